@@ -90,12 +90,17 @@ void Mixer::mix(sample_t* buffer, int start, int length, float volume_to, float
 
 	length = (std::min(m_length, length + start) - start);
 
+	const int channels = m_specs.channels;
+	const float volume_step = (volume_to - volume_from) / float(length);
+
+	out += start * channels;
+
 	for(int i = 0; i < length; i++)
 	{
-		float volume = volume_from * (1.0f - i / float(length)) + volume_to * (i / float(length));
+		float volume = volume_from + volume_step * i;
 
-		for(int c = 0; c < m_specs.channels; c++)
-			out[(i + start) * m_specs.channels + c] += buffer[i * m_specs.channels + c] * volume;
+		for(int c = 0; c < channels; c++)
+			out[i * channels + c] += buffer[i * channels + c] * volume;
 	}
 }
 
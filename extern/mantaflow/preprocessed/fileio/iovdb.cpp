@@ -20,6 +20,7 @@
 #include <fstream>
 #include <cstdlib>
 #include <cstring>
+#include <set>
 
 #include "mantaio.h"
 #include "grid.h"
@@ -593,6 +594,7 @@ int readObjectsVDB(const string &filename, std::vector<PbClass *> *objects, floa
   openvdb::initialize();
   openvdb::io::File file(filename);
   openvdb::GridPtrVec gridsVDB;
+  size_t fileGridCount = 0;
 
   // Register custom codecs, this makes sure custom attributes can be read
   registerCustomCodecs();
@@ -600,7 +602,26 @@ int readObjectsVDB(const string &filename, std::vector<PbClass *> *objects, floa
   try {
     file.setCopyMaxBytes(0);
     file.open();
-    gridsVDB = *(file.getGrids());
+
+    // Only read the grids of the requested objects. Files can contain more grids than needed,
+    // e.g. the ones that are only used to resume a bake.
+    std::set<std::string> objectNames;
+    for (PbClass *object : *objects) {
+      objectNames.insert(object->getName());
+    }
+    for (openvdb::io::File::NameIterator it = file.beginName(); it != file.endName(); ++it) {
+      fileGridCount++;
+    }
+    if (fileGridCount == 1) {
+      gridsVDB = *(file.getGrids());
+    }
+    else {
+      for (openvdb::io::File::NameIterator it = file.beginName(); it != file.endName(); ++it) {
+        if (objectNames.count(it.gridName())) {
+          gridsVDB.push_back(file.readGrid(it.gridName()));
+        }
+      }
+    }
     openvdb::MetaMap::Ptr metadata = file.getMetadata();
     unusedParameter(metadata);  // Unused for now
   }
@@ -625,7 +646,7 @@ int readObjectsVDB(const string &filename, std::vector<PbClass *> *objects, floa
     }
     // If there is just one grid in this file, load it regardless of name match (to vdb caches per
     // grid).
-    const bool onlyGrid = (gridsVDB.size() == 1);
+    const bool onlyGrid = (fileGridCount == 1);
 
     PbClass *object = dynamic_cast<PbClass *>(*iter);
     const Real dx = object->getParent()->getDx();
@@ -801,6 +801,36 @@ class CyclesRenderSettings(bpy.types.PropertyGroup):
         items=enum_texture_limit
     )
 
+    texture_memory_limit: IntProperty(
+        name="Viewport Texture Memory Limit",
+        description="Maximum memory in megabytes used by image textures for viewport rendering, "
+        "the largest images are loaded at a lower resolution to stay within it (0 for no limit)",
+        default=0,
+        min=0, max=(1 << 20),
+    )
+
+    texture_memory_limit_render: IntProperty(
+        name="Render Texture Memory Limit",
+        description="Maximum memory in megabytes used by image textures for final rendering, "
+        "the largest images are loaded at a lower resolution to stay within it (0 for no limit)",
+        default=0,
+        min=0, max=(1 << 20),
+    )
+
+    texture_half_float: BoolProperty(
+        name="Viewport Half Float Textures",
+        description="Store float image textures as half float for viewport rendering when their "
+        "values fit, halving memory usage and bandwidth at reduced precision",
+        default=False,
+    )
+
+    texture_half_float_render: BoolProperty(
+        name="Render Half Float Textures",
+        description="Store float image textures as half float for final rendering when their "
+        "values fit, halving memory usage and bandwidth at reduced precision",
+        default=False,
+    )
+
     ao_bounces: IntProperty(
         name="AO Bounces",
         default=0,
@@ -2038,6 +2038,8 @@ class CYCLES_RENDER_PT_simplify_viewport(CyclesButtonsPanel, Panel):
         col.prop(rd, "simplify_subdivision", text="Max Subdivision")
         col.prop(rd, "simplify_child_particles", text="Child Particles")
         col.prop(cscene, "texture_limit", text="Texture Limit")
+        col.prop(cscene, "texture_memory_limit", text="Texture Memory Limit")
+        col.prop(cscene, "texture_half_float", text="Half Float Textures")
         col.prop(cscene, "ao_bounces", text="AO Bounces")
         col.prop(rd, "simplify_volumes", text="Volume Resolution")
 
@@ -2064,6 +2066,8 @@ class CYCLES_RENDER_PT_simplify_render(CyclesButtonsPanel, Panel):
         col.prop(rd, "simplify_subdivision_render", text="Max Subdivision")
         col.prop(rd, "simplify_child_particles_render", text="Child Particles")
         col.prop(cscene, "texture_limit_render", text="Texture Limit")
+        col.prop(cscene, "texture_memory_limit_render", text="Texture Memory Limit")
+        col.prop(cscene, "texture_half_float_render", text="Half Float Textures")
         col.prop(cscene, "ao_bounces_render", text="AO Bounces")
 
 
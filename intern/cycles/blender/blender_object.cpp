@@ -184,9 +184,11 @@ Object *BlenderSync::sync_object(BL::Depsgraph &b_depsgraph,
     return NULL;
   }
 
-  /* Use task pool only for non-instances, since sync_dupli_particle accesses
-   * geometry. This restriction should be removed for better performance. */
-  TaskPool *object_geom_task_pool = (is_instance) ? NULL : geom_task_pool;
+  /* Use task pool for everything except particle instances, since sync_dupli_particle accesses
+   * geometry. Other instances sync their geometry from the original object, which remains valid
+   * for the deferred sync, so large sets of instanced collections are synced in parallel too. */
+  const bool is_particle_instance = is_instance && b_instance.particle_system();
+  TaskPool *object_geom_task_pool = (is_particle_instance) ? NULL : geom_task_pool;
 
   /* key to lookup object */
   ObjectKey key(b_parent, persistent_id, b_ob_instance, use_particle_hair);
@@ -517,6 +517,8 @@ void BlenderSession::render(BL::Depsgraph &b_depsgraph_)
     num_views++;
   }
 
+  string render_stats_json;
+
   int view_index = 0;
   for (b_rr.views.begin(b_view_iter); b_view_iter != b_rr.views.end();
        ++b_view_iter, ++view_index) {
@@ -578,6 +580,7 @@ void BlenderSession::render(BL::Depsgraph &b_depsgraph_)
       RenderStats stats;
       session->collect_statistics(&stats);
       printf("Render statistics:\n%s\n", stats.full_report().c_str());
+      render_stats_json = stats.json_report();
     }
 
     if (session->progress.get_cancel())
@@ -587,6 +590,13 @@ void BlenderSession::render(BL::Depsgraph &b_depsgraph_)
   /* add metadata */
   stamp_view_layer_metadata(scene, b_rlay_name);
 
+  /* Store profiling statistics with the render result, so the cost of shaders and objects
+   * can be inspected after rendering. */
+  if (!render_stats_json.empty()) {
+    b_engine.get_result().stamp_data_add_field(
+        ("cycles." + b_rlay_name + ".profiling").c_str(), render_stats_json.c_str());
+  }
+
   /* free result without merging */
   end_render_result(b_engine, b_rr, true, true, false);
 
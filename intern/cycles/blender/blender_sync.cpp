@@ -800,6 +800,20 @@ SceneParams BlenderSync::get_scene_params(BL::Scene &b_scene, bool background)
     params.texture_limit = 0;
   }
 
+  const int texture_memory_limit = (background) ?
+                                       get_int(cscene, "texture_memory_limit_render") :
+                                       get_int(cscene, "texture_memory_limit");
+  if (texture_memory_limit > 0 && b_scene.render().use_simplify()) {
+    params.texture_memory_limit = (size_t)texture_memory_limit * 1024 * 1024;
+  }
+  else {
+    params.texture_memory_limit = 0;
+  }
+
+  params.texture_half_float = b_scene.render().use_simplify() &&
+                              ((background) ? get_boolean(cscene, "texture_half_float_render") :
+                                              get_boolean(cscene, "texture_half_float"));
+
   params.bvh_layout = DebugFlags().cpu.bvh_layout;
 
   params.background = background;
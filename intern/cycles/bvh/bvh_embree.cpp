@@ -340,6 +340,9 @@ void BVHEmbree::build(Progress &progress, Stats *stats, RTCDevice rtc_device_)
                                                         RTC_BUILD_QUALITY_MEDIUM);
   rtcSetSceneBuildQuality(scene, build_quality);
 
+  geometry_attached.clear();
+  geometry_attached.resize(objects.size() * 2, false);
+
   int i = 0;
   foreach (Object *ob, objects) {
     if (params.top_level) {
@@ -389,6 +392,17 @@ void BVHEmbree::add_object(Object *ob, int i)
 }
 
 void BVHEmbree::add_instance(Object *ob, int i)
+{
+  RTCGeometry geom_id = rtcNewGeometry(rtc_device, RTC_GEOMETRY_TYPE_INSTANCE);
+  set_instance(geom_id, ob);
+
+  rtcCommitGeometry(geom_id);
+  rtcAttachGeometryByID(scene, geom_id, i * 2);
+  geometry_attached[i * 2] = true;
+  rtcReleaseGeometry(geom_id);
+}
+
+void BVHEmbree::set_instance(RTCGeometry geom_id, const Object *ob)
 {
   BVHEmbree *instance_bvh = (BVHEmbree *)(ob->get_geometry()->bvh);
   assert(instance_bvh != NULL);
@@ -397,7 +411,6 @@ void BVHEmbree::add_instance(Object *ob, int i)
   const size_t num_motion_steps = min(num_object_motion_steps, RTC_MAX_TIME_STEP_COUNT);
   assert(num_object_motion_steps <= RTC_MAX_TIME_STEP_COUNT);
 
-  RTCGeometry geom_id = rtcNewGeometry(rtc_device, RTC_GEOMETRY_TYPE_INSTANCE);
   rtcSetGeometryInstancedScene(geom_id, instance_bvh->scene);
   rtcSetGeometryTimeStepCount(geom_id, num_motion_steps);
 
@@ -425,10 +438,6 @@ void BVHEmbree::add_instance(Object *ob, int i)
 
   rtcSetGeometryUserData(geom_id, (void *)instance_bvh->scene);
   rtcSetGeometryMask(geom_id, ob->visibility_for_tracing());
-
-  rtcCommitGeometry(geom_id);
-  rtcAttachGeometryByID(scene, geom_id, i * 2);
-  rtcReleaseGeometry(geom_id);
 }
 
 void BVHEmbree::add_triangles(const Object *ob, const Mesh *mesh, int i)
@@ -476,6 +485,7 @@ void BVHEmbree::add_triangles(const Object *ob, const Mesh *mesh, int i)
 
   rtcCommitGeometry(geom_id);
   rtcAttachGeometryByID(scene, geom_id, i * 2);
+  geometry_attached[i * 2] = true;
   rtcReleaseGeometry(geom_id);
 }
 
@@ -661,25 +671,73 @@ void BVHEmbree::add_curves(const Object *ob, const Hair *hair, int i)
 
   rtcCommitGeometry(geom_id);
   rtcAttachGeometryByID(scene, geom_id, i * 2 + 1);
+  geometry_attached[i * 2 + 1] = true;
   rtcReleaseGeometry(geom_id);
 }
 
+bool BVHEmbree::can_refit() const
+{
+  if (scene == NULL || geometry_attached.size() != objects.size() * 2) {
+    return false;
+  }
+
+  /* The same Embree geometries must exist as when building, which is not the case anymore when
+   * objects became (in)visible to rays or geometry became empty. */
+  unsigned geom_id = 0;
+  foreach (Object *ob, objects) {
+    bool has_triangles = false, has_curves = false;
+
+    if (!params.top_level || ob->is_traceable()) {
+      Geometry *geom = ob->get_geometry();
+
+      if (params.top_level && geom->is_instanced()) {
+        has_triangles = true;
+      }
+      else if (geom->geometry_type == Geometry::MESH || geom->geometry_type == Geometry::VOLUME) {
+        has_triangles = static_cast<Mesh *>(geom)->num_triangles() > 0;
+      }
+      else if (geom->geometry_type == Geometry::HAIR) {
+        has_curves = static_cast<Hair *>(geom)->num_curves() > 0;
+      }
+    }
+
+    if (has_triangles != geometry_attached[geom_id] ||
+        has_curves != geometry_attached[geom_id + 1]) {
+      return false;
+    }
+    geom_id += 2;
+  }
+
+  return true;
+}
+
 void BVHEmbree::refit(Progress &progress)
 {
   progress.set_substatus("Refitting BVH nodes");
 
-  /* Update all vertex buffers, then tell Embree to rebuild/-fit the BVHs. */
+  /* Update the vertex buffers of modified geometry and the instance transforms, then tell Embree
+   * to rebuild/-fit the BVHs. Meshes are refitted since their topology did not change, so for
+   * rigid animation of instances only the top level BVH is rebuilt. */
   unsigned geom_id = 0;
   foreach (Object *ob, objects) {
-    if (!params.top_level || (ob->is_traceable() && !ob->get_geometry()->is_instanced())) {
+    if (!params.top_level || ob->is_traceable()) {
       Geometry *geom = ob->get_geometry();
 
-      if (geom->geometry_type == Geometry::MESH || geom->geometry_type == Geometry::VOLUME) {
+      if (params.top_level && geom->is_instanced()) {
+        RTCGeometry geom = rtcGetGeometry(scene, geom_id);
+        set_instance(geom, ob);
+        rtcCommitGeometry(geom);
+      }
+      else if (geom->geometry_type == Geometry::MESH || geom->geometry_type == Geometry::VOLUME) {
         Mesh *mesh = static_cast<Mesh *>(geom);
         if (mesh->num_triangles() > 0) {
           RTCGeometry geom = rtcGetGeometry(scene, geom_id);
-          set_tri_vertex_buffer(geom, mesh, true);
+          if (mesh->is_modified()) {
+            set_tri_vertex_buffer(geom, mesh, true);
+          }
+          rtcSetGeometryBuildQuality(geom, RTC_BUILD_QUALITY_REFIT);
           rtcSetGeometryUserData(geom, (void *)mesh->optix_prim_offset);
+          rtcSetGeometryMask(geom, ob->visibility_for_tracing());
           rtcCommitGeometry(geom);
         }
       }
@@ -689,6 +747,7 @@ void BVHEmbree::refit(Progress &progress)
           RTCGeometry geom = rtcGetGeometry(scene, geom_id + 1);
           set_curve_vertex_buffer(geom, hair, true);
           rtcSetGeometryUserData(geom, (void *)hair->optix_prim_offset);
+          rtcSetGeometryMask(geom, ob->visibility_for_tracing());
           rtcCommitGeometry(geom);
         }
       }
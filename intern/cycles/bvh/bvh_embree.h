@@ -38,6 +38,7 @@ class BVHEmbree : public BVH {
  public:
   void build(Progress &progress, Stats *stats, RTCDevice rtc_device);
   void refit(Progress &progress);
+  bool can_refit() const;
 
   RTCScene scene;
 
@@ -53,12 +54,17 @@ class BVHEmbree : public BVH {
   void add_curves(const Object *ob, const Hair *hair, int i);
   void add_triangles(const Object *ob, const Mesh *mesh, int i);
 
+  void set_instance(RTCGeometry geom_id, const Object *ob);
+
  private:
   void set_tri_vertex_buffer(RTCGeometry geom_id, const Mesh *mesh, const bool update);
   void set_curve_vertex_buffer(RTCGeometry geom_id, const Hair *hair, const bool update);
 
   RTCDevice rtc_device;
   enum RTCBuildQuality build_quality;
+
+  /* Which of the two geometry IDs of each object got geometry attached when building. */
+  vector<bool> geometry_attached;
 };
 
 CCL_NAMESPACE_END
@@ -930,19 +930,27 @@ CUDADevice::CUDAMem *CUDADevice::generic_alloc(device_memory &mem, size_t pitch_
 }
 
 void CUDADevice::generic_copy_to(device_memory &mem)
+{
+  generic_copy_to(mem, 0, mem.memory_size());
+}
+
+void CUDADevice::generic_copy_to(device_memory &mem, size_t offset, size_t size)
 {
   if (!mem.host_pointer || !mem.device_pointer) {
     return;
   }
 
+  assert(offset + size <= mem.memory_size());
+
   /* If use_mapped_host of mem is false, the current device only uses device memory allocated by
    * cuMemAlloc regardless of mem.host_pointer and mem.shared_pointer, and should copy data from
    * mem.host_pointer. */
   thread_scoped_lock lock(cuda_mem_map_mutex);
   if (!cuda_mem_map[&mem].use_mapped_host || mem.host_pointer != mem.shared_pointer) {
     const CUDAContextScope scope(this);
-    cuda_assert(
-        cuMemcpyHtoD((CUdeviceptr)mem.device_pointer, mem.host_pointer, mem.memory_size()));
+    cuda_assert(cuMemcpyHtoD((CUdeviceptr)(mem.device_pointer + offset),
+                             (const char *)mem.host_pointer + offset,
+                             size));
   }
 }
 
@@ -1020,6 +1028,19 @@ void CUDADevice::mem_copy_to(device_memory &mem)
   }
 }
 
+void CUDADevice::mem_copy_to_range(device_memory &mem, size_t offset, size_t size)
+{
+  /* Global memory keeps its pointer in kernel globals valid as long as the allocation does not
+   * change, so the range can be copied into it directly. */
+  if (mem.device_pointer && mem.device_size == mem.memory_size() &&
+      (mem.type == MEM_GLOBAL || mem.type == MEM_READ_ONLY || mem.type == MEM_READ_WRITE)) {
+    generic_copy_to(mem, offset, size);
+  }
+  else {
+    mem_copy_to(mem);
+  }
+}
+
 void CUDADevice::mem_copy_from(device_memory &mem, int y, int w, int h, int elem)
 {
   if (mem.type == MEM_PIXELS && !background) {
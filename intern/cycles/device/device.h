@@ -485,6 +485,12 @@ class Device {
 
   virtual void mem_alloc(device_memory &mem) = 0;
   virtual void mem_copy_to(device_memory &mem) = 0;
+  /* Copy a byte range of the host memory to the existing device allocation. Devices without
+   * support for this copy the whole memory. */
+  virtual void mem_copy_to_range(device_memory &mem, size_t /*offset*/, size_t /*size*/)
+  {
+    mem_copy_to(mem);
+  }
   virtual void mem_copy_from(device_memory &mem, int y, int w, int h, int elem) = 0;
   virtual void mem_zero(device_memory &mem) = 0;
   virtual void mem_free(device_memory &mem) = 0;
@@ -555,7 +555,7 @@ class CPUDevice : public Device {
     if (bvh->params.bvh_layout == BVH_LAYOUT_EMBREE ||
         bvh->params.bvh_layout == BVH_LAYOUT_MULTI_OPTIX_EMBREE) {
       BVHEmbree *const bvh_embree = static_cast<BVHEmbree *>(bvh);
-      if (refit) {
+      if (refit && bvh_embree->can_refit()) {
         bvh_embree->refit(progress);
       }
       else {
@@ -1626,7 +1626,9 @@ int2 CPUSplitKernel::split_kernel_global_size(device_memory & /*kg*/,
                                               device_memory & /*data*/,
                                               DeviceTask & /*task*/)
 {
-  return make_int2(1, 1);
+  /* Number of paths each thread keeps in flight. Every kernel stage loops over all of them,
+   * and shader sorting groups them by shader before evaluation for coherence. */
+  return make_int2(16, 16);
 }
 
 uint64_t CPUSplitKernel::state_buffer_size(device_memory &kernel_globals,
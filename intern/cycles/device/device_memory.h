@@ -253,6 +253,7 @@ class device_memory {
   void device_alloc();
   void device_free();
   void device_copy_to();
+  void device_copy_to(size_t offset, size_t size);
   void device_copy_from(int y, int w, int h, int elem);
   void device_zero();
 
@@ -332,6 +333,8 @@ template<typename T> class device_vector : public device_memory {
     data_type = device_type_traits<T>::data_type;
     data_elements = device_type_traits<T>::num_elements;
     modified = true;
+    modified_begin_ = 0;
+    modified_end_ = SIZE_MAX;
     need_realloc_ = true;
 
     assert(data_elements > 0);
@@ -351,7 +354,7 @@ template<typename T> class device_vector : public device_memory {
       device_free();
       host_free();
       host_pointer = host_alloc(sizeof(T) * new_size);
-      modified = true;
+      tag_modified();
       assert(device_pointer == 0);
     }
 
@@ -429,7 +432,7 @@ template<typename T> class device_vector : public device_memory {
     data_height = 0;
     data_depth = 0;
     host_pointer = 0;
-    modified = true;
+    tag_modified();
     need_realloc_ = true;
     assert(device_pointer == 0);
   }
@@ -454,6 +457,28 @@ template<typename T> class device_vector : public device_memory {
   void tag_modified()
   {
     modified = true;
+    modified_begin_ = 0;
+    modified_end_ = SIZE_MAX;
+  }
+
+  /* Tag only a range of elements as modified. As long as the device allocation stays the same,
+   * copy_to_device_if_modified() then only copies the elements in between the first and last
+   * modified element. */
+  void tag_modified(size_t offset, size_t num)
+  {
+    if (num == 0) {
+      return;
+    }
+
+    if (modified) {
+      modified_begin_ = (offset < modified_begin_) ? offset : modified_begin_;
+      modified_end_ = (offset + num > modified_end_) ? offset + num : modified_end_;
+    }
+    else {
+      modified = true;
+      modified_begin_ = offset;
+      modified_end_ = offset + num;
+    }
   }
 
   void tag_realloc()
@@ -491,12 +516,23 @@ template<typename T> class device_vector : public device_memory {
       return;
     }
 
+    const bool copy_range = device_pointer != 0 && !need_realloc_ &&
+                            modified_end_ <= data_size &&
+                            (modified_begin_ != 0 || modified_end_ != data_size);
+    if (copy_range) {
+      device_copy_to(memory_elements_size(modified_begin_),
+                     memory_elements_size(modified_end_ - modified_begin_));
+      return;
+    }
+
     copy_to_device();
   }
 
   void clear_modified()
   {
     modified = false;
+    modified_begin_ = 0;
+    modified_end_ = 0;
     need_realloc_ = false;
   }
 
@@ -528,6 +564,10 @@ template<typename T> class device_vector : public device_memory {
   {
     return width * ((height == 0) ? 1 : height) * ((depth == 0) ? 1 : depth);
   }
+
+  /* Range of modified elements, the whole vector unless tagged with tag_modified(offset, num). */
+  size_t modified_begin_;
+  size_t modified_end_;
 };
 
 /* Pixel Memory
@@ -436,6 +436,34 @@ class MultiDevice : public Device {
     stats.mem_alloc(mem.device_size - existing_size);
   }
 
+  void mem_copy_to_range(device_memory &mem, size_t offset, size_t size) override
+  {
+    device_ptr existing_key = mem.device_pointer;
+
+    /* Tile buffers and memory not on the devices yet need the full copy. */
+    if (!existing_key || strcmp(mem.name, "RenderBuffers") == 0) {
+      mem_copy_to(mem);
+      return;
+    }
+
+    size_t existing_size = mem.device_size;
+
+    /* The allocation does not change, so only the owning device of each island needs the data,
+     * pointers in kernel globals of the other devices remain valid. */
+    foreach (const vector<SubDevice *> &island, peer_islands) {
+      SubDevice *owner_sub = find_suitable_mem_device(existing_key, island);
+      mem.device = owner_sub->device;
+      mem.device_pointer = owner_sub->ptr_map[existing_key];
+      mem.device_size = existing_size;
+
+      owner_sub->device->mem_copy_to_range(mem, offset, size);
+    }
+
+    mem.device = this;
+    mem.device_pointer = existing_key;
+    mem.device_size = existing_size;
+  }
+
   void mem_copy_from(device_memory &mem, int y, int w, int h, int elem) override
   {
     device_ptr key = mem.device_pointer;
@@ -20,6 +20,7 @@
 
 #include "util/util_foreach.h"
 #include "util/util_logging.h"
+#include "util/util_murmurhash.h"
 
 #if defined(WITH_NETWORK)
 
@@ -28,6 +29,22 @@ CCL_NAMESPACE_BEGIN
 typedef map<device_ptr, device_ptr> PtrMap;
 typedef vector<uint8_t> DataVector;
 typedef map<device_ptr, DataVector> DataMap;
+typedef map<device_ptr, uint32_t> HashMap;
+
+/* hash of a memory buffer, to detect unchanged data that need not be sent again */
+static uint32_t mem_data_hash(const void *data, size_t size)
+{
+  const size_t chunk_size = (size_t)1 << 30;
+  const uint8_t *p = (const uint8_t *)data;
+  uint32_t hash = (uint32_t)size;
+
+  for (size_t offset = 0; offset < size; offset += chunk_size) {
+    const size_t len = min(chunk_size, size - offset);
+    hash = util_murmur_hash3(p + offset, (int)len, hash);
+  }
+
+  return hash;
+}
 
 /* tile list */
 typedef vector<RenderTile> TileList;
@@ -48,6 +65,9 @@ class NetworkDevice : public Device {
   device_ptr mem_counter;
   DeviceTask the_task; /* todo: handle multiple tasks */
 
+  /* hash of the data last sent for each buffer that is known to be on the server */
+  HashMap mem_hash;
+
   thread_mutex rpc_lock;
 
   virtual bool show_samples() const
@@ -101,6 +121,7 @@ class NetworkDevice : public Device {
     thread_scoped_lock lock(rpc_lock);
 
     mem.device_pointer = ++mem_counter;
+    mem_hash.erase(mem.device_pointer);
 
     RPCSend snd(socket, &error_func, "mem_alloc");
     snd.add(mem);
@@ -111,11 +132,27 @@ class NetworkDevice : public Device {
   {
     thread_scoped_lock lock(rpc_lock);
 
+    /* skip sending data the server already has, only for memory the device does not
+     * write to */
+    const bool use_hash = (mem.type == MEM_READ_ONLY || mem.type == MEM_GLOBAL ||
+                           mem.type == MEM_TEXTURE);
+    const uint32_t hash = (use_hash) ? mem_data_hash(mem.host_pointer, mem.memory_size()) : 0;
+    if (use_hash && mem.device_pointer) {
+      HashMap::iterator it = mem_hash.find(mem.device_pointer);
+      if (it != mem_hash.end() && it->second == hash) {
+        return;
+      }
+    }
+
     RPCSend snd(socket, &error_func, "mem_copy_to");
 
     snd.add(mem);
     snd.write();
     snd.write_buffer(mem.host_pointer, mem.memory_size());
+
+    if (use_hash && mem.device_pointer) {
+      mem_hash[mem.device_pointer] = hash;
+    }
   }
 
   void mem_copy_from(device_memory &mem, int y, int w, int h, int elem)
@@ -145,6 +182,8 @@ class NetworkDevice : public Device {
 
     snd.add(mem);
     snd.write();
+
+    mem_hash.erase(mem.device_pointer);
   }
 
   void mem_free(device_memory &mem)
@@ -157,6 +196,7 @@ class NetworkDevice : public Device {
       snd.add(mem);
       snd.write();
 
+      mem_hash.erase(mem.device_pointer);
       mem.device_pointer = 0;
     }
   }
@@ -153,7 +153,7 @@ ccl_device_inline bool lamp_light_sample(
     }
   }
 
-  ls->pdf *= kernel_data.integrator.pdf_lights;
+  ls->pdf *= kernel_data.integrator.pdf_lights * klight->select_weight;
 
   return (ls->pdf > 0.0f);
 }
@@ -291,7 +291,7 @@ ccl_device bool lamp_light_eval(
     return false;
   }
 
-  ls->pdf *= kernel_data.integrator.pdf_lights;
+  ls->pdf *= kernel_data.integrator.pdf_lights * klight->select_weight;
 
   return true;
 }
@@ -665,4 +665,9 @@ ccl_device_inline int light_select_num_samples(KernelGlobals *kg, int index)
   return kernel_tex_fetch(__lights, index).samples;
 }
 
+ccl_device_inline float light_select_weight(KernelGlobals *kg, int index)
+{
+  return kernel_tex_fetch(__lights, index).select_weight;
+}
+
 CCL_NAMESPACE_END
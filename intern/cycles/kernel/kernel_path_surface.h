@@ -51,6 +51,7 @@ ccl_device_noinline_cpu void kernel_branched_path_surface_connect_light(
     /* sample one light at random */
     int num_samples = 1;
     int num_all_lights = 1;
+    float select_weight = 1.0f;
     uint lamp_rng_hash = state->rng_hash;
     bool double_pdf = false;
     bool is_mesh_light = false;
@@ -65,6 +66,7 @@ ccl_device_noinline_cpu void kernel_branched_path_surface_connect_light(
         }
         num_samples = ceil_to_int(num_samples_adjust * light_select_num_samples(kg, i));
         num_all_lights = kernel_data.integrator.num_all_lights;
+        select_weight = light_select_weight(kg, i);
         lamp_rng_hash = cmj_hash(state->rng_hash, i);
         double_pdf = kernel_data.integrator.pdf_triangles != 0.0f;
       }
@@ -76,7 +78,9 @@ ccl_device_noinline_cpu void kernel_branched_path_surface_connect_light(
       }
     }
 
-    float num_samples_inv = num_samples_adjust / (num_samples * num_all_lights);
+    /* All lamps are sampled here, compensate for the lamp pdf including the probability of
+     * selecting the lamp. */
+    float num_samples_inv = num_samples_adjust * select_weight / (num_samples * num_all_lights);
 
     for (int j = 0; j < num_samples; j++) {
       Ray light_ray ccl_optional_struct_init;
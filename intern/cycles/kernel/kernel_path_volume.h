@@ -153,6 +153,7 @@ ccl_device void kernel_branched_path_volume_connect_light(KernelGlobals *kg,
     /* sample one light at random */
     int num_samples = 1;
     int num_all_lights = 1;
+    float select_weight = 1.0f;
     uint lamp_rng_hash = state->rng_hash;
     bool double_pdf = false;
     bool is_mesh_light = false;
@@ -167,6 +168,7 @@ ccl_device void kernel_branched_path_volume_connect_light(KernelGlobals *kg,
         }
         num_samples = light_select_num_samples(kg, i);
         num_all_lights = kernel_data.integrator.num_all_lights;
+        select_weight = light_select_weight(kg, i);
         lamp_rng_hash = cmj_hash(state->rng_hash, i);
         double_pdf = kernel_data.integrator.pdf_triangles != 0.0f;
       }
@@ -178,7 +180,7 @@ ccl_device void kernel_branched_path_volume_connect_light(KernelGlobals *kg,
       }
     }
 
-    float num_samples_inv = 1.0f / (num_samples * num_all_lights);
+    float num_samples_inv = select_weight / (num_samples * num_all_lights);
 
     for (int j = 0; j < num_samples; j++) {
       Ray light_ray ccl_optional_struct_init;
@@ -1521,7 +1521,7 @@ typedef struct KernelLight {
   float max_bounces;
   float random;
   float strength[3];
-  float pad1;
+  float select_weight;
   Transform tfm;
   Transform itfm;
   union {
@@ -54,7 +54,6 @@ ccl_device void kernel_shader_sort(KernelGlobals *kg, ccl_local_param ShaderSort
   }
   ccl_barrier(CCL_LOCAL_MEM_FENCE);
 
-  /* skip sorting for cpu split kernel */
 #  ifdef __KERNEL_OPENCL__
 
   /* bitonic sort */
@@ -77,6 +76,27 @@ ccl_device void kernel_shader_sort(KernelGlobals *kg, ccl_local_param ShaderSort
       }
     }
   }
+#  else
+  /* Same bitonic sort on the CPU, where a single thread sorts the whole block. Each pair of
+   * elements is compared and swapped once, from its lower index. */
+  for (uint length = 1; length < SHADER_SORT_BLOCK_SIZE; length <<= 1) {
+    for (uint inc = length; inc > 0; inc >>= 1) {
+      for (uint i = 0; i < SHADER_SORT_BLOCK_SIZE; i++) {
+        uint j = i ^ inc;
+        if (j < i) {
+          continue;
+        }
+        bool direction = ((i & (length << 1)) != 0);
+        ushort ioff = local_index[i];
+        ushort joff = local_index[j];
+        uint iKey = local_value[ioff];
+        uint jKey = local_value[joff];
+        bool swap = (jKey < iKey) ^ direction;
+        local_index[i] = (swap) ? joff : ioff;
+        local_index[j] = (swap) ? ioff : joff;
+      }
+    }
+  }
 #  endif /* __KERNEL_OPENCL__ */
 
   /* copy to destination */
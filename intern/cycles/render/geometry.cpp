@@ -610,6 +610,7 @@ void GeometryManager::update_attribute_element_offset(Geometry *geom,
         for (size_t k = 0; k < size; k++) {
           attr_uchar4[offset + k] = data[k];
         }
+        attr_uchar4.tag_modified(offset, size);
       }
       attr_uchar4_offset += size;
     }
@@ -622,6 +623,7 @@ void GeometryManager::update_attribute_element_offset(Geometry *geom,
         for (size_t k = 0; k < size; k++) {
           attr_float[offset + k] = data[k];
         }
+        attr_float.tag_modified(offset, size);
       }
       attr_float_offset += size;
     }
@@ -634,6 +636,7 @@ void GeometryManager::update_attribute_element_offset(Geometry *geom,
         for (size_t k = 0; k < size; k++) {
           attr_float2[offset + k] = data[k];
         }
+        attr_float2.tag_modified(offset, size);
       }
       attr_float2_offset += size;
     }
@@ -646,6 +649,7 @@ void GeometryManager::update_attribute_element_offset(Geometry *geom,
         for (size_t k = 0; k < size * 3; k++) {
           attr_float3[offset + k] = (&tfm->x)[k];
         }
+        attr_float3.tag_modified(offset, size * 3);
       }
       attr_float3_offset += size * 3;
     }
@@ -658,6 +662,7 @@ void GeometryManager::update_attribute_element_offset(Geometry *geom,
         for (size_t k = 0; k < size; k++) {
           attr_float3[offset + k] = data[k];
         }
+        attr_float3.tag_modified(offset, size);
       }
       attr_float3_offset += size;
     }
@@ -933,10 +938,10 @@ void GeometryManager::device_update_attributes(Device *device,
   /* copy to device */
   progress.set_status("Updating Mesh", "Copying Attributes to device");
 
-  dscene->attributes_float.copy_to_device();
-  dscene->attributes_float2.copy_to_device();
-  dscene->attributes_float3.copy_to_device();
-  dscene->attributes_uchar4.copy_to_device();
+  dscene->attributes_float.copy_to_device_if_modified();
+  dscene->attributes_float2.copy_to_device_if_modified();
+  dscene->attributes_float3.copy_to_device_if_modified();
+  dscene->attributes_uchar4.copy_to_device_if_modified();
 
   if (progress.get_cancel())
     return;
@@ -1099,13 +1104,20 @@ void GeometryManager::device_update_mesh(
       if (geom->geometry_type == Geometry::MESH || geom->geometry_type == Geometry::VOLUME) {
         Mesh *mesh = static_cast<Mesh *>(geom);
 
+        const size_t num_verts = mesh->verts.size();
+        const size_t num_triangles = mesh->num_triangles();
+
+        /* Only the ranges of the packed meshes are copied to the device, unless the arrays were
+         * reallocated. */
         if (mesh->shader_is_modified() || mesh->smooth_is_modified() ||
             mesh->triangles_is_modified() || copy_all_data) {
           mesh->pack_shaders(scene, &tri_shader[mesh->prim_offset]);
+          dscene->tri_shader.tag_modified(mesh->prim_offset, num_triangles);
         }
 
         if (mesh->verts_is_modified() || copy_all_data) {
           mesh->pack_normals(&vnormal[mesh->vert_offset]);
+          dscene->tri_vnormal.tag_modified(mesh->vert_offset, num_verts);
         }
 
         if (mesh->triangles_is_modified() || mesh->vert_patch_uv_is_modified() || copy_all_data) {
@@ -1115,6 +1127,9 @@ void GeometryManager::device_update_mesh(
                            &tri_patch_uv[mesh->vert_offset],
                            mesh->vert_offset,
                            mesh->prim_offset);
+          dscene->tri_vindex.tag_modified(mesh->prim_offset, num_triangles);
+          dscene->tri_patch.tag_modified(mesh->prim_offset, num_triangles);
+          dscene->tri_patch_uv.tag_modified(mesh->vert_offset, num_verts);
         }
 
         if (progress.get_cancel())
@@ -1157,6 +1172,8 @@ void GeometryManager::device_update_mesh(
                           &curve_keys[hair->curvekey_offset],
                           &curves[hair->prim_offset],
                           hair->curvekey_offset);
+        dscene->curve_keys.tag_modified(hair->curvekey_offset, hair->get_curve_keys().size());
+        dscene->curves.tag_modified(hair->prim_offset, hair->num_curves());
         if (progress.get_cancel())
           return;
       }
@@ -1232,14 +1249,22 @@ void GeometryManager::device_update_bvh(Device *device,
 
   VLOG(1) << "Using " << bvh_layout_name(bparams.bvh_layout) << " layout.";
 
+  /* The scene BVH is only kept when no geometry or objects were added or removed and no topology
+   * changed, so Embree can refit it and only rebuild the instance level of transformed objects. */
   const bool can_refit = scene->bvh != nullptr &&
-                         (bparams.bvh_layout == BVHLayout::BVH_LAYOUT_OPTIX);
+                         (bparams.bvh_layout == BVHLayout::BVH_LAYOUT_OPTIX ||
+                          bparams.bvh_layout == BVHLayout::BVH_LAYOUT_EMBREE ||
+                          bparams.bvh_layout == BVHLayout::BVH_LAYOUT_MULTI_OPTIX_EMBREE);
   const bool pack_all = scene->bvh == nullptr;
 
   BVH *bvh = scene->bvh;
   if (!scene->bvh) {
     bvh = scene->bvh = BVH::create(bparams, scene->geometry, scene->objects, device);
   }
+  else {
+    bvh->geometry = scene->geometry;
+    bvh->objects = scene->objects;
+  }
 
   device->build_bvh(bvh, progress, can_refit);
 
@@ -1595,49 +1620,27 @@ void GeometryManager::device_update_preprocess(Device *device, Scene *scene, Pro
     }
   }
 
+  /* Modified attributes and mesh or curve data without reallocation are tagged per geometry
+   * while packing, so only their ranges of the device arrays are copied. */
   if (device_update_flags & ATTR_FLOAT_NEEDS_REALLOC) {
     dscene->attributes_map.tag_realloc();
     dscene->attributes_float.tag_realloc();
   }
-  else if (device_update_flags & ATTR_FLOAT_MODIFIED) {
-    dscene->attributes_float.tag_modified();
-  }
 
   if (device_update_flags & ATTR_FLOAT2_NEEDS_REALLOC) {
     dscene->attributes_map.tag_realloc();
     dscene->attributes_float2.tag_realloc();
   }
-  else if (device_update_flags & ATTR_FLOAT2_MODIFIED) {
-    dscene->attributes_float2.tag_modified();
-  }
 
   if (device_update_flags & ATTR_FLOAT3_NEEDS_REALLOC) {
     dscene->attributes_map.tag_realloc();
     dscene->attributes_float3.tag_realloc();
   }
-  else if (device_update_flags & ATTR_FLOAT3_MODIFIED) {
-    dscene->attributes_float3.tag_modified();
-  }
 
   if (device_update_flags & ATTR_UCHAR4_NEEDS_REALLOC) {
     dscene->attributes_map.tag_realloc();
     dscene->attributes_uchar4.tag_realloc();
   }
-  else if (device_update_flags & ATTR_UCHAR4_MODIFIED) {
-    dscene->attributes_uchar4.tag_modified();
-  }
-
-  if (device_update_flags & DEVICE_MESH_DATA_MODIFIED) {
-    /* if anything else than vertices or shaders are modified, we would need to reallocate, so
-     * these are the only arrays that can be updated */
-    dscene->tri_vnormal.tag_modified();
-    dscene->tri_shader.tag_modified();
-  }
-
-  if (device_update_flags & DEVICE_CURVE_DATA_MODIFIED) {
-    dscene->curve_keys.tag_modified();
-    dscene->curves.tag_modified();
-  }
 
   need_flags_update = false;
 }
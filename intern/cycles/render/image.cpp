@@ -446,6 +446,7 @@ int ImageManager::add_image_slot(ImageLoader *loader,
   img->need_metadata = true;
   img->need_load = !(osl_texture_system && !img->loader->osl_filepath().empty());
   img->builtin = builtin;
+  img->texture_limit = 0;
   img->users = 1;
   img->mem = NULL;
 
@@ -646,6 +647,50 @@ bool ImageManager::file_load_image(Image *img, int texture_limit)
   return true;
 }
 
+void ImageManager::file_convert_to_half(Image *img, int slot)
+{
+  device_texture *mem = img->mem;
+  const size_t num_values = mem->data_size * mem->data_elements;
+  const float *pixels = (const float *)mem->host_pointer;
+
+  /* Keep full float precision when values do not fit in the half float range. */
+  for (size_t i = 0; i < num_values; i++) {
+    if (fabsf(pixels[i]) > 65504.0f) {
+      return;
+    }
+  }
+
+  const ImageDataType type = (mem->data_elements == 4) ? IMAGE_DATA_TYPE_HALF4 :
+                                                         IMAGE_DATA_TYPE_HALF;
+  img->mem_name = string_printf("__tex_image_%s_%03d", name_from_type(type), slot);
+  device_texture *half_mem = new device_texture(mem->device,
+                                                img->mem_name.c_str(),
+                                                slot,
+                                                type,
+                                                img->params.interpolation,
+                                                img->params.extension);
+  half_mem->info.use_transform_3d = mem->info.use_transform_3d;
+  half_mem->info.transform_3d = mem->info.transform_3d;
+
+  half *half_pixels;
+  {
+    thread_scoped_lock device_lock(device_mutex);
+    half_pixels = (half *)half_mem->alloc(mem->data_width, mem->data_height, mem->data_depth);
+  }
+
+  for (size_t i = 0; i < num_values; i++) {
+    half_pixels[i] = float_to_half(pixels[i]);
+  }
+
+  VLOG(1) << "Storing image " << img->loader->name() << " as half float.";
+
+  {
+    thread_scoped_lock device_lock(device_mutex);
+    delete mem;
+  }
+  img->mem = half_mem;
+}
+
 void ImageManager::device_load_image(Device *device, Scene *scene, int slot, Progress *progress)
 {
   if (progress->get_cancel()) {
@@ -656,7 +701,10 @@ void ImageManager::device_load_image(Device *device, Scene *scene, int slot, Pro
 
   progress->set_status("Updating Images", "Loading " + img->loader->name());
 
-  const int texture_limit = scene->params.texture_limit;
+  int texture_limit = scene->params.texture_limit;
+  if (img->texture_limit > 0 && (texture_limit == 0 || img->texture_limit < texture_limit)) {
+    texture_limit = img->texture_limit;
+  }
 
   load_image_metadata(img);
   ImageDataType type = img->metadata.type;
@@ -688,6 +736,9 @@ void ImageManager::device_load_image(Device *device, Scene *scene, int slot, Pro
       pixels[2] = TEX_IMAGE_MISSING_B;
       pixels[3] = TEX_IMAGE_MISSING_A;
     }
+    else if (scene->params.texture_half_float && has_half_images) {
+      file_convert_to_half(img, slot);
+    }
   }
   else if (type == IMAGE_DATA_TYPE_FLOAT) {
     if (!file_load_image<TypeDesc::FLOAT, float>(img, texture_limit)) {
@@ -697,6 +748,9 @@ void ImageManager::device_load_image(Device *device, Scene *scene, int slot, Pro
 
       pixels[0] = TEX_IMAGE_MISSING_R;
     }
+    else if (scene->params.texture_half_float && has_half_images) {
+      file_convert_to_half(img, slot);
+    }
   }
   else if (type == IMAGE_DATA_TYPE_BYTE4) {
     if (!file_load_image<TypeDesc::UINT8, uchar>(img, texture_limit)) {
@@ -808,6 +862,128 @@ void ImageManager::device_free_image(Device *, int slot)
   images[slot] = NULL;
 }
 
+/* Device memory for an image, with its resolution halved the given number of times. */
+static size_t image_device_memory_size(const ImageMetaData &metadata, const int level)
+{
+  size_t pixel_size = 0;
+  switch (metadata.type) {
+    case IMAGE_DATA_TYPE_FLOAT4:
+      pixel_size = sizeof(float4);
+      break;
+    case IMAGE_DATA_TYPE_BYTE4:
+      pixel_size = sizeof(uchar4);
+      break;
+    case IMAGE_DATA_TYPE_HALF4:
+      pixel_size = sizeof(half4);
+      break;
+    case IMAGE_DATA_TYPE_FLOAT:
+      pixel_size = sizeof(float);
+      break;
+    case IMAGE_DATA_TYPE_BYTE:
+      pixel_size = sizeof(uchar);
+      break;
+    case IMAGE_DATA_TYPE_HALF:
+      pixel_size = sizeof(half);
+      break;
+    case IMAGE_DATA_TYPE_USHORT4:
+      pixel_size = sizeof(ushort4);
+      break;
+    case IMAGE_DATA_TYPE_USHORT:
+      pixel_size = sizeof(uint16_t);
+      break;
+    default:
+      return metadata.byte_size;
+  }
+
+  const size_t width = max(metadata.width >> level, (size_t)1);
+  const size_t height = max(metadata.height >> level, (size_t)1);
+  const size_t depth = (metadata.depth > 1) ? max(metadata.depth >> level, (size_t)1) : 1;
+  return width * height * depth * pixel_size;
+}
+
+void ImageManager::update_texture_limits(Scene *scene)
+{
+  const size_t memory_limit = scene->params.texture_memory_limit;
+
+  /* Images that will be loaded, with the number of times their resolution is halved. */
+  vector<pair<Image *, int>> load_images;
+  size_t memory_used = 0;
+
+  for (size_t slot = 0; slot < images.size(); slot++) {
+    Image *img = images[slot];
+    if (img == NULL || img->users == 0) {
+      continue;
+    }
+    if (!img->need_load) {
+      memory_used += (img->mem) ? img->mem->memory_size() : 0;
+      continue;
+    }
+
+    img->texture_limit = 0;
+    if (memory_limit == 0) {
+      continue;
+    }
+
+    load_image_metadata(img);
+    const ImageMetaData &metadata = img->metadata;
+    if (metadata.type == IMAGE_DATA_TYPE_NANOVDB_FLOAT ||
+        metadata.type == IMAGE_DATA_TYPE_NANOVDB_FLOAT3) {
+      /* NanoVDB grids can not be loaded at reduced resolution. */
+      memory_used += metadata.byte_size;
+      continue;
+    }
+
+    /* Start from the resolution the scene texture limit gives. */
+    const size_t max_size = max(max(metadata.width, metadata.height), metadata.depth);
+    const int texture_limit = scene->params.texture_limit;
+    int level = 0;
+    while (texture_limit > 0 && (max_size >> level) > texture_limit) {
+      level++;
+    }
+
+    memory_used += image_device_memory_size(metadata, level);
+    load_images.push_back(make_pair(img, level));
+  }
+
+  /* Halve the resolution of the largest image until everything fits. */
+  while (memory_used > memory_limit) {
+    size_t largest_size = 0;
+    pair<Image *, int> *largest = NULL;
+    foreach (pair<Image *, int> &load_image, load_images) {
+      const ImageMetaData &metadata = load_image.first->metadata;
+      const size_t max_size = max(max(metadata.width, metadata.height), metadata.depth);
+      const size_t size = image_device_memory_size(metadata, load_image.second);
+      if ((max_size >> load_image.second) > 1 && size > largest_size) {
+        largest = &load_image;
+        largest_size = size;
+      }
+    }
+
+    if (largest == NULL) {
+      break;
+    }
+
+    largest->second++;
+    memory_used -= largest_size;
+    memory_used += image_device_memory_size(largest->first->metadata, largest->second);
+  }
+
+  foreach (pair<Image *, int> &load_image, load_images) {
+    Image *img = load_image.first;
+    const int level = load_image.second;
+    if (level > 0) {
+      const size_t max_size = max(max(img->metadata.width, img->metadata.height),
+                                  img->metadata.depth);
+      img->texture_limit = (int)((max_size + ((size_t)1 << level) - 1) >> level);
+    }
+  }
+
+  if (memory_limit > 0) {
+    VLOG(1) << "Image textures use " << string_human_readable_size(memory_used) << " of "
+            << string_human_readable_size(memory_limit) << " texture memory limit.";
+  }
+}
+
 void ImageManager::device_update(Device *device, Scene *scene, Progress &progress)
 {
   if (!need_update()) {
@@ -820,6 +996,8 @@ void ImageManager::device_update(Device *device, Scene *scene, Progress &progres
     }
   });
 
+  update_texture_limits(scene);
+
   TaskPool pool;
   for (size_t slot = 0; slot < images.size(); slot++) {
     Image *img = images[slot];
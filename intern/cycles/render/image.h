@@ -203,6 +203,9 @@ class ImageManager {
     bool need_load;
     bool builtin;
 
+    /* Maximum resolution to fit the texture memory limit, zero when not reduced. */
+    int texture_limit;
+
     string mem_name;
     device_texture *mem;
 
@@ -226,9 +229,11 @@ class ImageManager {
   void remove_image_user(int slot);
 
   void load_image_metadata(Image *img);
+  void update_texture_limits(Scene *scene);
 
   template<TypeDesc::BASETYPE FileFormat, typename StorageType>
   bool file_load_image(Image *img, int texture_limit);
+  void file_convert_to_half(Image *img, int slot);
 
   void device_load_image(Device *device, Scene *scene, int slot, Progress *progress);
   void device_free_image(Device *device, int slot);
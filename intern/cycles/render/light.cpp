@@ -282,6 +282,47 @@ bool LightManager::object_usable_as_light(Object *object)
   return false;
 }
 
+/* Relative probability of selecting each enabled light from the light distribution, with a mean
+ * of one. Point, spot and area lights are selected partly in proportion to their power, so that
+ * bright lights get more samples than dim ones. Other lights use a uniform weight, their
+ * strength is not comparable. */
+static vector<float> light_select_weights(Scene *scene)
+{
+  vector<float> weights;
+  float total_power = 0.0f;
+  int num_power_lights = 0;
+
+  foreach (Light *light, scene->lights) {
+    if (!light->is_enabled) {
+      continue;
+    }
+
+    const float power = (light->light_type == LIGHT_POINT || light->light_type == LIGHT_SPOT ||
+                         light->light_type == LIGHT_AREA) ?
+                            fabsf(average(light->strength)) :
+                            -1.0f;
+    weights.push_back(power);
+
+    if (power >= 0.0f) {
+      total_power += power;
+      num_power_lights++;
+    }
+  }
+
+  foreach (float &weight, weights) {
+    if (weight < 0.0f || !(total_power > 0.0f) || !isfinite(total_power)) {
+      weight = 1.0f;
+    }
+    else {
+      /* Mix with uniform selection, as the contribution at the shading point also depends on
+       * the distance and orientation of the light. */
+      weight = 0.5f + 0.5f * weight * num_power_lights / total_power;
+    }
+  }
+
+  return weights;
+}
+
 void LightManager::device_update_distribution(Device *,
                                               DeviceScene *dscene,
                                               Scene *scene,
@@ -411,6 +452,7 @@ void LightManager::device_update_distribution(Device *,
 
   /* point lights */
   float lightarea = (totarea > 0.0f) ? totarea / num_lights : 1.0f;
+  const vector<float> select_weights = light_select_weights(scene);
   bool use_lamp_mis = false;
 
   int light_index = 0;
@@ -422,7 +464,7 @@ void LightManager::device_update_distribution(Device *,
     distribution[offset].prim = ~light_index;
     distribution[offset].lamp.pad = 1.0f;
     distribution[offset].lamp.size = light->size;
-    totarea += lightarea;
+    totarea += lightarea * select_weights[light_index];
 
     if (light->light_type == LIGHT_DISTANT) {
       use_lamp_mis |= (light->angle > 0.0f && light->use_mis);
@@ -748,6 +790,7 @@ void LightManager::device_update_points(Device *, DeviceScene *dscene, Scene *sc
   }
 
   int light_index = 0;
+  const vector<float> select_weights = light_select_weights(scene);
 
   foreach (Light *light, scene->lights) {
     if (!light->is_enabled) {
@@ -785,6 +828,7 @@ void LightManager::device_update_points(Device *, DeviceScene *dscene, Scene *sc
     klights[light_index].strength[0] = light->strength.x;
     klights[light_index].strength[1] = light->strength.y;
     klights[light_index].strength[2] = light->strength.z;
+    klights[light_index].select_weight = select_weights[light_index];
 
     if (light->light_type == LIGHT_POINT) {
       shader_id &= ~SHADER_AREA_LIGHT;
@@ -952,6 +996,7 @@ void LightManager::device_update_points(Device *, DeviceScene *dscene, Scene *sc
     klights[light_index].area.dir[2] = dir.z;
     klights[light_index].tfm = light->tfm;
     klights[light_index].itfm = transform_inverse(light->tfm);
+    klights[light_index].select_weight = 1.0f;
 
     light_index++;
   }
@@ -180,6 +180,11 @@ class SceneParams {
   CurveShapeType hair_shape;
   bool persistent_data;
   int texture_limit;
+  /* Device memory budget for image textures in bytes, the largest images are loaded at reduced
+   * resolution to stay within it. Zero for no limit. */
+  size_t texture_memory_limit;
+  /* Store float image textures as half float when all values are in range. */
+  bool texture_half_float;
 
   bool background;
 
@@ -195,6 +200,8 @@ class SceneParams {
     hair_shape = CURVE_RIBBON;
     persistent_data = false;
     texture_limit = 0;
+    texture_memory_limit = 0;
+    texture_half_float = false;
     background = true;
   }
 
@@ -206,7 +213,9 @@ class SceneParams {
              use_bvh_unaligned_nodes == params.use_bvh_unaligned_nodes &&
              num_bvh_time_steps == params.num_bvh_time_steps &&
              hair_subdivisions == params.hair_subdivisions && hair_shape == params.hair_shape &&
-             persistent_data == params.persistent_data && texture_limit == params.texture_limit);
+             persistent_data == params.persistent_data && texture_limit == params.texture_limit &&
+             texture_memory_limit == params.texture_memory_limit &&
+             texture_half_float == params.texture_half_float);
   }
 
   int curve_subdivisions()
@@ -323,9 +323,12 @@ void Session::run_gpu()
       gpu_draw_ready = true;
       progress.set_update();
 
-      /* wait for until display buffer is updated */
+      /* Wait until the display buffer is updated. The device converts the buffers to the
+       * display pixels on the main thread, so only wait once the display is outdated. Samples
+       * that render faster than the display update are not limited by the draw rate. */
       if (!params.background) {
-        while (gpu_need_display_buffer_update) {
+        while (gpu_need_display_buffer_update &&
+               (time_dt() - last_display_time) > params.display_update_timeout) {
           if (progress.get_cancel())
             break;
 
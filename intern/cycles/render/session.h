@@ -68,6 +68,7 @@ class SessionParams {
   double reset_timeout;
   double text_timeout;
   double progressive_update_timeout;
+  double display_update_timeout;
 
   ShadingSystem shadingsystem;
 
@@ -96,6 +97,7 @@ class SessionParams {
     reset_timeout = 0.1;
     text_timeout = 1.0;
     progressive_update_timeout = 1.0;
+    display_update_timeout = 1.0 / 60.0;
 
     shadingsystem = SHADINGSYSTEM_SVM;
     tile_order = TILE_CENTER;
@@ -116,6 +118,7 @@ class SessionParams {
              cancel_timeout == params.cancel_timeout && reset_timeout == params.reset_timeout &&
              text_timeout == params.text_timeout &&
              progressive_update_timeout == params.progressive_update_timeout &&
+             display_update_timeout == params.display_update_timeout &&
              tile_order == params.tile_order && shadingsystem == params.shadingsystem &&
              denoising.type == params.denoising.type &&
              (denoising.use == params.denoising.use || (device.denoisers & denoising.type)));
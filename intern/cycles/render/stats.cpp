@@ -51,6 +51,24 @@ bool namedSampleCountPairComparator(const NamedSampleCountPair &a, const NamedSa
   return a.samples > b.samples;
 }
 
+string json_string(const string &str)
+{
+  string result = "\"";
+  foreach (const char c, str) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+      result += c;
+    }
+    else if ((unsigned char)c < 0x20) {
+      result += string_printf("\\u%04x", c);
+    }
+    else {
+      result += c;
+    }
+  }
+  return result + "\"";
+}
+
 }  // namespace
 
 NamedSizeEntry::NamedSizeEntry() : name(""), size(0)
@@ -170,6 +188,26 @@ string NamedNestedSampleStats::full_report(int indent_level, uint64_t total_samp
   return result;
 }
 
+string NamedNestedSampleStats::json_report()
+{
+  update_sum();
+
+  string result = string_printf("{\"name\": %s, \"total_time\": %.3f, \"self_time\": %.3f",
+                                json_string(name).c_str(),
+                                sum_samples * 0.001,
+                                self_samples * 0.001);
+  if (!entries.empty()) {
+    sort(entries.begin(), entries.end(), namedTimeSampleEntryComparator);
+    result += ", \"entries\": [";
+    for (size_t i = 0; i < entries.size(); i++) {
+      result += (i > 0) ? ", " : "";
+      result += entries[i].json_report();
+    }
+    result += "]";
+  }
+  return result + "}";
+}
+
 /* Named sample count pairs. */
 
 NamedSampleCountPair::NamedSampleCountPair(const ustring &name, uint64_t samples, uint64_t hits)
@@ -224,6 +262,42 @@ string NamedSampleCountStats::full_report(int indent_level)
   return result;
 }
 
+string NamedSampleCountStats::json_report()
+{
+  vector<NamedSampleCountPair> sorted_entries;
+  sorted_entries.reserve(entries.size());
+
+  uint64_t total_hits = 0, total_samples = 0;
+  foreach (entry_map::const_reference entry, entries) {
+    const NamedSampleCountPair &pair = entry.second;
+
+    total_hits += pair.hits;
+    total_samples += pair.samples;
+
+    sorted_entries.push_back(pair);
+  }
+  const double avg_samples_per_hit = ((double)total_samples) / total_hits;
+
+  sort(sorted_entries.begin(), sorted_entries.end(), namedSampleCountPairComparator);
+
+  string result = "[";
+  for (size_t i = 0; i < sorted_entries.size(); i++) {
+    const NamedSampleCountPair &entry = sorted_entries[i];
+    const double relative = (entry.hits > 0) ?
+                                ((double)entry.samples) / (entry.hits * avg_samples_per_hit) :
+                                0.0;
+
+    result += (i > 0) ? ", " : "";
+    result += string_printf(
+        "{\"name\": %s, \"time\": %.3f, \"hits\": %llu, \"relative_cost\": %.3f}",
+        json_string(entry.name.string()).c_str(),
+        entry.samples * 0.001,
+        (unsigned long long)entry.hits,
+        relative);
+  }
+  return result + "]";
+}
+
 /* Mesh statistics. */
 
 MeshStats::MeshStats()
@@ -345,6 +419,19 @@ string RenderStats::full_report()
   return result;
 }
 
+string RenderStats::json_report()
+{
+  if (!has_profiling) {
+    return "";
+  }
+
+  string result = "{";
+  result += "\"kernel\": " + kernel.json_report();
+  result += ", \"shaders\": " + shaders.json_report();
+  result += ", \"objects\": " + objects.json_report();
+  return result + "}";
+}
+
 NamedTimeStats::NamedTimeStats() : total_time(0.0)
 {
 }
@@ -113,6 +113,7 @@ class NamedNestedSampleStats {
   void update_sum();
 
   string full_report(int indent_level = 0, uint64_t total_samples = 0);
+  string json_report();
 
   string name;
 
@@ -141,6 +142,7 @@ class NamedSampleCountStats {
   NamedSampleCountStats();
 
   string full_report(int indent_level = 0);
+  string json_report();
   void add(const ustring &name, uint64_t samples, uint64_t hits);
 
   typedef unordered_map<ustring, NamedSampleCountPair, ustringHash> entry_map;
@@ -181,6 +183,9 @@ class RenderStats {
   /* Return full report as string. */
   string full_report();
 
+  /* Return profiling information as JSON string, for storing with the render result. */
+  string json_report();
+
   /* Collect kernel sampling information from Stats. */
   void collect_profiling(Scene *scene, Profiler &prof);
 
@@ -95,6 +95,11 @@
 #  define FFMPEG_HAVE_CANON_H264_RESOLUTION_FIX
 #endif
 
+/* Hardware decoding through #avcodec_get_hw_config and a device context. */
+#if (LIBAVCODEC_VERSION_MAJOR >= 58)
+#  define FFMPEG_HAVE_HWACCEL
+#endif
+
 #if ((LIBAVCODEC_VERSION_MAJOR > 53) || \
      (LIBAVCODEC_VERSION_MAJOR >= 53) && (LIBAVCODEC_VERSION_MINOR >= 60))
 #  define FFMPEG_HAVE_ENCODE_AUDIO2
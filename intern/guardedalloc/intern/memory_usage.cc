@@ -0,0 +1,242 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/** \file
+ * \ingroup MEM
+ *
+ * Memory usage statistics of the lock-free allocator.
+ *
+ * Every thread counts its own allocations, so allocating and freeing doesn't have to touch
+ * a global atomic shared by all threads (which becomes a bottleneck for allocation heavy
+ * multi-threaded code). The counters of all threads are only added together when the
+ * statistics are queried, or when the memory use of a thread grew enough that the peak
+ * memory has to be updated.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+#include "MEM_guardedalloc.h"
+#include "mallocn_intern.h"
+
+namespace {
+
+/**
+ * Memory statistics of one thread. The counters are only changed by their own thread,
+ * but they are read by other threads when the statistics are queried.
+ * Counts can be negative when a thread frees memory that was allocated by another thread.
+ */
+struct Local {
+  /** Set once the thread exited, counts are moved into #Global then. */
+  bool destructed = false;
+  /** The first thread using the allocator, its destruction means the program ends. */
+  bool is_main = false;
+  std::atomic<int64_t> blocks_num = 0;
+  std::atomic<int64_t> mem_in_use = 0;
+  /** Value of #mem_in_use when the global peak was last updated. */
+  int64_t mem_in_use_during_peak_update = 0;
+  /** Links in #Global::locals, not a container to avoid allocating from the allocator. */
+  Local *prev = nullptr, *next = nullptr;
+
+  Local();
+  ~Local();
+};
+
+struct Global {
+  /** Protects #locals, also locked while summing the counters of all threads. */
+  std::mutex locals_mutex;
+  Local *locals = nullptr;
+
+  /**
+   * Counts of threads that exited, and of allocations after the main thread exited
+   * (when thread local storage can't be used anymore).
+   */
+  std::atomic<int64_t> blocks_num_outside_locals = 0;
+  std::atomic<int64_t> mem_in_use_outside_locals = 0;
+
+  std::atomic<size_t> peak = 0;
+};
+
+}  // namespace
+
+/** Disabled when the main thread exits, static destructors may still free memory after that. */
+static std::atomic<bool> use_local_counters = true;
+
+/**
+ * Update the global peak memory once the memory in use of a thread grew by this many bytes.
+ * Keeps the peak accurate enough without summing the counters of all threads too often.
+ */
+static constexpr int64_t peak_update_threshold = 1024 * 1024;
+
+static Global &get_global()
+{
+  /* Never freed: memory can still be freed during (and after) destruction of static variables.
+   * Allocated with the system allocator, `new` may be overridden to use guarded allocation. */
+  static Global *global = new (malloc(sizeof(Global))) Global();
+  return *global;
+}
+
+static Local &get_local_data()
+{
+  static thread_local Local local;
+  return local;
+}
+
+Local::Local()
+{
+  Global &global = get_global();
+  std::lock_guard lock{global.locals_mutex};
+
+  if (global.locals == nullptr) {
+    is_main = true;
+  }
+  next = global.locals;
+  if (next) {
+    next->prev = this;
+  }
+  global.locals = this;
+}
+
+Local::~Local()
+{
+  Global &global = get_global();
+  std::lock_guard lock{global.locals_mutex};
+
+  if (prev) {
+    prev->next = next;
+  }
+  else {
+    global.locals = next;
+  }
+  if (next) {
+    next->prev = prev;
+  }
+  global.blocks_num_outside_locals.fetch_add(blocks_num);
+  global.mem_in_use_outside_locals.fetch_add(mem_in_use);
+
+  if (is_main) {
+    use_local_counters.store(false);
+  }
+  destructed = true;
+}
+
+static size_t memory_usage_current_locked(const Global &global)
+{
+  int64_t mem_in_use = global.mem_in_use_outside_locals;
+  for (const Local *local = global.locals; local; local = local->next) {
+    mem_in_use += local->mem_in_use;
+  }
+  return (size_t)std::max<int64_t>(mem_in_use, 0);
+}
+
+static void update_global_peak()
+{
+  Global &global = get_global();
+  std::lock_guard lock{global.locals_mutex};
+
+  for (Local *local = global.locals; local; local = local->next) {
+    local->mem_in_use_during_peak_update = local->mem_in_use;
+  }
+
+  const size_t mem_in_use = memory_usage_current_locked(global);
+  size_t peak = global.peak;
+  while (mem_in_use > peak && !global.peak.compare_exchange_weak(peak, mem_in_use)) {
+    /* Retry, another thread updated the peak meanwhile. */
+  }
+}
+
+void memory_usage_block_alloc(size_t size)
+{
+  if (LIKELY(use_local_counters.load(std::memory_order_relaxed))) {
+    Local &local = get_local_data();
+    if (LIKELY(!local.destructed)) {
+      /* Only this thread writes the counters, no read-modify-write atomic is needed. */
+      local.blocks_num.store(local.blocks_num.load(std::memory_order_relaxed) + 1,
+                             std::memory_order_relaxed);
+      local.mem_in_use.store(local.mem_in_use.load(std::memory_order_relaxed) + (int64_t)size,
+                             std::memory_order_relaxed);
+
+      if (local.mem_in_use - local.mem_in_use_during_peak_update > peak_update_threshold) {
+        update_global_peak();
+      }
+      return;
+    }
+  }
+  {
+    /* Allocations during thread (or program) exit. */
+    Global &global = get_global();
+    global.blocks_num_outside_locals.fetch_add(1, std::memory_order_relaxed);
+    global.mem_in_use_outside_locals.fetch_add((int64_t)size, std::memory_order_relaxed);
+  }
+}
+
+void memory_usage_block_free(size_t size)
+{
+  if (LIKELY(use_local_counters.load(std::memory_order_relaxed))) {
+    Local &local = get_local_data();
+    if (LIKELY(!local.destructed)) {
+      local.blocks_num.store(local.blocks_num.load(std::memory_order_relaxed) - 1,
+                             std::memory_order_relaxed);
+      local.mem_in_use.store(local.mem_in_use.load(std::memory_order_relaxed) - (int64_t)size,
+                             std::memory_order_relaxed);
+      return;
+    }
+  }
+  {
+    Global &global = get_global();
+    global.blocks_num_outside_locals.fetch_sub(1, std::memory_order_relaxed);
+    global.mem_in_use_outside_locals.fetch_sub((int64_t)size, std::memory_order_relaxed);
+  }
+}
+
+size_t memory_usage_block_num()
+{
+  Global &global = get_global();
+  std::lock_guard lock{global.locals_mutex};
+
+  int64_t blocks_num = global.blocks_num_outside_locals;
+  for (const Local *local = global.locals; local; local = local->next) {
+    blocks_num += local->blocks_num;
+  }
+  return (size_t)std::max<int64_t>(blocks_num, 0);
+}
+
+size_t memory_usage_current()
+{
+  Global &global = get_global();
+  std::lock_guard lock{global.locals_mutex};
+  return memory_usage_current_locked(global);
+}
+
+size_t memory_usage_peak()
+{
+  update_global_peak();
+  return get_global().peak;
+}
+
+void memory_usage_peak_reset()
+{
+  Global &global = get_global();
+  std::lock_guard lock{global.locals_mutex};
+
+  for (Local *local = global.locals; local; local = local->next) {
+    local->mem_in_use_during_peak_update = local->mem_in_use;
+  }
+  global.peak = memory_usage_current_locked(global);
+}
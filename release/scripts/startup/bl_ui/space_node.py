@@ -657,12 +657,16 @@ class NODE_PT_quality(bpy.types.Panel):
         tree = snode.node_tree
 
         col = layout.column()
+        col.prop(tree, "execution_mode")
         col.prop(tree, "render_quality", text="Render")
         col.prop(tree, "edit_quality", text="Edit")
         col.prop(tree, "chunk_size")
 
         col = layout.column()
         col.prop(tree, "use_opencl")
+        sub = col.column()
+        sub.active = tree.execution_mode == 'FULL_FRAME'
+        sub.prop(tree, "use_gpu")
         col.prop(tree, "use_groupnode_buffer")
         col.prop(tree, "use_two_pass")
         col.prop(tree, "use_viewer_border")
@@ -635,6 +635,11 @@ class USERPREF_PT_system_memory(SystemPanel, CenterAlignMixIn, Panel):
         col.prop(system, "vbo_time_out", text="Vbo Time Out")
         col.prop(system, "vbo_collection_rate", text="Garbage Collection Rate")
 
+        layout.separator()
+
+        col = layout.column()
+        col.prop(system, "compositor_memory_limit")
+
 
 class USERPREF_PT_system_video_sequencer(SystemPanel, CenterAlignMixIn, Panel):
     bl_label = "Video Sequencer"
@@ -655,6 +660,12 @@ class USERPREF_PT_system_video_sequencer(SystemPanel, CenterAlignMixIn, Panel):
         col.prop(system, "sequencer_disk_cache_size_limit", text="Cache Limit")
         col.prop(system, "sequencer_disk_cache_compression", text="Compression")
 
+        layout.separator()
+
+        layout.prop(system, "sequencer_proxy_build_threads")
+
+        layout.prop(system, "use_movie_hardware_decode")
+
 
 # -----------------------------------------------------------------------------
 # Viewport Panels
@@ -709,6 +720,9 @@ class USERPREF_PT_viewport_quality(ViewportPanel, CenterAlignMixIn, Panel):
         col.prop(system, "use_overlay_smooth_wire", text="Overlay")
         col.prop(system, "use_edit_mode_smooth_wire", text="Edit Mode")
 
+        col = layout.column()
+        col.prop(system, "use_gpu_shader_cache")
+
 
 class USERPREF_PT_viewport_textures(ViewportPanel, CenterAlignMixIn, Panel):
     bl_label = "Textures"
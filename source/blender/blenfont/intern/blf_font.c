@@ -39,6 +39,7 @@
 
 #include "DNA_vec_types.h"
 
+#include "BLI_hash_mm2a.h"
 #include "BLI_listbase.h"
 #include "BLI_math.h"
 #include "BLI_rect.h"
@@ -909,11 +910,70 @@ static void blf_font_boundbox_ex(FontBLF *font,
     r_info->width = pen_x;
   }
 }
+
+/**
+ * Find the cache entry for a string, NULL when it's too long to be cached.
+ * \param r_is_cached: Set when the entry holds the bounds of this string already.
+ */
+static BoundBoxCacheBLF *blf_font_boundbox_cache_entry(
+    FontBLF *font, GlyphCacheBLF *gc, const char *str, size_t len, bool *r_is_cached)
+{
+  len = BLI_strnlen(str, len);
+  if ((len == 0) || (len >= BLF_BOUNDBOX_CACHE_STR_LEN)) {
+    return NULL;
+  }
+
+  BLF_KERNING_VARS(font, has_kerning, kern_mode);
+  UNUSED_VARS(has_kerning);
+
+  const unsigned int hash = BLI_hash_mm2((const unsigned char *)str, len, kern_mode);
+
+  if (gc->boundbox_cache == NULL) {
+    gc->boundbox_cache = MEM_callocN(sizeof(*gc->boundbox_cache) * BLF_BOUNDBOX_CACHE_LEN,
+                                     __func__);
+  }
+
+  BoundBoxCacheBLF *entry = &gc->boundbox_cache[hash & (BLF_BOUNDBOX_CACHE_LEN - 1)];
+  *r_is_cached = (entry->hash == hash) && (entry->len == (unsigned int)len) &&
+                 (entry->kern_mode == kern_mode) && (memcmp(entry->str, str, len) == 0);
+
+  if (!*r_is_cached) {
+    /* Replace the previous string, the caller fills in the bounds. */
+    entry->hash = hash;
+    entry->len = (unsigned int)len;
+    entry->kern_mode = kern_mode;
+    memcpy(entry->str, str, len);
+  }
+  return entry;
+}
+
 void blf_font_boundbox(
     FontBLF *font, const char *str, size_t len, rctf *r_box, struct ResultBLF *r_info)
 {
   GlyphCacheBLF *gc = blf_glyph_cache_acquire(font);
-  blf_font_boundbox_ex(font, gc, str, len, r_box, r_info, 0);
+
+  bool is_cached = false;
+  BoundBoxCacheBLF *entry = blf_font_boundbox_cache_entry(font, gc, str, len, &is_cached);
+
+  if (is_cached) {
+    *r_box = entry->box;
+    if (r_info) {
+      r_info->lines = 1;
+      r_info->width = entry->width;
+    }
+  }
+  else {
+    struct ResultBLF info;
+    blf_font_boundbox_ex(font, gc, str, len, r_box, &info, 0);
+    if (entry) {
+      entry->box = *r_box;
+      entry->width = info.width;
+    }
+    if (r_info) {
+      *r_info = info;
+    }
+  }
+
   blf_glyph_cache_release(font);
 }
 
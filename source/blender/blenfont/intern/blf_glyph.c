@@ -216,6 +216,9 @@ void blf_glyph_cache_free(GlyphCacheBLF *gc)
   if (gc->bitmap_result) {
     MEM_freeN(gc->bitmap_result);
   }
+  if (gc->boundbox_cache) {
+    MEM_freeN(gc->boundbox_cache);
+  }
   MEM_freeN(gc);
 }
 
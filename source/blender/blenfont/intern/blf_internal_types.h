@@ -54,6 +54,21 @@ typedef struct KerningCacheBLF {
   int table[0x80][0x80];
 } KerningCacheBLF;
 
+#define BLF_BOUNDBOX_CACHE_LEN 256 /* power of two */
+#define BLF_BOUNDBOX_CACHE_STR_LEN 48
+
+/* Bounds of a short string measured with a glyph cache, see #blf_font_boundbox(). */
+typedef struct BoundBoxCacheBLF {
+  unsigned int hash;
+  /* string length, zero when unused. */
+  unsigned int len;
+  /* kerning mode used to measure the string. */
+  FT_UInt kern_mode;
+  int width;
+  rctf box;
+  char str[BLF_BOUNDBOX_CACHE_STR_LEN];
+} BoundBoxCacheBLF;
+
 typedef struct GlyphCacheBLF {
   struct GlyphCacheBLF *next;
   struct GlyphCacheBLF *prev;
@@ -73,6 +88,10 @@ typedef struct GlyphCacheBLF {
   /* fast ascii lookup */
   struct GlyphBLF *glyph_ascii_table[256];
 
+  /* Bounds of recently measured strings, indexed by hash (lazily allocated).
+   * The UI measures the same labels on every redraw. */
+  BoundBoxCacheBLF *boundbox_cache;
+
   /* texture array, to draw the glyphs. */
   GPUTexture *texture;
   char *bitmap_result;
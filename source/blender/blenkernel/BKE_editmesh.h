@@ -32,6 +32,7 @@ extern "C" {
 #endif
 
 struct BMLoop;
+struct BMVert;
 struct BMesh;
 struct BoundBox;
 struct Depsgraph;
@@ -81,8 +82,26 @@ typedef struct BMEditMesh {
    */
   char needs_flush_to_id;
 
+  /**
+   * Pending vertex-coordinate only change, see #BKE_editmesh_deform_tag_vert.
+   * Copied into the evaluated edit-mesh and cleared on evaluation.
+   */
+  char deform_tag;
+  /** Faces (by index) whose loops need their draw data updated, end exclusive. */
+  int deform_face_range[2];
+
 } BMEditMesh;
 
+/** #BMEditMesh.deform_tag */
+enum {
+  /** No pending change. */
+  EM_DEFORM_TAG_NONE = 0,
+  /** Only vertex coordinates changed, affecting faces in #BMEditMesh.deform_face_range. */
+  EM_DEFORM_TAG_RANGE = 1,
+  /** Other changes are pending, everything needs to be updated. */
+  EM_DEFORM_TAG_ALL = 2,
+};
+
 /* editmesh.c */
 void BKE_editmesh_looptri_calc(BMEditMesh *em);
 BMEditMesh *BKE_editmesh_create(BMesh *bm, const bool do_tessellate);
@@ -91,6 +110,9 @@ BMEditMesh *BKE_editmesh_from_object(struct Object *ob);
 void BKE_editmesh_free_derivedmesh(BMEditMesh *em);
 void BKE_editmesh_free(BMEditMesh *em);
 
+void BKE_editmesh_deform_tag_vert(BMEditMesh *em, struct BMVert *eve);
+void BKE_editmesh_deform_tag_all(BMEditMesh *em);
+
 float (*BKE_editmesh_vert_coords_alloc(struct Depsgraph *depsgraph,
                                        struct BMEditMesh *em,
                                        struct Scene *scene,
@@ -97,6 +97,10 @@ typedef struct EffectorCache {
   struct GuideEffectorData *guide_data;
   float guide_loc[4], guide_dir[3], guide_radius;
 
+  /* precalculated world space bounds outside of which the effector has no influence,
+   * only used with PE_USE_BOUNDS */
+  float bounds_min[3], bounds_max[3];
+
   float frame;
   int flag;
 } EffectorCache;
@@ -172,6 +176,7 @@ float effector_falloff(struct EffectorData *eff,
 
 /* EffectorData->flag */
 #define PE_VELOCITY_TO_IMPULSE 1
+#define PE_USE_BOUNDS 8
 
 /* ======== Simulation Debugging ======== */
 
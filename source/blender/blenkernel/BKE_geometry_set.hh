@@ -22,6 +22,8 @@
 
 #include <atomic>
 #include <iostream>
+#include <memory>
+#include <mutex>
 
 #include "BLI_float3.hh"
 #include "BLI_float4x4.hh"
@@ -191,6 +193,13 @@ class GeometryComponent {
   virtual blender::bke::ReadAttributePtr attribute_try_adapt_domain(
       blender::bke::ReadAttributePtr attribute, const AttributeDomain new_domain) const;
 
+  /* Same as #attribute_try_adapt_domain, but the interpolated values can be reused by later calls
+   * for the same attribute name and domain, as long as the component is not changed. */
+  virtual blender::bke::ReadAttributePtr attribute_try_adapt_domain_cached(
+      const blender::StringRef attribute_name,
+      blender::bke::ReadAttributePtr attribute,
+      const AttributeDomain new_domain) const;
+
   /* Returns true when the attribute has been deleted. */
   bool attribute_try_delete(const blender::StringRef attribute_name);
 
@@ -366,6 +375,12 @@ class MeshComponent : public GeometryComponent {
    * group names are stored on an object. Since we don't have an object here, we copy over the
    * names into this map. */
   blender::Map<std::string, int> vertex_group_names_;
+  /* Attributes interpolated to another domain, keyed by attribute name and domain. They are only
+   * added while the component is shared, because the mesh can't be changed then. */
+  mutable blender::Map<std::pair<std::string, int>,
+                       std::shared_ptr<const blender::bke::ReadAttribute>>
+      adapted_attributes_;
+  mutable std::mutex adapted_attributes_mutex_;
 
  public:
   MeshComponent();
@@ -389,6 +404,10 @@ class MeshComponent : public GeometryComponent {
   int attribute_domain_size(const AttributeDomain domain) const final;
   blender::bke::ReadAttributePtr attribute_try_adapt_domain(
       blender::bke::ReadAttributePtr attribute, const AttributeDomain new_domain) const final;
+  blender::bke::ReadAttributePtr attribute_try_adapt_domain_cached(
+      const blender::StringRef attribute_name,
+      blender::bke::ReadAttributePtr attribute,
+      const AttributeDomain new_domain) const final;
 
   bool is_empty() const final;
 
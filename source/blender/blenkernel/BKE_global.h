@@ -153,7 +153,9 @@ enum {
   G_DEBUG_XR = (1 << 19),                    /* XR/OpenXR messages */
   G_DEBUG_XR_TIME = (1 << 20),               /* XR/OpenXR timing messages */
 
-  G_DEBUG_GHOST = (1 << 21), /* Debug GHOST module. */
+  G_DEBUG_GHOST = (1 << 21),   /* Debug GHOST module. */
+  G_DEBUG_WM_TIME = (1 << 22), /* Main loop phase timing messages. */
+  G_DEBUG_STARTUP = (1 << 23), /* Startup phase timing messages. */
 };
 
 #define G_DEBUG_ALL \
@@ -360,6 +360,10 @@ void BKE_image_file_format_set(struct Image *image,
                                int ftype,
                                const struct ImbFormatOptions *options);
 bool BKE_image_has_loaded_ibuf(struct Image *image);
+struct ImBuf *BKE_image_load_gpu_mip_level(struct Image *ima,
+                                           struct ImageUser *iuser,
+                                           int max_size,
+                                           int r_full_size[2]);
 struct ImBuf *BKE_image_get_ibuf_with_name(struct Image *image, const char *name);
 struct ImBuf *BKE_image_get_first_ibuf(struct Image *image);
 
@@ -29,4 +29,8 @@ typedef enum eMeshBatchDirtyMode {
   BKE_MESH_BATCH_DIRTY_SHADING,
   BKE_MESH_BATCH_DIRTY_UVEDIT_ALL,
   BKE_MESH_BATCH_DIRTY_UVEDIT_SELECT,
+  /** Only edit-mesh vertex coordinates changed, see #BMEditMesh.deform_tag. */
+  BKE_MESH_BATCH_DIRTY_DEFORM,
+  /** Only vertex group weights changed, used by weight paint. */
+  BKE_MESH_BATCH_DIRTY_WEIGHTS,
 } eMeshBatchDirtyMode;
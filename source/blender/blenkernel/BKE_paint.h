@@ -312,6 +312,10 @@ typedef struct SculptClothLengthConstraint {
   eSculptClothConstraintType type;
 } SculptClothLengthConstraint;
 
+/* Number of constraint colors, constraints that can't be colored are solved serially after
+ * all the colors. */
+#define SCULPT_CLOTH_CONSTRAINT_COLORS 32
+
 typedef struct SculptClothSimulation {
   SculptClothLengthConstraint *length_constraints;
   int tot_length_constraints;
@@ -319,6 +323,12 @@ typedef struct SculptClothSimulation {
   int capacity_length_constraints;
   float *length_constraint_tweak;
 
+  /* Indices of #length_constraints sorted by color. Constraints with the same color don't share
+   * any vertex, so they can be solved in parallel. Rebuilt when new constraints are added. */
+  int *constraint_color_order;
+  int constraint_color_offset[SCULPT_CLOTH_CONSTRAINT_COLORS + 2];
+  int tot_colored_constraints;
+
   /* Position anchors for deformation brushes. These positions are modified by the brush and the
    * final positions of the simulated vertices are updated with constraints that use these points
    * as targets. */
@@ -473,6 +483,12 @@ typedef struct SculptSession {
   struct MeshElemMap *pmap;
   int *pmap_mem;
 
+  /* Vertex to vertex adjacency of the base mesh in CSR layout, created together with #pmap and
+   * freed with #BKE_sculptsession_free_pmap. The neighbors of vertex `v` are stored in
+   * `vert_adj_indices[vert_adj_offsets[v]]` to `vert_adj_indices[vert_adj_offsets[v + 1] - 1]`. */
+  int *vert_adj_offsets;
+  int *vert_adj_indices;
+
   /* Mesh Face Sets */
   /* Total number of polys of the base mesh. */
   int totfaces;
@@ -602,6 +618,7 @@ typedef struct SculptSession {
 
 void BKE_sculptsession_free(struct Object *ob);
 void BKE_sculptsession_free_deformMats(struct SculptSession *ss);
+void BKE_sculptsession_free_pmap(struct SculptSession *ss);
 void BKE_sculptsession_free_vwpaint_data(struct SculptSession *ss);
 void BKE_sculptsession_bm_to_me(struct Object *ob, bool reorder);
 void BKE_sculptsession_bm_to_me_for_render(struct Object *object);
@@ -36,6 +36,7 @@ extern "C" {
 #endif
 
 struct ParticleKey;
+struct ParticleNeighborGrid;
 struct ParticleSettings;
 struct ParticleSystem;
 struct ParticleSystemModifierData;
@@ -467,6 +468,7 @@ void psys_apply_hair_lattice(struct Depsgraph *depsgraph,
 struct ParticleSystem *psys_get_target_system(struct Object *ob, struct ParticleTarget *pt);
 void psys_count_keyed_targets(struct ParticleSimulationData *sim);
 void psys_update_particle_tree(struct ParticleSystem *psys, float cfra);
+void psys_neighbor_grid_free(struct ParticleNeighborGrid *grid);
 void psys_changed_type(struct Object *ob, struct ParticleSystem *psys);
 
 void psys_make_temp_pointcache(struct Object *ob, struct ParticleSystem *psys);
@@ -78,6 +78,8 @@ typedef enum {
 
   PBVH_UpdateTopology = 1 << 13,
   PBVH_UpdateColor = 1 << 14,
+  /* Draw buffers need new positions and normals, not only new mask, colors or face sets. */
+  PBVH_UpdateDrawCoords = 1 << 15,
 } PBVHNodeFlags;
 
 typedef struct PBVHFrustumPlanes {
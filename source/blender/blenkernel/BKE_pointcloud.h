@@ -47,6 +47,8 @@ void BKE_pointcloud_update_customdata_pointers(struct PointCloud *pointcloud);
 bool BKE_pointcloud_customdata_required(struct PointCloud *pointcloud,
                                         struct CustomDataLayer *layer);
 
+void BKE_pointcloud_runtime_clear_cache(struct PointCloud *pointcloud);
+
 /* Dependency Graph */
 
 struct PointCloud *BKE_pointcloud_new_for_eval(const struct PointCloud *pointcloud_src,
@@ -190,6 +190,11 @@ typedef struct Subdiv {
     /* Indexed by base face index, element indicates total number of ptex
      * faces created for preceding base faces. */
     int *face_ptex_offset;
+    /* Flat snapshot of the coarse mesh topology the refiner was created for.
+     * Allows to skip the converter based comparison for meshes which only
+     * deform over time. */
+    int *mesh_topology;
+    size_t mesh_topology_len;
   } cache_;
 } Subdiv;
 
@@ -47,6 +47,22 @@ bool BKE_volume_grid_dense_floats(const struct Volume *volume,
                                   DenseFloatVolumeGrid *r_dense_grid);
 void BKE_volume_dense_float_grid_clear(DenseFloatVolumeGrid *dense_grid);
 
+/* Extract the dense voxels in slabs along Z of at most \a max_slab_voxels voxels, so that the
+ * whole dense grid never has to be in memory at once. The header of \a r_dense_grid is filled
+ * before the callback is called, its voxels stay NULL. */
+typedef void (*BKE_volume_dense_float_slab_cb)(void *userdata,
+                                               const DenseFloatVolumeGrid *dense_grid,
+                                               const float *voxels,
+                                               int z_offset,
+                                               int depth);
+
+bool BKE_volume_grid_dense_floats_slabs(const struct Volume *volume,
+                                        struct VolumeGrid *volume_grid,
+                                        int64_t max_slab_voxels,
+                                        DenseFloatVolumeGrid *r_dense_grid,
+                                        BKE_volume_dense_float_slab_cb cb,
+                                        void *cb_userdata);
+
 /* Wireframe */
 
 typedef void (*BKE_volume_wireframe_cb)(
@@ -808,7 +808,7 @@ static void mesh_calc_modifier_final_normals(const Mesh *mesh_input,
   const bool do_poly_normals = ((final_datamask->pmask & CD_MASK_NORMAL) != 0);
 
   /* In case we also need poly normals, add the layer and compute them here
-   * (BKE_mesh_calc_normals_split() assumes that if that data exists, it is always valid). */
+   * (BKE_mesh_calc_normals_split() reuses that data unless it is tagged dirty). */
   if (do_poly_normals) {
     if (!CustomData_has_layer(&mesh_final->pdata, CD_NORMAL)) {
       float(*polynors)[3] = (float(*)[3])CustomData_add_layer(
@@ -822,6 +822,9 @@ static void mesh_calc_modifier_final_normals(const Mesh *mesh_input,
                                  mesh_final->totpoly,
                                  polynors,
                                  false);
+      /* Vertex normals were computed as well. */
+      mesh_final->runtime.cd_dirty_vert &= ~CD_MASK_NORMAL;
+      mesh_final->runtime.cd_dirty_poly &= ~CD_MASK_NORMAL;
     }
   }
 
@@ -854,8 +857,11 @@ static void mesh_calc_modifier_final_normals(const Mesh *mesh_input,
   /* Some modifiers, like data-transfer, may generate those data as temp layer,
    * we do not want to keep them, as they are used by display code when available
    * (i.e. even if autosmooth is disabled). */
-  if (!do_loop_normals && CustomData_has_layer(&mesh_final->ldata, CD_NORMAL)) {
-    CustomData_free_layers(&mesh_final->ldata, CD_NORMAL, mesh_final->totloop);
+  if (!do_loop_normals) {
+    if (CustomData_has_layer(&mesh_final->ldata, CD_NORMAL)) {
+      CustomData_free_layers(&mesh_final->ldata, CD_NORMAL, mesh_final->totloop);
+    }
+    mesh_final->runtime.cd_dirty_loop &= ~CD_MASK_NORMAL;
   }
 }
 
@@ -1539,7 +1545,7 @@ static void editbmesh_calc_modifier_final_normals(Mesh *mesh_final,
   const bool do_poly_normals = ((final_datamask->pmask & CD_MASK_NORMAL) != 0);
 
   /* In case we also need poly normals, add the layer and compute them here
-   * (BKE_mesh_calc_normals_split() assumes that if that data exists, it is always valid). */
+   * (BKE_mesh_calc_normals_split() reuses that data unless it is tagged dirty). */
   if (do_poly_normals) {
     if (!CustomData_has_layer(&mesh_final->pdata, CD_NORMAL)) {
       float(*polynors)[3] = (float(*)[3])CustomData_add_layer(
@@ -1553,6 +1559,9 @@ static void editbmesh_calc_modifier_final_normals(Mesh *mesh_final,
                                  mesh_final->totpoly,
                                  polynors,
                                  false);
+      /* Vertex normals were computed as well. */
+      mesh_final->runtime.cd_dirty_vert &= ~CD_MASK_NORMAL;
+      mesh_final->runtime.cd_dirty_poly &= ~CD_MASK_NORMAL;
     }
   }
 
@@ -1581,6 +1590,7 @@ static void editbmesh_calc_modifier_final_normals(Mesh *mesh_final,
     if (CustomData_has_layer(&mesh_final->ldata, CD_NORMAL)) {
       CustomData_free_layers(&mesh_final->ldata, CD_NORMAL, mesh_final->totloop);
     }
+    mesh_final->runtime.cd_dirty_loop &= ~CD_MASK_NORMAL;
   }
 }
 
@@ -1981,6 +1991,16 @@ static void editbmesh_build_data(struct Depsgraph *depsgraph,
   BKE_object_free_derived_caches(obedit);
   if (DEG_is_active(depsgraph)) {
     BKE_sculpt_update_object_before_eval(obedit);
+
+    /* The deform tag has been copied into the evaluated edit-mesh, start over. */
+    BMEditMesh *em_orig = ((Mesh *)DEG_get_original_id((ID *)obedit->data))->edit_mesh;
+    if (em_orig != nullptr) {
+      em_orig->deform_tag = EM_DEFORM_TAG_NONE;
+    }
+  }
+  else {
+    /* Other depsgraphs don't see all changes since the tag is cleared by the active one. */
+    em->deform_tag = EM_DEFORM_TAG_NONE;
   }
 
   BKE_editmesh_free_derivedmesh(em);
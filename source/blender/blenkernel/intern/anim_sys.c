@@ -376,53 +376,70 @@ static bool is_fcurve_evaluatable(FCurve *fcu)
   return true;
 }
 
+/* Resolve the property of the path, without checking the array index. */
+static bool animsys_rna_path_resolve_animateable(PointerRNA *ptr,
+                                                 const char *path,
+                                                 const int array_index,
+                                                 PathResolvedRNA *r_result)
+{
+  /* get property to write to */
+  if (RNA_path_resolve_property(ptr, path, &r_result->ptr, &r_result->prop)) {
+    return (ptr->owner_id == NULL) || RNA_property_animateable(&r_result->ptr, r_result->prop);
+  }
+
+  /* failed to get path */
+  /* XXX don't tag as failed yet though, as there are some legit situations (Action Constraint)
+   * where some channels will not exist, but shouldn't lock up Action */
+  if (G.debug & G_DEBUG) {
+    CLOG_WARN(&LOG,
+              "Animato: Invalid path. ID = '%s',  '%s[%d]'",
+              (ptr->owner_id) ? (ptr->owner_id->name + 2) : "<No ID>",
+              path,
+              array_index);
+  }
+  return false;
+}
+
+/* Set the array index of an already resolved property. */
+static bool animsys_rna_array_index_set(PointerRNA *ptr,
+                                        const char *path,
+                                        const int array_index,
+                                        PathResolvedRNA *r_result)
+{
+  int array_len = RNA_property_array_length(&r_result->ptr, r_result->prop);
+
+  if (array_len && array_index >= array_len) {
+    if (G.debug & G_DEBUG) {
+      CLOG_WARN(&LOG,
+                "Animato: Invalid array index. ID = '%s',  '%s[%d]', array length is %d",
+                (ptr->owner_id) ? (ptr->owner_id->name + 2) : "<No ID>",
+                path,
+                array_index,
+                array_len - 1);
+    }
+    return false;
+  }
+
+  r_result->prop_index = array_len ? array_index : -1;
+  return true;
+}
+
 bool BKE_animsys_store_rna_setting(PointerRNA *ptr,
                                    /* typically 'fcu->rna_path', 'fcu->array_index' */
                                    const char *rna_path,
                                    const int array_index,
                                    PathResolvedRNA *r_result)
 {
-  bool success = false;
   const char *path = rna_path;
 
   /* write value to setting */
-  if (path) {
-    /* get property to write to */
-    if (RNA_path_resolve_property(ptr, path, &r_result->ptr, &r_result->prop)) {
-      if ((ptr->owner_id == NULL) || RNA_property_animateable(&r_result->ptr, r_result->prop)) {
-        int array_len = RNA_property_array_length(&r_result->ptr, r_result->prop);
-
-        if (array_len && array_index >= array_len) {
-          if (G.debug & G_DEBUG) {
-            CLOG_WARN(&LOG,
-                      "Animato: Invalid array index. ID = '%s',  '%s[%d]', array length is %d",
-                      (ptr->owner_id) ? (ptr->owner_id->name + 2) : "<No ID>",
-                      path,
-                      array_index,
-                      array_len - 1);
-          }
-        }
-        else {
-          r_result->prop_index = array_len ? array_index : -1;
-          success = true;
-        }
-      }
-    }
-    else {
-      /* failed to get path */
-      /* XXX don't tag as failed yet though, as there are some legit situations (Action Constraint)
-       * where some channels will not exist, but shouldn't lock up Action */
-      if (G.debug & G_DEBUG) {
-        CLOG_WARN(&LOG,
-                  "Animato: Invalid path. ID = '%s',  '%s[%d]'",
-                  (ptr->owner_id) ? (ptr->owner_id->name + 2) : "<No ID>",
-                  path,
-                  array_index);
-      }
-    }
+  if (path == NULL) {
+    return false;
   }
-
-  return success;
+  if (!animsys_rna_path_resolve_animateable(ptr, path, array_index, r_result)) {
+    return false;
+  }
+  return animsys_rna_array_index_set(ptr, path, array_index, r_result);
 }
 
 /* less than 1.0 evaluates to false, use epsilon to avoid float error */
@@ -606,15 +623,30 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
                                      const AnimationEvalContext *anim_eval_context,
                                      bool flush_to_original)
 {
+  /* Consecutive F-Curves usually animate the items of the same array property (location,
+   * rotation, ...), only resolve the path once for all of them. */
+  const char *prev_rna_path = NULL;
+  bool prev_rna_path_resolved = false;
+  PathResolvedRNA anim_rna;
+
   /* Calculate then execute each curve. */
   LISTBASE_FOREACH (FCurve *, fcu, list) {
 
     if (!is_fcurve_evaluatable(fcu)) {
       continue;
     }
+    if (fcu->rna_path == NULL) {
+      continue;
+    }
 
-    PathResolvedRNA anim_rna;
-    if (BKE_animsys_store_rna_setting(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+    if (prev_rna_path == NULL || !STREQ(prev_rna_path, fcu->rna_path)) {
+      prev_rna_path = fcu->rna_path;
+      prev_rna_path_resolved = animsys_rna_path_resolve_animateable(
+          ptr, fcu->rna_path, fcu->array_index, &anim_rna);
+    }
+
+    if (prev_rna_path_resolved &&
+        animsys_rna_array_index_set(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
       const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
       BKE_animsys_write_rna_setting(&anim_rna, curval);
       if (flush_to_original) {
@@ -1741,12 +1773,22 @@ static void nlasnapshot_from_action(PointerRNA *ptr,
   const float modified_evaltime = evaluate_time_fmodifiers(
       &storage, modifiers, NULL, 0.0f, evaltime);
 
+  /* Consecutive F-Curves usually animate the items of the same property,
+   * only look up the channel once for all of them (see #animsys_evaluate_fcurves). */
+  const char *prev_rna_path = NULL;
+  NlaEvalChannel *nec = NULL;
+  NlaEvalChannelSnapshot *necs = NULL;
+
   for (fcu = action->curves.first; fcu; fcu = fcu->next) {
     if (!is_fcurve_evaluatable(fcu)) {
       continue;
     }
 
-    NlaEvalChannel *nec = nlaevalchan_verify(ptr, channels, fcu->rna_path);
+    if (prev_rna_path == NULL || fcu->rna_path == NULL || !STREQ(prev_rna_path, fcu->rna_path)) {
+      prev_rna_path = fcu->rna_path;
+      nec = nlaevalchan_verify(ptr, channels, fcu->rna_path);
+      necs = NULL;
+    }
 
     /* Invalid path or property cannot be animated. */
     if (nec == NULL) {
@@ -1757,7 +1799,9 @@ static void nlasnapshot_from_action(PointerRNA *ptr,
       continue;
     }
 
-    NlaEvalChannelSnapshot *necs = nlaeval_snapshot_ensure_channel(r_snapshot, nec);
+    if (necs == NULL) {
+      necs = nlaeval_snapshot_ensure_channel(r_snapshot, nec);
+    }
 
     float value = evaluate_fcurve(fcu, modified_evaltime);
     evaluate_value_fmodifiers(&storage, modifiers, fcu, &value, evaltime);
@@ -258,6 +258,12 @@ typedef struct ArmatureUserdata {
   bPoseChannel **pchan_from_defbase;
   int defbase_len;
 
+  /** Bone deform matrices with #premat and #postmat applied, indexed like #pchan_from_defbase.
+   * Only set when vertices can use plain linear blend skinning, see #armature_vert_task_linear. */
+  float (*defbase_deform_mats)[4][4];
+  /** False for groups that can't be blended linearly (B-Bones or envelope multiplied). */
+  bool *defbase_is_linear;
+
   float premat[4][4];
   float postmat[4][4];
 
@@ -267,10 +273,76 @@ typedef struct ArmatureUserdata {
   } bmesh;
 } ArmatureUserdata;
 
+/**
+ * Linear blend skinning of a vertex using the bone matrices precomputed in target space,
+ * blending the matrices of all influences and transforming the vertex once.
+ *
+ * \return false when the vertex needs the generic code-path.
+ */
+static bool armature_vert_task_linear(const ArmatureUserdata *data,
+                                      const int i,
+                                      const MDeformVert *dvert)
+{
+  float armature_weight = 1.0f;
+
+  if (data->armature_def_nr != -1) {
+    armature_weight = BKE_defvert_find_weight(dvert, data->armature_def_nr);
+
+    if (data->invert_vgroup) {
+      armature_weight = 1.0f - armature_weight;
+    }
+  }
+
+  if (armature_weight == 0.0f) {
+    return true;
+  }
+
+  float summat[4][4];
+  float contrib = 0.0f;
+  bool deformed = false;
+
+  zero_m4(summat);
+
+  const MDeformWeight *dw = dvert->dw;
+  for (uint j = dvert->totweight; j != 0; j--, dw++) {
+    const uint index = dw->def_nr;
+    if (index < data->defbase_len && data->pchan_from_defbase[index]) {
+      if (!data->defbase_is_linear[index]) {
+        return false;
+      }
+      deformed = true;
+
+      if (dw->weight != 0.0f) {
+        madd_m4_m4m4fl(summat, summat, data->defbase_deform_mats[index], dw->weight);
+        contrib += dw->weight;
+      }
+    }
+  }
+
+  if (!deformed && data->use_envelope) {
+    return false;
+  }
+
+  /* actually should be EPSILON? weight values and contrib can be like 10e-39 small */
+  if (contrib > 0.0001f) {
+    float co[3];
+    mul_v3_m4v3(co, summat, data->vert_coords[i]);
+    mul_v3_fl(co, 1.0f / contrib);
+    interp_v3_v3v3(data->vert_coords[i], data->vert_coords[i], co, armature_weight);
+  }
+
+  return true;
+}
+
 static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
                                           const int i,
                                           const MDeformVert *dvert)
 {
+  if (data->defbase_deform_mats && dvert && dvert->totweight &&
+      armature_vert_task_linear(data, i, dvert)) {
+    return;
+  }
+
   float(*const vert_coords)[3] = data->vert_coords;
   float(*const vert_deform_mats)[3][3] = data->vert_deform_mats;
   float(*const vert_coords_prev)[3] = data->vert_coords_prev;
@@ -588,6 +660,30 @@ static void armature_deform_coords_impl(const Object *ob_arm,
   mul_m4_m4m4(data.postmat, obinv, ob_arm->obmat);
   invert_m4_m4(data.premat, data.postmat);
 
+  /* Without dual quaternions, deform matrices or blending with previous coordinates, a vertex
+   * deformed by regular bones is a weighted sum of the bone matrices in target space.
+   * Compute those once here instead of transforming every vertex in and out of armature space
+   * and through every bone separately. */
+  if (use_dverts && !use_quaternion && vert_deform_mats == NULL && vert_coords_prev == NULL &&
+      defbase_len > 0) {
+    data.defbase_deform_mats = MEM_malloc_arrayN(
+        defbase_len, sizeof(*data.defbase_deform_mats), __func__);
+    data.defbase_is_linear = MEM_calloc_arrayN(defbase_len, sizeof(bool), __func__);
+    for (i = 0; i < defbase_len; i++) {
+      const bPoseChannel *pchan = pchan_from_defbase[i];
+      if (pchan == NULL) {
+        continue;
+      }
+      const Bone *bone = pchan->bone;
+      if ((bone->segments > 1 && pchan->runtime.bbone_segments == bone->segments) ||
+          (bone->flag & BONE_MULT_VG_ENV)) {
+        continue;
+      }
+      mul_m4_series(data.defbase_deform_mats[i], data.postmat, pchan->chan_mat, data.premat);
+      data.defbase_is_linear[i] = true;
+    }
+  }
+
   if (em_target != NULL) {
     /* While this could cause an extra loop over mesh data, in most cases this will
      * have already been properly set. */
@@ -611,6 +707,8 @@ static void armature_deform_coords_impl(const Object *ob_arm,
   if (pchan_from_defbase) {
     MEM_freeN(pchan_from_defbase);
   }
+  MEM_SAFE_FREE(data.defbase_deform_mats);
+  MEM_SAFE_FREE(data.defbase_is_linear);
 }
 
 void BKE_armature_deform_coords_with_gpencil_stroke(const Object *ob_arm,
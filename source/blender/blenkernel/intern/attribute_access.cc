@@ -31,6 +31,7 @@
 #include "BLI_color.hh"
 #include "BLI_float2.hh"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 
 #include "CLG_log.h"
 
@@ -82,9 +83,12 @@ void ReadAttribute::initialize_span() const
   const int element_size = cpp_type_.size();
   array_buffer_ = MEM_mallocN_aligned(size_ * element_size, cpp_type_.alignment(), __func__);
   array_is_temporary_ = true;
-  for (const int i : IndexRange(size_)) {
-    this->get_internal(i, POINTER_OFFSET(array_buffer_, i * element_size));
-  }
+  /* Reading elements does not modify the attribute, so they can be retrieved in parallel. */
+  parallel_for(IndexRange(size_), 4096, [&](IndexRange range) {
+    for (const int i : range) {
+      this->get_internal(i, POINTER_OFFSET(array_buffer_, i * element_size));
+    }
+  });
 }
 
 WriteAttribute::~WriteAttribute()
@@ -462,6 +466,32 @@ class ConvertedReadAttribute final : public ReadAttribute {
   }
 };
 
+/* Gives access to the values of an attribute that is shared with other users, e.g. an attribute
+ * that has been interpolated to another domain once and is cached on the geometry component. */
+class SharedReadAttribute final : public ReadAttribute {
+ private:
+  std::shared_ptr<const ReadAttribute> attribute_;
+
+ public:
+  SharedReadAttribute(std::shared_ptr<const ReadAttribute> attribute)
+      : ReadAttribute(attribute->domain(), attribute->cpp_type(), attribute->size()),
+        attribute_(std::move(attribute))
+  {
+  }
+
+  void get_internal(const int64_t index, void *r_value) const override
+  {
+    attribute_->get(index, r_value);
+  }
+
+  void initialize_span() const override
+  {
+    /* The values are not modified, so this const_cast is fine. */
+    array_buffer_ = const_cast<void *>(attribute_->get_span().data());
+    array_is_temporary_ = false;
+  }
+};
+
 /** \} */
 
 const blender::fn::CPPType *custom_data_type_to_cpp_type(const CustomDataType type)
@@ -1617,6 +1647,14 @@ ReadAttributePtr GeometryComponent::attribute_try_adapt_domain(
   return {};
 }
 
+ReadAttributePtr GeometryComponent::attribute_try_adapt_domain_cached(
+    const StringRef UNUSED(attribute_name),
+    ReadAttributePtr attribute,
+    const AttributeDomain new_domain) const
+{
+  return this->attribute_try_adapt_domain(std::move(attribute), new_domain);
+}
+
 WriteAttributePtr GeometryComponent::attribute_try_get_for_write(const StringRef attribute_name)
 {
   using namespace blender::bke;
@@ -1773,7 +1811,8 @@ ReadAttributePtr GeometryComponent::attribute_try_get_for_read(
   }
 
   if (attribute->domain() != domain) {
-    attribute = this->attribute_try_adapt_domain(std::move(attribute), domain);
+    attribute = this->attribute_try_adapt_domain_cached(
+        attribute_name, std::move(attribute), domain);
     if (!attribute) {
       return {};
     }
@@ -1804,7 +1843,8 @@ ReadAttributePtr GeometryComponent::attribute_try_get_for_read(const StringRef a
   }
 
   if (attribute->domain() != domain) {
-    attribute = this->attribute_try_adapt_domain(std::move(attribute), domain);
+    attribute = this->attribute_try_adapt_domain_cached(
+        attribute_name, std::move(attribute), domain);
     if (!attribute) {
       return {};
     }
@@ -2067,8 +2107,9 @@ static void adapt_mesh_domain_corner_to_point_impl(const Mesh &mesh,
   BLI_assert(r_values.size() == mesh.totvert);
   attribute_math::DefaultMixer<T> mixer(r_values);
 
+  Span<T> values = attribute.get_span();
   for (const int loop_index : IndexRange(mesh.totloop)) {
-    const T value = attribute[loop_index];
+    const T value = values[loop_index];
     const MLoop &loop = mesh.mloop[loop_index];
     const int point_index = loop.v;
     mixer.mix_in(point_index, value);
@@ -2102,10 +2143,13 @@ static void adapt_mesh_domain_point_to_corner_impl(const Mesh &mesh,
 {
   BLI_assert(r_values.size() == mesh.totloop);
 
-  for (const int loop_index : IndexRange(mesh.totloop)) {
-    const int vertex_index = mesh.mloop[loop_index].v;
-    r_values[loop_index] = attribute[vertex_index];
-  }
+  Span<T> values = attribute.get_span();
+  parallel_for(IndexRange(mesh.totloop), 4096, [&](IndexRange range) {
+    for (const int loop_index : range) {
+      const int vertex_index = mesh.mloop[loop_index].v;
+      r_values[loop_index] = values[vertex_index];
+    }
+  });
 }
 
 static ReadAttributePtr adapt_mesh_domain_point_to_corner(const Mesh &mesh,
@@ -2168,4 +2212,40 @@ ReadAttributePtr MeshComponent::attribute_try_adapt_domain(ReadAttributePtr attr
   return {};
 }
 
+ReadAttributePtr MeshComponent::attribute_try_adapt_domain_cached(
+    const StringRef attribute_name,
+    ReadAttributePtr attribute,
+    const AttributeDomain new_domain) const
+{
+  if (!attribute || attribute->domain() == new_domain) {
+    return this->attribute_try_adapt_domain(std::move(attribute), new_domain);
+  }
+
+  const std::pair<std::string, int> key{attribute_name, new_domain};
+  {
+    std::lock_guard lock{adapted_attributes_mutex_};
+    const std::shared_ptr<const blender::bke::ReadAttribute> *cached_attribute =
+        adapted_attributes_.lookup_ptr(key);
+    if (cached_attribute != nullptr) {
+      return std::make_unique<blender::bke::SharedReadAttribute>(*cached_attribute);
+    }
+  }
+
+  ReadAttributePtr new_attribute = this->attribute_try_adapt_domain(std::move(attribute),
+                                                                    new_domain);
+  if (!new_attribute || this->is_mutable()) {
+    /* A mutable mesh might be changed by the caller later on, so the values can't be reused. */
+    return new_attribute;
+  }
+
+  /* The lock is not held while interpolating, because that may use multiple threads. When two
+   * threads interpolate the same attribute at the same time, the first result is kept. */
+  std::shared_ptr<const blender::bke::ReadAttribute> shared_attribute{std::move(new_attribute)};
+  {
+    std::lock_guard lock{adapted_attributes_mutex_};
+    shared_attribute = adapted_attributes_.lookup_or_add(key, shared_attribute);
+  }
+  return std::make_unique<blender::bke::SharedReadAttribute>(std::move(shared_attribute));
+}
+
 /** \} */
@@ -1566,6 +1566,7 @@ BVHTree *BKE_bvhtree_from_mesh_get(struct BVHTreeFromMesh *data,
     case BVHTREE_FROM_EM_VERTS:
     case BVHTREE_FROM_EM_EDGES:
     case BVHTREE_FROM_EM_LOOPTRI:
+    case BVHTREE_FROM_POINTCLOUD:
     case BVHTREE_MAX_ITEM:
       BLI_assert(false);
       break;
@@ -1657,6 +1658,7 @@ BVHTree *BKE_bvhtree_from_editmesh_get(BVHTreeFromEditMesh *data,
     case BVHTREE_FROM_LOOPTRI_NO_HIDDEN:
     case BVHTREE_FROM_LOOSEVERTS:
     case BVHTREE_FROM_LOOSEEDGES:
+    case BVHTREE_FROM_POINTCLOUD:
     case BVHTREE_MAX_ITEM:
       BLI_assert(false);
       break;
@@ -1725,9 +1727,8 @@ void free_bvhtree_from_mesh(struct BVHTreeFromMesh *data)
 /** \name Point Cloud BVH Building
  * \{ */
 
-BVHTree *BKE_bvhtree_from_pointcloud_get(BVHTreeFromPointCloud *data,
-                                         const PointCloud *pointcloud,
-                                         const int tree_type)
+static BVHTree *bvhtree_from_pointcloud_create_tree(const PointCloud *pointcloud,
+                                                    const int tree_type)
 {
   BVHTree *tree = BLI_bvhtree_new(pointcloud->totpoint, 0.0f, tree_type, 6);
   if (!tree) {
@@ -1740,6 +1741,35 @@ BVHTree *BKE_bvhtree_from_pointcloud_get(BVHTreeFromPointCloud *data,
   BLI_assert(BLI_bvhtree_get_len(tree) == pointcloud->totpoint);
   BLI_bvhtree_balance(tree);
 
+  return tree;
+}
+
+/* Lazy initialization of #PointCloud_Runtime.bvh_cache, point clouds have no mutex of their own. */
+static ThreadMutex pointcloud_bvh_cache_mutex = BLI_MUTEX_INITIALIZER;
+
+/**
+ * The tree is stored in the point cloud's BVH cache, so later calls with the same point cloud
+ * reuse it. The cache is freed when the point cloud may be modified,
+ * see #BKE_pointcloud_runtime_clear_cache.
+ */
+BVHTree *BKE_bvhtree_from_pointcloud_get(BVHTreeFromPointCloud *data,
+                                         const PointCloud *pointcloud,
+                                         const int tree_type)
+{
+  /* This only updates a cache and can be considered to be logically const. */
+  BVHCache **bvh_cache_p = (BVHCache **)&pointcloud->runtime.bvh_cache;
+
+  BVHTree *tree = NULL;
+  bool lock_started = false;
+  data->cached = bvhcache_find(
+      bvh_cache_p, BVHTREE_FROM_POINTCLOUD, &tree, &lock_started, &pointcloud_bvh_cache_mutex);
+  if (data->cached == false) {
+    tree = bvhtree_from_pointcloud_create_tree(pointcloud, tree_type);
+    bvhcache_insert(*bvh_cache_p, tree, BVHTREE_FROM_POINTCLOUD);
+    bvhcache_unlock(*bvh_cache_p, lock_started);
+    data->cached = true;
+  }
+
   data->coords = pointcloud->co;
   data->tree = tree;
   data->nearest_callback = NULL;
@@ -1749,7 +1779,7 @@ BVHTree *BKE_bvhtree_from_pointcloud_get(BVHTreeFromPointCloud *data,
 
 void free_bvhtree_from_pointcloud(BVHTreeFromPointCloud *data)
 {
-  if (data->tree) {
+  if (data->tree && !data->cached) {
     BLI_bvhtree_free(data->tree);
   }
   memset(data, 0, sizeof(*data));
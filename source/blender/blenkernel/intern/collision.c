@@ -1547,19 +1547,14 @@ static bool cloth_bvh_obj_overlap_cb(void *userdata,
 
 static bool cloth_bvh_self_overlap_cb(void *userdata, int index_a, int index_b, int UNUSED(thread))
 {
-  /* No need for equal combinations (eg. (0,1) & (1,0)). */
-  if (index_a < index_b) {
-    ClothModifierData *clmd = (ClothModifierData *)userdata;
-    struct Cloth *clothObject = clmd->clothObject;
-    const MVertTri *tri_a, *tri_b;
-    tri_a = &clothObject->tri[index_a];
-    tri_b = &clothObject->tri[index_b];
-
-    if (cloth_bvh_selfcollision_is_active(clmd, clothObject, tri_a, tri_b)) {
-      return true;
-    }
-  }
-  return false;
+  /* Equal combinations (eg. (0,1) & (1,0)) are only reported once by the self overlap. */
+  ClothModifierData *clmd = (ClothModifierData *)userdata;
+  struct Cloth *clothObject = clmd->clothObject;
+  const MVertTri *tri_a, *tri_b;
+  tri_a = &clothObject->tri[index_a];
+  tri_b = &clothObject->tri[index_b];
+
+  return cloth_bvh_selfcollision_is_active(clmd, clothObject, tri_a, tri_b);
 }
 
 int cloth_bvh_collision(
@@ -1625,8 +1620,8 @@ int cloth_bvh_collision(
   if (clmd->coll_parms->flags & CLOTH_COLLSETTINGS_FLAG_SELF) {
     bvhtree_update_from_cloth(clmd, false, true);
 
-    overlap_self = BLI_bvhtree_overlap(
-        cloth->bvhselftree, cloth->bvhselftree, &coll_count_self, cloth_bvh_self_overlap_cb, clmd);
+    overlap_self = BLI_bvhtree_overlap_self(
+        cloth->bvhselftree, &coll_count_self, cloth_bvh_self_overlap_cb, clmd);
   }
 
   do {
@@ -26,6 +26,8 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "atomic_ops.h"
+
 /* Since we have versioning code here (CustomData_verify_versions()). */
 #define DNA_DEPRECATED_ALLOW
 
@@ -2095,6 +2097,89 @@ static bool customdata_typemap_is_valid(const CustomData *data)
 }
 #endif
 
+/* -------------------------------------------------------------------- */
+/** \name Layer Data Sharing
+ *
+ * Plain layers (without copy or free callbacks) can share their data with copies of the
+ * #CustomData, see #CD_SHARE. The data is owned by a #CustomDataLayerSharing which counts all
+ * layers using it and frees the data with the last one.
+ *
+ * Layers using shared data must not be written to, call
+ * #CustomData_duplicate_referenced_layer first to get an array owned by the layer.
+ * \{ */
+
+typedef struct CustomDataLayerSharing {
+  void *data;
+  int users;
+} CustomDataLayerSharing;
+
+static bool customData_layer_can_share(const CustomDataLayer *layer, int totelem)
+{
+  if (layer->data == NULL || totelem == 0 || (layer->flag & CD_FLAG_NOFREE)) {
+    return false;
+  }
+  const LayerTypeInfo *typeInfo = layerType_getInfo(layer->type);
+  return typeInfo->copy == NULL && typeInfo->free == NULL;
+}
+
+/**
+ * Add a user to the shared data of \a layer, creating the sharing info when the layer owned its
+ * data alone so far. The source of a copy is const in the API, the sharing info is run-time data
+ * which may be created from multiple threads at once (e.g. by different depsgraphs).
+ */
+static CustomDataLayerSharing *customData_layer_sharing_add_user(const CustomDataLayer *layer)
+{
+  CustomDataLayerSharing **sharing_p = (CustomDataLayerSharing **)&layer->sharing;
+  CustomDataLayerSharing *sharing = *sharing_p;
+  if (sharing == NULL) {
+    CustomDataLayerSharing *sharing_new = MEM_mallocN(sizeof(*sharing_new), __func__);
+    sharing_new->data = layer->data;
+    sharing_new->users = 1;
+    sharing = atomic_cas_ptr((void **)sharing_p, NULL, sharing_new);
+    if (sharing == NULL) {
+      sharing = sharing_new;
+    }
+    else {
+      MEM_freeN(sharing_new);
+    }
+  }
+  BLI_assert(sharing->data == layer->data);
+  atomic_add_and_fetch_int32(&sharing->users, 1);
+  return sharing;
+}
+
+/** Remove the layer as user of its shared data, freeing the data when it was the last user. */
+static void customData_layer_sharing_remove_user(CustomDataLayer *layer)
+{
+  CustomDataLayerSharing *sharing = layer->sharing;
+  if (atomic_sub_and_fetch_int32(&sharing->users, 1) == 0) {
+    MEM_freeN(sharing->data);
+    MEM_freeN(sharing);
+  }
+  layer->sharing = NULL;
+}
+
+/** Make sure the layer is the only owner of its data, so that it can be modified. */
+static void customData_layer_ensure_owned(CustomDataLayer *layer)
+{
+  CustomDataLayerSharing *sharing = layer->sharing;
+  if (sharing == NULL) {
+    return;
+  }
+  if (sharing->users == 1) {
+    /* Other users freed their copies already, take the data back. */
+    MEM_freeN(sharing);
+    layer->sharing = NULL;
+    return;
+  }
+  /* Plain layers only, so a byte copy is enough. */
+  void *data = MEM_dupallocN(layer->data);
+  customData_layer_sharing_remove_user(layer);
+  layer->data = data;
+}
+
+/** \} */
+
 bool CustomData_merge(const struct CustomData *source,
                       struct CustomData *dest,
                       CustomDataMask mask,
@@ -2145,6 +2230,7 @@ bool CustomData_merge(const struct CustomData *source,
       case CD_ASSIGN:
       case CD_REFERENCE:
       case CD_DUPLICATE:
+      case CD_SHARE:
         data = layer->data;
         break;
       default:
@@ -2156,6 +2242,19 @@ bool CustomData_merge(const struct CustomData *source,
       newlayer = customData_add_layer__internal(
           dest, type, CD_REFERENCE, data, totelem, layer->name);
     }
+    else if (alloctype == CD_SHARE) {
+      if (customData_layer_can_share(layer, totelem)) {
+        newlayer = customData_add_layer__internal(
+            dest, type, CD_ASSIGN, data, totelem, layer->name);
+        if (newlayer) {
+          newlayer->sharing = customData_layer_sharing_add_user(layer);
+        }
+      }
+      else {
+        newlayer = customData_add_layer__internal(
+            dest, type, CD_DUPLICATE, data, totelem, layer->name);
+      }
+    }
     else {
       newlayer = customData_add_layer__internal(dest, type, alloctype, data, totelem, layer->name);
     }
@@ -2186,6 +2285,7 @@ void CustomData_realloc(CustomData *data, int totelem)
       continue;
     }
     typeInfo = layerType_getInfo(layer->type);
+    customData_layer_ensure_owned(layer);
     layer->data = MEM_reallocN(layer->data, (size_t)totelem * typeInfo->size);
   }
 }
@@ -2209,6 +2309,11 @@ static void customData_free_layer__internal(CustomDataLayer *layer, int totelem)
 {
   const LayerTypeInfo *typeInfo;
 
+  if (layer->sharing) {
+    customData_layer_sharing_remove_user(layer);
+    return;
+  }
+
   if (!(layer->flag & CD_FLAG_NOFREE) && layer->data) {
     typeInfo = layerType_getInfo(layer->type);
 
@@ -2583,6 +2688,7 @@ static CustomDataLayer *customData_add_layer__internal(CustomData *data,
   data->layers[index].type = type;
   data->layers[index].flag = flag;
   data->layers[index].data = newlayerdata;
+  data->layers[index].sharing = NULL;
 
   /* Set default name if none exists. Note we only call DATA_()  once
    * we know there is a default name, to avoid overhead of locale lookups
@@ -2762,6 +2868,8 @@ static void *customData_duplicate_referenced_layer_index(CustomData *data,
 
   CustomDataLayer *layer = &data->layers[layer_index];
 
+  customData_layer_ensure_owned(layer);
+
   if (layer->flag & CD_FLAG_NOFREE) {
     /* MEM_dupallocN won't work in case of complex layers, like e.g.
      * CD_MDEFORMVERT, which has pointers to allocated data...
@@ -3267,6 +3375,8 @@ void *CustomData_set_layer(const CustomData *data, int type, void *ptr)
   if (layer_index == -1) {
     return NULL;
   }
+  /* Shared data is not owned by the caller, see #CustomData_duplicate_referenced_layer. */
+  BLI_assert(data->layers[layer_index].sharing == NULL);
 
   data->layers[layer_index].data = ptr;
 
@@ -3280,6 +3390,8 @@ void *CustomData_set_layer_n(const struct CustomData *data, int type, int n, voi
   if (layer_index == -1) {
     return NULL;
   }
+  /* Shared data is not owned by the caller, see #CustomData_duplicate_referenced_layer. */
+  BLI_assert(data->layers[layer_index].sharing == NULL);
 
   data->layers[layer_index].data = ptr;
 
@@ -4258,7 +4370,10 @@ void CustomData_blend_write_prepare(CustomData *data,
         }
         write_layers_size += chunk_size;
       }
-      write_layers[j++] = *layer;
+      write_layers[j] = *layer;
+      /* Run-time only. */
+      write_layers[j].sharing = NULL;
+      j++;
     }
   }
   BLI_assert(j == data->totlayer);
@@ -5191,6 +5306,7 @@ void CustomData_blend_read(BlendDataReader *reader, CustomData *data, int count)
     }
 
     layer->flag &= ~CD_FLAG_NOFREE;
+    layer->sharing = NULL;
 
     if (CustomData_verify_versions(data, i)) {
       BLO_read_data_address(reader, &layer->data);
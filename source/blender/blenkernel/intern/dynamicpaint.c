@@ -258,8 +258,15 @@ typedef struct PaintAdjData {
   int *border;
   /** Size of border. */
   int total_border;
+  /** Blocks of points neighboring each block of points, created on demand for wave stepping.
+   * Read block_targets from block_index[block] to block_index[block + 1]. */
+  int *block_index;
+  int *block_targets;
 } PaintAdjData;
 
+/* Points are grouped into blocks of (1 << ADJ_BLOCK_SHIFT) to skip resting regions. */
+#define ADJ_BLOCK_SHIFT 8
+
 /************************* Runtime evaluation store ***************************/
 
 void dynamicPaint_Modifier_free_runtime(DynamicPaintRuntime *runtime_data)
@@ -892,6 +899,8 @@ static void dynamicPaint_freeAdjData(PaintSurfaceData *data)
     if (data->adj_data->border) {
       MEM_freeN(data->adj_data->border);
     }
+    MEM_SAFE_FREE(data->adj_data->block_index);
+    MEM_SAFE_FREE(data->adj_data->block_targets);
     MEM_freeN(data->adj_data);
     data->adj_data = NULL;
   }
@@ -5078,6 +5087,7 @@ typedef struct DynamicPaintEffectData {
   const float min_dist;
   const float damp_factor;
   const bool reset_wave;
+  bool *block_active;
 } DynamicPaintEffectData;
 
 /*
@@ -5625,12 +5635,65 @@ static void dynamicPaint_doBorderStep(DynamicPaintSurface *surface)
       0, sData->adj_data->total_border, &data, dynamic_paint_border_cb, &settings);
 }
 
-static void dynamic_paint_wave_step_cb(void *__restrict userdata,
-                                       const int index,
-                                       const TaskParallelTLS *__restrict UNUSED(tls))
+/* Create the neighbor lists of blocks of points, kept with the adjacency data. */
+static void dynamic_paint_adjacency_blocks_ensure(PaintSurfaceData *sData)
 {
-  const DynamicPaintEffectData *data = userdata;
+  PaintAdjData *ad = sData->adj_data;
+  if (ad->block_index) {
+    return;
+  }
+
+  const int totblock = ((sData->total_points - 1) >> ADJ_BLOCK_SHIFT) + 1;
+  int *block_stamp = MEM_malloc_arrayN(totblock, sizeof(int), __func__);
+  int *block_index = MEM_malloc_arrayN(totblock + 1, sizeof(int), "Surface Adj Block Index");
+  int *block_targets = NULL;
+
+  /* First count the neighbor blocks (only to allocate), then fill them in. */
+  for (int pass = 0; pass < 2; pass++) {
+    int tot = 0;
+    copy_vn_i(block_stamp, totblock, -1);
+
+    for (int block = 0; block < totblock; block++) {
+      const int start = block << ADJ_BLOCK_SHIFT;
+      const int end = min_ii(start + (1 << ADJ_BLOCK_SHIFT), sData->total_points);
+
+      block_index[block] = tot;
+      for (int index = start; index < end; index++) {
+        for (int i = 0; i < ad->n_num[index]; i++) {
+          const int target = ad->n_target[ad->n_index[index] + i] >> ADJ_BLOCK_SHIFT;
+          if (target != block && block_stamp[target] != block) {
+            block_stamp[target] = block;
+            if (block_targets) {
+              block_targets[tot] = target;
+            }
+            tot++;
+          }
+        }
+      }
+    }
+    block_index[totblock] = tot;
 
+    if (pass == 0) {
+      block_targets = MEM_malloc_arrayN(max_ii(tot, 1), sizeof(int), "Surface Adj Block Targets");
+    }
+  }
+
+  MEM_freeN(block_stamp);
+  ad->block_index = block_index;
+  ad->block_targets = block_targets;
+}
+
+BLI_INLINE void dynamic_paint_wave_point_reset(PaintWavePoint *wPoint)
+{
+  /* if there wasn't any brush intersection, clear isect height */
+  if (wPoint->state == DPAINT_WAVE_NONE) {
+    wPoint->brush_isect = 0.0f;
+  }
+  wPoint->state = DPAINT_WAVE_NONE;
+}
+
+static void dynamic_paint_wave_step_point(const DynamicPaintEffectData *data, const int index)
+{
   const DynamicPaintSurface *surface = data->surface;
   const PaintSurfaceData *sData = surface->data;
   BakeAdjPoint *bNeighs = sData->bData->bNeighs;
@@ -5716,11 +5779,59 @@ static void dynamic_paint_wave_step_cb(void *__restrict userdata,
   }
 
   if (data->reset_wave) {
-    /* if there wasn't any brush intersection, clear isect height */
-    if (wPoint->state == DPAINT_WAVE_NONE) {
-      wPoint->brush_isect = 0.0f;
+    dynamic_paint_wave_point_reset(wPoint);
+  }
+}
+
+/* Tag blocks that have points which are not at rest. */
+static void dynamic_paint_wave_active_cb(void *__restrict userdata,
+                                         const int block,
+                                         const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const DynamicPaintEffectData *data = userdata;
+  const PaintSurfaceData *sData = data->surface->data;
+  const PaintWavePoint *prevPoint = data->prevPoint;
+  const int start = block << ADJ_BLOCK_SHIFT;
+  const int end = min_ii(start + (1 << ADJ_BLOCK_SHIFT), sData->total_points);
+  bool is_active = false;
+
+  /* Points in brush contact are not stepped and ignored by their neighbors. */
+  for (int index = start; index < end && !is_active; index++) {
+    const PaintWavePoint *wPoint = &prevPoint[index];
+    is_active = wPoint->state <= 0 && (wPoint->height != 0.0f || wPoint->velocity != 0.0f);
+  }
+  data->block_active[block] = is_active;
+}
+
+static void dynamic_paint_wave_step_cb(void *__restrict userdata,
+                                       const int block,
+                                       const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const DynamicPaintEffectData *data = userdata;
+  const PaintSurfaceData *sData = data->surface->data;
+  const PaintAdjData *ad = sData->adj_data;
+  const int start = block << ADJ_BLOCK_SHIFT;
+  const int end = min_ii(start + (1 << ADJ_BLOCK_SHIFT), sData->total_points);
+
+  /* Points at rest that only have neighbors at rest stay at rest,
+   * so blocks can be skipped when neither they nor their neighbor blocks are active. */
+  bool is_active = data->block_active[block];
+  for (int i = ad->block_index[block]; i < ad->block_index[block + 1] && !is_active; i++) {
+    is_active = data->block_active[ad->block_targets[i]];
+  }
+
+  if (is_active) {
+    for (int index = start; index < end; index++) {
+      dynamic_paint_wave_step_point(data, index);
+    }
+  }
+  else if (data->reset_wave) {
+    for (int index = start; index < end; index++) {
+      PaintWavePoint *wPoint = &((PaintWavePoint *)sData->type_data)[index];
+      if (wPoint->state <= 0) {
+        dynamic_paint_wave_point_reset(wPoint);
+      }
     }
-    wPoint->state = DPAINT_WAVE_NONE;
   }
 }
 
@@ -5745,6 +5856,10 @@ static void dynamicPaint_doWaveStep(DynamicPaintSurface *surface, float timescal
     return;
   }
 
+  dynamic_paint_adjacency_blocks_ensure(sData);
+  const int totblock = ((sData->total_points - 1) >> ADJ_BLOCK_SHIFT) + 1;
+  bool *block_active = MEM_malloc_arrayN(totblock, sizeof(bool), __func__);
+
   /* calculate average neigh distance (single thread) */
   for (index = 0; index < sData->total_points; index++) {
     int numOfNeighs = sData->adj_data->n_num[index];
@@ -5780,13 +5895,17 @@ static void dynamicPaint_doWaveStep(DynamicPaintSurface *surface, float timescal
         .min_dist = min_dist,
         .damp_factor = damp_factor,
         .reset_wave = (ss == steps - 1),
+        .block_active = block_active,
     };
     TaskParallelSettings settings;
     BLI_parallel_range_settings_defaults(&settings);
     settings.use_threading = (sData->total_points > 1000);
-    BLI_task_parallel_range(0, sData->total_points, &data, dynamic_paint_wave_step_cb, &settings);
+    settings.min_iter_per_thread = 1;
+    BLI_task_parallel_range(0, totblock, &data, dynamic_paint_wave_active_cb, &settings);
+    BLI_task_parallel_range(0, totblock, &data, dynamic_paint_wave_step_cb, &settings);
   }
 
+  MEM_freeN(block_active);
   MEM_freeN(prevPoint);
 }
 
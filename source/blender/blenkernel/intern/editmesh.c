@@ -175,6 +175,78 @@ void BKE_editmesh_free(BMEditMesh *em)
   }
 }
 
+static bool bm_vert_has_wire_edge(BMVert *v)
+{
+  BMEdge *e_iter, *e_first;
+  e_iter = e_first = v->e;
+  if (e_first == NULL) {
+    return true;
+  }
+  do {
+    if (e_iter->l == NULL) {
+      return true;
+    }
+  } while ((e_iter = BM_DISK_EDGE_NEXT(e_iter, v)) != e_first);
+  return false;
+}
+
+/**
+ * Tag \a eve as moved, when nothing but vertex coordinates change between two evaluations
+ * (interactive transform for e.g.) this lets the draw cache update the data of the faces
+ * around the moved vertices in place instead of extracting all of it again.
+ *
+ * Moving a vertex changes the normals of its faces, and so the normals of all vertices
+ * of those faces which are stored in the loops of their own faces: the range covers
+ * two rings of faces. Loose geometry isn't handled, everything gets updated then.
+ *
+ * \note Face indices must be valid.
+ */
+void BKE_editmesh_deform_tag_vert(BMEditMesh *em, BMVert *eve)
+{
+  if (em->deform_tag == EM_DEFORM_TAG_NONE) {
+    em->deform_tag = EM_DEFORM_TAG_RANGE;
+    em->deform_face_range[0] = INT_MAX;
+    em->deform_face_range[1] = INT_MIN;
+  }
+  else if (em->deform_tag != EM_DEFORM_TAG_RANGE) {
+    return;
+  }
+
+  if (bm_vert_has_wire_edge(eve)) {
+    em->deform_tag = EM_DEFORM_TAG_ALL;
+    return;
+  }
+
+  BMIter iter_f;
+  BMFace *f;
+  BM_ITER_ELEM (f, &iter_f, eve, BM_FACES_OF_VERT) {
+    BMLoop *l_iter, *l_first;
+    l_iter = l_first = BM_FACE_FIRST_LOOP(f);
+    do {
+      if (bm_vert_has_wire_edge(l_iter->v)) {
+        em->deform_tag = EM_DEFORM_TAG_ALL;
+        return;
+      }
+      BMIter iter_f_other;
+      BMFace *f_other;
+      BM_ITER_ELEM (f_other, &iter_f_other, l_iter->v, BM_FACES_OF_VERT) {
+        const int index = BM_elem_index_get(f_other);
+        em->deform_face_range[0] = min_ii(em->deform_face_range[0], index);
+        em->deform_face_range[1] = max_ii(em->deform_face_range[1], index + 1);
+      }
+    } while ((l_iter = l_iter->next) != l_first);
+  }
+}
+
+/**
+ * Any change other than moving vertices (topology, hiding, custom-data...)
+ * must call this so a pending #EM_DEFORM_TAG_RANGE isn't used.
+ */
+void BKE_editmesh_deform_tag_all(BMEditMesh *em)
+{
+  em->deform_tag = EM_DEFORM_TAG_ALL;
+}
+
 struct CageUserData {
   int totvert;
   float (*cos_cage)[3];
@@ -147,6 +147,65 @@ void BKE_partdeflect_free(PartDeflect *pd)
 
 /******************** EFFECTOR RELATIONS ***********************/
 
+/**
+ * With a maximum distance and spherical falloff, mesh surface and vertex effectors
+ * have no influence outside of their bounds grown by that distance.
+ * Calculate those bounds so points far away don't need the per vertex or surface lookups.
+ */
+static void precalculate_effector_bounds(EffectorCache *eff)
+{
+  PartDeflect *pd = eff->pd;
+
+  eff->flag &= ~PE_USE_BOUNDS;
+
+  if (!(pd->flag & PFIELD_USEMAX) || pd->falloff != PFIELD_FALL_SPHERE) {
+    return;
+  }
+
+  INIT_MINMAX(eff->bounds_min, eff->bounds_max);
+
+  if (pd->shape == PFIELD_SHAPE_SURFACE) {
+    if (eff->surmd == NULL || eff->surmd->bvhtree == NULL || eff->surmd->x == NULL) {
+      return;
+    }
+    /* Surface coordinates are already in world space. */
+    for (int i = 0; i < eff->surmd->numverts; i++) {
+      minmax_v3v3_v3(eff->bounds_min, eff->bounds_max, eff->surmd->x[i].co);
+    }
+  }
+  else if (pd->shape == PFIELD_SHAPE_POINTS && eff->psys == NULL) {
+    Mesh *me_eval = BKE_object_get_evaluated_mesh(eff->ob);
+    if (me_eval == NULL) {
+      return;
+    }
+    for (int i = 0; i < me_eval->totvert; i++) {
+      float co[3];
+      mul_v3_m4v3(co, eff->ob->obmat, me_eval->mvert[i].co);
+      minmax_v3v3_v3(eff->bounds_min, eff->bounds_max, co);
+    }
+  }
+  else {
+    return;
+  }
+
+  if (eff->bounds_min[0] > eff->bounds_max[0]) {
+    return;
+  }
+
+  /* Small margin so rounding can't cull a point right at the maximum distance. */
+  const float margin = pd->maxdist * 1.0001f + FLT_EPSILON;
+  add_v3_fl(eff->bounds_min, -margin);
+  add_v3_fl(eff->bounds_max, margin);
+  eff->flag |= PE_USE_BOUNDS;
+}
+
+BLI_INLINE bool effector_bounds_test(const EffectorCache *eff, const float co[3])
+{
+  return (co[0] >= eff->bounds_min[0] && co[0] <= eff->bounds_max[0] &&
+          co[1] >= eff->bounds_min[1] && co[1] <= eff->bounds_max[1] &&
+          co[2] >= eff->bounds_min[2] && co[2] <= eff->bounds_max[2]);
+}
+
 static void precalculate_effector(struct Depsgraph *depsgraph, EffectorCache *eff)
 {
   float ctime = DEG_get_ctime(depsgraph);
@@ -183,6 +242,8 @@ static void precalculate_effector(struct Depsgraph *depsgraph, EffectorCache *ef
   else if (eff->psys) {
     psys_update_particle_tree(eff->psys, ctime);
   }
+
+  precalculate_effector_bounds(eff);
 }
 
 static void add_effector_relation(ListBase *relations,
@@ -1174,6 +1235,10 @@ void BKE_effectors_apply(ListBase *effectors,
     for (eff = effectors->first; eff; eff = eff->next) {
       /* object effectors were fully checked to be OK to evaluate! */
 
+      if ((eff->flag & PE_USE_BOUNDS) && !effector_bounds_test(eff, point->loc)) {
+        continue;
+      }
+
       get_effector_tot(eff, &efd, point, &tot, &p, &step);
 
       for (; p < tot; p += step) {
@@ -18,6 +18,7 @@
 
 #include "BKE_attribute.h"
 #include "BKE_attribute_access.hh"
+#include "BKE_bvhutils.h"
 #include "BKE_geometry_set.hh"
 #include "BKE_lib_id.h"
 #include "BKE_mesh.h"
@@ -27,6 +28,7 @@
 #include "BKE_volume.h"
 
 #include "DNA_collection_types.h"
+#include "DNA_mesh_types.h"
 #include "DNA_object_types.h"
 
 #include "BLI_rand.hh"
@@ -330,6 +332,9 @@ GeometryComponent *MeshComponent::copy() const
     new_component->mesh_ = BKE_mesh_copy_for_eval(mesh_, false);
     new_component->ownership_ = GeometryOwnershipType::Owned;
     new_component->vertex_group_names_ = blender::Map(vertex_group_names_);
+    /* The copied mesh has the same attribute values, until it is changed. */
+    std::lock_guard lock{adapted_attributes_mutex_};
+    new_component->adapted_attributes_ = adapted_attributes_;
   }
   return new_component;
 }
@@ -344,6 +349,7 @@ void MeshComponent::clear()
     mesh_ = nullptr;
   }
   vertex_group_names_.clear();
+  adapted_attributes_.clear();
 }
 
 bool MeshComponent::has_mesh() const
@@ -375,6 +381,7 @@ void MeshComponent::replace_mesh_but_keep_vertex_group_names(Mesh *mesh,
   }
   mesh_ = mesh;
   ownership_ = ownership;
+  adapted_attributes_.clear();
 }
 
 /* Return the mesh and clear the component. The caller takes over responsibility for freeing the
@@ -384,6 +391,7 @@ Mesh *MeshComponent::release()
   BLI_assert(this->is_mutable());
   Mesh *mesh = mesh_;
   mesh_ = nullptr;
+  adapted_attributes_.clear();
   return mesh;
 }
 
@@ -425,6 +433,14 @@ Mesh *MeshComponent::get_for_write()
     mesh_ = BKE_mesh_copy_for_eval(mesh_, false);
     ownership_ = GeometryOwnershipType::Owned;
   }
+  else if (mesh_ != nullptr && mesh_->runtime.bvh_cache != nullptr) {
+    /* The caller might move the vertices, so cached BVH trees can't be used anymore. */
+    bvhcache_free(mesh_->runtime.bvh_cache);
+    mesh_->runtime.bvh_cache = nullptr;
+  }
+  /* The caller might change the mesh, so previously interpolated attributes can't be used
+   * anymore. */
+  adapted_attributes_.clear();
   return mesh_;
 }
 
@@ -511,6 +527,10 @@ PointCloud *PointCloudComponent::get_for_write()
     pointcloud_ = BKE_pointcloud_copy_for_eval(pointcloud_, false);
     ownership_ = GeometryOwnershipType::Owned;
   }
+  else if (pointcloud_ != nullptr) {
+    /* The caller might move the points, so cached BVH trees can't be used anymore. */
+    BKE_pointcloud_runtime_clear_cache(pointcloud_);
+  }
   return pointcloud_;
 }
 
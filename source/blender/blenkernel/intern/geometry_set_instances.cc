@@ -20,6 +20,8 @@
 #include "BKE_modifier.h"
 #include "BKE_pointcloud.h"
 
+#include "BLI_task.hh"
+
 #include "DNA_collection_types.h"
 #include "DNA_mesh_types.h"
 #include "DNA_meshdata_types.h"
@@ -199,6 +201,64 @@ void gather_attribute_info(Map<std::string, AttributeKind> &attributes,
   }
 }
 
+/* The data of an instanced mesh or point cloud and its offsets in the realized mesh. */
+struct RealizedInstance {
+  const Mesh *mesh;
+  const PointCloud *pointcloud;
+  const float4x4 *transform;
+  int vert_offset;
+  int edge_offset;
+  int loop_offset;
+  int poly_offset;
+};
+
+static void copy_mesh_instance(const Mesh &mesh, const RealizedInstance &instance, Mesh &new_mesh)
+{
+  const float4x4 &transform = *instance.transform;
+  for (const int i : IndexRange(mesh.totvert)) {
+    const MVert &old_vert = mesh.mvert[i];
+    MVert &new_vert = new_mesh.mvert[instance.vert_offset + i];
+
+    new_vert = old_vert;
+
+    const float3 new_position = transform * float3(old_vert.co);
+    copy_v3_v3(new_vert.co, new_position);
+  }
+  for (const int i : IndexRange(mesh.totedge)) {
+    const MEdge &old_edge = mesh.medge[i];
+    MEdge &new_edge = new_mesh.medge[instance.edge_offset + i];
+    new_edge = old_edge;
+    new_edge.v1 += instance.vert_offset;
+    new_edge.v2 += instance.vert_offset;
+  }
+  for (const int i : IndexRange(mesh.totloop)) {
+    const MLoop &old_loop = mesh.mloop[i];
+    MLoop &new_loop = new_mesh.mloop[instance.loop_offset + i];
+    new_loop = old_loop;
+    new_loop.v += instance.vert_offset;
+    new_loop.e += instance.edge_offset;
+  }
+  for (const int i : IndexRange(mesh.totpoly)) {
+    const MPoly &old_poly = mesh.mpoly[i];
+    MPoly &new_poly = new_mesh.mpoly[instance.poly_offset + i];
+    new_poly = old_poly;
+    new_poly.loopstart += instance.loop_offset;
+  }
+}
+
+static void copy_pointcloud_instance(const PointCloud &pointcloud,
+                                     const RealizedInstance &instance,
+                                     Mesh &new_mesh)
+{
+  const float4x4 &transform = *instance.transform;
+  for (const int i : IndexRange(pointcloud.totpoint)) {
+    MVert &new_vert = new_mesh.mvert[instance.vert_offset + i];
+    const float3 old_position = pointcloud.co[i];
+    const float3 new_position = transform * old_position;
+    copy_v3_v3(new_vert.co, new_position);
+  }
+}
+
 static Mesh *join_mesh_topology_and_builtin_attributes(Span<GeometryInstanceGroup> set_groups,
                                                        const bool convert_points_to_vertices)
 {
@@ -245,6 +305,9 @@ static Mesh *join_mesh_topology_and_builtin_attributes(Span<GeometryInstanceGrou
   new_mesh->runtime.cd_dirty_edge = cd_dirty_edge;
   new_mesh->runtime.cd_dirty_loop = cd_dirty_loop;
 
+  /* Compute where the data of every instance starts in the new mesh first, so that the instances
+   * can be copied in parallel. */
+  Vector<RealizedInstance> instances;
   int vert_offset = 0;
   int loop_offset = 0;
   int edge_offset = 0;
@@ -254,36 +317,8 @@ static Mesh *join_mesh_topology_and_builtin_attributes(Span<GeometryInstanceGrou
     if (set.has_mesh()) {
       const Mesh &mesh = *set.get_mesh_for_read();
       for (const float4x4 &transform : set_group.transforms) {
-        for (const int i : IndexRange(mesh.totvert)) {
-          const MVert &old_vert = mesh.mvert[i];
-          MVert &new_vert = new_mesh->mvert[vert_offset + i];
-
-          new_vert = old_vert;
-
-          const float3 new_position = transform * float3(old_vert.co);
-          copy_v3_v3(new_vert.co, new_position);
-        }
-        for (const int i : IndexRange(mesh.totedge)) {
-          const MEdge &old_edge = mesh.medge[i];
-          MEdge &new_edge = new_mesh->medge[edge_offset + i];
-          new_edge = old_edge;
-          new_edge.v1 += vert_offset;
-          new_edge.v2 += vert_offset;
-        }
-        for (const int i : IndexRange(mesh.totloop)) {
-          const MLoop &old_loop = mesh.mloop[i];
-          MLoop &new_loop = new_mesh->mloop[loop_offset + i];
-          new_loop = old_loop;
-          new_loop.v += vert_offset;
-          new_loop.e += edge_offset;
-        }
-        for (const int i : IndexRange(mesh.totpoly)) {
-          const MPoly &old_poly = mesh.mpoly[i];
-          MPoly &new_poly = new_mesh->mpoly[poly_offset + i];
-          new_poly = old_poly;
-          new_poly.loopstart += loop_offset;
-        }
-
+        instances.append(
+            {&mesh, nullptr, &transform, vert_offset, edge_offset, loop_offset, poly_offset});
         vert_offset += mesh.totvert;
         loop_offset += mesh.totloop;
         edge_offset += mesh.totedge;
@@ -293,17 +328,23 @@ static Mesh *join_mesh_topology_and_builtin_attributes(Span<GeometryInstanceGrou
     if (convert_points_to_vertices && set.has_pointcloud()) {
       const PointCloud &pointcloud = *set.get_pointcloud_for_read();
       for (const float4x4 &transform : set_group.transforms) {
-        for (const int i : IndexRange(pointcloud.totpoint)) {
-          MVert &new_vert = new_mesh->mvert[vert_offset + i];
-          const float3 old_position = pointcloud.co[i];
-          const float3 new_position = transform * old_position;
-          copy_v3_v3(new_vert.co, new_position);
-        }
+        instances.append({nullptr, &pointcloud, &transform, vert_offset, 0, 0, 0});
         vert_offset += pointcloud.totpoint;
       }
     }
   }
 
+  parallel_for(instances.index_range(), 32, [&](IndexRange range) {
+    for (const RealizedInstance &instance : instances.as_span().slice(range)) {
+      if (instance.mesh != nullptr) {
+        copy_mesh_instance(*instance.mesh, instance, *new_mesh);
+      }
+      else {
+        copy_pointcloud_instance(*instance.pointcloud, instance, *new_mesh);
+      }
+    }
+  });
+
   return new_mesh;
 }
 
@@ -327,6 +368,9 @@ static void join_attributes(Span<GeometryInstanceGroup> set_groups,
     }
     fn::GMutableSpan dst_span = write_attribute->get_span_for_write_only();
 
+    /* Gather the source values of all instances first, then copy them in parallel. */
+    Vector<ReadAttributePtr> source_attributes;
+    Vector<std::pair<fn::GSpan, int>> copies;
     int offset = 0;
     for (const GeometryInstanceGroup &set_group : set_groups) {
       const GeometrySet &set = set_group.geometry_set;
@@ -342,12 +386,11 @@ static void join_attributes(Span<GeometryInstanceGroup> set_groups,
 
           if (source_attribute) {
             fn::GSpan src_span = source_attribute->get_span();
-            const void *src_buffer = src_span.data();
             for (const int UNUSED(i) : set_group.transforms.index_range()) {
-              void *dst_buffer = dst_span[offset];
-              cpp_type->copy_to_initialized_n(src_buffer, dst_buffer, domain_size);
+              copies.append({src_span, offset});
               offset += domain_size;
             }
+            source_attributes.append(std::move(source_attribute));
           }
           else {
             offset += domain_size * set_group.transforms.size();
@@ -356,6 +399,13 @@ static void join_attributes(Span<GeometryInstanceGroup> set_groups,
       }
     }
 
+    parallel_for(copies.index_range(), 32, [&](IndexRange range) {
+      for (const std::pair<fn::GSpan, int> &copy : copies.as_span().slice(range)) {
+        cpp_type->copy_to_initialized_n(
+            copy.first.data(), dst_span[copy.second], copy.first.size());
+      }
+    });
+
     write_attribute->apply_span();
   }
 }
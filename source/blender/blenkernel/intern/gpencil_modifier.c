@@ -29,6 +29,7 @@
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.h"
 #include "BLI_string_utils.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -746,6 +747,26 @@ void BKE_gpencil_prepare_eval_data(Depsgraph *depsgraph, Scene *scene, Object *o
   BKE_gpencil_update_orig_pointers(ob_orig, ob);
 }
 
+typedef struct GpencilDeformStrokeData {
+  GpencilModifierData *md;
+  const GpencilModifierTypeInfo *mti;
+  Depsgraph *depsgraph;
+  Object *ob;
+  bGPDlayer *gpl;
+  bGPDframe *gpf;
+} GpencilDeformStrokeData;
+
+static void gpencil_deform_stroke_task_cb(void *__restrict userdata,
+                                          void *item,
+                                          int UNUSED(index),
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  GpencilDeformStrokeData *data = userdata;
+  bGPDstroke *gps = item;
+
+  data->mti->deformStroke(data->md, data->depsgraph, data->ob, data->gpl, data->gpf, gps);
+}
+
 /** Calculate gpencil modifiers.
  * \param depsgraph: Current depsgraph
  * \param scene: Current scene
@@ -793,9 +814,20 @@ void BKE_gpencil_modifiers_calc(Depsgraph *depsgraph, Scene *scene, Object *ob)
           }
 
           if (mti->deformStroke) {
-            LISTBASE_FOREACH (bGPDstroke *, gps, &gpf->strokes) {
-              mti->deformStroke(md, depsgraph, ob, gpl, gpf, gps);
-            }
+            /* Strokes are deformed independently of each other. */
+            GpencilDeformStrokeData data = {
+                .md = md,
+                .mti = mti,
+                .depsgraph = depsgraph,
+                .ob = ob,
+                .gpl = gpl,
+                .gpf = gpf,
+            };
+            TaskParallelSettings settings;
+            BLI_parallel_range_settings_defaults(&settings);
+            settings.min_iter_per_thread = 16;
+            BLI_task_parallel_listbase(
+                &gpf->strokes, &data, gpencil_deform_stroke_task_cb, &settings);
           }
         }
       }
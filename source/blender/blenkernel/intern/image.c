@@ -5701,6 +5701,33 @@ bool BKE_image_has_loaded_ibuf(Image *image)
   return has_loaded_ibuf;
 }
 
+/**
+ * Load a reduced resolution level of the image file for drawing, when the file stores those
+ * (tiled, mip-mapped OpenEXR). This avoids reading the full resolution image when only a
+ * limited texture size is drawn. Images that are already loaded are skipped, their buffer is
+ * used instead.
+ *
+ * The result is not cached in the image, it is to be freed with #IMB_freeImBuf.
+ * Returns NULL when no reduced level could be loaded.
+ */
+ImBuf *BKE_image_load_gpu_mip_level(Image *ima, ImageUser *iuser, int max_size, int r_full_size[2])
+{
+  if (!ELEM(ima->source, IMA_SRC_FILE, IMA_SRC_TILED) || ima->type != IMA_TYPE_IMAGE) {
+    return NULL;
+  }
+  if (BKE_image_has_packedfile(ima) || BKE_image_is_multiview(ima) ||
+      BKE_image_has_loaded_ibuf(ima)) {
+    return NULL;
+  }
+
+  char filepath[FILE_MAX];
+  BKE_image_user_file_path(iuser, ima, filepath);
+
+  const int flag = IB_rect | imbuf_alpha_flags_for_image(ima);
+  return IMB_loadiffname_mip_level(
+      filepath, flag, ima->colorspace_settings.name, max_size, r_full_size);
+}
+
 /**
  * References the result, #BKE_image_release_ibuf is to be called to de-reference.
  * Use lock=NULL when calling #BKE_image_release_ibuf().
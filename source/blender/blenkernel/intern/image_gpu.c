@@ -97,6 +97,45 @@ static int smaller_power_of_2_limit(int num, bool limit_gl_texture_size)
   return power_of_2_min_i(GPU_texture_size_with_limit(num, limit_gl_texture_size));
 }
 
+/* Acquire the image buffer to upload. When the texture size is limited, a reduced mip level is
+ * read from the file if it has one, instead of loading the full resolution image only to scale
+ * it down. The full image size is returned in \a r_full_size either way.
+ * Release with #image_gpu_release_ibuf. */
+static ImBuf *image_gpu_acquire_ibuf(Image *ima,
+                                     ImageUser *iuser,
+                                     const bool limit_gl_texture_size,
+                                     int r_full_size[2],
+                                     bool *r_is_mip_level)
+{
+  *r_is_mip_level = false;
+
+  if (limit_gl_texture_size) {
+    const int max_size = GPU_texture_size_with_limit(INT_MAX, true);
+    ImBuf *ibuf = BKE_image_load_gpu_mip_level(ima, iuser, max_size, r_full_size);
+    if (ibuf) {
+      *r_is_mip_level = true;
+      return ibuf;
+    }
+  }
+
+  ImBuf *ibuf = BKE_image_acquire_ibuf(ima, iuser, NULL);
+  if (ibuf) {
+    r_full_size[0] = ibuf->x;
+    r_full_size[1] = ibuf->y;
+  }
+  return ibuf;
+}
+
+static void image_gpu_release_ibuf(Image *ima, ImBuf *ibuf, const bool is_mip_level)
+{
+  if (is_mip_level) {
+    IMB_freeImBuf(ibuf);
+  }
+  else {
+    BKE_image_release_ibuf(ima, ibuf, NULL);
+  }
+}
+
 static GPUTexture *gpu_texture_create_tile_mapping(Image *ima, const int multiview_eye)
 {
   GPUTexture *tilearray = ima->gputexture[TEXTARGET_2D_ARRAY][multiview_eye];
@@ -161,7 +200,10 @@ static GPUTexture *gpu_texture_create_tile_array(Image *ima, ImBuf *main_ibuf)
     ImageUser iuser;
     BKE_imageuser_default(&iuser);
     iuser.tile = tile->tile_number;
-    ImBuf *ibuf = BKE_image_acquire_ibuf(ima, &iuser, NULL);
+    int full_size[2];
+    bool is_mip_level;
+    ImBuf *ibuf = image_gpu_acquire_ibuf(
+        ima, &iuser, limit_gl_texture_size, full_size, &is_mip_level);
 
     if (ibuf) {
       PackTile *packtile = (PackTile *)MEM_callocN(sizeof(PackTile), __func__);
@@ -182,7 +224,7 @@ static GPUTexture *gpu_texture_create_tile_array(Image *ima, ImBuf *main_ibuf)
       float w = packtile->boxpack.w, h = packtile->boxpack.h;
       packtile->pack_score = max_ff(w, h) / min_ff(w, h) * w * h;
 
-      BKE_image_release_ibuf(ima, ibuf, NULL);
+      image_gpu_release_ibuf(ima, ibuf, is_mip_level);
       BLI_addtail(&boxes, packtile);
     }
   }
@@ -231,7 +273,10 @@ static GPUTexture *gpu_texture_create_tile_array(Image *ima, ImBuf *main_ibuf)
     ImageUser iuser;
     BKE_imageuser_default(&iuser);
     iuser.tile = tile->tile_number;
-    ImBuf *ibuf = BKE_image_acquire_ibuf(ima, &iuser, NULL);
+    int full_size[2];
+    bool is_mip_level;
+    ImBuf *ibuf = image_gpu_acquire_ibuf(
+        ima, &iuser, limit_gl_texture_size, full_size, &is_mip_level);
 
     if (ibuf) {
       const bool store_premultiplied = BKE_image_has_gpu_texture_premultiplied_alpha(ima, ibuf);
@@ -242,9 +287,8 @@ static GPUTexture *gpu_texture_create_tile_array(Image *ima, ImBuf *main_ibuf)
                                  UNPACK2(tilesize),
                                  use_high_bitdepth,
                                  store_premultiplied);
+      image_gpu_release_ibuf(ima, ibuf, is_mip_level);
     }
-
-    BKE_image_release_ibuf(ima, ibuf, NULL);
   }
 
   if (GPU_mipmap_enabled()) {
@@ -382,8 +426,17 @@ static GPUTexture *image_get_gpu_texture(Image *ima,
 
   /* check if we have a valid image buffer */
   ImBuf *ibuf_intern = ibuf;
+  int full_size[2] = {0, 0};
+  bool is_mip_level = false;
   if (ibuf_intern == NULL) {
-    ibuf_intern = BKE_image_acquire_ibuf(ima, iuser, NULL);
+    if (textarget == TEXTARGET_2D) {
+      const bool limit_gl_texture_size = (ima->gpuflag & IMA_GPU_MAX_RESOLUTION) == 0;
+      ibuf_intern = image_gpu_acquire_ibuf(
+          ima, iuser, limit_gl_texture_size, full_size, &is_mip_level);
+    }
+    else {
+      ibuf_intern = BKE_image_acquire_ibuf(ima, iuser, NULL);
+    }
     if (ibuf_intern == NULL) {
       *tex = image_gpu_texture_error_create(textarget);
       return *tex;
@@ -422,13 +475,18 @@ static GPUTexture *image_get_gpu_texture(Image *ima,
     }
   }
 
+  if (is_mip_level) {
+    GPU_texture_orig_size_set(*tex, UNPACK2(full_size));
+  }
+  else {
+    GPU_texture_orig_size_set(*tex, ibuf_intern->x, ibuf_intern->y);
+  }
+
   /* if `ibuf` was given, we don't own the `ibuf_intern` */
   if (ibuf == NULL) {
-    BKE_image_release_ibuf(ima, ibuf_intern, NULL);
+    image_gpu_release_ibuf(ima, ibuf_intern, is_mip_level);
   }
 
-  GPU_texture_orig_size_set(*tex, ibuf_intern->x, ibuf_intern->y);
-
   return *tex;
 }
 
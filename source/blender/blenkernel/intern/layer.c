@@ -890,6 +890,23 @@ static void layer_collection_sync(ViewLayer *view_layer,
   BLI_assert(BLI_listbase_count(lb_collections) == BLI_listbase_count(lb_layer_collections));
 }
 
+static bool no_resync = false;
+
+/**
+ * Skip view layer collection tree updates until #BKE_layer_collection_resync_allow is called.
+ * Used when adding many objects at once (e.g. importers), where syncing after every object makes
+ * adding them quadratic. The caller is responsible for calling #BKE_main_collection_sync after.
+ */
+void BKE_layer_collection_resync_forbid(void)
+{
+  no_resync = true;
+}
+
+void BKE_layer_collection_resync_allow(void)
+{
+  no_resync = false;
+}
+
 /**
  * Update view layer collection tree from collections used in the scene.
  * This is used when collections are removed or added, both while editing
@@ -897,6 +914,10 @@ static void layer_collection_sync(ViewLayer *view_layer,
  */
 void BKE_layer_collection_sync(const Scene *scene, ViewLayer *view_layer)
 {
+  if (no_resync) {
+    return;
+  }
+
   if (!scene->master_collection) {
     /* Happens for old files that don't have versioning applied yet. */
     return;
@@ -973,6 +994,10 @@ void BKE_main_collection_sync(const Main *bmain)
 
   /* TODO: optimize for file load so only linked collections get checked? */
 
+  if (no_resync) {
+    return;
+  }
+
   for (const Scene *scene = bmain->scenes.first; scene; scene = scene->id.next) {
     BKE_scene_collection_sync(scene);
   }
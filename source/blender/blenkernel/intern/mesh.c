@@ -125,7 +125,13 @@ static void mesh_copy_data(Main *bmain, ID *id_dst, const ID *id_src, const int
 
   mesh_dst->mat = MEM_dupallocN(mesh_src->mat);
 
-  const eCDAllocType alloc_type = (flag & LIB_ID_COPY_CD_REFERENCE) ? CD_REFERENCE : CD_DUPLICATE;
+  eCDAllocType alloc_type = CD_DUPLICATE;
+  if (flag & LIB_ID_COPY_CD_REFERENCE) {
+    alloc_type = CD_REFERENCE;
+  }
+  else if (flag & LIB_ID_COPY_CD_SHARE) {
+    alloc_type = CD_SHARE;
+  }
   CustomData_copy(&mesh_src->vdata, &mesh_dst->vdata, mask.vmask, alloc_type, mesh_dst->totvert);
   CustomData_copy(&mesh_src->edata, &mesh_dst->edata, mask.emask, alloc_type, mesh_dst->totedge);
   CustomData_copy(&mesh_src->ldata, &mesh_dst->ldata, mask.lmask, alloc_type, mesh_dst->totloop);
@@ -1761,6 +1767,8 @@ void BKE_mesh_vert_coords_apply(Mesh *mesh, const float (*vert_coords)[3])
     copy_v3_v3(mv->co, vert_coords[i]);
   }
   mesh->runtime.cd_dirty_vert |= CD_MASK_NORMAL;
+  mesh->runtime.cd_dirty_poly |= CD_MASK_NORMAL;
+  mesh->runtime.cd_dirty_loop |= CD_MASK_NORMAL;
 }
 
 void BKE_mesh_vert_coords_apply_with_mat4(Mesh *mesh,
@@ -1774,6 +1782,8 @@ void BKE_mesh_vert_coords_apply_with_mat4(Mesh *mesh,
     mul_v3_m4v3(mv->co, mat, vert_coords[i]);
   }
   mesh->runtime.cd_dirty_vert |= CD_MASK_NORMAL;
+  mesh->runtime.cd_dirty_poly |= CD_MASK_NORMAL;
+  mesh->runtime.cd_dirty_loop |= CD_MASK_NORMAL;
 }
 
 void BKE_mesh_vert_normals_apply(Mesh *mesh, const short (*vert_normals)[3])
@@ -1819,14 +1829,16 @@ void BKE_mesh_calc_normals_split_ex(Mesh *mesh, MLoopNorSpaceArray *r_lnors_spac
   /* may be NULL */
   clnors = CustomData_get_layer(&mesh->ldata, CD_CUSTOMLOOPNORMAL);
 
-  if (CustomData_has_layer(&mesh->pdata, CD_NORMAL)) {
-    /* This assume that layer is always up to date, not sure this is the case
-     * (esp. in Edit mode?)... */
-    polynors = CustomData_get_layer(&mesh->pdata, CD_NORMAL);
-    free_polynors = false;
-  }
-  else {
-    polynors = MEM_malloc_arrayN(mesh->totpoly, sizeof(float[3]), __func__);
+  /* Poly normals stored in the mesh are only reused when neither they nor the vertex normals
+   * need to be recomputed. */
+  const bool use_cached_polynors = ((mesh->runtime.cd_dirty_vert | mesh->runtime.cd_dirty_poly) &
+                                    CD_MASK_NORMAL) == 0;
+  polynors = CustomData_get_layer(&mesh->pdata, CD_NORMAL);
+  if (polynors == NULL || !use_cached_polynors) {
+    if (polynors == NULL) {
+      polynors = MEM_malloc_arrayN(mesh->totpoly, sizeof(float[3]), __func__);
+      free_polynors = true;
+    }
     BKE_mesh_calc_normals_poly(mesh->mvert,
                                NULL,
                                mesh->totvert,
@@ -1836,7 +1848,9 @@ void BKE_mesh_calc_normals_split_ex(Mesh *mesh, MLoopNorSpaceArray *r_lnors_spac
                                mesh->totpoly,
                                polynors,
                                false);
-    free_polynors = true;
+    if (!free_polynors) {
+      mesh->runtime.cd_dirty_poly &= ~CD_MASK_NORMAL;
+    }
   }
 
   BKE_mesh_normals_loop_split(mesh->mvert,
@@ -1860,6 +1874,7 @@ void BKE_mesh_calc_normals_split_ex(Mesh *mesh, MLoopNorSpaceArray *r_lnors_spac
   }
 
   mesh->runtime.cd_dirty_vert &= ~CD_MASK_NORMAL;
+  mesh->runtime.cd_dirty_loop &= ~CD_MASK_NORMAL;
 }
 
 void BKE_mesh_calc_normals_split(Mesh *mesh)
@@ -32,6 +32,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.h"
 
 #include "BKE_customdata.h"
 #include "BKE_lib_id.h"
@@ -43,31 +44,66 @@
 
 #include "DEG_depsgraph_query.h"
 
+typedef struct UpdateMeshCoordsTaskData {
+  const MultiresReshapeContext *reshape_context;
+  /* Loop which defines the coordinate of every vertex. */
+  const int *vert_loop_index;
+} UpdateMeshCoordsTaskData;
+
+static void update_mesh_coords_task(void *__restrict userdata_v,
+                                    const int vertex_index,
+                                    const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const UpdateMeshCoordsTaskData *data = userdata_v;
+  const MultiresReshapeContext *reshape_context = data->reshape_context;
+  const int loop_index = data->vert_loop_index[vertex_index];
+  if (loop_index == -1) {
+    return;
+  }
+  MVert *vert = &reshape_context->base_mesh->mvert[vertex_index];
+
+  GridCoord grid_coord;
+  grid_coord.grid_index = loop_index;
+  grid_coord.u = 1.0f;
+  grid_coord.v = 1.0f;
+
+  float P[3];
+  float tangent_matrix[3][3];
+  multires_reshape_evaluate_limit_at_grid(reshape_context, &grid_coord, P, tangent_matrix);
+
+  ReshapeConstGridElement grid_element = multires_reshape_orig_grid_element_for_grid_coord(
+      reshape_context, &grid_coord);
+  float D[3];
+  mul_v3_m3v3(D, tangent_matrix, grid_element.displacement);
+
+  add_v3_v3v3(vert->co, P, D);
+}
+
 void multires_reshape_apply_base_update_mesh_coords(MultiresReshapeContext *reshape_context)
 {
   Mesh *base_mesh = reshape_context->base_mesh;
   const MLoop *mloop = base_mesh->mloop;
-  MVert *mvert = base_mesh->mvert;
-  for (int loop_index = 0; loop_index < base_mesh->totloop; ++loop_index) {
-    const MLoop *loop = &mloop[loop_index];
-    MVert *vert = &mvert[loop->v];
 
-    GridCoord grid_coord;
-    grid_coord.grid_index = loop_index;
-    grid_coord.u = 1.0f;
-    grid_coord.v = 1.0f;
+  /* Every corner of a vertex evaluates to its new coordinate, use the last one for every vertex
+   * so the result is the same as when evaluating all the corners in order. */
+  int *vert_loop_index = MEM_malloc_arrayN(base_mesh->totvert, sizeof(int), __func__);
+  copy_vn_i(vert_loop_index, base_mesh->totvert, -1);
+  for (int loop_index = 0; loop_index < base_mesh->totloop; ++loop_index) {
+    vert_loop_index[mloop[loop_index].v] = loop_index;
+  }
 
-    float P[3];
-    float tangent_matrix[3][3];
-    multires_reshape_evaluate_limit_at_grid(reshape_context, &grid_coord, P, tangent_matrix);
+  UpdateMeshCoordsTaskData data = {
+      .reshape_context = reshape_context,
+      .vert_loop_index = vert_loop_index,
+  };
 
-    ReshapeConstGridElement grid_element = multires_reshape_orig_grid_element_for_grid_coord(
-        reshape_context, &grid_coord);
-    float D[3];
-    mul_v3_m3v3(D, tangent_matrix, grid_element.displacement);
+  TaskParallelSettings parallel_range_settings;
+  BLI_parallel_range_settings_defaults(&parallel_range_settings);
+  parallel_range_settings.min_iter_per_thread = 128;
+  BLI_task_parallel_range(
+      0, base_mesh->totvert, &data, update_mesh_coords_task, &parallel_range_settings);
 
-    add_v3_v3v3(vert->co, P, D);
-  }
+  MEM_freeN(vert_loop_index);
 }
 
 /* Assumes no is normalized; return value's sign is negative if v is on the other side of the
@@ -79,6 +115,86 @@ static float v3_dist_from_plane(const float v[3], const float center[3], const f
   return dot_v3v3(s, no);
 }
 
+typedef struct RefitBaseMeshTaskData {
+  Mesh *base_mesh;
+  const MeshElemMap *pmap;
+  const float (*origco)[3];
+} RefitBaseMeshTaskData;
+
+static void refit_base_mesh_task(void *__restrict userdata_v,
+                                 const int i,
+                                 const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const RefitBaseMeshTaskData *data = userdata_v;
+  Mesh *base_mesh = data->base_mesh;
+  const MeshElemMap *pmap = data->pmap;
+  const float(*origco)[3] = data->origco;
+
+  float avg_no[3] = {0, 0, 0}, center[3] = {0, 0, 0}, push[3];
+
+  /* Don't adjust vertices not used by at least one poly. */
+  if (!pmap[i].count) {
+    return;
+  }
+
+  /* Find center. */
+  int tot = 0;
+  for (int j = 0; j < pmap[i].count; j++) {
+    const MPoly *p = &base_mesh->mpoly[pmap[i].indices[j]];
+
+    /* This double counts, not sure if that's bad or good. */
+    for (int k = 0; k < p->totloop; k++) {
+      const int vndx = base_mesh->mloop[p->loopstart + k].v;
+      if (vndx != i) {
+        add_v3_v3(center, origco[vndx]);
+        tot++;
+      }
+    }
+  }
+  mul_v3_fl(center, 1.0f / tot);
+
+  /* Find normal. */
+  for (int j = 0; j < pmap[i].count; j++) {
+    const MPoly *p = &base_mesh->mpoly[pmap[i].indices[j]];
+    MPoly fake_poly;
+    MLoop *fake_loops;
+    float(*fake_co)[3];
+    float no[3];
+
+    /* Set up poly, loops, and coords in order to call BKE_mesh_calc_poly_normal_coords(). */
+    fake_poly.totloop = p->totloop;
+    fake_poly.loopstart = 0;
+    fake_loops = MEM_malloc_arrayN(p->totloop, sizeof(MLoop), "fake_loops");
+    fake_co = MEM_malloc_arrayN(p->totloop, sizeof(float[3]), "fake_co");
+
+    for (int k = 0; k < p->totloop; k++) {
+      const int vndx = base_mesh->mloop[p->loopstart + k].v;
+
+      fake_loops[k].v = k;
+
+      if (vndx == i) {
+        copy_v3_v3(fake_co[k], center);
+      }
+      else {
+        copy_v3_v3(fake_co[k], origco[vndx]);
+      }
+    }
+
+    BKE_mesh_calc_poly_normal_coords(&fake_poly, fake_loops, (const float(*)[3])fake_co, no);
+    MEM_freeN(fake_loops);
+    MEM_freeN(fake_co);
+
+    add_v3_v3(avg_no, no);
+  }
+  normalize_v3(avg_no);
+
+  /* Push vertex away from the plane. */
+  const float dist = v3_dist_from_plane(base_mesh->mvert[i].co, center, avg_no);
+  copy_v3_v3(push, avg_no);
+  mul_v3_fl(push, dist);
+  add_v3_v3(base_mesh->mvert[i].co, push);
+}
+
 void multires_reshape_apply_base_refit_base_mesh(MultiresReshapeContext *reshape_context)
 {
   Mesh *base_mesh = reshape_context->base_mesh;
@@ -99,71 +215,18 @@ void multires_reshape_apply_base_refit_base_mesh(MultiresReshapeContext *reshape
     copy_v3_v3(origco[i], base_mesh->mvert[i].co);
   }
 
-  for (int i = 0; i < base_mesh->totvert; i++) {
-    float avg_no[3] = {0, 0, 0}, center[3] = {0, 0, 0}, push[3];
-
-    /* Don't adjust vertices not used by at least one poly. */
-    if (!pmap[i].count) {
-      continue;
-    }
-
-    /* Find center. */
-    int tot = 0;
-    for (int j = 0; j < pmap[i].count; j++) {
-      const MPoly *p = &base_mesh->mpoly[pmap[i].indices[j]];
-
-      /* This double counts, not sure if that's bad or good. */
-      for (int k = 0; k < p->totloop; k++) {
-        const int vndx = base_mesh->mloop[p->loopstart + k].v;
-        if (vndx != i) {
-          add_v3_v3(center, origco[vndx]);
-          tot++;
-        }
-      }
-    }
-    mul_v3_fl(center, 1.0f / tot);
-
-    /* Find normal. */
-    for (int j = 0; j < pmap[i].count; j++) {
-      const MPoly *p = &base_mesh->mpoly[pmap[i].indices[j]];
-      MPoly fake_poly;
-      MLoop *fake_loops;
-      float(*fake_co)[3];
-      float no[3];
-
-      /* Set up poly, loops, and coords in order to call BKE_mesh_calc_poly_normal_coords(). */
-      fake_poly.totloop = p->totloop;
-      fake_poly.loopstart = 0;
-      fake_loops = MEM_malloc_arrayN(p->totloop, sizeof(MLoop), "fake_loops");
-      fake_co = MEM_malloc_arrayN(p->totloop, sizeof(float[3]), "fake_co");
-
-      for (int k = 0; k < p->totloop; k++) {
-        const int vndx = base_mesh->mloop[p->loopstart + k].v;
-
-        fake_loops[k].v = k;
-
-        if (vndx == i) {
-          copy_v3_v3(fake_co[k], center);
-        }
-        else {
-          copy_v3_v3(fake_co[k], origco[vndx]);
-        }
-      }
-
-      BKE_mesh_calc_poly_normal_coords(&fake_poly, fake_loops, (const float(*)[3])fake_co, no);
-      MEM_freeN(fake_loops);
-      MEM_freeN(fake_co);
-
-      add_v3_v3(avg_no, no);
-    }
-    normalize_v3(avg_no);
-
-    /* Push vertex away from the plane. */
-    const float dist = v3_dist_from_plane(base_mesh->mvert[i].co, center, avg_no);
-    copy_v3_v3(push, avg_no);
-    mul_v3_fl(push, dist);
-    add_v3_v3(base_mesh->mvert[i].co, push);
-  }
+  /* Every vertex only reads the original coordinates, so they can be refit in parallel. */
+  RefitBaseMeshTaskData data = {
+      .base_mesh = base_mesh,
+      .pmap = pmap,
+      .origco = (const float(*)[3])origco,
+  };
+
+  TaskParallelSettings parallel_range_settings;
+  BLI_parallel_range_settings_defaults(&parallel_range_settings);
+  parallel_range_settings.min_iter_per_thread = 128;
+  BLI_task_parallel_range(
+      0, base_mesh->totvert, &data, refit_base_mesh_task, &parallel_range_settings);
 
   MEM_freeN(origco);
   MEM_freeN(pmap);
@@ -14,6 +14,8 @@
  * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+#include <mutex>
+
 #include "CLG_log.h"
 
 #include "BLI_map.hh"
@@ -29,6 +31,10 @@
 
 static CLG_LogRef LOG = {"bke.node_ui_storage"};
 
+/* Node trees can be evaluated from multiple threads at the same time, and nodes within one
+ * evaluation can be executed in parallel, so changes to the UI storage are serialized. */
+static std::mutex ui_storage_mutex;
+
 using blender::Map;
 using blender::StringRef;
 using blender::Vector;
@@ -72,6 +78,7 @@ const NodeUIStorage *BKE_node_tree_ui_storage_get_from_context(const bContext *C
 void BKE_nodetree_ui_storage_free_for_context(bNodeTree &ntree,
                                               const NodeTreeEvaluationContext &context)
 {
+  std::lock_guard<std::mutex> lock(ui_storage_mutex);
   NodeTreeUIStorage *ui_storage = ntree.ui_storage;
   if (ui_storage != nullptr) {
     ui_storage->context_map.remove(context);
@@ -133,6 +140,7 @@ void BKE_nodetree_error_message_add(bNodeTree &ntree,
 {
   node_error_message_log(ntree, node, message, type);
 
+  std::lock_guard<std::mutex> lock(ui_storage_mutex);
   NodeUIStorage &node_ui_storage = find_node_ui_storage(ntree, context, node);
   node_ui_storage.warnings.append({type, std::move(message)});
 }
@@ -142,6 +150,7 @@ void BKE_nodetree_attribute_hint_add(bNodeTree &ntree,
                                      const bNode &node,
                                      const StringRef attribute_name)
 {
+  std::lock_guard<std::mutex> lock(ui_storage_mutex);
   NodeUIStorage &node_ui_storage = find_node_ui_storage(ntree, context, node);
   node_ui_storage.attribute_name_hints.add_as(attribute_name);
 }
@@ -32,6 +32,7 @@
 #include "DNA_scene_types.h"
 
 #include "BLI_blenlib.h"
+#include "BLI_hash.h"
 #include "BLI_math.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
@@ -343,9 +344,21 @@ void BKE_object_eval_uber_transform(Depsgraph *depsgraph, Object *object)
 void BKE_object_batch_cache_dirty_tag(Object *ob)
 {
   switch (ob->type) {
-    case OB_MESH:
-      BKE_mesh_batch_cache_dirty_tag(ob->data, BKE_MESH_BATCH_DIRTY_ALL);
+    case OB_MESH: {
+      Mesh *me = ob->data;
+      BMEditMesh *em = me->edit_mesh;
+      if (em && em->deform_tag == EM_DEFORM_TAG_RANGE) {
+        BKE_mesh_batch_cache_dirty_tag(me, BKE_MESH_BATCH_DIRTY_DEFORM);
+      }
+      else {
+        BKE_mesh_batch_cache_dirty_tag(me, BKE_MESH_BATCH_DIRTY_ALL);
+      }
+      if (em) {
+        /* Consumed, a later evaluation without a new tag must update everything. */
+        em->deform_tag = EM_DEFORM_TAG_NONE;
+      }
       break;
+    }
     case OB_LATTICE:
       BKE_lattice_batch_cache_dirty_tag(ob->data, BKE_LATTICE_BATCH_DIRTY_ALL);
       break;
@@ -475,6 +488,8 @@ void BKE_object_eval_eval_base_flags(Depsgraph *depsgraph,
   }
   object->base_local_view_bits = base->local_view_bits;
   object->runtime.local_collections_bits = base->local_collections_bits;
+  /* Cached so drawing doesn't hash the name of every object on every redraw. */
+  object->runtime.random_id = BLI_hash_int_2d(BLI_hash_string(object->id.name + 2), 0);
 
   if (object->mode == OB_MODE_PARTICLE_EDIT) {
     for (ParticleSystem *psys = object->particlesystem.first; psys != NULL; psys = psys->next) {
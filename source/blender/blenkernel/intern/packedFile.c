@@ -41,6 +41,8 @@
 #include "DNA_volume_types.h"
 
 #include "BLI_blenlib.h"
+#include "BLI_ghash.h"
+#include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_font.h"
@@ -152,12 +154,69 @@ int BKE_packedfile_count_all(Main *bmain)
   return count;
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Shared Packed Data
+ *
+ * Duplicates of a packed file (ID copies, copy-on-write copies made by the depsgraph and the
+ * temporary font data) share the data buffer of their source instead of copying it. Packed data
+ * is never modified in place, so the buffer is only freed once its last user is gone.
+ *
+ * Only shared buffers are tracked, the stored value is the number of additional users.
+ * \{ */
+
+static ThreadMutex packed_data_mutex = BLI_MUTEX_INITIALIZER;
+static GHash *packed_data_users = NULL;
+
+static void packedfile_data_user_add(void *data)
+{
+  BLI_mutex_lock(&packed_data_mutex);
+  if (packed_data_users == NULL) {
+    packed_data_users = BLI_ghash_ptr_new(__func__);
+  }
+  void **users_p;
+  if (!BLI_ghash_ensure_p(packed_data_users, data, &users_p)) {
+    *users_p = POINTER_FROM_UINT(0);
+  }
+  *users_p = POINTER_FROM_UINT(POINTER_AS_UINT(*users_p) + 1);
+  BLI_mutex_unlock(&packed_data_mutex);
+}
+
+/* Returns true when the caller was the last user of the data and should free it. */
+static bool packedfile_data_user_remove(void *data)
+{
+  bool is_last_user = true;
+
+  BLI_mutex_lock(&packed_data_mutex);
+  void **users_p = packed_data_users ? BLI_ghash_lookup_p(packed_data_users, data) : NULL;
+  if (users_p != NULL) {
+    const uint users = POINTER_AS_UINT(*users_p) - 1;
+    if (users == 0) {
+      BLI_ghash_remove(packed_data_users, data, NULL, NULL);
+      if (BLI_ghash_len(packed_data_users) == 0) {
+        BLI_ghash_free(packed_data_users, NULL, NULL);
+        packed_data_users = NULL;
+      }
+    }
+    else {
+      *users_p = POINTER_FROM_UINT(users);
+    }
+    is_last_user = false;
+  }
+  BLI_mutex_unlock(&packed_data_mutex);
+
+  return is_last_user;
+}
+
+/** \} */
+
 void BKE_packedfile_free(PackedFile *pf)
 {
   if (pf) {
     BLI_assert(pf->data != NULL);
 
-    MEM_SAFE_FREE(pf->data);
+    if (packedfile_data_user_remove(pf->data)) {
+      MEM_freeN(pf->data);
+    }
     MEM_freeN(pf);
   }
   else {
@@ -173,7 +232,7 @@ PackedFile *BKE_packedfile_duplicate(const PackedFile *pf_src)
   PackedFile *pf_dst;
 
   pf_dst = MEM_dupallocN(pf_src);
-  pf_dst->data = MEM_dupallocN(pf_src->data);
+  packedfile_data_user_add(pf_dst->data);
 
   return pf_dst;
 }
@@ -41,6 +41,7 @@
 #include "BLI_hash.h"
 #include "BLI_listbase.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -1419,8 +1420,7 @@ static void sculptsession_free_pbvh(Object *object)
     ss->pbvh = NULL;
   }
 
-  MEM_SAFE_FREE(ss->pmap);
-  MEM_SAFE_FREE(ss->pmap_mem);
+  BKE_sculptsession_free_pmap(ss);
 
   MEM_SAFE_FREE(ss->persistent_base);
 
@@ -1435,6 +1435,14 @@ static void sculptsession_free_pbvh(Object *object)
   MEM_SAFE_FREE(ss->fake_neighbors.fake_neighbor_index);
 }
 
+void BKE_sculptsession_free_pmap(SculptSession *ss)
+{
+  MEM_SAFE_FREE(ss->pmap);
+  MEM_SAFE_FREE(ss->pmap_mem);
+  MEM_SAFE_FREE(ss->vert_adj_offsets);
+  MEM_SAFE_FREE(ss->vert_adj_indices);
+}
+
 void BKE_sculptsession_bm_to_me_for_render(Object *object)
 {
   if (object && object->sculpt) {
@@ -1469,8 +1477,7 @@ void BKE_sculptsession_free(Object *ob)
 
     sculptsession_free_pbvh(ob);
 
-    MEM_SAFE_FREE(ss->pmap);
-    MEM_SAFE_FREE(ss->pmap_mem);
+    BKE_sculptsession_free_pmap(ss);
     if (ss->bm_log) {
       BM_log_free(ss->bm_log);
     }
@@ -1600,6 +1607,107 @@ static bool sculpt_modifiers_active(Scene *scene, Sculpt *sd, Object *ob)
 /**
  * \param need_mask: So that the evaluated mesh that is returned has mask data.
  */
+typedef struct VertexAdjacencyTaskData {
+  const MeshElemMap *pmap;
+  const int *pmap_mem;
+  const MPoly *mpoly;
+  const MLoop *mloop;
+
+  /* Each vertex has room for two neighbors per face in #neighbors, at the same offset as its
+   * faces in #pmap_mem. */
+  int *neighbors;
+  int *neighbors_len;
+
+  const int *offsets;
+  int *indices;
+} VertexAdjacencyTaskData;
+
+static void vertex_adjacency_gather_task_cb(void *__restrict userdata,
+                                            const int v,
+                                            const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  VertexAdjacencyTaskData *data = userdata;
+  const MeshElemMap *vert_map = &data->pmap[v];
+  int *neighbors = &data->neighbors[(vert_map->indices - data->pmap_mem) * 2];
+  int len = 0;
+
+  for (int i = 0; i < vert_map->count; i++) {
+    const MPoly *p = &data->mpoly[vert_map->indices[i]];
+    uint f_adj_v[2];
+    if (poly_get_adj_loops_from_vert(p, data->mloop, v, f_adj_v) == -1) {
+      continue;
+    }
+    for (int j = 0; j < ARRAY_SIZE(f_adj_v); j++) {
+      const int v_other = (int)f_adj_v[j];
+      if (v_other == v) {
+        continue;
+      }
+      bool is_duplicate = false;
+      for (int k = 0; k < len; k++) {
+        if (neighbors[k] == v_other) {
+          is_duplicate = true;
+          break;
+        }
+      }
+      if (!is_duplicate) {
+        neighbors[len++] = v_other;
+      }
+    }
+  }
+
+  data->neighbors_len[v] = len;
+}
+
+static void vertex_adjacency_fill_task_cb(void *__restrict userdata,
+                                          const int v,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  VertexAdjacencyTaskData *data = userdata;
+  const int *neighbors = &data->neighbors[(data->pmap[v].indices - data->pmap_mem) * 2];
+  memcpy(&data->indices[data->offsets[v]], neighbors, sizeof(int) * data->neighbors_len[v]);
+}
+
+/* Build the CSR vertex adjacency from the vertex to face map, so neighbor iteration doesn't
+ * need to search the faces of the vertex every time. */
+static void sculpt_vertex_adjacency_create(SculptSession *ss, const Mesh *me)
+{
+  MEM_SAFE_FREE(ss->vert_adj_offsets);
+  MEM_SAFE_FREE(ss->vert_adj_indices);
+
+  const int totvert = me->totvert;
+  int *offsets = MEM_mallocN(sizeof(int) * (totvert + 1), "sculpt vert adjacency offsets");
+
+  VertexAdjacencyTaskData data = {
+      .pmap = ss->pmap,
+      .pmap_mem = ss->pmap_mem,
+      .mpoly = me->mpoly,
+      .mloop = me->mloop,
+      .neighbors = MEM_mallocN(sizeof(int) * max_ii(me->totloop * 2, 1), __func__),
+      .neighbors_len = MEM_mallocN(sizeof(int) * max_ii(totvert, 1), __func__),
+      .offsets = offsets,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+  BLI_task_parallel_range(0, totvert, &data, vertex_adjacency_gather_task_cb, &settings);
+
+  offsets[0] = 0;
+  for (int v = 0; v < totvert; v++) {
+    offsets[v + 1] = offsets[v] + data.neighbors_len[v];
+  }
+
+  data.indices = MEM_mallocN(sizeof(int) * max_ii(offsets[totvert], 1),
+                             "sculpt vert adjacency indices");
+  BLI_task_parallel_range(0, totvert, &data, vertex_adjacency_fill_task_cb, &settings);
+
+  MEM_freeN(data.neighbors);
+  MEM_freeN(data.neighbors_len);
+
+  ss->vert_adj_offsets = offsets;
+  ss->vert_adj_indices = data.indices;
+}
+
 static void sculpt_update_object(Depsgraph *depsgraph,
                                  Object *ob,
                                  Mesh *me_eval,
@@ -1688,6 +1796,7 @@ static void sculpt_update_object(Depsgraph *depsgraph,
   if (need_pmap && ob->type == OB_MESH && !ss->pmap) {
     BKE_mesh_vert_poly_map_create(
         &ss->pmap, &ss->pmap_mem, me->mpoly, me->mloop, me->totvert, me->totpoly, me->totloop);
+    sculpt_vertex_adjacency_create(ss, me);
   }
 
   pbvh_show_mask_set(ss->pbvh, ss->show_mask);
@@ -1126,7 +1126,7 @@ void psys_free(Object *ob, ParticleSystem *psys)
 
     BLI_freelistN(&psys->targets);
 
-    BLI_bvhtree_free(psys->bvhtree);
+    psys_neighbor_grid_free(psys->neighbor_grid);
     BLI_kdtree_3d_free(psys->tree);
 
     if (psys->fluid_springs) {
@@ -2799,14 +2799,6 @@ static bool psys_thread_context_init_path(ParticleThreadContext *ctx,
   return true;
 }
 
-static void psys_task_init_path(ParticleTask *task, ParticleSimulationData *sim)
-{
-  /* init random number generator */
-  int seed = 31415926 + sim->psys->seed;
-
-  task->rng_path = BLI_rng_new(seed);
-}
-
 /* note: this function must be thread safe, except for branching! */
 static void psys_thread_create_path(ParticleTask *task,
                                     struct ChildParticle *cpa,
@@ -3140,20 +3132,26 @@ static void psys_thread_create_path(ParticleTask *task,
   }
 }
 
-static void exec_child_path_cache(TaskPool *__restrict UNUSED(pool), void *taskdata)
+static void child_path_cache_task_cb(void *__restrict userdata,
+                                     const int i,
+                                     const TaskParallelTLS *__restrict UNUSED(tls))
 {
-  ParticleTask *task = taskdata;
-  ParticleThreadContext *ctx = task->ctx;
-  ParticleSystem *psys = ctx->sim.psys;
-  ParticleCacheKey **cache = psys->childcache;
-  ChildParticle *cpa;
-  int i;
+  /* Paths only read the thread context from the task, so it's shared by all children. */
+  ParticleTask *task = userdata;
+  ParticleSystem *psys = task->ctx->sim.psys;
 
-  cpa = psys->child + task->begin;
-  for (i = task->begin; i < task->end; i++, cpa++) {
-    BLI_assert(i < psys->totchildcache);
-    psys_thread_create_path(task, cpa, cache[i], i);
-  }
+  BLI_assert(i < psys->totchildcache);
+  psys_thread_create_path(task, &psys->child[i], psys->childcache[i], i);
+}
+
+static void child_path_cache_range(ParticleTask *task, const int start, const int end)
+{
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  /* The cost of children varies a lot (clumping, kink, roughness, virtual parents),
+   * use small chunks so threads stay balanced. */
+  settings.min_iter_per_thread = 64;
+  BLI_task_parallel_range(start, end, task, child_path_cache_task_cb, &settings);
 }
 
 void psys_cache_child_paths(ParticleSimulationData *sim,
@@ -3161,11 +3159,9 @@ void psys_cache_child_paths(ParticleSimulationData *sim,
                             const bool editupdate,
                             const bool use_render_params)
 {
-  TaskPool *task_pool;
   ParticleThreadContext ctx;
-  ParticleTask *tasks_parent, *tasks_child;
-  int numtasks_parent, numtasks_child;
-  int i, totchild, totparent;
+  ParticleTask task = {NULL};
+  int totchild, totparent;
 
   if (sim->psys->flag & PSYS_GLOBAL_HAIR) {
     return;
@@ -3176,7 +3172,6 @@ void psys_cache_child_paths(ParticleSimulationData *sim,
     return;
   }
 
-  task_pool = BLI_task_pool_create(&ctx, TASK_PRIORITY_LOW);
   totchild = ctx.totchild;
   totparent = ctx.totparent;
 
@@ -3192,32 +3187,15 @@ void psys_cache_child_paths(ParticleSimulationData *sim,
     sim->psys->totchildcache = totchild;
   }
 
+  task.ctx = &ctx;
+
   /* cache parent paths */
   ctx.parent_pass = 1;
-  psys_tasks_create(&ctx, 0, totparent, &tasks_parent, &numtasks_parent);
-  for (i = 0; i < numtasks_parent; i++) {
-    ParticleTask *task = &tasks_parent[i];
-
-    psys_task_init_path(task, sim);
-    BLI_task_pool_push(task_pool, exec_child_path_cache, task, false, NULL);
-  }
-  BLI_task_pool_work_and_wait(task_pool);
+  child_path_cache_range(&task, 0, totparent);
 
   /* cache child paths */
   ctx.parent_pass = 0;
-  psys_tasks_create(&ctx, totparent, totchild, &tasks_child, &numtasks_child);
-  for (i = 0; i < numtasks_child; i++) {
-    ParticleTask *task = &tasks_child[i];
-
-    psys_task_init_path(task, sim);
-    BLI_task_pool_push(task_pool, exec_child_path_cache, task, false, NULL);
-  }
-  BLI_task_pool_work_and_wait(task_pool);
-
-  BLI_task_pool_free(task_pool);
-
-  psys_tasks_free(tasks_parent, numtasks_parent);
-  psys_tasks_free(tasks_child, numtasks_child);
+  child_path_cache_range(&task, totparent, totchild);
 
   psys_thread_context_free(&ctx);
 }
@@ -5372,7 +5350,7 @@ void BKE_particle_system_blend_read_data(BlendDataReader *reader, ListBase *part
     }
 
     psys->tree = NULL;
-    psys->bvhtree = NULL;
+    psys->neighbor_grid = NULL;
 
     psys->orig_psys = NULL;
     psys->batch_cache = NULL;
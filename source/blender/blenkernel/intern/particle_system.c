@@ -92,7 +92,7 @@
 #  include "manta_fluid_API.h"
 #endif  // WITH_FLUID
 
-static ThreadRWMutex psys_bvhtree_rwlock = BLI_RWLOCK_INITIALIZER;
+static ThreadRWMutex psys_neighbor_grid_rwlock = BLI_RWLOCK_INITIALIZER;
 
 /************************************************/
 /*          Reacting to system events           */
@@ -1323,16 +1323,164 @@ void psys_get_pointcache_start_end(Scene *scene, ParticleSystem *psys, int *sfra
 /************************************************/
 /*          Effectors                           */
 /************************************************/
-static void psys_update_particle_bvhtree(ParticleSystem *psys, float cfra)
+/* Uniform grid used for SPH neighbor queries. Cells are hashed into a fixed number of buckets
+ * and the particles are sorted by bucket, so a range query only visits the cells overlapping
+ * the query sphere and reads their particles from contiguous memory. */
+typedef struct ParticleNeighborGrid {
+  float cell_size_inv;
+  /** Power of two. */
+  int totbucket;
+  /** First point of every bucket, with one extra entry at the end (`totbucket + 1`). */
+  int *bucket_start;
+  /** Points sorted by bucket. */
+  int *index;
+  float (*co)[3];
+  int (*cell)[3];
+} ParticleNeighborGrid;
+
+BLI_INLINE int neighbor_grid_bucket(const ParticleNeighborGrid *grid, const int cell[3])
+{
+  const uint hash = ((uint)cell[0] * 73856093u) ^ ((uint)cell[1] * 19349663u) ^
+                    ((uint)cell[2] * 83492791u);
+  return (int)(hash & (uint)(grid->totbucket - 1));
+}
+
+BLI_INLINE void neighbor_grid_cell(const ParticleNeighborGrid *grid,
+                                   const float co[3],
+                                   int r_cell[3])
+{
+  for (int i = 0; i < 3; i++) {
+    r_cell[i] = (int)floorf(co[i] * grid->cell_size_inv);
+  }
+}
+
+typedef struct NeighborGridBuildData {
+  const ParticleNeighborGrid *grid;
+  const float (*co)[3];
+  int (*cell)[3];
+  int *bucket;
+} NeighborGridBuildData;
+
+static void neighbor_grid_build_cell_cb(void *__restrict userdata,
+                                        const int i,
+                                        const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  NeighborGridBuildData *data = userdata;
+
+  neighbor_grid_cell(data->grid, data->co[i], data->cell[i]);
+  data->bucket[i] = neighbor_grid_bucket(data->grid, data->cell[i]);
+}
+
+static ParticleNeighborGrid *neighbor_grid_new(const float (*co)[3],
+                                               const int *index,
+                                               int totpoint,
+                                               float cell_size)
+{
+  ParticleNeighborGrid *grid = MEM_callocN(sizeof(*grid), __func__);
+  int(*cell)[3] = MEM_malloc_arrayN(totpoint, sizeof(*cell), __func__);
+  int *bucket = MEM_malloc_arrayN(totpoint, sizeof(*bucket), __func__);
+
+  grid->cell_size_inv = 1.0f / max_ff(cell_size, 1e-4f);
+  grid->totbucket = power_of_2_max_i(max_ii(totpoint, 1));
+  grid->bucket_start = MEM_callocN(sizeof(int) * (size_t)(grid->totbucket + 1), __func__);
+  grid->index = MEM_malloc_arrayN(totpoint, sizeof(*grid->index), __func__);
+  grid->co = MEM_malloc_arrayN(totpoint, sizeof(*grid->co), __func__);
+  grid->cell = MEM_malloc_arrayN(totpoint, sizeof(*grid->cell), __func__);
+
+  NeighborGridBuildData data = {
+      .grid = grid,
+      .co = co,
+      .cell = cell,
+      .bucket = bucket,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (totpoint > 1000);
+  BLI_task_parallel_range(0, totpoint, &data, neighbor_grid_build_cell_cb, &settings);
+
+  /* Counting sort of the points by bucket. */
+  for (int i = 0; i < totpoint; i++) {
+    grid->bucket_start[bucket[i] + 1]++;
+  }
+  for (int b = 0; b < grid->totbucket; b++) {
+    grid->bucket_start[b + 1] += grid->bucket_start[b];
+  }
+
+  int *bucket_fill = MEM_dupallocN(grid->bucket_start);
+  for (int i = 0; i < totpoint; i++) {
+    const int j = bucket_fill[bucket[i]]++;
+    grid->index[j] = index[i];
+    copy_v3_v3(grid->co[j], co[i]);
+    copy_v3_v3_int(grid->cell[j], cell[i]);
+  }
+
+  MEM_freeN(bucket_fill);
+  MEM_freeN(bucket);
+  MEM_freeN(cell);
+
+  return grid;
+}
+
+void psys_neighbor_grid_free(ParticleNeighborGrid *grid)
+{
+  if (grid) {
+    MEM_freeN(grid->bucket_start);
+    MEM_freeN(grid->index);
+    MEM_freeN(grid->co);
+    MEM_freeN(grid->cell);
+    MEM_freeN(grid);
+  }
+}
+
+/* Same semantics as #BLI_bvhtree_range_query, the callback gets the query location. */
+static void neighbor_grid_range_query(const ParticleNeighborGrid *grid,
+                                      const float co[3],
+                                      float radius,
+                                      BVHTree_RangeQuery callback,
+                                      void *userdata)
+{
+  const float radius_sq = radius * radius;
+  const float radius_v3[3] = {radius, radius, radius};
+  float co_min[3], co_max[3];
+  int cell_min[3], cell_max[3], cell[3];
+
+  sub_v3_v3v3(co_min, co, radius_v3);
+  add_v3_v3v3(co_max, co, radius_v3);
+  neighbor_grid_cell(grid, co_min, cell_min);
+  neighbor_grid_cell(grid, co_max, cell_max);
+
+  for (cell[0] = cell_min[0]; cell[0] <= cell_max[0]; cell[0]++) {
+    for (cell[1] = cell_min[1]; cell[1] <= cell_max[1]; cell[1]++) {
+      for (cell[2] = cell_min[2]; cell[2] <= cell_max[2]; cell[2]++) {
+        const int bucket = neighbor_grid_bucket(grid, cell);
+        const int end = grid->bucket_start[bucket + 1];
+
+        for (int i = grid->bucket_start[bucket]; i < end; i++) {
+          /* Other cells can share the bucket, skip them so no point is visited twice. */
+          if (!equals_v3v3_int(grid->cell[i], cell)) {
+            continue;
+          }
+          const float dist_sq = len_squared_v3v3(co, grid->co[i]);
+          if (dist_sq < radius_sq) {
+            callback(userdata, grid->index[i], co, dist_sq);
+          }
+        }
+      }
+    }
+  }
+}
+
+static void psys_update_particle_neighbor_grid(ParticleSystem *psys, float cfra)
 {
   if (psys) {
     PARTICLE_P;
     int totpart = 0;
     bool need_rebuild;
 
-    BLI_rw_mutex_lock(&psys_bvhtree_rwlock, THREAD_LOCK_READ);
-    need_rebuild = !psys->bvhtree || psys->bvhtree_frame != cfra;
-    BLI_rw_mutex_unlock(&psys_bvhtree_rwlock);
+    BLI_rw_mutex_lock(&psys_neighbor_grid_rwlock, THREAD_LOCK_READ);
+    need_rebuild = !psys->neighbor_grid || psys->neighbor_grid_frame != cfra;
+    BLI_rw_mutex_unlock(&psys_neighbor_grid_rwlock);
 
     if (need_rebuild) {
       LOOP_SHOWN_PARTICLES
@@ -1340,27 +1488,39 @@ static void psys_update_particle_bvhtree(ParticleSystem *psys, float cfra)
         totpart++;
       }
 
-      BLI_rw_mutex_lock(&psys_bvhtree_rwlock, THREAD_LOCK_WRITE);
-
-      BLI_bvhtree_free(psys->bvhtree);
-      psys->bvhtree = BLI_bvhtree_new(totpart, 0.0, 4, 6);
+      float(*co)[3] = MEM_malloc_arrayN(max_ii(totpart, 1), sizeof(*co), __func__);
+      int *index = MEM_malloc_arrayN(max_ii(totpart, 1), sizeof(*index), __func__);
+      int totpoint = 0;
 
       LOOP_SHOWN_PARTICLES
       {
         if (pa->alive == PARS_ALIVE) {
-          if (pa->state.time == cfra) {
-            BLI_bvhtree_insert(psys->bvhtree, p, pa->prev_state.co, 1);
-          }
-          else {
-            BLI_bvhtree_insert(psys->bvhtree, p, pa->state.co, 1);
-          }
+          copy_v3_v3(co[totpoint], (pa->state.time == cfra) ? pa->prev_state.co : pa->state.co);
+          index[totpoint] = p;
+          totpoint++;
         }
       }
-      BLI_bvhtree_balance(psys->bvhtree);
 
-      psys->bvhtree_frame = cfra;
+      /* Cells match the interaction radius, so a query touches at most 27 cells. */
+      const SPHFluidSettings *fluid = psys->part->fluid;
+      float cell_size = 1.0f;
+      if (fluid) {
+        cell_size = fluid->radius *
+                    ((fluid->flag & SPH_FAC_RADIUS) ? 4.0f * psys->part->size : 1.0f);
+      }
+
+      ParticleNeighborGrid *grid = neighbor_grid_new(co, index, totpoint, cell_size);
+
+      MEM_freeN(co);
+      MEM_freeN(index);
+
+      BLI_rw_mutex_lock(&psys_neighbor_grid_rwlock, THREAD_LOCK_WRITE);
 
-      BLI_rw_mutex_unlock(&psys_bvhtree_rwlock);
+      psys_neighbor_grid_free(psys->neighbor_grid);
+      psys->neighbor_grid = grid;
+      psys->neighbor_grid_frame = cfra;
+
+      BLI_rw_mutex_unlock(&psys_neighbor_grid_rwlock);
     }
   }
 }
@@ -1714,11 +1874,13 @@ static void sph_evaluate_func(BVHTree *tree,
       break;
     }
 
-    BLI_rw_mutex_lock(&psys_bvhtree_rwlock, THREAD_LOCK_READ);
+    BLI_rw_mutex_lock(&psys_neighbor_grid_rwlock, THREAD_LOCK_READ);
 
-    BLI_bvhtree_range_query(psys[i]->bvhtree, co, interaction_radius, callback, pfr);
+    if (psys[i]->neighbor_grid) {
+      neighbor_grid_range_query(psys[i]->neighbor_grid, co, interaction_radius, callback, pfr);
+    }
 
-    BLI_rw_mutex_unlock(&psys_bvhtree_rwlock);
+    BLI_rw_mutex_unlock(&psys_neighbor_grid_rwlock);
   }
 }
 static void sph_density_accum_cb(void *userdata, int index, const float co[3], float squared_dist)
@@ -3886,12 +4048,13 @@ static void dynamics_step(ParticleSimulationData *sim, float cfra)
     }
     case PART_PHYS_FLUID: {
       ParticleTarget *pt = psys->targets.first;
-      psys_update_particle_bvhtree(psys, cfra);
+      psys_update_particle_neighbor_grid(psys, cfra);
 
       for (; pt;
            pt = pt->next) { /* Updating others systems particle tree for fluid-fluid interaction */
         if (pt->ob) {
-          psys_update_particle_bvhtree(BLI_findlink(&pt->ob->particlesystem, pt->psys - 1), cfra);
+          psys_update_particle_neighbor_grid(
+              BLI_findlink(&pt->ob->particlesystem, pt->psys - 1), cfra);
         }
       }
       break;
@@ -252,16 +252,19 @@ void pbvh_grow_nodes(PBVH *pbvh, int totnode)
 
 /* Add a vertex to the map, with a positive value for unique vertices and
  * a negative value for additional vertices */
-static int map_insert_vert(
-    PBVH *pbvh, GHash *map, unsigned int *face_verts, unsigned int *uniq_verts, int vertex)
+static int map_insert_vert(PBVH *pbvh,
+                           GHash *map,
+                           unsigned int *face_verts,
+                           unsigned int *uniq_verts,
+                           int vertex,
+                           int leaf_order)
 {
   void *key, **value_p;
 
   key = POINTER_FROM_INT(vertex);
   if (!BLI_ghash_ensure_p(map, key, &value_p)) {
     int value_i;
-    if (BLI_BITMAP_TEST(pbvh->vert_bitmap, vertex) == 0) {
-      BLI_BITMAP_ENABLE(pbvh->vert_bitmap, vertex);
+    if (pbvh->vert_leaf_owner[vertex] == leaf_order) {
       value_i = *uniq_verts;
       (*uniq_verts)++;
     }
@@ -277,7 +280,7 @@ static int map_insert_vert(
 }
 
 /* Find vertices used by the faces in this node and update the draw buffers */
-static void build_mesh_leaf_node(PBVH *pbvh, PBVHNode *node)
+static void build_mesh_leaf_node(PBVH *pbvh, PBVHNode *node, int leaf_order)
 {
   bool has_visible = false;
 
@@ -298,8 +301,12 @@ static void build_mesh_leaf_node(PBVH *pbvh, PBVHNode *node)
   for (int i = 0; i < totface; i++) {
     const MLoopTri *lt = &pbvh->looptri[node->prim_indices[i]];
     for (int j = 0; j < 3; j++) {
-      face_vert_indices[i][j] = map_insert_vert(
-          pbvh, map, &node->face_verts, &node->uniq_verts, pbvh->mloop[lt->tri[j]].v);
+      face_vert_indices[i][j] = map_insert_vert(pbvh,
+                                                map,
+                                                &node->face_verts,
+                                                &node->uniq_verts,
+                                                pbvh->mloop[lt->tri[j]].v,
+                                                leaf_order);
     }
 
     if (has_visible == false) {
@@ -413,6 +420,7 @@ static void build_grid_leaf_node(PBVH *pbvh, PBVHNode *node)
   BKE_pbvh_node_mark_rebuild_draw(node);
 }
 
+/* The leaf data that depends on the vertices is built afterwards, see #pbvh_build_leaves. */
 static void build_leaf(PBVH *pbvh, int node_index, BBC *prim_bbc, int offset, int count)
 {
   pbvh->nodes[node_index].flag |= PBVH_Leaf;
@@ -422,15 +430,110 @@ static void build_leaf(PBVH *pbvh, int node_index, BBC *prim_bbc, int offset, in
 
   /* Still need vb for searches */
   update_vb(pbvh, &pbvh->nodes[node_index], prim_bbc, offset, count);
+}
+
+/* Leaf node indices in the order in which the recursive build creates the leaves. */
+static int *pbvh_leaves_in_build_order(PBVH *pbvh, int *r_totleaf)
+{
+  int *leaves = MEM_mallocN(sizeof(int) * pbvh->totnode, __func__);
+  int *stack = MEM_mallocN(sizeof(int) * pbvh->totnode, __func__);
+  int stack_len = 0;
+  int totleaf = 0;
+
+  stack[stack_len++] = 0;
+  while (stack_len > 0) {
+    const int node_index = stack[--stack_len];
+    const PBVHNode *node = &pbvh->nodes[node_index];
+    if (node->flag & PBVH_Leaf) {
+      leaves[totleaf++] = node_index;
+    }
+    else {
+      stack[stack_len++] = node->children_offset + 1;
+      stack[stack_len++] = node->children_offset;
+    }
+  }
+
+  MEM_freeN(stack);
+  *r_totleaf = totleaf;
+  return leaves;
+}
+
+typedef struct PBVHBuildLeavesData {
+  PBVH *pbvh;
+  const int *leaves;
+} PBVHBuildLeavesData;
+
+static void pbvh_leaf_claim_verts_task_cb(void *__restrict userdata,
+                                          const int leaf_order,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  PBVHBuildLeavesData *data = userdata;
+  PBVH *pbvh = data->pbvh;
+  const PBVHNode *node = &pbvh->nodes[data->leaves[leaf_order]];
+
+  for (int i = 0; i < node->totprim; i++) {
+    const MLoopTri *lt = &pbvh->looptri[node->prim_indices[i]];
+    for (int j = 0; j < 3; j++) {
+      int *owner = &pbvh->vert_leaf_owner[pbvh->mloop[lt->tri[j]].v];
+      /* Atomic minimum, the first leaf in build order owns the vertex. */
+      int old_owner = *owner;
+      while (leaf_order < old_owner) {
+        const int prev_owner = atomic_cas_int32(owner, old_owner, leaf_order);
+        if (prev_owner == old_owner) {
+          break;
+        }
+        old_owner = prev_owner;
+      }
+    }
+  }
+}
+
+static void pbvh_build_leaf_task_cb(void *__restrict userdata,
+                                    const int leaf_order,
+                                    const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  PBVHBuildLeavesData *data = userdata;
+  PBVH *pbvh = data->pbvh;
+  PBVHNode *node = &pbvh->nodes[data->leaves[leaf_order]];
 
   if (pbvh->looptri) {
-    build_mesh_leaf_node(pbvh, pbvh->nodes + node_index);
+    build_mesh_leaf_node(pbvh, node, leaf_order);
   }
   else {
-    build_grid_leaf_node(pbvh, pbvh->nodes + node_index);
+    build_grid_leaf_node(pbvh, node);
   }
 }
 
+/**
+ * Build the vertex data of all leaves in parallel. A vertex that is used by multiple leaves is
+ * a unique vertex of the first of those leaves in build order, so the result is the same as
+ * when building the leaves one after another.
+ */
+static void pbvh_build_leaves(PBVH *pbvh)
+{
+  int totleaf;
+  int *leaves = pbvh_leaves_in_build_order(pbvh, &totleaf);
+
+  PBVHBuildLeavesData data = {
+      .pbvh = pbvh,
+      .leaves = leaves,
+  };
+
+  TaskParallelSettings settings;
+  BKE_pbvh_parallel_range_settings(&settings, true, totleaf);
+
+  if (pbvh->looptri) {
+    pbvh->vert_leaf_owner = MEM_mallocN(sizeof(int) * pbvh->totvert, __func__);
+    copy_vn_i(pbvh->vert_leaf_owner, pbvh->totvert, INT_MAX);
+    BLI_task_parallel_range(0, totleaf, &data, pbvh_leaf_claim_verts_task_cb, &settings);
+  }
+
+  BLI_task_parallel_range(0, totleaf, &data, pbvh_build_leaf_task_cb, &settings);
+
+  MEM_SAFE_FREE(pbvh->vert_leaf_owner);
+  MEM_freeN(leaves);
+}
+
 /* Return zero if all primitives in the node can be drawn with the
  * same material (including flat/smooth shading), non-zero otherwise */
 static bool leaf_needs_material_split(PBVH *pbvh, int offset, int count)
@@ -554,6 +657,71 @@ static void pbvh_build(PBVH *pbvh, BB *cb, BBC *prim_bbc, int totprim)
 
   pbvh->totnode = 1;
   build_sub(pbvh, 0, cb, prim_bbc, 0, totprim);
+  pbvh_build_leaves(pbvh);
+}
+
+typedef struct PBVHPrimBBCData {
+  PBVH *pbvh;
+  BBC *prim_bbc;
+} PBVHPrimBBCData;
+
+static void pbvh_mesh_prim_bbc_task_cb(void *__restrict userdata,
+                                       const int i,
+                                       const TaskParallelTLS *__restrict tls)
+{
+  PBVHPrimBBCData *data = userdata;
+  const PBVH *pbvh = data->pbvh;
+  const MLoopTri *lt = &pbvh->looptri[i];
+  const int sides = 3;
+  BBC *bbc = data->prim_bbc + i;
+
+  BB_reset((BB *)bbc);
+
+  for (int j = 0; j < sides; j++) {
+    BB_expand((BB *)bbc, pbvh->verts[pbvh->mloop[lt->tri[j]].v].co);
+  }
+
+  BBC_update_centroid(bbc);
+
+  BB_expand(tls->userdata_chunk, bbc->bcentroid);
+}
+
+static void pbvh_grid_prim_bbc_task_cb(void *__restrict userdata,
+                                       const int i,
+                                       const TaskParallelTLS *__restrict tls)
+{
+  PBVHPrimBBCData *data = userdata;
+  const PBVH *pbvh = data->pbvh;
+  const CCGKey *key = &pbvh->gridkey;
+  CCGElem *grid = pbvh->grids[i];
+  BBC *bbc = data->prim_bbc + i;
+
+  BB_reset((BB *)bbc);
+
+  for (int j = 0; j < key->grid_area; j++) {
+    BB_expand((BB *)bbc, CCG_elem_offset_co(key, grid, j));
+  }
+
+  BBC_update_centroid(bbc);
+
+  BB_expand(tls->userdata_chunk, bbc->bcentroid);
+}
+
+static void pbvh_prim_bbc_reduce(const void *__restrict UNUSED(userdata),
+                                 void *__restrict chunk_join,
+                                 void *__restrict chunk)
+{
+  BB_expand_with_bb(chunk_join, chunk);
+}
+
+/* The bounding box around all centroids is accumulated per thread in cb. */
+static void pbvh_prim_bbc_parallel_range_settings(TaskParallelSettings *settings, BB *cb)
+{
+  BLI_parallel_range_settings_defaults(settings);
+  settings->min_iter_per_thread = 1024;
+  settings->userdata_chunk = cb;
+  settings->userdata_chunk_size = sizeof(*cb);
+  settings->func_reduce = pbvh_prim_bbc_reduce;
 }
 
 /**
@@ -583,7 +751,6 @@ void BKE_pbvh_build_mesh(PBVH *pbvh,
   pbvh->mloop = mloop;
   pbvh->looptri = looptri;
   pbvh->verts = verts;
-  pbvh->vert_bitmap = BLI_BITMAP_NEW(totvert, "bvh->vert_bitmap");
   pbvh->totvert = totvert;
   pbvh->leaf_limit = LEAF_LIMIT;
   pbvh->vdata = vdata;
@@ -598,28 +765,19 @@ void BKE_pbvh_build_mesh(PBVH *pbvh,
   /* For each face, store the AABB and the AABB centroid */
   prim_bbc = MEM_mallocN(sizeof(BBC) * looptri_num, "prim_bbc");
 
-  for (int i = 0; i < looptri_num; i++) {
-    const MLoopTri *lt = &looptri[i];
-    const int sides = 3;
-    BBC *bbc = prim_bbc + i;
-
-    BB_reset((BB *)bbc);
-
-    for (int j = 0; j < sides; j++) {
-      BB_expand((BB *)bbc, verts[pbvh->mloop[lt->tri[j]].v].co);
-    }
-
-    BBC_update_centroid(bbc);
-
-    BB_expand(&cb, bbc->bcentroid);
-  }
+  PBVHPrimBBCData data = {
+      .pbvh = pbvh,
+      .prim_bbc = prim_bbc,
+  };
+  TaskParallelSettings settings;
+  pbvh_prim_bbc_parallel_range_settings(&settings, &cb);
+  BLI_task_parallel_range(0, looptri_num, &data, pbvh_mesh_prim_bbc_task_cb, &settings);
 
   if (looptri_num) {
     pbvh_build(pbvh, &cb, prim_bbc, looptri_num);
   }
 
   MEM_freeN(prim_bbc);
-  MEM_freeN(pbvh->vert_bitmap);
 }
 
 /* Do a full rebuild with on Grids data structure */
@@ -648,20 +806,13 @@ void BKE_pbvh_build_grids(PBVH *pbvh,
   /* For each grid, store the AABB and the AABB centroid */
   BBC *prim_bbc = MEM_mallocN(sizeof(BBC) * totgrid, "prim_bbc");
 
-  for (int i = 0; i < totgrid; i++) {
-    CCGElem *grid = grids[i];
-    BBC *bbc = prim_bbc + i;
-
-    BB_reset((BB *)bbc);
-
-    for (int j = 0; j < gridsize * gridsize; j++) {
-      BB_expand((BB *)bbc, CCG_elem_offset_co(key, grid, j));
-    }
-
-    BBC_update_centroid(bbc);
-
-    BB_expand(&cb, bbc->bcentroid);
-  }
+  PBVHPrimBBCData data = {
+      .pbvh = pbvh,
+      .prim_bbc = prim_bbc,
+  };
+  TaskParallelSettings settings;
+  pbvh_prim_bbc_parallel_range_settings(&settings, &cb);
+  BLI_task_parallel_range(0, totgrid, &data, pbvh_grid_prim_bbc_task_cb, &settings);
 
   if (totgrid) {
     pbvh_build(pbvh, &cb, prim_bbc, totgrid);
@@ -1296,7 +1447,10 @@ static void pbvh_update_draw_buffer_cb(void *__restrict userdata,
   }
 
   if (node->flag & PBVH_UpdateDrawBuffers) {
-    const int update_flags = pbvh_get_buffers_update_flags(pbvh);
+    int update_flags = pbvh_get_buffers_update_flags(pbvh);
+    if (node->flag & (PBVH_RebuildDrawBuffers | PBVH_UpdateDrawCoords)) {
+      update_flags |= GPU_PBVH_BUFFERS_UPDATE_COORDS;
+    }
     switch (pbvh->type) {
       case PBVH_GRIDS:
         GPU_pbvh_grid_buffers_update(node->draw_buffers,
@@ -1374,7 +1528,7 @@ static void pbvh_update_draw_buffers(PBVH *pbvh, PBVHNode **nodes, int totnode,
       GPU_pbvh_buffers_update_flush(node->draw_buffers);
     }
 
-    node->flag &= ~(PBVH_RebuildDrawBuffers | PBVH_UpdateDrawBuffers);
+    node->flag &= ~(PBVH_RebuildDrawBuffers | PBVH_UpdateDrawBuffers | PBVH_UpdateDrawCoords);
   }
 }
 
@@ -1735,7 +1889,7 @@ BMesh *BKE_pbvh_get_bmesh(PBVH *pbvh)
 void BKE_pbvh_node_mark_update(PBVHNode *node)
 {
   node->flag |= PBVH_UpdateNormals | PBVH_UpdateBB | PBVH_UpdateOriginalBB |
-                PBVH_UpdateDrawBuffers | PBVH_UpdateRedraw;
+                PBVH_UpdateDrawBuffers | PBVH_UpdateDrawCoords | PBVH_UpdateRedraw;
 }
 
 void BKE_pbvh_node_mark_update_mask(PBVHNode *node)
@@ -1751,17 +1905,18 @@ void BKE_pbvh_node_mark_update_color(PBVHNode *node)
 void BKE_pbvh_node_mark_update_visibility(PBVHNode *node)
 {
   node->flag |= PBVH_UpdateVisibility | PBVH_RebuildDrawBuffers | PBVH_UpdateDrawBuffers |
-                PBVH_UpdateRedraw;
+                PBVH_UpdateDrawCoords | PBVH_UpdateRedraw;
 }
 
 void BKE_pbvh_node_mark_rebuild_draw(PBVHNode *node)
 {
-  node->flag |= PBVH_RebuildDrawBuffers | PBVH_UpdateDrawBuffers | PBVH_UpdateRedraw;
+  node->flag |= PBVH_RebuildDrawBuffers | PBVH_UpdateDrawBuffers | PBVH_UpdateDrawCoords |
+                PBVH_UpdateRedraw;
 }
 
 void BKE_pbvh_node_mark_redraw(PBVHNode *node)
 {
-  node->flag |= PBVH_UpdateDrawBuffers | PBVH_UpdateRedraw;
+  node->flag |= PBVH_UpdateDrawBuffers | PBVH_UpdateDrawCoords | PBVH_UpdateRedraw;
 }
 
 void BKE_pbvh_node_mark_normals_update(PBVHNode *node)
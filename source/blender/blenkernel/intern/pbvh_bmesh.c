@@ -25,6 +25,7 @@
 #include "BLI_heap_simple.h"
 #include "BLI_math.h"
 #include "BLI_memarena.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_DerivedMesh.h"
@@ -753,8 +754,16 @@ typedef struct {
   int cd_vert_mask_offset;
   int cd_vert_node_offset;
   int cd_face_node_offset;
+  /* When set, edges are appended here instead of being inserted into the queue,
+   * used while gathering edges from multiple nodes in parallel. */
+  BLI_Buffer *candidates;
 } EdgeQueueContext;
 
+typedef struct EdgeQueueCandidate {
+  BMEdge *e;
+  float priority;
+} EdgeQueueCandidate;
+
 /* only tag'd edges are in the queue */
 #ifdef USE_EDGEQUEUE_TAG
 #  define EDGE_QUEUE_TEST(e) (BM_elem_flag_test((CHECK_TYPE_INLINE(e, BMEdge *), e), BM_ELEM_TAG))
@@ -845,6 +854,11 @@ static void edge_queue_insert(EdgeQueueContext *eq_ctx, BMEdge *e, float priorit
        (check_mask(eq_ctx, e->v1) || check_mask(eq_ctx, e->v2))) &&
       !(BM_elem_flag_test_bool(e->v1, BM_ELEM_HIDDEN) ||
         BM_elem_flag_test_bool(e->v2, BM_ELEM_HIDDEN))) {
+    if (eq_ctx->candidates) {
+      EdgeQueueCandidate candidate = {e, priority};
+      BLI_buffer_append(eq_ctx->candidates, EdgeQueueCandidate, candidate);
+      return;
+    }
     BMVert **pair = BLI_mempool_alloc(eq_ctx->pool);
     pair[0] = e->v1;
     pair[1] = e->v2;
@@ -990,6 +1004,93 @@ static void short_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
   }
 }
 
+typedef struct EdgeQueueNodesData {
+  const EdgeQueueContext *eq_ctx;
+  PBVH *pbvh;
+  const int *node_indices;
+  BLI_Buffer *candidates;
+  void (*face_add)(EdgeQueueContext *eq_ctx, BMFace *f);
+} EdgeQueueNodesData;
+
+static void edge_queue_add_nodes_task_cb(void *__restrict userdata,
+                                         const int i,
+                                         const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  EdgeQueueNodesData *data = userdata;
+  PBVHNode *node = &data->pbvh->nodes[data->node_indices[i]];
+  EdgeQueueContext eq_ctx = *data->eq_ctx;
+  eq_ctx.candidates = &data->candidates[i];
+
+  GSetIterator gs_iter;
+
+  /* Check each face */
+  GSET_ITER (gs_iter, node->bm_faces) {
+    BMFace *f = BLI_gsetIterator_getKey(&gs_iter);
+
+    data->face_add(&eq_ctx, f);
+  }
+}
+
+/* Gather the edges of all leaf nodes marked for topology update.
+ *
+ * Finding the edges only reads the mesh so it's done for every node in parallel, the edges
+ * are then inserted into the queue in node order, giving the same queue as a serial pass. */
+static void edge_queue_add_nodes(EdgeQueueContext *eq_ctx,
+                                 PBVH *pbvh,
+                                 void (*face_add)(EdgeQueueContext *eq_ctx, BMFace *f))
+{
+  int *node_indices = MEM_malloc_arrayN(pbvh->totnode, sizeof(int), __func__);
+  int totnode = 0;
+
+  for (int n = 0; n < pbvh->totnode; n++) {
+    PBVHNode *node = &pbvh->nodes[n];
+
+    /* Check leaf nodes marked for topology update */
+    if ((node->flag & PBVH_Leaf) && (node->flag & PBVH_UpdateTopology) &&
+        !(node->flag & PBVH_FullyHidden)) {
+      node_indices[totnode++] = n;
+    }
+  }
+
+  BLI_Buffer *candidates = MEM_malloc_arrayN(totnode, sizeof(*candidates), __func__);
+  for (int i = 0; i < totnode; i++) {
+    BLI_buffer_field_init(&candidates[i], EdgeQueueCandidate);
+  }
+
+  EdgeQueueNodesData data = {
+      .eq_ctx = eq_ctx,
+      .pbvh = pbvh,
+      .node_indices = node_indices,
+      .candidates = candidates,
+      .face_add = face_add,
+  };
+  TaskParallelSettings settings;
+  BKE_pbvh_parallel_range_settings(&settings, true, totnode);
+  BLI_task_parallel_range(0, totnode, &data, edge_queue_add_nodes_task_cb, &settings);
+
+  for (int i = 0; i < totnode; i++) {
+    for (int j = 0; j < candidates[i].count; j++) {
+      const EdgeQueueCandidate *candidate = &BLI_buffer_at(&candidates[i], EdgeQueueCandidate, j);
+      BMEdge *e = candidate->e;
+#ifdef USE_EDGEQUEUE_TAG
+      /* The same edge can be found from multiple faces and nodes. */
+      if (EDGE_QUEUE_TEST(e)) {
+        continue;
+      }
+      EDGE_QUEUE_ENABLE(e);
+#endif
+      BMVert **pair = BLI_mempool_alloc(eq_ctx->pool);
+      pair[0] = e->v1;
+      pair[1] = e->v2;
+      BLI_heapsimple_insert(eq_ctx->q->heap, candidate->priority, pair);
+    }
+    BLI_buffer_field_free(&candidates[i]);
+  }
+
+  MEM_freeN(candidates);
+  MEM_freeN(node_indices);
+}
+
 /* Create a priority queue containing vertex pairs connected by a long
  * edge as defined by PBVH.bm_max_edge_len.
  *
@@ -1035,22 +1136,7 @@ static void long_edge_queue_create(EdgeQueueContext *eq_ctx,
   pbvh_bmesh_edge_tag_verify(pbvh);
 #endif
 
-  for (int n = 0; n < pbvh->totnode; n++) {
-    PBVHNode *node = &pbvh->nodes[n];
-
-    /* Check leaf nodes marked for topology update */
-    if ((node->flag & PBVH_Leaf) && (node->flag & PBVH_UpdateTopology) &&
-        !(node->flag & PBVH_FullyHidden)) {
-      GSetIterator gs_iter;
-
-      /* Check each face */
-      GSET_ITER (gs_iter, node->bm_faces) {
-        BMFace *f = BLI_gsetIterator_getKey(&gs_iter);
-
-        long_edge_queue_face_add(eq_ctx, f);
-      }
-    }
-  }
+  edge_queue_add_nodes(eq_ctx, pbvh, long_edge_queue_face_add);
 }
 
 /* Create a priority queue containing vertex pairs connected by a
@@ -1094,22 +1180,7 @@ static void short_edge_queue_create(EdgeQueueContext *eq_ctx,
     eq_ctx->q->edge_queue_tri_in_range = edge_queue_tri_in_sphere;
   }
 
-  for (int n = 0; n < pbvh->totnode; n++) {
-    PBVHNode *node = &pbvh->nodes[n];
-
-    /* Check leaf nodes marked for topology update */
-    if ((node->flag & PBVH_Leaf) && (node->flag & PBVH_UpdateTopology) &&
-        !(node->flag & PBVH_FullyHidden)) {
-      GSetIterator gs_iter;
-
-      /* Check each face */
-      GSET_ITER (gs_iter, node->bm_faces) {
-        BMFace *f = BLI_gsetIterator_getKey(&gs_iter);
-
-        short_edge_queue_face_add(eq_ctx, f);
-      }
-    }
-  }
+  edge_queue_add_nodes(eq_ctx, pbvh, short_edge_queue_face_add);
 }
 
 /*************************** Topology update **************************/
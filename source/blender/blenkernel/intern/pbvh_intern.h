@@ -151,8 +151,10 @@ struct PBVH {
   BLI_bitmap **grid_hidden;
 
   /* Only used during BVH build and update,
-   * don't need to remain valid after */
-  BLI_bitmap *vert_bitmap;
+   * don't need to remain valid after.
+   * For every vertex the build order of the first leaf that uses it,
+   * that leaf has it as a unique vertex. */
+  int *vert_leaf_owner;
 
 #ifdef PERFCNTRS
   int perf_modified;
@@ -1641,32 +1641,6 @@ static int ptcache_file_write(PTCacheFile *pf, const void *f, unsigned int tot,
 {
   return (fwrite(f, size, tot, pf->fp) == tot);
 }
-static int ptcache_file_data_read(PTCacheFile *pf)
-{
-  int i;
-
-  for (i = 0; i < BPHYS_TOT_DATA; i++) {
-    if ((pf->data_types & (1 << i)) &&
-        !ptcache_file_read(pf, pf->cur[i], 1, ptcache_data_size[i])) {
-      return 0;
-    }
-  }
-
-  return 1;
-}
-static int ptcache_file_data_write(PTCacheFile *pf)
-{
-  int i;
-
-  for (i = 0; i < BPHYS_TOT_DATA; i++) {
-    if ((pf->data_types & (1 << i)) &&
-        !ptcache_file_write(pf, pf->cur[i], 1, ptcache_data_size[i])) {
-      return 0;
-    }
-  }
-
-  return 1;
-}
 static int ptcache_file_header_begin_read(PTCacheFile *pf)
 {
   unsigned int typeflag = 0;
@@ -1833,16 +1807,50 @@ static void ptcache_data_free(PTCacheMem *pm)
     }
   }
 }
-static void ptcache_data_copy(void *from[], void *to[])
+/* Size of all data of a single point, as stored interleaved in uncompressed cache files. */
+static unsigned int ptcache_data_point_size(int data_types)
 {
-  int i;
-  for (i = 0; i < BPHYS_TOT_DATA; i++) {
-    /* note, durian file 03.4b_comp crashes if to[i] is not tested
-     * its NULL, not sure if this should be fixed elsewhere but for now its needed */
-    if (from[i] && to[i]) {
-      memcpy(to[i], from[i], ptcache_data_size[i]);
+  unsigned int point_size = 0;
+  for (int i = 0; i < BPHYS_TOT_DATA; i++) {
+    if (data_types & (1 << i)) {
+      point_size += ptcache_data_size[i];
     }
   }
+  return point_size;
+}
+
+/* Split points stored interleaved in \a buffer into the data arrays of \a pm. */
+static void ptcache_data_deinterleave(PTCacheMem *pm, const char *buffer, unsigned int point_size)
+{
+  const char *src = buffer;
+  for (int i = 0; i < BPHYS_TOT_DATA; i++) {
+    if ((pm->data_types & (1 << i)) == 0) {
+      continue;
+    }
+    const unsigned int size = ptcache_data_size[i];
+    char *dst = pm->data[i];
+    for (unsigned int p = 0; p < pm->totpoint; p++) {
+      memcpy(dst + (size_t)p * size, src + (size_t)p * point_size, size);
+    }
+    src += size;
+  }
+}
+
+/* Inverse of #ptcache_data_deinterleave. */
+static void ptcache_data_interleave(const PTCacheMem *pm, char *buffer, unsigned int point_size)
+{
+  char *dst = buffer;
+  for (int i = 0; i < BPHYS_TOT_DATA; i++) {
+    if ((pm->data_types & (1 << i)) == 0) {
+      continue;
+    }
+    const unsigned int size = ptcache_data_size[i];
+    const char *src = pm->data[i];
+    for (unsigned int p = 0; p < pm->totpoint; p++) {
+      memcpy(dst + (size_t)p * point_size, src + (size_t)p * size, size);
+    }
+    dst += size;
+  }
 }
 
 static void ptcache_extra_free(PTCacheMem *pm)
@@ -1974,19 +1982,17 @@ static PTCacheMem *ptcache_disk_frame_to_mem(PTCacheID *pid, int cfra)
         }
       }
     }
-    else {
-      void *cur[BPHYS_TOT_DATA];
-      BKE_ptcache_mem_pointers_init(pm, cur);
-      ptcache_file_pointers_init(pf);
-
-      for (i = 0; i < pm->totpoint; i++) {
-        if (!ptcache_file_data_read(pf)) {
-          error = 1;
-          break;
-        }
-        ptcache_data_copy(pf->cur, cur);
-        BKE_ptcache_mem_pointers_incr(cur);
+    else if (pm->totpoint > 0) {
+      /* Read all interleaved points at once instead of every element separately. */
+      const unsigned int point_size = ptcache_data_point_size(pm->data_types);
+      char *buffer = MEM_malloc_arrayN(pm->totpoint, point_size, "PTCache read buffer");
+      if (ptcache_file_read(pf, buffer, pm->totpoint, point_size)) {
+        ptcache_data_deinterleave(pm, buffer, point_size);
+      }
+      else {
+        error = 1;
       }
+      MEM_freeN(buffer);
     }
   }
 
@@ -2076,19 +2082,15 @@ static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
         }
       }
     }
-    else {
-      void *cur[BPHYS_TOT_DATA];
-      BKE_ptcache_mem_pointers_init(pm, cur);
-      ptcache_file_pointers_init(pf);
-
-      for (i = 0; i < pm->totpoint; i++) {
-        ptcache_data_copy(cur, pf->cur);
-        if (!ptcache_file_data_write(pf)) {
-          error = 1;
-          break;
-        }
-        BKE_ptcache_mem_pointers_incr(cur);
+    else if (pm->totpoint > 0) {
+      /* Write all points at once, the file layout stays interleaved per point. */
+      const unsigned int point_size = ptcache_data_point_size(pm->data_types);
+      char *buffer = MEM_malloc_arrayN(pm->totpoint, point_size, "PTCache write buffer");
+      ptcache_data_interleave(pm, buffer, point_size);
+      if (!ptcache_file_write(pf, buffer, pm->totpoint, point_size)) {
+        error = 1;
       }
+      MEM_freeN(buffer);
     }
   }
 
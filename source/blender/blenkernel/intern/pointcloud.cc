@@ -32,6 +32,7 @@
 #include "BLI_utildefines.h"
 
 #include "BKE_anim_data.h"
+#include "BKE_bvhutils.h"
 #include "BKE_customdata.h"
 #include "BKE_geometry_set.hh"
 #include "BKE_global.h"
@@ -90,6 +91,7 @@ static void pointcloud_copy_data(Main *UNUSED(bmain), ID *id_dst, const ID *id_s
   BKE_pointcloud_update_customdata_pointers(pointcloud_dst);
 
   pointcloud_dst->batch_cache = nullptr;
+  memset(&pointcloud_dst->runtime, 0, sizeof(pointcloud_dst->runtime));
 }
 
 static void pointcloud_free_data(ID *id)
@@ -97,6 +99,7 @@ static void pointcloud_free_data(ID *id)
   PointCloud *pointcloud = (PointCloud *)id;
   BKE_animdata_free(&pointcloud->id, false);
   BKE_pointcloud_batch_cache_free(pointcloud);
+  BKE_pointcloud_runtime_clear_cache(pointcloud);
   CustomData_free(&pointcloud->pdata, pointcloud->totpoint);
   MEM_SAFE_FREE(pointcloud->mat);
 }
@@ -149,6 +152,8 @@ static void pointcloud_blend_read_data(BlendDataReader *reader, ID *id)
 
   /* Materials */
   BLO_read_pointer_array(reader, (void **)&pointcloud->mat);
+
+  memset(&pointcloud->runtime, 0, sizeof(pointcloud->runtime));
 }
 
 static void pointcloud_blend_read_lib(BlendLibReader *reader, ID *id)
@@ -313,6 +318,15 @@ bool BKE_pointcloud_customdata_required(PointCloud *UNUSED(pointcloud), CustomDa
   return layer->type == CD_PROP_FLOAT3 && STREQ(layer->name, POINTCLOUD_ATTR_POSITION);
 }
 
+/* Free caches derived from the point positions, called when they may be changed. */
+void BKE_pointcloud_runtime_clear_cache(PointCloud *pointcloud)
+{
+  if (pointcloud->runtime.bvh_cache) {
+    bvhcache_free(pointcloud->runtime.bvh_cache);
+    pointcloud->runtime.bvh_cache = nullptr;
+  }
+}
+
 /* Dependency Graph */
 
 PointCloud *BKE_pointcloud_new_for_eval(const PointCloud *pointcloud_src, int totpoint)
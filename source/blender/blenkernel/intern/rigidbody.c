@@ -1659,17 +1659,34 @@ static void rigidbody_update_sim_world(Scene *scene, RigidBodyWorld *rbw)
   rigidbody_update_ob_array(rbw);
 }
 
-static void rigidbody_update_sim_ob(
-    Depsgraph *depsgraph, Scene *scene, RigidBodyWorld *rbw, Object *ob, RigidBodyOb *rbo)
+/**
+ * Effectors acting on the bodies of a world. Bodies that are effectors themselves don't get
+ * forces applied, so the list is the same for all bodies and only created once per update.
+ */
+typedef struct RigidBodyEffectors {
+  ListBase *effectors;
+  bool is_created;
+} RigidBodyEffectors;
+
+static void rigidbody_update_sim_ob(Depsgraph *depsgraph,
+                                    Scene *scene,
+                                    RigidBodyWorld *rbw,
+                                    ViewLayer *view_layer,
+                                    RigidBodyEffectors *rb_effectors,
+                                    Object *ob,
+                                    RigidBodyOb *rbo)
 {
   /* only update if rigid body exists */
   if (rbo->shared->physics_object == NULL) {
     return;
   }
 
-  ViewLayer *view_layer = DEG_get_input_view_layer(depsgraph);
-  Base *base = BKE_view_layer_base_find(view_layer, ob);
-  const bool is_selected = base ? (base->flag & BASE_SELECTED) != 0 : false;
+  /* Selection only matters while transforming, avoid the base lookup otherwise. */
+  bool is_selected = false;
+  if (G.moving & G_TRANSFORM_OBJ) {
+    Base *base = BKE_view_layer_base_find(view_layer, ob);
+    is_selected = base ? (base->flag & BASE_SELECTED) != 0 : false;
+  }
 
   if (rbo->shape == RB_SHAPE_TRIMESH && rbo->flag & RBO_FLAG_USE_DEFORM) {
     Mesh *mesh = ob->runtime.mesh_deform_eval;
@@ -1717,10 +1734,14 @@ static void rigidbody_update_sim_ob(
            ((ob->pd == NULL) || (ob->pd->forcefield == PFIELD_NULL))) {
     EffectorWeights *effector_weights = rbw->effector_weights;
     EffectedPoint epoint;
-    ListBase *effectors;
 
     /* get effectors present in the group specified by effector_weights */
-    effectors = BKE_effectors_create(depsgraph, ob, NULL, effector_weights, false);
+    if (!rb_effectors->is_created) {
+      rb_effectors->effectors = BKE_effectors_create(
+          depsgraph, ob, NULL, effector_weights, false);
+      rb_effectors->is_created = true;
+    }
+    ListBase *effectors = rb_effectors->effectors;
     if (effectors) {
       float eff_force[3] = {0.0f, 0.0f, 0.0f};
       float eff_loc[3], eff_vel[3];
@@ -1753,9 +1774,6 @@ static void rigidbody_update_sim_ob(
     else if (G.f & G_DEBUG) {
       printf("\tno forces to apply to '%s'\n", ob->id.name + 2);
     }
-
-    /* cleanup */
-    BKE_effectors_free(effectors);
   }
   /* NOTE: passive objects don't need to be updated since they don't move */
 
@@ -1803,6 +1821,9 @@ static void rigidbody_update_simulation(Depsgraph *depsgraph,
     FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
   }
 
+  ViewLayer *view_layer = DEG_get_input_view_layer(depsgraph);
+  RigidBodyEffectors rb_effectors = {NULL, false};
+
   /* update objects */
   FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
     if (ob->type == OB_MESH) {
@@ -1852,11 +1873,13 @@ static void rigidbody_update_simulation(Depsgraph *depsgraph,
       rbo->flag &= ~(RBO_FLAG_NEEDS_VALIDATE | RBO_FLAG_NEEDS_RESHAPE);
 
       /* update simulation object... */
-      rigidbody_update_sim_ob(depsgraph, scene, rbw, ob, rbo);
+      rigidbody_update_sim_ob(depsgraph, scene, rbw, view_layer, &rb_effectors, ob, rbo);
     }
   }
   FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
 
+  BKE_effectors_free(rb_effectors.effectors);
+
   /* update constraints */
   if (rbw->constraints == NULL) { /* no constraints, move on */
     return;
@@ -1994,6 +2017,11 @@ static void rigidbody_free_substep_data(ListBase *substep_targets)
 }
 static void rigidbody_update_simulation_post_step(Depsgraph *depsgraph, RigidBodyWorld *rbw)
 {
+  /* Only transformed objects need their state reset. */
+  if (!(G.moving & G_TRANSFORM_OBJ)) {
+    return;
+  }
+
   ViewLayer *view_layer = DEG_get_input_view_layer(depsgraph);
 
   FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
@@ -59,7 +59,7 @@
 #include "BLI_ghash.h"
 #include "BLI_listbase.h"
 #include "BLI_math.h"
-#include "BLI_threads.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_collection.h"
@@ -72,7 +72,6 @@
 #include "BKE_mesh.h"
 #include "BKE_modifier.h"
 #include "BKE_pointcache.h"
-#include "BKE_scene.h"
 #include "BKE_softbody.h"
 
 #include "DEG_depsgraph.h"
@@ -135,10 +134,14 @@ typedef struct SB_thread_context {
   int do_deflector;
   float fieldfactor;
   float windfactor;
-  int nr;
-  int tot;
 } SB_thread_context;
 
+/* Points and springs are split in chunks of this size to be processed in parallel.
+ * Small enough to balance threads, since collisions make some points much more expensive. */
+#define SB_THREAD_CHUNK_SIZE 64
+/* Avoid pointless threading overhead for few points or springs. */
+#define SB_THREAD_MIN_ELEMENTS 200
+
 #define MID_PRESERVE 1
 
 #define SOFTGOALSNAP 0.999f
@@ -1516,12 +1519,15 @@ static void _scan_for_ext_spring_forces(
   }
 }
 
-static void *exec_scan_for_ext_spring_forces(void *data)
+static void scan_for_ext_spring_forces_task_cb(void *__restrict userdata,
+                                               const int chunk,
+                                               const TaskParallelTLS *__restrict UNUSED(tls))
 {
-  SB_thread_context *pctx = (SB_thread_context *)data;
+  const SB_thread_context *pctx = userdata;
+  const int ifirst = pctx->ifirst + chunk * SB_THREAD_CHUNK_SIZE;
+  const int ilast = min_ii(ifirst + SB_THREAD_CHUNK_SIZE, pctx->ilast);
   _scan_for_ext_spring_forces(
-      pctx->scene, pctx->ob, pctx->timenow, pctx->ifirst, pctx->ilast, pctx->effectors);
-  return NULL;
+      pctx->scene, pctx->ob, pctx->timenow, ifirst, ilast, pctx->effectors);
 }
 
 static void sb_sfesf_threads_run(struct Depsgraph *depsgraph,
@@ -1531,62 +1537,31 @@ static void sb_sfesf_threads_run(struct Depsgraph *depsgraph,
                                  int totsprings,
                                  int *UNUSED(ptr_to_break_func(void)))
 {
-  ListBase threads;
-  SB_thread_context *sb_threads;
-  int i, totthread, left, dec;
-
-  /* wild guess .. may increase with better thread management 'above'
-   * or even be UI option sb->spawn_cf_threads_nopts */
-  int lowsprings = 100;
-
   ListBase *effectors = BKE_effectors_create(
       depsgraph, ob, NULL, ob->soft->effector_weights, false);
 
-  /* figure the number of threads while preventing pretty pointless threading overhead */
-  totthread = BKE_scene_num_threads(scene);
-  /* what if we got zillions of CPUs running but less to spread*/
-  while ((totsprings / totthread < lowsprings) && (totthread > 1)) {
-    totthread--;
-  }
-
-  sb_threads = MEM_callocN(sizeof(SB_thread_context) * totthread, "SBSpringsThread");
-  memset(sb_threads, 0, sizeof(SB_thread_context) * totthread);
-  left = totsprings;
-  dec = totsprings / totthread + 1;
-  for (i = 0; i < totthread; i++) {
-    sb_threads[i].scene = scene;
-    sb_threads[i].ob = ob;
-    sb_threads[i].forcetime = 0.0; /* not used here */
-    sb_threads[i].timenow = timenow;
-    sb_threads[i].ilast = left;
-    left = left - dec;
-    if (left > 0) {
-      sb_threads[i].ifirst = left;
-    }
-    else {
-      sb_threads[i].ifirst = 0;
-    }
-    sb_threads[i].effectors = effectors;
-    sb_threads[i].do_deflector = false; /* not used here */
-    sb_threads[i].fieldfactor = 0.0f;   /* not used here */
-    sb_threads[i].windfactor = 0.0f;    /* not used here */
-    sb_threads[i].nr = i;
-    sb_threads[i].tot = totthread;
-  }
-  if (totthread > 1) {
-    BLI_threadpool_init(&threads, exec_scan_for_ext_spring_forces, totthread);
-
-    for (i = 0; i < totthread; i++) {
-      BLI_threadpool_insert(&threads, &sb_threads[i]);
-    }
-
-    BLI_threadpool_end(&threads);
-  }
-  else {
-    exec_scan_for_ext_spring_forces(&sb_threads[0]);
-  }
-  /* clean up */
-  MEM_freeN(sb_threads);
+  SB_thread_context sb_thread = {
+      .scene = scene,
+      .ob = ob,
+      .forcetime = 0.0f, /* not used here */
+      .timenow = timenow,
+      .ifirst = 0,
+      .ilast = totsprings,
+      .effectors = effectors,
+      .do_deflector = false, /* not used here */
+      .fieldfactor = 0.0f,   /* not used here */
+      .windfactor = 0.0f,    /* not used here */
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (totsprings >= SB_THREAD_MIN_ELEMENTS);
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0,
+                          (totsprings + SB_THREAD_CHUNK_SIZE - 1) / SB_THREAD_CHUNK_SIZE,
+                          &sb_thread,
+                          scan_for_ext_spring_forces_task_cb,
+                          &settings);
 
   BKE_effectors_free(effectors);
 }
@@ -2183,21 +2158,24 @@ static int _softbody_calc_forces_slice_in_a_thread(Scene *scene,
   return 0; /*done fine*/
 }
 
-static void *exec_softbody_calc_forces(void *data)
+static void softbody_calc_forces_task_cb(void *__restrict userdata,
+                                         const int chunk,
+                                         const TaskParallelTLS *__restrict UNUSED(tls))
 {
-  SB_thread_context *pctx = (SB_thread_context *)data;
+  const SB_thread_context *pctx = userdata;
+  const int ifirst = pctx->ifirst + chunk * SB_THREAD_CHUNK_SIZE;
+  const int ilast = min_ii(ifirst + SB_THREAD_CHUNK_SIZE, pctx->ilast);
   _softbody_calc_forces_slice_in_a_thread(pctx->scene,
                                           pctx->ob,
                                           pctx->forcetime,
                                           pctx->timenow,
-                                          pctx->ifirst,
-                                          pctx->ilast,
+                                          ifirst,
+                                          ilast,
                                           NULL,
                                           pctx->effectors,
                                           pctx->do_deflector,
                                           pctx->fieldfactor,
                                           pctx->windfactor);
-  return NULL;
 }
 
 static void sb_cf_threads_run(Scene *scene,
@@ -2211,62 +2189,29 @@ static void sb_cf_threads_run(Scene *scene,
                               float fieldfactor,
                               float windfactor)
 {
-  ListBase threads;
-  SB_thread_context *sb_threads;
-  int i, totthread, left, dec;
-
-  /* wild guess .. may increase with better thread management 'above'
-   * or even be UI option sb->spawn_cf_threads_nopts. */
-  int lowpoints = 100;
-
-  /* figure the number of threads while preventing pretty pointless threading overhead */
-  totthread = BKE_scene_num_threads(scene);
-  /* what if we got zillions of CPUs running but less to spread*/
-  while ((totpoint / totthread < lowpoints) && (totthread > 1)) {
-    totthread--;
-  }
-
-  /* printf("sb_cf_threads_run spawning %d threads\n", totthread); */
-
-  sb_threads = MEM_callocN(sizeof(SB_thread_context) * totthread, "SBThread");
-  memset(sb_threads, 0, sizeof(SB_thread_context) * totthread);
-  left = totpoint;
-  dec = totpoint / totthread + 1;
-  for (i = 0; i < totthread; i++) {
-    sb_threads[i].scene = scene;
-    sb_threads[i].ob = ob;
-    sb_threads[i].forcetime = forcetime;
-    sb_threads[i].timenow = timenow;
-    sb_threads[i].ilast = left;
-    left = left - dec;
-    if (left > 0) {
-      sb_threads[i].ifirst = left;
-    }
-    else {
-      sb_threads[i].ifirst = 0;
-    }
-    sb_threads[i].effectors = effectors;
-    sb_threads[i].do_deflector = do_deflector;
-    sb_threads[i].fieldfactor = fieldfactor;
-    sb_threads[i].windfactor = windfactor;
-    sb_threads[i].nr = i;
-    sb_threads[i].tot = totthread;
-  }
-
-  if (totthread > 1) {
-    BLI_threadpool_init(&threads, exec_softbody_calc_forces, totthread);
-
-    for (i = 0; i < totthread; i++) {
-      BLI_threadpool_insert(&threads, &sb_threads[i]);
-    }
-
-    BLI_threadpool_end(&threads);
-  }
-  else {
-    exec_softbody_calc_forces(&sb_threads[0]);
-  }
-  /* clean up */
-  MEM_freeN(sb_threads);
+  SB_thread_context sb_thread = {
+      .scene = scene,
+      .ob = ob,
+      .forcetime = forcetime,
+      .timenow = timenow,
+      .ifirst = 0,
+      .ilast = totpoint,
+      .effectors = effectors,
+      .do_deflector = do_deflector,
+      .fieldfactor = fieldfactor,
+      .windfactor = windfactor,
+  };
+
+  /* Uses the task scheduler instead of spawning threads for every force evaluation. */
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (totpoint >= SB_THREAD_MIN_ELEMENTS);
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0,
+                          (totpoint + SB_THREAD_CHUNK_SIZE - 1) / SB_THREAD_CHUNK_SIZE,
+                          &sb_thread,
+                          softbody_calc_forces_task_cb,
+                          &settings);
 }
 
 static void softbody_calc_forces(
@@ -2328,149 +2273,209 @@ static void softbody_calc_forces(
   BKE_effectors_free(effectors);
 }
 
-static void softbody_apply_forces(Object *ob, float forcetime, int mode, float *err, int mid_flags)
-{
-  /* time evolution */
-  /* actually does an explicit euler step mode == 0 */
-  /* or heun ~ 2nd order runge-kutta steps, mode 1, 2 */
-  SoftBody *sb = ob->soft; /* is supposed to be there */
-  BodyPoint *bp;
-  float dx[3] = {0}, dv[3], aabbmin[3], aabbmax[3], cm[3] = {0.0f, 0.0f, 0.0f};
-  float timeovermass /*, freezeloc=0.00001f, freezeforce=0.00000000001f*/;
-  float maxerrpos = 0.0f, maxerrvel = 0.0f;
-  int a, fuzzy = 0;
-
-  forcetime *= sb_time_scale(ob);
+/* Statistics gathered while integrating, reduced over all points. */
+typedef struct SB_ApplyForcesStats {
+  float aabbmin[3], aabbmax[3];
+  float maxerrpos, maxerrvel;
+  int fuzzy;
+} SB_ApplyForcesStats;
 
-  aabbmin[0] = aabbmin[1] = aabbmin[2] = 1e20f;
-  aabbmax[0] = aabbmax[1] = aabbmax[2] = -1e20f;
+typedef struct SB_ApplyForcesData {
+  Object *ob;
+  float forcetime;
+  int mode;
+  int mid_flags;
+} SB_ApplyForcesData;
+
+static void softbody_apply_forces_task_cb(void *__restrict userdata,
+                                          const int a,
+                                          const TaskParallelTLS *__restrict tls)
+{
+  const SB_ApplyForcesData *data = userdata;
+  SB_ApplyForcesStats *stats = tls->userdata_chunk;
+  Object *ob = data->ob;
+  BodyPoint *bp = &ob->soft->bpoint[a];
+  const float forcetime = data->forcetime;
+  const int mode = data->mode;
+  const int mid_flags = data->mid_flags;
+  float dx[3] = {0}, dv[3];
+  float timeovermass /*, freezeloc=0.00001f, freezeforce=0.00000000001f*/;
 
-  /* old one with homogeneous masses  */
+  /* Now we have individual masses. */
   /* claim a minimum mass for vertex */
-#if 0
-  if (sb->nodemass > 0.009999f) {
-    timeovermass = forcetime / sb->nodemass;
+  if (_final_mass(ob, bp) > 0.009999f) {
+    timeovermass = forcetime / _final_mass(ob, bp);
   }
   else {
     timeovermass = forcetime / 0.009999f;
   }
-#endif
 
-  for (a = sb->totpoint, bp = sb->bpoint; a > 0; a--, bp++) {
-    /* Now we have individual masses. */
-    /* claim a minimum mass for vertex */
-    if (_final_mass(ob, bp) > 0.009999f) {
-      timeovermass = forcetime / _final_mass(ob, bp);
+  if (_final_goal(ob, bp) < SOFTGOALSNAP) {
+    /* this makes t~ = t */
+    if (mid_flags & MID_PRESERVE) {
+      copy_v3_v3(dx, bp->vec);
+    }
+
+    /**
+     * So here is:
+     * <pre>
+     * (v)' = a(cceleration) =
+     *     sum(F_springs)/m + gravitation + some friction forces + more forces.
+     * </pre>
+     *
+     * The ( ... )' operator denotes derivate respective time.
+     *
+     * The euler step for velocity then becomes:
+     * <pre>
+     * v(t + dt) = v(t) + a(t) * dt
+     * </pre>
+     */
+    mul_v3_fl(bp->force, timeovermass); /* individual mass of node here */
+    /* some nasty if's to have heun in here too */
+    copy_v3_v3(dv, bp->force);
+
+    if (mode == 1) {
+      copy_v3_v3(bp->prevvec, bp->vec);
+      copy_v3_v3(bp->prevdv, dv);
+    }
+
+    if (mode == 2) {
+      /* be optimistic and execute step */
+      bp->vec[0] = bp->prevvec[0] + 0.5f * (dv[0] + bp->prevdv[0]);
+      bp->vec[1] = bp->prevvec[1] + 0.5f * (dv[1] + bp->prevdv[1]);
+      bp->vec[2] = bp->prevvec[2] + 0.5f * (dv[2] + bp->prevdv[2]);
+      /* compare euler to heun to estimate error for step sizing */
+      stats->maxerrvel = max_ff(stats->maxerrvel, fabsf(dv[0] - bp->prevdv[0]));
+      stats->maxerrvel = max_ff(stats->maxerrvel, fabsf(dv[1] - bp->prevdv[1]));
+      stats->maxerrvel = max_ff(stats->maxerrvel, fabsf(dv[2] - bp->prevdv[2]));
     }
     else {
-      timeovermass = forcetime / 0.009999f;
+      add_v3_v3(bp->vec, bp->force);
     }
 
-    if (_final_goal(ob, bp) < SOFTGOALSNAP) {
-      /* this makes t~ = t */
-      if (mid_flags & MID_PRESERVE) {
-        copy_v3_v3(dx, bp->vec);
-      }
+    /* this makes t~ = t+dt */
+    if (!(mid_flags & MID_PRESERVE)) {
+      copy_v3_v3(dx, bp->vec);
+    }
 
-      /**
-       * So here is:
-       * <pre>
-       * (v)' = a(cceleration) =
-       *     sum(F_springs)/m + gravitation + some friction forces + more forces.
-       * </pre>
-       *
-       * The ( ... )' operator denotes derivate respective time.
-       *
-       * The euler step for velocity then becomes:
-       * <pre>
-       * v(t + dt) = v(t) + a(t) * dt
-       * </pre>
-       */
-      mul_v3_fl(bp->force, timeovermass); /* individual mass of node here */
-      /* some nasty if's to have heun in here too */
-      copy_v3_v3(dv, bp->force);
-
-      if (mode == 1) {
-        copy_v3_v3(bp->prevvec, bp->vec);
-        copy_v3_v3(bp->prevdv, dv);
-      }
+    /* so here is (x)'= v(elocity) */
+    /* the euler step for location then becomes */
+    /* x(t + dt) = x(t) + v(t~) * dt */
+    mul_v3_fl(dx, forcetime);
 
-      if (mode == 2) {
-        /* be optimistic and execute step */
-        bp->vec[0] = bp->prevvec[0] + 0.5f * (dv[0] + bp->prevdv[0]);
-        bp->vec[1] = bp->prevvec[1] + 0.5f * (dv[1] + bp->prevdv[1]);
-        bp->vec[2] = bp->prevvec[2] + 0.5f * (dv[2] + bp->prevdv[2]);
-        /* compare euler to heun to estimate error for step sizing */
-        maxerrvel = max_ff(maxerrvel, fabsf(dv[0] - bp->prevdv[0]));
-        maxerrvel = max_ff(maxerrvel, fabsf(dv[1] - bp->prevdv[1]));
-        maxerrvel = max_ff(maxerrvel, fabsf(dv[2] - bp->prevdv[2]));
+    /* the freezer coming sooner or later */
+#if 0
+    if ((dot_v3v3(dx, dx) < freezeloc) && (dot_v3v3(bp->force, bp->force) < freezeforce)) {
+      bp->frozen /= 2;
+    }
+    else {
+      bp->frozen = min_ff(bp->frozen * 1.05f, 1.0f);
+    }
+    mul_v3_fl(dx, bp->frozen);
+#endif
+    /* again some nasty if's to have heun in here too */
+    if (mode == 1) {
+      copy_v3_v3(bp->prevpos, bp->pos);
+      copy_v3_v3(bp->prevdx, dx);
+    }
+
+    if (mode == 2) {
+      bp->pos[0] = bp->prevpos[0] + 0.5f * (dx[0] + bp->prevdx[0]);
+      bp->pos[1] = bp->prevpos[1] + 0.5f * (dx[1] + bp->prevdx[1]);
+      bp->pos[2] = bp->prevpos[2] + 0.5f * (dx[2] + bp->prevdx[2]);
+      stats->maxerrpos = max_ff(stats->maxerrpos, fabsf(dx[0] - bp->prevdx[0]));
+      stats->maxerrpos = max_ff(stats->maxerrpos, fabsf(dx[1] - bp->prevdx[1]));
+      stats->maxerrpos = max_ff(stats->maxerrpos, fabsf(dx[2] - bp->prevdx[2]));
+
+      /* bp->choke is set when we need to pull a vertex or edge out of the collider.
+       * the collider object signals to get out by pushing hard. on the other hand
+       * we don't want to end up in deep space so we add some <viscosity>
+       * to balance that out */
+      if (bp->choke2 > 0.0f) {
+        mul_v3_fl(bp->vec, (1.0f - bp->choke2));
       }
-      else {
-        add_v3_v3(bp->vec, bp->force);
+      if (bp->choke > 0.0f) {
+        mul_v3_fl(bp->vec, (1.0f - bp->choke));
       }
+    }
+    else {
+      add_v3_v3(bp->pos, dx);
+    }
+  } /*snap*/
+  /* so while we are looping BPs anyway do statistics on the fly */
+  minmax_v3v3_v3(stats->aabbmin, stats->aabbmax, bp->pos);
+  if (bp->loc_flag & SBF_DOFUZZY) {
+    stats->fuzzy = 1;
+  }
+}
 
-      /* this makes t~ = t+dt */
-      if (!(mid_flags & MID_PRESERVE)) {
-        copy_v3_v3(dx, bp->vec);
-      }
+static void softbody_apply_forces_reduce(const void *__restrict UNUSED(userdata),
+                                         void *__restrict chunk_join,
+                                         void *__restrict chunk)
+{
+  SB_ApplyForcesStats *join = chunk_join;
+  const SB_ApplyForcesStats *stats = chunk;
+
+  for (int i = 0; i < 3; i++) {
+    join->aabbmin[i] = min_ff(join->aabbmin[i], stats->aabbmin[i]);
+    join->aabbmax[i] = max_ff(join->aabbmax[i], stats->aabbmax[i]);
+  }
+  join->maxerrpos = max_ff(join->maxerrpos, stats->maxerrpos);
+  join->maxerrvel = max_ff(join->maxerrvel, stats->maxerrvel);
+  join->fuzzy |= stats->fuzzy;
+}
+
+static void softbody_apply_forces(Object *ob, float forcetime, int mode, float *err, int mid_flags)
+{
+  /* time evolution */
+  /* actually does an explicit euler step mode == 0 */
+  /* or heun ~ 2nd order runge-kutta steps, mode 1, 2 */
+  SoftBody *sb = ob->soft; /* is supposed to be there */
+  float cm[3] = {0.0f, 0.0f, 0.0f};
 
-      /* so here is (x)'= v(elocity) */
-      /* the euler step for location then becomes */
-      /* x(t + dt) = x(t) + v(t~) * dt */
-      mul_v3_fl(dx, forcetime);
+  forcetime *= sb_time_scale(ob);
 
-      /* the freezer coming sooner or later */
+  /* old one with homogeneous masses  */
+  /* claim a minimum mass for vertex */
 #if 0
-      if ((dot_v3v3(dx, dx) < freezeloc) && (dot_v3v3(bp->force, bp->force) < freezeforce)) {
-        bp->frozen /= 2;
-      }
-      else {
-        bp->frozen = min_ff(bp->frozen * 1.05f, 1.0f);
-      }
-      mul_v3_fl(dx, bp->frozen);
+  if (sb->nodemass > 0.009999f) {
+    timeovermass = forcetime / sb->nodemass;
+  }
+  else {
+    timeovermass = forcetime / 0.009999f;
+  }
 #endif
-      /* again some nasty if's to have heun in here too */
-      if (mode == 1) {
-        copy_v3_v3(bp->prevpos, bp->pos);
-        copy_v3_v3(bp->prevdx, dx);
-      }
 
-      if (mode == 2) {
-        bp->pos[0] = bp->prevpos[0] + 0.5f * (dx[0] + bp->prevdx[0]);
-        bp->pos[1] = bp->prevpos[1] + 0.5f * (dx[1] + bp->prevdx[1]);
-        bp->pos[2] = bp->prevpos[2] + 0.5f * (dx[2] + bp->prevdx[2]);
-        maxerrpos = max_ff(maxerrpos, fabsf(dx[0] - bp->prevdx[0]));
-        maxerrpos = max_ff(maxerrpos, fabsf(dx[1] - bp->prevdx[1]));
-        maxerrpos = max_ff(maxerrpos, fabsf(dx[2] - bp->prevdx[2]));
-
-        /* bp->choke is set when we need to pull a vertex or edge out of the collider.
-         * the collider object signals to get out by pushing hard. on the other hand
-         * we don't want to end up in deep space so we add some <viscosity>
-         * to balance that out */
-        if (bp->choke2 > 0.0f) {
-          mul_v3_fl(bp->vec, (1.0f - bp->choke2));
-        }
-        if (bp->choke > 0.0f) {
-          mul_v3_fl(bp->vec, (1.0f - bp->choke));
-        }
-      }
-      else {
-        add_v3_v3(bp->pos, dx);
-      }
-    } /*snap*/
-    /* so while we are looping BPs anyway do statistics on the fly */
-    minmax_v3v3_v3(aabbmin, aabbmax, bp->pos);
-    if (bp->loc_flag & SBF_DOFUZZY) {
-      fuzzy = 1;
-    }
-  } /*for*/
+  /* Points are independent here, integrate them in parallel. */
+  SB_ApplyForcesData data = {
+      .ob = ob,
+      .forcetime = forcetime,
+      .mode = mode,
+      .mid_flags = mid_flags,
+  };
+  SB_ApplyForcesStats stats = {
+      .aabbmin = {1e20f, 1e20f, 1e20f},
+      .aabbmax = {-1e20f, -1e20f, -1e20f},
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (sb->totpoint >= 1024);
+  settings.min_iter_per_thread = 256;
+  settings.userdata_chunk = &stats;
+  settings.userdata_chunk_size = sizeof(stats);
+  settings.func_reduce = softbody_apply_forces_reduce;
+  BLI_task_parallel_range(0, sb->totpoint, &data, softbody_apply_forces_task_cb, &settings);
+
+  const float maxerrpos = stats.maxerrpos;
+  const float maxerrvel = stats.maxerrvel;
 
   if (sb->totpoint) {
     mul_v3_fl(cm, 1.0f / sb->totpoint);
   }
   if (sb->scratch) {
-    copy_v3_v3(sb->scratch->aabbmin, aabbmin);
-    copy_v3_v3(sb->scratch->aabbmax, aabbmax);
+    copy_v3_v3(sb->scratch->aabbmin, stats.aabbmin);
+    copy_v3_v3(sb->scratch->aabbmax, stats.aabbmax);
   }
 
   if (err) { /* so step size will be controlled by biggest difference in slope */
@@ -2481,7 +2486,7 @@ static void softbody_apply_forces(Object *ob, float forcetime, int mode, float *
       *err = maxerrpos;
     }
     // printf("EP %f EV %f\n", maxerrpos, maxerrvel);
-    if (fuzzy) {
+    if (stats.fuzzy) {
       *err /= sb->fuzzyness;
     }
   }
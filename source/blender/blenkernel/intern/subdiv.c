@@ -23,10 +23,14 @@
 
 #include "BKE_subdiv.h"
 
+#include <string.h>
+
 #include "DNA_mesh_types.h"
 #include "DNA_meshdata_types.h"
 #include "DNA_modifier_types.h"
 
+#include "BKE_customdata.h"
+
 #include "BLI_utildefines.h"
 
 #include "MEM_guardedalloc.h"
@@ -173,14 +177,86 @@ Subdiv *BKE_subdiv_update_from_converter(Subdiv *subdiv,
   return BKE_subdiv_new_from_converter(settings, converter);
 }
 
+/* Store everything the mesh converter feeds to the topology refiner into a flat array, so
+ * topology can be compared with a single memcmp(). UV coordinates are stored as-is since
+ * face-varying topology is derived from them. */
+static int *subdiv_mesh_topology_snapshot(const SubdivSettings *settings,
+                                          const Mesh *mesh,
+                                          size_t *r_len)
+{
+  const int num_uv_layers = CustomData_number_of_layers(&mesh->ldata, CD_MLOOPUV);
+  const int edge_stride = settings->use_creases ? 3 : 2;
+  const size_t len = 5 + (size_t)mesh->totpoly * 2 + (size_t)mesh->totloop * 2 +
+                     (size_t)mesh->totedge * edge_stride +
+                     (size_t)mesh->totloop * 2 * num_uv_layers;
+  int *topology = MEM_malloc_arrayN(len, sizeof(int), "subdiv mesh topology");
+  int *data = topology;
+  *data++ = mesh->totvert;
+  *data++ = mesh->totedge;
+  *data++ = mesh->totpoly;
+  *data++ = mesh->totloop;
+  *data++ = num_uv_layers;
+  for (int poly_index = 0; poly_index < mesh->totpoly; poly_index++) {
+    *data++ = mesh->mpoly[poly_index].loopstart;
+    *data++ = mesh->mpoly[poly_index].totloop;
+  }
+  for (int loop_index = 0; loop_index < mesh->totloop; loop_index++) {
+    *data++ = (int)mesh->mloop[loop_index].v;
+    *data++ = (int)mesh->mloop[loop_index].e;
+  }
+  for (int edge_index = 0; edge_index < mesh->totedge; edge_index++) {
+    const MEdge *edge = &mesh->medge[edge_index];
+    *data++ = (int)edge->v1;
+    *data++ = (int)edge->v2;
+    if (settings->use_creases) {
+      *data++ = edge->crease;
+    }
+  }
+  for (int layer_index = 0; layer_index < num_uv_layers; layer_index++) {
+    const MLoopUV *mloopuv = CustomData_get_layer_n(&mesh->ldata, CD_MLOOPUV, layer_index);
+    for (int loop_index = 0; loop_index < mesh->totloop; loop_index++) {
+      memcpy(data, mloopuv[loop_index].uv, sizeof(float[2]));
+      data += 2;
+    }
+  }
+  BLI_assert((size_t)(data - topology) == len);
+  *r_len = len;
+  return topology;
+}
+
 Subdiv *BKE_subdiv_update_from_mesh(Subdiv *subdiv,
                                     const SubdivSettings *settings,
                                     const Mesh *mesh)
 {
+  size_t mesh_topology_len;
+  int *mesh_topology = subdiv_mesh_topology_snapshot(settings, mesh, &mesh_topology_len);
+  /* Fast path for deforming meshes: the converter does not need to be created at all when the
+   * snapshot of the topology matches the one the refiner was created for. */
+  if (subdiv != NULL && subdiv->topology_refiner != NULL &&
+      subdiv->cache_.mesh_topology != NULL &&
+      BKE_subdiv_settings_equal(&subdiv->settings, settings)) {
+    BKE_subdiv_stats_begin(&subdiv->stats, SUBDIV_STATS_TOPOLOGY_COMPARE);
+    const bool is_topology_equal = subdiv->cache_.mesh_topology_len == mesh_topology_len &&
+                                   memcmp(subdiv->cache_.mesh_topology,
+                                          mesh_topology,
+                                          sizeof(int) * mesh_topology_len) == 0;
+    BKE_subdiv_stats_end(&subdiv->stats, SUBDIV_STATS_TOPOLOGY_COMPARE);
+    if (is_topology_equal) {
+      MEM_freeN(mesh_topology);
+      return subdiv;
+    }
+  }
   OpenSubdiv_Converter converter;
   BKE_subdiv_converter_init_for_mesh(&converter, settings, mesh);
   subdiv = BKE_subdiv_update_from_converter(subdiv, settings, &converter);
   BKE_subdiv_converter_free(&converter);
+  if (subdiv == NULL) {
+    MEM_freeN(mesh_topology);
+    return NULL;
+  }
+  MEM_SAFE_FREE(subdiv->cache_.mesh_topology);
+  subdiv->cache_.mesh_topology = mesh_topology;
+  subdiv->cache_.mesh_topology_len = mesh_topology_len;
   return subdiv;
 }
 
@@ -198,6 +274,7 @@ void BKE_subdiv_free(Subdiv *subdiv)
   if (subdiv->cache_.face_ptex_offset != NULL) {
     MEM_freeN(subdiv->cache_.face_ptex_offset);
   }
+  MEM_SAFE_FREE(subdiv->cache_.mesh_topology);
   MEM_freeN(subdiv);
 }
 
@@ -61,6 +61,32 @@ bool BKE_subdiv_eval_begin(Subdiv *subdiv)
   return true;
 }
 
+/* Upload a run of consecutive used coarse vertices with a single evaluator call. */
+static void set_coarse_positions_run(Subdiv *subdiv,
+                                     const MVert *mvert,
+                                     const float (*coarse_vertex_cos)[3],
+                                     const int vertex_index,
+                                     const int manifold_vertex_index,
+                                     const int num_vertices)
+{
+  if (num_vertices == 0) {
+    return;
+  }
+  OpenSubdiv_Evaluator *evaluator = subdiv->evaluator;
+  if (coarse_vertex_cos != NULL) {
+    evaluator->setCoarsePositions(
+        evaluator, coarse_vertex_cos[vertex_index], manifold_vertex_index, num_vertices);
+  }
+  else {
+    evaluator->setCoarsePositionsFromBuffer(evaluator,
+                                            &mvert[vertex_index],
+                                            offsetof(MVert, co),
+                                            sizeof(MVert),
+                                            manifold_vertex_index,
+                                            num_vertices);
+  }
+}
+
 static void set_coarse_positions(Subdiv *subdiv,
                                  const Mesh *mesh,
                                  const float (*coarse_vertex_cos)[3])
@@ -80,22 +106,29 @@ static void set_coarse_positions(Subdiv *subdiv,
       BLI_BITMAP_ENABLE(vertex_used_map, loop->v);
     }
   }
-  for (int vertex_index = 0, manifold_vertex_index = 0; vertex_index < mesh->totvert;
-       vertex_index++) {
+  /* Used vertices are consecutive in OpenSubdiv, so every run of used vertices is uploaded at
+   * once, which is the whole mesh when there is no loose geometry. */
+  int run_start = 0, run_manifold_start = 0, manifold_vertex_index = 0;
+  for (int vertex_index = 0; vertex_index < mesh->totvert; vertex_index++) {
     if (!BLI_BITMAP_TEST_BOOL(vertex_used_map, vertex_index)) {
+      set_coarse_positions_run(subdiv,
+                               mvert,
+                               coarse_vertex_cos,
+                               run_start,
+                               run_manifold_start,
+                               manifold_vertex_index - run_manifold_start);
+      run_start = vertex_index + 1;
+      run_manifold_start = manifold_vertex_index;
       continue;
     }
-    const float *vertex_co;
-    if (coarse_vertex_cos != NULL) {
-      vertex_co = coarse_vertex_cos[vertex_index];
-    }
-    else {
-      const MVert *vertex = &mvert[vertex_index];
-      vertex_co = vertex->co;
-    }
-    subdiv->evaluator->setCoarsePositions(subdiv->evaluator, vertex_co, manifold_vertex_index, 1);
     manifold_vertex_index++;
   }
+  set_coarse_positions_run(subdiv,
+                           mvert,
+                           coarse_vertex_cos,
+                           run_start,
+                           run_manifold_start,
+                           manifold_vertex_index - run_manifold_start);
   MEM_freeN(vertex_used_map);
 }
 
@@ -629,6 +629,57 @@ MovieTrackingMarker *tracking_get_keyframed_marker(MovieTrackingTrack *track,
 /** \name Frame Accessor
  * \{ */
 
+static ImBuf *accessor_frames_lookup(TrackingImageAccessor *accessor, int clip_index, int frame)
+{
+  ImBuf *ibuf = NULL;
+
+  BLI_spin_lock(&accessor->cache_lock);
+  for (int i = 0; i < MAX_ACCESSOR_FRAMES; i++) {
+    TrackingImageAccessorFrame *accessor_frame = &accessor->frames[i];
+    if (accessor_frame->ibuf != NULL && accessor_frame->clip_index == clip_index &&
+        accessor_frame->frame == frame) {
+      ibuf = accessor_frame->ibuf;
+      IMB_refImBuf(ibuf);
+      break;
+    }
+  }
+  BLI_spin_unlock(&accessor->cache_lock);
+
+  return ibuf;
+}
+
+static void accessor_frames_add(TrackingImageAccessor *accessor,
+                                int clip_index,
+                                int frame,
+                                ImBuf *ibuf)
+{
+  ImBuf *old_ibuf;
+
+  IMB_refImBuf(ibuf);
+
+  BLI_spin_lock(&accessor->cache_lock);
+  for (int i = 0; i < MAX_ACCESSOR_FRAMES; i++) {
+    TrackingImageAccessorFrame *accessor_frame = &accessor->frames[i];
+    if (accessor_frame->ibuf != NULL && accessor_frame->clip_index == clip_index &&
+        accessor_frame->frame == frame) {
+      /* Another thread added the frame meanwhile. */
+      BLI_spin_unlock(&accessor->cache_lock);
+      IMB_freeImBuf(ibuf);
+      return;
+    }
+  }
+  TrackingImageAccessorFrame *accessor_frame = &accessor->frames[accessor->frames_next];
+  accessor->frames_next = (accessor->frames_next + 1) % MAX_ACCESSOR_FRAMES;
+  old_ibuf = accessor_frame->ibuf;
+  accessor_frame->clip_index = clip_index;
+  accessor_frame->frame = frame;
+  accessor_frame->ibuf = ibuf;
+  BLI_spin_unlock(&accessor->cache_lock);
+
+  /* Release outside of the lock, this might free the frame. */
+  IMB_freeImBuf(old_ibuf);
+}
+
 static ImBuf *accessor_get_preprocessed_ibuf(TrackingImageAccessor *accessor,
                                              int clip_index,
                                              int frame)
@@ -640,6 +691,11 @@ static ImBuf *accessor_get_preprocessed_ibuf(TrackingImageAccessor *accessor,
 
   BLI_assert(clip_index < accessor->num_clips);
 
+  ibuf = accessor_frames_lookup(accessor, clip_index, frame);
+  if (ibuf != NULL) {
+    return ibuf;
+  }
+
   clip = accessor->clips[clip_index];
   scene_frame = BKE_movieclip_remap_clip_to_scene_frame(clip, frame);
   BKE_movieclip_user_set_frame(&user, scene_frame);
@@ -647,6 +703,10 @@ static ImBuf *accessor_get_preprocessed_ibuf(TrackingImageAccessor *accessor,
   user.render_flag = 0;
   ibuf = BKE_movieclip_get_ibuf(clip, &user);
 
+  if (ibuf != NULL) {
+    accessor_frames_add(accessor, clip_index, frame, ibuf);
+  }
+
   return ibuf;
 }
 
@@ -946,6 +1006,9 @@ TrackingImageAccessor *tracking_image_accessor_new(MovieClip *clips[MAX_ACCESSOR
 void tracking_image_accessor_destroy(TrackingImageAccessor *accessor)
 {
   libmv_FrameAccessorDestroy(accessor->libmv_accessor);
+  for (int i = 0; i < MAX_ACCESSOR_FRAMES; i++) {
+    IMB_freeImBuf(accessor->frames[i].ibuf);
+  }
   BLI_spin_end(&accessor->cache_lock);
   MEM_freeN(accessor->tracks);
   MEM_freeN(accessor);
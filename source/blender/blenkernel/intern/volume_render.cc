@@ -18,6 +18,8 @@
  * \ingroup bke
  */
 
+#include <algorithm>
+
 #include "MEM_guardedalloc.h"
 
 #include "BLI_array.hh"
@@ -141,6 +143,60 @@ bool BKE_volume_grid_dense_floats(const Volume *volume,
   return false;
 }
 
+bool BKE_volume_grid_dense_floats_slabs(const Volume *volume,
+                                        VolumeGrid *volume_grid,
+                                        const int64_t max_slab_voxels,
+                                        DenseFloatVolumeGrid *r_dense_grid,
+                                        BKE_volume_dense_float_slab_cb cb,
+                                        void *cb_userdata)
+{
+#ifdef WITH_OPENVDB
+  const VolumeGridType grid_type = BKE_volume_grid_type(volume_grid);
+  openvdb::GridBase::ConstPtr grid = BKE_volume_grid_openvdb_for_read(volume, volume_grid);
+
+  const openvdb::CoordBBox bbox = grid->evalActiveVoxelBoundingBox();
+  if (bbox.empty()) {
+    return false;
+  }
+
+  const openvdb::Vec3i resolution = bbox.dim().asVec3i();
+  const int64_t slice_voxels = static_cast<int64_t>(resolution[0]) *
+                               static_cast<int64_t>(resolution[1]);
+  const int slab_depth = static_cast<int>(
+      std::clamp<int64_t>(max_slab_voxels / slice_voxels, 1, resolution[2]));
+  const int channels = BKE_volume_grid_channels(volume_grid);
+  const int elem_size = sizeof(float) * channels;
+  float *voxels = static_cast<float *>(
+      MEM_malloc_arrayN(slice_voxels * slab_depth, elem_size, __func__));
+  if (voxels == nullptr) {
+    return false;
+  }
+
+  create_texture_to_object_matrix(grid->transform().baseMap()->getAffineMap()->getMat4(),
+                                  bbox,
+                                  r_dense_grid->texture_to_object);
+  r_dense_grid->voxels = nullptr;
+  r_dense_grid->channels = channels;
+  copy_v3_v3_int(r_dense_grid->resolution, resolution.asV());
+
+  /* With #openvdb::tools::LayoutXYZ, X varies fastest, so every slab is a contiguous part of the
+   * dense grid. */
+  for (int z_offset = 0; z_offset < resolution[2]; z_offset += slab_depth) {
+    const int depth = std::min(slab_depth, resolution[2] - z_offset);
+    openvdb::CoordBBox slab_bbox = bbox;
+    slab_bbox.min().z() = bbox.min().z() + z_offset;
+    slab_bbox.max().z() = slab_bbox.min().z() + depth - 1;
+    extract_dense_float_voxels(grid_type, *grid, slab_bbox, voxels);
+    cb(cb_userdata, r_dense_grid, voxels, z_offset, depth);
+  }
+
+  MEM_freeN(voxels);
+  return true;
+#endif
+  UNUSED_VARS(volume, volume_grid, max_slab_voxels, r_dense_grid, cb, cb_userdata);
+  return false;
+}
+
 void BKE_volume_dense_float_grid_clear(DenseFloatVolumeGrid *dense_grid)
 {
   if (dense_grid->voxels != nullptr) {
@@ -64,6 +64,18 @@
 
 struct StampData;
 
+/* Rendered frame waiting in the queue of the encode thread. */
+typedef struct FFMpegEncodeFrame {
+  uint8_t *pixels;
+  const RenderData *rd;
+  int cfra;
+  /* Time up to which audio is written after the frame. */
+  double audio_time;
+} FFMpegEncodeFrame;
+
+/* Number of rendered frames that can wait for the encode thread. */
+#  define FFMPEG_ENCODE_QUEUE_SIZE 4
+
 typedef struct FFMpegContext {
   int ffmpeg_type;
   int ffmpeg_codec;
@@ -104,6 +116,15 @@ typedef struct FFMpegContext {
 #  ifdef WITH_AUDASPACE
   AUD_Device *audio_mixdown_device;
 #  endif
+
+  /* Pixel conversion, encoding and writing of the frames runs in a separate thread, so the
+   * renderer can continue with the next frame. Frames of the pool move from encode_free_queue
+   * to encode_queue and back once they are written. */
+  ListBase encode_threads;
+  ThreadQueue *encode_queue;
+  ThreadQueue *encode_free_queue;
+  FFMpegEncodeFrame encode_frames[FFMPEG_ENCODE_QUEUE_SIZE];
+  bool encode_failed;
 } FFMpegContext;
 
 #  define FFMPEG_AUTOSPLIT_SIZE 2000000000
@@ -568,7 +589,8 @@ static AVStream *alloc_video_stream(FFMpegContext *context,
 
   c = st->codec;
   c->thread_count = BLI_system_thread_count();
-  c->thread_type = FF_THREAD_SLICE;
+  /* Encoders without frame threading support use slice threads only. */
+  c->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
 
   c->codec_id = codec_id;
   c->codec_type = AVMEDIA_TYPE_VIDEO;
@@ -1224,6 +1246,78 @@ static void flush_ffmpeg(FFMpegContext *context)
  * * public interface
  * ********************************************************************** */
 
+#  ifdef WITH_AUDASPACE
+static void write_audio_frames(FFMpegContext *context, double to_pts)
+{
+  int finished = 0;
+
+  while (context->audio_stream && !finished) {
+    if ((context->audio_time >= to_pts) || (write_audio_frame(context))) {
+      finished = 1;
+    }
+  }
+}
+#  endif
+
+static void *ffmpeg_encode_thread(void *context_v)
+{
+  FFMpegContext *context = context_v;
+  FFMpegEncodeFrame *frame;
+
+  /* Returns NULL once BKE_ffmpeg_end marked the queue as finished and it ran empty. */
+  while ((frame = BLI_thread_queue_pop(context->encode_queue))) {
+    if (!context->encode_failed) {
+      AVFrame *avframe = generate_video_frame(context, frame->pixels, NULL);
+      if (!(avframe && write_video_frame(context, frame->rd, frame->cfra, avframe, NULL))) {
+        context->encode_failed = true;
+      }
+#  ifdef WITH_AUDASPACE
+      write_audio_frames(context, frame->audio_time);
+#  endif
+    }
+
+    BLI_thread_queue_push(context->encode_free_queue, frame);
+  }
+
+  return NULL;
+}
+
+static void ffmpeg_encode_thread_start(FFMpegContext *context, int rectx, int recty)
+{
+  context->encode_queue = BLI_thread_queue_init();
+  context->encode_free_queue = BLI_thread_queue_init();
+  context->encode_failed = false;
+
+  for (int i = 0; i < FFMPEG_ENCODE_QUEUE_SIZE; i++) {
+    FFMpegEncodeFrame *frame = &context->encode_frames[i];
+    frame->pixels = MEM_mallocN((size_t)4 * rectx * recty, "ffmpeg encode frame");
+    BLI_thread_queue_push(context->encode_free_queue, frame);
+  }
+
+  BLI_threadpool_init(&context->encode_threads, ffmpeg_encode_thread, 1);
+  BLI_threadpool_insert(&context->encode_threads, context);
+}
+
+/* Wait until all queued frames are written. */
+static void ffmpeg_encode_thread_end(FFMpegContext *context)
+{
+  if (context->encode_queue == NULL) {
+    return;
+  }
+
+  BLI_thread_queue_nowait(context->encode_queue);
+  BLI_threadpool_end(&context->encode_threads);
+
+  for (int i = 0; i < FFMPEG_ENCODE_QUEUE_SIZE; i++) {
+    MEM_SAFE_FREE(context->encode_frames[i].pixels);
+  }
+
+  BLI_thread_queue_free(context->encode_queue);
+  BLI_thread_queue_free(context->encode_free_queue);
+  context->encode_queue = NULL;
+  context->encode_free_queue = NULL;
+}
+
 /* Get the output filename-- similar to the other output formats */
 static void ffmpeg_filepath_get(
     FFMpegContext *context, char *string, const RenderData *rd, bool preview, const char *suffix)
@@ -1348,24 +1442,17 @@ int BKE_ffmpeg_start(void *context_v,
 #    endif
   }
 #  endif
+
+  /* Autosplit needs the size of the written file after every frame, encode synchronously. */
+  if (success && context->video_stream && !context->ffmpeg_autosplit) {
+    ffmpeg_encode_thread_start(context, rectx, recty);
+  }
+
   return success;
 }
 
 static void end_ffmpeg_impl(FFMpegContext *context, int is_autosplit);
 
-#  ifdef WITH_AUDASPACE
-static void write_audio_frames(FFMpegContext *context, double to_pts)
-{
-  int finished = 0;
-
-  while (context->audio_stream && !finished) {
-    if ((context->audio_time >= to_pts) || (write_audio_frame(context))) {
-      finished = 1;
-    }
-  }
-}
-#  endif
-
 int BKE_ffmpeg_append(void *context_v,
                       RenderData *rd,
                       int start_frame,
@@ -1385,6 +1472,25 @@ int BKE_ffmpeg_append(void *context_v,
   /* why is this done before writing the video frame and again at end_ffmpeg? */
   //  write_audio_frames(frame / (((double)rd->frs_sec) / rd->frs_sec_base));
 
+  if (context->encode_queue) {
+    /* Blocks only when all frames of the pool are still waiting to be encoded. */
+    FFMpegEncodeFrame *encode_frame = BLI_thread_queue_pop(context->encode_free_queue);
+
+    if (context->encode_failed) {
+      BLI_thread_queue_push(context->encode_free_queue, encode_frame);
+      BKE_report(reports, RPT_ERROR, "Error writing frame");
+      return 0;
+    }
+
+    memcpy(encode_frame->pixels, pixels, (size_t)4 * rectx * recty);
+    encode_frame->rd = rd;
+    encode_frame->cfra = frame - start_frame;
+    encode_frame->audio_time = (frame - start_frame) /
+                               (((double)rd->frs_sec) / (double)rd->frs_sec_base);
+    BLI_thread_queue_push(context->encode_queue, encode_frame);
+    return success;
+  }
+
   if (context->video_stream) {
     avframe = generate_video_frame(context, (unsigned char *)pixels, reports);
     success = (avframe && write_video_frame(context, rd, frame - start_frame, avframe, reports));
@@ -1409,6 +1515,8 @@ static void end_ffmpeg_impl(FFMpegContext *context, int is_autosplit)
 {
   PRINT("Closing ffmpeg...\n");
 
+  ffmpeg_encode_thread_end(context);
+
 #  ifdef WITH_AUDASPACE
   if (is_autosplit == false) {
     if (context->audio_mixdown_device) {
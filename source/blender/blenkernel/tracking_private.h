@@ -130,6 +130,16 @@ float *tracking_track_get_mask_for_region(int frame_width,
 struct libmv_FrameAccessor;
 
 #define MAX_ACCESSOR_CLIP 64
+#define MAX_ACCESSOR_FRAMES 4
+
+/* Frame of a clip which has been requested by the accessor recently. */
+typedef struct TrackingImageAccessorFrame {
+  int clip_index;
+  int frame;
+  /* Own reference to the (pre-processed) frame, NULL for unused entries. */
+  struct ImBuf *ibuf;
+} TrackingImageAccessorFrame;
+
 typedef struct TrackingImageAccessor {
   struct MovieClip *clips[MAX_ACCESSOR_CLIP];
   int num_clips;
@@ -141,6 +151,11 @@ typedef struct TrackingImageAccessor {
   int num_tracks;
 
   struct libmv_FrameAccessor *libmv_accessor;
+
+  /* Frames shared by all tracks, so that the clip cache (which is protected by a global lock) is
+   * only accessed once per frame and not once per marker. Protected by the cache lock. */
+  TrackingImageAccessorFrame frames[MAX_ACCESSOR_FRAMES];
+  int frames_next;
   SpinLock cache_lock;
 } TrackingImageAccessor;
 
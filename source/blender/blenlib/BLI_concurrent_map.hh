@@ -0,0 +1,266 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * A `blender::ConcurrentMap<Key, Value>` is a hash map that can be used from multiple threads at
+ * the same time. It is meant to replace a `blender::Map` that is protected by a single mutex,
+ * which becomes a point of contention when many threads access it.
+ *
+ * The keys are distributed over a fixed number of shards. Every shard is a `blender::Map` with
+ * its own mutex, so threads only wait for each other when they access keys in the same shard.
+ *
+ * Some noteworthy information:
+ * - All methods are thread-safe, except for construction, destruction and moving.
+ * - References to keys or values are never handed out, because another thread could change the
+ *   shard they are in at the same time. Values are copied or moved out instead. To change
+ *   values in place use #foreach_item, whose callback runs while the shard is locked.
+ * - Callbacks run while a shard is locked, they must not access the same map again.
+ * - The hash is remixed to select the shard, so that the low bits of it (used by the map of the
+ *   shard) and the bits used to select the shard are independent.
+ */
+
+#include <mutex>
+
+#include "BLI_map.hh"
+
+namespace blender {
+
+template<
+    /** Type of the keys stored in the map. */
+    typename Key,
+    /** Type of the value that is stored per key. */
+    typename Value,
+    /** The hash function used to hash the keys, see BLI_hash.hh. */
+    typename Hash = DefaultHash<Key>,
+    /** The equality operator used to compare keys. */
+    typename IsEqual = DefaultEquality,
+    /**
+     * Number of shards as a power of two. More shards reduce contention, but increase the
+     * memory footprint of empty maps.
+     */
+    int ShardsNumLog2 = 6>
+class ConcurrentMap {
+ public:
+  using MapType = Map<Key, Value, 0, DefaultProbingStrategy, Hash, IsEqual>;
+  static constexpr int64_t ShardsNum = int64_t(1) << ShardsNumLog2;
+
+ private:
+  /* Aligned to avoid false sharing between the mutexes of different shards. */
+  struct alignas(64) Shard {
+    mutable std::mutex mutex;
+    MapType map;
+  };
+
+  Array<Shard, 0> shards_;
+  Hash hash_;
+
+ public:
+  ConcurrentMap() : shards_(ShardsNum)
+  {
+  }
+
+  /**
+   * Reserve memory for roughly \a n keys in total, assuming they are distributed evenly.
+   */
+  void reserve(const int64_t n)
+  {
+    const int64_t n_per_shard = n / ShardsNum + 1;
+    for (Shard &shard : shards_) {
+      std::lock_guard lock{shard.mutex};
+      shard.map.reserve(n_per_shard);
+    }
+  }
+
+  /**
+   * Add a key-value-pair to the map. If the map contains the key already, nothing is changed.
+   * Returns true when the key has been newly added.
+   */
+  bool add(const Key &key, const Value &value)
+  {
+    Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.map.add(key, value);
+  }
+  bool add(const Key &key, Value &&value)
+  {
+    Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.map.add(key, std::move(value));
+  }
+
+  /**
+   * Add a key-value-pair to the map. This invokes undefined behavior when the key is in the map
+   * already.
+   */
+  void add_new(const Key &key, const Value &value)
+  {
+    Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    shard.map.add_new(key, value);
+  }
+  void add_new(const Key &key, Value &&value)
+  {
+    Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    shard.map.add_new(key, std::move(value));
+  }
+
+  /**
+   * Add a key-value-pair to the map. If the map contains the key already, the corresponding
+   * value will be replaced. Returns true when the key has been newly added.
+   */
+  bool add_overwrite(const Key &key, const Value &value)
+  {
+    Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.map.add_overwrite(key, value);
+  }
+
+  /**
+   * Returns true if there is a key in the map that compares equal to the given key.
+   */
+  bool contains(const Key &key) const
+  {
+    const Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.map.contains(key);
+  }
+
+  /**
+   * Returns a copy of the value corresponding to the key, or the default value when the key is
+   * not in the map.
+   */
+  Value lookup_default(const Key &key, const Value &default_value) const
+  {
+    const Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.map.lookup_default(key, default_value);
+  }
+
+  /**
+   * Returns a copy of the value corresponding to the key. If the key is not in the map,
+   * \a create_value is called and its result is added. \a create_value is only called once per
+   * key, even when multiple threads look up the same key at the same time.
+   */
+  template<typename CreateValueF>
+  Value lookup_or_add_cb(const Key &key, const CreateValueF &create_value)
+  {
+    Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.map.lookup_or_add_cb(key, create_value);
+  }
+
+  /**
+   * Remove the key from the map. Returns true when the key has been removed.
+   */
+  bool remove(const Key &key)
+  {
+    Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.map.remove(key);
+  }
+
+  /**
+   * Get the value that is stored for the given key and remove it from the map. This invokes
+   * undefined behavior when the key is not in the map.
+   */
+  Value pop(const Key &key)
+  {
+    Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.map.pop(key);
+  }
+
+  /**
+   * Get the value that is stored for the given key and remove it from the map. If the key is not
+   * in the map, nothing is removed and an empty optional is returned.
+   */
+  std::optional<Value> pop_try(const Key &key)
+  {
+    Shard &shard = this->shard_for_key(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.map.pop_try(key);
+  }
+
+  /**
+   * Call \a fn with every key and a (mutable) reference to its value. The shards are locked one
+   * after another, so items that are added or removed by other threads meanwhile may or may not
+   * be visited.
+   */
+  template<typename FuncT> void foreach_item(const FuncT &fn)
+  {
+    for (Shard &shard : shards_) {
+      std::lock_guard lock{shard.mutex};
+      for (auto item : shard.map.items()) {
+        fn(item.key, item.value);
+      }
+    }
+  }
+
+  /**
+   * Number of keys in the map. This is only exact when no other thread changes the map at the
+   * same time.
+   */
+  int64_t size() const
+  {
+    int64_t size = 0;
+    for (const Shard &shard : shards_) {
+      std::lock_guard lock{shard.mutex};
+      size += shard.map.size();
+    }
+    return size;
+  }
+
+  bool is_empty() const
+  {
+    return this->size() == 0;
+  }
+
+  /**
+   * Remove all keys from the map.
+   */
+  void clear()
+  {
+    for (Shard &shard : shards_) {
+      std::lock_guard lock{shard.mutex};
+      shard.map.clear();
+    }
+  }
+
+ private:
+  int64_t shard_index(const Key &key) const
+  {
+    /* Fibonacci hashing, uses the highest bits of the remixed hash. */
+    const uint64_t hash = uint64_t(hash_(key)) * uint64_t(0x9E3779B97F4A7C15);
+    return int64_t(hash >> (64 - ShardsNumLog2));
+  }
+
+  Shard &shard_for_key(const Key &key)
+  {
+    return shards_[this->shard_index(key)];
+  }
+
+  const Shard &shard_for_key(const Key &key) const
+  {
+    return shards_[this->shard_index(key)];
+  }
+};
+
+}  // namespace blender
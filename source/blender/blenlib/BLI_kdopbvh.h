@@ -172,6 +172,10 @@ BVHTreeOverlap *BLI_bvhtree_overlap(const BVHTree *tree1,
                                     unsigned int *r_overlap_tot,
                                     BVHTree_OverlapCallback callback,
                                     void *userdata);
+BVHTreeOverlap *BLI_bvhtree_overlap_self(const BVHTree *tree,
+                                         unsigned int *r_overlap_tot,
+                                         BVHTree_OverlapCallback callback,
+                                         void *userdata);
 
 int *BLI_bvhtree_intersect_plane(BVHTree *tree, float plane[4], uint *r_intersect_tot);
 
@@ -217,6 +221,16 @@ int BLI_bvhtree_ray_cast(BVHTree *tree,
                          BVHTree_RayCastCallback callback,
                          void *userdata);
 
+void BLI_bvhtree_ray_cast_batch(BVHTree *tree,
+                                const float (*co)[3],
+                                const float (*dir)[3],
+                                const int rays_num,
+                                float radius,
+                                BVHTreeRayHit *hits,
+                                BVHTree_RayCastCallback callback,
+                                void *userdata,
+                                int flag);
+
 void BLI_bvhtree_ray_cast_all_ex(BVHTree *tree,
                                  const float co[3],
                                  const float dir[3],
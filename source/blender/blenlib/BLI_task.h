@@ -48,6 +48,10 @@ void BLI_task_scheduler_init(void);
 void BLI_task_scheduler_exit(void);
 int BLI_task_scheduler_num_threads(void);
 
+int BLI_task_scheduler_numa_nodes_num(void);
+void BLI_task_scheduler_numa_run(int node, void (*func)(int node, void *userdata), void *userdata);
+void BLI_task_scheduler_numa_run_all(void (*func)(int node, void *userdata), void *userdata);
+
 /* Task Pool
  *
  * Pool of tasks that will be executed by the central task scheduler. For each
@@ -31,6 +31,7 @@
 #  include <tbb/blocked_range.h>
 #  include <tbb/parallel_for.h>
 #  include <tbb/parallel_for_each.h>
+#  include <tbb/parallel_scan.h>
 #  ifdef WIN32
 /* We cannot keep this defined, since other parts of the code deal with this on their own, leading
  * to multiple define warnings unless we un-define this, however we can only undefine this if we
@@ -41,7 +42,10 @@
 #  endif
 #endif
 
+#include <functional>
+
 #include "BLI_index_range.hh"
+#include "BLI_span.hh"
 #include "BLI_utildefines.h"
 
 namespace blender {
@@ -75,4 +79,38 @@ void parallel_for(IndexRange range, int64_t grain_size, const Function &function
 #endif
 }
 
+/**
+ * Replace every value with the sum of all values before it (an exclusive prefix sum) and return
+ * the sum of all values. This is typically used to turn element counts into offsets.
+ */
+template<typename T> T parallel_prefix_sum(MutableSpan<T> values, int64_t grain_size)
+{
+#ifdef WITH_TBB
+  return tbb::parallel_scan(
+      tbb::blocked_range<int64_t>(0, values.size(), grain_size),
+      T(0),
+      [&](const tbb::blocked_range<int64_t> &range, T sum, const bool is_final_scan) {
+        /* The values must not be changed before the final scan, they may be read twice. */
+        for (int64_t i = range.begin(); i < range.end(); i++) {
+          const T value = values[i];
+          if (is_final_scan) {
+            values[i] = sum;
+          }
+          sum += value;
+        }
+        return sum;
+      },
+      std::plus<T>());
+#else
+  UNUSED_VARS(grain_size);
+  T sum = T(0);
+  for (T &value : values) {
+    const T old_value = value;
+    value = sum;
+    sum += old_value;
+  }
+  return sum;
+#endif
+}
+
 }  // namespace blender
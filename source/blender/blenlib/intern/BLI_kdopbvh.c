@@ -70,6 +70,9 @@
 #  define KDOPBVH_THREAD_LEAF_THRESHOLD 1024
 #endif
 
+/* Minimum number of rays cast by one thread for batched ray casts. */
+#define KDOPBVH_THREAD_RAY_THRESHOLD 256
+
 /* -------------------------------------------------------------------- */
 /** \name Struct Definitions
  * \{ */
@@ -1398,6 +1401,198 @@ BVHTreeOverlap *BLI_bvhtree_overlap_ex(
   return overlap;
 }
 
+/**
+ * Version of #tree_overlap_traverse_cb for two nodes of the same tree,
+ * reporting the pair with the lower index first.
+ */
+static void tree_overlap_traverse_self_pair(BVHOverlapData_Thread *data_thread,
+                                            const BVHNode *node1,
+                                            const BVHNode *node2)
+{
+  BVHOverlapData_Shared *data = data_thread->shared;
+  int j;
+
+  if (tree_overlap_test(node1, node2, data->start_axis, data->stop_axis)) {
+    /* check if node1 is a leaf */
+    if (!node1->totnode) {
+      /* check if node2 is a leaf */
+      if (!node2->totnode) {
+        const int index_a = min_ii(node1->index, node2->index);
+        const int index_b = max_ii(node1->index, node2->index);
+
+        if (!data->callback ||
+            data->callback(data->userdata, index_a, index_b, data_thread->thread)) {
+          BVHTreeOverlap *overlap = BLI_stack_push_r(data_thread->overlap);
+          overlap->indexA = index_a;
+          overlap->indexB = index_b;
+        }
+      }
+      else {
+        for (j = 0; j < node2->totnode; j++) {
+          tree_overlap_traverse_self_pair(data_thread, node1, node2->children[j]);
+        }
+      }
+    }
+    else {
+      for (j = 0; j < node1->totnode; j++) {
+        tree_overlap_traverse_self_pair(data_thread, node1->children[j], node2);
+      }
+    }
+  }
+}
+
+/**
+ * Overlap of all leafs under \a node with each other, every pair is only visited once.
+ */
+static void tree_overlap_traverse_self(BVHOverlapData_Thread *data_thread, const BVHNode *node)
+{
+  for (int j = 0; j < node->totnode; j++) {
+    tree_overlap_traverse_self(data_thread, node->children[j]);
+    for (int k = j + 1; k < node->totnode; k++) {
+      tree_overlap_traverse_self_pair(data_thread, node->children[j], node->children[k]);
+    }
+  }
+}
+
+typedef struct BVHOverlapSelfData {
+  BVHOverlapData_Thread *data;
+  /** Nodes covering all leafs, tasks traverse every pair of them (including each with itself). */
+  const BVHNode **nodes;
+  int (*node_pairs)[2];
+} BVHOverlapSelfData;
+
+static void bvhtree_overlap_self_task_cb(void *__restrict userdata,
+                                         const int j,
+                                         const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  BVHOverlapSelfData *self_data = userdata;
+  BVHOverlapData_Thread *data = &self_data->data[j];
+  const int a = self_data->node_pairs[j][0];
+  const int b = self_data->node_pairs[j][1];
+
+  if (a == b) {
+    tree_overlap_traverse_self(data, self_data->nodes[a]);
+  }
+  else {
+    tree_overlap_traverse_self_pair(data, self_data->nodes[a], self_data->nodes[b]);
+  }
+}
+
+/**
+ * Overlap of a tree with itself, like `BLI_bvhtree_overlap(tree, tree, ...)` but only returning
+ * (and passing to \a callback) every pair once, with `indexA < indexB`.
+ * Also splits the work in more tasks than #BLI_bvhtree_overlap.
+ */
+BVHTreeOverlap *BLI_bvhtree_overlap_self(const BVHTree *tree,
+                                         uint *r_overlap_tot,
+                                         /* optional callback to test the overlap before adding
+                                          * (must be thread-safe!) */
+                                         BVHTree_OverlapCallback callback,
+                                         void *userdata)
+{
+  const BVHNode *root = tree->nodes[tree->totleaf];
+  const bool use_threading = (tree->totleaf > KDOPBVH_THREAD_LEAF_THRESHOLD);
+  BVHOverlapData_Shared data_shared;
+  BVHOverlapSelfData self_data;
+  int nodes_len = 1;
+  const BVHNode **nodes;
+  int j;
+
+  *r_overlap_tot = 0;
+
+  if (tree->totleaf == 0) {
+    return NULL;
+  }
+
+  /* Split the tree in enough nodes to keep all threads busy, the number of tasks grows with the
+   * square of the number of nodes. */
+  nodes = MEM_mallocN(sizeof(*nodes) * (size_t)tree->totleaf, __func__);
+  nodes[0] = root;
+  if (use_threading) {
+    const BVHNode **nodes_prev = MEM_mallocN(sizeof(*nodes) * (size_t)tree->totleaf, __func__);
+    bool split = true;
+    while (split && nodes_len < 16) {
+      int nodes_prev_len = nodes_len;
+      SWAP(const BVHNode **, nodes, nodes_prev);
+      nodes_len = 0;
+      split = false;
+      for (j = 0; j < nodes_prev_len; j++) {
+        if (nodes_prev[j]->totnode) {
+          for (int k = 0; k < nodes_prev[j]->totnode; k++) {
+            nodes[nodes_len++] = nodes_prev[j]->children[k];
+          }
+          split = true;
+        }
+        else {
+          nodes[nodes_len++] = nodes_prev[j];
+        }
+      }
+    }
+    MEM_freeN(nodes_prev);
+  }
+
+  const int tasks_len = nodes_len * (nodes_len + 1) / 2;
+  int(*node_pairs)[2] = MEM_mallocN(sizeof(*node_pairs) * (size_t)tasks_len, __func__);
+  j = 0;
+  for (int a = 0; a < nodes_len; a++) {
+    for (int b = a; b < nodes_len; b++, j++) {
+      node_pairs[j][0] = a;
+      node_pairs[j][1] = b;
+    }
+  }
+
+  BVHOverlapData_Thread *data = MEM_mallocN(sizeof(*data) * (size_t)tasks_len, __func__);
+
+  data_shared.tree1 = tree;
+  data_shared.tree2 = tree;
+  data_shared.start_axis = tree->start_axis;
+  data_shared.stop_axis = tree->stop_axis;
+  data_shared.callback = callback;
+  data_shared.userdata = userdata;
+
+  for (j = 0; j < tasks_len; j++) {
+    data[j].shared = &data_shared;
+    data[j].overlap = BLI_stack_new(sizeof(BVHTreeOverlap), __func__);
+    data[j].max_interactions = 0;
+    data[j].thread = j;
+  }
+
+  self_data.data = data;
+  self_data.nodes = nodes;
+  self_data.node_pairs = node_pairs;
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = use_threading;
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0, tasks_len, &self_data, bvhtree_overlap_self_task_cb, &settings);
+
+  size_t total = 0;
+  for (j = 0; j < tasks_len; j++) {
+    total += BLI_stack_count(data[j].overlap);
+  }
+
+  BVHTreeOverlap *overlap = NULL;
+  if (total) {
+    BVHTreeOverlap *to = overlap = MEM_mallocN(sizeof(BVHTreeOverlap) * total, "BVHTreeOverlap");
+    for (j = 0; j < tasks_len; j++) {
+      uint count = (uint)BLI_stack_count(data[j].overlap);
+      BLI_stack_pop_n(data[j].overlap, to, count);
+      to += count;
+    }
+  }
+
+  for (j = 0; j < tasks_len; j++) {
+    BLI_stack_free(data[j].overlap);
+  }
+  MEM_freeN(data);
+  MEM_freeN(nodes);
+  MEM_freeN(node_pairs);
+
+  *r_overlap_tot = (uint)total;
+  return overlap;
+}
+
 BVHTreeOverlap *BLI_bvhtree_overlap(
     const BVHTree *tree1,
     const BVHTree *tree2,
@@ -1993,6 +2188,70 @@ int BLI_bvhtree_ray_cast(BVHTree *tree,
       tree, co, dir, radius, hit, callback, userdata, BVH_RAYCAST_DEFAULT);
 }
 
+typedef struct BVHRayCastBatchData {
+  BVHTree *tree;
+  const float (*co)[3];
+  const float (*dir)[3];
+  float radius;
+  BVHTreeRayHit *hits;
+  BVHTree_RayCastCallback callback;
+  void *userdata;
+  int flag;
+} BVHRayCastBatchData;
+
+static void bvhtree_ray_cast_batch_task_cb(void *__restrict userdata,
+                                           const int i,
+                                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const BVHRayCastBatchData *batch = userdata;
+  BLI_bvhtree_ray_cast_ex(batch->tree,
+                          batch->co[i],
+                          batch->dir[i],
+                          batch->radius,
+                          &batch->hits[i],
+                          batch->callback,
+                          batch->userdata,
+                          batch->flag);
+}
+
+/**
+ * Cast many rays at once, using multiple threads for large batches.
+ * Every ray behaves like a call to #BLI_bvhtree_ray_cast_ex, \a hits must be initialized
+ * by the caller (index & distance), one for every ray.
+ *
+ * Consecutive rays are handled by the same thread, so rays that are coherent
+ * (e.g. neighboring pixels) traverse the same nodes while they are in the cache.
+ *
+ * \note \a callback must be thread-safe.
+ */
+void BLI_bvhtree_ray_cast_batch(BVHTree *tree,
+                                const float (*co)[3],
+                                const float (*dir)[3],
+                                const int rays_num,
+                                float radius,
+                                BVHTreeRayHit *hits,
+                                BVHTree_RayCastCallback callback,
+                                void *userdata,
+                                int flag)
+{
+  BVHRayCastBatchData batch = {
+      .tree = tree,
+      .co = co,
+      .dir = dir,
+      .radius = radius,
+      .hits = hits,
+      .callback = callback,
+      .userdata = userdata,
+      .flag = flag,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (rays_num > KDOPBVH_THREAD_RAY_THRESHOLD);
+  settings.min_iter_per_thread = KDOPBVH_THREAD_RAY_THRESHOLD;
+  BLI_task_parallel_range(0, rays_num, &batch, bvhtree_ray_cast_batch_task_cb, &settings);
+}
+
 float BLI_bvhtree_bb_raycast(const float bv[6],
                              const float light_start[3],
                              const float light_end[3],
@@ -22,6 +22,7 @@
 
 #include "BLI_kdtree_impl.h"
 #include "BLI_math.h"
+#include "BLI_task.h"
 #include "BLI_strict_flags.h"
 #include "BLI_utildefines.h"
 
@@ -837,6 +838,84 @@ struct DeDuplicateParams {
   int search;
 };
 
+/**
+ * Use a parallel pre-pass for trees with more nodes than this,
+ * see #deduplicate_has_neighbor_recursive.
+ */
+#define KD_DEDUPLICATE_THREAD_THRESHOLD 10000
+
+struct DeDuplicateNeighborParams {
+  const KDTreeNode *nodes;
+  uint root;
+  float range;
+  float range_sq;
+  /** Node aligned, true when there is another node in range. */
+  bool *has_neighbor;
+};
+
+/**
+ * Check if there is any other node in range of the search coordinate.
+ * Only reads the tree, so it can run for many nodes in parallel.
+ */
+static bool deduplicate_has_neighbor_recursive(const struct DeDuplicateNeighborParams *p,
+                                               uint i,
+                                               const float search_co[KD_DIMS],
+                                               const int search)
+{
+  const KDTreeNode *node = &p->nodes[i];
+  if (search_co[node->d] + p->range <= node->co[node->d]) {
+    return (node->left != KD_NODE_UNSET) &&
+           deduplicate_has_neighbor_recursive(p, node->left, search_co, search);
+  }
+  if (search_co[node->d] - p->range >= node->co[node->d]) {
+    return (node->right != KD_NODE_UNSET) &&
+           deduplicate_has_neighbor_recursive(p, node->right, search_co, search);
+  }
+  if ((search != node->index) && (len_squared_vnvn(node->co, search_co) <= p->range_sq)) {
+    return true;
+  }
+  return ((node->left != KD_NODE_UNSET) &&
+          deduplicate_has_neighbor_recursive(p, node->left, search_co, search)) ||
+         ((node->right != KD_NODE_UNSET) &&
+          deduplicate_has_neighbor_recursive(p, node->right, search_co, search));
+}
+
+static void deduplicate_has_neighbor_task_cb(void *__restrict userdata,
+                                             const int i,
+                                             const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const struct DeDuplicateNeighborParams *p = userdata;
+  const KDTreeNode *node = &p->nodes[i];
+  p->has_neighbor[i] = deduplicate_has_neighbor_recursive(p, p->root, node->co, node->index);
+}
+
+/**
+ * Nodes without any other node in range can't find duplicates, so searching from them can be
+ * skipped. Finding them is independent for every node, unlike the search for duplicates
+ * (which depends on the duplicates found before). For large trees where most nodes have no
+ * duplicates, this moves most of the work to multiple threads without changing the result.
+ */
+static bool *deduplicate_has_neighbor_calc(const KDTree *tree, const float range)
+{
+  if (tree->nodes_len <= KD_DEDUPLICATE_THREAD_THRESHOLD) {
+    return NULL;
+  }
+  struct DeDuplicateNeighborParams p = {
+      .nodes = tree->nodes,
+      .root = tree->root,
+      .range = range,
+      .range_sq = square_f(range),
+      .has_neighbor = MEM_mallocN(sizeof(bool) * tree->nodes_len, __func__),
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+  BLI_task_parallel_range(
+      0, (int)tree->nodes_len, &p, deduplicate_has_neighbor_task_cb, &settings);
+  return p.has_neighbor;
+}
+
 static void deduplicate_recursive(const struct DeDuplicateParams *p, uint i)
 {
   const KDTreeNode *node = &p->nodes[i];
@@ -898,11 +977,16 @@ int BLI_kdtree_nd_(calc_duplicates_fast)(const KDTree *tree,
       .duplicates_found = &found,
   };
 
+  bool *has_neighbor = deduplicate_has_neighbor_calc(tree, range);
+
   if (use_index_order) {
     uint *order = kdtree_order(tree);
     for (uint i = 0; i < tree->nodes_len; i++) {
       const uint node_index = order[i];
       const int index = (int)i;
+      if (has_neighbor && !has_neighbor[node_index]) {
+        continue;
+      }
       if (ELEM(duplicates[index], -1, index)) {
         p.search = index;
         copy_vn_vn(p.search_co, tree->nodes[node_index].co);
@@ -920,6 +1004,9 @@ int BLI_kdtree_nd_(calc_duplicates_fast)(const KDTree *tree,
     for (uint i = 0; i < tree->nodes_len; i++) {
       const uint node_index = i;
       const int index = p.nodes[node_index].index;
+      if (has_neighbor && !has_neighbor[node_index]) {
+        continue;
+      }
       if (ELEM(duplicates[index], -1, index)) {
         p.search = index;
         copy_vn_vn(p.search_co, tree->nodes[node_index].co);
@@ -932,6 +1019,7 @@ int BLI_kdtree_nd_(calc_duplicates_fast)(const KDTree *tree,
       }
     }
   }
+  MEM_SAFE_FREE(has_neighbor);
   return found;
 }
 
@@ -41,6 +41,7 @@
 #  include "BLI_set.hh"
 #  include "BLI_span.hh"
 #  include "BLI_stack.hh"
+#  include "BLI_task.hh"
 #  include "BLI_vector.hh"
 #  include "BLI_vector_set.hh"
 
@@ -2519,69 +2520,79 @@ static IMesh raycast_boolean(const IMesh &tm,
   }
   BLI_bvhtree_balance(tree);
 
-  Vector<Face *> out_faces;
-  out_faces.reserve(tm.face_size());
-  Array<float> in_shape(nshapes, 0);
-  Array<int> winding(nshapes, 0);
-  for (int t : tm.face_index_range()) {
-    Face &tri = *tm.face(t);
-    int shape = shape_fn(tri.orig);
-    if (dbg_level > 0) {
-      std::cout << "process triangle " << t << " = " << &tri << "\n";
-      std::cout << "shape = " << shape << "\n";
-    }
-    test_tri_inside_shapes(tm, shape_fn, nshapes, t, tree, in_shape);
-    for (int other_shape = 0; other_shape < nshapes; ++other_shape) {
-      if (other_shape == shape) {
-        continue;
-      }
-      /* The in_shape array has a confidence value for "insideness".
-       * For most operations, even a hint of being inside
-       * gives good results, but when shape is a cutter in a Difference
-       * operation, we want to be pretty sure that the point is inside other_shape.
-       * E.g., T75827.
-       */
-      bool need_high_confidence = (op == BoolOpType::Difference) && (shape != 0);
-      bool inside = in_shape[other_shape] >= (need_high_confidence ? 0.5f : 0.1f);
+  /* The tests of the triangles are independent, so they can run in parallel.
+   * The output is built afterwards, to keep the order of the faces deterministic. */
+  enum { TRI_REMOVE = 0, TRI_KEEP = 1, TRI_FLIP = 2 };
+  Array<uint8_t> tri_result(tm.face_size());
+  parallel_for(tm.face_index_range(), 256, [&](const IndexRange range) {
+    Array<float> in_shape(nshapes, 0);
+    Array<int> winding(nshapes, 0);
+    for (int t : range) {
+      Face &tri = *tm.face(t);
+      int shape = shape_fn(tri.orig);
       if (dbg_level > 0) {
-        std::cout << "test point is " << (inside ? "inside" : "outside") << " other_shape "
-                  << other_shape << "\n";
-      }
-      winding[other_shape] = inside;
-    }
-    /* Find out the "in the output volume" flag for each of the cases of winding[shape] == 0
-     * and winding[shape] == 1. If the flags are different, this patch should be in the output.
-     * Also, if this is a Difference and the shape isn't the first one, need to flip the normals.
-     */
-    winding[shape] = 0;
-    bool in_output_volume_0 = apply_bool_op(op, winding);
-    winding[shape] = 1;
-    bool in_output_volume_1 = apply_bool_op(op, winding);
-    bool do_remove = in_output_volume_0 == in_output_volume_1;
-    bool do_flip = !do_remove && op == BoolOpType::Difference && shape != 0;
-    if (dbg_level > 0) {
-      std::cout << "winding = ";
-      for (int i = 0; i < nshapes; ++i) {
-        std::cout << winding[i] << " ";
+        std::cout << "process triangle " << t << " = " << &tri << "\n";
+        std::cout << "shape = " << shape << "\n";
       }
-      std::cout << "\niv0=" << in_output_volume_0 << ", iv1=" << in_output_volume_1 << "\n";
-      std::cout << "result for tri " << t << ": remove=" << do_remove << ", flip=" << do_flip
-                << "\n";
-    }
-    if (!do_remove) {
-      if (!do_flip) {
-        out_faces.append(&tri);
+      test_tri_inside_shapes(tm, shape_fn, nshapes, t, tree, in_shape);
+      for (int other_shape = 0; other_shape < nshapes; ++other_shape) {
+        if (other_shape == shape) {
+          continue;
+        }
+        /* The in_shape array has a confidence value for "insideness".
+         * For most operations, even a hint of being inside
+         * gives good results, but when shape is a cutter in a Difference
+         * operation, we want to be pretty sure that the point is inside other_shape.
+         * E.g., T75827.
+         */
+        bool need_high_confidence = (op == BoolOpType::Difference) && (shape != 0);
+        bool inside = in_shape[other_shape] >= (need_high_confidence ? 0.5f : 0.1f);
+        if (dbg_level > 0) {
+          std::cout << "test point is " << (inside ? "inside" : "outside") << " other_shape "
+                    << other_shape << "\n";
+        }
+        winding[other_shape] = inside;
       }
-      else {
-        /* We need flipped version of tri. */
-        Array<const Vert *> flipped_vs = {tri[0], tri[2], tri[1]};
-        Array<int> flipped_e_origs = {tri.edge_orig[2], tri.edge_orig[1], tri.edge_orig[0]};
-        Array<bool> flipped_is_intersect = {
-            tri.is_intersect[2], tri.is_intersect[1], tri.is_intersect[0]};
-        Face *flipped_f = arena->add_face(
-            flipped_vs, tri.orig, flipped_e_origs, flipped_is_intersect);
-        out_faces.append(flipped_f);
+      /* Find out the "in the output volume" flag for each of the cases of winding[shape] == 0
+       * and winding[shape] == 1. If the flags are different, this patch should be in the
+       * output. Also, if this is a Difference and the shape isn't the first one, need to flip
+       * the normals.
+       */
+      winding[shape] = 0;
+      bool in_output_volume_0 = apply_bool_op(op, winding);
+      winding[shape] = 1;
+      bool in_output_volume_1 = apply_bool_op(op, winding);
+      bool do_remove = in_output_volume_0 == in_output_volume_1;
+      bool do_flip = !do_remove && op == BoolOpType::Difference && shape != 0;
+      if (dbg_level > 0) {
+        std::cout << "winding = ";
+        for (int i = 0; i < nshapes; ++i) {
+          std::cout << winding[i] << " ";
+        }
+        std::cout << "\niv0=" << in_output_volume_0 << ", iv1=" << in_output_volume_1 << "\n";
+        std::cout << "result for tri " << t << ": remove=" << do_remove << ", flip=" << do_flip
+                  << "\n";
       }
+      tri_result[t] = do_remove ? TRI_REMOVE : (do_flip ? TRI_FLIP : TRI_KEEP);
+    }
+  });
+
+  Vector<Face *> out_faces;
+  out_faces.reserve(tm.face_size());
+  for (int t : tm.face_index_range()) {
+    Face &tri = *tm.face(t);
+    if (tri_result[t] == TRI_KEEP) {
+      out_faces.append(&tri);
+    }
+    else if (tri_result[t] == TRI_FLIP) {
+      /* We need flipped version of tri. */
+      Array<const Vert *> flipped_vs = {tri[0], tri[2], tri[1]};
+      Array<int> flipped_e_origs = {tri.edge_orig[2], tri.edge_orig[1], tri.edge_orig[0]};
+      Array<bool> flipped_is_intersect = {
+          tri.is_intersect[2], tri.is_intersect[1], tri.is_intersect[0]};
+      Face *flipped_f = arena->add_face(
+          flipped_vs, tri.orig, flipped_e_origs, flipped_is_intersect);
+      out_faces.append(flipped_f);
     }
   }
   BLI_bvhtree_free(tree);
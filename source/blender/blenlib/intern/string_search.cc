@@ -22,6 +22,7 @@
 #include "BLI_string_ref.hh"
 #include "BLI_string_search.h"
 #include "BLI_string_utf8.h"
+#include "BLI_task.hh"
 #include "BLI_timeit.hh"
 
 namespace blender::string_search {
@@ -433,11 +434,19 @@ int BLI_string_search_query(StringSearch *search, const char *query, void ***r_d
   Vector<StringRef, 64> query_words;
   string_search::extract_normalized_words(query, allocator, query_words);
 
-  /* Compute score of every result. */
+  /* Compute score of every result. Items are independent, so large searches (e.g. all data-blocks
+   * of a file) are scored in parallel. */
+  Array<int> scores(search->items.size());
+  parallel_for(search->items.index_range(), 256, [&](const IndexRange range) {
+    for (const int result_index : range) {
+      scores[result_index] = string_search::score_query_against_words(
+          query_words, search->items[result_index].normalized_words);
+    }
+  });
+
   MultiValueMap<int, int> result_indices_by_score;
-  for (const int result_index : search->items.index_range()) {
-    const int score = string_search::score_query_against_words(
-        query_words, search->items[result_index].normalized_words);
+  for (const int result_index : scores.index_range()) {
+    const int score = scores[result_index];
     if (score >= 0) {
       result_indices_by_score.add(score, result_index);
     }
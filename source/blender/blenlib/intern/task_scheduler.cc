@@ -25,6 +25,10 @@
 #include "BLI_task.h"
 #include "BLI_threads.h"
 
+#include "numaapi.h"
+
+#include <memory>
+
 #ifdef WITH_TBB
 /* Need to include at least one header to get the version define. */
 #  include <tbb/blocked_range.h>
@@ -32,6 +36,12 @@
 #    include <tbb/global_control.h>
 #    define WITH_TBB_GLOBAL_CONTROL
 #  endif
+#  if TBB_INTERFACE_VERSION_MAJOR >= 12
+#    include <tbb/task_arena.h>
+#    include <tbb/task_group.h>
+#    include <tbb/task_scheduler_observer.h>
+#    define WITH_TBB_NUMA_ARENAS
+#  endif
 #endif
 
 /* Task Scheduler */
@@ -41,6 +51,79 @@ static int task_scheduler_num_threads = 1;
 static tbb::global_control *task_scheduler_global_control = nullptr;
 #endif
 
+#ifdef WITH_TBB_NUMA_ARENAS
+/* Pins the worker threads joining an arena to its NUMA node. */
+class NUMANodeObserver : public tbb::task_scheduler_observer {
+  int node_;
+
+ public:
+  NUMANodeObserver(tbb::task_arena &arena, int node)
+      : tbb::task_scheduler_observer(arena), node_(node)
+  {
+    observe(true);
+  }
+
+  ~NUMANodeObserver() override
+  {
+    observe(false);
+  }
+
+  void on_scheduler_entry(bool UNUSED(is_worker)) override
+  {
+    numaAPI_RunThreadOnNode(node_);
+  }
+};
+
+struct NUMANodeArena {
+  tbb::task_arena arena;
+  NUMANodeObserver *observer;
+
+  MEM_CXX_CLASS_ALLOC_FUNCS("NUMANodeArena")
+};
+
+/* One arena per NUMA node, only used on systems with multiple nodes. */
+static NUMANodeArena *task_scheduler_numa_arenas = nullptr;
+static int task_scheduler_numa_nodes_num = 1;
+
+static void task_scheduler_numa_init()
+{
+  if (numaAPI_Initialize() != NUMAAPI_SUCCESS) {
+    return;
+  }
+  const int nodes_num = numaAPI_GetNumNodes();
+  if (nodes_num < 2) {
+    return;
+  }
+  for (int node = 0; node < nodes_num; node++) {
+    if (!numaAPI_IsNodeAvailable(node)) {
+      /* Keep node indices matching the system ones, don't deal with holes. */
+      return;
+    }
+  }
+
+  task_scheduler_numa_arenas = new NUMANodeArena[nodes_num];
+  for (int node = 0; node < nodes_num; node++) {
+    NUMANodeArena &node_arena = task_scheduler_numa_arenas[node];
+    node_arena.arena.initialize(numaAPI_GetNumNodeProcessors(node));
+    node_arena.observer = OBJECT_GUARDED_NEW(NUMANodeObserver, node_arena.arena, node);
+  }
+  task_scheduler_numa_nodes_num = nodes_num;
+}
+
+static void task_scheduler_numa_exit()
+{
+  if (task_scheduler_numa_arenas == nullptr) {
+    return;
+  }
+  for (int node = 0; node < task_scheduler_numa_nodes_num; node++) {
+    OBJECT_GUARDED_DELETE(task_scheduler_numa_arenas[node].observer, NUMANodeObserver);
+  }
+  delete[] task_scheduler_numa_arenas;
+  task_scheduler_numa_arenas = nullptr;
+  task_scheduler_numa_nodes_num = 1;
+}
+#endif
+
 void BLI_task_scheduler_init()
 {
 #ifdef WITH_TBB_GLOBAL_CONTROL
@@ -59,6 +142,10 @@ void BLI_task_scheduler_init()
      * Ideally such code should be rewritten not to use the number of threads
      * at all. */
     task_scheduler_num_threads = BLI_system_thread_count();
+#  ifdef WITH_TBB_NUMA_ARENAS
+    /* Per node arenas would ignore the thread count override, only use them without it. */
+    task_scheduler_numa_init();
+#  endif
   }
 #else
   task_scheduler_num_threads = BLI_system_thread_count();
@@ -67,6 +154,9 @@ void BLI_task_scheduler_init()
 
 void BLI_task_scheduler_exit()
 {
+#ifdef WITH_TBB_NUMA_ARENAS
+  task_scheduler_numa_exit();
+#endif
 #ifdef WITH_TBB_GLOBAL_CONTROL
   OBJECT_GUARDED_DELETE(task_scheduler_global_control, tbb::global_control);
 #endif
@@ -76,3 +166,58 @@ int BLI_task_scheduler_num_threads()
 {
   return task_scheduler_num_threads;
 }
+
+/* NUMA Nodes */
+
+/**
+ * Number of NUMA nodes tasks can be bound to with #BLI_task_scheduler_numa_run
+ * and #BLI_task_scheduler_numa_run_all. This is 1 on systems without NUMA support.
+ */
+int BLI_task_scheduler_numa_nodes_num()
+{
+#ifdef WITH_TBB_NUMA_ARENAS
+  return task_scheduler_numa_nodes_num;
+#else
+  return 1;
+#endif
+}
+
+/**
+ * Run \a func in the task arena of \a node and wait for it to finish. Parallel loops and tasks
+ * started from \a func only run on threads of that NUMA node, so memory they first touch gets
+ * allocated on the node too.
+ */
+void BLI_task_scheduler_numa_run(int node, void (*func)(int node, void *userdata), void *userdata)
+{
+#ifdef WITH_TBB_NUMA_ARENAS
+  if (task_scheduler_numa_arenas != nullptr) {
+    BLI_assert(node >= 0 && node < task_scheduler_numa_nodes_num);
+    task_scheduler_numa_arenas[node].arena.execute([&]() { func(node, userdata); });
+    return;
+  }
+#endif
+  func(node, userdata);
+}
+
+/**
+ * Run \a func once for every NUMA node, concurrently, each in the task arena of its node.
+ * Waits for all of them to finish.
+ */
+void BLI_task_scheduler_numa_run_all(void (*func)(int node, void *userdata), void *userdata)
+{
+#ifdef WITH_TBB_NUMA_ARENAS
+  if (task_scheduler_numa_arenas != nullptr) {
+    const int nodes_num = task_scheduler_numa_nodes_num;
+    std::unique_ptr<tbb::task_group[]> groups(new tbb::task_group[nodes_num]);
+    for (int node = 0; node < nodes_num; node++) {
+      task_scheduler_numa_arenas[node].arena.execute(
+          [&, node]() { groups[node].run([=]() { func(node, userdata); }); });
+    }
+    for (int node = 0; node < nodes_num; node++) {
+      task_scheduler_numa_arenas[node].arena.execute([&, node]() { groups[node].wait(); });
+    }
+    return;
+  }
+#endif
+  func(0, userdata);
+}
@@ -0,0 +1,154 @@
+/* Apache License, Version 2.0 */
+
+#include <atomic>
+#include <mutex>
+
+#include "BLI_concurrent_map.hh"
+#include "BLI_task.hh"
+#include "BLI_timeit.hh"
+#include "BLI_vector.hh"
+#include "testing/testing.h"
+
+namespace blender::tests {
+
+TEST(concurrent_map, DefaultConstructor)
+{
+  ConcurrentMap<int, float> map;
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_TRUE(map.is_empty());
+}
+
+TEST(concurrent_map, AddLookupRemove)
+{
+  ConcurrentMap<int, float> map;
+  EXPECT_TRUE(map.add(1, 2.0f));
+  EXPECT_FALSE(map.add(1, 3.0f));
+  map.add_new(5, 6.0f);
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_TRUE(map.contains(1));
+  EXPECT_FALSE(map.contains(2));
+  EXPECT_EQ(map.lookup_default(1, 0.0f), 2.0f);
+  EXPECT_EQ(map.lookup_default(2, -1.0f), -1.0f);
+
+  EXPECT_FALSE(map.add_overwrite(1, 4.0f));
+  EXPECT_EQ(map.lookup_default(1, 0.0f), 4.0f);
+
+  EXPECT_TRUE(map.remove(1));
+  EXPECT_FALSE(map.remove(1));
+  EXPECT_EQ(map.pop(5), 6.0f);
+  EXPECT_FALSE(map.pop_try(5).has_value());
+  EXPECT_TRUE(map.is_empty());
+}
+
+TEST(concurrent_map, ForeachItem)
+{
+  ConcurrentMap<int, int> map;
+  for (int i = 0; i < 1000; i++) {
+    map.add_new(i, i);
+  }
+  map.foreach_item([](const int key, int &value) { value = key * 2; });
+  int sum = 0;
+  map.foreach_item([&](const int key, const int value) {
+    EXPECT_EQ(value, key * 2);
+    sum += key;
+  });
+  EXPECT_EQ(sum, 999 * 1000 / 2);
+
+  map.clear();
+  EXPECT_TRUE(map.is_empty());
+}
+
+TEST(concurrent_map, MoveOnlyValue)
+{
+  ConcurrentMap<int, std::unique_ptr<int>> map;
+  map.add_new(1, std::make_unique<int>(3));
+  std::unique_ptr<int> value = map.pop(1);
+  EXPECT_EQ(*value, 3);
+}
+
+TEST(concurrent_map, ParallelAdd)
+{
+  ConcurrentMap<int, int> map;
+  parallel_for(IndexRange(100000), 256, [&](const IndexRange range) {
+    for (const int i : range) {
+      map.add_new(i, i * 3);
+    }
+  });
+  EXPECT_EQ(map.size(), 100000);
+  for (int i = 0; i < 100000; i++) {
+    EXPECT_EQ(map.lookup_default(i, -1), i * 3);
+  }
+}
+
+TEST(concurrent_map, ParallelLookupOrAddCreatesOnce)
+{
+  ConcurrentMap<int, int> map;
+  std::atomic<int> created = 0;
+  parallel_for(IndexRange(100000), 64, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int key = i % 100;
+      const int value = map.lookup_or_add_cb(key, [&]() {
+        created++;
+        return key + 1;
+      });
+      EXPECT_EQ(value, key + 1);
+    }
+  });
+  EXPECT_EQ(created, 100);
+  EXPECT_EQ(map.size(), 100);
+}
+
+/**
+ * Set this to 1 to activate the benchmark. It is disabled by default, because it prints a lot.
+ */
+#if 0
+template<typename AddF, typename PopF>
+BLI_NOINLINE void benchmark_parallel(StringRef name, const int amount, AddF add, PopF pop)
+{
+  SCOPED_TIMER(name);
+  parallel_for(IndexRange(amount), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      add(i);
+    }
+  });
+  std::atomic<int64_t> sum = 0;
+  parallel_for(IndexRange(amount), 1024, [&](const IndexRange range) {
+    int64_t local_sum = 0;
+    for (const int i : range) {
+      local_sum += pop(i);
+    }
+    sum += local_sum;
+  });
+  /* Print the value for simple error checking and to avoid some compiler optimizations. */
+  std::cout << "Sum: " << sum << "\n";
+}
+
+TEST(concurrent_map, Benchmark)
+{
+  for (int i = 0; i < 3; i++) {
+    Map<int, int> map;
+    std::mutex mutex;
+    benchmark_parallel(
+        "Map with mutex",
+        1000000,
+        [&](const int i) {
+          std::lock_guard lock{mutex};
+          map.add_new(i, i);
+        },
+        [&](const int i) {
+          std::lock_guard lock{mutex};
+          return map.pop(i);
+        });
+
+    ConcurrentMap<int, int> concurrent_map;
+    benchmark_parallel(
+        "ConcurrentMap ",
+        1000000,
+        [&](const int i) { concurrent_map.add_new(i, i); },
+        [&](const int i) { return concurrent_map.pop(i); });
+  }
+}
+
+#endif /* Benchmark */
+
+}  // namespace blender::tests
@@ -132,3 +132,129 @@ TEST(kdopbvh, OptimalFindNearest_500)
 {
   find_nearest_points_test(500, 1.0, 1000, 12, true);
 }
+
+static bool overlap_self_ordered_callback(void * /*userdata*/,
+                                          int index_a,
+                                          int index_b,
+                                          int /*thread*/)
+{
+  return index_a < index_b;
+}
+
+static int overlap_cmp(const void *a_v, const void *b_v)
+{
+  const BVHTreeOverlap *a = (const BVHTreeOverlap *)a_v;
+  const BVHTreeOverlap *b = (const BVHTreeOverlap *)b_v;
+  if (a->indexA != b->indexA) {
+    return a->indexA < b->indexA ? -1 : 1;
+  }
+  if (a->indexB != b->indexB) {
+    return a->indexB < b->indexB ? -1 : 1;
+  }
+  return 0;
+}
+
+/**
+ * #BLI_bvhtree_overlap_self must find the same pairs as overlapping the tree with itself,
+ * only once each and with the lower index first.
+ */
+static void overlap_self_test(int points_len, float epsilon, int random_seed)
+{
+  struct RNG *rng = BLI_rng_new(random_seed);
+  BVHTree *tree = BLI_bvhtree_new(points_len, epsilon, 4, 26);
+
+  for (int i = 0; i < points_len; i++) {
+    float co[3];
+    rng_v3_round(co, 3, rng, 1000, 1.0f);
+    BLI_bvhtree_insert(tree, i, co, 1);
+  }
+  BLI_bvhtree_balance(tree);
+
+  uint overlap_len, overlap_self_len;
+  BVHTreeOverlap *overlap = BLI_bvhtree_overlap(
+      tree, tree, &overlap_len, overlap_self_ordered_callback, nullptr);
+  BVHTreeOverlap *overlap_self = BLI_bvhtree_overlap_self(
+      tree, &overlap_self_len, nullptr, nullptr);
+
+  EXPECT_EQ(overlap_len, overlap_self_len);
+  if (overlap_len == overlap_self_len && overlap_len != 0) {
+    qsort(overlap, overlap_len, sizeof(*overlap), overlap_cmp);
+    qsort(overlap_self, overlap_self_len, sizeof(*overlap_self), overlap_cmp);
+    for (uint i = 0; i < overlap_len; i++) {
+      EXPECT_EQ(overlap[i].indexA, overlap_self[i].indexA);
+      EXPECT_EQ(overlap[i].indexB, overlap_self[i].indexB);
+    }
+  }
+
+  MEM_SAFE_FREE(overlap);
+  MEM_SAFE_FREE(overlap_self);
+  BLI_bvhtree_free(tree);
+  BLI_rng_free(rng);
+}
+
+TEST(kdopbvh, OverlapSelf_1)
+{
+  overlap_self_test(1, 0.1f, 1234);
+}
+TEST(kdopbvh, OverlapSelf_500)
+{
+  overlap_self_test(500, 0.05f, 12);
+}
+TEST(kdopbvh, OverlapSelf_5000)
+{
+  overlap_self_test(5000, 0.02f, 123);
+}
+
+static void ray_cast_batch_test(int points_len, int rays_len, int random_seed)
+{
+  struct RNG *rng = BLI_rng_new(random_seed);
+  BVHTree *tree = BLI_bvhtree_new(points_len, 0.01f, 4, 6);
+
+  float(*points)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * points_len, __func__);
+  for (int i = 0; i < points_len; i++) {
+    rng_v3_round(points[i], 3, rng, 1000, 1.0f);
+    BLI_bvhtree_insert(tree, i, points[i], 1);
+  }
+  BLI_bvhtree_balance(tree);
+
+  float(*ray_co)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * rays_len, __func__);
+  float(*ray_dir)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * rays_len, __func__);
+  BVHTreeRayHit *hits = (BVHTreeRayHit *)MEM_mallocN(sizeof(*hits) * rays_len, __func__);
+  for (int i = 0; i < rays_len; i++) {
+    rng_v3_round(ray_co[i], 3, rng, 1000, 2.0f);
+    /* Aim at a point, so that most rays hit something. */
+    sub_v3_v3v3(ray_dir[i], points[i % points_len], ray_co[i]);
+    normalize_v3(ray_dir[i]);
+    hits[i].index = -1;
+    hits[i].dist = BVH_RAYCAST_DIST_MAX;
+  }
+
+  BLI_bvhtree_ray_cast_batch(
+      tree, ray_co, ray_dir, rays_len, 0.0f, hits, nullptr, nullptr, BVH_RAYCAST_DEFAULT);
+
+  for (int i = 0; i < rays_len; i++) {
+    BVHTreeRayHit hit;
+    hit.index = -1;
+    hit.dist = BVH_RAYCAST_DIST_MAX;
+    BLI_bvhtree_ray_cast(tree, ray_co[i], ray_dir[i], 0.0f, &hit, nullptr, nullptr);
+    EXPECT_NE(hits[i].index, -1);
+    EXPECT_EQ(hits[i].index, hit.index);
+    EXPECT_EQ(hits[i].dist, hit.dist);
+  }
+
+  BLI_bvhtree_free(tree);
+  BLI_rng_free(rng);
+  MEM_freeN(points);
+  MEM_freeN(ray_co);
+  MEM_freeN(ray_dir);
+  MEM_freeN(hits);
+}
+
+TEST(kdopbvh, RayCastBatch_1)
+{
+  ray_cast_batch_test(1, 1, 1234);
+}
+TEST(kdopbvh, RayCastBatch_5000)
+{
+  ray_cast_batch_test(500, 5000, 12);
+}
@@ -0,0 +1,66 @@
+/* Apache License, Version 2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_rand.hh"
+#include "BLI_sort.hh"
+#include "BLI_timeit.hh"
+#include "BLI_vector.hh"
+
+namespace blender::tests {
+
+TEST(sort, ParallelSort)
+{
+  RandomNumberGenerator rng(0);
+  Vector<int> values;
+  for (int i = 0; i < 100000; i++) {
+    values.append(rng.get_int32(1000));
+  }
+  Vector<int> expected = values;
+  std::sort(expected.begin(), expected.end());
+
+  parallel_sort(values.begin(), values.end());
+  EXPECT_EQ_ARRAY(values.data(), expected.data(), values.size());
+}
+
+TEST(sort, ParallelSortCompare)
+{
+  RandomNumberGenerator rng(0);
+  Vector<float> values;
+  for (int i = 0; i < 100000; i++) {
+    values.append(rng.get_float());
+  }
+  Vector<float> expected = values;
+  std::sort(expected.begin(), expected.end(), std::greater<>());
+
+  parallel_sort(values.begin(), values.end(), std::greater<>());
+  EXPECT_EQ_ARRAY(values.data(), expected.data(), values.size());
+}
+
+/**
+ * Set this to 1 to activate the benchmark. It is disabled by default, because it prints a lot.
+ */
+#if 0
+TEST(sort, Benchmark)
+{
+  RandomNumberGenerator rng(0);
+  Vector<int> values;
+  for (int i = 0; i < 10000000; i++) {
+    values.append(rng.get_int32());
+  }
+  for (int i = 0; i < 3; i++) {
+    Vector<int> values_copy = values;
+    {
+      SCOPED_TIMER("std::sort");
+      std::sort(values_copy.begin(), values_copy.end());
+    }
+    values_copy = values;
+    {
+      SCOPED_TIMER("parallel_sort");
+      parallel_sort(values_copy.begin(), values_copy.end());
+    }
+  }
+}
+#endif /* Benchmark */
+
+}  // namespace blender::tests
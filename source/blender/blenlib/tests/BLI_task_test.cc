@@ -12,6 +12,8 @@
 #include "BLI_listbase.h"
 #include "BLI_mempool.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #define NUM_ITEMS 10000
 
@@ -181,3 +183,27 @@ TEST(task, ListBaseIter)
   MEM_freeN(items_buffer);
   BLI_threadapi_exit();
 }
+
+TEST(task, ParallelPrefixSum)
+{
+  blender::Vector<int> values;
+  for (int i = 0; i < 100000; i++) {
+    values.append(i % 7);
+  }
+  blender::Vector<int> expected_offsets;
+  int expected_sum = 0;
+  for (const int value : values) {
+    expected_offsets.append(expected_sum);
+    expected_sum += value;
+  }
+
+  const int sum = blender::parallel_prefix_sum(values.as_mutable_span(), 1024);
+  EXPECT_EQ(sum, expected_sum);
+  EXPECT_EQ_ARRAY(values.data(), expected_offsets.data(), values.size());
+}
+
+TEST(task, ParallelPrefixSumEmpty)
+{
+  blender::Vector<int> values;
+  EXPECT_EQ(blender::parallel_prefix_sum(values.as_mutable_span(), 1024), 0);
+}
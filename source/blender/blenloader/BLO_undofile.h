@@ -27,12 +27,13 @@
 struct GHash;
 struct Scene;
 
-typedef struct {
+typedef struct MemFileChunk {
   void *next, *prev;
   const char *buf;
   /** Size in bytes. */
   size_t size;
-  /** When true, this chunk doesn't own the memory, it's shared with a previous #MemFileChunk */
+  /** When true, this chunk is identical to the matching #MemFileChunk of the previous step.
+   * Buffers themselves are reference counted and may be shared by any step. */
   bool is_identical;
   /** When true, this chunk is also identical to the one in the next step (used by undo code to
    * detect unchanged IDs).
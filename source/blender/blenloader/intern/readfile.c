@@ -69,6 +69,7 @@
 #include "BLI_memarena.h"
 #include "BLI_mempool.h"
 #include "BLI_mmap.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 
 #include "BLT_translation.h"
@@ -199,6 +200,10 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname);
 static BHead *find_bhead_from_code_name(FileData *fd, const short idcode, const char *name);
 static BHead *find_bhead_from_idname(FileData *fd, const char *idname);
 static bool library_link_idcode_needs_tag_check(const short idcode, const int flag);
+static ssize_t fd_read_from_memfile_ex(FileData *filedata,
+                                       void *buffer,
+                                       size_t size,
+                                       bool *r_is_memchunck_identical);
 
 typedef struct BHeadN {
   struct BHeadN *next, *prev;
@@ -822,6 +827,13 @@ static BHeadN *get_bhead(FileData *fd)
           new_bhead->has_data = false;
           new_bhead->is_memchunk_identical = false;
           new_bhead->bhead = bhead;
+          if (fd->memfile != NULL) {
+            /* Skip the data, but undo still needs to know whether it changed. */
+            const off64_t offset_backup = fd->file_offset;
+            fd_read_from_memfile_ex(
+                fd, NULL, (size_t)bhead.len, &new_bhead->is_memchunk_identical);
+            fd->file_offset = offset_backup;
+          }
           off64_t seek_new = fd->seek(fd, bhead.len, SEEK_CUR);
           if (seek_new == -1) {
             fd->is_eof = true;
@@ -962,6 +974,27 @@ static BHead *blo_bhead_read_full(FileData *fd, BHead *thisblock)
   }
   return &new_bhead_data->bhead;
 }
+
+/**
+ * When the file is memory-mapped, the data of a block that hasn't been read yet
+ * can be accessed in-place, so pages are only faulted in once they're actually used
+ * and the block never needs to be duplicated into a temporary allocation.
+ *
+ * \return NULL when the data can't be accessed this way (the caller must read it instead).
+ * Callers must check #BLI_mmap_any_io_error once they're done accessing the data.
+ */
+static const void *blo_bhead_data_mmap_pointer(FileData *fd, const BHead *thisblock)
+{
+  const BHeadN *new_bhead = BHEADN_FROM_BHEAD(thisblock);
+  BLI_assert(new_bhead->has_data == false && new_bhead->file_offset != 0);
+  if (fd->mmap_file == NULL || BLI_mmap_any_io_error(fd->mmap_file)) {
+    return NULL;
+  }
+  if ((size_t)new_bhead->file_offset + (size_t)thisblock->len > fd->buffersize) {
+    return NULL;
+  }
+  return POINTER_OFFSET(BLI_mmap_get_pointer(fd->mmap_file), new_bhead->file_offset);
+}
 #endif /* USE_BHEAD_READ_ON_DEMAND */
 
 /* Warning! Caller's responsibility to ensure given bhead **is** an ID one! */
@@ -1230,16 +1263,48 @@ static off64_t fd_seek_from_mmap(FileData *filedata, off64_t offset, int whence)
 
 /* MemFile reading. */
 
-static ssize_t fd_read_from_memfile(FileData *filedata,
-                                    void *buffer,
-                                    size_t size,
-                                    bool *r_is_memchunck_identical)
+/**
+ * Move the chunk cursor to the chunk containing the current read position.
+ * Reads are mostly sequential, or jump back a little to read delayed data,
+ * so walking from the last position is cheap.
+ */
+static MemFileChunk *fd_memfile_chunk_at_offset(FileData *filedata)
 {
-  static size_t seek = SIZE_MAX; /* the current position */
-  static size_t offset = 0;      /* size of previous chunks */
-  static MemFileChunk *chunk = NULL;
-  size_t chunkoffset, readsize, totread;
+  const size_t file_offset = (size_t)filedata->file_offset;
+  MemFileChunk *chunk = filedata->memfile_chunk;
+  size_t chunk_offset = filedata->memfile_chunk_offset;
+
+  if (chunk == NULL || file_offset < chunk_offset) {
+    if (chunk == NULL || file_offset < chunk_offset / 2) {
+      chunk = filedata->memfile->chunks.first;
+      chunk_offset = 0;
+    }
+    else {
+      while (file_offset < chunk_offset) {
+        chunk = chunk->prev;
+        chunk_offset -= chunk->size;
+      }
+    }
+  }
+  while (chunk != NULL && file_offset >= chunk_offset + chunk->size) {
+    chunk_offset += chunk->size;
+    chunk = chunk->next;
+  }
 
+  filedata->memfile_chunk = chunk;
+  filedata->memfile_chunk_offset = chunk_offset;
+  return chunk;
+}
+
+/**
+ * \param buffer: When NULL, the data isn't copied, only the position advances and
+ * \a r_is_memchunck_identical is computed.
+ */
+static ssize_t fd_read_from_memfile_ex(FileData *filedata,
+                                       void *buffer,
+                                       size_t size,
+                                       bool *r_is_memchunck_identical)
+{
   if (r_is_memchunck_identical != NULL) {
     *r_is_memchunck_identical = true;
   }
@@ -1248,66 +1313,67 @@ static ssize_t fd_read_from_memfile(FileData *filedata,
     return 0;
   }
 
-  if (seek != (size_t)filedata->file_offset) {
-    chunk = filedata->memfile->chunks.first;
-    seek = 0;
-
-    while (chunk) {
-      if (seek + chunk->size > (size_t)filedata->file_offset) {
-        break;
-      }
-      seek += chunk->size;
-      chunk = chunk->next;
+  size_t totread = 0;
+  do {
+    MemFileChunk *chunk = fd_memfile_chunk_at_offset(filedata);
+    /* debug, should never happen */
+    if (chunk == NULL) {
+      printf("illegal read, chunk zero\n");
+      return 0;
     }
-    offset = seek;
-    seek = (size_t)filedata->file_offset;
-  }
-
-  if (chunk) {
-    totread = 0;
 
-    do {
-      /* first check if it's on the end if current chunk */
-      if (seek - offset == chunk->size) {
-        offset += chunk->size;
-        chunk = chunk->next;
-      }
+    const size_t chunkoffset = (size_t)filedata->file_offset - filedata->memfile_chunk_offset;
+    /* data can be spread over multiple chunks, so clamp size
+     * to within this chunk, and then it will read further in
+     * the next chunk */
+    const size_t readsize = MIN2(size - totread, chunk->size - chunkoffset);
 
-      /* debug, should never happen */
-      if (chunk == NULL) {
-        printf("illegal read, chunk zero\n");
-        return 0;
-      }
+    if (buffer != NULL) {
+      memcpy(POINTER_OFFSET(buffer, totread), chunk->buf + chunkoffset, readsize);
+    }
+    totread += readsize;
+    filedata->file_offset += readsize;
+    if (r_is_memchunck_identical != NULL) {
+      /* `is_identical` of current chunk represents whether it changed compared to previous undo
+       * step. this is fine in redo case, but not in undo case, where we need an extra flag
+       * defined when saving the next (future) step after the one we want to restore, as we are
+       * supposed to 'come from' that future undo step, and not the one before current one. */
+      *r_is_memchunck_identical &= filedata->undo_direction == STEP_REDO ?
+                                       chunk->is_identical :
+                                       chunk->is_identical_future;
+    }
+  } while (totread < size);
 
-      chunkoffset = seek - offset;
-      readsize = size - totread;
+  return (ssize_t)totread;
+}
 
-      /* data can be spread over multiple chunks, so clamp size
-       * to within this chunk, and then it will read further in
-       * the next chunk */
-      if (chunkoffset + readsize > chunk->size) {
-        readsize = chunk->size - chunkoffset;
-      }
+static ssize_t fd_read_from_memfile(FileData *filedata,
+                                    void *buffer,
+                                    size_t size,
+                                    bool *r_is_memchunck_identical)
+{
+  return fd_read_from_memfile_ex(filedata, buffer, size, r_is_memchunck_identical);
+}
 
-      memcpy(POINTER_OFFSET(buffer, totread), chunk->buf + chunkoffset, readsize);
-      totread += readsize;
-      filedata->file_offset += readsize;
-      seek += readsize;
-      if (r_is_memchunck_identical != NULL) {
-        /* `is_identical` of current chunk represents whether it changed compared to previous undo
-         * step. this is fine in redo case, but not in undo case, where we need an extra flag
-         * defined when saving the next (future) step after the one we want to restore, as we are
-         * supposed to 'come from' that future undo step, and not the one before current one. */
-        *r_is_memchunck_identical &= filedata->undo_direction == STEP_REDO ?
-                                         chunk->is_identical :
-                                         chunk->is_identical_future;
-      }
-    } while (totread < size);
+static off64_t fd_seek_from_memfile(FileData *filedata, off64_t offset, int whence)
+{
+  off64_t new_pos;
+  if (whence == SEEK_CUR) {
+    new_pos = filedata->file_offset + offset;
+  }
+  else if (whence == SEEK_SET) {
+    new_pos = offset;
+  }
+  else {
+    return -1;
+  }
 
-    return (ssize_t)totread;
+  if (new_pos < 0 || new_pos > (off64_t)filedata->buffersize) {
+    return -1;
   }
 
-  return 0;
+  filedata->file_offset = new_pos;
+  return filedata->file_offset;
 }
 
 static FileData *filedata_new(void)
@@ -1566,6 +1632,13 @@ FileData *blo_filedata_from_memfile(MemFile *memfile,
   fd->read = fd_read_from_memfile;
   fd->flags |= FD_FLAGS_NOT_MY_BUFFER;
 
+  /* Delay reading data, so data of IDs that are reused from the current Main for undo never
+   * gets copied out of the memfile. */
+  fd->seek = fd_seek_from_memfile;
+  LISTBASE_FOREACH (MemFileChunk *, chunk, &memfile->chunks) {
+    fd->buffersize += chunk->size;
+  }
+
   return blo_decode_and_check(fd, reports);
 }
 
@@ -2151,6 +2224,77 @@ static void switch_endian_structs(const struct SDNA *filesdna, BHead *bhead)
   }
 }
 
+/**
+ * Arrays with at least this many elements are reconstructed from multiple threads.
+ * Below that the overhead of scheduling outweighs the gain.
+ */
+#define RECONSTRUCT_PARALLEL_BLOCKS_MIN 8192
+#define RECONSTRUCT_PARALLEL_CHUNK_SIZE 2048
+
+typedef struct ReconstructParallelData {
+  const struct DNA_ReconstructInfo *reconstruct_info;
+  int old_struct_nr, new_struct_nr;
+  int old_block_size, new_block_size;
+  int blocks;
+  const char *old_blocks;
+  char *new_blocks;
+} ReconstructParallelData;
+
+static void reconstruct_parallel_cb(void *__restrict userdata,
+                                    const int chunk_index,
+                                    const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const ReconstructParallelData *data = userdata;
+  const int block_start = chunk_index * RECONSTRUCT_PARALLEL_CHUNK_SIZE;
+  const int blocks = MIN2(RECONSTRUCT_PARALLEL_CHUNK_SIZE, data->blocks - block_start);
+
+  DNA_struct_reconstruct_blocks(data->reconstruct_info,
+                                data->old_struct_nr,
+                                data->new_struct_nr,
+                                blocks,
+                                data->old_blocks + (size_t)block_start * data->old_block_size,
+                                data->new_blocks + (size_t)block_start * data->new_block_size);
+}
+
+/**
+ * Wrapper around #DNA_struct_reconstruct which splits large arrays (vertices, loops, ...)
+ * into ranges that are converted in parallel. Every range writes to its own part of the
+ * result, so the output is identical to the single threaded conversion.
+ */
+static void *read_struct_reconstruct(FileData *fd, BHead *bh, const void *old_blocks)
+{
+  if (bh->nr < RECONSTRUCT_PARALLEL_BLOCKS_MIN) {
+    return DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, old_blocks);
+  }
+
+  const SDNA_Struct *old_struct = fd->filesdna->structs[bh->SDNAnr];
+  const int new_struct_nr = DNA_struct_find_nr(fd->memsdna,
+                                               fd->filesdna->types[old_struct->type]);
+  if (new_struct_nr == -1) {
+    return NULL;
+  }
+  const SDNA_Struct *new_struct = fd->memsdna->structs[new_struct_nr];
+
+  ReconstructParallelData data = {
+      .reconstruct_info = fd->reconstruct_info,
+      .old_struct_nr = bh->SDNAnr,
+      .new_struct_nr = new_struct_nr,
+      .old_block_size = fd->filesdna->types_size[old_struct->type],
+      .new_block_size = fd->memsdna->types_size[new_struct->type],
+      .blocks = bh->nr,
+      .old_blocks = old_blocks,
+  };
+  data.new_blocks = MEM_callocN((size_t)data.blocks * data.new_block_size, "reconstruct");
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  const int chunks = (data.blocks + RECONSTRUCT_PARALLEL_CHUNK_SIZE - 1) /
+                     RECONSTRUCT_PARALLEL_CHUNK_SIZE;
+  BLI_task_parallel_range(0, chunks, &data, reconstruct_parallel_cb, &settings);
+
+  return data.new_blocks;
+}
+
 static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
 {
   void *temp = NULL;
@@ -2178,6 +2322,18 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
       if (fd->compflags[bh->SDNAnr] == SDNA_CMP_NOT_EQUAL) {
 #ifdef USE_BHEAD_READ_ON_DEMAND
         if (BHEADN_FROM_BHEAD(bh)->has_data == false) {
+          /* Reconstruct straight from the mapped file when possible,
+           * this avoids an intermediate copy of the (potentially large) old data. */
+          const void *mmap_data = blo_bhead_data_mmap_pointer(fd, bh);
+          if (mmap_data != NULL) {
+            temp = read_struct_reconstruct(fd, bh, mmap_data);
+            if (UNLIKELY(BLI_mmap_any_io_error(fd->mmap_file))) {
+              fd->flags &= ~FD_FLAGS_FILE_OK;
+              MEM_SAFE_FREE(temp);
+            }
+            return temp;
+          }
+
           bh = blo_bhead_read_full(fd, bh);
           if (UNLIKELY(bh == NULL)) {
             fd->flags &= ~FD_FLAGS_FILE_OK;
@@ -2185,7 +2341,7 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
           }
         }
 #endif
-        temp = DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, (bh + 1));
+        temp = read_struct_reconstruct(fd, bh, (bh + 1));
       }
       else {
         /* SDNA_CMP_EQUAL */
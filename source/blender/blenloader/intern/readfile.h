@@ -38,6 +38,7 @@ struct BLOCacheStorage;
 struct IDNameLib_Map;
 struct Key;
 struct MemFile;
+struct MemFileChunk;
 struct Object;
 struct OldNewMap;
 struct ReportList;
@@ -89,6 +90,10 @@ typedef struct FileData {
   struct BLI_mmap_file *mmap_file;
   /** Variables needed for reading from memfile (undo). */
   struct MemFile *memfile;
+  /** Chunk containing the current read position (NULL when past the end),
+   * and the offset at which that chunk starts. */
+  struct MemFileChunk *memfile_chunk;
+  size_t memfile_chunk_offset;
   /** Whether we are undoing (< 0) or redoing (> 0), used to choose which 'unchanged' flag to use
    * to detect unchanged data from memfile. */
   int undo_direction; /* eUndoStepDir */
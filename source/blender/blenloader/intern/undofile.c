@@ -42,6 +42,7 @@
 
 #include "BLI_blenlib.h"
 #include "BLI_ghash.h"
+#include "BLI_hash_mm2a.h"
 
 #include "BLO_readfile.h"
 #include "BLO_undofile.h"
@@ -54,15 +55,112 @@
 
 /* **************** support for memory-write, for undo buffers *************** */
 
+/* -------------------------------------------------------------------- */
+/** \name Shared Chunk Storage
+ *
+ * Chunk buffers are stored once (by content) for all #MemFile steps, so identical data is
+ * shared even when it moved to a different position in the file between undo pushes.
+ * Each #MemFileChunk holds a reference to its buffer.
+ * \{ */
+
+typedef struct MemFileChunkBuffer {
+  /** Points to the data following this header (or the data being looked up). */
+  const char *data;
+  size_t size;
+  uint hash;
+  /** Number of #MemFileChunk using this buffer. */
+  uint users;
+} MemFileChunkBuffer;
+
+#define CHUNK_BUFFER_FROM_DATA(buf) \
+  ((MemFileChunkBuffer *)POINTER_OFFSET(buf, -(ptrdiff_t)sizeof(MemFileChunkBuffer)))
+
+/** All buffers used by any #MemFile, only allocated while there are users. */
+static GSet *memfile_chunk_buffers = NULL;
+
+static uint memfile_chunk_buffer_hash(const void *key)
+{
+  const MemFileChunkBuffer *buffer = key;
+  return buffer->hash;
+}
+
+static bool memfile_chunk_buffer_cmp(const void *a, const void *b)
+{
+  const MemFileChunkBuffer *buffer_a = a;
+  const MemFileChunkBuffer *buffer_b = b;
+  return (buffer_a->hash != buffer_b->hash) || (buffer_a->size != buffer_b->size) ||
+         (memcmp(buffer_a->data, buffer_b->data, buffer_a->size) != 0);
+}
+
+/**
+ * Return a buffer matching the given data, adding a user to it.
+ * \param r_is_new: Set when the buffer did not exist yet (memory was allocated).
+ */
+static const char *memfile_chunk_buffer_ensure(const char *buf, size_t size, bool *r_is_new)
+{
+  if (memfile_chunk_buffers == NULL) {
+    memfile_chunk_buffers = BLI_gset_new(
+        memfile_chunk_buffer_hash, memfile_chunk_buffer_cmp, __func__);
+  }
+
+  const MemFileChunkBuffer key = {
+      .data = buf,
+      .size = size,
+      .hash = BLI_hash_mm2((const uchar *)buf, size, 0),
+  };
+
+  void **key_p;
+  if (BLI_gset_ensure_p_ex(memfile_chunk_buffers, &key, &key_p)) {
+    MemFileChunkBuffer *buffer = *key_p;
+    buffer->users++;
+    *r_is_new = false;
+    return buffer->data;
+  }
+
+  MemFileChunkBuffer *buffer = MEM_mallocN(sizeof(*buffer) + size, "Chunk buffer");
+  char *data = (char *)(buffer + 1);
+  memcpy(data, buf, size);
+  buffer->data = data;
+  buffer->size = size;
+  buffer->hash = key.hash;
+  buffer->users = 1;
+  *key_p = buffer;
+
+  *r_is_new = true;
+  return data;
+}
+
+static void memfile_chunk_buffer_user_add(const char *data)
+{
+  CHUNK_BUFFER_FROM_DATA(data)->users++;
+}
+
+static void memfile_chunk_buffer_user_remove(const char *data)
+{
+  MemFileChunkBuffer *buffer = CHUNK_BUFFER_FROM_DATA(data);
+  BLI_assert(buffer->users > 0);
+  if (--buffer->users != 0) {
+    return;
+  }
+
+  BLI_gset_remove(memfile_chunk_buffers, buffer, NULL);
+  MEM_freeN(buffer);
+
+  if (BLI_gset_len(memfile_chunk_buffers) == 0) {
+    BLI_gset_free(memfile_chunk_buffers, NULL);
+    memfile_chunk_buffers = NULL;
+  }
+}
+
+/** \} */
+
 /* not memfile itself */
 void BLO_memfile_free(MemFile *memfile)
 {
   MemFileChunk *chunk;
 
   while ((chunk = BLI_pophead(&memfile->chunks))) {
-    if (chunk->is_identical == false) {
-      MEM_freeN((void *)chunk->buf);
-    }
+    memfile_chunk_buffer_user_remove(chunk->buf);
     MEM_freeN(chunk);
   }
   memfile->size = 0;
@@ -72,31 +170,25 @@ void BLO_memfile_free(MemFile *memfile)
 /* result is that 'first' is being freed */
 void BLO_memfile_merge(MemFile *first, MemFile *second)
 {
-  /* We use this mapping to store the memory buffers from second memfile chunks which are not owned
-   * by it (i.e. shared with some previous memory steps). */
+  /* Buffers are reference counted, so freeing 'first' keeps everything 'second' uses.
+   * Only the 'is_identical' state of 'second' needs updating: it now compares against the
+   * step before 'first', so chunks matching data that 'first' changed are not identical. */
   GHash *buffer_to_second_memchunk = BLI_ghash_new(
       BLI_ghashutil_ptrhash, BLI_ghashutil_ptrcmp, __func__);
 
-  /* First, detect all memchunks in second memfile that are not owned by it. */
   for (MemFileChunk *sc = second->chunks.first; sc != NULL; sc = sc->next) {
     if (sc->is_identical) {
       BLI_ghash_insert(buffer_to_second_memchunk, (void *)sc->buf, sc);
     }
   }
 
-  /* Now, check all chunks from first memfile (the one we are removing), and if a memchunk owned by
-   * it is also used by the second memfile, transfer the ownership. */
   for (MemFileChunk *fc = first->chunks.first; fc != NULL; fc = fc->next) {
     if (!fc->is_identical) {
       MemFileChunk *sc = BLI_ghash_lookup(buffer_to_second_memchunk, fc->buf);
       if (sc != NULL) {
         BLI_assert(sc->is_identical);
         sc->is_identical = false;
-        fc->is_identical = true;
       }
-      /* Note that if the second memfile does not use that chunk, we assume that the first one
-       * fully owns it without sharing it with any other memfile, and hence it should be freed with
-       * it. */
     }
   }
 
@@ -178,6 +270,7 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
         curchunk->buf = compchunk->buf;
         curchunk->is_identical = true;
         compchunk->is_identical_future = true;
+        memfile_chunk_buffer_user_add(curchunk->buf);
       }
     }
     *compchunk_step = compchunk->next;
@@ -185,10 +278,13 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
 
   /* not equal... */
   if (curchunk->buf == NULL) {
-    char *buf_new = MEM_mallocN(size, "Chunk buffer");
-    memcpy(buf_new, buf, size);
-    curchunk->buf = buf_new;
-    memfile->size += size;
+    /* The data may still be stored already, by any step and at any position. Note that
+     * 'is_identical' stays false then, since it's only about the previous step's layout. */
+    bool is_new;
+    curchunk->buf = memfile_chunk_buffer_ensure(buf, size, &is_new);
+    if (is_new) {
+      memfile->size += size;
+    }
   }
 }
 
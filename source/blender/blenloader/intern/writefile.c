@@ -101,6 +101,8 @@
 #include "BLI_bitmap.h"
 #include "BLI_blenlib.h"
 #include "BLI_mempool.h"
+#include "BLI_task.h"
+#include "BLI_threads.h"
 #include "MEM_guardedalloc.h" /* MEM_freeN */
 
 #include "BKE_blender_version.h"
@@ -162,7 +164,7 @@ struct WriteWrap {
   /* internal */
   union {
     int file_handle;
-    gzFile gz_handle;
+    struct ZlibWriter *zlib_writer;
   } _user_data;
 };
 
@@ -192,17 +194,121 @@ static size_t ww_write_none(WriteWrap *ww, const char *buf, size_t buf_len)
 }
 #undef FILE_HANDLE
 
-/* zlib */
-#define FILE_HANDLE(ww) (ww)->_user_data.gz_handle
+/* zlib
+ *
+ * The data is split into frames which are compressed on worker threads as independent
+ * gzip members, while the caller keeps producing data. Frames are written out in order,
+ * concatenated gzip members are a valid gzip stream so any zlib reader can open the file. */
+
+/** Amount of uncompressed data per gzip member. */
+#define ZLIB_FRAME_SIZE (1 << 20)
+
+typedef struct ZlibFrame {
+  struct ZlibFrame *next, *prev;
+  uchar *data_in;
+  size_t data_in_len;
+  uchar *data_out;
+  size_t data_out_len;
+  bool error;
+} ZlibFrame;
+
+typedef struct ZlibWriter {
+  int file_handle;
+  TaskPool *task_pool;
+  /** Frames being compressed, in file order. */
+  ListBase frames_pending;
+  int frames_pending_len;
+  /** When this many frames are pending, wait for them and write them out. */
+  int frames_pending_max;
+  /** Frame being filled, NULL until data is written. */
+  ZlibFrame *frame_active;
+  bool error;
+} ZlibWriter;
+
+#define ZLIB_WRITER(ww) ((ZlibWriter *)(ww)->_user_data.zlib_writer)
+
+static void zlib_frame_compress_task(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  ZlibFrame *frame = taskdata;
+
+  z_stream strm = {NULL};
+  /* Window bits of 15 + 16 writes a gzip header. Level 1, as the previous 'wb1' mode. */
+  if (deflateInit2(&strm, 1, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+    frame->error = true;
+    return;
+  }
+
+  const size_t data_out_size = deflateBound(&strm, (uLong)frame->data_in_len);
+  frame->data_out = MEM_mallocN(data_out_size, __func__);
+
+  strm.next_in = frame->data_in;
+  strm.avail_in = (uInt)frame->data_in_len;
+  strm.next_out = frame->data_out;
+  strm.avail_out = (uInt)data_out_size;
+
+  if (deflate(&strm, Z_FINISH) != Z_STREAM_END) {
+    frame->error = true;
+  }
+  frame->data_out_len = data_out_size - strm.avail_out;
+  deflateEnd(&strm);
+
+  MEM_freeN(frame->data_in);
+  frame->data_in = NULL;
+}
+
+/** Wait for all pending frames and write them to the file in order. */
+static void zlib_writer_flush_pending(ZlibWriter *zw)
+{
+  BLI_task_pool_work_and_wait(zw->task_pool);
+
+  LISTBASE_FOREACH_MUTABLE (ZlibFrame *, frame, &zw->frames_pending) {
+    if (frame->error) {
+      zw->error = true;
+    }
+    if (!zw->error) {
+      if (write(zw->file_handle, frame->data_out, frame->data_out_len) !=
+          (ssize_t)frame->data_out_len) {
+        zw->error = true;
+      }
+    }
+    MEM_SAFE_FREE(frame->data_in);
+    MEM_SAFE_FREE(frame->data_out);
+    MEM_freeN(frame);
+  }
+  BLI_listbase_clear(&zw->frames_pending);
+  zw->frames_pending_len = 0;
+}
+
+static void zlib_writer_submit_active(ZlibWriter *zw)
+{
+  ZlibFrame *frame = zw->frame_active;
+  zw->frame_active = NULL;
+  if (frame == NULL) {
+    return;
+  }
+
+  BLI_addtail(&zw->frames_pending, frame);
+  zw->frames_pending_len++;
+  BLI_task_pool_push(zw->task_pool, zlib_frame_compress_task, frame, false, NULL);
+
+  if (zw->frames_pending_len >= zw->frames_pending_max) {
+    zlib_writer_flush_pending(zw);
+  }
+}
 
 static bool ww_open_zlib(WriteWrap *ww, const char *filepath)
 {
-  gzFile file;
+  int file;
 
-  file = BLI_gzopen(filepath, "wb1");
+  file = BLI_open(filepath, O_BINARY + O_WRONLY + O_CREAT + O_TRUNC, 0666);
 
-  if (file != Z_NULL) {
-    FILE_HANDLE(ww) = file;
+  if (file != -1) {
+    ZlibWriter *zw = MEM_callocN(sizeof(*zw), __func__);
+    zw->file_handle = file;
+    zw->task_pool = BLI_task_pool_create(NULL, TASK_PRIORITY_HIGH);
+    /* Enough frames to keep all threads busy, without holding on to too much memory. */
+    zw->frames_pending_max = MAX2(2, BLI_system_thread_count() * 2);
+    ww->_user_data.zlib_writer = zw;
     return true;
   }
 
@@ -210,13 +316,47 @@ static bool ww_open_zlib(WriteWrap *ww, const char *filepath)
 }
 static bool ww_close_zlib(WriteWrap *ww)
 {
-  return (gzclose(FILE_HANDLE(ww)) == Z_OK);
+  ZlibWriter *zw = ZLIB_WRITER(ww);
+
+  zlib_writer_submit_active(zw);
+  zlib_writer_flush_pending(zw);
+
+  bool ok = !zw->error;
+  BLI_task_pool_free(zw->task_pool);
+  if (close(zw->file_handle) == -1) {
+    ok = false;
+  }
+  MEM_freeN(zw);
+  ww->_user_data.zlib_writer = NULL;
+
+  return ok;
 }
 static size_t ww_write_zlib(WriteWrap *ww, const char *buf, size_t buf_len)
 {
-  return gzwrite(FILE_HANDLE(ww), buf, buf_len);
+  ZlibWriter *zw = ZLIB_WRITER(ww);
+  size_t buf_len_remaining = buf_len;
+
+  while (buf_len_remaining != 0) {
+    if (zw->frame_active == NULL) {
+      zw->frame_active = MEM_callocN(sizeof(ZlibFrame), __func__);
+      zw->frame_active->data_in = MEM_mallocN(ZLIB_FRAME_SIZE, __func__);
+    }
+
+    ZlibFrame *frame = zw->frame_active;
+    const size_t len = MIN2(buf_len_remaining, ZLIB_FRAME_SIZE - frame->data_in_len);
+    memcpy(frame->data_in + frame->data_in_len, buf, len);
+    frame->data_in_len += len;
+    buf += len;
+    buf_len_remaining -= len;
+
+    if (frame->data_in_len == ZLIB_FRAME_SIZE) {
+      zlib_writer_submit_active(zw);
+    }
+  }
+
+  return zw->error ? 0 : buf_len;
 }
-#undef FILE_HANDLE
+#undef ZLIB_WRITER
 
 /* --- end compression types --- */
 
@@ -229,6 +369,7 @@ static void ww_handle_init(eWriteWrapType ww_type, WriteWrap *r_ww)
       r_ww->open = ww_open_zlib;
       r_ww->close = ww_close_zlib;
       r_ww->write = ww_write_zlib;
+      /* Data is already gathered into large frames. */
       r_ww->use_buf = false;
       break;
     }
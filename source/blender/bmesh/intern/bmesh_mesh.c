@@ -492,6 +492,59 @@ static void mesh_faces_calc_normals_cb(void *UNUSED(userdata), MempoolIterData *
   BM_face_normal_update(f);
 }
 
+/**
+ * Calculate the normal of a single vertex from the (already updated) normals of its faces.
+ *
+ * Only the vertex itself is written, so unlike accumulating face normals into their vertices,
+ * this doesn't need any synchronization between threads. It also doesn't need index arrays
+ * for intermediate results, all data is read from the elements around the vertex.
+ */
+static void bm_vert_calc_normals_impl(BMVert *v)
+{
+  float *v_no = v->no;
+  zero_v3(v_no);
+
+  BMEdge *e_first = v->e;
+  if (e_first != NULL) {
+    BMEdge *e_iter = e_first;
+    do {
+      BMLoop *l_first = e_iter->l;
+      if (l_first != NULL) {
+        BMLoop *l_iter = l_first;
+        do {
+          /* Every face corner of the vertex is visited once, through the loop starting at it. */
+          if (l_iter->v == v) {
+            float dir_prev[3], dir_next[3];
+            sub_v3_v3v3(dir_prev, l_iter->prev->v->co, v->co);
+            sub_v3_v3v3(dir_next, l_iter->next->v->co, v->co);
+            normalize_v3(dir_prev);
+            normalize_v3(dir_next);
+
+            /* The angle of the face corner is used as weight. */
+            const float fac = saacos(dot_v3v3(dir_prev, dir_next));
+            if (fac != fac) { /* NAN detection. */
+              /* Degenerated case, nothing to do here, just ignore that face. */
+              continue;
+            }
+            madd_v3_v3fl(v_no, l_iter->f->no, fac);
+          }
+        } while ((l_iter = l_iter->radial_next) != l_first);
+      }
+    } while ((e_iter = BM_DISK_EDGE_NEXT(e_iter, v)) != e_first);
+  }
+
+  if (UNLIKELY(normalize_v3(v_no) == 0.0f)) {
+    normalize_v3_v3(v_no, v->co);
+  }
+}
+
+static void mesh_verts_calc_normals_cb(void *UNUSED(userdata), MempoolIterData *mp_v)
+{
+  BMVert *v = (BMVert *)mp_v;
+
+  bm_vert_calc_normals_impl(v);
+}
+
 /**
  * \brief BMesh Compute Normals
  *
@@ -499,34 +552,13 @@ static void mesh_faces_calc_normals_cb(void *UNUSED(userdata), MempoolIterData *
  */
 void BM_mesh_normals_update(BMesh *bm)
 {
-  float(*edgevec)[3] = MEM_mallocN(sizeof(*edgevec) * bm->totedge, __func__);
-
-  /* Parallel mempool iteration does not allow generating indices inline anymore... */
-  BM_mesh_elem_index_ensure(bm, (BM_EDGE | BM_FACE));
-
   /* calculate all face normals */
   BM_iter_parallel(
       bm, BM_FACES_OF_MESH, mesh_faces_calc_normals_cb, NULL, bm->totface >= BM_OMP_LIMIT);
 
-  /* Zero out vertex normals */
-  BMIter viter;
-  BMVert *v;
-  int i;
-
-  BM_ITER_MESH_INDEX (v, &viter, bm, BM_VERTS_OF_MESH, i) {
-    BM_elem_index_set(v, i); /* set_inline */
-    zero_v3(v->no);
-  }
-  bm->elem_index_dirty &= ~BM_VERT;
-
-  /* Compute normalized direction vectors for each edge.
-   * Directions will be used for calculating the weights of the face normals on the vertex normals.
-   */
-  bm_mesh_edges_calc_vectors(bm, edgevec, NULL);
-
-  /* Add weighted face normals to vertices, and normalize vert normals. */
-  bm_mesh_verts_calc_normals(bm, (const float(*)[3])edgevec, NULL, NULL, NULL);
-  MEM_freeN(edgevec);
+  /* Calculate all vertex normals from the face normals. */
+  BM_iter_parallel(
+      bm, BM_VERTS_OF_MESH, mesh_verts_calc_normals_cb, NULL, bm->totvert >= BM_OMP_LIMIT);
 }
 
 /**
@@ -81,6 +81,7 @@
 #include "BLI_alloca.h"
 #include "BLI_listbase.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.h"
 
 #include "BKE_customdata.h"
 #include "BKE_mesh.h"
@@ -586,12 +587,114 @@ BLI_INLINE void bmesh_quick_edgedraw_flag(MEdge *med, BMEdge *e)
  *
  * \param bmain: May be NULL in case \a calc_object_remap parameter option is not set.
  */
+/* Minimum number of elements converted by one thread in #BM_mesh_bm_to_me. */
+#define BM_TO_MESH_ELEM_PER_THREAD 4096
+
+typedef struct BMToMeshData {
+  BMesh *bm;
+  Mesh *me;
+  MVert *mvert;
+  MEdge *medge;
+  MLoop *mloop;
+  MPoly *mpoly;
+  int cd_vert_bweight_offset;
+  int cd_edge_bweight_offset;
+  int cd_edge_crease_offset;
+} BMToMeshData;
+
+static void bm_to_mesh_verts_task_cb(void *__restrict userdata,
+                                     const int i,
+                                     const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const BMToMeshData *data = userdata;
+  BMesh *bm = data->bm;
+  BMVert *v = bm->vtable[i];
+  MVert *mvert = &data->mvert[i];
+
+  copy_v3_v3(mvert->co, v->co);
+  normal_float_to_short_v3(mvert->no, v->no);
+
+  mvert->flag = BM_vert_flag_to_mflag(v);
+
+  /* Copy over custom-data. */
+  CustomData_from_bmesh_block(&bm->vdata, &data->me->vdata, v->head.data, i);
+
+  if (data->cd_vert_bweight_offset != -1) {
+    mvert->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(v, data->cd_vert_bweight_offset);
+  }
+
+  BM_CHECK_ELEMENT(v);
+}
+
+static void bm_to_mesh_edges_task_cb(void *__restrict userdata,
+                                     const int i,
+                                     const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const BMToMeshData *data = userdata;
+  BMesh *bm = data->bm;
+  BMEdge *e = bm->etable[i];
+  MEdge *med = &data->medge[i];
+
+  med->v1 = BM_elem_index_get(e->v1);
+  med->v2 = BM_elem_index_get(e->v2);
+
+  med->flag = BM_edge_flag_to_mflag(e);
+
+  /* Copy over custom-data. */
+  CustomData_from_bmesh_block(&bm->edata, &data->me->edata, e->head.data, i);
+
+  bmesh_quick_edgedraw_flag(med, e);
+
+  if (data->cd_edge_crease_offset != -1) {
+    med->crease = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(e, data->cd_edge_crease_offset);
+  }
+  if (data->cd_edge_bweight_offset != -1) {
+    med->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(e, data->cd_edge_bweight_offset);
+  }
+
+  BM_CHECK_ELEMENT(e);
+}
+
+static void bm_to_mesh_faces_task_cb(void *__restrict userdata,
+                                     const int i,
+                                     const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const BMToMeshData *data = userdata;
+  BMesh *bm = data->bm;
+  BMFace *f = bm->ftable[i];
+  MPoly *mpoly = &data->mpoly[i];
+  BMLoop *l_iter, *l_first;
+
+  /* The loop start has been set already. */
+  int j = mpoly->loopstart;
+  mpoly->totloop = f->len;
+  mpoly->mat_nr = f->mat_nr;
+  mpoly->flag = BM_face_flag_to_mflag(f);
+
+  l_iter = l_first = BM_FACE_FIRST_LOOP(f);
+  do {
+    MLoop *mloop = &data->mloop[j];
+    mloop->e = BM_elem_index_get(l_iter->e);
+    mloop->v = BM_elem_index_get(l_iter->v);
+
+    /* Copy over custom-data. */
+    CustomData_from_bmesh_block(&bm->ldata, &data->me->ldata, l_iter->head.data, j);
+
+    j++;
+    BM_CHECK_ELEMENT(l_iter);
+    BM_CHECK_ELEMENT(l_iter->e);
+    BM_CHECK_ELEMENT(l_iter->v);
+  } while ((l_iter = l_iter->next) != l_first);
+
+  /* Copy over custom-data. */
+  CustomData_from_bmesh_block(&bm->pdata, &data->me->pdata, f->head.data, i);
+
+  BM_CHECK_ELEMENT(f);
+}
+
 void BM_mesh_bm_to_me(Main *bmain, BMesh *bm, Mesh *me, const struct BMeshToMeshParams *params)
 {
-  MEdge *med;
-  BMVert *v, *eve;
-  BMEdge *e;
-  BMFace *f;
+  BMVert *eve;
   BMIter iter;
   int i, j;
 
@@ -610,7 +713,8 @@ void BM_mesh_bm_to_me(Main *bmain, BMesh *bm, Mesh *me, const struct BMeshToMesh
 #if 0
   oldverts = MEM_dupallocN(me->mvert);
 #else
-    oldverts = me->mvert;
+    /* The array may be shared with evaluated copies of the mesh, take ownership first. */
+    oldverts = CustomData_duplicate_referenced_layer(&me->vdata, CD_MVERT, me->totvert);
     me->mvert = NULL;
     CustomData_update_typemap(&me->vdata);
     CustomData_set_layer(&me->vdata, CD_MVERT, NULL);
@@ -658,91 +762,42 @@ void BM_mesh_bm_to_me(Main *bmain, BMesh *bm, Mesh *me, const struct BMeshToMesh
   /* This is called again, 'dotess' arg is used there. */
   BKE_mesh_update_customdata_pointers(me, 0);
 
-  i = 0;
-  BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
-    copy_v3_v3(mvert->co, v->co);
-    normal_float_to_short_v3(mvert->no, v->no);
-
-    mvert->flag = BM_vert_flag_to_mflag(v);
-
-    BM_elem_index_set(v, i); /* set_inline */
-
-    /* Copy over custom-data. */
-    CustomData_from_bmesh_block(&bm->vdata, &me->vdata, v->head.data, i);
-
-    if (cd_vert_bweight_offset != -1) {
-      mvert->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(v, cd_vert_bweight_offset);
-    }
-
-    i++;
-    mvert++;
-
-    BM_CHECK_ELEMENT(v);
-  }
-  bm->elem_index_dirty &= ~BM_VERT;
-
-  med = medge;
-  i = 0;
-  BM_ITER_MESH (e, &iter, bm, BM_EDGES_OF_MESH) {
-    med->v1 = BM_elem_index_get(e->v1);
-    med->v2 = BM_elem_index_get(e->v2);
-
-    med->flag = BM_edge_flag_to_mflag(e);
-
-    BM_elem_index_set(e, i); /* set_inline */
+  /* Elements are accessed by index below, so that they can be converted in parallel. */
+  BM_mesh_elem_index_ensure(bm, BM_VERT | BM_EDGE | BM_FACE);
+  BM_mesh_elem_table_ensure(bm, BM_VERT | BM_EDGE | BM_FACE);
 
-    /* Copy over custom-data. */
-    CustomData_from_bmesh_block(&bm->edata, &me->edata, e->head.data, i);
-
-    bmesh_quick_edgedraw_flag(med, e);
-
-    if (cd_edge_crease_offset != -1) {
-      med->crease = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(e, cd_edge_crease_offset);
-    }
-    if (cd_edge_bweight_offset != -1) {
-      med->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(e, cd_edge_bweight_offset);
-    }
-
-    i++;
-    med++;
-    BM_CHECK_ELEMENT(e);
-  }
-  bm->elem_index_dirty &= ~BM_EDGE;
-
-  i = 0;
+  /* Loops of a face are stored contiguously, compute where they start up front. */
   j = 0;
-  BM_ITER_MESH (f, &iter, bm, BM_FACES_OF_MESH) {
-    BMLoop *l_iter, *l_first;
-    mpoly->loopstart = j;
-    mpoly->totloop = f->len;
-    mpoly->mat_nr = f->mat_nr;
-    mpoly->flag = BM_face_flag_to_mflag(f);
-
-    l_iter = l_first = BM_FACE_FIRST_LOOP(f);
-    do {
-      mloop->e = BM_elem_index_get(l_iter->e);
-      mloop->v = BM_elem_index_get(l_iter->v);
-
-      /* Copy over custom-data. */
-      CustomData_from_bmesh_block(&bm->ldata, &me->ldata, l_iter->head.data, j);
-
-      j++;
-      mloop++;
-      BM_CHECK_ELEMENT(l_iter);
-      BM_CHECK_ELEMENT(l_iter->e);
-      BM_CHECK_ELEMENT(l_iter->v);
-    } while ((l_iter = l_iter->next) != l_first);
-
-    if (f == bm->act_face) {
-      me->act_face = i;
-    }
-
-    /* Copy over custom-data. */
-    CustomData_from_bmesh_block(&bm->pdata, &me->pdata, f->head.data, i);
+  for (i = 0; i < bm->totface; i++) {
+    mpoly[i].loopstart = j;
+    j += bm->ftable[i]->len;
+  }
 
-    i++;
-    mpoly++;
-    BM_CHECK_ELEMENT(f);
+  BMToMeshData data = {
+      .bm = bm,
+      .me = me,
+      .mvert = mvert,
+      .medge = medge,
+      .mloop = mloop,
+      .mpoly = mpoly,
+      .cd_vert_bweight_offset = cd_vert_bweight_offset,
+      .cd_edge_bweight_offset = cd_edge_bweight_offset,
+      .cd_edge_crease_offset = cd_edge_crease_offset,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = BM_TO_MESH_ELEM_PER_THREAD;
+
+  settings.use_threading = bm->totvert > BM_TO_MESH_ELEM_PER_THREAD;
+  BLI_task_parallel_range(0, bm->totvert, &data, bm_to_mesh_verts_task_cb, &settings);
+  settings.use_threading = bm->totedge > BM_TO_MESH_ELEM_PER_THREAD;
+  BLI_task_parallel_range(0, bm->totedge, &data, bm_to_mesh_edges_task_cb, &settings);
+  settings.use_threading = bm->totface > BM_TO_MESH_ELEM_PER_THREAD;
+  BLI_task_parallel_range(0, bm->totface, &data, bm_to_mesh_faces_task_cb, &settings);
+
+  if (bm->act_face) {
+    me->act_face = BM_elem_index_get(bm->act_face);
   }
 
   /* Patch hook indices and vertex parents. */
@@ -35,6 +35,7 @@
 #include "BLI_memarena.h"
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
+#include "BLI_task.h"
 
 #include "bmesh.h"
 #include "bmesh_tools.h"
@@ -1525,138 +1526,127 @@ void BM_face_as_array_loop_quad(BMFace *f, BMLoop *r_loops[4])
 }
 
 /**
- * \brief BM_mesh_calc_tessellation get the looptris and its number from a certain bmesh
- * \param looptris:
+ * Threading is only used for meshes with at least this many faces,
+ * below this the overhead of ensuring the face table and indices isn't worth it.
+ */
+#define BM_FACE_TESSELLATE_THREADED_LIMIT 1024
+
+/**
+ * Tessellate a single face into \a looptris.
+ * \return the number of triangles, (`f->len - 2`, zero for two-edged faces).
  *
- * \note \a looptris Must be pre-allocated to at least the size of given by: poly_to_tri_count
+ * \param pmemarena: Created on demand for n-gons, the caller must free it.
  */
-void BM_mesh_calc_tessellation(BMesh *bm, BMLoop *(*looptris)[3], int *r_looptris_tot)
+static int bm_face_calc_tessellation_looptris(BMFace *efa,
+                                              BMLoop *(*looptris)[3],
+                                              MemArena **pmemarena)
 {
   /* use this to avoid locking pthread for _every_ polygon
    * and calling the fill function */
 #define USE_TESSFACE_SPEEDUP
 
-  /* this assumes all faces can be scan-filled, which isn't always true,
-   * worst case we over alloc a little which is acceptable */
-#ifndef NDEBUG
-  const int looptris_tot = poly_to_tri_count(bm->totface, bm->totloop);
-#endif
-
-  BMIter iter;
-  BMFace *efa;
   int i = 0;
 
-  MemArena *arena = NULL;
-
-  BM_ITER_MESH (efa, &iter, bm, BM_FACES_OF_MESH) {
-    /* don't consider two-edged faces */
-    if (UNLIKELY(efa->len < 3)) {
-      /* do nothing */
-    }
+  /* don't consider two-edged faces */
+  if (UNLIKELY(efa->len < 3)) {
+    /* do nothing */
+  }
 
 #ifdef USE_TESSFACE_SPEEDUP
 
-    /* no need to ensure the loop order, we know its ok */
-
-    else if (efa->len == 3) {
-#  if 0
-      int j;
-      BM_ITER_ELEM_INDEX(l, &liter, efa, BM_LOOPS_OF_FACE, j) {
-        looptris[i][j] = l;
-      }
-      i += 1;
-#  else
-      /* more cryptic but faster */
-      BMLoop *l;
-      BMLoop **l_ptr = looptris[i++];
-      l_ptr[0] = l = BM_FACE_FIRST_LOOP(efa);
-      l_ptr[1] = l = l->next;
-      l_ptr[2] = l->next;
-#  endif
-    }
-    else if (efa->len == 4) {
-#  if 0
-      BMLoop *ltmp[4];
-      int j;
-      BLI_array_grow_items(looptris, 2);
-      BM_ITER_ELEM_INDEX(l, &liter, efa, BM_LOOPS_OF_FACE, j) {
-        ltmp[j] = l;
-      }
+  /* no need to ensure the loop order, we know its ok */
 
-      looptris[i][0] = ltmp[0];
-      looptris[i][1] = ltmp[1];
-      looptris[i][2] = ltmp[2];
-      i += 1;
-
-      looptris[i][0] = ltmp[0];
-      looptris[i][1] = ltmp[2];
-      looptris[i][2] = ltmp[3];
-      i += 1;
-#  else
-      /* more cryptic but faster */
-      BMLoop *l;
-      BMLoop **l_ptr_a = looptris[i++];
-      BMLoop **l_ptr_b = looptris[i++];
-      (l_ptr_a[0] = l_ptr_b[0] = l = BM_FACE_FIRST_LOOP(efa));
-      (l_ptr_a[1] = l = l->next);
-      (l_ptr_a[2] = l_ptr_b[1] = l = l->next);
-      (l_ptr_b[2] = l->next);
-#  endif
-
-      if (UNLIKELY(is_quad_flip_v3_first_third_fast(
-              l_ptr_a[0]->v->co, l_ptr_a[1]->v->co, l_ptr_a[2]->v->co, l_ptr_b[2]->v->co))) {
-        /* flip out of degenerate 0-2 state. */
-        l_ptr_a[2] = l_ptr_b[2];
-        l_ptr_b[0] = l_ptr_a[1];
-      }
+  else if (efa->len == 3) {
+    /* more cryptic but faster */
+    BMLoop *l;
+    BMLoop **l_ptr = looptris[i++];
+    l_ptr[0] = l = BM_FACE_FIRST_LOOP(efa);
+    l_ptr[1] = l = l->next;
+    l_ptr[2] = l->next;
+  }
+  else if (efa->len == 4) {
+    /* more cryptic but faster */
+    BMLoop *l;
+    BMLoop **l_ptr_a = looptris[i++];
+    BMLoop **l_ptr_b = looptris[i++];
+    (l_ptr_a[0] = l_ptr_b[0] = l = BM_FACE_FIRST_LOOP(efa));
+    (l_ptr_a[1] = l = l->next);
+    (l_ptr_a[2] = l_ptr_b[1] = l = l->next);
+    (l_ptr_b[2] = l->next);
+
+    if (UNLIKELY(is_quad_flip_v3_first_third_fast(
+            l_ptr_a[0]->v->co, l_ptr_a[1]->v->co, l_ptr_a[2]->v->co, l_ptr_b[2]->v->co))) {
+      /* flip out of degenerate 0-2 state. */
+      l_ptr_a[2] = l_ptr_b[2];
+      l_ptr_b[0] = l_ptr_a[1];
     }
+  }
 
 #endif /* USE_TESSFACE_SPEEDUP */
 
-    else {
-      int j;
-
-      BMLoop *l_iter;
-      BMLoop *l_first;
-      BMLoop **l_arr;
+  else {
+    int j;
 
-      float axis_mat[3][3];
-      float(*projverts)[2];
-      uint(*tris)[3];
+    BMLoop *l_iter;
+    BMLoop *l_first;
+    BMLoop **l_arr;
 
-      const int totfilltri = efa->len - 2;
+    float axis_mat[3][3];
+    float(*projverts)[2];
+    uint(*tris)[3];
 
-      if (UNLIKELY(arena == NULL)) {
-        arena = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, __func__);
-      }
+    const int totfilltri = efa->len - 2;
 
-      tris = BLI_memarena_alloc(arena, sizeof(*tris) * totfilltri);
-      l_arr = BLI_memarena_alloc(arena, sizeof(*l_arr) * efa->len);
-      projverts = BLI_memarena_alloc(arena, sizeof(*projverts) * efa->len);
+    if (UNLIKELY(*pmemarena == NULL)) {
+      *pmemarena = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, __func__);
+    }
+    MemArena *arena = *pmemarena;
 
-      axis_dominant_v3_to_m3_negate(axis_mat, efa->no);
+    tris = BLI_memarena_alloc(arena, sizeof(*tris) * totfilltri);
+    l_arr = BLI_memarena_alloc(arena, sizeof(*l_arr) * efa->len);
+    projverts = BLI_memarena_alloc(arena, sizeof(*projverts) * efa->len);
 
-      j = 0;
-      l_iter = l_first = BM_FACE_FIRST_LOOP(efa);
-      do {
-        l_arr[j] = l_iter;
-        mul_v2_m3v3(projverts[j], axis_mat, l_iter->v->co);
-        j++;
-      } while ((l_iter = l_iter->next) != l_first);
+    axis_dominant_v3_to_m3_negate(axis_mat, efa->no);
 
-      BLI_polyfill_calc_arena(projverts, efa->len, 1, tris, arena);
+    j = 0;
+    l_iter = l_first = BM_FACE_FIRST_LOOP(efa);
+    do {
+      l_arr[j] = l_iter;
+      mul_v2_m3v3(projverts[j], axis_mat, l_iter->v->co);
+      j++;
+    } while ((l_iter = l_iter->next) != l_first);
 
-      for (j = 0; j < totfilltri; j++) {
-        BMLoop **l_ptr = looptris[i++];
-        uint *tri = tris[j];
+    BLI_polyfill_calc_arena(projverts, efa->len, 1, tris, arena);
 
-        l_ptr[0] = l_arr[tri[0]];
-        l_ptr[1] = l_arr[tri[1]];
-        l_ptr[2] = l_arr[tri[2]];
-      }
+    for (j = 0; j < totfilltri; j++) {
+      BMLoop **l_ptr = looptris[i++];
+      uint *tri = tris[j];
 
-      BLI_memarena_clear(arena);
+      l_ptr[0] = l_arr[tri[0]];
+      l_ptr[1] = l_arr[tri[1]];
+      l_ptr[2] = l_arr[tri[2]];
     }
+
+    BLI_memarena_clear(arena);
+  }
+
+  return i;
+
+#undef USE_TESSFACE_SPEEDUP
+}
+
+static void bm_mesh_calc_tessellation__single_threaded(BMesh *bm,
+                                                       BMLoop *(*looptris)[3],
+                                                       int *r_looptris_tot)
+{
+  BMIter iter;
+  BMFace *efa;
+  int i = 0;
+
+  MemArena *arena = NULL;
+
+  BM_ITER_MESH (efa, &iter, bm, BM_FACES_OF_MESH) {
+    i += bm_face_calc_tessellation_looptris(efa, looptris + i, &arena);
   }
 
   if (arena) {
@@ -1665,10 +1655,86 @@ void BM_mesh_calc_tessellation(BMesh *bm, BMLoop *(*looptris)[3], int *r_looptri
   }
 
   *r_looptris_tot = i;
+}
 
-  BLI_assert(i <= looptris_tot);
+typedef struct TessellationData {
+  BMFace **ftable;
+  BMLoop *(*looptris)[3];
+} TessellationData;
 
-#undef USE_TESSFACE_SPEEDUP
+typedef struct TessellationTLS {
+  MemArena *arena;
+} TessellationTLS;
+
+static void bm_mesh_calc_tessellation_task_cb(void *__restrict userdata,
+                                              const int i,
+                                              const TaskParallelTLS *__restrict tls)
+{
+  const TessellationData *data = userdata;
+  TessellationTLS *tls_data = tls->userdata_chunk;
+  BMFace *efa = data->ftable[i];
+  /* Every face before this one has `len - 2` triangles, the loop index of the first loop is the
+   * total length of all faces before it. */
+  const int looptri_index = BM_elem_index_get(BM_FACE_FIRST_LOOP(efa)) - (i * 2);
+  bm_face_calc_tessellation_looptris(efa, data->looptris + looptri_index, &tls_data->arena);
+}
+
+static void bm_mesh_calc_tessellation_free_cb(const void *__restrict UNUSED(userdata),
+                                              void *__restrict tls_v)
+{
+  TessellationTLS *tls_data = tls_v;
+  if (tls_data->arena) {
+    BLI_memarena_free(tls_data->arena);
+  }
+}
+
+static void bm_mesh_calc_tessellation__multi_threaded(BMesh *bm,
+                                                      BMLoop *(*looptris)[3],
+                                                      int *r_looptris_tot)
+{
+  BM_mesh_elem_index_ensure(bm, BM_LOOP | BM_FACE);
+  BM_mesh_elem_table_ensure(bm, BM_FACE);
+
+  TessellationData data = {
+      .ftable = bm->ftable,
+      .looptris = looptris,
+  };
+  TessellationTLS tls_dummy = {NULL};
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.userdata_chunk = &tls_dummy;
+  settings.userdata_chunk_size = sizeof(tls_dummy);
+  settings.func_free = bm_mesh_calc_tessellation_free_cb;
+  settings.min_iter_per_thread = 1024;
+  BLI_task_parallel_range(0, bm->totface, &data, bm_mesh_calc_tessellation_task_cb, &settings);
+
+  *r_looptris_tot = bm->totloop - (bm->totface * 2);
+}
+
+/**
+ * \brief BM_mesh_calc_tessellation get the looptris and its number from a certain bmesh
+ * \param looptris:
+ *
+ * \note \a looptris Must be pre-allocated to at least the size of given by: poly_to_tri_count
+ */
+void BM_mesh_calc_tessellation(BMesh *bm, BMLoop *(*looptris)[3], int *r_looptris_tot)
+{
+  /* this assumes all faces can be scan-filled, which isn't always true,
+   * worst case we over alloc a little which is acceptable */
+#ifndef NDEBUG
+  const int looptris_tot = poly_to_tri_count(bm->totface, bm->totloop);
+#endif
+
+  /* The multi-threaded version needs index arrays, only worth it for larger meshes. */
+  if (bm->totface < BM_FACE_TESSELLATE_THREADED_LIMIT) {
+    bm_mesh_calc_tessellation__single_threaded(bm, looptris, r_looptris_tot);
+  }
+  else {
+    bm_mesh_calc_tessellation__multi_threaded(bm, looptris, r_looptris_tot);
+  }
+
+  BLI_assert(*r_looptris_tot <= looptris_tot);
 }
 
 /**
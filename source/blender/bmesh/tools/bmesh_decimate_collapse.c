@@ -32,6 +32,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_quadric.h"
+#include "BLI_task.h"
 #include "BLI_utildefines_stack.h"
 
 #include "BKE_customdata.h"
@@ -236,18 +237,23 @@ static float bm_decim_build_edge_cost_single__topology(BMEdge *e)
 
 #endif /* USE_TOPOLOGY_FALLBACK */
 
-static void bm_decim_build_edge_cost_single(BMEdge *e,
-                                            const Quadric *vquadrics,
-                                            const float *vweights,
-                                            const float vweight_factor,
-                                            Heap *eheap,
-                                            HeapNode **eheap_table)
+/**
+ * Calculate the collapse cost of an edge.
+ * \return false when the edge must not be collapsed.
+ *
+ * \note Only reads the mesh, so it can run on multiple edges in parallel.
+ */
+static bool bm_decim_calc_edge_cost_single(BMEdge *e,
+                                           const Quadric *vquadrics,
+                                           const float *vweights,
+                                           const float vweight_factor,
+                                           float *r_cost)
 {
   float cost;
 
   if (UNLIKELY(vweights && ((vweights[BM_elem_index_get(e->v1)] == 0.0f) ||
                             (vweights[BM_elem_index_get(e->v2)] == 0.0f)))) {
-    goto clear;
+    return false;
   }
 
   /* check we can collapse, some edges we better not touch */
@@ -257,7 +263,7 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
     else {
       /* only collapse tri's */
-      goto clear;
+      return false;
     }
   }
   else if (BM_edge_is_manifold(e)) {
@@ -266,11 +272,11 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
     else {
       /* only collapse tri's */
-      goto clear;
+      return false;
     }
   }
   else {
-    goto clear;
+    return false;
   }
   /* end sanity check */
 
@@ -322,14 +328,27 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
   }
 
-  BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
-  return;
+  *r_cost = cost;
+  return true;
+}
 
-clear:
-  if (eheap_table[BM_elem_index_get(e)]) {
-    BLI_heap_remove(eheap, eheap_table[BM_elem_index_get(e)]);
+static void bm_decim_build_edge_cost_single(BMEdge *e,
+                                            const Quadric *vquadrics,
+                                            const float *vweights,
+                                            const float vweight_factor,
+                                            Heap *eheap,
+                                            HeapNode **eheap_table)
+{
+  float cost;
+  if (bm_decim_calc_edge_cost_single(e, vquadrics, vweights, vweight_factor, &cost)) {
+    BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
+  }
+  else {
+    if (eheap_table[BM_elem_index_get(e)]) {
+      BLI_heap_remove(eheap, eheap_table[BM_elem_index_get(e)]);
+    }
+    eheap_table[BM_elem_index_get(e)] = NULL;
   }
-  eheap_table[BM_elem_index_get(e)] = NULL;
 }
 
 /* use this for degenerate cases - add back to the heap with an invalid cost,
@@ -340,6 +359,25 @@ static void bm_decim_invalid_edge_cost_single(BMEdge *e, Heap *eheap, HeapNode *
   eheap_table[BM_elem_index_get(e)] = BLI_heap_insert(eheap, COST_INVALID, e);
 }
 
+typedef struct DecimEdgeCostData {
+  BMEdge **etable;
+  const Quadric *vquadrics;
+  const float *vweights;
+  float vweight_factor;
+  /* Output, the cost is only set for edges that can be collapsed. */
+  float *costs;
+  bool *can_collapse;
+} DecimEdgeCostData;
+
+static void bm_decim_calc_edge_cost_task_cb(void *__restrict userdata,
+                                            const int i,
+                                            const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  DecimEdgeCostData *data = userdata;
+  data->can_collapse[i] = bm_decim_calc_edge_cost_single(
+      data->etable[i], data->vquadrics, data->vweights, data->vweight_factor, &data->costs[i]);
+}
+
 static void bm_decim_build_edge_cost(BMesh *bm,
                                      const Quadric *vquadrics,
                                      const float *vweights,
@@ -347,15 +385,32 @@ static void bm_decim_build_edge_cost(BMesh *bm,
                                      Heap *eheap,
                                      HeapNode **eheap_table)
 {
-  BMIter iter;
-  BMEdge *e;
-  uint i;
-
-  BM_ITER_MESH_INDEX (e, &iter, bm, BM_EDGES_OF_MESH, i) {
-    /* keep sanity check happy */
-    eheap_table[i] = NULL;
-    bm_decim_build_edge_cost_single(e, vquadrics, vweights, vweight_factor, eheap, eheap_table);
+  BM_mesh_elem_table_ensure(bm, BM_EDGE);
+
+  /* Calculating the costs is the expensive part, do that in parallel. The heap is filled
+   * afterwards in the same order as before, so the result doesn't depend on threading. */
+  DecimEdgeCostData data = {
+      .etable = bm->etable,
+      .vquadrics = vquadrics,
+      .vweights = vweights,
+      .vweight_factor = vweight_factor,
+      .costs = MEM_mallocN(sizeof(*data.costs) * bm->totedge, __func__),
+      .can_collapse = MEM_mallocN(sizeof(*data.can_collapse) * bm->totedge, __func__),
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = bm->totedge > 1024;
+  settings.min_iter_per_thread = 1024;
+  BLI_task_parallel_range(0, bm->totedge, &data, bm_decim_calc_edge_cost_task_cb, &settings);
+
+  for (int i = 0; i < bm->totedge; i++) {
+    BMEdge *e = bm->etable[i];
+    eheap_table[i] = data.can_collapse[i] ? BLI_heap_insert(eheap, data.costs[i], e) : NULL;
   }
+
+  MEM_freeN(data.costs);
+  MEM_freeN(data.can_collapse);
 }
 
 #ifdef USE_SYMMETRY
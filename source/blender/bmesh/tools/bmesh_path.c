@@ -27,6 +27,7 @@
 #include "BLI_heap_simple.h"
 #include "BLI_linklist.h"
 #include "BLI_math.h"
+#include "BLI_task.h"
 
 #include "bmesh.h"
 #include "bmesh_path.h" /* own include */
@@ -389,14 +390,12 @@ LinkNode *BM_mesh_calc_path_edge(BMesh *bm,
 static float facetag_cut_cost_edge(BMFace *f_a,
                                    BMFace *f_b,
                                    BMEdge *e,
+                                   const float (*face_centers)[3],
                                    const void *const f_endpoints[2])
 {
-  float f_a_cent[3];
-  float f_b_cent[3];
+  const float *f_a_cent = face_centers[BM_elem_index_get(f_a)];
+  const float *f_b_cent = face_centers[BM_elem_index_get(f_b)];
   float e_cent[3];
-
-  BM_face_calc_center_median_weighted(f_a, f_a_cent);
-  BM_face_calc_center_median_weighted(f_b, f_b_cent);
 #if 0
   mid_v3_v3v3(e_cent, e->v1->co, e->v2->co);
 #else
@@ -424,13 +423,11 @@ static float facetag_cut_cost_edge(BMFace *f_a,
 static float facetag_cut_cost_vert(BMFace *f_a,
                                    BMFace *f_b,
                                    BMVert *v,
+                                   const float (*face_centers)[3],
                                    const void *const f_endpoints[2])
 {
-  float f_a_cent[3];
-  float f_b_cent[3];
-
-  BM_face_calc_center_median_weighted(f_a, f_a_cent);
-  BM_face_calc_center_median_weighted(f_b, f_b_cent);
+  const float *f_a_cent = face_centers[BM_elem_index_get(f_a)];
+  const float *f_b_cent = face_centers[BM_elem_index_get(f_b)];
 
   return step_cost_3_v3_ex(
       f_a_cent, v->co, f_b_cent, (f_a == f_endpoints[0]), (f_b == f_endpoints[1]));
@@ -440,6 +437,7 @@ static void facetag_add_adjacent(HeapSimple *heap,
                                  BMFace *f_a,
                                  BMFace **faces_prev,
                                  float *cost,
+                                 const float (*face_centers)[3],
                                  const void *const f_endpoints[2],
                                  const struct BMCalcPathParams *params)
 {
@@ -461,7 +459,8 @@ static void facetag_add_adjacent(HeapSimple *heap,
           const int f_b_index = BM_elem_index_get(f_b);
           const float cost_cut = params->use_topology_distance ?
                                      1.0f :
-                                     facetag_cut_cost_edge(f_a, f_b, l_iter->e, f_endpoints);
+                                     facetag_cut_cost_edge(
+                                         f_a, f_b, l_iter->e, face_centers, f_endpoints);
           const float cost_new = cost[f_a_index] + cost_cut;
 
           if (cost[f_b_index] > cost_new) {
@@ -489,7 +488,8 @@ static void facetag_add_adjacent(HeapSimple *heap,
             const int f_b_index = BM_elem_index_get(f_b);
             const float cost_cut = params->use_topology_distance ?
                                        1.0f :
-                                       facetag_cut_cost_vert(f_a, f_b, l_a->v, f_endpoints);
+                                       facetag_cut_cost_vert(
+                                           f_a, f_b, l_a->v, face_centers, f_endpoints);
             const float cost_new = cost[f_a_index] + cost_cut;
 
             if (cost[f_b_index] > cost_new) {
@@ -504,6 +504,19 @@ static void facetag_add_adjacent(HeapSimple *heap,
   }
 }
 
+typedef struct FaceTagCenterData {
+  BMFace **ftable;
+  float (*face_centers)[3];
+} FaceTagCenterData;
+
+static void facetag_calc_center_task_cb(void *__restrict userdata,
+                                        const int i,
+                                        const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const FaceTagCenterData *data = userdata;
+  BM_face_calc_center_median_weighted(data->ftable[i], data->face_centers[i]);
+}
+
 LinkNode *BM_mesh_calc_path_face(BMesh *bm,
                                  BMFace *f_src,
                                  BMFace *f_dst,
@@ -518,6 +531,7 @@ LinkNode *BM_mesh_calc_path_face(BMesh *bm,
   HeapSimple *heap;
   float *cost;
   BMFace **faces_prev;
+  float(*face_centers)[3] = NULL;
   int i, totface;
 
   /* Start measuring face path at the face edges, ignoring their centers. */
@@ -539,6 +553,22 @@ LinkNode *BM_mesh_calc_path_face(BMesh *bm,
 
   copy_vn_fl(cost, totface, COST_INIT_MAX);
 
+  /* Face centers are needed for every step of the search (often many times for the same face),
+   * calculate them once up-front. */
+  if (!params->use_topology_distance) {
+    BM_mesh_elem_table_ensure(bm, BM_FACE);
+    face_centers = MEM_mallocN(sizeof(*face_centers) * totface, __func__);
+
+    FaceTagCenterData data = {
+        .ftable = bm->ftable,
+        .face_centers = face_centers,
+    };
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 1024;
+    BLI_task_parallel_range(0, totface, &data, facetag_calc_center_task_cb, &settings);
+  }
+
   /*
    * Arrays are now filled as follows:
    *
@@ -564,7 +594,8 @@ LinkNode *BM_mesh_calc_path_face(BMesh *bm,
 
     if (!BM_elem_flag_test(f, BM_ELEM_TAG)) {
       BM_elem_flag_enable(f, BM_ELEM_TAG);
-      facetag_add_adjacent(heap, f, faces_prev, cost, f_endpoints, params);
+      facetag_add_adjacent(
+          heap, f, faces_prev, cost, (const float(*)[3])face_centers, f_endpoints, params);
     }
   }
 
@@ -576,6 +607,7 @@ LinkNode *BM_mesh_calc_path_face(BMesh *bm,
 
   MEM_freeN(faces_prev);
   MEM_freeN(cost);
+  MEM_SAFE_FREE(face_centers);
   BLI_heapsimple_free(heap, NULL);
 
   return path;
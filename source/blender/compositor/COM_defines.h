@@ -58,10 +58,32 @@ typedef enum CompositorPriority {
   COM_PRIORITY_LOW = 0,
 } CompositorPriority;
 
+/**
+ * \brief The way operations are executed
+ * \see CompositorContext.execution_model
+ * \ingroup Execution
+ */
+typedef enum CompositorExecutionModel {
+  /**
+   * \brief Operations are grouped in execution groups, which are calculated in chunks
+   * pulling their pixels from the outputs to the inputs.
+   */
+  COM_EXECUTION_MODEL_TILED = 0,
+  /**
+   * \brief Operations are calculated once each for their whole area,
+   * in order from the inputs to the outputs.
+   */
+  COM_EXECUTION_MODEL_FULL_FRAME = 1,
+} CompositorExecutionModel;
+
 // configurable items
 
 // chunk size determination
 #define COM_PREVIEW_SIZE 140.0f
+/**
+ * \brief Memory limit in bytes of the buffers kept between executions, see ResultCache.
+ */
+#define COM_RESULT_CACHE_MEMORY_LIMIT ((size_t)1024 * 1024 * 1024)
 #define COM_OPENCL_ENABLED
 //#define COM_DEBUG
 
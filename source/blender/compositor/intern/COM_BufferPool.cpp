@@ -0,0 +1,123 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ */
+
+#include <unordered_map>
+#include <vector>
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_threads.h"
+
+#include "COM_BufferPool.h"
+
+static struct {
+  /** Released buffers by their number of floats. */
+  std::unordered_map<size_t, std::vector<float *>> released;
+  size_t mem_released = 0;
+  size_t mem_in_use = 0;
+  size_t mem_limit = 0;
+  ThreadMutex mutex = BLI_MUTEX_INITIALIZER;
+} g_buffer_pool;
+
+/* Call with the mutex locked. */
+static void buffer_pool_free_released()
+{
+  for (std::pair<const size_t, std::vector<float *>> &item : g_buffer_pool.released) {
+    for (float *buffer : item.second) {
+      MEM_freeN(buffer);
+    }
+  }
+  g_buffer_pool.released.clear();
+  g_buffer_pool.mem_released = 0;
+}
+
+/* Call with the mutex locked. */
+static bool buffer_pool_exceeds_limit(size_t mem_size)
+{
+  return g_buffer_pool.mem_limit > 0 &&
+         g_buffer_pool.mem_in_use + g_buffer_pool.mem_released + mem_size >
+             g_buffer_pool.mem_limit;
+}
+
+float *BufferPool::acquire(size_t num_floats)
+{
+  const size_t mem_size = sizeof(float) * num_floats;
+  float *buffer = nullptr;
+
+  BLI_mutex_lock(&g_buffer_pool.mutex);
+  std::unordered_map<size_t, std::vector<float *>>::iterator it = g_buffer_pool.released.find(
+      num_floats);
+  if (it != g_buffer_pool.released.end() && !it->second.empty()) {
+    buffer = it->second.back();
+    it->second.pop_back();
+    g_buffer_pool.mem_released -= mem_size;
+  }
+  else if (buffer_pool_exceeds_limit(mem_size)) {
+    /* Released buffers of other sizes are in the way, give their memory back. */
+    buffer_pool_free_released();
+  }
+  g_buffer_pool.mem_in_use += mem_size;
+  BLI_mutex_unlock(&g_buffer_pool.mutex);
+
+  if (buffer == nullptr) {
+    buffer = (float *)MEM_mallocN_aligned(mem_size, 16, "COM_MemoryBuffer");
+  }
+  return buffer;
+}
+
+void BufferPool::release(float *buffer, size_t num_floats)
+{
+  const size_t mem_size = sizeof(float) * num_floats;
+
+  BLI_mutex_lock(&g_buffer_pool.mutex);
+  g_buffer_pool.mem_in_use -= mem_size;
+  const bool keep = !buffer_pool_exceeds_limit(mem_size);
+  if (keep) {
+    g_buffer_pool.released[num_floats].push_back(buffer);
+    g_buffer_pool.mem_released += mem_size;
+  }
+  BLI_mutex_unlock(&g_buffer_pool.mutex);
+
+  if (!keep) {
+    MEM_freeN(buffer);
+  }
+}
+
+bool BufferPool::exceeds_limit(size_t mem_size)
+{
+  BLI_mutex_lock(&g_buffer_pool.mutex);
+  /* Released buffers are freed before exceeding the limit, they don't count. */
+  const bool exceeds = g_buffer_pool.mem_limit > 0 &&
+                       g_buffer_pool.mem_in_use + mem_size > g_buffer_pool.mem_limit;
+  BLI_mutex_unlock(&g_buffer_pool.mutex);
+  return exceeds;
+}
+
+void BufferPool::set_memory_limit(size_t mem_limit)
+{
+  BLI_mutex_lock(&g_buffer_pool.mutex);
+  g_buffer_pool.mem_limit = mem_limit;
+  BLI_mutex_unlock(&g_buffer_pool.mutex);
+}
+
+void BufferPool::clear()
+{
+  BLI_mutex_lock(&g_buffer_pool.mutex);
+  buffer_pool_free_released();
+  BLI_mutex_unlock(&g_buffer_pool.mutex);
+}
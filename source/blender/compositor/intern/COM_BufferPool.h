@@ -0,0 +1,63 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * \brief Allocates the buffers of MemoryBuffer's, reusing released buffers of the same size.
+ *
+ * Execution models release buffers as soon as their last reader is calculated, so operations
+ * calculated later with the same resolution reuse the memory instead of allocating it again.
+ * Released buffers are kept until the end of the execution, see #clear.
+ *
+ * The memory of the acquired buffers can be limited with the compositor memory limit
+ * preference. Released buffers are freed instead of being kept once the limit is reached, and
+ * execution models free recomputable results (see ResultCache) before exceeding it.
+ *
+ * \note thread safe, temporary buffers are allocated by the WorkScheduler threads.
+ * \ingroup Memory
+ */
+class BufferPool {
+ public:
+  /**
+   * \brief get a buffer of \a num_floats floats, its content is undefined
+   */
+  static float *acquire(size_t num_floats);
+
+  /**
+   * \brief give back a buffer from #acquire, for later acquisitions of the same size
+   */
+  static void release(float *buffer, size_t num_floats);
+
+  /**
+   * \brief whether acquiring \a mem_size more bytes exceeds the memory limit
+   */
+  static bool exceeds_limit(size_t mem_size);
+
+  /**
+   * \brief set the limit in bytes of the acquired buffers, 0 for no limit
+   */
+  static void set_memory_limit(size_t mem_limit);
+
+  /**
+   * \brief free the released buffers
+   */
+  static void clear();
+};
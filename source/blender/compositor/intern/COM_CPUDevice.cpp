@@ -24,13 +24,23 @@ CPUDevice::CPUDevice(int thread_id) : m_thread_id(thread_id)
 
 void CPUDevice::execute(WorkPackage *work)
 {
+  if (work->getExecuteFunction()) {
+    work->getExecuteFunction()();
+    return;
+  }
+
   const unsigned int chunkNumber = work->getChunkNumber();
   ExecutionGroup *executionGroup = work->getExecutionGroup();
   rcti rect;
 
   executionGroup->determineChunkRect(&rect, chunkNumber);
 
-  executionGroup->getOutputOperation()->executeRegion(&rect, chunkNumber);
+  /* Chunks still scheduled when the execution is canceled (e.g. restarted for another visible
+   * area) are skipped, but finalized so the execution group can finish. */
+  NodeOperation *operation = executionGroup->getOutputOperation();
+  if (!operation->isBraked()) {
+    operation->executeRegion(&rect, chunkNumber);
+  }
 
   executionGroup->finalizeChunkExecution(chunkNumber, nullptr);
 }
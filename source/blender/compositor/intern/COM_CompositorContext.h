@@ -255,6 +255,14 @@ class CompositorContext {
     return this->getbNodeTree()->chunksize;
   }
 
+  /**
+   * \brief get the way operations are executed
+   */
+  CompositorExecutionModel getExecutionModel() const
+  {
+    return (CompositorExecutionModel)this->getbNodeTree()->execution_mode;
+  }
+
   void setFastCalculation(bool fastCalculation)
   {
     this->m_fastCalculation = fastCalculation;
@@ -268,6 +276,15 @@ class CompositorContext {
     return (this->getbNodeTree()->flag & NTREE_COM_GROUPNODE_BUFFER) != 0;
   }
 
+  /**
+   * \brief should operations with a GPU shader be calculated on the GPU
+   * \see COM_EXECUTION_MODEL_FULL_FRAME
+   */
+  bool isGPUEnabled() const
+  {
+    return (this->getbNodeTree()->flag & NTREE_COM_GPU) != 0;
+  }
+
   /**
    * \brief Get the render percentage as a factor.
    * The compositor uses a factor i.o. a percentage.
@@ -614,6 +614,24 @@ void ExecutionGroup::setViewerBorder(float xmin, float xmax, float ymin, float y
   }
 }
 
+void ExecutionGroup::setViewerVisibleBorder(const rctf *border)
+{
+  NodeOperation *operation = this->getOutputOperation();
+
+  if (operation->isViewerOperation()) {
+    rcti visible;
+    BLI_rcti_init(&visible,
+                  floorf(border->xmin + 0.5f * this->m_width),
+                  ceilf(border->xmax + 0.5f * this->m_width),
+                  floorf(border->ymin + 0.5f * this->m_height),
+                  ceilf(border->ymax + 0.5f * this->m_height));
+    if (!BLI_rcti_isect(&this->m_viewerBorder, &visible, &this->m_viewerBorder)) {
+      /* Nothing visible, no chunks to calculate. */
+      BLI_rcti_init(&this->m_viewerBorder, 0, 0, 0, 0);
+    }
+  }
+}
+
 void ExecutionGroup::setRenderBorder(float xmin, float xmax, float ymin, float ymax)
 {
   NodeOperation *operation = this->getOutputOperation();
@@ -437,6 +437,13 @@ class ExecutionGroup {
    */
   void setViewerBorder(float xmin, float xmax, float ymin, float ymax);
 
+  /**
+   * \brief limit the viewer operation to the part of its image visible in the editors
+   * \note the coordinates are in pixels relative to the image center
+   * \see bNodeTree.viewer_visible_border
+   */
+  void setViewerVisibleBorder(const rctf *border);
+
   void setRenderBorder(float xmin, float xmax, float ymin, float ymax);
 
   /* allow the DebugInfo class to look at internals */
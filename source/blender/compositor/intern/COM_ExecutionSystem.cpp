@@ -28,6 +28,7 @@
 #include "COM_Converter.h"
 #include "COM_Debug.h"
 #include "COM_ExecutionGroup.h"
+#include "COM_FullFrameExecutionModel.h"
 #include "COM_NodeOperation.h"
 #include "COM_NodeOperationBuilder.h"
 #include "COM_ReadBufferOperation.h"
@@ -59,8 +60,10 @@ ExecutionSystem::ExecutionSystem(RenderData *rd,
     this->m_context.setQuality((CompositorQuality)editingtree->edit_quality);
   }
   this->m_context.setRendering(rendering);
-  this->m_context.setHasActiveOpenCLDevices(WorkScheduler::has_gpu_devices() &&
-                                            (editingtree->flag & NTREE_COM_OPENCL));
+  /* OpenCL devices only execute chunks of execution groups. */
+  this->m_context.setHasActiveOpenCLDevices(
+      WorkScheduler::has_gpu_devices() && (editingtree->flag & NTREE_COM_OPENCL) &&
+      this->m_context.getExecutionModel() == COM_EXECUTION_MODEL_TILED);
 
   this->m_context.setRenderData(rd);
   this->m_context.setViewSettings(viewSettings);
@@ -78,6 +81,9 @@ ExecutionSystem::ExecutionSystem(RenderData *rd,
   bool use_viewer_border = (editingtree->flag & NTREE_VIEWER_BORDER) &&
                            viewer_border->xmin < viewer_border->xmax &&
                            viewer_border->ymin < viewer_border->ymax;
+  /* Only the visible part of the viewer image is calculated when editing. */
+  const rctf *viewer_visible_border = &editingtree->viewer_visible_border;
+  const bool use_viewer_visible_border = !rendering && !BLI_rctf_is_empty(viewer_visible_border);
 
   editingtree->stats_draw(editingtree->sdh, TIP_("Compositing | Determining resolution"));
 
@@ -101,6 +107,9 @@ ExecutionSystem::ExecutionSystem(RenderData *rd,
       executionGroup->setViewerBorder(
           viewer_border->xmin, viewer_border->xmax, viewer_border->ymin, viewer_border->ymax);
     }
+    if (use_viewer_visible_border) {
+      executionGroup->setViewerVisibleBorder(viewer_visible_border);
+    }
   }
 
   //  DebugInfo::graphviz(this);
@@ -134,6 +143,12 @@ void ExecutionSystem::execute()
 
   DebugInfo::execute_started(this);
 
+  if (this->m_context.getExecutionModel() == COM_EXECUTION_MODEL_FULL_FRAME) {
+    FullFrameExecutionModel execution_model(this->m_context, this->m_operations);
+    execution_model.execute();
+    return;
+  }
+
   unsigned int order = 0;
   for (vector<NodeOperation *>::iterator iter = this->m_operations.begin();
        iter != this->m_operations.end();
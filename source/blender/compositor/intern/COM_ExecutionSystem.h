@@ -107,6 +107,16 @@ class ExecutionGroup;
  * \see ExecutionSystem.addReadWriteBufferOperations
  * \see NodeOperation.isComplex
  * \see ExecutionGroup class representing the ExecutionGroup
+ *
+ * \section EM_FullFrame Full-frame execution
+ * When the node tree uses the full-frame execution mode, no buffers or groups are added in
+ * Step4: every operation is calculated once for its whole area, inputs first, and its buffer is
+ * freed when all its readers are calculated.
+ * With GPU calculations enabled, operations that have a GPU shader are drawn on the GPU and
+ * their results stay there while GPU operations read them.
+ * \see FullFrameExecutionModel
+ * \see GPUDevice
+ * \see NodeOperation.update_memory_buffer
  */
 
 /**
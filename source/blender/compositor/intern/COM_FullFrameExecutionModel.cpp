@@ -0,0 +1,742 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <typeinfo>
+
+#include "COM_FullFrameExecutionModel.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_hash_mm2a.h"
+#include "BLI_rect.h"
+#include "BLI_string.h"
+
+#include "BLT_translation.h"
+
+#include "DNA_color_types.h"
+#include "DNA_node_types.h"
+#include "DNA_scene_types.h"
+
+#include "GPU_capabilities.h"
+
+#include "COM_BufferOperation.h"
+#include "COM_BufferPool.h"
+#include "COM_ReadBufferOperation.h"
+#include "COM_ResultCache.h"
+#include "COM_WorkScheduler.h"
+#include "COM_WriteBufferOperation.h"
+
+/**
+ * Two murmur hashes with different seeds, combined into a 64 bit cache key to make collisions
+ * between results unlikely.
+ */
+struct CacheKeyHash {
+  BLI_HashMurmur2A mm2[2];
+
+  CacheKeyHash()
+  {
+    BLI_hash_mm2a_init(&mm2[0], 0);
+    BLI_hash_mm2a_init(&mm2[1], 0x9e3779b9);
+  }
+
+  void add(const void *data, size_t len)
+  {
+    BLI_hash_mm2a_add(&mm2[0], (const unsigned char *)data, len);
+    BLI_hash_mm2a_add(&mm2[1], (const unsigned char *)data, len);
+  }
+
+  void add_int(int value)
+  {
+    add(&value, sizeof(value));
+  }
+
+  void add_string(const char *str)
+  {
+    add(str, strlen(str) + 1);
+  }
+
+  uint64_t end()
+  {
+    return ((uint64_t)BLI_hash_mm2a_end(&mm2[0]) << 32) | BLI_hash_mm2a_end(&mm2[1]);
+  }
+};
+
+FullFrameExecutionModel::FullFrameExecutionModel(CompositorContext &context,
+                                                 const std::vector<NodeOperation *> &operations)
+    : m_context(context),
+      m_operations(operations),
+      m_gpu_device(nullptr),
+      m_context_hash(0),
+      m_num_operations_finished(0)
+{
+}
+
+FullFrameExecutionModel::~FullFrameExecutionModel()
+{
+  /* Buffers of operations whose readers weren't calculated (fast calculation, cancel). */
+  for (std::map<NodeOperation *, MemoryBuffer *>::iterator it = m_buffers.begin();
+       it != m_buffers.end();
+       ++it) {
+    delete it->second;
+  }
+  m_buffers.clear();
+}
+
+void FullFrameExecutionModel::determine_readers()
+{
+  std::set<NodeOperation *> has_complex_reader;
+  for (NodeOperation *operation : m_operations) {
+    for (unsigned int index = 0; index < operation->getNumberOfInputSockets(); index++) {
+      NodeOperationInput *input = operation->getInputSocket(index);
+      if (!input->isConnected()) {
+        continue;
+      }
+      NodeOperation *input_operation = &input->getLink()->getOperation();
+      m_readers_left[input_operation]++;
+      if (operation->isComplex()) {
+        /* Complex operations may access the buffer of their inputs directly. */
+        has_complex_reader.insert(input_operation);
+      }
+    }
+    if (operation->isReadBufferOperation()) {
+      /* The buffer written for read buffer operations is freed after they are calculated. */
+      MemoryProxy *memory_proxy = ((ReadBufferOperation *)operation)->getMemoryProxy();
+      if (memory_proxy) {
+        m_readers_left[memory_proxy->getWriteBufferOperation()]++;
+      }
+    }
+  }
+
+  for (NodeOperation *operation : m_operations) {
+    if (operation->isSetOperation() && has_complex_reader.count(operation) == 0) {
+      m_single_value.insert(operation);
+    }
+  }
+}
+
+void FullFrameExecutionModel::execute()
+{
+  const bool is_rendering = m_context.isRendering();
+  const CompositorPriority priorities[] = {
+      COM_PRIORITY_HIGH, COM_PRIORITY_MEDIUM, COM_PRIORITY_LOW};
+
+  determine_readers();
+  m_context_hash = calculate_context_hash();
+
+  if (m_context.isGPUEnabled() && GPUDevice::is_available()) {
+    m_gpu_device = new GPUDevice();
+  }
+  WorkScheduler::start(m_context);
+
+  for (const CompositorPriority priority : priorities) {
+    if (priority != COM_PRIORITY_HIGH && m_context.isFastCalculation()) {
+      break;
+    }
+    for (NodeOperation *operation : m_operations) {
+      if (is_breaked()) {
+        break;
+      }
+      if (operation->isOutputOperation(is_rendering) &&
+          operation->getRenderPriority() == priority) {
+        execute_operation_recursive(operation);
+      }
+    }
+  }
+
+  WorkScheduler::stop();
+
+  if (m_gpu_device) {
+    free_textures();
+    delete m_gpu_device;
+    m_gpu_device = nullptr;
+  }
+
+  for (NodeOperation *operation : m_write_buffer_operations) {
+    operation->deinitExecution();
+  }
+  m_write_buffer_operations.clear();
+}
+
+void FullFrameExecutionModel::execute_operation_recursive(NodeOperation *operation)
+{
+  if (m_executed.count(operation)) {
+    return;
+  }
+  m_executed.insert(operation);
+
+  uint64_t cache_key;
+  if (is_cacheable(operation) && get_cache_key(operation, &cache_key)) {
+    MemoryBuffer *buffer = ResultCache::lookup(cache_key);
+    if (buffer) {
+      use_cached_buffer(operation, buffer);
+      return;
+    }
+  }
+
+  for (unsigned int index = 0; index < operation->getNumberOfInputSockets(); index++) {
+    NodeOperationInput *input = operation->getInputSocket(index);
+    if (input->isConnected()) {
+      execute_operation_recursive(&input->getLink()->getOperation());
+    }
+  }
+  if (operation->isReadBufferOperation()) {
+    /* Explicit buffers created by nodes are written by an operation not linked by sockets. */
+    MemoryProxy *memory_proxy = ((ReadBufferOperation *)operation)->getMemoryProxy();
+    if (memory_proxy) {
+      execute_operation_recursive(memory_proxy->getWriteBufferOperation());
+    }
+  }
+
+  execute_operation(operation);
+}
+
+void FullFrameExecutionModel::execute_operation(NodeOperation *operation)
+{
+  if (m_gpu_device && can_execute_on_gpu(operation) && execute_operation_on_gpu(operation)) {
+    return;
+  }
+
+  const unsigned int num_inputs = operation->getNumberOfInputSockets();
+  std::vector<MemoryBuffer *> input_buffers(num_inputs, nullptr);
+  std::vector<NodeOperationOutput *> input_links(num_inputs, nullptr);
+  std::vector<BufferOperation *> buffer_operations;
+
+  /* Read the calculated inputs instead of evaluating them again. */
+  for (unsigned int index = 0; index < num_inputs; index++) {
+    NodeOperationInput *input = operation->getInputSocket(index);
+    input_links[index] = input->getLink();
+    if (input_links[index] == nullptr) {
+      continue;
+    }
+    NodeOperation *input_operation = &input_links[index]->getOperation();
+    input_buffers[index] = get_input_buffer(input_operation);
+
+    BufferOperation *buffer_operation = new BufferOperation(
+        input_buffers[index],
+        input_links[index]->getDataType(),
+        input_operation->getWidth(),
+        input_operation->getHeight(),
+        m_single_value.count(input_operation) != 0);
+    buffer_operations.push_back(buffer_operation);
+    input->setLink(buffer_operation->getOutputSocket());
+  }
+
+  MemoryBuffer *output = nullptr;
+  if (operation->getWidth() > 0 && operation->getHeight() > 0 && !is_breaked()) {
+    if (operation->getNumberOfOutputSockets() > 0) {
+      output = create_output_buffer(operation);
+    }
+    operation->setbNodeTree(m_context.getbNodeTree());
+    operation->initExecution();
+    if (operation->isReadBufferOperation()) {
+      ((ReadBufferOperation *)operation)->updateMemoryBuffer();
+    }
+    calculate_areas(operation, output, input_buffers.data());
+    uint64_t cache_key;
+    if (output && !is_breaked() && is_cacheable(operation) &&
+        get_cache_key(operation, &cache_key)) {
+      ResultCache::store(cache_key, output);
+    }
+    if (operation->isWriteBufferOperation()) {
+      /* Keep the buffer of the memory proxy until its readers are calculated. */
+      m_write_buffer_operations.push_back(operation);
+    }
+    else {
+      operation->deinitExecution();
+    }
+  }
+
+  for (unsigned int index = 0; index < num_inputs; index++) {
+    operation->getInputSocket(index)->setLink(input_links[index]);
+  }
+  for (BufferOperation *buffer_operation : buffer_operations) {
+    delete buffer_operation;
+  }
+
+  if (output) {
+    if (m_readers_left[operation] > 0) {
+      m_buffers[operation] = output;
+    }
+    else {
+      delete output;
+    }
+  }
+  for (unsigned int index = 0; index < num_inputs; index++) {
+    if (input_links[index]) {
+      read_finished(&input_links[index]->getOperation());
+    }
+  }
+  read_memory_proxy_finished(operation);
+
+  m_num_operations_finished++;
+  update_progress();
+}
+
+/**
+ * Operations are calculated on the GPU when they have a shader and all their inputs have the
+ * size of the operation or are single values.
+ */
+bool FullFrameExecutionModel::can_execute_on_gpu(NodeOperation *operation) const
+{
+  const unsigned int num_inputs = operation->getNumberOfInputSockets();
+  const int width = operation->getWidth();
+  const int height = operation->getHeight();
+  if (operation->get_gpu_shader() == nullptr || m_single_value.count(operation) ||
+      operation->getNumberOfOutputSockets() != 1 || num_inputs > COM_GPU_MAX_INPUTS ||
+      width <= 0 || height <= 0 || width > GPU_max_texture_size() ||
+      height > GPU_max_texture_size() || is_breaked()) {
+    return false;
+  }
+  for (unsigned int index = 0; index < num_inputs; index++) {
+    NodeOperationInput *input = operation->getInputSocket(index);
+    if (!input->isConnected()) {
+      return false;
+    }
+    NodeOperation *input_operation = &input->getLink()->getOperation();
+    if (m_buffers.count(input_operation) == 0 && m_textures.count(input_operation) == 0) {
+      return false;
+    }
+    if (m_single_value.count(input_operation) == 0 &&
+        (input_operation->getWidth() != width || input_operation->getHeight() != height)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * \return false when the operation couldn't be calculated on the GPU (shader compilation or
+ * texture allocation failed), it is calculated on the CPU instead.
+ */
+bool FullFrameExecutionModel::execute_operation_on_gpu(NodeOperation *operation)
+{
+  const unsigned int num_inputs = operation->getNumberOfInputSockets();
+  GPUTexture *inputs[COM_GPU_MAX_INPUTS];
+  GPUTexture *output = nullptr;
+
+  m_gpu_device->activate();
+  GPUShader *shader = m_gpu_device->get_shader(operation);
+  bool has_inputs = shader != nullptr;
+  for (unsigned int index = 0; index < num_inputs && has_inputs; index++) {
+    NodeOperation *input_operation = &operation->getInputSocket(index)->getLink()->getOperation();
+    inputs[index] = get_input_texture(input_operation);
+    has_inputs = inputs[index] != nullptr;
+  }
+  if (has_inputs) {
+    output = m_gpu_device->execute(operation, shader, inputs);
+  }
+  if (output && m_readers_left[operation] == 0) {
+    m_gpu_device->free_texture(output);
+  }
+  m_gpu_device->deactivate();
+
+  if (output == nullptr) {
+    return false;
+  }
+  if (m_readers_left[operation] > 0) {
+    m_textures[operation] = output;
+  }
+  for (unsigned int index = 0; index < num_inputs; index++) {
+    read_finished(&operation->getInputSocket(index)->getLink()->getOperation());
+  }
+
+  m_num_operations_finished++;
+  update_progress();
+  return true;
+}
+
+/**
+ * Buffer of a calculated input, results on the GPU are downloaded the first time a CPU operation
+ * reads them.
+ */
+MemoryBuffer *FullFrameExecutionModel::get_input_buffer(NodeOperation *input_operation)
+{
+  std::map<NodeOperation *, MemoryBuffer *>::iterator it = m_buffers.find(input_operation);
+  if (it != m_buffers.end()) {
+    return it->second;
+  }
+  std::map<NodeOperation *, GPUTexture *>::iterator texture_it = m_textures.find(
+      input_operation);
+  if (texture_it == m_textures.end()) {
+    return nullptr;
+  }
+  m_gpu_device->activate();
+  MemoryBuffer *buffer = m_gpu_device->download(
+      texture_it->second, input_operation->getOutputSocket()->getDataType());
+  m_gpu_device->deactivate();
+  m_buffers[input_operation] = buffer;
+  return buffer;
+}
+
+/**
+ * Texture of a calculated input, results on the CPU are uploaded the first time a GPU operation
+ * reads them.
+ * \note only call while the GPUDevice is active.
+ */
+GPUTexture *FullFrameExecutionModel::get_input_texture(NodeOperation *input_operation)
+{
+  std::map<NodeOperation *, GPUTexture *>::iterator it = m_textures.find(input_operation);
+  if (it != m_textures.end()) {
+    return it->second;
+  }
+  GPUTexture *texture = m_gpu_device->upload(m_buffers[input_operation]);
+  if (texture) {
+    m_textures[input_operation] = texture;
+  }
+  return texture;
+}
+
+void FullFrameExecutionModel::free_textures()
+{
+  m_gpu_device->activate();
+  for (std::map<NodeOperation *, GPUTexture *>::iterator it = m_textures.begin();
+       it != m_textures.end();
+       ++it) {
+    m_gpu_device->free_texture(it->second);
+  }
+  m_textures.clear();
+  m_gpu_device->deactivate();
+}
+
+MemoryBuffer *FullFrameExecutionModel::create_output_buffer(NodeOperation *operation)
+{
+  rcti rect;
+  const bool is_a_single_elem = m_single_value.count(operation) != 0;
+  if (is_a_single_elem) {
+    BLI_rcti_init(&rect, 0, 1, 0, 1);
+  }
+  else {
+    BLI_rcti_init(&rect, 0, operation->getWidth(), 0, operation->getHeight());
+  }
+  /* At most, value and vector buffers have less channels. */
+  const size_t mem_size = sizeof(float) * COM_NUM_CHANNELS_COLOR * BLI_rcti_size_x(&rect) *
+                          BLI_rcti_size_y(&rect);
+  if (BufferPool::exceeds_limit(mem_size)) {
+    /* Cached results can be calculated again, free them instead of exceeding the limit. */
+    ResultCache::free_memory(mem_size);
+  }
+  return new MemoryBuffer(operation->getOutputSocket()->getDataType(), &rect, is_a_single_elem);
+}
+
+void FullFrameExecutionModel::calculate_areas(NodeOperation *operation,
+                                              MemoryBuffer *output,
+                                              MemoryBuffer **inputs)
+{
+  rcti area;
+  if (output && m_single_value.count(operation)) {
+    BLI_rcti_init(&area, 0, 1, 0, 1);
+    operation->update_memory_buffer(output, &area, inputs);
+    return;
+  }
+
+  rcti op_area;
+  if (!get_calculated_area(operation, &op_area)) {
+    return;
+  }
+  if (operation->isSingleThreaded()) {
+    operation->update_memory_buffer(output, &op_area, inputs);
+    return;
+  }
+
+  /* Split in chunks, so areas can be calculated by multiple threads. */
+  const int chunk_size = m_context.getChunksize();
+  for (int ymin = op_area.ymin; ymin < op_area.ymax; ymin += chunk_size) {
+    for (int xmin = op_area.xmin; xmin < op_area.xmax; xmin += chunk_size) {
+      BLI_rcti_init(&area,
+                    xmin,
+                    min(xmin + chunk_size, op_area.xmax),
+                    ymin,
+                    min(ymin + chunk_size, op_area.ymax));
+      WorkScheduler::schedule_function([=]() {
+        /* Skip the chunks still scheduled when the execution is canceled. */
+        if (is_breaked()) {
+          return;
+        }
+        rcti chunk_area = area;
+        operation->update_memory_buffer(output, &chunk_area, inputs);
+      });
+    }
+  }
+  WorkScheduler::finish();
+}
+
+/**
+ * Viewer operations are limited to the viewer border and, when editing, to the part of their
+ * image visible in the editors. Other operations calculate their whole area.
+ * \return false when there is nothing to calculate.
+ */
+bool FullFrameExecutionModel::get_calculated_area(NodeOperation *operation, rcti *r_area) const
+{
+  const int width = operation->getWidth();
+  const int height = operation->getHeight();
+  BLI_rcti_init(r_area, 0, width, 0, height);
+  if (!operation->isViewerOperation()) {
+    return true;
+  }
+
+  const bNodeTree *ntree = m_context.getbNodeTree();
+  const rctf *viewer_border = &ntree->viewer_border;
+  if ((ntree->flag & NTREE_VIEWER_BORDER) && !BLI_rctf_is_empty(viewer_border)) {
+    rcti border;
+    BLI_rcti_init(&border,
+                  viewer_border->xmin * width,
+                  viewer_border->xmax * width,
+                  viewer_border->ymin * height,
+                  viewer_border->ymax * height);
+    if (!BLI_rcti_isect(r_area, &border, r_area)) {
+      return false;
+    }
+  }
+
+  const rctf *visible_border = &ntree->viewer_visible_border;
+  if (!m_context.isRendering() && !BLI_rctf_is_empty(visible_border)) {
+    rcti visible;
+    BLI_rcti_init(&visible,
+                  floorf(visible_border->xmin + 0.5f * width),
+                  ceilf(visible_border->xmax + 0.5f * width),
+                  floorf(visible_border->ymin + 0.5f * height),
+                  ceilf(visible_border->ymax + 0.5f * height));
+    if (!BLI_rcti_isect(r_area, &visible, r_area)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void FullFrameExecutionModel::read_finished(NodeOperation *operation)
+{
+  if (--m_readers_left[operation] > 0) {
+    return;
+  }
+  if (m_executed.count(operation) == 0) {
+    /* All readers used cached results, release the inputs of this operation too. */
+    m_executed.insert(operation);
+    for (unsigned int index = 0; index < operation->getNumberOfInputSockets(); index++) {
+      NodeOperationInput *input = operation->getInputSocket(index);
+      if (input->isConnected()) {
+        read_finished(&input->getLink()->getOperation());
+      }
+    }
+    read_memory_proxy_finished(operation);
+    m_num_operations_finished++;
+    return;
+  }
+  /* Last reader calculated, the buffer is not needed anymore. */
+  std::map<NodeOperation *, MemoryBuffer *>::iterator it = m_buffers.find(operation);
+  if (it != m_buffers.end()) {
+    delete it->second;
+    m_buffers.erase(it);
+  }
+  std::map<NodeOperation *, GPUTexture *>::iterator texture_it = m_textures.find(operation);
+  if (texture_it != m_textures.end()) {
+    m_gpu_device->activate();
+    m_gpu_device->free_texture(texture_it->second);
+    m_gpu_device->deactivate();
+    m_textures.erase(texture_it);
+  }
+  if (operation->isWriteBufferOperation()) {
+    /* All read buffer operations are calculated, free the buffer of the memory proxy. */
+    std::vector<NodeOperation *>::iterator write_it = std::find(
+        m_write_buffer_operations.begin(), m_write_buffer_operations.end(), operation);
+    if (write_it != m_write_buffer_operations.end()) {
+      operation->deinitExecution();
+      m_write_buffer_operations.erase(write_it);
+    }
+  }
+}
+
+/**
+ * The buffer of the memory proxy read by \a operation is freed when all its read buffer
+ * operations are calculated, instead of at the end of the execution.
+ */
+void FullFrameExecutionModel::read_memory_proxy_finished(NodeOperation *operation)
+{
+  if (operation->isReadBufferOperation()) {
+    MemoryProxy *memory_proxy = ((ReadBufferOperation *)operation)->getMemoryProxy();
+    if (memory_proxy) {
+      read_finished(memory_proxy->getWriteBufferOperation());
+    }
+  }
+}
+
+uint64_t FullFrameExecutionModel::calculate_context_hash() const
+{
+  CacheKeyHash hash;
+  const RenderData *rd = m_context.getRenderData();
+  hash.add_int(m_context.getFramenumber());
+  hash.add_int(m_context.getQuality());
+  hash.add_int(m_context.isRendering());
+  hash.add_int(m_context.isFastCalculation());
+  hash.add_string(m_context.getViewName() ? m_context.getViewName() : "");
+  if (rd) {
+    hash.add_int(rd->size);
+    hash.add_int(rd->xsch);
+    hash.add_int(rd->ysch);
+  }
+  const ColorManagedViewSettings *view_settings = m_context.getViewSettings();
+  if (view_settings) {
+    hash.add_int(view_settings->flag);
+    hash.add_string(view_settings->look);
+    hash.add_string(view_settings->view_transform);
+    hash.add(&view_settings->exposure, sizeof(float));
+    hash.add(&view_settings->gamma, sizeof(float));
+  }
+  const ColorManagedDisplaySettings *display_settings = m_context.getDisplaySettings();
+  if (display_settings) {
+    hash.add_string(display_settings->display_device);
+  }
+  return hash.end();
+}
+
+/**
+ * Only complex operations (filters) are worth caching, other operations are faster to calculate
+ * again than the memory they would take. Sources are identified by their content so they are
+ * always calculated.
+ */
+bool FullFrameExecutionModel::is_cacheable(NodeOperation *operation) const
+{
+  return operation->isComplex() && operation->getNumberOfInputSockets() > 0 &&
+         operation->getNumberOfOutputSockets() > 0 &&
+         !operation->isReadBufferOperation() && !operation->isWriteBufferOperation() &&
+         m_single_value.count(operation) == 0 && operation->getWidth() > 0 &&
+         operation->getHeight() > 0;
+}
+
+bool FullFrameExecutionModel::get_cache_key(NodeOperation *operation, uint64_t *r_key)
+{
+  std::map<NodeOperation *, CacheKey>::iterator it = m_cache_keys.find(operation);
+  if (it == m_cache_keys.end()) {
+    it = m_cache_keys.insert(std::make_pair(operation, calculate_cache_key(operation))).first;
+  }
+  *r_key = it->second.hash;
+  return it->second.is_valid;
+}
+
+FullFrameExecutionModel::CacheKey FullFrameExecutionModel::calculate_cache_key(
+    NodeOperation *operation)
+{
+  CacheKey key = {false, 0};
+  if (operation->isReadBufferOperation()) {
+    /* Result of the operation writing the memory proxy. */
+    MemoryProxy *memory_proxy = ((ReadBufferOperation *)operation)->getMemoryProxy();
+    if (memory_proxy) {
+      key.is_valid = get_cache_key(memory_proxy->getWriteBufferOperation(), &key.hash);
+    }
+    return key;
+  }
+
+  const unsigned int num_inputs = operation->getNumberOfInputSockets();
+  const bNode *node = operation->getbNode();
+  if (node && node->id && num_inputs > 0) {
+    /* Data-blocks used by the node (scene camera, movie clip tracking...) can change without the
+     * node tree changing. */
+    return key;
+  }
+
+  CacheKeyHash hash;
+  hash.add(&m_context_hash, sizeof(m_context_hash));
+  hash.add_string(typeid(*operation).name());
+  hash.add_int(operation->getWidth());
+  hash.add_int(operation->getHeight());
+  if (node) {
+    hash.add_int(node->type);
+    hash.add_int(operation->getbNodeOperationIndex());
+    hash.add_int(node->custom1);
+    hash.add_int(node->custom2);
+    hash.add(&node->custom3, sizeof(float));
+    hash.add(&node->custom4, sizeof(float));
+    if (node->storage) {
+      /* Pointers in the storage are duplicated when the node tree is localized, so storage
+       * containing pointers doesn't match between executions and is never found in the cache. */
+      hash.add(node->storage, MEM_allocN_len(node->storage));
+    }
+  }
+
+  if (num_inputs == 0) {
+    /* Sources (images, render layers, values...) are identified by their content, which can
+     * change without any setting changing. */
+    execute_operation_recursive(operation);
+    std::map<NodeOperation *, MemoryBuffer *>::iterator it = m_buffers.find(operation);
+    if (it != m_buffers.end()) {
+      MemoryBuffer *buffer = it->second;
+      hash.add(buffer->getBuffer(),
+               sizeof(float) * buffer->getWidth() * buffer->getHeight() *
+                   buffer->get_num_channels());
+    }
+  }
+  for (unsigned int index = 0; index < num_inputs; index++) {
+    NodeOperationInput *input = operation->getInputSocket(index);
+    uint64_t input_key = 0;
+    if (input->isConnected() && !get_cache_key(&input->getLink()->getOperation(), &input_key)) {
+      return key;
+    }
+    hash.add(&input_key, sizeof(input_key));
+  }
+
+  key.hash = hash.end();
+  key.is_valid = true;
+  return key;
+}
+
+void FullFrameExecutionModel::use_cached_buffer(NodeOperation *operation, MemoryBuffer *buffer)
+{
+  if (m_readers_left[operation] > 0) {
+    m_buffers[operation] = buffer;
+  }
+  else {
+    delete buffer;
+  }
+  /* Inputs aren't calculated for this reader. */
+  for (unsigned int index = 0; index < operation->getNumberOfInputSockets(); index++) {
+    NodeOperationInput *input = operation->getInputSocket(index);
+    if (input->isConnected()) {
+      read_finished(&input->getLink()->getOperation());
+    }
+  }
+
+  m_num_operations_finished++;
+  update_progress();
+}
+
+void FullFrameExecutionModel::update_progress()
+{
+  const bNodeTree *ntree = m_context.getbNodeTree();
+  const unsigned int num_operations = m_operations.size();
+
+  if (ntree->progress) {
+    float progress = m_num_operations_finished;
+    progress /= num_operations;
+    ntree->progress(ntree->prh, progress);
+  }
+
+  char buf[128];
+  BLI_snprintf(buf,
+               sizeof(buf),
+               TIP_("Compositing | Operation %u-%u"),
+               m_num_operations_finished,
+               num_operations);
+  ntree->stats_draw(ntree->sdh, buf);
+}
+
+bool FullFrameExecutionModel::is_breaked() const
+{
+  const bNodeTree *ntree = m_context.getbNodeTree();
+  return ntree->test_break && ntree->test_break(ntree->tbh);
+}
@@ -0,0 +1,127 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "COM_CompositorContext.h"
+#include "COM_GPUDevice.h"
+#include "COM_MemoryBuffer.h"
+#include "COM_NodeOperation.h"
+
+/**
+ * \brief Executes the operations of an ExecutionSystem in the full-frame execution model.
+ *
+ * Every operation is calculated once for its whole area into a MemoryBuffer, in topological
+ * order (inputs first), areas being distributed among the WorkScheduler threads. An operation
+ * buffer is freed as soon as all operations reading it are calculated.
+ *
+ * Inputs of an operation are replaced by BufferOperation's during its calculation so operations
+ * that only implement the per pixel methods read the calculated buffers instead of evaluating
+ * their inputs again.
+ *
+ * Results of complex operations are kept in the ResultCache between executions, identified by a
+ * key hashing the operation settings and the keys of its inputs. When the result is cached, the
+ * inputs of the operation aren't calculated.
+ *
+ * When GPU calculations are enabled, operations with a GPU shader are calculated by the
+ * GPUDevice. Their results stay on the GPU as long as only GPU operations read them.
+ *
+ * \see COM_EXECUTION_MODEL_FULL_FRAME
+ * \see NodeOperation.update_memory_buffer
+ * \ingroup Execution
+ */
+class FullFrameExecutionModel {
+ private:
+  CompositorContext &m_context;
+  const std::vector<NodeOperation *> &m_operations;
+
+  /** \brief calculated operation buffers that still have readers */
+  std::map<NodeOperation *, MemoryBuffer *> m_buffers;
+
+  /** \brief calculated operation textures on the GPU that still have readers */
+  std::map<NodeOperation *, GPUTexture *> m_textures;
+
+  /** \brief device calculating operations with a GPU shader, nullptr when disabled */
+  GPUDevice *m_gpu_device;
+
+  /** \brief number of input sockets reading an operation that aren't calculated yet */
+  std::map<NodeOperation *, int> m_readers_left;
+
+  /** \brief operations only storing a single value (set operations without complex readers) */
+  std::set<NodeOperation *> m_single_value;
+
+  /**
+   * \brief write buffer operations, de-initialized (freeing their buffer) when their read buffer
+   * operations are calculated
+   */
+  std::vector<NodeOperation *> m_write_buffer_operations;
+
+  /** \brief key identifying the result of an operation in the ResultCache */
+  struct CacheKey {
+    bool is_valid;
+    uint64_t hash;
+  };
+  std::map<NodeOperation *, CacheKey> m_cache_keys;
+
+  /** \brief hash of the context settings operations may depend on, part of all cache keys */
+  uint64_t m_context_hash;
+
+  std::set<NodeOperation *> m_executed;
+  unsigned int m_num_operations_finished;
+
+ public:
+  FullFrameExecutionModel(CompositorContext &context,
+                          const std::vector<NodeOperation *> &operations);
+  ~FullFrameExecutionModel();
+
+  /**
+   * \brief calculate all output operations, by order of priority
+   */
+  void execute();
+
+ private:
+  void determine_readers();
+  void execute_operation_recursive(NodeOperation *operation);
+  void execute_operation(NodeOperation *operation);
+  bool execute_operation_on_gpu(NodeOperation *operation);
+  bool can_execute_on_gpu(NodeOperation *operation) const;
+  MemoryBuffer *get_input_buffer(NodeOperation *input_operation);
+  GPUTexture *get_input_texture(NodeOperation *input_operation);
+  void free_textures();
+  MemoryBuffer *create_output_buffer(NodeOperation *operation);
+  void calculate_areas(NodeOperation *operation, MemoryBuffer *output, MemoryBuffer **inputs);
+  bool get_calculated_area(NodeOperation *operation, rcti *r_area) const;
+  void read_finished(NodeOperation *operation);
+  void read_memory_proxy_finished(NodeOperation *operation);
+  uint64_t calculate_context_hash() const;
+  bool is_cacheable(NodeOperation *operation) const;
+  bool get_cache_key(NodeOperation *operation, uint64_t *r_key);
+  CacheKey calculate_cache_key(NodeOperation *operation);
+  void use_cached_buffer(NodeOperation *operation, MemoryBuffer *buffer);
+  void update_progress();
+  bool is_breaked() const;
+
+#ifdef WITH_CXX_GUARDEDALLOC
+  MEM_CXX_CLASS_ALLOC_FUNCS("COM:FullFrameExecutionModel")
+#endif
+};
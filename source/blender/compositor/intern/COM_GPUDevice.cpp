@@ -0,0 +1,196 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ */
+
+#include "COM_GPUDevice.h"
+#include "COM_GPUShaders.glsl.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_rect.h"
+#include "BLI_string.h"
+
+#include "BKE_global.h"
+
+#include "DRW_engine.h"
+
+#include "GPU_batch.h"
+#include "GPU_batch_presets.h"
+#include "GPU_framebuffer.h"
+#include "GPU_shader.h"
+#include "GPU_state.h"
+#include "GPU_texture.h"
+
+static eGPUTextureFormat get_texture_format(unsigned int num_channels)
+{
+  /* Three channel formats can't be drawn to, vectors use the alpha channel as padding. */
+  return (num_channels == 1) ? GPU_R32F : GPU_RGBA32F;
+}
+
+GPUDevice::GPUDevice()
+{
+  this->m_framebuffer = nullptr;
+}
+
+GPUDevice::~GPUDevice()
+{
+  activate();
+  for (std::map<std::string, GPUShader *>::iterator it = m_shaders.begin();
+       it != m_shaders.end();
+       ++it) {
+    if (it->second) {
+      GPU_shader_free(it->second);
+    }
+  }
+  m_shaders.clear();
+  GPU_FRAMEBUFFER_FREE_SAFE(m_framebuffer);
+  deactivate();
+}
+
+bool GPUDevice::is_available()
+{
+  return !G.background;
+}
+
+void GPUDevice::activate()
+{
+  DRW_opengl_context_enable();
+}
+
+void GPUDevice::deactivate()
+{
+  DRW_opengl_context_disable();
+}
+
+GPUShader *GPUDevice::get_shader(NodeOperation *operation)
+{
+  const char *name = operation->get_gpu_shader();
+  std::map<std::string, GPUShader *>::iterator it = m_shaders.find(name);
+  if (it != m_shaders.end()) {
+    return it->second;
+  }
+
+  char defines[64];
+  BLI_snprintf(defines, sizeof(defines), "#define %s\n", name);
+  GPUShader *shader = GPU_shader_create(datatoc_COM_GPUShaders_glsl,
+                                        datatoc_COM_GPUShaders_glsl,
+                                        nullptr,
+                                        nullptr,
+                                        defines,
+                                        "compositor_operation");
+  m_shaders[name] = shader;
+  return shader;
+}
+
+GPUTexture *GPUDevice::upload(MemoryBuffer *buffer)
+{
+  const unsigned int num_channels = buffer->get_num_channels();
+  const int width = buffer->getWidth();
+  const int height = buffer->getHeight();
+  const float *data = buffer->getBuffer();
+  float *padded = nullptr;
+
+  if (num_channels == COM_NUM_CHANNELS_VECTOR) {
+    padded = (float *)MEM_mallocN(sizeof(float) * COM_NUM_CHANNELS_COLOR * width * height,
+                                  __func__);
+    for (int i = 0; i < width * height; i++) {
+      copy_v3_v3(&padded[i * COM_NUM_CHANNELS_COLOR], &data[i * COM_NUM_CHANNELS_VECTOR]);
+      padded[i * COM_NUM_CHANNELS_COLOR + 3] = 0.0f;
+    }
+    data = padded;
+  }
+
+  GPUTexture *texture = GPU_texture_create_2d(
+      "compositor_input", width, height, 1, get_texture_format(num_channels), data);
+
+  if (padded) {
+    MEM_freeN(padded);
+  }
+  return texture;
+}
+
+MemoryBuffer *GPUDevice::download(GPUTexture *texture, DataType data_type)
+{
+  rcti rect;
+  BLI_rcti_init(&rect, 0, GPU_texture_width(texture), 0, GPU_texture_height(texture));
+  MemoryBuffer *buffer = new MemoryBuffer(data_type, &rect);
+  const unsigned int num_channels = buffer->get_num_channels();
+  const int num_elems = buffer->getWidth() * buffer->getHeight();
+
+  float *data = (float *)GPU_texture_read(texture, GPU_DATA_FLOAT, 0);
+  if (num_channels == COM_NUM_CHANNELS_VECTOR) {
+    for (int i = 0; i < num_elems; i++) {
+      copy_v3_v3(&buffer->getBuffer()[i * COM_NUM_CHANNELS_VECTOR],
+                 &data[i * COM_NUM_CHANNELS_COLOR]);
+    }
+  }
+  else {
+    memcpy(buffer->getBuffer(), data, sizeof(float) * num_channels * num_elems);
+  }
+  MEM_freeN(data);
+  return buffer;
+}
+
+GPUTexture *GPUDevice::execute(NodeOperation *operation, GPUShader *shader, GPUTexture **inputs)
+{
+  const DataType data_type = operation->getOutputSocket()->getDataType();
+  const unsigned int num_channels = (data_type == COM_DT_VALUE) ? 1 : COM_NUM_CHANNELS_COLOR;
+  GPUTexture *output = GPU_texture_create_2d("compositor_operation",
+                                             operation->getWidth(),
+                                             operation->getHeight(),
+                                             1,
+                                             get_texture_format(num_channels),
+                                             nullptr);
+  if (output == nullptr) {
+    return nullptr;
+  }
+
+  GPU_framebuffer_ensure_config(&m_framebuffer,
+                                {GPU_ATTACHMENT_NONE, GPU_ATTACHMENT_TEXTURE(output)});
+  GPU_framebuffer_bind(m_framebuffer);
+  GPU_blend(GPU_BLEND_NONE);
+  GPU_depth_test(GPU_DEPTH_NONE);
+
+  GPU_shader_bind(shader);
+  const unsigned int num_inputs = operation->getNumberOfInputSockets();
+  for (unsigned int index = 0; index < num_inputs; index++) {
+    char name[16];
+    BLI_snprintf(name, sizeof(name), "input%u", index);
+    const int binding = GPU_shader_get_texture_binding(shader, name);
+    if (binding != -1) {
+      GPU_texture_bind(inputs[index], binding);
+    }
+  }
+  operation->set_gpu_uniforms(shader);
+
+  GPUBatch *batch = GPU_batch_preset_quad();
+  GPU_batch_set_shader(batch, shader);
+  GPU_batch_draw(batch);
+
+  for (unsigned int index = 0; index < num_inputs; index++) {
+    GPU_texture_unbind(inputs[index]);
+  }
+  GPU_shader_unbind();
+  GPU_framebuffer_restore();
+
+  return output;
+}
+
+void GPUDevice::free_texture(GPUTexture *texture)
+{
+  GPU_texture_free(texture);
+}
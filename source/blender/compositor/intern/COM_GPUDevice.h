@@ -0,0 +1,107 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "COM_MemoryBuffer.h"
+#include "COM_NodeOperation.h"
+
+struct GPUFrameBuffer;
+struct GPUShader;
+struct GPUTexture;
+
+/**
+ * \brief maximum number of input sockets of operations calculated on the GPU
+ */
+#define COM_GPU_MAX_INPUTS 3
+
+/**
+ * \brief Calculates operations with GPU shaders in the full-frame execution model.
+ *
+ * Operations results are GPUTexture's with the size of the operation, they stay on the GPU so
+ * chains of GPU operations don't copy intermediate results to main memory. Results of CPU
+ * operations are uploaded when a GPU operation reads them, results of GPU operations are
+ * downloaded when a CPU operation reads them.
+ *
+ * The shaders of all operations are in COM_GPUShaders.glsl, selected by the define set with
+ * NodeOperation.setGPUShader. Operations without shader, or whose shader doesn't compile, are
+ * calculated on the CPU.
+ *
+ * GPU calls are only valid between #activate and #deactivate, which make the GPU context of the
+ * draw manager current in the calling thread.
+ *
+ * \see FullFrameExecutionModel
+ * \ingroup Execution
+ */
+class GPUDevice {
+ private:
+  /**
+   * \brief compiled shaders by name, nullptr when compiling failed
+   */
+  std::map<std::string, GPUShader *> m_shaders;
+
+  /**
+   * \brief frame-buffer the result textures are attached to while being drawn
+   */
+  GPUFrameBuffer *m_framebuffer;
+
+ public:
+  GPUDevice();
+  ~GPUDevice();
+
+  /**
+   * \brief can operations be calculated on the GPU
+   * \note there is no GPU context in background mode
+   */
+  static bool is_available();
+
+  void activate();
+  void deactivate();
+
+  /**
+   * \brief get the shader of operation, compiled on first use
+   * \return nullptr when the shader doesn't compile
+   */
+  GPUShader *get_shader(NodeOperation *operation);
+
+  /**
+   * \brief create a texture with the content of buffer
+   */
+  GPUTexture *upload(MemoryBuffer *buffer);
+
+  /**
+   * \brief create a buffer with the content of texture, for readers calculated on the CPU
+   */
+  MemoryBuffer *download(GPUTexture *texture, DataType data_type);
+
+  /**
+   * \brief draw the shader of operation into a new texture
+   * \param inputs: textures of the input sockets
+   * \return the result, nullptr when the texture can't be allocated
+   */
+  GPUTexture *execute(NodeOperation *operation, GPUShader *shader, GPUTexture **inputs);
+
+  void free_texture(GPUTexture *texture);
+
+#ifdef WITH_CXX_GUARDEDALLOC
+  MEM_CXX_CLASS_ALLOC_FUNCS("COM:GPUDevice")
+#endif
+};
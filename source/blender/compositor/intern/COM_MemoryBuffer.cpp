@@ -18,6 +18,8 @@
 
 #include "COM_MemoryBuffer.h"
 
+#include "COM_BufferPool.h"
+
 #include "MEM_guardedalloc.h"
 
 using std::max;
@@ -58,10 +60,10 @@ MemoryBuffer::MemoryBuffer(MemoryProxy *memoryProxy, unsigned int chunkNumber, r
   this->m_memoryProxy = memoryProxy;
   this->m_chunkNumber = chunkNumber;
   this->m_num_channels = determine_num_channels(memoryProxy->getDataType());
-  this->m_buffer = (float *)MEM_mallocN_aligned(
-      sizeof(float) * determineBufferSize() * this->m_num_channels, 16, "COM_MemoryBuffer");
+  this->m_buffer = BufferPool::acquire(determineBufferSize() * this->m_num_channels);
   this->m_state = COM_MB_ALLOCATED;
   this->m_datatype = memoryProxy->getDataType();
+  this->m_is_a_single_elem = false;
 }
 
 MemoryBuffer::MemoryBuffer(MemoryProxy *memoryProxy, rcti *rect)
@@ -72,12 +74,12 @@ MemoryBuffer::MemoryBuffer(MemoryProxy *memoryProxy, rcti *rect)
   this->m_memoryProxy = memoryProxy;
   this->m_chunkNumber = -1;
   this->m_num_channels = determine_num_channels(memoryProxy->getDataType());
-  this->m_buffer = (float *)MEM_mallocN_aligned(
-      sizeof(float) * determineBufferSize() * this->m_num_channels, 16, "COM_MemoryBuffer");
+  this->m_buffer = BufferPool::acquire(determineBufferSize() * this->m_num_channels);
   this->m_state = COM_MB_TEMPORARILY;
   this->m_datatype = memoryProxy->getDataType();
+  this->m_is_a_single_elem = false;
 }
-MemoryBuffer::MemoryBuffer(DataType dataType, rcti *rect)
+MemoryBuffer::MemoryBuffer(DataType dataType, rcti *rect, bool is_a_single_elem)
 {
   BLI_rcti_init(&this->m_rect, rect->xmin, rect->xmax, rect->ymin, rect->ymax);
   this->m_width = BLI_rcti_size_x(&this->m_rect);
@@ -86,14 +88,21 @@ MemoryBuffer::MemoryBuffer(DataType dataType, rcti *rect)
   this->m_memoryProxy = nullptr;
   this->m_chunkNumber = -1;
   this->m_num_channels = determine_num_channels(dataType);
-  this->m_buffer = (float *)MEM_mallocN_aligned(
-      sizeof(float) * determineBufferSize() * this->m_num_channels, 16, "COM_MemoryBuffer");
+  this->m_buffer = BufferPool::acquire(determineBufferSize() * this->m_num_channels);
   this->m_state = COM_MB_TEMPORARILY;
   this->m_datatype = dataType;
+  this->m_is_a_single_elem = is_a_single_elem;
 }
 MemoryBuffer *MemoryBuffer::duplicate()
 {
-  MemoryBuffer *result = new MemoryBuffer(this->m_memoryProxy, &this->m_rect);
+  MemoryBuffer *result;
+  if (this->m_memoryProxy) {
+    result = new MemoryBuffer(this->m_memoryProxy, &this->m_rect);
+  }
+  else {
+    /* Buffers of the full-frame execution model don't belong to a memory proxy. */
+    result = new MemoryBuffer(this->m_datatype, &this->m_rect, this->m_is_a_single_elem);
+  }
   memcpy(result->m_buffer,
          this->m_buffer,
          this->determineBufferSize() * this->m_num_channels * sizeof(float));
@@ -104,6 +113,24 @@ void MemoryBuffer::clear()
   memset(this->m_buffer, 0, this->determineBufferSize() * this->m_num_channels * sizeof(float));
 }
 
+void MemoryBuffer::fill(const rcti *area, const float *value)
+{
+  rcti rect_clamp;
+  if (!BLI_rcti_isect(area, &this->m_rect, &rect_clamp)) {
+    return;
+  }
+  const size_t elem_size = sizeof(float) * this->m_num_channels;
+  for (int y = rect_clamp.ymin; y < rect_clamp.ymax; y++) {
+    float *elem = &this->m_buffer[((y - this->m_rect.ymin) * this->m_width +
+                                   (rect_clamp.xmin - this->m_rect.xmin)) *
+                                  this->m_num_channels];
+    for (int x = rect_clamp.xmin; x < rect_clamp.xmax; x++) {
+      memcpy(elem, value, elem_size);
+      elem += this->m_num_channels;
+    }
+  }
+}
+
 float MemoryBuffer::getMaximumValue()
 {
   float result = this->m_buffer[0];
@@ -144,7 +171,7 @@ float MemoryBuffer::getMaximumValue(rcti *rect)
 MemoryBuffer::~MemoryBuffer()
 {
   if (this->m_buffer) {
-    MEM_freeN(this->m_buffer);
+    BufferPool::release(this->m_buffer, determineBufferSize() * this->m_num_channels);
     this->m_buffer = nullptr;
   }
 }
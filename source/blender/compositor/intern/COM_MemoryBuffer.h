@@ -94,6 +94,11 @@ class MemoryBuffer {
   int m_width;
   int m_height;
 
+  /**
+   * \brief whether the buffer stores one element that is used for all pixels of its operation
+   */
+  bool m_is_a_single_elem;
+
  public:
   /**
    * \brief construct new MemoryBuffer for a chunk
@@ -107,8 +112,9 @@ class MemoryBuffer {
 
   /**
    * \brief construct new temporarily MemoryBuffer for an area
+   * \param is_a_single_elem: the buffer stores a single value used for all pixels
    */
-  MemoryBuffer(DataType datatype, rcti *rect);
+  MemoryBuffer(DataType datatype, rcti *rect, bool is_a_single_elem = false);
 
   /**
    * \brief destructor
@@ -137,6 +143,14 @@ class MemoryBuffer {
     return this->m_buffer;
   }
 
+  /**
+   * \brief does this buffer store a single element for all pixels of its operation
+   */
+  bool is_a_single_elem() const
+  {
+    return this->m_is_a_single_elem;
+  }
+
   /**
    * \brief after execution the state will be set to available by calling this method
    */
@@ -344,6 +358,11 @@ class MemoryBuffer {
    */
   void clear();
 
+  /**
+   * \brief set all pixels of \a area to \a value, which has a float per channel
+   */
+  void fill(const rcti *area, const float *value);
+
   MemoryBuffer *duplicate();
 
   float getMaximumValue();
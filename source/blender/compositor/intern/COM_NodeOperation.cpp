@@ -36,7 +36,11 @@ NodeOperation::NodeOperation()
   this->m_height = 0;
   this->m_isResolutionSet = false;
   this->m_openCL = false;
+  this->m_row_update = false;
+  this->m_gpu_shader = nullptr;
   this->m_btree = nullptr;
+  this->m_bnode = nullptr;
+  this->m_bnode_operation_index = 0;
 }
 
 NodeOperation::~NodeOperation()
@@ -134,6 +138,99 @@ void NodeOperation::deinitExecution()
 {
   /* pass */
 }
+
+void NodeOperation::update_memory_buffer(MemoryBuffer *output,
+                                         const rcti *area,
+                                         MemoryBuffer **inputs)
+{
+  rcti rect = *area;
+  if (output == nullptr) {
+    /* Output operations store their result themselves. */
+    this->executeRegion(&rect, 0);
+    return;
+  }
+  if (this->m_row_update && can_update_rows(output, inputs)) {
+    update_memory_buffer_rows(output, area, inputs);
+    return;
+  }
+
+  float *buffer = output->getBuffer();
+  const int num_channels = output->get_num_channels();
+  const bool is_complex = this->isComplex();
+  void *data = is_complex ? this->initializeTileData(&rect) : nullptr;
+  for (int y = rect.ymin; y < rect.ymax; y++) {
+    int offset = (y * output->getWidth() + rect.xmin) * num_channels;
+    for (int x = rect.xmin; x < rect.xmax; x++) {
+      if (is_complex) {
+        this->read(&buffer[offset], x, y, data);
+      }
+      else {
+        this->readSampled(&buffer[offset], x, y, COM_PS_NEAREST);
+      }
+      offset += num_channels;
+    }
+    if (isBraked()) {
+      break;
+    }
+  }
+  if (data) {
+    this->deinitializeTileData(&rect, data);
+  }
+}
+
+bool NodeOperation::can_update_rows(MemoryBuffer *output, MemoryBuffer **inputs) const
+{
+  const unsigned int num_inputs = this->getNumberOfInputSockets();
+  if (num_inputs > COM_ROW_MAX_INPUTS) {
+    return false;
+  }
+  for (unsigned int index = 0; index < num_inputs; index++) {
+    MemoryBuffer *input = inputs[index];
+    if (input == nullptr) {
+      return false;
+    }
+    /* Inputs of another size are read with the conversions of #BufferOperation. */
+    if (!input->is_a_single_elem() && (input->getWidth() != output->getWidth() ||
+                                       input->getHeight() != output->getHeight())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void NodeOperation::update_memory_buffer_rows(MemoryBuffer *output,
+                                              const rcti *area,
+                                              MemoryBuffer **inputs)
+{
+  const unsigned int num_inputs = this->getNumberOfInputSockets();
+  const int width = output->getWidth();
+  const int out_stride = output->get_num_channels();
+  PixelCursor p;
+  p.out_stride = out_stride;
+  for (int y = area->ymin; y < area->ymax; y++) {
+    const int row_offset = y * width + area->xmin;
+    p.out = output->getBuffer() + row_offset * out_stride;
+    p.out_end = p.out + BLI_rcti_size_x(area) * out_stride;
+    for (unsigned int index = 0; index < COM_ROW_MAX_INPUTS; index++) {
+      if (index >= num_inputs) {
+        p.ins[index] = nullptr;
+        p.in_strides[index] = 0;
+      }
+      else if (inputs[index]->is_a_single_elem()) {
+        p.ins[index] = inputs[index]->getBuffer();
+        p.in_strides[index] = 0;
+      }
+      else {
+        p.in_strides[index] = inputs[index]->get_num_channels();
+        p.ins[index] = inputs[index]->getBuffer() + row_offset * p.in_strides[index];
+      }
+    }
+    this->update_memory_buffer_row(p);
+    if (isBraked()) {
+      break;
+    }
+  }
+}
 SocketReader *NodeOperation::getInputSocketReader(unsigned int inputSocketIndex)
 {
   return this->getInputSocket(inputSocketIndex)->getReader();
@@ -37,6 +37,8 @@ using std::list;
 using std::max;
 using std::min;
 
+struct GPUShader;
+
 class OpenCLDevice;
 class ReadBufferOperation;
 class WriteBufferOperation;
@@ -68,6 +70,44 @@ typedef enum InputResizeMode {
   COM_SC_STRETCH = NS_CR_STRETCH,
 } InputResizeMode;
 
+/**
+ * \brief Maximum number of inputs of an operation that updates its output by rows
+ * \see NodeOperation.update_memory_buffer_row
+ */
+#define COM_ROW_MAX_INPUTS 4
+
+/**
+ * \brief Cursor over the output and input elements of a row
+ * \ingroup execution
+ *
+ * Strides are in floats, the stride of an input that is a single value is 0 so all pointers can
+ * be advanced together.
+ * \see NodeOperation.update_memory_buffer_row
+ */
+struct PixelCursor {
+  float *out;
+  /** End of the output row, the cursor is at the end when `out == out_end`. */
+  const float *out_end;
+  int out_stride;
+  const float *ins[COM_ROW_MAX_INPUTS];
+  int in_strides[COM_ROW_MAX_INPUTS];
+
+  /** Advance the cursor \a num_elems elements. */
+  void next(int num_elems = 1)
+  {
+    out += out_stride * num_elems;
+    for (int i = 0; i < COM_ROW_MAX_INPUTS; i++) {
+      ins[i] += in_strides[i] * num_elems;
+    }
+  }
+
+  /** Number of elements left in the row. */
+  int num_elems_left() const
+  {
+    return (int)(out_end - out) / out_stride;
+  }
+};
+
 /**
  * \brief NodeOperation contains calculation logic
  *
@@ -118,11 +158,35 @@ class NodeOperation : public SocketReader {
    */
   const bNodeTree *m_btree;
 
+  /**
+   * \brief the node this operation was created for, nullptr for operations added by the
+   * NodeOperationBuilder (conversions, buffers, ...)
+   */
+  const bNode *m_bnode;
+
+  /**
+   * \brief index of this operation among the operations created for #m_bnode
+   */
+  unsigned int m_bnode_operation_index;
+
   /**
    * \brief set to truth when resolution for this operation is set
    */
   bool m_isResolutionSet;
 
+  /**
+   * \brief does this operation calculate its output by rows in the full-frame execution model
+   * \see NodeOperation.update_memory_buffer_row
+   */
+  bool m_row_update;
+
+  /**
+   * \brief define selecting the shader of this operation in COM_GPUShaders.glsl, nullptr when
+   * the operation can't be calculated on the GPU
+   * \see GPUDevice
+   */
+  const char *m_gpu_shader;
+
  public:
   virtual ~NodeOperation();
 
@@ -187,6 +251,20 @@ class NodeOperation : public SocketReader {
   {
     this->m_btree = tree;
   }
+
+  void setbNode(const bNode *node, unsigned int operation_index)
+  {
+    this->m_bnode = node;
+    this->m_bnode_operation_index = operation_index;
+  }
+  const bNode *getbNode() const
+  {
+    return this->m_bnode;
+  }
+  unsigned int getbNodeOperationIndex() const
+  {
+    return this->m_bnode_operation_index;
+  }
   virtual void initExecution();
 
   /**
@@ -200,6 +278,47 @@ class NodeOperation : public SocketReader {
   {
   }
 
+  /**
+   * \brief calculate an area of the output at once, used by the full-frame execution model
+   * \ingroup execution
+   * \note can be called from multiple threads at once for different areas
+   * \param output: buffer of the whole output to write \a area to, nullptr for output operations
+   * \param area: the area to calculate
+   * \param inputs: the calculated buffers of all input sockets, a value is stored at (0,0) of a
+   * single pixel buffer when the input is a single value.
+   *
+   * Default implementation calculates the pixels one by one, reading the inputs through
+   * BufferOperation's, so operations can be migrated to full-frame one at a time.
+   * When the operation uses row updates and all inputs are full buffers of the same size or
+   * single values, #update_memory_buffer_row is called for every row of \a area instead.
+   * \see FullFrameExecutionModel
+   */
+  virtual void update_memory_buffer(MemoryBuffer *output, const rcti *area, MemoryBuffer **inputs);
+
+  /**
+   * \brief calculate a row of the output at once, used by the full-frame execution model
+   * \ingroup execution
+   * \note can be called from multiple threads at once for different rows
+   * \param p: cursor at the start of the row, with an input pointer for every input socket
+   *
+   * Avoids the virtual call per pixel and per input of the pixel methods, so simple kernels can
+   * be written with SIMD instructions.
+   * \see NodeOperation.setRowUpdate
+   */
+  virtual void update_memory_buffer_row(PixelCursor & /*p*/)
+  {
+  }
+
+  /**
+   * \brief set the uniforms of the GPU shader of this operation before it is drawn
+   * \ingroup execution
+   * \param shader: the bound shader
+   * \see NodeOperation.setGPUShader
+   */
+  virtual void set_gpu_uniforms(GPUShader * /*shader*/)
+  {
+  }
+
   /**
    * \brief when a chunk is executed by an OpenCLDevice, this method is called
    * \ingroup execution
@@ -343,6 +462,15 @@ class NodeOperation : public SocketReader {
     return this->m_openCL;
   }
 
+  /**
+   * \brief name of the GPU shader of this operation, nullptr when it has none
+   * \see GPUDevice
+   */
+  const char *get_gpu_shader() const
+  {
+    return this->m_gpu_shader;
+  }
+
   virtual bool isViewerOperation() const
   {
     return false;
@@ -420,9 +548,35 @@ class NodeOperation : public SocketReader {
     this->m_openCL = openCL;
   }
 
+  /**
+   * \brief set the GPU shader calculating this operation in the full-frame execution model
+   * \param name: define selecting the shader in COM_GPUShaders.glsl, the shader reads input
+   * socket N from sampler inputN.
+   * \note subclasses that override the pixel methods need to set their own shader or nullptr.
+   */
+  void setGPUShader(const char *name)
+  {
+    this->m_gpu_shader = name;
+  }
+
+  /**
+   * \brief set whether this operation implements #update_memory_buffer_row
+   * \note subclasses that override the pixel methods need to override the row method as well.
+   */
+  void setRowUpdate(bool row_update)
+  {
+    this->m_row_update = row_update;
+  }
+
   /* allow the DebugInfo class to look at internals */
   friend class DebugInfo;
 
+ private:
+  bool can_update_rows(MemoryBuffer *output, MemoryBuffer **inputs) const;
+  void update_memory_buffer_rows(MemoryBuffer *output, const rcti *area, MemoryBuffer **inputs);
+
+ public:
+
 #ifdef WITH_CXX_GUARDEDALLOC
   MEM_CXX_CLASS_ALLOC_FUNCS("COM:NodeOperation")
 #endif
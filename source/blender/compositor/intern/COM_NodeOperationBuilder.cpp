@@ -38,7 +38,10 @@
 #include "COM_NodeOperationBuilder.h" /* own include */
 
 NodeOperationBuilder::NodeOperationBuilder(const CompositorContext *context, bNodeTree *b_nodetree)
-    : m_context(context), m_current_node(nullptr), m_active_viewer(nullptr)
+    : m_context(context),
+      m_current_node(nullptr),
+      m_current_node_num_operations(0),
+      m_active_viewer(nullptr)
 {
   m_graph.from_bNodeTree(*context, b_nodetree);
 }
@@ -56,6 +59,7 @@ void NodeOperationBuilder::convertToOperations(ExecutionSystem *system)
     Node *node = (Node *)m_graph.nodes()[index];
 
     m_current_node = node;
+    m_current_node_num_operations = 0;
 
     DebugInfo::node_to_operations(node);
     node->convertToOperations(converter, *m_context);
@@ -104,8 +108,10 @@ void NodeOperationBuilder::convertToOperations(ExecutionSystem *system)
 
   determineResolutions();
 
-  /* surround complex ops with read/write buffer */
-  add_complex_operation_buffers();
+  if (m_context->getExecutionModel() == COM_EXECUTION_MODEL_TILED) {
+    /* surround complex ops with read/write buffer */
+    add_complex_operation_buffers();
+  }
 
   /* links not available from here on */
   /* XXX make m_links a local variable to avoid confusion! */
@@ -116,8 +122,10 @@ void NodeOperationBuilder::convertToOperations(ExecutionSystem *system)
   /* ensure topological (link-based) order of nodes */
   /*sort_operations();*/ /* not needed yet */
 
-  /* create execution groups */
-  group_operations();
+  if (m_context->getExecutionModel() == COM_EXECUTION_MODEL_TILED) {
+    /* create execution groups */
+    group_operations();
+  }
 
   /* transfer resulting operations to the system */
   system->set_operations(m_operations, m_groups);
@@ -125,6 +133,9 @@ void NodeOperationBuilder::convertToOperations(ExecutionSystem *system)
 
 void NodeOperationBuilder::addOperation(NodeOperation *operation)
 {
+  if (m_current_node) {
+    operation->setbNode(m_current_node->getbNode(), m_current_node_num_operations++);
+  }
   m_operations.push_back(operation);
 }
 
@@ -0,0 +1,105 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ */
+
+#include <list>
+#include <unordered_map>
+
+#include "COM_ResultCache.h"
+#include "COM_defines.h"
+
+struct ResultCacheEntry {
+  MemoryBuffer *buffer;
+  size_t mem_size;
+  /** Position in #g_result_cache.lru. */
+  std::list<uint64_t>::iterator lru_position;
+};
+
+static struct {
+  std::unordered_map<uint64_t, ResultCacheEntry> entries;
+  /** Keys of the entries, most recently used first. */
+  std::list<uint64_t> lru;
+  size_t mem_in_use = 0;
+} g_result_cache;
+
+static size_t buffer_mem_size(MemoryBuffer *buffer)
+{
+  return sizeof(float) * buffer->getWidth() * buffer->getHeight() * buffer->get_num_channels();
+}
+
+static void result_cache_remove(std::unordered_map<uint64_t, ResultCacheEntry>::iterator it)
+{
+  g_result_cache.mem_in_use -= it->second.mem_size;
+  g_result_cache.lru.erase(it->second.lru_position);
+  delete it->second.buffer;
+  g_result_cache.entries.erase(it);
+}
+
+MemoryBuffer *ResultCache::lookup(uint64_t key)
+{
+  std::unordered_map<uint64_t, ResultCacheEntry>::iterator it = g_result_cache.entries.find(key);
+  if (it == g_result_cache.entries.end()) {
+    return nullptr;
+  }
+  g_result_cache.lru.splice(
+      g_result_cache.lru.begin(), g_result_cache.lru, it->second.lru_position);
+  return it->second.buffer->duplicate();
+}
+
+void ResultCache::store(uint64_t key, MemoryBuffer *buffer)
+{
+  const size_t mem_size = buffer_mem_size(buffer);
+  if (mem_size > COM_RESULT_CACHE_MEMORY_LIMIT) {
+    return;
+  }
+
+  std::unordered_map<uint64_t, ResultCacheEntry>::iterator it = g_result_cache.entries.find(key);
+  if (it != g_result_cache.entries.end()) {
+    result_cache_remove(it);
+  }
+  while (g_result_cache.mem_in_use + mem_size > COM_RESULT_CACHE_MEMORY_LIMIT) {
+    result_cache_remove(g_result_cache.entries.find(g_result_cache.lru.back()));
+  }
+
+  g_result_cache.lru.push_front(key);
+  ResultCacheEntry &entry = g_result_cache.entries[key];
+  entry.buffer = buffer->duplicate();
+  entry.mem_size = mem_size;
+  entry.lru_position = g_result_cache.lru.begin();
+  g_result_cache.mem_in_use += mem_size;
+}
+
+void ResultCache::free_memory(size_t mem_size)
+{
+  size_t mem_freed = 0;
+  while (mem_freed < mem_size && !g_result_cache.lru.empty()) {
+    std::unordered_map<uint64_t, ResultCacheEntry>::iterator it = g_result_cache.entries.find(
+        g_result_cache.lru.back());
+    mem_freed += it->second.mem_size;
+    result_cache_remove(it);
+  }
+}
+
+void ResultCache::clear()
+{
+  for (std::pair<const uint64_t, ResultCacheEntry> &item : g_result_cache.entries) {
+    delete item.second.buffer;
+  }
+  g_result_cache.entries.clear();
+  g_result_cache.lru.clear();
+  g_result_cache.mem_in_use = 0;
+}
@@ -0,0 +1,58 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "COM_MemoryBuffer.h"
+
+/**
+ * \brief Keeps the buffers of expensive operations between executions of the compositor.
+ *
+ * Buffers are identified by a key hashing the operation, its settings and the keys of its inputs
+ * (see FullFrameExecutionModel), so after editing a node only the operations downstream of it are
+ * calculated again. The least recently used buffers are freed when the cache exceeds
+ * #COM_RESULT_CACHE_MEMORY_LIMIT.
+ *
+ * \note only accessed while executing the compositor, which is serialized by COM_execute.
+ * \ingroup Execution
+ */
+class ResultCache {
+ public:
+  /**
+   * \brief get a copy of the buffer cached for \a key
+   * \return nullptr when \a key isn't cached, the caller owns the returned buffer otherwise.
+   */
+  static MemoryBuffer *lookup(uint64_t key);
+
+  /**
+   * \brief store a copy of \a buffer for \a key, freeing least recently used buffers if needed
+   */
+  static void store(uint64_t key, MemoryBuffer *buffer);
+
+  /**
+   * \brief free least recently used buffers until \a mem_size bytes are freed or no buffer is left
+   */
+  static void free_memory(size_t mem_size);
+
+  /**
+   * \brief free all cached buffers
+   */
+  static void clear();
+};
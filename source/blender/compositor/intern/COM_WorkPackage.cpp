@@ -23,3 +23,10 @@ WorkPackage::WorkPackage(ExecutionGroup *group, unsigned int chunkNumber)
   this->m_executionGroup = group;
   this->m_chunkNumber = chunkNumber;
 }
+
+WorkPackage::WorkPackage(std::function<void()> execute_fn)
+{
+  this->m_executionGroup = nullptr;
+  this->m_chunkNumber = 0;
+  this->m_execute_fn = std::move(execute_fn);
+}
@@ -23,6 +23,8 @@ class WorkPackage;
 class ExecutionGroup;
 #include "COM_ExecutionGroup.h"
 
+#include <functional>
+
 /**
  * \brief contains data about work that can be scheduled
  * \see WorkScheduler
@@ -39,6 +41,12 @@ class WorkPackage {
    */
   unsigned int m_chunkNumber;
 
+  /**
+   * \brief custom work to execute instead of a chunk of an ExecutionGroup
+   * \see WorkScheduler.schedule_function
+   */
+  std::function<void()> m_execute_fn;
+
  public:
   /**
    * constructor
@@ -47,6 +55,12 @@ class WorkPackage {
    */
   WorkPackage(ExecutionGroup *group, unsigned int chunkNumber);
 
+  /**
+   * constructor
+   * \param execute_fn: the work to be executed
+   */
+  WorkPackage(std::function<void()> execute_fn);
+
   /**
    * \brief get the ExecutionGroup
    */
@@ -63,6 +77,14 @@ class WorkPackage {
     return this->m_chunkNumber;
   }
 
+  /**
+   * \brief get the custom work, empty for chunks of an ExecutionGroup
+   */
+  const std::function<void()> &getExecuteFunction() const
+  {
+    return this->m_execute_fn;
+  }
+
 #ifdef WITH_CXX_GUARDEDALLOC
   MEM_CXX_CLASS_ALLOC_FUNCS("COM:WorkPackage")
 #endif
@@ -122,6 +122,18 @@ void WorkScheduler::schedule(ExecutionGroup *group, int chunkNumber)
 #endif
 }
 
+void WorkScheduler::schedule_function(std::function<void()> execute_fn)
+{
+  WorkPackage *package = new WorkPackage(std::move(execute_fn));
+#if COM_CURRENT_THREADING_MODEL == COM_TM_NOTHREAD
+  CPUDevice device(0);
+  device.execute(package);
+  delete package;
+#elif COM_CURRENT_THREADING_MODEL == COM_TM_QUEUE
+  BLI_thread_queue_push(g_work_scheduler.cpu_queue, package);
+#endif
+}
+
 void WorkScheduler::start(CompositorContext &context)
 {
 #if COM_CURRENT_THREADING_MODEL == COM_TM_QUEUE
@@ -56,6 +56,13 @@ struct WorkScheduler {
    */
   static void schedule(ExecutionGroup *group, int chunkNumber);
 
+  /**
+   * \brief schedule custom work to be executed by a CPUDevice
+   * Used by the full-frame execution model to calculate areas of an operation in parallel.
+   * \see WorkScheduler.finish to wait for its completion
+   */
+  static void schedule_function(std::function<void()> execute_fn);
+
   /**
    * \brief initialize the WorkScheduler
    *
@@ -23,8 +23,12 @@
 #include "BKE_node.h"
 #include "BKE_scene.h"
 
+#include "DNA_userdef_types.h"
+
+#include "COM_BufferPool.h"
 #include "COM_ExecutionSystem.h"
 #include "COM_MovieDistortionOperation.h"
+#include "COM_ResultCache.h"
 #include "COM_WorkScheduler.h"
 #include "COM_compositor.h"
 #include "clew.h"
@@ -93,6 +97,7 @@ void COM_execute(RenderData *render_data,
   /* Initialize workscheduler. */
   const bool use_opencl = (node_tree->flag & NTREE_COM_OPENCL) != 0;
   WorkScheduler::initialize(use_opencl, BKE_render_num_threads(render_data));
+  BufferPool::set_memory_limit((size_t)U.compositor_memory_limit * 1024 * 1024);
 
   /* Execute. */
   const bool twopass = (node_tree->flag & NTREE_TWO_PASS) && !rendering;
@@ -102,6 +107,7 @@ void COM_execute(RenderData *render_data,
     fast_pass.execute();
 
     if (node_tree->test_break(node_tree->tbh)) {
+      BufferPool::clear();
       BLI_mutex_unlock(&g_compositor.mutex);
       return;
     }
@@ -111,6 +117,9 @@ void COM_execute(RenderData *render_data,
       render_data, scene, node_tree, rendering, false, viewSettings, displaySettings, viewName);
   system.execute();
 
+  /* Keep the memory of released buffers only during executions. */
+  BufferPool::clear();
+
   BLI_mutex_unlock(&g_compositor.mutex);
 }
 
@@ -119,6 +128,8 @@ void COM_deinitialize()
   if (g_compositor.is_initialized) {
     BLI_mutex_lock(&g_compositor.mutex);
     WorkScheduler::deinitialize();
+    ResultCache::clear();
+    BufferPool::clear();
     g_compositor.is_initialized = false;
     BLI_mutex_unlock(&g_compositor.mutex);
     BLI_mutex_end(&g_compositor.mutex);
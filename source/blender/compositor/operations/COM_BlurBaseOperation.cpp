@@ -18,6 +18,7 @@
 
 #include "COM_BlurBaseOperation.h"
 #include "BLI_math.h"
+#include "COM_FastGaussianBlurOperation.h"
 #include "MEM_guardedalloc.h"
 
 #include "RE_pipeline.h"
@@ -163,6 +164,24 @@ void BlurBaseOperation::setData(const NodeBlurData *data)
   memcpy(&m_data, data, sizeof(NodeBlurData));
 }
 
+bool BlurBaseOperation::use_iir_gauss(float rad) const
+{
+  return this->m_data.filtertype == R_FILTER_GAUSS && rad >= MIN_IIR_GAUSS_RADIUS;
+}
+
+MemoryBuffer *BlurBaseOperation::create_iir_gauss_buffer(MemoryBuffer *input,
+                                                        float rad,
+                                                        unsigned int xy)
+{  /* The gaussian filter value is truncated at 3 times its standard deviation, see
+   * #RE_filter_value. */
+  const float sigma = rad / 3.0f;
+  MemoryBuffer *buffer = input->duplicate();
+  for (unsigned int c = 0; c < buffer->get_num_channels(); c++) {
+    FastGaussianBlurOperation::IIR_gauss(buffer, sigma, c, xy);
+  }
+  return buffer;
+}
+
 void BlurBaseOperation::updateSize()
 {
   if (!this->m_sizeavailable) {
@@ -23,6 +23,12 @@
 
 #define MAX_GAUSSTAB_RADIUS 30000
 
+/**
+ * Radius from which gaussian blurs use a recursive filter instead of their kernel, its cost
+ * doesn't depend on the radius.
+ */
+#define MIN_IIR_GAUSS_RADIUS 32.0f
+
 #include "BLI_simd.h"
 
 class BlurBaseOperation : public NodeOperation, public QualityStepHelper {
@@ -35,6 +41,18 @@ class BlurBaseOperation : public NodeOperation, public QualityStepHelper {
 #endif
   float *make_dist_fac_inverse(float rad, int size, int falloff);
 
+  /**
+   * Whether gaussian blurs of radius \a rad are faster with a recursive filter than with their
+   * kernel, see #create_iir_gauss_buffer.
+   */
+  bool use_iir_gauss(float rad) const;
+  /**
+   * Blur \a input along the x (\a xy = 1) or y (\a xy = 2) axis with a recursive gaussian filter
+   * matching the kernel of radius \a rad.
+   * \return the blurred copy of \a input.
+   */
+  MemoryBuffer *create_iir_gauss_buffer(MemoryBuffer *input, float rad, unsigned int xy);
+
   void updateSize();
 
   /**
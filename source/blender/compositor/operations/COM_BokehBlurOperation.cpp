@@ -18,8 +18,11 @@
 
 #include "COM_BokehBlurOperation.h"
 #include "BLI_math.h"
+#include "COM_FHTConvolution.h"
 #include "COM_OpenCLDevice.h"
 
+#include "MEM_guardedalloc.h"
+
 #include "RE_pipeline.h"
 
 BokehBlurOperation::BokehBlurOperation()
@@ -39,6 +42,8 @@ BokehBlurOperation::BokehBlurOperation()
   this->m_inputBoundingBoxReader = nullptr;
 
   this->m_extend_bounds = false;
+  this->m_use_fft = false;
+  this->m_fft_buffer = nullptr;
 }
 
 void *BokehBlurOperation::initializeTileData(rcti * /*rect*/)
@@ -48,6 +53,9 @@ void *BokehBlurOperation::initializeTileData(rcti * /*rect*/)
     updateSize();
   }
   void *buffer = getInputOperation(0)->initializeTileData(nullptr);
+  if (this->m_use_fft && this->m_fft_buffer == nullptr) {
+    this->m_fft_buffer = create_fft_buffer((MemoryBuffer *)buffer);
+  }
   unlockMutex();
   return buffer;
 }
@@ -68,6 +76,87 @@ void BokehBlurOperation::initExecution()
   this->m_bokehMidY = height / 2.0f;
   this->m_bokehDimension = dimension / 2.0f;
   QualityStepHelper::initExecution(COM_QH_INCREASE);
+
+  /* Only a size known before execution, the whole input is needed for the transforms. */
+  this->m_use_fft = this->m_sizeavailable && get_blur_radius() >= MIN_FFT_BOKEH_RADIUS;
+}
+
+int BokehBlurOperation::get_blur_radius() const
+{
+  const float max_dim = max(this->getWidth(), this->getHeight());
+  return this->m_size * max_dim / 100.0f;
+}
+
+MemoryBuffer *BokehBlurOperation::create_fft_buffer(MemoryBuffer *input)
+{
+  const int radius = get_blur_radius();
+  const int kernel_size = 2 * radius + 1;
+  const int sat_size = kernel_size + 1;
+  const float m = this->m_bokehDimension / radius;
+
+  /* The kernel is centered, tap (kx, ky) reads the input at offset (radius - kx, radius - ky).
+   * Like #executePixel the offsets go from -radius to radius - 1, the first row and column are
+   * left empty. */
+  rcti kernel_rect;
+  BLI_rcti_init(&kernel_rect, 0, kernel_size, 0, kernel_size);
+  MemoryBuffer *kernel = new MemoryBuffer(COM_DT_COLOR, &kernel_rect);
+  kernel->clear();
+  for (int ky = 1; ky < kernel_size; ky++) {
+    const float v = this->m_bokehMidY - (radius - ky) * m;
+    for (int kx = 1; kx < kernel_size; kx++) {
+      const float u = this->m_bokehMidX - (radius - kx) * m;
+      float bokeh[4];
+      this->m_inputBokehProgram->readSampled(bokeh, u, v, COM_PS_NEAREST);
+      kernel->writePixel(kx, ky, bokeh);
+    }
+  }
+
+  /* Summed area table of the kernel weights, to normalize pixels close to the borders. */
+  double *sat = (double *)MEM_callocN(
+      sizeof(double) * COM_NUM_CHANNELS_COLOR * sat_size * sat_size, __func__);
+  const float *kernel_buffer = kernel->getBuffer();
+  for (int ky = 0; ky < kernel_size; ky++) {
+    for (int kx = 0; kx < kernel_size; kx++) {
+      const float *weight = &kernel_buffer[(ky * kernel_size + kx) * COM_NUM_CHANNELS_COLOR];
+      double *dst = &sat[((ky + 1) * sat_size + kx + 1) * COM_NUM_CHANNELS_COLOR];
+      const double *left = dst - COM_NUM_CHANNELS_COLOR;
+      const double *top = dst - sat_size * COM_NUM_CHANNELS_COLOR;
+      const double *top_left = top - COM_NUM_CHANNELS_COLOR;
+      for (int ch = 0; ch < COM_NUM_CHANNELS_COLOR; ch++) {
+        dst[ch] = weight[ch] + left[ch] + top[ch] - top_left[ch];
+      }
+    }
+  }
+
+  MemoryBuffer *result = new MemoryBuffer(COM_DT_COLOR, input->getRect());
+  result->clear();
+  fht_convolve_image(result->getBuffer(), input, kernel, COM_NUM_CHANNELS_COLOR);
+  delete kernel;
+
+  const int width = input->getWidth();
+  const int height = input->getHeight();
+  float *buffer = result->getBuffer();
+  for (int y = 0; y < height; y++) {
+    /* Taps reading inside of the input. */
+    const int ky_min = max(radius - (height - 1 - y), 1);
+    const int ky_max = min(radius + y, kernel_size - 1);
+    for (int x = 0; x < width; x++) {
+      const int kx_min = max(radius - (width - 1 - x), 1);
+      const int kx_max = min(radius + x, kernel_size - 1);
+      const double *s00 = &sat[(ky_min * sat_size + kx_min) * COM_NUM_CHANNELS_COLOR];
+      const double *s01 = &sat[(ky_min * sat_size + kx_max + 1) * COM_NUM_CHANNELS_COLOR];
+      const double *s10 = &sat[((ky_max + 1) * sat_size + kx_min) * COM_NUM_CHANNELS_COLOR];
+      const double *s11 = &sat[((ky_max + 1) * sat_size + kx_max + 1) * COM_NUM_CHANNELS_COLOR];
+      float *color = &buffer[(y * width + x) * COM_NUM_CHANNELS_COLOR];
+      for (int ch = 0; ch < COM_NUM_CHANNELS_COLOR; ch++) {
+        const float weight = s11[ch] - s01[ch] - s10[ch] + s00[ch];
+        color[ch] *= 1.0f / weight;
+      }
+    }
+  }
+  MEM_freeN(sat);
+
+  return result;
 }
 
 void BokehBlurOperation::executePixel(float output[4], int x, int y, void *data)
@@ -77,7 +166,10 @@ void BokehBlurOperation::executePixel(float output[4], int x, int y, void *data)
   float bokeh[4];
 
   this->m_inputBoundingBoxReader->readSampled(tempBoundingBox, x, y, COM_PS_NEAREST);
-  if (tempBoundingBox[0] > 0.0f) {
+  if (tempBoundingBox[0] > 0.0f && this->m_fft_buffer) {
+    this->m_fft_buffer->read(output, x, y);
+  }
+  else if (tempBoundingBox[0] > 0.0f) {
     float multiplier_accum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
     MemoryBuffer *inputBuffer = (MemoryBuffer *)data;
     float *buffer = inputBuffer->getBuffer();
@@ -132,6 +224,10 @@ void BokehBlurOperation::executePixel(float output[4], int x, int y, void *data)
 
 void BokehBlurOperation::deinitExecution()
 {
+  if (this->m_fft_buffer) {
+    delete this->m_fft_buffer;
+    this->m_fft_buffer = nullptr;
+  }
   deinitMutex();
   this->m_inputProgram = nullptr;
   this->m_inputBokehProgram = nullptr;
@@ -146,7 +242,13 @@ bool BokehBlurOperation::determineDependingAreaOfInterest(rcti *input,
   rcti bokehInput;
   const float max_dim = max(this->getWidth(), this->getHeight());
 
-  if (this->m_sizeavailable) {
+  if (this->m_use_fft) {
+    newInput.xmax = this->getWidth();
+    newInput.xmin = 0;
+    newInput.ymax = this->getHeight();
+    newInput.ymin = 0;
+  }
+  else if (this->m_sizeavailable) {
     newInput.xmax = input->xmax + (this->m_size * max_dim / 100.0f);
     newInput.xmin = input->xmin - (this->m_size * max_dim / 100.0f);
     newInput.ymax = input->ymax + (this->m_size * max_dim / 100.0f);
@@ -21,6 +21,12 @@
 #include "COM_NodeOperation.h"
 #include "COM_QualityStepHelper.h"
 
+/**
+ * Radius from which a constant size bokeh blur convolves the whole input with an FFT instead of
+ * gathering the kernel for every pixel.
+ */
+#define MIN_FFT_BOKEH_RADIUS 16
+
 class BokehBlurOperation : public NodeOperation, public QualityStepHelper {
  private:
   SocketReader *m_inputProgram;
@@ -33,6 +39,15 @@ class BokehBlurOperation : public NodeOperation, public QualityStepHelper {
   float m_bokehMidY;
   float m_bokehDimension;
   bool m_extend_bounds;
+  bool m_use_fft;
+  MemoryBuffer *m_fft_buffer;
+
+  int get_blur_radius() const;
+  /**
+   * Blur the whole \a input at once, normalizing each pixel by the weights of the bokeh inside
+   * of the image like #executePixel does.
+   */
+  MemoryBuffer *create_fft_buffer(MemoryBuffer *input);
 
  public:
   BokehBlurOperation();
@@ -0,0 +1,46 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2021, Blender Foundation.
+ */
+
+#pragma once
+
+#include "COM_MemoryBuffer.h"
+#include "COM_NodeOperation.h"
+
+/**
+ * \brief Reads the pixels of an already calculated MemoryBuffer.
+ *
+ * Used by the full-frame execution model to replace the inputs of operations that are calculated
+ * with their per pixel methods, so upstream operations aren't evaluated again.
+ * \see FullFrameExecutionModel
+ */
+class BufferOperation : public NodeOperation {
+ private:
+  MemoryBuffer *m_buffer;
+  bool m_single_value; /* single value stored at (0,0), used for the whole area */
+
+ public:
+  BufferOperation(MemoryBuffer *buffer,
+                  DataType datatype,
+                  unsigned int width,
+                  unsigned int height,
+                  bool single_value);
+
+  void *initializeTileData(rcti *rect);
+  void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+  void executePixelFiltered(float output[4], float x, float y, float dx[2], float dy[2]);
+};
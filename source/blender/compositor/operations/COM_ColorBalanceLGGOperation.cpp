@@ -44,6 +44,7 @@ ColorBalanceLGGOperation::ColorBalanceLGGOperation()
   this->m_inputValueOperation = nullptr;
   this->m_inputColorOperation = nullptr;
   this->setResolutionInputSocketIndex(1);
+  this->setRowUpdate(true);
 }
 
 void ColorBalanceLGGOperation::initExecution()
@@ -79,6 +80,21 @@ void ColorBalanceLGGOperation::executePixelSampled(float output[4],
   output[3] = inputColor[3];
 }
 
+void ColorBalanceLGGOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  for (; p.out < p.out_end; p.next()) {
+    const float *in_color = p.ins[1];
+    const float fac = min(1.0f, p.ins[0][0]);
+    const float mfac = 1.0f - fac;
+    for (int i = 0; i < 3; i++) {
+      p.out[i] = mfac * in_color[i] +
+                 fac * colorbalance_lgg(
+                           in_color[i], this->m_lift[i], this->m_gamma_inv[i], this->m_gain[i]);
+    }
+    p.out[3] = in_color[3];
+  }
+}
+
 void ColorBalanceLGGOperation::deinitExecution()
 {
   this->m_inputValueOperation = nullptr;
@@ -47,6 +47,8 @@ class ColorBalanceLGGOperation : public NodeOperation {
    */
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
 
+  void update_memory_buffer_row(PixelCursor &p);
+
   /**
    * Initialize the execution
    */
@@ -41,6 +41,8 @@ ConvertValueToColorOperation::ConvertValueToColorOperation() : ConvertBaseOperat
 {
   this->addInputSocket(COM_DT_VALUE);
   this->addOutputSocket(COM_DT_COLOR);
+  this->setRowUpdate(true);
+  this->setGPUShader("CONVERT_VALUE_TO_COLOR");
 }
 
 void ConvertValueToColorOperation::executePixelSampled(float output[4],
@@ -54,12 +56,23 @@ void ConvertValueToColorOperation::executePixelSampled(float output[4],
   output[3] = 1.0f;
 }
 
+void ConvertValueToColorOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  for (; p.out < p.out_end; p.next()) {
+    const float value = p.ins[0][0];
+    p.out[0] = p.out[1] = p.out[2] = value;
+    p.out[3] = 1.0f;
+  }
+}
+
 /* ******** Color to Value ******** */
 
 ConvertColorToValueOperation::ConvertColorToValueOperation() : ConvertBaseOperation()
 {
   this->addInputSocket(COM_DT_COLOR);
   this->addOutputSocket(COM_DT_VALUE);
+  this->setRowUpdate(true);
+  this->setGPUShader("CONVERT_COLOR_TO_VALUE");
 }
 
 void ConvertColorToValueOperation::executePixelSampled(float output[4],
@@ -72,12 +85,21 @@ void ConvertColorToValueOperation::executePixelSampled(float output[4],
   output[0] = (inputColor[0] + inputColor[1] + inputColor[2]) / 3.0f;
 }
 
+void ConvertColorToValueOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  for (; p.out < p.out_end; p.next()) {
+    const float *in_color = p.ins[0];
+    p.out[0] = (in_color[0] + in_color[1] + in_color[2]) / 3.0f;
+  }
+}
+
 /* ******** Color to BW ******** */
 
 ConvertColorToBWOperation::ConvertColorToBWOperation() : ConvertBaseOperation()
 {
   this->addInputSocket(COM_DT_COLOR);
   this->addOutputSocket(COM_DT_VALUE);
+  this->setRowUpdate(true);
 }
 
 void ConvertColorToBWOperation::executePixelSampled(float output[4],
@@ -90,12 +112,21 @@ void ConvertColorToBWOperation::executePixelSampled(float output[4],
   output[0] = IMB_colormanagement_get_luminance(inputColor);
 }
 
+void ConvertColorToBWOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  for (; p.out < p.out_end; p.next()) {
+    p.out[0] = IMB_colormanagement_get_luminance(p.ins[0]);
+  }
+}
+
 /* ******** Color to Vector ******** */
 
 ConvertColorToVectorOperation::ConvertColorToVectorOperation() : ConvertBaseOperation()
 {
   this->addInputSocket(COM_DT_COLOR);
   this->addOutputSocket(COM_DT_VECTOR);
+  this->setRowUpdate(true);
+  this->setGPUShader("CONVERT_COLOR_TO_VECTOR");
 }
 
 void ConvertColorToVectorOperation::executePixelSampled(float output[4],
@@ -108,12 +139,21 @@ void ConvertColorToVectorOperation::executePixelSampled(float output[4],
   copy_v3_v3(output, color);
 }
 
+void ConvertColorToVectorOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  for (; p.out < p.out_end; p.next()) {
+    copy_v3_v3(p.out, p.ins[0]);
+  }
+}
+
 /* ******** Value to Vector ******** */
 
 ConvertValueToVectorOperation::ConvertValueToVectorOperation() : ConvertBaseOperation()
 {
   this->addInputSocket(COM_DT_VALUE);
   this->addOutputSocket(COM_DT_VECTOR);
+  this->setRowUpdate(true);
+  this->setGPUShader("CONVERT_VALUE_TO_VECTOR");
 }
 
 void ConvertValueToVectorOperation::executePixelSampled(float output[4],
@@ -126,12 +166,22 @@ void ConvertValueToVectorOperation::executePixelSampled(float output[4],
   output[0] = output[1] = output[2] = value;
 }
 
+void ConvertValueToVectorOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  for (; p.out < p.out_end; p.next()) {
+    const float value = p.ins[0][0];
+    p.out[0] = p.out[1] = p.out[2] = value;
+  }
+}
+
 /* ******** Vector to Color ******** */
 
 ConvertVectorToColorOperation::ConvertVectorToColorOperation() : ConvertBaseOperation()
 {
   this->addInputSocket(COM_DT_VECTOR);
   this->addOutputSocket(COM_DT_COLOR);
+  this->setRowUpdate(true);
+  this->setGPUShader("CONVERT_VECTOR_TO_COLOR");
 }
 
 void ConvertVectorToColorOperation::executePixelSampled(float output[4],
@@ -143,12 +193,22 @@ void ConvertVectorToColorOperation::executePixelSampled(float output[4],
   output[3] = 1.0f;
 }
 
+void ConvertVectorToColorOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  for (; p.out < p.out_end; p.next()) {
+    copy_v3_v3(p.out, p.ins[0]);
+    p.out[3] = 1.0f;
+  }
+}
+
 /* ******** Vector to Value ******** */
 
 ConvertVectorToValueOperation::ConvertVectorToValueOperation() : ConvertBaseOperation()
 {
   this->addInputSocket(COM_DT_VECTOR);
   this->addOutputSocket(COM_DT_VALUE);
+  this->setRowUpdate(true);
+  this->setGPUShader("CONVERT_VECTOR_TO_VALUE");
 }
 
 void ConvertVectorToValueOperation::executePixelSampled(float output[4],
@@ -161,6 +221,14 @@ void ConvertVectorToValueOperation::executePixelSampled(float output[4],
   output[0] = (input[0] + input[1] + input[2]) / 3.0f;
 }
 
+void ConvertVectorToValueOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  for (; p.out < p.out_end; p.next()) {
+    const float *in_vector = p.ins[0];
+    p.out[0] = (in_vector[0] + in_vector[1] + in_vector[2]) / 3.0f;
+  }
+}
+
 /* ******** RGB to YCC ******** */
 
 ConvertRGBToYCCOperation::ConvertRGBToYCCOperation() : ConvertBaseOperation()
@@ -36,6 +36,7 @@ class ConvertValueToColorOperation : public ConvertBaseOperation {
   ConvertValueToColorOperation();
 
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+  void update_memory_buffer_row(PixelCursor &p);
 };
 
 class ConvertColorToValueOperation : public ConvertBaseOperation {
@@ -43,6 +44,7 @@ class ConvertColorToValueOperation : public ConvertBaseOperation {
   ConvertColorToValueOperation();
 
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+  void update_memory_buffer_row(PixelCursor &p);
 };
 
 class ConvertColorToBWOperation : public ConvertBaseOperation {
@@ -50,6 +52,7 @@ class ConvertColorToBWOperation : public ConvertBaseOperation {
   ConvertColorToBWOperation();
 
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+  void update_memory_buffer_row(PixelCursor &p);
 };
 
 class ConvertColorToVectorOperation : public ConvertBaseOperation {
@@ -57,6 +60,7 @@ class ConvertColorToVectorOperation : public ConvertBaseOperation {
   ConvertColorToVectorOperation();
 
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+  void update_memory_buffer_row(PixelCursor &p);
 };
 
 class ConvertValueToVectorOperation : public ConvertBaseOperation {
@@ -64,6 +68,7 @@ class ConvertValueToVectorOperation : public ConvertBaseOperation {
   ConvertValueToVectorOperation();
 
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+  void update_memory_buffer_row(PixelCursor &p);
 };
 
 class ConvertVectorToColorOperation : public ConvertBaseOperation {
@@ -71,6 +76,7 @@ class ConvertVectorToColorOperation : public ConvertBaseOperation {
   ConvertVectorToColorOperation();
 
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+  void update_memory_buffer_row(PixelCursor &p);
 };
 
 class ConvertVectorToValueOperation : public ConvertBaseOperation {
@@ -78,6 +84,7 @@ class ConvertVectorToValueOperation : public ConvertBaseOperation {
   ConvertVectorToValueOperation();
 
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+  void update_memory_buffer_row(PixelCursor &p);
 };
 
 class ConvertRGBToYCCOperation : public ConvertBaseOperation {
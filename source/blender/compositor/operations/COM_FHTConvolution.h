@@ -0,0 +1,30 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * Copyright 2011, Blender Foundation.
+ */
+
+#pragma once
+
+#include "COM_MemoryBuffer.h"
+
+/**
+ * Convolve the first \a num_channels channels of the color buffer \a image with the color
+ * buffer \a kernel using the 2D Fast Hartley Transform, adding the result to \a dst.
+ *
+ * \a dst has the size of \a image. The kernel is centered on each pixel, pixels outside of the
+ * image are treated as zero. Channels are convolved in parallel.
+ */
+void fht_convolve_image(float *dst, MemoryBuffer *image, MemoryBuffer *kernel, int num_channels);
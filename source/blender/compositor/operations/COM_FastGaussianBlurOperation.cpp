@@ -18,6 +18,7 @@
 
 #include <climits>
 
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 #include "COM_FastGaussianBlurOperation.h"
 #include "MEM_guardedalloc.h"
@@ -110,17 +111,99 @@ void *FastGaussianBlurOperation::initializeTileData(rcti *rect)
   return this->m_iirgaus;
 }
 
+/** Coefficients of the recursive filter and of the border corrections. */
+struct IIRGaussCoefficients {
+  double cf[4];
+  double tsM[9];
+};
+
+/** Filter the \a L values of \a X into \a Y, \a W is used for the intermediate result. */
+static void iir_gauss_line(
+    const IIRGaussCoefficients &coefs, const double *X, double *W, double *Y, unsigned int L)
+{
+  const double *cf = coefs.cf;
+  const double *tsM = coefs.tsM;
+  double tsu[3], tsv[3];
+  unsigned int i;
+
+  W[0] = cf[0] * X[0] + cf[1] * X[0] + cf[2] * X[0] + cf[3] * X[0];
+  W[1] = cf[0] * X[1] + cf[1] * W[0] + cf[2] * X[0] + cf[3] * X[0];
+  W[2] = cf[0] * X[2] + cf[1] * W[1] + cf[2] * W[0] + cf[3] * X[0];
+  for (i = 3; i < L; i++) {
+    W[i] = cf[0] * X[i] + cf[1] * W[i - 1] + cf[2] * W[i - 2] + cf[3] * W[i - 3];
+  }
+  tsu[0] = W[L - 1] - X[L - 1];
+  tsu[1] = W[L - 2] - X[L - 1];
+  tsu[2] = W[L - 3] - X[L - 1];
+  tsv[0] = tsM[0] * tsu[0] + tsM[1] * tsu[1] + tsM[2] * tsu[2] + X[L - 1];
+  tsv[1] = tsM[3] * tsu[0] + tsM[4] * tsu[1] + tsM[5] * tsu[2] + X[L - 1];
+  tsv[2] = tsM[6] * tsu[0] + tsM[7] * tsu[1] + tsM[8] * tsu[2] + X[L - 1];
+  Y[L - 1] = cf[0] * W[L - 1] + cf[1] * tsv[0] + cf[2] * tsv[1] + cf[3] * tsv[2];
+  Y[L - 2] = cf[0] * W[L - 2] + cf[1] * Y[L - 1] + cf[2] * tsv[0] + cf[3] * tsv[1];
+  Y[L - 3] = cf[0] * W[L - 3] + cf[1] * Y[L - 2] + cf[2] * Y[L - 1] + cf[3] * tsv[0];
+  /* 'i != UINT_MAX' is really 'i >= 0', but necessary for unsigned int wrapping */
+  for (i = L - 4; i != UINT_MAX; i--) {
+    Y[i] = cf[0] * W[i] + cf[1] * Y[i + 1] + cf[2] * Y[i + 2] + cf[3] * Y[i + 3];
+  }
+}
+
+/** Number of lines filtered by a task, sharing the intermediate buffers. */
+#define IIR_GAUSS_LINES_PER_TASK 16
+
+struct IIRGaussTaskData {
+  IIRGaussCoefficients coefs;
+  float *buffer;
+  /** Number of lines and values per line. */
+  unsigned int num_lines;
+  unsigned int line_length;
+  /** Offsets in floats between lines and between the values of a line. */
+  unsigned int line_stride;
+  unsigned int elem_stride;
+};
+
+static void iir_gauss_lines_task(void *__restrict userdata,
+                                 const int task_index,
+                                 const TaskParallelTLS *__restrict /*tls*/)
+{
+  const IIRGaussTaskData *data = (const IIRGaussTaskData *)userdata;
+  const unsigned int L = data->line_length;
+  double *X = (double *)MEM_mallocN(3 * L * sizeof(double), "IIR_gauss buf");
+  double *Y = X + L;
+  double *W = Y + L;
+
+  const unsigned int line_start = task_index * IIR_GAUSS_LINES_PER_TASK;
+  const unsigned int line_end = min(line_start + IIR_GAUSS_LINES_PER_TASK, data->num_lines);
+  for (unsigned int line = line_start; line < line_end; line++) {
+    float *values = data->buffer + line * data->line_stride;
+    for (unsigned int i = 0; i < L; i++) {
+      X[i] = values[i * data->elem_stride];
+    }
+    iir_gauss_line(data->coefs, X, W, Y, L);
+    for (unsigned int i = 0; i < L; i++) {
+      values[i * data->elem_stride] = Y[i];
+    }
+  }
+
+  MEM_freeN(X);
+}
+
+static void iir_gauss_lines(IIRGaussTaskData *data)
+{
+  const int num_tasks = (data->num_lines + IIR_GAUSS_LINES_PER_TASK - 1) /
+                        IIR_GAUSS_LINES_PER_TASK;
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  BLI_task_parallel_range(0, num_tasks, data, iir_gauss_lines_task, &settings);
+}
+
 void FastGaussianBlurOperation::IIR_gauss(MemoryBuffer *src,
                                           float sigma,
                                           unsigned int chan,
                                           unsigned int xy)
 {
-  double q, q2, sc, cf[4], tsM[9], tsu[3], tsv[3];
-  double *X, *Y, *W;
+  double q, q2, sc;
   const unsigned int src_width = src->getWidth();
   const unsigned int src_height = src->getHeight();
-  unsigned int x, y, sz;
-  unsigned int i;
   float *buffer = src->getBuffer();
   const unsigned int num_channels = src->get_num_channels();
 
@@ -133,7 +216,7 @@ void FastGaussianBlurOperation::IIR_gauss(MemoryBuffer *src,
     xy = 3;
   }
 
-  // XXX The YVV macro defined below explicitly expects sources of at least 3x3 pixels,
+  // XXX The line filter explicitly expects sources of at least 3x3 pixels,
   //     so just skipping blur along faulty direction if src's def is below that limit!
   if (src_width < 3) {
     xy &= ~1;
@@ -145,6 +228,10 @@ void FastGaussianBlurOperation::IIR_gauss(MemoryBuffer *src,
     return;
   }
 
+  IIRGaussTaskData data;
+  double *cf = data.coefs.cf;
+  double *tsM = data.coefs.tsM;
+
   // see "Recursive Gabor Filtering" by Young/VanVliet
   // all factors here in double.prec.
   // Required, because for single.prec it seems to blow up if sigma > ~200
@@ -184,75 +271,21 @@ void FastGaussianBlurOperation::IIR_gauss(MemoryBuffer *src,
                  cf[3] * cf[3] * cf[3] - cf[3] * cf[2] + cf[3]);
   tsM[8] = sc * (cf[3] * (cf[1] + cf[3] * cf[2]));
 
-#define YVV(L) \
-  { \
-    W[0] = cf[0] * X[0] + cf[1] * X[0] + cf[2] * X[0] + cf[3] * X[0]; \
-    W[1] = cf[0] * X[1] + cf[1] * W[0] + cf[2] * X[0] + cf[3] * X[0]; \
-    W[2] = cf[0] * X[2] + cf[1] * W[1] + cf[2] * W[0] + cf[3] * X[0]; \
-    for (i = 3; i < L; i++) { \
-      W[i] = cf[0] * X[i] + cf[1] * W[i - 1] + cf[2] * W[i - 2] + cf[3] * W[i - 3]; \
-    } \
-    tsu[0] = W[L - 1] - X[L - 1]; \
-    tsu[1] = W[L - 2] - X[L - 1]; \
-    tsu[2] = W[L - 3] - X[L - 1]; \
-    tsv[0] = tsM[0] * tsu[0] + tsM[1] * tsu[1] + tsM[2] * tsu[2] + X[L - 1]; \
-    tsv[1] = tsM[3] * tsu[0] + tsM[4] * tsu[1] + tsM[5] * tsu[2] + X[L - 1]; \
-    tsv[2] = tsM[6] * tsu[0] + tsM[7] * tsu[1] + tsM[8] * tsu[2] + X[L - 1]; \
-    Y[L - 1] = cf[0] * W[L - 1] + cf[1] * tsv[0] + cf[2] * tsv[1] + cf[3] * tsv[2]; \
-    Y[L - 2] = cf[0] * W[L - 2] + cf[1] * Y[L - 1] + cf[2] * tsv[0] + cf[3] * tsv[1]; \
-    Y[L - 3] = cf[0] * W[L - 3] + cf[1] * Y[L - 2] + cf[2] * Y[L - 1] + cf[3] * tsv[0]; \
-    /* 'i != UINT_MAX' is really 'i >= 0', but necessary for unsigned int wrapping */ \
-    for (i = L - 4; i != UINT_MAX; i--) { \
-      Y[i] = cf[0] * W[i] + cf[1] * Y[i + 1] + cf[2] * Y[i + 2] + cf[3] * Y[i + 3]; \
-    } \
-  } \
-  (void)0
-
-  // intermediate buffers
-  sz = max(src_width, src_height);
-  X = (double *)MEM_callocN(sz * sizeof(double), "IIR_gauss X buf");
-  Y = (double *)MEM_callocN(sz * sizeof(double), "IIR_gauss Y buf");
-  W = (double *)MEM_callocN(sz * sizeof(double), "IIR_gauss W buf");
+  data.buffer = buffer + chan;
   if (xy & 1) {  // H
-    int offset;
-    for (y = 0; y < src_height; y++) {
-      const int yx = y * src_width;
-      offset = yx * num_channels + chan;
-      for (x = 0; x < src_width; x++) {
-        X[x] = buffer[offset];
-        offset += num_channels;
-      }
-      YVV(src_width);
-      offset = yx * num_channels + chan;
-      for (x = 0; x < src_width; x++) {
-        buffer[offset] = Y[x];
-        offset += num_channels;
-      }
-    }
+    data.num_lines = src_height;
+    data.line_length = src_width;
+    data.line_stride = src_width * num_channels;
+    data.elem_stride = num_channels;
+    iir_gauss_lines(&data);
   }
   if (xy & 2) {  // V
-    int offset;
-    const int add = src_width * num_channels;
-
-    for (x = 0; x < src_width; x++) {
-      offset = x * num_channels + chan;
-      for (y = 0; y < src_height; y++) {
-        X[y] = buffer[offset];
-        offset += add;
-      }
-      YVV(src_height);
-      offset = x * num_channels + chan;
-      for (y = 0; y < src_height; y++) {
-        buffer[offset] = Y[y];
-        offset += add;
-      }
-    }
+    data.num_lines = src_width;
+    data.line_length = src_height;
+    data.line_stride = num_channels;
+    data.elem_stride = src_width * num_channels;
+    iir_gauss_lines(&data);
   }
-
-  MEM_freeN(X);
-  MEM_freeN(W);
-  MEM_freeN(Y);
-#undef YVV
 }
 
 ///
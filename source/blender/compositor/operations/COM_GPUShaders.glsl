@@ -0,0 +1,150 @@
+/* Shaders of the operations calculated on the GPU in the full-frame execution model.
+ * The shader of an operation is selected by the define set with NodeOperation.setGPUShader.
+ * Input socket N is read from sampler inputN, single value inputs are 1x1 textures. */
+
+#ifdef GPU_VERTEX_SHADER
+
+in vec2 pos;
+
+void main()
+{
+  gl_Position = vec4(pos * 2.0 - 1.0, 0.0, 1.0);
+}
+
+#else /* GPU_FRAGMENT_SHADER */
+
+#  if defined(MIX_ADD) || defined(MIX_BLEND) || defined(MIX_DARKEN)
+#    define MIX
+#  elif defined(MIX_DIFFERENCE) || defined(MIX_LIGHTEN) || defined(MIX_MULTIPLY)
+#    define MIX
+#  elif defined(MIX_SCREEN) || defined(MIX_SUBTRACT)
+#    define MIX
+#  endif
+
+#  if defined(MATH_ADD) || defined(MATH_SUBTRACT) || defined(MATH_MULTIPLY)
+#    define MATH
+#  elif defined(MATH_DIVIDE) || defined(MATH_MINIMUM) || defined(MATH_MAXIMUM)
+#    define MATH
+#  endif
+
+uniform sampler2D input0;
+uniform sampler2D input1;
+uniform sampler2D input2;
+
+out vec4 fragColor;
+
+vec4 read_input(sampler2D tex)
+{
+  ivec2 co = min(ivec2(gl_FragCoord.xy), textureSize(tex, 0) - 1);
+  return texelFetch(tex, co, 0);
+}
+
+/* ******** Mix Operations ******** */
+
+#  if defined(MIX)
+uniform bool use_value_alpha_multiply;
+uniform bool use_clamp;
+
+void main()
+{
+  float value = read_input(input0).r;
+  vec4 color1 = read_input(input1);
+  vec4 color2 = read_input(input2);
+  if (use_value_alpha_multiply) {
+    value *= color2.a;
+  }
+  float valuem = 1.0 - value;
+  vec3 result;
+
+#    if defined(MIX_ADD)
+  result = color1.rgb + value * color2.rgb;
+#    elif defined(MIX_BLEND)
+  result = valuem * color1.rgb + value * color2.rgb;
+#    elif defined(MIX_DARKEN)
+  result = min(color1.rgb, color2.rgb) * value + color1.rgb * valuem;
+#    elif defined(MIX_DIFFERENCE)
+  result = valuem * color1.rgb + value * abs(color1.rgb - color2.rgb);
+#    elif defined(MIX_LIGHTEN)
+  result = max(value * color2.rgb, color1.rgb);
+#    elif defined(MIX_MULTIPLY)
+  result = color1.rgb * (valuem + value * color2.rgb);
+#    elif defined(MIX_SCREEN)
+  result = 1.0 - (valuem + value * (1.0 - color2.rgb)) * (1.0 - color1.rgb);
+#    elif defined(MIX_SUBTRACT)
+  result = color1.rgb - value * color2.rgb;
+#    endif
+
+  fragColor = vec4(result, color1.a);
+  if (use_clamp) {
+    fragColor = clamp(fragColor, 0.0, 1.0);
+  }
+}
+
+/* ******** Math Operations ******** */
+
+#  elif defined(MATH)
+uniform bool use_clamp;
+
+void main()
+{
+  float value1 = read_input(input0).r;
+  float value2 = read_input(input1).r;
+  float result;
+
+#    if defined(MATH_ADD)
+  result = value1 + value2;
+#    elif defined(MATH_SUBTRACT)
+  result = value1 - value2;
+#    elif defined(MATH_MULTIPLY)
+  result = value1 * value2;
+#    elif defined(MATH_DIVIDE)
+  /* We don't want to divide by zero. */
+  result = (value2 == 0.0) ? 0.0 : value1 / value2;
+#    elif defined(MATH_MINIMUM)
+  result = min(value1, value2);
+#    elif defined(MATH_MAXIMUM)
+  result = max(value1, value2);
+#    endif
+
+  if (use_clamp) {
+    result = clamp(result, 0.0, 1.0);
+  }
+  fragColor = vec4(result);
+}
+
+/* ******** Convert Operations ******** */
+
+#  elif defined(CONVERT_VALUE_TO_COLOR)
+void main()
+{
+  fragColor = vec4(vec3(read_input(input0).r), 1.0);
+}
+
+#  elif defined(CONVERT_COLOR_TO_VALUE) || defined(CONVERT_VECTOR_TO_VALUE)
+void main()
+{
+  vec4 color = read_input(input0);
+  fragColor = vec4((color.r + color.g + color.b) / 3.0);
+}
+
+#  elif defined(CONVERT_COLOR_TO_VECTOR)
+void main()
+{
+  fragColor = vec4(read_input(input0).rgb, 0.0);
+}
+
+#  elif defined(CONVERT_VALUE_TO_VECTOR)
+void main()
+{
+  fragColor = vec4(vec3(read_input(input0).r), 0.0);
+}
+
+#  elif defined(CONVERT_VECTOR_TO_COLOR)
+void main()
+{
+  fragColor = vec4(read_input(input0).rgb, 1.0);
+}
+
+#  endif
+
+#endif /* GPU_FRAGMENT_SHADER */
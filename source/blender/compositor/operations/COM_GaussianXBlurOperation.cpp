@@ -30,6 +30,8 @@ GaussianXBlurOperation::GaussianXBlurOperation() : BlurBaseOperation(COM_DT_COLO
   this->m_gausstab_sse = nullptr;
 #endif
   this->m_filtersize = 0;
+  this->m_rad = 0.0f;
+  this->m_iir_buffer = nullptr;
 }
 
 void *GaussianXBlurOperation::initializeTileData(rcti * /*rect*/)
@@ -39,6 +41,9 @@ void *GaussianXBlurOperation::initializeTileData(rcti * /*rect*/)
     updateGauss();
   }
   void *buffer = getInputOperation(0)->initializeTileData(nullptr);
+  if (this->m_iir_buffer == nullptr && use_iir_gauss(this->m_rad)) {
+    this->m_iir_buffer = create_iir_gauss_buffer((MemoryBuffer *)buffer, this->m_rad, 1);
+  }
   unlockMutex();
   return buffer;
 }
@@ -52,6 +57,7 @@ void GaussianXBlurOperation::initExecution()
   if (this->m_sizeavailable) {
     float rad = max_ff(m_size * m_data.sizex, 0.0f);
     m_filtersize = min_ii(ceil(rad), MAX_GAUSSTAB_RADIUS);
+    m_rad = rad;
 
     /* TODO(sergey): De-duplicate with the case below and Y blur. */
     this->m_gausstab = BlurBaseOperation::make_gausstab(rad, m_filtersize);
@@ -68,6 +74,7 @@ void GaussianXBlurOperation::updateGauss()
     float rad = max_ff(m_size * m_data.sizex, 0.0f);
     rad = min_ff(rad, MAX_GAUSSTAB_RADIUS);
     m_filtersize = min_ii(ceil(rad), MAX_GAUSSTAB_RADIUS);
+    m_rad = rad;
 
     this->m_gausstab = BlurBaseOperation::make_gausstab(rad, m_filtersize);
 #ifdef BLI_HAVE_SSE2
@@ -78,6 +85,11 @@ void GaussianXBlurOperation::updateGauss()
 
 void GaussianXBlurOperation::executePixel(float output[4], int x, int y, void *data)
 {
+  if (this->m_iir_buffer) {
+    this->m_iir_buffer->read(output, x, y);
+    return;
+  }
+
   float ATTR_ALIGN(16) color_accum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
   float multiplier_accum = 0.0f;
   MemoryBuffer *inputBuffer = (MemoryBuffer *)data;
@@ -169,6 +181,11 @@ void GaussianXBlurOperation::deinitExecution()
   }
 #endif
 
+  if (this->m_iir_buffer) {
+    delete this->m_iir_buffer;
+    this->m_iir_buffer = nullptr;
+  }
+
   deinitMutex();
 }
 
@@ -190,7 +207,8 @@ bool GaussianXBlurOperation::determineDependingAreaOfInterest(rcti *input,
     }
   }
   {
-    if (this->m_sizeavailable && this->m_gausstab != nullptr) {
+    /* The recursive filter of large radii reads the whole input at once. */
+    if (this->m_sizeavailable && this->m_gausstab != nullptr && !use_iir_gauss(this->m_rad)) {
       newInput.xmax = input->xmax + this->m_filtersize + 1;
       newInput.xmin = input->xmin - this->m_filtersize - 1;
       newInput.ymax = input->ymax;
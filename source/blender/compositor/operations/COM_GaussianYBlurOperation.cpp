@@ -30,6 +30,8 @@ GaussianYBlurOperation::GaussianYBlurOperation() : BlurBaseOperation(COM_DT_COLO
   this->m_gausstab_sse = nullptr;
 #endif
   this->m_filtersize = 0;
+  this->m_rad = 0.0f;
+  this->m_iir_buffer = nullptr;
 }
 
 void *GaussianYBlurOperation::initializeTileData(rcti * /*rect*/)
@@ -39,6 +41,9 @@ void *GaussianYBlurOperation::initializeTileData(rcti * /*rect*/)
     updateGauss();
   }
   void *buffer = getInputOperation(0)->initializeTileData(nullptr);
+  if (this->m_iir_buffer == nullptr && use_iir_gauss(this->m_rad)) {
+    this->m_iir_buffer = create_iir_gauss_buffer((MemoryBuffer *)buffer, this->m_rad, 2);
+  }
   unlockMutex();
   return buffer;
 }
@@ -52,6 +57,7 @@ void GaussianYBlurOperation::initExecution()
   if (this->m_sizeavailable) {
     float rad = max_ff(m_size * m_data.sizey, 0.0f);
     m_filtersize = min_ii(ceil(rad), MAX_GAUSSTAB_RADIUS);
+    m_rad = rad;
 
     this->m_gausstab = BlurBaseOperation::make_gausstab(rad, m_filtersize);
 #ifdef BLI_HAVE_SSE2
@@ -67,6 +73,7 @@ void GaussianYBlurOperation::updateGauss()
     float rad = max_ff(m_size * m_data.sizey, 0.0f);
     rad = min_ff(rad, MAX_GAUSSTAB_RADIUS);
     m_filtersize = min_ii(ceil(rad), MAX_GAUSSTAB_RADIUS);
+    m_rad = rad;
 
     this->m_gausstab = BlurBaseOperation::make_gausstab(rad, m_filtersize);
 #ifdef BLI_HAVE_SSE2
@@ -77,6 +84,11 @@ void GaussianYBlurOperation::updateGauss()
 
 void GaussianYBlurOperation::executePixel(float output[4], int x, int y, void *data)
 {
+  if (this->m_iir_buffer) {
+    this->m_iir_buffer->read(output, x, y);
+    return;
+  }
+
   float ATTR_ALIGN(16) color_accum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
   float multiplier_accum = 0.0f;
   MemoryBuffer *inputBuffer = (MemoryBuffer *)data;
@@ -169,6 +181,11 @@ void GaussianYBlurOperation::deinitExecution()
   }
 #endif
 
+  if (this->m_iir_buffer) {
+    delete this->m_iir_buffer;
+    this->m_iir_buffer = nullptr;
+  }
+
   deinitMutex();
 }
 
@@ -190,7 +207,8 @@ bool GaussianYBlurOperation::determineDependingAreaOfInterest(rcti *input,
     }
   }
   {
-    if (this->m_sizeavailable && this->m_gausstab != nullptr) {
+    /* The recursive filter of large radii reads the whole input at once. */
+    if (this->m_sizeavailable && this->m_gausstab != nullptr && !use_iir_gauss(this->m_rad)) {
       newInput.xmax = input->xmax;
       newInput.xmin = input->xmin;
       newInput.ymax = input->ymax + this->m_filtersize + 1;
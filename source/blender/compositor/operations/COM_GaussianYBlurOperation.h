@@ -28,6 +28,9 @@ class GaussianYBlurOperation : public BlurBaseOperation {
   __m128 *m_gausstab_sse;
 #endif
   int m_filtersize;
+  float m_rad;
+  /** Input blurred with a recursive filter for large radii, see #use_iir_gauss. */
+  MemoryBuffer *m_iir_buffer;
   void updateGauss();
 
  public:
@@ -22,6 +22,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_math.h"
+#include "BLI_task.hh"
 
 #include "BKE_lib_id.h"
 #include "BKE_mask.h"
@@ -58,7 +59,6 @@ void MaskOperation::initExecution()
       /* make a throw away copy of the mask */
       const float frame = (float)this->m_frame_number - this->m_frame_shutter;
       const float frame_step = (this->m_frame_shutter * 2.0f) / this->m_rasterMaskHandleTot;
-      float frame_iter = frame;
 
       Mask *mask_temp = (Mask *)BKE_id_copy_ex(
           nullptr, &this->m_mask->id, nullptr, LIB_ID_COPY_LOCALIZE | LIB_ID_COPY_NO_ANIMDATA);
@@ -75,23 +75,34 @@ void MaskOperation::initExecution()
         }
       }
 
+      /* Every sample is evaluated on its own copy, so that the handles can be initialized in
+       * parallel. */
+      Mask *mask_samples[CMP_NODE_MASK_MBLUR_SAMPLES_MAX];
       for (unsigned int i = 0; i < this->m_rasterMaskHandleTot; i++) {
+        mask_samples[i] = (Mask *)BKE_id_copy_ex(
+            nullptr, &mask_temp->id, nullptr, LIB_ID_COPY_LOCALIZE | LIB_ID_COPY_NO_ANIMDATA);
         this->m_rasterMaskHandles[i] = BKE_maskrasterize_handle_new();
+      }
 
-        /* re-eval frame info */
-        BKE_mask_evaluate(mask_temp, frame_iter, true);
-
-        BKE_maskrasterize_handle_init(this->m_rasterMaskHandles[i],
-                                      mask_temp,
-                                      this->m_maskWidth,
-                                      this->m_maskHeight,
-                                      true,
-                                      true,
-                                      this->m_do_feather);
+      const blender::IndexRange samples(this->m_rasterMaskHandleTot);
+      blender::parallel_for(samples, 1, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          /* re-eval frame info */
+          BKE_mask_evaluate(mask_samples[i], frame + frame_step * (float)i, true);
+
+          BKE_maskrasterize_handle_init(this->m_rasterMaskHandles[i],
+                                        mask_samples[i],
+                                        this->m_maskWidth,
+                                        this->m_maskHeight,
+                                        true,
+                                        true,
+                                        this->m_do_feather);
+        }
+      });
 
-        frame_iter += frame_step;
+      for (unsigned int i = 0; i < this->m_rasterMaskHandleTot; i++) {
+        BKE_id_free(nullptr, &mask_samples[i]->id);
       }
-
       BKE_id_free(nullptr, &mask_temp->id);
     }
   }
@@ -19,6 +19,9 @@
 #include "COM_MathBaseOperation.h"
 
 #include "BLI_math.h"
+#include "BLI_simd.h"
+
+#include "GPU_shader.h"
 
 MathBaseOperation::MathBaseOperation()
 {
@@ -46,6 +49,11 @@ void MathBaseOperation::deinitExecution()
   this->m_inputValue3Operation = nullptr;
 }
 
+void MathBaseOperation::set_gpu_uniforms(GPUShader *shader)
+{
+  GPU_shader_uniform_1b(shader, "use_clamp", this->m_useClamp);
+}
+
 void MathBaseOperation::determineResolution(unsigned int resolution[2],
                                             unsigned int preferredResolution[2])
 {
@@ -71,6 +79,34 @@ void MathBaseOperation::clampIfNeeded(float *color)
   }
 }
 
+/**
+ * Calculate a row of values with the binary function \a Fn, which implements `calc` for a single
+ * value and `calc_sse` for 4 values at once.
+ */
+template<typename Fn> static void math_update_row(PixelCursor &p, const bool use_clamp)
+{
+#ifdef BLI_HAVE_SSE2
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 one = _mm_set1_ps(1.0f);
+  for (; p.num_elems_left() >= 4; p.next(4)) {
+    /* Single value inputs are broadcast to all lanes. */
+    const __m128 a = p.in_strides[0] ? _mm_loadu_ps(p.ins[0]) : _mm_set1_ps(p.ins[0][0]);
+    const __m128 b = p.in_strides[1] ? _mm_loadu_ps(p.ins[1]) : _mm_set1_ps(p.ins[1][0]);
+    __m128 result = Fn::calc_sse(a, b);
+    if (use_clamp) {
+      result = _mm_min_ps(_mm_max_ps(result, zero), one);
+    }
+    _mm_storeu_ps(p.out, result);
+  }
+#endif
+  for (; p.out < p.out_end; p.next()) {
+    p.out[0] = Fn::calc(p.ins[0][0], p.ins[1][0]);
+    if (use_clamp) {
+      CLAMP(p.out[0], 0.0f, 1.0f);
+    }
+  }
+}
+
 void MathAddOperation::executePixelSampled(float output[4], float x, float y, PixelSampler sampler)
 {
   float inputValue1[4];
@@ -84,6 +120,24 @@ void MathAddOperation::executePixelSampled(float output[4], float x, float y, Pi
   clampIfNeeded(output);
 }
 
+struct MathAddFn {
+  static float calc(float a, float b)
+  {
+    return a + b;
+  }
+#ifdef BLI_HAVE_SSE2
+  static __m128 calc_sse(__m128 a, __m128 b)
+  {
+    return _mm_add_ps(a, b);
+  }
+#endif
+};
+
+void MathAddOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  math_update_row<MathAddFn>(p, this->m_useClamp);
+}
+
 void MathSubtractOperation::executePixelSampled(float output[4],
                                                 float x,
                                                 float y,
@@ -100,6 +154,24 @@ void MathSubtractOperation::executePixelSampled(float output[4],
   clampIfNeeded(output);
 }
 
+struct MathSubtractFn {
+  static float calc(float a, float b)
+  {
+    return a - b;
+  }
+#ifdef BLI_HAVE_SSE2
+  static __m128 calc_sse(__m128 a, __m128 b)
+  {
+    return _mm_sub_ps(a, b);
+  }
+#endif
+};
+
+void MathSubtractOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  math_update_row<MathSubtractFn>(p, this->m_useClamp);
+}
+
 void MathMultiplyOperation::executePixelSampled(float output[4],
                                                 float x,
                                                 float y,
@@ -116,6 +188,24 @@ void MathMultiplyOperation::executePixelSampled(float output[4],
   clampIfNeeded(output);
 }
 
+struct MathMultiplyFn {
+  static float calc(float a, float b)
+  {
+    return a * b;
+  }
+#ifdef BLI_HAVE_SSE2
+  static __m128 calc_sse(__m128 a, __m128 b)
+  {
+    return _mm_mul_ps(a, b);
+  }
+#endif
+};
+
+void MathMultiplyOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  math_update_row<MathMultiplyFn>(p, this->m_useClamp);
+}
+
 void MathDivideOperation::executePixelSampled(float output[4],
                                               float x,
                                               float y,
@@ -137,6 +227,25 @@ void MathDivideOperation::executePixelSampled(float output[4],
   clampIfNeeded(output);
 }
 
+struct MathDivideFn {
+  static float calc(float a, float b)
+  {
+    /* We don't want to divide by zero. */
+    return (b == 0.0f) ? 0.0f : a / b;
+  }
+#ifdef BLI_HAVE_SSE2
+  static __m128 calc_sse(__m128 a, __m128 b)
+  {
+    return _mm_and_ps(_mm_cmpneq_ps(b, _mm_setzero_ps()), _mm_div_ps(a, b));
+  }
+#endif
+};
+
+void MathDivideOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  math_update_row<MathDivideFn>(p, this->m_useClamp);
+}
+
 void MathSineOperation::executePixelSampled(float output[4],
                                             float x,
                                             float y,
@@ -356,6 +465,25 @@ void MathMinimumOperation::executePixelSampled(float output[4],
   clampIfNeeded(output);
 }
 
+struct MathMinimumFn {
+  static float calc(float a, float b)
+  {
+    return min(a, b);
+  }
+#ifdef BLI_HAVE_SSE2
+  static __m128 calc_sse(__m128 a, __m128 b)
+  {
+    /* Same operand order as `std::min`, for NaN. */
+    return _mm_min_ps(b, a);
+  }
+#endif
+};
+
+void MathMinimumOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  math_update_row<MathMinimumFn>(p, this->m_useClamp);
+}
+
 void MathMaximumOperation::executePixelSampled(float output[4],
                                                float x,
                                                float y,
@@ -372,6 +500,25 @@ void MathMaximumOperation::executePixelSampled(float output[4],
   clampIfNeeded(output);
 }
 
+struct MathMaximumFn {
+  static float calc(float a, float b)
+  {
+    return max(a, b);
+  }
+#ifdef BLI_HAVE_SSE2
+  static __m128 calc_sse(__m128 a, __m128 b)
+  {
+    /* Same operand order as `std::max`, for NaN. */
+    return _mm_max_ps(b, a);
+  }
+#endif
+};
+
+void MathMaximumOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  math_update_row<MathMaximumFn>(p, this->m_useClamp);
+}
+
 void MathRoundOperation::executePixelSampled(float output[4],
                                              float x,
                                              float y,
@@ -64,6 +64,8 @@ class MathBaseOperation : public NodeOperation {
    */
   void determineResolution(unsigned int resolution[2], unsigned int preferredResolution[2]);
 
+  void set_gpu_uniforms(GPUShader *shader);
+
   void setUseClamp(bool value)
   {
     this->m_useClamp = value;
@@ -74,29 +76,41 @@ class MathAddOperation : public MathBaseOperation {
  public:
   MathAddOperation() : MathBaseOperation()
   {
+    this->setRowUpdate(true);
+    this->setGPUShader("MATH_ADD");
   }
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+  void update_memory_buffer_row(PixelCursor &p);
 };
 class MathSubtractOperation : public MathBaseOperation {
  public:
   MathSubtractOperation() : MathBaseOperation()
   {
+    this->setRowUpdate(true);
+    this->setGPUShader("MATH_SUBTRACT");
   }
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+  void update_memory_buffer_row(PixelCursor &p);
 };
 class MathMultiplyOperation : public MathBaseOperation {
  public:
   MathMultiplyOperation() : MathBaseOperation()
   {
+    this->setRowUpdate(true);
+    this->setGPUShader("MATH_MULTIPLY");
   }
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+  void update_memory_buffer_row(PixelCursor &p);
 };
 class MathDivideOperation : public MathBaseOperation {
  public:
   MathDivideOperation() : MathBaseOperation()
   {
+    this->setRowUpdate(true);
+    this->setGPUShader("MATH_DIVIDE");
   }
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+  void update_memory_buffer_row(PixelCursor &p);
 };
 class MathSineOperation : public MathBaseOperation {
  public:
@@ -181,15 +195,21 @@ class MathMinimumOperation : public MathBaseOperation {
  public:
   MathMinimumOperation() : MathBaseOperation()
   {
+    this->setRowUpdate(true);
+    this->setGPUShader("MATH_MINIMUM");
   }
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+  void update_memory_buffer_row(PixelCursor &p);
 };
 class MathMaximumOperation : public MathBaseOperation {
  public:
   MathMaximumOperation() : MathBaseOperation()
   {
+    this->setRowUpdate(true);
+    this->setGPUShader("MATH_MAXIMUM");
   }
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+  void update_memory_buffer_row(PixelCursor &p);
 };
 class MathRoundOperation : public MathBaseOperation {
  public:
@@ -20,6 +20,16 @@
 
 #include "BLI_math.h"
 
+#include "GPU_shader.h"
+
+#ifdef BLI_HAVE_SSE2
+/* Absolute value of all lanes. */
+static inline __m128 abs_sse(__m128 a)
+{
+  return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+}
+#endif
+
 /* ******** Mix Base Operation ******** */
 
 MixBaseOperation::MixBaseOperation()
@@ -95,11 +105,33 @@ void MixBaseOperation::deinitExecution()
   this->m_inputColor2Operation = nullptr;
 }
 
+void MixBaseOperation::set_gpu_uniforms(GPUShader *shader)
+{
+  GPU_shader_uniform_1b(shader, "use_value_alpha_multiply", this->m_valueAlphaMultiply);
+  GPU_shader_uniform_1b(shader, "use_clamp", this->m_useClamp);
+}
+
+#ifdef BLI_HAVE_SSE2
+void MixBaseOperation::store_row_color(float *out, __m128 color, __m128 color1)
+{
+  /* Alpha of the first color is kept. */
+  const __m128 alpha_mask = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+  color = _mm_or_ps(_mm_andnot_ps(alpha_mask, color), _mm_and_ps(alpha_mask, color1));
+  if (m_useClamp) {
+    color = _mm_min_ps(_mm_max_ps(color, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+  }
+  _mm_storeu_ps(out, color);
+}
+#endif
+
 /* ******** Mix Add Operation ******** */
 
 MixAddOperation::MixAddOperation()
 {
-  /* pass */
+#ifdef BLI_HAVE_SSE2
+  this->setRowUpdate(true);
+#endif
+  this->setGPUShader("MIX_ADD");
 }
 
 void MixAddOperation::executePixelSampled(float output[4], float x, float y, PixelSampler sampler)
@@ -124,11 +156,26 @@ void MixAddOperation::executePixelSampled(float output[4], float x, float y, Pix
   clampIfNeeded(output);
 }
 
+#ifdef BLI_HAVE_SSE2
+void MixAddOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  for (; p.out < p.out_end; p.next()) {
+    const __m128 color1 = _mm_loadu_ps(p.ins[1]);
+    const __m128 color2 = _mm_loadu_ps(p.ins[2]);
+    const __m128 value = _mm_set1_ps(get_row_value(p));
+    store_row_color(p.out, _mm_add_ps(color1, _mm_mul_ps(value, color2)), color1);
+  }
+}
+#endif
+
 /* ******** Mix Blend Operation ******** */
 
 MixBlendOperation::MixBlendOperation()
 {
-  /* pass */
+#ifdef BLI_HAVE_SSE2
+  this->setRowUpdate(true);
+#endif
+  this->setGPUShader("MIX_BLEND");
 }
 
 void MixBlendOperation::executePixelSampled(float output[4],
@@ -158,6 +205,21 @@ void MixBlendOperation::executePixelSampled(float output[4],
   clampIfNeeded(output);
 }
 
+#ifdef BLI_HAVE_SSE2
+void MixBlendOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  const __m128 one = _mm_set1_ps(1.0f);
+  for (; p.out < p.out_end; p.next()) {
+    const __m128 color1 = _mm_loadu_ps(p.ins[1]);
+    const __m128 color2 = _mm_loadu_ps(p.ins[2]);
+    const __m128 value = _mm_set1_ps(get_row_value(p));
+    const __m128 valuem = _mm_sub_ps(one, value);
+    store_row_color(
+        p.out, _mm_add_ps(_mm_mul_ps(valuem, color1), _mm_mul_ps(value, color2)), color1);
+  }
+}
+#endif
+
 /* ******** Mix Burn Operation ******** */
 
 MixColorBurnOperation::MixColorBurnOperation()
@@ -290,7 +352,10 @@ void MixColorOperation::executePixelSampled(float output[4],
 
 MixDarkenOperation::MixDarkenOperation()
 {
-  /* pass */
+#ifdef BLI_HAVE_SSE2
+  this->setRowUpdate(true);
+#endif
+  this->setGPUShader("MIX_DARKEN");
 }
 
 void MixDarkenOperation::executePixelSampled(float output[4],
@@ -319,11 +384,30 @@ void MixDarkenOperation::executePixelSampled(float output[4],
   clampIfNeeded(output);
 }
 
+#ifdef BLI_HAVE_SSE2
+void MixDarkenOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  const __m128 one = _mm_set1_ps(1.0f);
+  for (; p.out < p.out_end; p.next()) {
+    const __m128 color1 = _mm_loadu_ps(p.ins[1]);
+    const __m128 color2 = _mm_loadu_ps(p.ins[2]);
+    const __m128 value = _mm_set1_ps(get_row_value(p));
+    const __m128 valuem = _mm_sub_ps(one, value);
+    const __m128 darkest = _mm_min_ps(color1, color2);
+    store_row_color(
+        p.out, _mm_add_ps(_mm_mul_ps(darkest, value), _mm_mul_ps(color1, valuem)), color1);
+  }
+}
+#endif
+
 /* ******** Mix Difference Operation ******** */
 
 MixDifferenceOperation::MixDifferenceOperation()
 {
-  /* pass */
+#ifdef BLI_HAVE_SSE2
+  this->setRowUpdate(true);
+#endif
+  this->setGPUShader("MIX_DIFFERENCE");
 }
 
 void MixDifferenceOperation::executePixelSampled(float output[4],
@@ -352,6 +436,22 @@ void MixDifferenceOperation::executePixelSampled(float output[4],
   clampIfNeeded(output);
 }
 
+#ifdef BLI_HAVE_SSE2
+void MixDifferenceOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  const __m128 one = _mm_set1_ps(1.0f);
+  for (; p.out < p.out_end; p.next()) {
+    const __m128 color1 = _mm_loadu_ps(p.ins[1]);
+    const __m128 color2 = _mm_loadu_ps(p.ins[2]);
+    const __m128 value = _mm_set1_ps(get_row_value(p));
+    const __m128 valuem = _mm_sub_ps(one, value);
+    const __m128 difference = abs_sse(_mm_sub_ps(color1, color2));
+    store_row_color(
+        p.out, _mm_add_ps(_mm_mul_ps(valuem, color1), _mm_mul_ps(value, difference)), color1);
+  }
+}
+#endif
+
 /* ******** Mix Difference Operation ******** */
 
 MixDivideOperation::MixDivideOperation()
@@ -577,7 +677,10 @@ void MixHueOperation::executePixelSampled(float output[4], float x, float y, Pix
 
 MixLightenOperation::MixLightenOperation()
 {
-  /* pass */
+#ifdef BLI_HAVE_SSE2
+  this->setRowUpdate(true);
+#endif
+  this->setGPUShader("MIX_LIGHTEN");
 }
 
 void MixLightenOperation::executePixelSampled(float output[4],
@@ -624,6 +727,18 @@ void MixLightenOperation::executePixelSampled(float output[4],
   clampIfNeeded(output);
 }
 
+#ifdef BLI_HAVE_SSE2
+void MixLightenOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  for (; p.out < p.out_end; p.next()) {
+    const __m128 color1 = _mm_loadu_ps(p.ins[1]);
+    const __m128 color2 = _mm_loadu_ps(p.ins[2]);
+    const __m128 value = _mm_set1_ps(get_row_value(p));
+    store_row_color(p.out, _mm_max_ps(_mm_mul_ps(value, color2), color1), color1);
+  }
+}
+#endif
+
 /* ******** Mix Linear Light Operation ******** */
 
 MixLinearLightOperation::MixLinearLightOperation()
@@ -676,7 +791,10 @@ void MixLinearLightOperation::executePixelSampled(float output[4],
 
 MixMultiplyOperation::MixMultiplyOperation()
 {
-  /* pass */
+#ifdef BLI_HAVE_SSE2
+  this->setRowUpdate(true);
+#endif
+  this->setGPUShader("MIX_MULTIPLY");
 }
 
 void MixMultiplyOperation::executePixelSampled(float output[4],
@@ -705,6 +823,21 @@ void MixMultiplyOperation::executePixelSampled(float output[4],
   clampIfNeeded(output);
 }
 
+#ifdef BLI_HAVE_SSE2
+void MixMultiplyOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  const __m128 one = _mm_set1_ps(1.0f);
+  for (; p.out < p.out_end; p.next()) {
+    const __m128 color1 = _mm_loadu_ps(p.ins[1]);
+    const __m128 color2 = _mm_loadu_ps(p.ins[2]);
+    const __m128 value = _mm_set1_ps(get_row_value(p));
+    const __m128 valuem = _mm_sub_ps(one, value);
+    store_row_color(
+        p.out, _mm_mul_ps(color1, _mm_add_ps(valuem, _mm_mul_ps(value, color2))), color1);
+  }
+}
+#endif
+
 /* ******** Mix Overlay Operation ******** */
 
 MixOverlayOperation::MixOverlayOperation()
@@ -801,7 +934,10 @@ void MixSaturationOperation::executePixelSampled(float output[4],
 
 MixScreenOperation::MixScreenOperation()
 {
-  /* pass */
+#ifdef BLI_HAVE_SSE2
+  this->setRowUpdate(true);
+#endif
+  this->setGPUShader("MIX_SCREEN");
 }
 
 void MixScreenOperation::executePixelSampled(float output[4],
@@ -831,6 +967,21 @@ void MixScreenOperation::executePixelSampled(float output[4],
   clampIfNeeded(output);
 }
 
+#ifdef BLI_HAVE_SSE2
+void MixScreenOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  const __m128 one = _mm_set1_ps(1.0f);
+  for (; p.out < p.out_end; p.next()) {
+    const __m128 color1 = _mm_loadu_ps(p.ins[1]);
+    const __m128 color2 = _mm_loadu_ps(p.ins[2]);
+    const __m128 value = _mm_set1_ps(get_row_value(p));
+    const __m128 valuem = _mm_sub_ps(one, value);
+    const __m128 factor = _mm_add_ps(valuem, _mm_mul_ps(value, _mm_sub_ps(one, color2)));
+    store_row_color(p.out, _mm_sub_ps(one, _mm_mul_ps(factor, _mm_sub_ps(one, color1))), color1);
+  }
+}
+#endif
+
 /* ******** Mix Soft Light Operation ******** */
 
 MixSoftLightOperation::MixSoftLightOperation()
@@ -881,7 +1032,10 @@ void MixSoftLightOperation::executePixelSampled(float output[4],
 
 MixSubtractOperation::MixSubtractOperation()
 {
-  /* pass */
+#ifdef BLI_HAVE_SSE2
+  this->setRowUpdate(true);
+#endif
+  this->setGPUShader("MIX_SUBTRACT");
 }
 
 void MixSubtractOperation::executePixelSampled(float output[4],
@@ -909,6 +1063,18 @@ void MixSubtractOperation::executePixelSampled(float output[4],
   clampIfNeeded(output);
 }
 
+#ifdef BLI_HAVE_SSE2
+void MixSubtractOperation::update_memory_buffer_row(PixelCursor &p)
+{
+  for (; p.out < p.out_end; p.next()) {
+    const __m128 color1 = _mm_loadu_ps(p.ins[1]);
+    const __m128 color2 = _mm_loadu_ps(p.ins[2]);
+    const __m128 value = _mm_set1_ps(get_row_value(p));
+    store_row_color(p.out, _mm_sub_ps(color1, _mm_mul_ps(value, color2)), color1);
+  }
+}
+#endif
+
 /* ******** Mix Value Operation ******** */
 
 MixValueOperation::MixValueOperation()
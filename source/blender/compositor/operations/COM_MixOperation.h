@@ -20,6 +20,8 @@
 
 #include "COM_NodeOperation.h"
 
+#include "BLI_simd.h"
+
 /**
  * All this programs converts an input color to an output value.
  * it assumes we are in sRGB color space.
@@ -43,6 +45,25 @@ class MixBaseOperation : public NodeOperation {
     }
   }
 
+  /**
+   * Mix factor of the current element of a row update.
+   */
+  inline float get_row_value(const PixelCursor &p) const
+  {
+    float value = p.ins[0][0];
+    if (m_valueAlphaMultiply) {
+      value *= p.ins[2][3];
+    }
+    return value;
+  }
+
+#ifdef BLI_HAVE_SSE2
+  /**
+   * Store the result of a row update with the alpha of \a color1, clamped when needed.
+   */
+  void store_row_color(float *out, __m128 color, __m128 color1);
+#endif
+
  public:
   /**
    * Default constructor
@@ -66,6 +87,8 @@ class MixBaseOperation : public NodeOperation {
 
   void determineResolution(unsigned int resolution[2], unsigned int preferredResolution[2]);
 
+  void set_gpu_uniforms(GPUShader *shader);
+
   void setUseValueAlphaMultiply(const bool value)
   {
     this->m_valueAlphaMultiply = value;
@@ -84,12 +107,18 @@ class MixAddOperation : public MixBaseOperation {
  public:
   MixAddOperation();
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+#ifdef BLI_HAVE_SSE2
+  void update_memory_buffer_row(PixelCursor &p);
+#endif
 };
 
 class MixBlendOperation : public MixBaseOperation {
  public:
   MixBlendOperation();
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+#ifdef BLI_HAVE_SSE2
+  void update_memory_buffer_row(PixelCursor &p);
+#endif
 };
 
 class MixColorBurnOperation : public MixBaseOperation {
@@ -108,12 +137,18 @@ class MixDarkenOperation : public MixBaseOperation {
  public:
   MixDarkenOperation();
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+#ifdef BLI_HAVE_SSE2
+  void update_memory_buffer_row(PixelCursor &p);
+#endif
 };
 
 class MixDifferenceOperation : public MixBaseOperation {
  public:
   MixDifferenceOperation();
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+#ifdef BLI_HAVE_SSE2
+  void update_memory_buffer_row(PixelCursor &p);
+#endif
 };
 
 class MixDivideOperation : public MixBaseOperation {
@@ -144,6 +179,9 @@ class MixLightenOperation : public MixBaseOperation {
  public:
   MixLightenOperation();
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+#ifdef BLI_HAVE_SSE2
+  void update_memory_buffer_row(PixelCursor &p);
+#endif
 };
 
 class MixLinearLightOperation : public MixBaseOperation {
@@ -156,6 +194,9 @@ class MixMultiplyOperation : public MixBaseOperation {
  public:
   MixMultiplyOperation();
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+#ifdef BLI_HAVE_SSE2
+  void update_memory_buffer_row(PixelCursor &p);
+#endif
 };
 
 class MixOverlayOperation : public MixBaseOperation {
@@ -174,6 +215,9 @@ class MixScreenOperation : public MixBaseOperation {
  public:
   MixScreenOperation();
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+#ifdef BLI_HAVE_SSE2
+  void update_memory_buffer_row(PixelCursor &p);
+#endif
 };
 
 class MixSoftLightOperation : public MixBaseOperation {
@@ -186,6 +230,9 @@ class MixSubtractOperation : public MixBaseOperation {
  public:
   MixSubtractOperation();
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
+#ifdef BLI_HAVE_SSE2
+  void update_memory_buffer_row(PixelCursor &p);
+#endif
 };
 
 class MixValueOperation : public MixBaseOperation {
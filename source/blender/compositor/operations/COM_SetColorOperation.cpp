@@ -37,3 +37,10 @@ void SetColorOperation::determineResolution(unsigned int resolution[2],
   resolution[0] = preferredResolution[0];
   resolution[1] = preferredResolution[1];
 }
+
+void SetColorOperation::update_memory_buffer(MemoryBuffer *output,
+                                             const rcti *area,
+                                             MemoryBuffer ** /*inputs*/)
+{
+  output->fill(area, this->m_color);
+}
@@ -77,6 +77,7 @@ class SetColorOperation : public NodeOperation {
   void executePixelSampled(float output[4], float x, float y, PixelSampler sampler);
 
   void determineResolution(unsigned int resolution[2], unsigned int preferredResolution[2]);
+  void update_memory_buffer(MemoryBuffer *output, const rcti *area, MemoryBuffer **inputs);
   bool isSetOperation() const
   {
     return true;
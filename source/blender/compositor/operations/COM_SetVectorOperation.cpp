@@ -40,3 +40,11 @@ void SetVectorOperation::determineResolution(unsigned int resolution[2],
   resolution[0] = preferredResolution[0];
   resolution[1] = preferredResolution[1];
 }
+
+void SetVectorOperation::update_memory_buffer(MemoryBuffer *output,
+                                              const rcti *area,
+                                              MemoryBuffer ** /*inputs*/)
+{
+  const float vector[3] = {this->m_x, this->m_y, this->m_z};
+  output->fill(area, vector);
+}
@@ -62,6 +62,18 @@ void DEG_debug_stats_gnuplot(const struct Depsgraph *graph,
                              const char *label,
                              const char *output_filename);
 
+/* ************************************************ */
+/* Evaluation Profiling */
+
+/* Start recording the start and end time of every evaluated operation, for all following
+ * evaluations (until stopped). Has no cost when not started. */
+void DEG_debug_eval_profile_start(struct Depsgraph *depsgraph);
+/* Stop recording, and free recorded events. */
+void DEG_debug_eval_profile_stop(struct Depsgraph *depsgraph);
+/* Write recorded events as Chrome/Perfetto trace JSON.
+ * Returns false when profiling was not started. */
+bool DEG_debug_eval_profile_write_trace(const struct Depsgraph *depsgraph, FILE *fp);
+
 /* ************************************************ */
 
 /* Compare two dependency graphs. */
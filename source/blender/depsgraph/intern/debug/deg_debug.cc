@@ -22,6 +22,7 @@
  */
 
 #include "intern/debug/deg_debug.h"
+#include "intern/debug/deg_eval_profiler.h"
 
 #include "BLI_console.h"
 #include "BLI_hash.h"
@@ -35,10 +36,18 @@
 namespace blender::deg {
 
 DepsgraphDebug::DepsgraphDebug()
-    : flags(G.debug), is_ever_evaluated(false), graph_evaluation_start_time_(0)
+    : flags(G.debug),
+      is_ever_evaluated(false),
+      eval_profiler(nullptr),
+      graph_evaluation_start_time_(0)
 {
 }
 
+DepsgraphDebug::~DepsgraphDebug()
+{
+  delete eval_profiler;
+}
+
 bool DepsgraphDebug::do_time_debug() const
 {
   return ((G.debug & G_DEBUG_DEPSGRAPH_TIME) != 0);
@@ -33,9 +33,12 @@
 namespace blender {
 namespace deg {
 
+class EvalProfiler;
+
 class DepsgraphDebug {
  public:
   DepsgraphDebug();
+  ~DepsgraphDebug();
 
   bool do_time_debug() const;
 
@@ -53,6 +56,10 @@ class DepsgraphDebug {
    * This is NOT an indication that depsgraph is at its evaluated state. */
   bool is_ever_evaluated;
 
+  /* Records timing of evaluated operations when profiling is enabled, NULL otherwise.
+   * See #DEG_debug_eval_profile_start. */
+  EvalProfiler *eval_profiler;
+
  protected:
   /* Maximum number of counters used to calculate frame rate of depsgraph update. */
   static const constexpr int MAX_FPS_COUNTERS = 64;
@@ -0,0 +1,183 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The Original Code is Copyright (C) 2021 Blender Foundation.
+ * All rights reserved.
+ */
+
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#include "intern/debug/deg_eval_profiler.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "PIL_time.h"
+
+#include "BLI_string.h"
+#include "BLI_utildefines.h"
+
+#include "DEG_depsgraph_debug.h"
+
+#include "atomic_ops.h"
+
+#include "intern/depsgraph.h"
+#include "intern/node/deg_node_component.h"
+#include "intern/node/deg_node_id.h"
+#include "intern/node/deg_node_operation.h"
+
+namespace deg = blender::deg;
+
+namespace blender::deg {
+
+namespace {
+
+/* Small sequential identifiers are easier to read in trace viewers than native thread IDs. */
+int current_thread_id()
+{
+  static uint32_t num_threads = 0;
+  static thread_local int thread_id = -1;
+  if (thread_id == -1) {
+    thread_id = (int)atomic_fetch_and_add_uint32(&num_threads, 1);
+  }
+  return thread_id;
+}
+
+void write_json_string(FILE *fp, const char *str)
+{
+  fputc('"', fp);
+  for (const char *c = str; *c; c++) {
+    if (ELEM(*c, '"', '\\')) {
+      fputc('\\', fp);
+      fputc(*c, fp);
+    }
+    else if ((unsigned char)*c < 0x20) {
+      fprintf(fp, "\\u%04x", *c);
+    }
+    else {
+      fputc(*c, fp);
+    }
+  }
+  fputc('"', fp);
+}
+
+}  // namespace
+
+EvalProfiler::EvalProfiler()
+    : start_time_(PIL_check_seconds_timer()),
+      events_((Event *)MEM_mallocN(sizeof(Event) * MAX_EVENTS, __func__)),
+      num_events_(0)
+{
+}
+
+EvalProfiler::~EvalProfiler()
+{
+  MEM_freeN(events_);
+}
+
+double EvalProfiler::now() const
+{
+  return PIL_check_seconds_timer();
+}
+
+void EvalProfiler::record(const OperationNode *operation_node,
+                          const float frame,
+                          const double start,
+                          const double end)
+{
+  const uint32_t index = atomic_fetch_and_add_uint32(&num_events_, 1) % MAX_EVENTS;
+  Event &event = events_[index];
+
+  const ComponentNode *comp_node = operation_node->owner;
+  const IDNode *id_node = comp_node->owner;
+  BLI_strncpy(event.id_name, id_node->id_orig->name, sizeof(event.id_name));
+  BLI_strncpy(event.component_name, comp_node->name.c_str(), sizeof(event.component_name));
+  event.component_type_name = nodeTypeAsString(comp_node->type);
+  event.operation_name = operationCodeAsString(operation_node->opcode);
+  event.name_tag = operation_node->name_tag;
+  event.thread_id = current_thread_id();
+  event.frame = frame;
+  event.start = start - start_time_;
+  event.end = end - start_time_;
+}
+
+void EvalProfiler::write_trace(FILE *fp) const
+{
+  const uint32_t num_events = std::min(num_events_, (uint32_t)MAX_EVENTS);
+  /* When the ring buffer wrapped around, the oldest event is at the write position. */
+  const uint32_t first_event = (num_events_ > (uint32_t)MAX_EVENTS) ? num_events_ % MAX_EVENTS : 0;
+
+  fprintf(fp, "{\"traceEvents\":[\n");
+  for (uint32_t i = 0; i < num_events; i++) {
+    const Event &event = events_[(first_event + i) % MAX_EVENTS];
+    fprintf(fp, "%s{\"name\":", (i == 0) ? "" : ",\n");
+    char name[MAX_ID_NAME + 128];
+    if (event.name_tag != -1) {
+      BLI_snprintf(name,
+                   sizeof(name),
+                   "%s %s[%d]",
+                   event.id_name + 2,
+                   event.operation_name,
+                   event.name_tag);
+    }
+    else {
+      BLI_snprintf(name, sizeof(name), "%s %s", event.id_name + 2, event.operation_name);
+    }
+    write_json_string(fp, name);
+    fprintf(fp, ",\"cat\":");
+    write_json_string(fp, event.component_type_name);
+    /* Chrome trace times are in microseconds. */
+    fprintf(fp,
+            ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"frame\":%g,"
+            "\"component\":",
+            event.thread_id,
+            event.start * 1e6,
+            (event.end - event.start) * 1e6,
+            event.frame);
+    write_json_string(fp, event.component_name);
+    fprintf(fp, "}}");
+  }
+  fprintf(fp, "\n],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+}  // namespace blender::deg
+
+void DEG_debug_eval_profile_start(Depsgraph *depsgraph)
+{
+  deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(depsgraph);
+  if (deg_graph->debug.eval_profiler == nullptr) {
+    deg_graph->debug.eval_profiler = new deg::EvalProfiler();
+  }
+}
+
+void DEG_debug_eval_profile_stop(Depsgraph *depsgraph)
+{
+  deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(depsgraph);
+  BLI_assert(!deg_graph->is_evaluating);
+  delete deg_graph->debug.eval_profiler;
+  deg_graph->debug.eval_profiler = nullptr;
+}
+
+bool DEG_debug_eval_profile_write_trace(const Depsgraph *depsgraph, FILE *fp)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(depsgraph);
+  if (deg_graph->debug.eval_profiler == nullptr) {
+    return false;
+  }
+  deg_graph->debug.eval_profiler->write_trace(fp);
+  return true;
+}
@@ -0,0 +1,79 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The Original Code is Copyright (C) 2021 Blender Foundation.
+ * All rights reserved.
+ */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#pragma once
+
+#include "intern/depsgraph_type.h"
+
+#include "DNA_ID.h"
+
+#include <stdio.h>
+
+namespace blender {
+namespace deg {
+
+struct OperationNode;
+
+/* Records start and end time of every evaluated operation, for every evaluation of the graph
+ * while it's enabled. Events are written into a fixed size ring buffer without locking, so the
+ * most recent events are kept when recording for a long time (e.g. playback). */
+class EvalProfiler {
+ public:
+  /* Maximum number of events kept, older events are overwritten. */
+  static const constexpr int MAX_EVENTS = 1 << 17;
+
+  EvalProfiler();
+  ~EvalProfiler();
+
+  /* Time stamp in seconds, to be passed to record(). */
+  double now() const;
+
+  /* Record evaluation of an operation. Can be called from any thread. */
+  void record(const OperationNode *operation_node, float frame, double start, double end);
+
+  /* Write all recorded events as Chrome/Perfetto trace JSON. */
+  void write_trace(FILE *fp) const;
+
+ protected:
+  struct Event {
+    char id_name[MAX_ID_NAME];
+    /* Component names are copied (they're bone names for example), the depsgraph might be
+     * rebuilt before the trace is written. */
+    char component_name[64];
+    const char *component_type_name;
+    const char *operation_name;
+    int name_tag;
+    int thread_id;
+    float frame;
+    /* Relative to start_time_, in seconds. */
+    double start, end;
+  };
+
+  double start_time_;
+  Event *events_;
+  /* Number of events ever recorded, the ring buffer position is this modulo MAX_EVENTS. */
+  uint32_t num_events_;
+};
+
+}  // namespace deg
+}  // namespace blender
@@ -209,6 +209,21 @@ Relation *Depsgraph::check_nodes_connected(const Node *from,
                                            const Node *to,
                                            const char *description)
 {
+  /* Some nodes have a lot of relations (the copy-on-write operation of an ID for example),
+   * so only look through the shorter of the two lists. */
+  if (to->inlinks.size() < from->outlinks.size()) {
+    for (Relation *rel : to->inlinks) {
+      BLI_assert(rel->to == to);
+      if (rel->from != from) {
+        continue;
+      }
+      if (description != nullptr && !STREQ(rel->name, description)) {
+        continue;
+      }
+      return rel;
+    }
+    return nullptr;
+  }
   for (Relation *rel : from->outlinks) {
     BLI_assert(rel->from == from);
     if (rel->to != to) {
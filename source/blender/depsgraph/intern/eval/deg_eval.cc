@@ -30,7 +30,11 @@
 #include "BLI_compiler_attrs.h"
 #include "BLI_gsqueue.h"
 #include "BLI_task.h"
+#include "BLI_threads.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
+
+#include <algorithm>
 
 #include "BKE_global.h"
 
@@ -43,6 +47,7 @@
 
 #include "atomic_ops.h"
 
+#include "intern/debug/deg_eval_profiler.h"
 #include "intern/depsgraph.h"
 #include "intern/depsgraph_relation.h"
 #include "intern/eval/deg_eval_copy_on_write.h"
@@ -73,6 +78,30 @@ void schedule_node_to_pool(OperationNode *node, const int UNUSED(thread_id), Tas
   BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
 }
 
+/* Keep the operation with the longest critical path in r_next_node, to be evaluated next by the
+ * current thread, and push all others to the pool. */
+void schedule_node_to_pool_or_keep(OperationNode *node,
+                                   const int thread_id,
+                                   TaskPool *pool,
+                                   OperationNode **r_next_node)
+{
+  if (*r_next_node == nullptr) {
+    *r_next_node = node;
+    return;
+  }
+  if (node->critical_path_time > (*r_next_node)->critical_path_time) {
+    std::swap(node, *r_next_node);
+  }
+  schedule_node_to_pool(node, thread_id, pool);
+}
+
+void schedule_node_to_vector(OperationNode *node,
+                             const int /*thread_id*/,
+                             Vector<OperationNode *> *r_nodes)
+{
+  r_nodes->append(node);
+}
+
 /* Denotes which part of dependency graph is being evaluated. */
 enum class EvaluationStage {
   /* Stage 1: Only  Copy-on-Write operations are to be evaluated, prior to anything else.
@@ -103,15 +132,23 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
 
   /* Sanity checks. */
   BLI_assert(!operation_node->is_noop() && "NOOP nodes should not actually be scheduled");
-  /* Perform operation. */
-  if (state->do_stats) {
-    const double start_time = PIL_check_seconds_timer();
-    operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += PIL_check_seconds_timer() - start_time;
+  /* Perform operation. The timing is always measured, it's used to estimate critical paths. */
+  const double start_time = PIL_check_seconds_timer();
+  operation_node->evaluate(depsgraph);
+  const double end_time = PIL_check_seconds_timer();
+  const double eval_time = end_time - start_time;
+  if (UNLIKELY(state->graph->debug.eval_profiler != nullptr)) {
+    state->graph->debug.eval_profiler->record(
+        operation_node, state->graph->ctime, start_time, end_time);
   }
-  else {
-    operation_node->evaluate(depsgraph);
+  if (state->do_stats) {
+    operation_node->stats.current_time += eval_time;
   }
+  /* Only the thread evaluating the operation writes to it, no need for synchronization. */
+  operation_node->average_time = (operation_node->average_time == 0.0f) ?
+                                     (float)eval_time :
+                                     0.75f * operation_node->average_time +
+                                         0.25f * (float)eval_time;
 }
 
 void deg_task_run_func(TaskPool *pool, void *taskdata)
@@ -119,12 +156,17 @@ void deg_task_run_func(TaskPool *pool, void *taskdata)
   void *userdata_v = BLI_task_pool_user_data(pool);
   DepsgraphEvalState *state = (DepsgraphEvalState *)userdata_v;
 
-  /* Evaluate node. */
   OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
-  evaluate_node(state, operation_node);
+  while (operation_node != nullptr) {
+    /* Evaluate node. */
+    evaluate_node(state, operation_node);
 
-  /* Schedule children. */
-  schedule_children(state, operation_node, schedule_node_to_pool, pool);
+    /* Schedule children. The most critical child is evaluated right away by this thread, so long
+     * chains of operations don't wait behind other work and avoid the scheduling overhead. */
+    OperationNode *next_node = nullptr;
+    schedule_children(state, operation_node, schedule_node_to_pool_or_keep, pool, &next_node);
+    operation_node = next_node;
+  }
 }
 
 bool check_operation_node_visible(OperationNode *op_node)
@@ -177,10 +219,65 @@ void calculate_pending_parents(Depsgraph *graph)
   }
 }
 
+bool need_evaluate_operation(OperationNode *node)
+{
+  return check_operation_node_visible(node) && (node->flag & DEPSOP_FLAG_NEEDS_UPDATE);
+}
+
+/* Compute OperationNode.critical_path_time for all operations which are to be evaluated, using
+ * the given per-operation time. Operations are visited in reverse topological order: an operation
+ * is handled once all operations depending on it are. The custom_flags are used to count the
+ * dependent operations which are not handled yet. */
+template<typename TimeFunction>
+void calculate_critical_path(Depsgraph *graph, TimeFunction time_function)
+{
+  Vector<OperationNode *> stack;
+  for (OperationNode *node : graph->operations) {
+    node->custom_flags = 0;
+    if (!need_evaluate_operation(node)) {
+      continue;
+    }
+    for (Relation *rel : node->outlinks) {
+      OperationNode *child = (OperationNode *)rel->to;
+      if ((rel->flag & RELATION_FLAG_CYCLIC) == 0 && need_evaluate_operation(child)) {
+        node->custom_flags++;
+      }
+    }
+  }
+  for (OperationNode *node : graph->operations) {
+    if (node->custom_flags == 0 && need_evaluate_operation(node)) {
+      stack.append(node);
+    }
+  }
+
+  while (!stack.is_empty()) {
+    OperationNode *node = stack.pop_last();
+    float path_time = 0.0f;
+    for (Relation *rel : node->outlinks) {
+      OperationNode *child = (OperationNode *)rel->to;
+      if ((rel->flag & RELATION_FLAG_CYCLIC) == 0 && need_evaluate_operation(child)) {
+        path_time = max_ff(path_time, child->critical_path_time);
+      }
+    }
+    node->critical_path_time = time_function(node) + path_time;
+
+    for (Relation *rel : node->inlinks) {
+      if (rel->from->type != NodeType::OPERATION || (rel->flag & RELATION_FLAG_CYCLIC)) {
+        continue;
+      }
+      OperationNode *parent = (OperationNode *)rel->from;
+      if (need_evaluate_operation(parent) && --parent->custom_flags == 0) {
+        stack.append(parent);
+      }
+    }
+  }
+}
+
 void initialize_execution(DepsgraphEvalState *state, Depsgraph *graph)
 {
   const bool do_stats = state->do_stats;
   calculate_pending_parents(graph);
+  calculate_critical_path(graph, [](const OperationNode *node) { return node->average_time; });
   /* Clear tags and other things which needs to be clear. */
   for (OperationNode *node : graph->operations) {
     if (do_stats) {
@@ -313,6 +410,19 @@ void schedule_node_to_queue(OperationNode *node,
   BLI_gsqueue_push(evaluation_queue, &node);
 }
 
+/* Schedule all operations which are ready for evaluation, the most critical ones first. */
+void schedule_graph_to_pool(DepsgraphEvalState *state, TaskPool *pool)
+{
+  Vector<OperationNode *> nodes;
+  schedule_graph(state, schedule_node_to_vector, &nodes);
+  std::stable_sort(nodes.begin(), nodes.end(), [](OperationNode *a, OperationNode *b) {
+    return a->critical_path_time > b->critical_path_time;
+  });
+  for (OperationNode *node : nodes) {
+    schedule_node_to_pool(node, 0, pool);
+  }
+}
+
 void evaluate_graph_single_threaded(DepsgraphEvalState *state)
 {
   GSQueue *evaluation_queue = BLI_gsqueue_new(sizeof(OperationNode *));
@@ -345,6 +455,34 @@ void depsgraph_ensure_view_layer(Depsgraph *graph)
   deg_update_copy_on_write_datablock(graph, scene_id_node);
 }
 
+/* Compare the evaluation wall time against the lower bounds given by the longest chain of
+ * dependent operations and by the total amount of work spread over all threads. */
+void print_critical_path_stats(Depsgraph *graph, const double wall_time)
+{
+  float critical_path_time = 0.0f;
+  double total_time = 0.0;
+  for (OperationNode *node : graph->operations) {
+    total_time += node->stats.current_time;
+  }
+  /* Tags are still set, so the same operations are considered as during evaluation. */
+  calculate_critical_path(graph, [](const OperationNode *node) {
+    return (float)node->stats.current_time;
+  });
+  for (OperationNode *node : graph->operations) {
+    if (need_evaluate_operation(node)) {
+      critical_path_time = max_ff(critical_path_time, node->critical_path_time);
+    }
+  }
+  const int num_threads = BLI_system_thread_count();
+  printf("Depsgraph evaluation: wall time %f seconds, critical path %f seconds, ",
+         wall_time,
+         critical_path_time);
+  printf("work %f seconds on %d threads (%f seconds per thread).\n",
+         total_time,
+         num_threads,
+         total_time / num_threads);
+}
+
 }  // namespace
 
 static TaskPool *deg_evaluate_task_pool_create(DepsgraphEvalState *state)
@@ -374,6 +512,7 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
 
   graph->is_evaluating = true;
   depsgraph_ensure_view_layer(graph);
+  const double start_time = PIL_check_seconds_timer();
   /* Set up evaluation state. */
   DepsgraphEvalState state;
   state.graph = graph;
@@ -386,14 +525,14 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   /* First, process all Copy-On-Write nodes. */
   state.stage = EvaluationStage::COPY_ON_WRITE;
   TaskPool *task_pool = deg_evaluate_task_pool_create(&state);
-  schedule_graph(&state, schedule_node_to_pool, task_pool);
+  schedule_graph_to_pool(&state, task_pool);
   BLI_task_pool_work_and_wait(task_pool);
   BLI_task_pool_free(task_pool);
 
   /* After that, process all other nodes. */
   state.stage = EvaluationStage::THREADED_EVALUATION;
   task_pool = deg_evaluate_task_pool_create(&state);
-  schedule_graph(&state, schedule_node_to_pool, task_pool);
+  schedule_graph_to_pool(&state, task_pool);
   BLI_task_pool_work_and_wait(task_pool);
   BLI_task_pool_free(task_pool);
 
@@ -407,6 +546,7 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
    * synchronization. */
   if (state.do_stats) {
     deg_eval_stats_aggregate(graph);
+    print_critical_path_stats(graph, PIL_check_seconds_timer() - start_time);
   }
   /* Clear any uncleared tags - just in case. */
   deg_graph_clear_tags(graph);
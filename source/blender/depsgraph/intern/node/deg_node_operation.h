@@ -273,6 +273,12 @@ struct OperationNode : public Node {
   /* (OperationFlag) extra settings affecting evaluation. */
   int flag;
 
+  /* Evaluation time in seconds, averaged over previous evaluations. */
+  float average_time;
+  /* Estimated time needed to evaluate this operation and the longest chain of operations
+   * depending on it. Operations with the longest remaining path are evaluated first. */
+  float critical_path_time;
+
   DEG_DEPSNODE_DECLARE;
 };
 
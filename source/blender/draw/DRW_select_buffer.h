@@ -77,6 +77,8 @@ typedef struct SELECTID_Context {
 
   /* To check for updates. */
   float persmat[4][4];
+  /** Viewport settings affecting the drawn elements (X-ray, face dots, clipping). */
+  int view_flag;
   bool is_dirty;
 } SELECTID_Context;
 
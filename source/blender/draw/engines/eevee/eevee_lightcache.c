@@ -75,6 +75,11 @@
   (IRRADIANCE_MAX_POOL_SIZE / IRRADIANCE_SAMPLE_SIZE_X) * \
       (IRRADIANCE_MAX_POOL_SIZE / IRRADIANCE_SAMPLE_SIZE_Y)
 
+/* Number of irradiance samples rendered per draw manager pipeline. Larger batches amortize the
+ * scene cache creation but keep the draw manager locked longer, which stalls the viewport. */
+#define LIGHTBAKE_GRID_BATCH_LEN 4
+#define LIGHTBAKE_GRID_BATCH_LEN_BACKGROUND 64
+
 /* TODO should be replace by a more elegant alternative. */
 extern void DRW_opengl_context_enable(void);
 extern void DRW_opengl_context_disable(void);
@@ -131,6 +136,8 @@ typedef struct EEVEE_LightBake {
   int grid_sample;
   /** Total number of samples for the current grid. */
   int grid_sample_len;
+  /** Number of samples of the current grid rendered in the same pipeline, from `grid_sample`. */
+  int grid_sample_batch_len;
   /** Nth grid in the cache being rendered. */
   int grid_curr;
   /** The current light bounce being evaluated. */
@@ -1105,33 +1112,24 @@ static void grid_loc_to_world_loc(EEVEE_LightGrid *egrid, const int local_cell[3
   madd_v3_v3fl(r_pos, egrid->increment_z, local_cell[2]);
 }
 
-static void eevee_lightbake_render_grid_sample(void *ved, void *user_data)
+/* Render and filter one sample of the current grid. Expects `lcache->grid_tx.tex` to contain the
+ * previous bounce. */
+static void eevee_lightbake_render_grid_sample_ex(EEVEE_Data *vedata,
+                                                  EEVEE_ViewLayerData *sldata,
+                                                  EEVEE_LightBake *lbake,
+                                                  LightCache *lcache,
+                                                  const int grid_sample)
 {
-  EEVEE_Data *vedata = (EEVEE_Data *)ved;
-  EEVEE_ViewLayerData *sldata = EEVEE_view_layer_data_ensure();
   EEVEE_CommonUniformBuffer *common_data = &sldata->common_data;
-  EEVEE_LightBake *lbake = (EEVEE_LightBake *)user_data;
   EEVEE_LightGrid *egrid = lbake->grid;
   LightProbe *prb = *lbake->probe;
-  Scene *scene_eval = DEG_get_evaluated_scene(lbake->depsgraph);
-  LightCache *lcache = scene_eval->eevee.light_cache_data;
   int grid_loc[3], sample_id, sample_offset, stride;
   float pos[3];
-  const bool is_last_bounce_sample = ((egrid->offset + lbake->grid_sample) ==
+  const bool is_last_bounce_sample = ((egrid->offset + grid_sample) ==
                                       (lbake->total_irr_samples - 1));
 
-  /* No bias for rendering the probe. */
-  egrid->level_bias = 1.0f;
-
-  /* Use the previous bounce for rendering this bounce. */
-  SWAP(GPUTexture *, lbake->grid_prev, lcache->grid_tx.tex);
-
-  /* TODO do this once for the whole bake when we have independent DRWManagers.
-   * Warning: Some of the things above require this. */
-  eevee_lightbake_cache_create(vedata, lbake);
-
   /* Compute sample position */
-  compute_cell_id(egrid, prb, lbake->grid_sample, &sample_id, grid_loc, &stride);
+  compute_cell_id(egrid, prb, grid_sample, &sample_id, grid_loc, &stride);
   sample_offset = egrid->offset + sample_id;
 
   grid_loc_to_world_loc(egrid, grid_loc, pos);
@@ -1185,11 +1183,40 @@ static void eevee_lightbake_render_grid_sample(void *ved, void *user_data)
 
   /* If it is the last sample grid sample (and last bounce). */
   if ((lbake->bounce_curr == lbake->bounce_len - 1) && (lbake->grid_curr == lbake->grid_len - 1) &&
-      (lbake->grid_sample == lbake->grid_sample_len - 1)) {
+      (grid_sample == lbake->grid_sample_len - 1)) {
     lcache->flag &= ~LIGHTCACHE_UPDATE_GRID;
   }
 }
 
+/* Render `grid_sample_batch_len` samples of the current grid. They all share the same probe and
+ * bounce, so the scene cache only needs to be created once for the whole batch. */
+static void eevee_lightbake_render_grid_sample(void *ved, void *user_data)
+{
+  EEVEE_Data *vedata = (EEVEE_Data *)ved;
+  EEVEE_ViewLayerData *sldata = EEVEE_view_layer_data_ensure();
+  EEVEE_LightBake *lbake = (EEVEE_LightBake *)user_data;
+  Scene *scene_eval = DEG_get_evaluated_scene(lbake->depsgraph);
+  LightCache *lcache = scene_eval->eevee.light_cache_data;
+
+  /* No bias for rendering the probe. */
+  lbake->grid->level_bias = 1.0f;
+
+  /* Use the previous bounce for rendering this bounce. */
+  SWAP(GPUTexture *, lbake->grid_prev, lcache->grid_tx.tex);
+
+  /* TODO do this once for the whole bake when we have independent DRWManagers.
+   * Warning: Some of the things above require this. */
+  eevee_lightbake_cache_create(vedata, lbake);
+
+  for (int i = 0; i < lbake->grid_sample_batch_len; i++) {
+    if (i > 0) {
+      /* Swapped back by the previous sample before filtering. */
+      SWAP(GPUTexture *, lbake->grid_prev, lcache->grid_tx.tex);
+    }
+    eevee_lightbake_render_grid_sample_ex(vedata, sldata, lbake, lcache, lbake->grid_sample + i);
+  }
+}
+
 static void eevee_lightbake_render_probe_sample(void *ved, void *user_data)
 {
   EEVEE_Data *vedata = (EEVEE_Data *)ved;
@@ -1346,7 +1373,8 @@ void EEVEE_lightbake_update(void *custom_data)
 }
 
 static bool lightbake_do_sample(EEVEE_LightBake *lbake,
-                                void (*render_callback)(void *ved, void *user_data))
+                                void (*render_callback)(void *ved, void *user_data),
+                                const int samples_len)
 {
   if (G.is_break == true || *lbake->stop) {
     return false;
@@ -1357,7 +1385,7 @@ static bool lightbake_do_sample(EEVEE_LightBake *lbake,
   /* TODO: make DRW manager instantiable (and only lock on drawing) */
   eevee_lightbake_context_enable(lbake);
   DRW_custom_pipeline(&draw_engine_eevee_type, depsgraph, render_callback, lbake);
-  lbake->done += 1;
+  lbake->done += samples_len;
   *lbake->progress = lbake->done / (float)lbake->total;
   *lbake->do_update = 1;
   eevee_lightbake_context_disable(lbake);
@@ -1421,11 +1449,13 @@ void EEVEE_lightbake_job(void *custom_data, short *stop, short *do_update, float
   /* Render world irradiance and reflection first */
   if (lcache->flag & LIGHTCACHE_UPDATE_WORLD) {
     lbake->probe = NULL;
-    lightbake_do_sample(lbake, eevee_lightbake_render_world_sample);
+    lightbake_do_sample(lbake, eevee_lightbake_render_world_sample, 1);
   }
 
   /* Render irradiance grids */
   if (lcache->flag & LIGHTCACHE_UPDATE_GRID) {
+    const int batch_len = G.background ? LIGHTBAKE_GRID_BATCH_LEN_BACKGROUND :
+                                         LIGHTBAKE_GRID_BATCH_LEN;
     for (lbake->bounce_curr = 0; lbake->bounce_curr < lbake->bounce_len; lbake->bounce_curr++) {
       /* Bypass world, start at 1. */
       lbake->probe = lbake->grid_prb + 1;
@@ -1436,8 +1466,11 @@ void EEVEE_lightbake_job(void *custom_data, short *stop, short *do_update, float
         lbake->grid_sample_len = prb->grid_resolution_x * prb->grid_resolution_y *
                                  prb->grid_resolution_z;
         for (lbake->grid_sample = 0; lbake->grid_sample < lbake->grid_sample_len;
-             ++lbake->grid_sample) {
-          lightbake_do_sample(lbake, eevee_lightbake_render_grid_sample);
+             lbake->grid_sample += lbake->grid_sample_batch_len) {
+          lbake->grid_sample_batch_len = min_ii(batch_len,
+                                                lbake->grid_sample_len - lbake->grid_sample);
+          lightbake_do_sample(
+              lbake, eevee_lightbake_render_grid_sample, lbake->grid_sample_batch_len);
         }
       }
     }
@@ -1450,7 +1483,7 @@ void EEVEE_lightbake_job(void *custom_data, short *stop, short *do_update, float
     lbake->cube = lcache->cube_data + 1;
     for (lbake->cube_offset = 1; lbake->cube_offset < lbake->cube_len;
          lbake->cube_offset++, lbake->probe++, lbake->cube++) {
-      lightbake_do_sample(lbake, eevee_lightbake_render_probe_sample);
+      lightbake_do_sample(lbake, eevee_lightbake_render_probe_sample, 1);
     }
   }
 
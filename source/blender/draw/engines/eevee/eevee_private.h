@@ -52,6 +52,7 @@ extern struct DrawEngineType draw_engine_eevee_type;
 #define MAX_SHADOW 128 /* TODO : Make this depends on GL_MAX_ARRAY_TEXTURE_LAYERS */
 #define MAX_SHADOW_CASCADE 8
 #define MAX_SHADOW_CUBE (MAX_SHADOW - MAX_CASCADE_NUM * MAX_SHADOW_CASCADE)
+#define MAX_SHADOW_CASCADE_LAYER (MAX_CASCADE_NUM * MAX_SHADOW_CASCADE)
 #define MAX_BLOOM_STEP 16
 #define MAX_AOVS 64
 
@@ -576,6 +577,9 @@ typedef struct EEVEE_LightsInfo {
   uchar shadow_cascade_light_indices[MAX_SHADOW_CASCADE];
   /* Update bitmap. */
   BLI_bitmap sh_cube_update[BLI_BITMAP_SIZE(MAX_SHADOW_CUBE)];
+  /* Cascade layers still containing the render of `sh_cascade_layer_mat`. */
+  BLI_bitmap sh_cascade_layer_valid[BLI_BITMAP_SIZE(MAX_SHADOW_CASCADE_LAYER)];
+  float sh_cascade_layer_mat[MAX_SHADOW_CASCADE_LAYER][4][4];
   /* Lights tracking */
   struct BoundSphere shadow_bounds[MAX_LIGHT]; /* Tightly packed light bounds  */
   /* List of bbox and update bitmap. Double buffered. */
@@ -426,8 +426,16 @@ void EEVEE_shadows_draw_cascades(EEVEE_ViewLayerData *sldata,
    * The only time it's more beneficial is when the CPU culling overhead
    * outweigh the instancing overhead. which is rarely the case. */
   for (int j = 0; j < csm_render->cascade_count; j++) {
-    DRW_view_set_active(g_data->cube_views[j]);
     int layer = csm_data->tex_id + j;
+    /* Skip layers already rendered from the same matrix with no shadow caster update since. */
+    if (BLI_BITMAP_TEST(linfo->sh_cascade_layer_valid, layer) &&
+        equals_m4m4(linfo->sh_cascade_layer_mat[layer], csm_data->shadowmat[j])) {
+      continue;
+    }
+    BLI_BITMAP_ENABLE(linfo->sh_cascade_layer_valid, layer);
+    copy_m4_m4(linfo->sh_cascade_layer_mat[layer], csm_data->shadowmat[j]);
+
+    DRW_view_set_active(g_data->cube_views[j]);
     GPU_framebuffer_texture_layer_attach(
         sldata->shadow_fb, sldata->shadow_cascade_pool, 0, layer, 0);
     GPU_framebuffer_bind(sldata->shadow_fb);
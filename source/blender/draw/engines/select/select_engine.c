@@ -24,6 +24,8 @@
 
 #include "DNA_screen_types.h"
 
+#include "ED_view3d.h"
+
 #include "UI_resources.h"
 
 #include "DRW_engine.h"
@@ -199,15 +201,27 @@ static void select_cache_init(void *vedata)
 
   /* Check if the viewport has changed. */
   float(*persmat)[4] = draw_ctx->rv3d->persmat;
-  e_data.context.is_dirty = !compare_m4m4(e_data.context.persmat, persmat, FLT_EPSILON);
+  const int view_flag = (XRAY_FLAG_ENABLED(draw_ctx->v3d) ? (1 << 0) : 0) |
+                        ((draw_ctx->v3d->overlay.edit_flag & V3D_OVERLAY_EDIT_FACE_DOT) ?
+                             (1 << 1) :
+                             0) |
+                        (RV3D_CLIPPING_ENABLED(draw_ctx->v3d, draw_ctx->rv3d) ? (1 << 2) : 0);
+  e_data.context.is_dirty = !compare_m4m4(e_data.context.persmat, persmat, FLT_EPSILON) ||
+                            (e_data.context.view_flag != view_flag);
 
   if (!e_data.context.is_dirty) {
-    /* Check if any of the drawn objects have been transformed. */
+    /* Check if any of the drawn objects have been transformed or edited.
+     * The buffer can be kept from a previous operator, so geometry changes matter too. */
+    const int recalc_flag = ID_RECALC_TRANSFORM | ID_RECALC_GEOMETRY;
     Object **ob = &e_data.context.objects_drawn[0];
     for (uint i = e_data.context.objects_drawn_len; i--; ob++) {
       DrawData *data = DRW_drawdata_get(&(*ob)->id, &draw_engine_select_type);
-      if (data && (data->recalc & ID_RECALC_TRANSFORM) != 0) {
-        data->recalc &= ~ID_RECALC_TRANSFORM;
+      if (data == NULL) {
+        /* Draw data was freed, the object has been reallocated. */
+        e_data.context.is_dirty = true;
+      }
+      else if ((data->recalc & recalc_flag) != 0) {
+        data->recalc &= ~recalc_flag;
         e_data.context.is_dirty = true;
       }
     }
@@ -216,6 +230,7 @@ static void select_cache_init(void *vedata)
   if (e_data.context.is_dirty) {
     /* Remove all tags from drawn or culled objects. */
     copy_m4_m4(e_data.context.persmat, persmat);
+    e_data.context.view_flag = view_flag;
     e_data.context.objects_drawn_len = 0;
     e_data.context.index_drawn_len = 1;
     select_engine_framebuffer_setup();
@@ -22,6 +22,7 @@
 
 #pragma once
 
+struct BMesh;
 struct TaskGraph;
 
 /* Vertex Group Selection and display options */
@@ -258,6 +259,11 @@ typedef struct MeshBatchCache {
   float tot_area, tot_uv_area;
 
   bool no_loose_wire;
+
+  /* Only edit-mesh coordinates changed since the buffers were extracted,
+   * `pos_nor` can be updated in place for the faces in `deform_face_range` (end exclusive). */
+  bool is_deform_dirty;
+  int deform_face_range[2];
 } MeshBatchCache;
 
 void mesh_buffer_cache_create_requested(struct TaskGraph *task_graph,
@@ -275,3 +281,8 @@ void mesh_buffer_cache_create_requested(struct TaskGraph *task_graph,
                                         const Scene *scene,
                                         const ToolSettings *ts,
                                         const bool use_hide);
+
+void mesh_buffer_cache_update_pos_nor_range(GPUVertBuf *vbo,
+                                            struct BMesh *bm,
+                                            const int face_start,
+                                            const int face_end);
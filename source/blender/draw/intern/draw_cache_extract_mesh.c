@@ -246,36 +246,58 @@ static void mesh_render_data_update_normals(MeshRenderData *mr,
 
   if (mr->extract_type != MR_EXTRACT_BMESH) {
     /* Mesh */
+    /* Reuse the normals the modifier stack already stored on the evaluated mesh,
+     * as long as the coordinates didn't change since. */
+    const bool vert_normals_valid = (me->runtime.cd_dirty_vert & CD_MASK_NORMAL) == 0;
+    const float(*cached_poly_normals)[3] = NULL;
+    const float(*cached_loop_normals)[3] = NULL;
+    if (vert_normals_valid && (me->runtime.cd_dirty_poly & CD_MASK_NORMAL) == 0) {
+      cached_poly_normals = CustomData_get_layer(&me->pdata, CD_NORMAL);
+    }
+    if (vert_normals_valid && (me->runtime.cd_dirty_loop & CD_MASK_NORMAL) == 0) {
+      cached_loop_normals = CustomData_get_layer(&me->ldata, CD_NORMAL);
+    }
+
     if (data_flag & (MR_DATA_POLY_NOR | MR_DATA_LOOP_NOR | MR_DATA_TAN_LOOP_NOR)) {
       mr->poly_normals = MEM_mallocN(sizeof(*mr->poly_normals) * mr->poly_len, __func__);
-      BKE_mesh_calc_normals_poly((MVert *)mr->mvert,
-                                 NULL,
-                                 mr->vert_len,
-                                 mr->mloop,
-                                 mr->mpoly,
-                                 mr->loop_len,
-                                 mr->poly_len,
-                                 mr->poly_normals,
-                                 true);
+      if (cached_poly_normals) {
+        memcpy(mr->poly_normals, cached_poly_normals, sizeof(*mr->poly_normals) * mr->poly_len);
+      }
+      else {
+        BKE_mesh_calc_normals_poly((MVert *)mr->mvert,
+                                   NULL,
+                                   mr->vert_len,
+                                   mr->mloop,
+                                   mr->mpoly,
+                                   mr->loop_len,
+                                   mr->poly_len,
+                                   mr->poly_normals,
+                                   true);
+      }
     }
     if (((data_flag & MR_DATA_LOOP_NOR) && is_auto_smooth) || (data_flag & MR_DATA_TAN_LOOP_NOR)) {
       mr->loop_normals = MEM_mallocN(sizeof(*mr->loop_normals) * mr->loop_len, __func__);
-      short(*clnors)[2] = CustomData_get_layer(&mr->me->ldata, CD_CUSTOMLOOPNORMAL);
-      BKE_mesh_normals_loop_split(mr->me->mvert,
-                                  mr->vert_len,
-                                  mr->me->medge,
-                                  mr->edge_len,
-                                  mr->me->mloop,
-                                  mr->loop_normals,
-                                  mr->loop_len,
-                                  mr->me->mpoly,
-                                  mr->poly_normals,
-                                  mr->poly_len,
-                                  is_auto_smooth,
-                                  split_angle,
-                                  NULL,
-                                  clnors,
-                                  NULL);
+      if (cached_loop_normals) {
+        memcpy(mr->loop_normals, cached_loop_normals, sizeof(*mr->loop_normals) * mr->loop_len);
+      }
+      else {
+        short(*clnors)[2] = CustomData_get_layer(&mr->me->ldata, CD_CUSTOMLOOPNORMAL);
+        BKE_mesh_normals_loop_split(mr->me->mvert,
+                                    mr->vert_len,
+                                    mr->me->medge,
+                                    mr->edge_len,
+                                    mr->me->mloop,
+                                    mr->loop_normals,
+                                    mr->loop_len,
+                                    mr->me->mpoly,
+                                    mr->poly_normals,
+                                    mr->poly_len,
+                                    is_auto_smooth,
+                                    split_angle,
+                                    NULL,
+                                    clnors,
+                                    NULL);
+      }
     }
   }
   else {
@@ -763,10 +785,18 @@ typedef void(ExtractFinishFn)(const MeshRenderData *mr,
                               struct MeshBatchCache *cache,
                               void *buffer,
                               void *data);
+typedef void *(ExtractTaskInitFn)(void *userdata);
+typedef void(ExtractTaskFinishFn)(void *userdata, void *task_userdata);
 
 typedef struct MeshExtract {
   /** Executed on main thread and return user data for iteration functions. */
   ExtractInitFn *init;
+  /**
+   * Executed at the start of every task (optional), returns the user data given to the
+   * iteration functions of this task. Used by extractors which can't share their user data
+   * between threads, e.g. to write to a partial buffer.
+   */
+  ExtractTaskInitFn *task_init;
   /** Executed on one (or more if use_threading) worker thread(s). */
   ExtractTriBMeshFn *iter_looptri_bm;
   ExtractTriMeshFn *iter_looptri_mesh;
@@ -776,6 +806,11 @@ typedef struct MeshExtract {
   ExtractLEdgeMeshFn *iter_ledge_mesh;
   ExtractLVertBMeshFn *iter_lvert_bm;
   ExtractLVertMeshFn *iter_lvert_mesh;
+  /**
+   * Executed at the end of every task (optional), merges the data created by `task_init` into
+   * the user data and frees it. Calls are never done concurrently for the same extraction.
+   */
+  ExtractTaskFinishFn *task_finish;
   /** Executed on one worker thread after all elements iterations. */
   ExtractFinishFn *finish;
   /** Used to request common data. */
@@ -796,6 +831,31 @@ BLI_INLINE eMRIterType mesh_extract_iter_type(const MeshExtract *ext)
 
 /** \} */
 
+/* ---------------------------------------------------------------------- */
+/** \name Extract Index Buffer Builder Tasks
+ *
+ * For extractors with a #GPUIndexBufBuilder as user data that only use the
+ * `GPU_indexbuf_set_*` functions: every task fills its own sub-builder.
+ * \{ */
+
+static void *extract_elb_task_init(void *userdata)
+{
+  GPUIndexBufBuilder *elb = userdata;
+  GPUIndexBufBuilder *sub_builder = MEM_mallocN(sizeof(*sub_builder), __func__);
+  GPU_indexbuf_subbuild_init(elb, sub_builder);
+  return sub_builder;
+}
+
+static void extract_elb_task_finish(void *userdata, void *task_userdata)
+{
+  GPUIndexBufBuilder *elb = userdata;
+  GPUIndexBufBuilder *sub_builder = task_userdata;
+  GPU_indexbuf_join(elb, sub_builder);
+  MEM_freeN(sub_builder);
+}
+
+/** \} */
+
 /* ---------------------------------------------------------------------- */
 /** \name Extract Triangles Indices
  * \{ */
@@ -804,6 +864,8 @@ typedef struct MeshExtract_Tri_Data {
   GPUIndexBufBuilder elb;
   int *tri_mat_start;
   int *tri_mat_end;
+  /** Index of the first triangle of each visible polygon in the index buffer. */
+  int *poly_tri_ofs;
 } MeshExtract_Tri_Data;
 
 static void *extract_tris_init(const MeshRenderData *mr,
@@ -848,25 +910,70 @@ static void *extract_tris_init(const MeshRenderData *mr,
 
   memcpy(data->tri_mat_end, mat_tri_len, mat_tri_idx_size);
 
+  /* Store where the triangles of every polygon start, so they can be written from multiple
+   * threads in the same order as a sequential iteration over the triangles. */
+  data->poly_tri_ofs = MEM_malloc_arrayN(max_ii(mr->poly_len, 1), sizeof(int), __func__);
+  int *mat_tri_ofs = data->tri_mat_end;
+  if (mr->extract_type == MR_EXTRACT_BMESH) {
+    BMIter iter;
+    BMFace *efa;
+    int f_index;
+    BM_ITER_MESH_INDEX (efa, &iter, mr->bm, BM_FACES_OF_MESH, f_index) {
+      if (!BM_elem_flag_test(efa, BM_ELEM_HIDDEN)) {
+        int mat = min_ii(efa->mat_nr, mr->mat_len - 1);
+        data->poly_tri_ofs[f_index] = mat_tri_ofs[mat];
+        mat_tri_ofs[mat] += efa->len - 2;
+      }
+    }
+  }
+  else {
+    const MPoly *mp = mr->mpoly;
+    for (int mp_index = 0; mp_index < mr->poly_len; mp_index++, mp++) {
+      if (!(mr->use_hide && (mp->flag & ME_HIDE))) {
+        int mat = min_ii(mp->mat_nr, mr->mat_len - 1);
+        data->poly_tri_ofs[mp_index] = mat_tri_ofs[mat];
+        mat_tri_ofs[mat] += mp->totloop - 2;
+      }
+    }
+  }
+
   int visible_tri_tot = ofs;
   GPU_indexbuf_init(&data->elb, GPU_PRIM_TRIS, visible_tri_tot, mr->loop_len);
 
   return data;
 }
 
-static void extract_tris_iter_looptri_bm(const MeshRenderData *mr,
+static void *extract_tris_task_init(void *_data)
+{
+  MeshExtract_Tri_Data *data = _data;
+  MeshExtract_Tri_Data *data_task = MEM_mallocN(sizeof(*data_task), __func__);
+  *data_task = *data;
+  GPU_indexbuf_subbuild_init(&data->elb, &data_task->elb);
+  return data_task;
+}
+
+static void extract_tris_task_finish(void *_data, void *_data_task)
+{
+  MeshExtract_Tri_Data *data = _data;
+  MeshExtract_Tri_Data *data_task = _data_task;
+  GPU_indexbuf_join(&data->elb, &data_task->elb);
+  MEM_freeN(data_task);
+}
+
+static void extract_tris_iter_looptri_bm(const MeshRenderData *UNUSED(mr),
                                          const struct ExtractTriBMesh_Params *params,
                                          void *_data)
 {
   MeshExtract_Tri_Data *data = _data;
-  const int mat_last = mr->mat_len - 1;
-  EXTRACT_TRIS_LOOPTRI_FOREACH_BM_BEGIN(elt, _elt_index, params)
+  EXTRACT_TRIS_LOOPTRI_FOREACH_BM_BEGIN(elt, elt_index, params)
   {
-    if (!BM_elem_flag_test(elt[0]->f, BM_ELEM_HIDDEN)) {
-      int *mat_tri_ofs = data->tri_mat_end;
-      const int mat = min_ii(elt[0]->f->mat_nr, mat_last);
+    const BMFace *efa = elt[0]->f;
+    if (!BM_elem_flag_test(efa, BM_ELEM_HIDDEN)) {
+      const int f_index = BM_elem_index_get(efa);
+      const int tri_first_index = poly_to_tri_count(f_index,
+                                                    BM_elem_index_get(BM_FACE_FIRST_LOOP(efa)));
       GPU_indexbuf_set_tri_verts(&data->elb,
-                                 mat_tri_ofs[mat]++,
+                                 data->poly_tri_ofs[f_index] + (elt_index - tri_first_index),
                                  BM_elem_index_get(elt[0]),
                                  BM_elem_index_get(elt[1]),
                                  BM_elem_index_get(elt[2]));
@@ -880,15 +987,16 @@ static void extract_tris_iter_looptri_mesh(const MeshRenderData *mr,
                                            void *_data)
 {
   MeshExtract_Tri_Data *data = _data;
-  const int mat_last = mr->mat_len - 1;
-  EXTRACT_TRIS_LOOPTRI_FOREACH_MESH_BEGIN(mlt, _mlt_index, params)
+  EXTRACT_TRIS_LOOPTRI_FOREACH_MESH_BEGIN(mlt, mlt_index, params)
   {
     const MPoly *mp = &mr->mpoly[mlt->poly];
     if (!(mr->use_hide && (mp->flag & ME_HIDE))) {
-      int *mat_tri_ofs = data->tri_mat_end;
-      const int mat = min_ii(mp->mat_nr, mat_last);
-      GPU_indexbuf_set_tri_verts(
-          &data->elb, mat_tri_ofs[mat]++, mlt->tri[0], mlt->tri[1], mlt->tri[2]);
+      const int tri_first_index = poly_to_tri_count(mlt->poly, mp->loopstart);
+      GPU_indexbuf_set_tri_verts(&data->elb,
+                                 data->poly_tri_ofs[mlt->poly] + (mlt_index - tri_first_index),
+                                 mlt->tri[0],
+                                 mlt->tri[1],
+                                 mlt->tri[2]);
     }
   }
   EXTRACT_TRIS_LOOPTRI_FOREACH_MESH_END;
@@ -922,16 +1030,19 @@ static void extract_tris_finish(const MeshRenderData *mr,
   }
   MEM_freeN(data->tri_mat_start);
   MEM_freeN(data->tri_mat_end);
+  MEM_freeN(data->poly_tri_ofs);
   MEM_freeN(data);
 }
 
 static const MeshExtract extract_tris = {
     .init = extract_tris_init,
+    .task_init = extract_tris_task_init,
     .iter_looptri_bm = extract_tris_iter_looptri_bm,
     .iter_looptri_mesh = extract_tris_iter_looptri_mesh,
+    .task_finish = extract_tris_task_finish,
     .finish = extract_tris_finish,
     .data_flag = 0,
-    .use_threading = false,
+    .use_threading = true,
 };
 
 /** \} */
@@ -962,6 +1073,11 @@ static void extract_lines_iter_poly_bm(const MeshRenderData *mr,
     /* Use #BMLoop.prev to match mesh order (to avoid minor differences in data extraction). */
     l_iter = l_first = BM_FACE_FIRST_LOOP(f)->prev;
     do {
+      if (l_iter->e->l != l_iter) {
+        /* Only write the edge from its first loop, polygons sharing it might be extracted by
+         * other threads. */
+        continue;
+      }
       if (!BM_elem_flag_test(l_iter->e, BM_ELEM_HIDDEN)) {
         GPU_indexbuf_set_line_verts(elb,
                                     BM_elem_index_get(l_iter->e),
@@ -1071,13 +1187,15 @@ static void extract_lines_finish(const MeshRenderData *UNUSED(mr),
 
 static const MeshExtract extract_lines = {
     .init = extract_lines_init,
+    .task_init = extract_elb_task_init,
     .iter_poly_bm = extract_lines_iter_poly_bm,
     .iter_poly_mesh = extract_lines_iter_poly_mesh,
     .iter_ledge_bm = extract_lines_iter_ledge_bm,
     .iter_ledge_mesh = extract_lines_iter_ledge_mesh,
+    .task_finish = extract_elb_task_finish,
     .finish = extract_lines_finish,
     .data_flag = 0,
-    .use_threading = false,
+    .use_threading = true,
 };
 /** \} */
 
@@ -1108,13 +1226,15 @@ static void extract_lines_with_lines_loose_finish(const MeshRenderData *mr,
 
 static const MeshExtract extract_lines_with_lines_loose = {
     .init = extract_lines_init,
+    .task_init = extract_elb_task_init,
     .iter_poly_bm = extract_lines_iter_poly_bm,
     .iter_poly_mesh = extract_lines_iter_poly_mesh,
     .iter_ledge_bm = extract_lines_iter_ledge_bm,
     .iter_ledge_mesh = extract_lines_iter_ledge_mesh,
+    .task_finish = extract_elb_task_finish,
     .finish = extract_lines_with_lines_loose_finish,
     .data_flag = 0,
-    .use_threading = false,
+    .use_threading = true,
 };
 
 /** \} */
@@ -1240,15 +1360,17 @@ static void extract_points_finish(const MeshRenderData *UNUSED(mr),
 
 static const MeshExtract extract_points = {
     .init = extract_points_init,
+    .task_init = extract_elb_task_init,
     .iter_poly_bm = extract_points_iter_poly_bm,
     .iter_poly_mesh = extract_points_iter_poly_mesh,
     .iter_ledge_bm = extract_points_iter_ledge_bm,
     .iter_ledge_mesh = extract_points_iter_ledge_mesh,
     .iter_lvert_bm = extract_points_iter_lvert_bm,
     .iter_lvert_mesh = extract_points_iter_lvert_mesh,
+    .task_finish = extract_elb_task_finish,
     .finish = extract_points_finish,
     .data_flag = 0,
-    .use_threading = false,
+    .use_threading = true,
 };
 
 /** \} */
@@ -1325,11 +1447,13 @@ static void extract_fdots_finish(const MeshRenderData *UNUSED(mr),
 
 static const MeshExtract extract_fdots = {
     .init = extract_fdots_init,
+    .task_init = extract_elb_task_init,
     .iter_poly_bm = extract_fdots_iter_poly_bm,
     .iter_poly_mesh = extract_fdots_iter_poly_mesh,
+    .task_finish = extract_elb_task_finish,
     .finish = extract_fdots_finish,
     .data_flag = 0,
-    .use_threading = false,
+    .use_threading = true,
 };
 
 /** \} */
@@ -2271,6 +2395,64 @@ static const MeshExtract extract_pos_nor_hq = {
     .use_threading = true,
 };
 
+/** \} */
+
+/* ---------------------------------------------------------------------- */
+/** \name Update Position and Vertex Normal
+ * \{ */
+
+/**
+ * Re-upload the loops of the faces in `[face_start, face_end)` of an already uploaded `pos_nor`
+ * buffer, used when only edit-mesh vertex coordinates changed (see #BKE_MESH_BATCH_DIRTY_DEFORM).
+ * Only valid when the buffer was extracted from the edit-mesh itself (no deformed coordinates).
+ */
+void mesh_buffer_cache_update_pos_nor_range(GPUVertBuf *vbo,
+                                            BMesh *bm,
+                                            const int face_start,
+                                            const int face_end)
+{
+  BLI_assert(face_start < face_end && face_end <= bm->totface);
+  BLI_assert(GPU_vertbuf_get_status(vbo) & GPU_VERTBUF_DATA_UPLOADED);
+
+  BM_mesh_elem_index_ensure(bm, BM_LOOP | BM_FACE);
+  BM_mesh_elem_table_ensure(bm, BM_FACE);
+
+  /* Loop indices are contiguous per face, in face order. */
+  BMFace *f_last = BM_face_at_index(bm, face_end - 1);
+  const int loop_start = BM_elem_index_get(BM_FACE_FIRST_LOOP(BM_face_at_index(bm, face_start)));
+  const int loop_end = BM_elem_index_get(BM_FACE_FIRST_LOOP(f_last)) + f_last->len;
+
+  const bool use_hq = GPU_vertbuf_get_format(vbo)->stride == sizeof(PosNorHQLoop);
+  const uint stride = use_hq ? sizeof(PosNorHQLoop) : sizeof(PosNorLoop);
+  void *vbo_data = MEM_mallocN(stride * (loop_end - loop_start), __func__);
+
+  for (int f_index = face_start; f_index < face_end; f_index++) {
+    BMFace *efa = BM_face_at_index(bm, f_index);
+    const short hidden = BM_elem_flag_test(efa, BM_ELEM_HIDDEN) ? -1 : 0;
+    BMLoop *l_iter, *l_first;
+    l_iter = l_first = BM_FACE_FIRST_LOOP(efa);
+    do {
+      const int l_index = BM_elem_index_get(l_iter) - loop_start;
+      if (use_hq) {
+        PosNorHQLoop *vert = &((PosNorHQLoop *)vbo_data)[l_index];
+        copy_v3_v3(vert->pos, l_iter->v->co);
+        normal_float_to_short_v3(vert->nor, l_iter->v->no);
+        vert->nor[3] = hidden;
+      }
+      else {
+        PosNorLoop *vert = &((PosNorLoop *)vbo_data)[l_index];
+        copy_v3_v3(vert->pos, l_iter->v->co);
+        vert->nor = GPU_normal_convert_i10_v3(l_iter->v->no);
+        vert->nor.w = hidden;
+      }
+    } while ((l_iter = l_iter->next) != l_first);
+  }
+
+  GPU_vertbuf_use(vbo);
+  GPU_vertbuf_update_sub(vbo, stride * loop_start, stride * (loop_end - loop_start), vbo_data);
+  MEM_freeN(vbo_data);
+}
+
 /** \} */
 /* ---------------------------------------------------------------------- */
 /** \name Extract HQ Loop Normal
@@ -2461,6 +2643,14 @@ static const MeshExtract extract_lnor = {
 /** \name Extract UV  layers
  * \{ */
 
+typedef struct MeshExtract_UV_Data {
+  float (*vbo_data)[2];
+  /** Offsets (BMesh) or arrays (Mesh) of the extracted layers. */
+  int cd_ofs[MAX_MTFACE];
+  const MLoopUV *layers[MAX_MTFACE];
+  int layers_len;
+} MeshExtract_UV_Data;
+
 static void *extract_uv_init(const MeshRenderData *mr, struct MeshBatchCache *cache, void *buf)
 {
   GPUVertFormat format = {0};
@@ -2516,39 +2706,69 @@ static void *extract_uv_init(const MeshRenderData *mr, struct MeshBatchCache *ca
   GPU_vertbuf_init_with_format(vbo, &format);
   GPU_vertbuf_data_alloc(vbo, v_len);
 
-  float(*uv_data)[2] = (float(*)[2])GPU_vertbuf_get_data(vbo);
-  for (int i = 0; i < MAX_MTFACE; i++) {
-    if (uv_layers & (1 << i)) {
-      if (mr->extract_type == MR_EXTRACT_BMESH) {
-        int cd_ofs = CustomData_get_n_offset(cd_ldata, CD_MLOOPUV, i);
-        BMIter f_iter;
-        BMFace *efa;
-        BM_ITER_MESH (efa, &f_iter, mr->bm, BM_FACES_OF_MESH) {
-          BMLoop *l_iter, *l_first;
-          l_iter = l_first = BM_FACE_FIRST_LOOP(efa);
-          do {
-            MLoopUV *luv = BM_ELEM_CD_GET_VOID_P(l_iter, cd_ofs);
-            memcpy(uv_data, luv->uv, sizeof(*uv_data));
-            uv_data++;
-          } while ((l_iter = l_iter->next) != l_first);
+  MeshExtract_UV_Data *data = MEM_callocN(sizeof(*data), __func__);
+  data->vbo_data = (float(*)[2])GPU_vertbuf_get_data(vbo);
+  if (v_len == mr->loop_len) {
+    /* Layers are stored one after the other, see #GPU_vertformat_deinterleave. */
+    for (int i = 0; i < MAX_MTFACE; i++) {
+      if (uv_layers & (1 << i)) {
+        if (mr->extract_type == MR_EXTRACT_BMESH) {
+          data->cd_ofs[data->layers_len] = CustomData_get_n_offset(cd_ldata, CD_MLOOPUV, i);
         }
-      }
-      else {
-        MLoopUV *layer_data = CustomData_get_layer_n(cd_ldata, CD_MLOOPUV, i);
-        for (int ml_index = 0; ml_index < mr->loop_len; ml_index++, uv_data++, layer_data++) {
-          memcpy(uv_data, layer_data->uv, sizeof(*uv_data));
+        else {
+          data->layers[data->layers_len] = CustomData_get_layer_n(cd_ldata, CD_MLOOPUV, i);
         }
+        data->layers_len++;
       }
     }
   }
+  return data;
+}
 
-  return NULL;
+static void extract_uv_iter_poly_bm(const MeshRenderData *mr,
+                                    const ExtractPolyBMesh_Params *params,
+                                    void *_data)
+{
+  MeshExtract_UV_Data *data = _data;
+  EXTRACT_POLY_AND_LOOP_FOREACH_BM_BEGIN(l, l_index, params, mr)
+  {
+    for (int i = 0; i < data->layers_len; i++) {
+      const MLoopUV *luv = BM_ELEM_CD_GET_VOID_P(l, data->cd_ofs[i]);
+      copy_v2_v2(data->vbo_data[i * mr->loop_len + l_index], luv->uv);
+    }
+  }
+  EXTRACT_POLY_AND_LOOP_FOREACH_BM_END(l);
+}
+
+static void extract_uv_iter_poly_mesh(const MeshRenderData *mr,
+                                      const ExtractPolyMesh_Params *params,
+                                      void *_data)
+{
+  MeshExtract_UV_Data *data = _data;
+  EXTRACT_POLY_AND_LOOP_FOREACH_MESH_BEGIN(mp, mp_index, ml, ml_index, params, mr)
+  {
+    for (int i = 0; i < data->layers_len; i++) {
+      copy_v2_v2(data->vbo_data[i * mr->loop_len + ml_index], data->layers[i][ml_index].uv);
+    }
+  }
+  EXTRACT_POLY_AND_LOOP_FOREACH_MESH_END;
+}
+
+static void extract_uv_finish(const MeshRenderData *UNUSED(mr),
+                              struct MeshBatchCache *UNUSED(cache),
+                              void *UNUSED(buf),
+                              void *data)
+{
+  MEM_freeN(data);
 }
 
 static const MeshExtract extract_uv = {
     .init = extract_uv_init,
+    .iter_poly_bm = extract_uv_iter_poly_bm,
+    .iter_poly_mesh = extract_uv_iter_poly_mesh,
+    .finish = extract_uv_finish,
     .data_flag = 0,
-    .use_threading = false,
+    .use_threading = true,
 };
 
 /** \} */
@@ -5495,6 +5715,8 @@ static const MeshExtract extract_fdot_idx = {
  * \{ */
 typedef struct ExtractUserData {
   void *user_data;
+  /** Serializes #MeshExtract.task_finish calls of the tasks of one extraction. */
+  ThreadMutex task_finish_mutex;
 } ExtractUserData;
 
 typedef enum ExtractTaskDataType {
@@ -5538,6 +5760,7 @@ static ExtractTaskData *extract_task_data_create_mesh_extract(const MeshRenderDa
    * This structure makes sure that when extract_init is called, that the user data of all
    * iterations are updated. */
   taskdata->user_data = MEM_callocN(sizeof(ExtractUserData), __func__);
+  BLI_mutex_init(&taskdata->user_data->task_finish_mutex);
   taskdata->iter_type = mesh_extract_iter_type(extract);
   taskdata->task_counter = task_counter;
   taskdata->start = 0;
@@ -5558,7 +5781,10 @@ static ExtractTaskData *extract_task_data_create_lines_loose(const MeshRenderDat
 static void extract_task_data_free(void *data)
 {
   ExtractTaskData *task_data = data;
-  MEM_SAFE_FREE(task_data->user_data);
+  if (task_data->user_data) {
+    BLI_mutex_end(&task_data->user_data->task_finish_mutex);
+    MEM_freeN(task_data->user_data);
+  }
   MEM_freeN(task_data);
 }
 
@@ -5651,12 +5877,18 @@ static void extract_run(void *__restrict taskdata)
 {
   ExtractTaskData *data = (ExtractTaskData *)taskdata;
   if (data->tasktype == EXTRACT_MESH_EXTRACT) {
-    mesh_extract_iter(data->mr,
-                      data->iter_type,
-                      data->start,
-                      data->end,
-                      data->extract,
-                      data->user_data->user_data);
+    const MeshExtract *extract = data->extract;
+    void *user_data = data->user_data->user_data;
+    void *task_user_data = extract->task_init ? extract->task_init(user_data) : user_data;
+
+    mesh_extract_iter(
+        data->mr, data->iter_type, data->start, data->end, extract, task_user_data);
+
+    if (extract->task_finish) {
+      BLI_mutex_lock(&data->user_data->task_finish_mutex);
+      extract->task_finish(user_data, task_user_data);
+      BLI_mutex_unlock(&data->user_data->task_finish_mutex);
+    }
 
     /* If this is the last task, we do the finish function. */
     int remainin_tasks = atomic_sub_and_fetch_int32(data->task_counter, 1);
@@ -5865,6 +6097,7 @@ static void extract_task_create(struct TaskGraph *task_graph,
   if (use_thread && extract->use_threading) {
 
     /* Divide task into sensible chunks. */
+    const int task_counter_init = *task_counter;
     if (taskdata->iter_type & MR_ITER_LOOPTRI) {
       for (int i = 0; i < mr->tri_len; i += chunk_size) {
         extract_range_task_create(
@@ -5889,6 +6122,11 @@ static void extract_task_create(struct TaskGraph *task_graph,
             task_graph, task_node_user_data_init, taskdata, MR_ITER_LVERT, i, chunk_size);
       }
     }
+    if (*task_counter == task_counter_init) {
+      /* Nothing to iterate over, still run one task so the extraction is finished. */
+      extract_range_task_create(
+          task_graph, task_node_user_data_init, taskdata, taskdata->iter_type, 0, 0);
+    }
     BLI_addtail(user_data_init_task_datas, taskdata);
   }
   else if (use_thread) {
@@ -40,6 +40,7 @@
 
 #include "BLI_hash.h"
 #include "BLI_polyfill_2d.h"
+#include "BLI_task.h"
 
 #include "draw_cache.h"
 #include "draw_cache_impl.h"
@@ -255,6 +256,9 @@ typedef struct gpIterData {
   gpStrokeVert *verts;
   gpColorVert *cols;
   GPUIndexBufBuilder ibo;
+  /** Visible strokes, gathered to fill the buffers in parallel. */
+  bGPDstroke **strokes;
+  int stroke_len;
   int vert_len;
   int tri_len;
   int curve_len;
@@ -355,22 +359,36 @@ static void gpencil_buffer_add_stroke(gpStrokeVert *verts,
   gpencil_buffer_add_point(verts, cols, gps, &pts[adj_idx], v++, true);
 }
 
+/* Write the cached triangulation of the stroke at its own offset, so that strokes can be added
+ * from multiple threads. */
 static void gpencil_buffer_add_fill(GPUIndexBufBuilder *ibo, const bGPDstroke *gps)
 {
   int tri_len = gps->tot_triangles;
   int v = gps->runtime.stroke_start;
+  uint *data = &ibo->data[gps->runtime.fill_start * 3];
   for (int i = 0; i < tri_len; i++) {
     uint *tri = gps->triangles[i].verts;
-    GPU_indexbuf_add_tri_verts(ibo, v + tri[0], v + tri[1], v + tri[2]);
+    *data++ = v + tri[0];
+    *data++ = v + tri[1];
+    *data++ = v + tri[2];
   }
 }
 
-static void gpencil_stroke_iter_cb(bGPDlayer *UNUSED(gpl),
-                                   bGPDframe *UNUSED(gpf),
-                                   bGPDstroke *gps,
-                                   void *thunk)
+static void gpencil_stroke_gather_cb(bGPDlayer *UNUSED(gpl),
+                                     bGPDframe *UNUSED(gpf),
+                                     bGPDstroke *gps,
+                                     void *thunk)
 {
   gpIterData *iter = (gpIterData *)thunk;
+  iter->strokes[iter->stroke_len++] = gps;
+}
+
+static void gpencil_stroke_fill_task_cb(void *__restrict userdata,
+                                        const int i,
+                                        const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  gpIterData *iter = (gpIterData *)userdata;
+  bGPDstroke *gps = iter->strokes[i];
   gpencil_buffer_add_stroke(iter->verts, iter->cols, gps);
   if (gps->tot_triangles > 0) {
     gpencil_buffer_add_fill(&iter->ibo, gps);
@@ -387,6 +405,7 @@ static void gpencil_object_verts_count_cb(bGPDlayer *UNUSED(gpl),
   /* Store first index offset */
   gps->runtime.stroke_start = iter->vert_len;
   gps->runtime.fill_start = iter->tri_len;
+  iter->stroke_len++;
   iter->vert_len += gps->totpoints + 2 + gpencil_stroke_is_cyclic(gps);
   iter->tri_len += gps->tot_triangles;
 }
@@ -411,6 +430,8 @@ static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfr
         .gpd = gpd,
         .verts = NULL,
         .ibo = {0},
+        .strokes = NULL,
+        .stroke_len = 0,
         .vert_len = 1, /* Start at 1 for the gl_InstanceID trick to work (see vert shader). */
         .tri_len = 0,
         .curve_len = 0,
@@ -418,6 +439,15 @@ static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfr
     BKE_gpencil_visible_stroke_iter(
         NULL, ob, NULL, gpencil_object_verts_count_cb, &iter, do_onion, cfra);
 
+    /* The offsets of every stroke are known now, gather the strokes so that they can be written
+     * to the buffers in parallel. */
+    const int stroke_len = iter.stroke_len;
+    iter.strokes = MEM_malloc_arrayN(max_ii(stroke_len, 1), sizeof(*iter.strokes), __func__);
+    iter.stroke_len = 0;
+    BKE_gpencil_visible_stroke_iter(
+        NULL, ob, NULL, gpencil_stroke_gather_cb, &iter, do_onion, cfra);
+    BLI_assert(iter.stroke_len == stroke_len);
+
     /* Create VBOs. */
     GPUVertFormat *format = gpencil_stroke_format();
     GPUVertFormat *format_col = gpencil_color_format();
@@ -432,7 +462,12 @@ static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfr
     GPU_indexbuf_init(&iter.ibo, GPU_PRIM_TRIS, iter.tri_len, iter.vert_len);
 
     /* Fill buffers with data. */
-    BKE_gpencil_visible_stroke_iter(NULL, ob, NULL, gpencil_stroke_iter_cb, &iter, do_onion, cfra);
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 64;
+    BLI_task_parallel_range(0, stroke_len, &iter, gpencil_stroke_fill_task_cb, &settings);
+    iter.ibo.index_len = iter.tri_len * 3;
+    MEM_freeN(iter.strokes);
 
     /* Mark last 2 verts as invalid. */
     for (int i = 0; i < 2; i++) {
@@ -496,6 +496,15 @@ static void mesh_batch_cache_init(Mesh *me)
     // cache->vert_len = mesh_render_verts_len_get(me);
   }
 
+  else {
+    /* Checked before updating buffers in place, see #mesh_batch_cache_deform_supported. */
+    BMEditMesh *em = me->edit_mesh;
+    cache->vert_len = em->bm->totvert;
+    cache->edge_len = em->bm->totedge;
+    cache->poly_len = em->bm->totface;
+    cache->tri_len = em->tottri;
+  }
+
   cache->mat_len = mesh_render_mat_len_get(me);
   cache->surface_per_mat = MEM_callocN(sizeof(*cache->surface_per_mat) * cache->mat_len, __func__);
   cache->final.tris_per_mat = MEM_callocN(sizeof(*cache->final.tris_per_mat) * cache->mat_len,
@@ -508,12 +517,72 @@ static void mesh_batch_cache_init(Mesh *me)
   drw_mesh_weight_state_clear(&cache->weight_state);
 }
 
+static void mesh_batch_cache_update_deform(Mesh *me)
+{
+  MeshBatchCache *cache = me->runtime.batch_cache;
+  if (!cache->is_deform_dirty) {
+    return;
+  }
+  cache->is_deform_dirty = false;
+
+  /* Discard what depends on vertex coordinates, keeping the rest (edit flags, UVs, colors,
+   * selection indices, most index buffers). The tessellation can change with coordinates. */
+  FOREACH_MESH_BUFFER_CACHE (cache, mbufcache) {
+    if (mbufcache != &cache->final) {
+      GPU_VERTBUF_DISCARD_SAFE(mbufcache->vbo.pos_nor);
+    }
+    GPU_VERTBUF_DISCARD_SAFE(mbufcache->vbo.lnor);
+    GPU_VERTBUF_DISCARD_SAFE(mbufcache->vbo.edge_fac);
+    GPU_VERTBUF_DISCARD_SAFE(mbufcache->vbo.tan);
+    GPU_VERTBUF_DISCARD_SAFE(mbufcache->vbo.edituv_stretch_area);
+    GPU_VERTBUF_DISCARD_SAFE(mbufcache->vbo.edituv_stretch_angle);
+    GPU_VERTBUF_DISCARD_SAFE(mbufcache->vbo.mesh_analysis);
+    GPU_VERTBUF_DISCARD_SAFE(mbufcache->vbo.fdots_pos);
+    GPU_VERTBUF_DISCARD_SAFE(mbufcache->vbo.fdots_nor);
+    GPU_VERTBUF_DISCARD_SAFE(mbufcache->vbo.skin_roots);
+    GPU_INDEXBUF_DISCARD_SAFE(mbufcache->ibo.tris);
+    GPU_INDEXBUF_DISCARD_SAFE(mbufcache->ibo.lines_adjacency);
+    GPU_INDEXBUF_DISCARD_SAFE(mbufcache->ibo.edituv_tris);
+  }
+  for (int i = 0; i < cache->mat_len; i++) {
+    GPU_INDEXBUF_DISCARD_SAFE(cache->final.tris_per_mat[i]);
+  }
+
+  GPUVertBuf *pos_nor = cache->final.vbo.pos_nor;
+  if (pos_nor && (GPU_vertbuf_get_status(pos_nor) & GPU_VERTBUF_DATA_UPLOADED)) {
+    if (cache->deform_face_range[0] < cache->deform_face_range[1]) {
+      mesh_buffer_cache_update_pos_nor_range(pos_nor,
+                                             me->edit_mesh->bm,
+                                             cache->deform_face_range[0],
+                                             cache->deform_face_range[1]);
+    }
+  }
+  else {
+    GPU_VERTBUF_DISCARD_SAFE(cache->final.vbo.pos_nor);
+  }
+
+  /* Batches are cheap to re-create and may reference any of the discarded buffers. */
+  for (int i = 0; i < sizeof(cache->batch) / sizeof(void *); i++) {
+    GPUBatch **batch = (GPUBatch **)&cache->batch;
+    GPU_BATCH_DISCARD_SAFE(batch[i]);
+  }
+  for (int i = 0; i < cache->mat_len; i++) {
+    GPU_BATCH_DISCARD_SAFE(cache->surface_per_mat[i]);
+  }
+  cache->batch_ready = 0;
+
+  cache->tot_area = 0.0f;
+}
+
 void DRW_mesh_batch_cache_validate(Mesh *me)
 {
   if (!mesh_batch_cache_valid(me)) {
     mesh_batch_cache_clear(me);
     mesh_batch_cache_init(me);
   }
+  else {
+    mesh_batch_cache_update_deform(me);
+  }
 }
 
 static MeshBatchCache *mesh_batch_cache_get(Mesh *me)
@@ -622,6 +691,24 @@ static void mesh_batch_cache_discard_uvedit_select(MeshBatchCache *cache)
   cache->batch_ready &= ~MBC_EDITUV;
 }
 
+/* In place updates of #BKE_MESH_BATCH_DIRTY_DEFORM are only implemented when drawing
+ * the edit-mesh directly, and only if the topology didn't change since extraction. */
+static bool mesh_batch_cache_deform_supported(const Mesh *me, const MeshBatchCache *cache)
+{
+  const BMEditMesh *em = me->edit_mesh;
+  if (em == NULL || !cache->is_editmode || cache->is_dirty) {
+    return false;
+  }
+  const Mesh *me_final = em->mesh_eval_final;
+  if (me_final == NULL || me_final != em->mesh_eval_cage ||
+      me_final->runtime.wrapper_type != ME_WRAPPER_TYPE_BMESH ||
+      (me_final->runtime.edit_data && me_final->runtime.edit_data->vertexCos)) {
+    return false;
+  }
+  return (cache->vert_len == em->bm->totvert) && (cache->edge_len == em->bm->totedge) &&
+         (cache->poly_len == em->bm->totface) && (cache->tri_len == em->tottri);
+}
+
 void DRW_mesh_batch_cache_dirty_tag(Mesh *me, eMeshBatchDirtyMode mode)
 {
   MeshBatchCache *cache = me->runtime.batch_cache;
@@ -667,6 +754,29 @@ void DRW_mesh_batch_cache_dirty_tag(Mesh *me, eMeshBatchDirtyMode mode)
     case BKE_MESH_BATCH_DIRTY_ALL:
       cache->is_dirty = true;
       break;
+    case BKE_MESH_BATCH_DIRTY_DEFORM:
+      if (!mesh_batch_cache_deform_supported(me, cache)) {
+        cache->is_dirty = true;
+      }
+      else if (cache->is_deform_dirty) {
+        /* Not drawn since the last change. */
+        cache->deform_face_range[0] = min_ii(cache->deform_face_range[0],
+                                             me->edit_mesh->deform_face_range[0]);
+        cache->deform_face_range[1] = max_ii(cache->deform_face_range[1],
+                                             me->edit_mesh->deform_face_range[1]);
+      }
+      else {
+        cache->is_deform_dirty = true;
+        copy_v2_v2_int(cache->deform_face_range, me->edit_mesh->deform_face_range);
+      }
+      break;
+    case BKE_MESH_BATCH_DIRTY_WEIGHTS:
+      FOREACH_MESH_BUFFER_CACHE (cache, mbufcache) {
+        GPU_VERTBUF_DISCARD_SAFE(mbufcache->vbo.weights);
+      }
+      GPU_BATCH_CLEAR_SAFE(cache->batch.surface_weights);
+      cache->batch_ready &= ~MBC_SURFACE_WEIGHTS;
+      break;
     case BKE_MESH_BATCH_DIRTY_SHADING:
       mesh_batch_cache_discard_shaded_tri(cache);
       mesh_batch_cache_discard_uvedit(cache);
@@ -284,6 +284,39 @@ GPUBatch *DRW_volume_batch_cache_get_selection_surface(Volume *volume)
   return cache->selection_surface;
 }
 
+/* Number of voxels extracted at once when filling a grid texture, large dense grids are uploaded
+ * in slabs so that the whole dense grid is never in memory. */
+#define VOLUME_GRID_SLAB_VOXELS (1 << 24)
+
+static void volume_grid_texture_slab_cb(void *userdata,
+                                        const DenseFloatVolumeGrid *dense_grid,
+                                        const float *voxels,
+                                        int z_offset,
+                                        int depth)
+{
+  DRWVolumeGrid *cache_grid = userdata;
+
+  if (z_offset == 0) {
+    eGPUTextureFormat format = (dense_grid->channels == 3) ? GPU_RGB16F : GPU_R16F;
+    cache_grid->texture = GPU_texture_create_3d(
+        "volume_grid", UNPACK3(dense_grid->resolution), 1, format, GPU_DATA_FLOAT, NULL);
+  }
+  /* The texture can be null if the resolution along one axis is larger than
+   * GL_MAX_3D_TEXTURE_SIZE. */
+  if (cache_grid->texture == NULL) {
+    return;
+  }
+  GPU_texture_update_sub(cache_grid->texture,
+                         GPU_DATA_FLOAT,
+                         voxels,
+                         0,
+                         0,
+                         z_offset,
+                         dense_grid->resolution[0],
+                         dense_grid->resolution[1],
+                         depth);
+}
+
 static DRWVolumeGrid *volume_grid_cache_get(Volume *volume,
                                             VolumeGrid *grid,
                                             VolumeBatchCache *cache)
@@ -318,27 +351,20 @@ static DRWVolumeGrid *volume_grid_cache_get(Volume *volume,
   const bool was_loaded = BKE_volume_grid_is_loaded(grid);
 
   DenseFloatVolumeGrid dense_grid;
-  if (BKE_volume_grid_dense_floats(volume, grid, &dense_grid)) {
+  if (BKE_volume_grid_dense_floats_slabs(volume,
+                                         grid,
+                                         VOLUME_GRID_SLAB_VOXELS,
+                                         &dense_grid,
+                                         volume_grid_texture_slab_cb,
+                                         cache_grid)) {
     copy_m4_m4(cache_grid->texture_to_object, dense_grid.texture_to_object);
     invert_m4_m4(cache_grid->object_to_texture, dense_grid.texture_to_object);
 
-    /* Create GPU texture. */
-    eGPUTextureFormat format = (channels == 3) ? GPU_RGB16F : GPU_R16F;
-    cache_grid->texture = GPU_texture_create_3d("volume_grid",
-                                                UNPACK3(dense_grid.resolution),
-                                                1,
-                                                format,
-                                                GPU_DATA_FLOAT,
-                                                dense_grid.voxels);
-    /* The texture can be null if the resolution along one axis is larger than
-     * GL_MAX_3D_TEXTURE_SIZE. */
     if (cache_grid->texture != NULL) {
       GPU_texture_swizzle_set(cache_grid->texture, (channels == 3) ? "rgb1" : "rrr1");
       GPU_texture_wrap_mode(cache_grid->texture, false, false);
-      BKE_volume_dense_float_grid_clear(&dense_grid);
     }
     else {
-      MEM_freeN(dense_grid.voxels);
       printf("Error: Could not allocate 3D texture for volume.\n");
     }
   }
@@ -36,11 +36,11 @@
 #include "DNA_meta_types.h"
 
 #include "BLI_alloca.h"
-#include "BLI_hash.h"
 #include "BLI_link_utils.h"
 #include "BLI_listbase.h"
 #include "BLI_memblock.h"
 #include "BLI_mempool.h"
+#include "BLI_task.h"
 
 #ifdef DRW_DEBUG_CULLING
 #  include "BLI_math_bits.h"
@@ -62,9 +62,14 @@ static void draw_call_sort(DRWCommand *array, DRWCommand *array_tmp, int array_l
    * there is collisions. If there is a lot of different batches,
    * the sorting benefit will be negligible.
    * So at least sort fast! */
-  uchar idx[128] = {0};
-  /* Shift by 6 positions knowing each GPUBatch is > 64 bytes */
-#define KEY(a) ((((size_t)((a).draw.batch)) >> 6) % ARRAY_SIZE(idx))
+  uchar idx[256] = {0};
+  /* Shift by 6 positions knowing each GPUBatch is > 64 bytes.
+   * The negative scale bit is part of the key so mirrored and regular instances of the same
+   * batch end up in separate runs, a change of facing during batching forces a flush. */
+#define KEY(a) \
+  ((((((size_t)((a).draw.batch)) >> 6) << 1) | \
+    (DRW_handle_negative_scale_get(&(a).draw.handle) ? 1 : 0)) % \
+   ARRAY_SIZE(idx))
   BLI_assert(array_len <= ARRAY_SIZE(idx));
 
   for (int i = 0; i < array_len; i++) {
@@ -86,6 +91,17 @@ static void draw_call_sort(DRWCommand *array, DRWCommand *array_tmp, int array_l
   memcpy(array, array_tmp, sizeof(*array) * array_len);
 }
 
+static void draw_call_sort_chunk_cb(void *__restrict userdata,
+                                    const int i,
+                                    const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  DRWCommandChunk **chunks = userdata;
+  DRWCommandChunk *chunk = chunks[i];
+  DRWCommand commands_tmp[ARRAY_SIZE(chunk->commands)];
+
+  draw_call_sort(chunk->commands, commands_tmp, chunk->command_used);
+}
+
 void drw_resource_buffer_finish(ViewportMemoryPool *vmempool)
 {
   int chunk_id = DRW_handle_chunk_get(&DST.resource_handle);
@@ -130,10 +146,18 @@ void drw_resource_buffer_finish(ViewportMemoryPool *vmempool)
 
   DRW_uniform_attrs_pool_flush_all(vmempool->obattrs_ubo_pool);
 
-  /* Aligned alloc to avoid unaligned memcpy. */
-  DRWCommandChunk *chunk_tmp = MEM_mallocN_aligned(sizeof(DRWCommandChunk), 16, "tmp call chunk");
+  /* Chunks are sorted independently of each other, gather the sortable ones first
+   * so they can be processed in parallel. */
   DRWCommandChunk *chunk;
   BLI_memblock_iter iter;
+  int chunks_len = 0;
+  BLI_memblock_iternew(vmempool->commands, &iter);
+  while (BLI_memblock_iterstep(&iter)) {
+    chunks_len++;
+  }
+
+  DRWCommandChunk **chunks = MEM_malloc_arrayN(max_ii(chunks_len, 1), sizeof(*chunks), __func__);
+  int sortable_len = 0;
   BLI_memblock_iternew(vmempool->commands, &iter);
   while ((chunk = BLI_memblock_iterstep(&iter))) {
     bool sortable = true;
@@ -144,10 +168,17 @@ void drw_resource_buffer_finish(ViewportMemoryPool *vmempool)
       }
     }
     if (sortable) {
-      draw_call_sort(chunk->commands, chunk_tmp->commands, chunk->command_used);
+      chunks[sortable_len++] = chunk;
     }
   }
-  MEM_freeN(chunk_tmp);
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (sortable_len > 64);
+  settings.min_iter_per_thread = 16;
+  BLI_task_parallel_range(0, sortable_len, chunks, draw_call_sort_chunk_cb, &settings);
+
+  MEM_freeN(chunks);
 }
 
 /** \} */
@@ -513,11 +544,7 @@ static void drw_call_obinfos_init(DRWObjectInfos *ob_infos, Object *ob)
   /* Orco factors. */
   drw_call_calc_orco(ob, ob_infos->orcotexfac);
   /* Random float value. */
-  uint random = (DST.dupli_source) ?
-                    DST.dupli_source->random_id :
-                    /* TODO(fclem): this is rather costly to do at runtime. Maybe we can
-                     * put it in ob->runtime and make depsgraph ensure it is up to date. */
-                    BLI_hash_int_2d(BLI_hash_string(ob->id.name + 2), 0);
+  uint random = (DST.dupli_source) ? DST.dupli_source->random_id : ob->runtime.random_id;
   ob_infos->ob_random = random * (1.0f / (float)0xFFFFFFFF);
   /* Object State. */
   ob_infos->ob_flag = 1.0f; /* Required to have a correct sign */
@@ -26,6 +26,7 @@
 #include "BLI_math.h"
 #include "BLI_math_bits.h"
 #include "BLI_memblock.h"
+#include "BLI_task.h"
 
 #include "BKE_global.h"
 
@@ -485,11 +486,48 @@ void DRW_culling_frustum_planes_get(const DRWView *view, float planes[6][4])
   memcpy(planes, view->frustum_planes, sizeof(float[6][4]));
 }
 
+static void draw_compute_culling_state(const DRWView *view, DRWCullingState *cull)
+{
+  if (cull->bsphere.radius < 0.0) {
+    cull->mask = 0;
+  }
+  else {
+    bool culled = !draw_culling_sphere_test(
+        &view->frustum_bsphere, view->frustum_planes, &cull->bsphere);
+
+#ifdef DRW_DEBUG_CULLING
+    if (G.debug_value != 0) {
+      if (culled) {
+        DRW_debug_sphere(cull->bsphere.center, cull->bsphere.radius, (const float[4]){1, 0, 0, 1});
+      }
+      else {
+        DRW_debug_sphere(cull->bsphere.center, cull->bsphere.radius, (const float[4]){0, 1, 0, 1});
+      }
+    }
+#endif
+
+    if (view->visibility_fn) {
+      culled = !view->visibility_fn(!culled, cull->user_data);
+    }
+
+    SET_FLAG_FROM_TEST(cull->mask, culled, view->culling_mask);
+  }
+}
+
+static void draw_compute_culling_cb(void *__restrict userdata,
+                                    const int i,
+                                    const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const DRWView *view = userdata;
+  DRWCullingState *cull = BLI_memblock_elem_get(DST.vmempool->cullstates, 0, i);
+
+  draw_compute_culling_state(view, cull);
+}
+
 static void draw_compute_culling(DRWView *view)
 {
   view = view->parent ? view->parent : view;
 
-  /* TODO(fclem): multi-thread this. */
   /* TODO(fclem): compute all dirty views at once. */
   if (!view->is_dirty) {
     return;
@@ -497,33 +535,25 @@ static void draw_compute_culling(DRWView *view)
 
   BLI_memblock_iter iter;
   BLI_memblock_iternew(DST.vmempool->cullstates, &iter);
-  DRWCullingState *cull;
-  while ((cull = BLI_memblock_iterstep(&iter))) {
-    if (cull->bsphere.radius < 0.0) {
-      cull->mask = 0;
-    }
-    else {
-      bool culled = !draw_culling_sphere_test(
-          &view->frustum_bsphere, view->frustum_planes, &cull->bsphere);
 
+  /* Each culling state only depends on its own bounds. The visibility callbacks may write
+   * engine data, keep those single threaded. */
+  bool use_threading = (view->visibility_fn == NULL);
 #ifdef DRW_DEBUG_CULLING
-      if (G.debug_value != 0) {
-        if (culled) {
-          DRW_debug_sphere(
-              cull->bsphere.center, cull->bsphere.radius, (const float[4]){1, 0, 0, 1});
-        }
-        else {
-          DRW_debug_sphere(
-              cull->bsphere.center, cull->bsphere.radius, (const float[4]){0, 1, 0, 1});
-        }
-      }
+  use_threading = use_threading && (G.debug_value == 0);
 #endif
 
-      if (view->visibility_fn) {
-        culled = !view->visibility_fn(!culled, cull->user_data);
-      }
-
-      SET_FLAG_FROM_TEST(cull->mask, culled, view->culling_mask);
+  if (use_threading) {
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.use_threading = (iter.end_index > 1024);
+    settings.min_iter_per_thread = 256;
+    BLI_task_parallel_range(0, iter.end_index, view, draw_compute_culling_cb, &settings);
+  }
+  else {
+    DRWCullingState *cull;
+    while ((cull = BLI_memblock_iterstep(&iter))) {
+      draw_compute_culling_state(view, cull);
     }
   }
 
@@ -527,6 +527,20 @@ void DRW_select_buffer_context_create(Base **bases, const uint bases_len, short
 {
   struct SELECTID_Context *select_ctx = DRW_select_engine_context_get();
 
+  /* Keep the ID buffer drawn by a previous operator when it used the same objects,
+   * the engine still invalidates it on view, settings or object updates. */
+  bool keep_drawn = (select_mode != -1) && (select_mode == select_ctx->select_mode) &&
+                    (bases_len == select_ctx->objects_len);
+  for (uint base_index = 0; keep_drawn && base_index < bases_len; base_index++) {
+    keep_drawn = (bases[base_index]->object == select_ctx->objects[base_index]);
+  }
+  if (keep_drawn) {
+    for (uint base_index = 0; base_index < bases_len; base_index++) {
+      bases[base_index]->object->runtime.select_id = base_index;
+    }
+    return;
+  }
+
   select_ctx->objects = MEM_reallocN(select_ctx->objects,
                                      sizeof(*select_ctx->objects) * bases_len);
 
@@ -547,6 +547,12 @@ int actkeyblock_get_valid_hold(ActKeyColumn *ac)
   return (ac->block.flag & ~ac->block.conflict) & hold_mask;
 }
 
+/* Checks if the block starting at this column overlaps the visible range. */
+static bool actkeyblock_is_visible(const ActKeyColumn *ab, const View2D *v2d)
+{
+  return (ab->next != NULL) && (ab->next->cfra >= v2d->cur.xmin) && (ab->cfra <= v2d->cur.xmax);
+}
+
 /* *************************** Keyframe Drawing *************************** */
 
 void draw_keyframe_shape(float x,
@@ -731,6 +737,10 @@ static void draw_keylist(View2D *v2d,
     uint block_len = 0;
     uint gpencil_len = 0;
     LISTBASE_FOREACH (ActKeyColumn *, ab, keys) {
+      /* Skip blocks outside of the visible range, like the keys below. */
+      if (!actkeyblock_is_visible(ab, v2d)) {
+        continue;
+      }
       if (actkeyblock_get_valid_hold(ab)) {
         block_len++;
       }
@@ -752,6 +762,9 @@ static void draw_keylist(View2D *v2d,
       if (block_len > 0) {
         immBegin(GPU_PRIM_TRIS, 6 * block_len);
         LISTBASE_FOREACH (ActKeyColumn *, ab, keys) {
+          if (!actkeyblock_is_visible(ab, v2d)) {
+            continue;
+          }
           int valid_hold = actkeyblock_get_valid_hold(ab);
           if (valid_hold != 0) {
             if ((valid_hold & ACTKEYBLOCK_FLAG_STATIC_HOLD) == 0) {
@@ -793,7 +806,7 @@ static void draw_keylist(View2D *v2d,
       else {
         immBegin(GPU_PRIM_TRIS, 6 * gpencil_len);
         LISTBASE_FOREACH (ActKeyColumn *, ab, keys) {
-          if (ab->next == NULL) {
+          if (!actkeyblock_is_visible(ab, v2d)) {
             continue;
           }
           immRectf_fast_with_color(pos_id,
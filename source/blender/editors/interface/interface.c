@@ -3439,6 +3439,24 @@ void UI_blocklist_free_inactive(const bContext *C, ListBase *lb)
   }
 }
 
+/**
+ * Tag the blocks kept from the last redraw as active again, so they are drawn without being
+ * rebuilt. Popups are skipped, they are handled by their own region.
+ *
+ * \return false when there are no blocks to reuse.
+ */
+bool UI_blocklist_reuse(ListBase *lb)
+{
+  bool found = false;
+  LISTBASE_FOREACH (uiBlock *, block, lb) {
+    if (!block->handle) {
+      block->active = true;
+      found = true;
+    }
+  }
+  return found;
+}
+
 void UI_block_region_set(uiBlock *block, ARegion *region)
 {
   ListBase *lb = &region->uiblocks;
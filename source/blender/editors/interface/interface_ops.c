@@ -978,6 +978,13 @@ static bool copy_to_selected_button(bContext *C, bool all, bool poll)
 
     if (UI_context_copy_to_selected_list(C, &ptr, prop, &lb, &use_path_from_id, &path) &&
         !BLI_listbase_is_empty(&lb)) {
+      /* Updates are run once all values are copied. */
+      PointerRNA *update_ptrs = NULL;
+      int update_ptrs_len = 0;
+      if (!poll) {
+        update_ptrs = MEM_mallocN(sizeof(*update_ptrs) * BLI_listbase_count(&lb), __func__);
+      }
+
       LISTBASE_FOREACH (CollectionPointerLink *, link, &lb) {
         if (link->ptr.data != ptr.data) {
           if (use_path_from_id) {
@@ -1008,13 +1015,18 @@ static bool copy_to_selected_button(bContext *C, bool all, bool poll)
                 break;
               }
               if (RNA_property_copy(bmain, &lptr, &ptr, prop, (all) ? -1 : index)) {
-                RNA_property_update(C, &lptr, prop);
+                update_ptrs[update_ptrs_len++] = lptr;
                 success = true;
               }
             }
           }
         }
       }
+
+      if (update_ptrs) {
+        RNA_property_update_batch(C, update_ptrs, update_ptrs_len, prop);
+        MEM_freeN(update_ptrs);
+      }
     }
     MEM_SAFE_FREE(path);
     BLI_freelistN(&lb);
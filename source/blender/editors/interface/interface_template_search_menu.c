@@ -140,6 +140,11 @@ struct MenuSearch_Data {
   ListBase items;
   /** Use for all small allocations. */
   MemArena *memarena;
+  /**
+   * Search over `items`, created on the first update and reused for every following query,
+   * so typing doesn't normalize all item strings again on each key press.
+   */
+  StringSearch *search;
 
   /** Use for context menu, to fake a button to create a context menu. */
   struct {
@@ -920,6 +925,9 @@ static void menu_search_arg_free_fn(void *data_v)
     }
   }
 
+  if (data->search != NULL) {
+    BLI_string_search_free(data->search);
+  }
   BLI_memarena_free(data->memarena);
 
   MEM_freeN(data);
@@ -994,14 +1002,16 @@ static void menu_search_update_fn(const bContext *UNUSED(C),
 {
   struct MenuSearch_Data *data = arg;
 
-  StringSearch *search = BLI_string_search_new();
-
-  LISTBASE_FOREACH (struct MenuSearch_Item *, item, &data->items) {
-    BLI_string_search_add(search, item->drawwstr_full, item);
+  if (data->search == NULL) {
+    data->search = BLI_string_search_new();
+    LISTBASE_FOREACH (struct MenuSearch_Item *, item, &data->items) {
+      BLI_string_search_add(data->search, item->drawwstr_full, item);
+    }
   }
 
   struct MenuSearch_Item **filtered_items;
-  const int filtered_amount = BLI_string_search_query(search, str, (void ***)&filtered_items);
+  const int filtered_amount = BLI_string_search_query(
+      data->search, str, (void ***)&filtered_items);
 
   for (int i = 0; i < filtered_amount; i++) {
     struct MenuSearch_Item *item = filtered_items[i];
@@ -1011,7 +1021,6 @@ static void menu_search_update_fn(const bContext *UNUSED(C),
   }
 
   MEM_freeN(filtered_items);
-  BLI_string_search_free(search);
 }
 
 /** \} */
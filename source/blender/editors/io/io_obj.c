@@ -0,0 +1,205 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The Original Code is Copyright (C) 2021 Blender Foundation.
+ * All rights reserved.
+ */
+
+/** \file
+ * \ingroup editor/io
+ */
+
+#include "DNA_object_types.h"
+#include "DNA_scene_types.h"
+#include "DNA_space_types.h"
+
+#include "BKE_context.h"
+#include "BKE_main.h"
+#include "BKE_report.h"
+
+#include "BLI_path_util.h"
+#include "BLI_string.h"
+#include "BLI_utildefines.h"
+
+#include "DEG_depsgraph.h"
+
+#include "RNA_access.h"
+#include "RNA_define.h"
+#include "RNA_enum_types.h"
+
+#include "WM_api.h"
+#include "WM_types.h"
+
+#include "io_obj.h"
+
+#include "IO_obj.h"
+
+static const EnumPropertyItem obj_export_evaluation_mode_items[] = {
+    {DAG_EVAL_RENDER,
+     "RENDER",
+     0,
+     "Render",
+     "Use Render settings for object visibility, modifier settings, etc"},
+    {DAG_EVAL_VIEWPORT,
+     "VIEWPORT",
+     0,
+     "Viewport",
+     "Use Viewport settings for object visibility, modifier settings, etc"},
+    {0, NULL, 0, NULL, NULL},
+};
+
+static int wm_obj_export_invoke(bContext *C, wmOperator *op, const wmEvent *UNUSED(event))
+{
+  Scene *scene = CTX_data_scene(C);
+
+  if (!RNA_struct_property_is_set(op->ptr, "start_frame")) {
+    RNA_int_set(op->ptr, "start_frame", SFRA);
+  }
+  if (!RNA_struct_property_is_set(op->ptr, "end_frame")) {
+    RNA_int_set(op->ptr, "end_frame", EFRA);
+  }
+
+  if (!RNA_struct_property_is_set(op->ptr, "filepath")) {
+    Main *bmain = CTX_data_main(C);
+    char filepath[FILE_MAX];
+    const char *main_blendfile_path = BKE_main_blendfile_path(bmain);
+
+    if (main_blendfile_path[0] == '\0') {
+      BLI_strncpy(filepath, "untitled", sizeof(filepath));
+    }
+    else {
+      BLI_strncpy(filepath, main_blendfile_path, sizeof(filepath));
+    }
+
+    BLI_path_extension_replace(filepath, sizeof(filepath), ".obj");
+    RNA_string_set(op->ptr, "filepath", filepath);
+  }
+
+  WM_event_add_fileselect(C, op);
+
+  return OPERATOR_RUNNING_MODAL;
+}
+
+static int wm_obj_export_exec(bContext *C, wmOperator *op)
+{
+  if (!RNA_struct_property_is_set(op->ptr, "filepath")) {
+    BKE_report(op->reports, RPT_ERROR, "No filename given");
+    return OPERATOR_CANCELLED;
+  }
+
+  char filepath[FILE_MAX];
+  RNA_string_get(op->ptr, "filepath", filepath);
+
+  OBJExportParams params;
+  params.export_animation = RNA_boolean_get(op->ptr, "export_animation");
+  params.start_frame = RNA_int_get(op->ptr, "start_frame");
+  params.end_frame = RNA_int_get(op->ptr, "end_frame");
+  params.global_scale = RNA_float_get(op->ptr, "global_scale");
+  params.forward_axis = RNA_enum_get(op->ptr, "axis_forward");
+  params.up_axis = RNA_enum_get(op->ptr, "axis_up");
+  params.export_selected_objects = RNA_boolean_get(op->ptr, "export_selected_objects");
+  params.export_uv = RNA_boolean_get(op->ptr, "export_uv");
+  params.export_normals = RNA_boolean_get(op->ptr, "export_normals");
+  params.evaluation_mode = RNA_enum_get(op->ptr, "evaluation_mode");
+
+  if ((params.forward_axis % 3) == (params.up_axis % 3)) {
+    BKE_report(op->reports, RPT_ERROR, "Forward and up axes must be different");
+    return OPERATOR_CANCELLED;
+  }
+  if (params.export_animation && params.start_frame > params.end_frame) {
+    BKE_report(op->reports, RPT_ERROR, "Start frame must not be after the end frame");
+    return OPERATOR_CANCELLED;
+  }
+
+  if (!OBJ_export(C, filepath, &params, op->reports)) {
+    return OPERATOR_CANCELLED;
+  }
+  return OPERATOR_FINISHED;
+}
+
+void WM_OT_obj_export(wmOperatorType *ot)
+{
+  ot->name = "Export Wavefront OBJ";
+  ot->description = "Save the scene to a Wavefront OBJ file";
+  ot->idname = "WM_OT_obj_export";
+
+  ot->invoke = wm_obj_export_invoke;
+  ot->exec = wm_obj_export_exec;
+  ot->poll = WM_operator_winactive;
+
+  WM_operator_properties_filesel(ot,
+                                 FILE_TYPE_FOLDER,
+                                 FILE_BLENDER,
+                                 FILE_SAVE,
+                                 WM_FILESEL_FILEPATH | WM_FILESEL_SHOW_PROPS,
+                                 FILE_DEFAULTDISPLAY,
+                                 FILE_SORT_ALPHA);
+
+  PropertyRNA *prop = RNA_def_string(ot->srna, "filter_glob", "*.obj", 0, "", "");
+  RNA_def_property_flag(prop, PROP_HIDDEN);
+
+  RNA_def_boolean(ot->srna,
+                  "export_animation",
+                  false,
+                  "Animation",
+                  "Write one file per frame, with the frame number added to the file name");
+  RNA_def_int(ot->srna,
+              "start_frame",
+              1,
+              INT_MIN,
+              INT_MAX,
+              "Start Frame",
+              "The first frame to be exported",
+              INT_MIN,
+              INT_MAX);
+  RNA_def_int(ot->srna,
+              "end_frame",
+              250,
+              INT_MIN,
+              INT_MAX,
+              "End Frame",
+              "The last frame to be exported",
+              INT_MIN,
+              INT_MAX);
+
+  RNA_def_float(
+      ot->srna,
+      "global_scale",
+      1.0f,
+      1e-6f,
+      1e6f,
+      "Scale",
+      "Value by which to enlarge or shrink the objects with respect to the world's origin",
+      0.001f,
+      1000.0f);
+  RNA_def_enum(
+      ot->srna, "axis_forward", rna_enum_object_axis_items, OB_NEGZ, "Forward Axis", "");
+  RNA_def_enum(ot->srna, "axis_up", rna_enum_object_axis_items, OB_POSY, "Up Axis", "");
+
+  RNA_def_boolean(ot->srna,
+                  "export_selected_objects",
+                  false,
+                  "Selected Objects Only",
+                  "Only export selected objects instead of all visible ones");
+  RNA_def_boolean(ot->srna, "export_uv", true, "UVs", "Write the active UV map");
+  RNA_def_boolean(ot->srna, "export_normals", true, "Normals", "Write face and vertex normals");
+  RNA_def_enum(ot->srna,
+               "evaluation_mode",
+               obj_export_evaluation_mode_items,
+               DAG_EVAL_VIEWPORT,
+               "Use Settings for",
+               "Determines visibility of objects, modifier settings, and other areas where there "
+               "are different settings for viewport and rendering");
+}
@@ -38,6 +38,8 @@
 #endif
 
 #include "io_cache.h"
+#include "io_obj.h"
+#include "io_stl.h"
 
 void ED_operatortypes_io(void)
 {
@@ -56,4 +58,7 @@ void ED_operatortypes_io(void)
 
   WM_operatortype_append(CACHEFILE_OT_open);
   WM_operatortype_append(CACHEFILE_OT_reload);
+
+  WM_operatortype_append(WM_OT_obj_export);
+  WM_operatortype_append(WM_OT_stl_import);
 }
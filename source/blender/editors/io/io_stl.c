@@ -0,0 +1,165 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The Original Code is Copyright (C) 2021 Blender Foundation.
+ * All rights reserved.
+ */
+
+/** \file
+ * \ingroup editor/io
+ */
+
+#include "DNA_object_types.h"
+#include "DNA_scene_types.h"
+#include "DNA_space_types.h"
+
+#include "BKE_context.h"
+#include "BKE_report.h"
+
+#include "BLI_path_util.h"
+#include "BLI_string.h"
+#include "BLI_utildefines.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "RNA_access.h"
+#include "RNA_define.h"
+#include "RNA_enum_types.h"
+
+#include "ED_object.h"
+
+#include "WM_api.h"
+#include "WM_types.h"
+
+#include "io_stl.h"
+
+#include "IO_stl.h"
+
+static int wm_stl_import_exec(bContext *C, wmOperator *op)
+{
+  Scene *scene = CTX_data_scene(C);
+  STLImportParams params;
+
+  params.global_scale = RNA_float_get(op->ptr, "global_scale");
+  params.forward_axis = RNA_enum_get(op->ptr, "axis_forward");
+  params.up_axis = RNA_enum_get(op->ptr, "axis_up");
+  params.use_facet_normal = RNA_boolean_get(op->ptr, "use_facet_normal");
+
+  if ((params.forward_axis % 3) == (params.up_axis % 3)) {
+    BKE_report(op->reports, RPT_ERROR, "Forward and up axes must be different");
+    return OPERATOR_CANCELLED;
+  }
+
+  if (RNA_boolean_get(op->ptr, "use_scene_unit") && scene->unit.system != USER_UNIT_NONE) {
+    params.global_scale /= scene->unit.scale_length;
+  }
+
+  /* Switch out of edit mode to avoid being stuck in it (T54326). */
+  Object *obedit = CTX_data_edit_object(C);
+  if (obedit) {
+    ED_object_mode_set(C, OB_MODE_OBJECT);
+  }
+
+  int files_num = 0;
+  int imported_num = 0;
+  char filepath[FILE_MAX];
+
+  if (RNA_collection_length(op->ptr, "files") > 0) {
+    char directory[FILE_MAX];
+    RNA_string_get(op->ptr, "directory", directory);
+
+    RNA_BEGIN (op->ptr, itemptr, "files") {
+      char *filename = RNA_string_get_alloc(&itemptr, "name", NULL, 0);
+      BLI_join_dirfile(filepath, sizeof(filepath), directory, filename);
+      MEM_freeN(filename);
+
+      files_num++;
+      if (STL_import(C, filepath, &params, op->reports)) {
+        imported_num++;
+      }
+    }
+    RNA_END;
+  }
+  else if (RNA_struct_property_is_set(op->ptr, "filepath")) {
+    RNA_string_get(op->ptr, "filepath", filepath);
+
+    files_num++;
+    if (STL_import(C, filepath, &params, op->reports)) {
+      imported_num++;
+    }
+  }
+
+  if (files_num == 0) {
+    BKE_report(op->reports, RPT_ERROR, "No filename given");
+    return OPERATOR_CANCELLED;
+  }
+
+  if (imported_num == 0) {
+    return OPERATOR_CANCELLED;
+  }
+
+  WM_event_add_notifier(C, NC_SCENE | ND_OB_ACTIVE, scene);
+  WM_event_add_notifier(C, NC_SCENE | ND_LAYER_CONTENT, scene);
+
+  return OPERATOR_FINISHED;
+}
+
+void WM_OT_stl_import(wmOperatorType *ot)
+{
+  ot->name = "Import STL";
+  ot->description = "Load one or more STL files as mesh objects";
+  ot->idname = "WM_OT_stl_import";
+  ot->flag = OPTYPE_REGISTER | OPTYPE_UNDO;
+
+  ot->invoke = WM_operator_filesel;
+  ot->exec = wm_stl_import_exec;
+  ot->poll = WM_operator_winactive;
+
+  WM_operator_properties_filesel(ot,
+                                 FILE_TYPE_FOLDER,
+                                 FILE_BLENDER,
+                                 FILE_OPENFILE,
+                                 WM_FILESEL_FILEPATH | WM_FILESEL_FILES | WM_FILESEL_DIRECTORY |
+                                     WM_FILESEL_SHOW_PROPS,
+                                 FILE_DEFAULTDISPLAY,
+                                 FILE_SORT_ALPHA);
+
+  PropertyRNA *prop = RNA_def_string(ot->srna, "filter_glob", "*.stl", 0, "", "");
+  RNA_def_property_flag(prop, PROP_HIDDEN);
+
+  RNA_def_float(
+      ot->srna,
+      "global_scale",
+      1.0f,
+      1e-6f,
+      1e6f,
+      "Scale",
+      "Value by which to enlarge or shrink the objects with respect to the world's origin",
+      0.001f,
+      1000.0f);
+  RNA_def_boolean(ot->srna,
+                  "use_scene_unit",
+                  false,
+                  "Scene Unit",
+                  "Apply current scene's unit (as defined by unit scale) to imported data");
+  RNA_def_boolean(ot->srna,
+                  "use_facet_normal",
+                  false,
+                  "Facet Normals",
+                  "Use (import) facet normals (note that this will still give flat shading)");
+  RNA_def_enum(
+      ot->srna, "axis_forward", rna_enum_object_axis_items, OB_POSY, "Forward Axis", "");
+  RNA_def_enum(ot->srna, "axis_up", rna_enum_object_axis_items, OB_POSZ, "Up Axis", "");
+}
@@ -1466,6 +1466,7 @@ void EDBM_update_generic(Mesh *mesh, const bool do_tessellation, const bool is_d
   }
   /* don't keep stale derivedMesh data around, see: T38872. */
   BKE_editmesh_free_derivedmesh(em);
+  BKE_editmesh_deform_tag_all(em);
 
 #ifdef DEBUG
   {
@@ -2848,6 +2848,25 @@ static const char *region_panels_collect_categories(ARegion *region,
   return NULL;
 }
 
+/**
+ * Redraws that don't need a rebuild (button highlighting for example) reuse the blocks of the
+ * last layout instead of running all panel draw callbacks again. The region size and view are
+ * used for the layout, so they must be unchanged.
+ */
+static bool region_panels_layout_reuse(ARegion *region)
+{
+  if (((region->do_draw & RGN_DRAW_NO_REBUILD) == 0) ||
+      (region->flag & RGN_FLAG_SEARCH_FILTER_UPDATE)) {
+    return false;
+  }
+  if ((region->winx != region->runtime.panels_layout_winx) ||
+      (region->winy != region->runtime.panels_layout_winy) ||
+      !BLI_rctf_compare(&region->v2d.cur, &region->runtime.panels_layout_cur, FLT_EPSILON)) {
+    return false;
+  }
+  return UI_blocklist_reuse(&region->uiblocks);
+}
+
 /**
  * \param contexts: A NULL terminated array of context strings to match against.
  * Matching against any of these strings will draw the panel.
@@ -2859,6 +2878,10 @@ void ED_region_panels_layout_ex(const bContext *C,
                                 const char *contexts[],
                                 const char *category_override)
 {
+  if (region_panels_layout_reuse(region)) {
+    return;
+  }
+
   /* collect panels to draw */
   WorkSpace *workspace = CTX_wm_workspace(C);
   LinkNode *panel_types_stack = NULL;
@@ -3025,6 +3048,10 @@ void ED_region_panels_layout_ex(const bContext *C,
   if (use_category_tabs) {
     region->runtime.category = category;
   }
+
+  region->runtime.panels_layout_cur = v2d->cur;
+  region->runtime.panels_layout_winx = region->winx;
+  region->runtime.panels_layout_winy = region->winy;
 }
 
 void ED_region_panels_layout(const bContext *C, ARegion *region)
@@ -35,8 +35,10 @@
 #include "BIF_glutil.h"
 
 #include "IMB_colormanagement.h"
+#include "IMB_imbuf.h"
 #include "IMB_imbuf_types.h"
 
+#include "GPU_capabilities.h"
 #include "GPU_immediate.h"
 #include "GPU_matrix.h"
 #include "GPU_texture.h"
@@ -363,6 +365,39 @@ void immDrawPixelsTex_clipping(IMMDrawPixelsTexState *state,
 
 /* **** Color management helper functions for GLSL display/transform ***** */
 
+/* Draw a whole texture, uses the currently bound shader. */
+static void immDrawTexture(IMMDrawPixelsTexState *state,
+                           GPUTexture *tex,
+                           float x,
+                           float y,
+                           int img_w,
+                           int img_h,
+                           bool use_filter,
+                           float zoom_x,
+                           float zoom_y)
+{
+  GPU_texture_filter_mode(tex, use_filter);
+  GPU_texture_bind(tex, 0);
+
+  uint pos = state->pos, texco = state->texco;
+
+  immBegin(GPU_PRIM_TRI_FAN, 4);
+  immAttr2f(texco, 0.0f, 0.0f);
+  immVertex2f(pos, x, y);
+
+  immAttr2f(texco, 1.0f, 0.0f);
+  immVertex2f(pos, x + img_w * zoom_x, y);
+
+  immAttr2f(texco, 1.0f, 1.0f);
+  immVertex2f(pos, x + img_w * zoom_x, y + img_h * zoom_y);
+
+  immAttr2f(texco, 0.0f, 1.0f);
+  immVertex2f(pos, x, y + img_h * zoom_y);
+  immEnd();
+
+  GPU_texture_unbind(tex);
+}
+
 /* Draw given image buffer on a screen using GLSL for display transform */
 void ED_draw_imbuf_clipping(ImBuf *ibuf,
                             float x,
@@ -416,7 +451,15 @@ void ED_draw_imbuf_clipping(ImBuf *ibuf,
     }
 
     if (ok) {
-      if (ibuf->rect_float) {
+      /* Float buffers stay on the GPU between redraws, only the display transform changes. */
+      GPUTexture *display_texture = (ibuf->rect_float) ? IMB_display_gpu_texture_ensure(ibuf) :
+                                                         NULL;
+
+      if (display_texture) {
+        immDrawTexture(
+            &state, display_texture, x, y, ibuf->x, ibuf->y, use_filter, zoom_x, zoom_y);
+      }
+      else if (ibuf->rect_float) {
         eGPUTextureFormat format = 0;
 
         if (ibuf->channels == 3) {
@@ -566,6 +609,14 @@ void ED_draw_imbuf_ctx(
 int ED_draw_imbuf_method(ImBuf *ibuf)
 {
   if (U.image_draw_method == IMAGE_DRAW_METHOD_AUTO) {
+    /* Float buffers that fit in a texture are only uploaded once, see
+     * #IMB_display_gpu_texture_ensure. */
+    const int max_size = GPU_max_texture_size();
+    if (ibuf->rect_float && ELEM(ibuf->channels, 3, 4) && ibuf->x <= max_size &&
+        ibuf->y <= max_size) {
+      return IMAGE_DRAW_METHOD_GLSL;
+    }
+
     /* Use faster GLSL when CPU to GPU transfer is unlikely to be a bottleneck,
      * otherwise do color management on CPU side. */
     const size_t threshold = sizeof(float[4]) * 2048 * 2048;
@@ -57,6 +57,7 @@
 #include "BKE_subsurf.h"
 
 #include "DEG_depsgraph.h"
+#include "DEG_depsgraph_query.h"
 
 #include "WM_api.h"
 #include "WM_message.h"
@@ -191,6 +192,28 @@ static bool vertex_paint_use_fast_update_check(Object *ob)
   return false;
 }
 
+/* Check if weight changes can be drawn directly from the evaluated mesh
+ * (without evaluating modifiers), this is only the case when nothing
+ * in the stack depends on the weights and the deform-verts are shared. */
+static bool weight_paint_use_fast_update_check(Object *ob)
+{
+  VirtualModifierData virtualModifierData;
+  if (BKE_modifiers_get_virtual_modifierlist(ob, &virtualModifierData) != NULL) {
+    return false;
+  }
+
+  Mesh *me_eval = BKE_object_get_evaluated_mesh(ob);
+
+  if (me_eval != NULL) {
+    Mesh *me = BKE_mesh_from_object(ob);
+    if (me && me->dvert) {
+      return (me->dvert == CustomData_get_layer(&me_eval->vdata, CD_MDEFORMVERT));
+    }
+  }
+
+  return false;
+}
+
 static void paint_last_stroke_update(Scene *scene, const float location[3])
 {
   UnifiedPaintSettings *ups = &scene->toolsettings->unified_paint_settings;
@@ -1471,6 +1494,9 @@ struct WPaintData {
   /* original weight values for use in blur/smear */
   float *precomputed_weight;
   bool precomputed_weight_ready;
+
+  /* Weights are shared with the evaluated mesh, only its weight batches need updating. */
+  bool use_fast_update;
 };
 
 /* Initialize the stroke cache invariants from operator properties */
@@ -1663,6 +1689,7 @@ static bool wpaint_stroke_test_start(bContext *C, wmOperator *op, const float mo
   wpd->defbase_sel = defbase_sel;
   wpd->defbase_tot_sel = defbase_tot_sel > 1 ? defbase_tot_sel : 1;
   wpd->do_multipaint = (ts->multipaint && defbase_tot_sel > 1);
+  wpd->use_fast_update = weight_paint_use_fast_update_check(ob);
 
   /* set up auto-normalize, and generate map for detecting which
    * vgroups affect deform bones */
@@ -2426,9 +2453,15 @@ static void wpaint_stroke_update_step(bContext *C, struct PaintStroke *stroke, P
   mul_v3_m4v3(loc_world, ob->obmat, ss->cache->true_location);
   paint_last_stroke_update(scene, loc_world);
 
-  BKE_mesh_batch_cache_dirty_tag(ob->data, BKE_MESH_BATCH_DIRTY_ALL);
-
-  DEG_id_tag_update(ob->data, 0);
+  if (wpd->use_fast_update) {
+    /* Only the weight overlay changed, avoid re-evaluating the mesh for every dab. */
+    Object *ob_eval = DEG_get_evaluated_object(vc->depsgraph, ob);
+    BKE_mesh_batch_cache_dirty_tag(ob_eval->data, BKE_MESH_BATCH_DIRTY_WEIGHTS);
+  }
+  else {
+    BKE_mesh_batch_cache_dirty_tag(ob->data, BKE_MESH_BATCH_DIRTY_ALL);
+    DEG_id_tag_update(ob->data, 0);
+  }
   WM_event_add_notifier(C, NC_OBJECT | ND_DRAW, ob);
   swap_m4m4(wpd->vc.rv3d->persmat, mat);
 
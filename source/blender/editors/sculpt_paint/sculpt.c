@@ -785,13 +785,26 @@ static void sculpt_vertex_neighbors_get_faces(SculptSession *ss,
   iter->capacity = SCULPT_VERTEX_NEIGHBOR_FIXED_CAPACITY;
   iter->neighbors = iter->neighbors_fixed;
 
-  for (int i = 0; i < ss->pmap[index].count; i++) {
-    const MPoly *p = &ss->mpoly[vert_map->indices[i]];
-    uint f_adj_v[2];
-    if (poly_get_adj_loops_from_vert(p, ss->mloop, index, f_adj_v) != -1) {
-      for (int j = 0; j < ARRAY_SIZE(f_adj_v); j += 1) {
-        if (f_adj_v[j] != index) {
-          sculpt_vertex_neighbor_add(iter, f_adj_v[j]);
+  if (ss->vert_adj_offsets) {
+    /* Use the cached adjacency, neighbors there are already unique. */
+    const int start = ss->vert_adj_offsets[index];
+    const int len = ss->vert_adj_offsets[index + 1] - start;
+    if (len > iter->capacity) {
+      iter->capacity = len + SCULPT_VERTEX_NEIGHBOR_FIXED_CAPACITY;
+      iter->neighbors = MEM_mallocN(iter->capacity * sizeof(int), "neighbor array");
+    }
+    memcpy(iter->neighbors, &ss->vert_adj_indices[start], sizeof(int) * len);
+    iter->size = len;
+  }
+  else {
+    for (int i = 0; i < ss->pmap[index].count; i++) {
+      const MPoly *p = &ss->mpoly[vert_map->indices[i]];
+      uint f_adj_v[2];
+      if (poly_get_adj_loops_from_vert(p, ss->mloop, index, f_adj_v) != -1) {
+        for (int j = 0; j < ARRAY_SIZE(f_adj_v); j += 1) {
+          if (f_adj_v[j] != index) {
+            sculpt_vertex_neighbor_add(iter, f_adj_v[j]);
+          }
         }
       }
     }
@@ -2463,15 +2476,11 @@ static float brush_strength(const Sculpt *sd,
 }
 
 /* Return a multiplier for brush strength on a particular vertex. */
-float SCULPT_brush_strength_factor(SculptSession *ss,
-                                   const Brush *br,
-                                   const float brush_point[3],
-                                   const float len,
-                                   const short vno[3],
-                                   const float fno[3],
-                                   const float mask,
-                                   const int vertex_index,
-                                   const int thread_id)
+/* Strength of the brush texture at the given point, 1 when the brush has no texture. */
+static float sculpt_brush_texture_factor(SculptSession *ss,
+                                         const Brush *br,
+                                         const float brush_point[3],
+                                         const int thread_id)
 {
   StrokeCache *cache = ss->cache;
   const Scene *scene = cache->vc->scene;
@@ -2532,6 +2541,22 @@ float SCULPT_brush_strength_factor(SculptSession *ss,
     }
   }
 
+  return avg;
+}
+
+float SCULPT_brush_strength_factor(SculptSession *ss,
+                                   const Brush *br,
+                                   const float brush_point[3],
+                                   const float len,
+                                   const short vno[3],
+                                   const float fno[3],
+                                   const float mask,
+                                   const int vertex_index,
+                                   const int thread_id)
+{
+  StrokeCache *cache = ss->cache;
+  float avg = sculpt_brush_texture_factor(ss, br, brush_point, thread_id);
+
   /* Hardness. */
   float final_len = len;
   const float hardness = cache->paint_brush.hardness;
@@ -2560,6 +2585,160 @@ float SCULPT_brush_strength_factor(SculptSession *ss,
   return avg;
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Batched Brush Strength
+ *
+ * Brushes gather the vertices of a node that pass the brush test, compute the strength factors
+ * of all of them at once and then apply the factors. Every step of
+ * #SCULPT_brush_strength_factor is done for the whole batch in a tight loop over contiguous
+ * arrays, settings that are the same for all vertices are only checked once.
+ * \{ */
+
+void SCULPT_brush_batch_init(SculptBrushBatch *batch, PBVH *pbvh, PBVHNode *node)
+{
+  int uniq_verts, totvert;
+  BKE_pbvh_node_num_verts(pbvh, node, &uniq_verts, &totvert);
+
+  batch->len = 0;
+  batch->capacity = uniq_verts;
+
+  /* Use a single allocation for all arrays, starting with the pointers for alignment. */
+  const size_t elem_size = sizeof(MVert *) + sizeof(float[3]) * 2 + sizeof(float) * 3 +
+                           sizeof(int) * 2;
+  char *data = MEM_mallocN(max_ii(uniq_verts, 1) * elem_size, __func__);
+  batch->mvert = (MVert **)data;
+  data += sizeof(MVert *) * uniq_verts;
+  batch->co = (float(*)[3])data;
+  data += sizeof(float[3]) * uniq_verts;
+  batch->no = (float(*)[3])data;
+  data += sizeof(float[3]) * uniq_verts;
+  batch->len_to_brush = (float *)data;
+  data += sizeof(float) * uniq_verts;
+  batch->mask = (float *)data;
+  data += sizeof(float) * uniq_verts;
+  batch->factor = (float *)data;
+  data += sizeof(float) * uniq_verts;
+  batch->vertex_index = (int *)data;
+  data += sizeof(int) * uniq_verts;
+  batch->proxy_index = (int *)data;
+}
+
+void SCULPT_brush_batch_add(SculptBrushBatch *batch,
+                            const PBVHVertexIter *vd,
+                            const float co[3],
+                            const float len,
+                            const short vno[3],
+                            const float fno[3])
+{
+  BLI_assert(batch->len < batch->capacity);
+  const int i = batch->len++;
+  batch->mvert[i] = vd->mvert;
+  copy_v3_v3(batch->co[i], co);
+  if (vno) {
+    normal_short_to_float_v3(batch->no[i], vno);
+  }
+  else if (fno) {
+    copy_v3_v3(batch->no[i], fno);
+  }
+  else {
+    zero_v3(batch->no[i]);
+  }
+  batch->len_to_brush[i] = len;
+  batch->mask[i] = vd->mask ? *vd->mask : 0.0f;
+  batch->vertex_index[i] = vd->index;
+  batch->proxy_index[i] = vd->i;
+}
+
+void SCULPT_brush_batch_strength_factors(SculptSession *ss,
+                                         const Brush *br,
+                                         SculptBrushBatch *batch,
+                                         const int thread_id)
+{
+  StrokeCache *cache = ss->cache;
+  const int len = batch->len;
+  float *factor = batch->factor;
+
+  /* Texture. */
+  if (br->mtex.tex && (br->mtex.brush_map_mode == MTEX_MAP_MODE_3D || ss->texcache)) {
+    for (int i = 0; i < len; i++) {
+      factor[i] = sculpt_brush_texture_factor(ss, br, batch->co[i], thread_id);
+    }
+  }
+  else {
+    for (int i = 0; i < len; i++) {
+      factor[i] = 1.0f;
+    }
+  }
+
+  /* Hardness, the resulting lengths are stored in place of the distances. */
+  const float hardness = cache->paint_brush.hardness;
+  const float radius = cache->radius;
+  float *final_len = batch->len_to_brush;
+  if (hardness == 1.0f) {
+    for (int i = 0; i < len; i++) {
+      final_len[i] = (final_len[i] < radius) ? 0.0f : radius;
+    }
+  }
+  else if (hardness != 0.0f) {
+    const float hardness_len = hardness * radius;
+    const float hardness_fac = 1.0f / (1.0f - hardness);
+    for (int i = 0; i < len; i++) {
+      final_len[i] = (final_len[i] < hardness_len) ? 0.0f :
+                                                     (final_len[i] - hardness_len) * hardness_fac;
+    }
+  }
+
+  /* Falloff curve. */
+  for (int i = 0; i < len; i++) {
+    factor[i] *= BKE_brush_curve_strength(br, final_len[i], radius);
+  }
+
+  /* Front-face. */
+  if (br->flag & BRUSH_FRONTFACE) {
+    const float *view_normal = cache->view_normal;
+    for (int i = 0; i < len; i++) {
+      factor[i] *= max_ff(dot_v3v3(batch->no[i], view_normal), 0.0f);
+    }
+  }
+
+  /* Paint mask. */
+  for (int i = 0; i < len; i++) {
+    factor[i] *= 1.0f - batch->mask[i];
+  }
+
+  /* Auto-masking. */
+  AutomaskingCache *automasking = cache->automasking;
+  if (automasking && automasking->factor) {
+    for (int i = 0; i < len; i++) {
+      factor[i] *= automasking->factor[batch->vertex_index[i]];
+    }
+  }
+  else if (automasking) {
+    for (int i = 0; i < len; i++) {
+      factor[i] *= SCULPT_automasking_factor_get(automasking, ss, batch->vertex_index[i]);
+    }
+  }
+}
+
+/* Tag the vertices of the batch for a PBVH update after they were displaced. */
+void SCULPT_brush_batch_tag_update(const SculptBrushBatch *batch)
+{
+  for (int i = 0; i < batch->len; i++) {
+    if (batch->mvert[i]) {
+      batch->mvert[i]->flag |= ME_VERT_PBVH_UPDATE;
+    }
+  }
+}
+
+void SCULPT_brush_batch_free(SculptBrushBatch *batch)
+{
+  MEM_SAFE_FREE(batch->mvert);
+  batch->len = 0;
+  batch->capacity = 0;
+}
+
+/** \} */
+
 /* Test AABB against sphere. */
 bool SCULPT_search_sphere_cb(PBVHNode *node, void *data_v)
 {
@@ -3283,29 +3462,26 @@ static void do_draw_brush_task_cb_ex(void *__restrict userdata,
       ss, &test, data->brush->falloff_shape);
   const int thread_id = BLI_task_parallel_thread_id(tls);
 
+  SculptBrushBatch batch;
+  SCULPT_brush_batch_init(&batch, ss->pbvh, data->nodes[n]);
+
   BKE_pbvh_vertex_iter_begin(ss->pbvh, data->nodes[n], vd, PBVH_ITER_UNIQUE)
   {
     if (!sculpt_brush_test_sq_fn(&test, vd.co)) {
       continue;
     }
-    /* Offset vertex. */
-    const float fade = SCULPT_brush_strength_factor(ss,
-                                                    brush,
-                                                    vd.co,
-                                                    sqrtf(test.dist),
-                                                    vd.no,
-                                                    vd.fno,
-                                                    vd.mask ? *vd.mask : 0.0f,
-                                                    vd.index,
-                                                    thread_id);
+    SCULPT_brush_batch_add(&batch, &vd, vd.co, sqrtf(test.dist), vd.no, vd.fno);
+  }
+  BKE_pbvh_vertex_iter_end;
 
-    mul_v3_v3fl(proxy[vd.i], offset, fade);
+  SCULPT_brush_batch_strength_factors(ss, brush, &batch, thread_id);
 
-    if (vd.mvert) {
-      vd.mvert->flag |= ME_VERT_PBVH_UPDATE;
-    }
+  /* Offset vertices. */
+  for (int i = 0; i < batch.len; i++) {
+    mul_v3_v3fl(proxy[batch.proxy_index[i]], offset, batch.factor[i]);
   }
-  BKE_pbvh_vertex_iter_end;
+  SCULPT_brush_batch_tag_update(&batch);
+  SCULPT_brush_batch_free(&batch);
 }
 
 static void do_draw_brush(Sculpt *sd, Object *ob, PBVHNode **nodes, int totnode)
@@ -4003,6 +4179,9 @@ static void do_grab_brush_task_cb_ex(void *__restrict userdata,
 
   const bool grab_silhouette = brush->flag2 & BRUSH_GRAB_SILHOUETTE;
 
+  SculptBrushBatch batch;
+  SCULPT_brush_batch_init(&batch, ss->pbvh, data->nodes[n]);
+
   BKE_pbvh_vertex_iter_begin(ss->pbvh, data->nodes[n], vd, PBVH_ITER_UNIQUE)
   {
     SCULPT_orig_vert_data_update(&orig_data, &vd);
@@ -4010,34 +4189,29 @@ static void do_grab_brush_task_cb_ex(void *__restrict userdata,
     if (!sculpt_brush_test_sq_fn(&test, orig_data.co)) {
       continue;
     }
-    float fade = bstrength * SCULPT_brush_strength_factor(ss,
-                                                          brush,
-                                                          orig_data.co,
-                                                          sqrtf(test.dist),
-                                                          orig_data.no,
-                                                          NULL,
-                                                          vd.mask ? *vd.mask : 0.0f,
-                                                          vd.index,
-                                                          thread_id);
+    SCULPT_brush_batch_add(&batch, &vd, orig_data.co, sqrtf(test.dist), orig_data.no, NULL);
+  }
+  BKE_pbvh_vertex_iter_end;
 
-    if (grab_silhouette) {
-      float silhouette_test_dir[3];
-      normalize_v3_v3(silhouette_test_dir, grab_delta);
-      if (dot_v3v3(ss->cache->initial_normal, ss->cache->grab_delta_symmetry) < 0.0f) {
-        mul_v3_fl(silhouette_test_dir, -1.0f);
-      }
-      float vno[3];
-      normal_short_to_float_v3(vno, orig_data.no);
-      fade *= max_ff(dot_v3v3(vno, silhouette_test_dir), 0.0f);
-    }
+  SCULPT_brush_batch_strength_factors(ss, brush, &batch, thread_id);
 
-    mul_v3_v3fl(proxy[vd.i], grab_delta, fade);
+  float silhouette_test_dir[3];
+  if (grab_silhouette) {
+    normalize_v3_v3(silhouette_test_dir, grab_delta);
+    if (dot_v3v3(ss->cache->initial_normal, ss->cache->grab_delta_symmetry) < 0.0f) {
+      mul_v3_fl(silhouette_test_dir, -1.0f);
+    }
+  }
 
-    if (vd.mvert) {
-      vd.mvert->flag |= ME_VERT_PBVH_UPDATE;
+  for (int i = 0; i < batch.len; i++) {
+    float fade = bstrength * batch.factor[i];
+    if (grab_silhouette) {
+      fade *= max_ff(dot_v3v3(batch.no[i], silhouette_test_dir), 0.0f);
     }
+    mul_v3_v3fl(proxy[batch.proxy_index[i]], grab_delta, fade);
   }
-  BKE_pbvh_vertex_iter_end;
+  SCULPT_brush_batch_tag_update(&batch);
+  SCULPT_brush_batch_free(&batch);
 }
 
 static void do_grab_brush(Sculpt *sd, Object *ob, PBVHNode **nodes, int totnode)
@@ -5200,6 +5374,10 @@ static void do_clay_strips_brush_task_cb_ex(void *__restrict userdata,
   plane_from_point_normal_v3(test.plane_tool, area_co, area_no_sp);
   const int thread_id = BLI_task_parallel_thread_id(tls);
 
+  SculptBrushBatch batch;
+  SCULPT_brush_batch_init(&batch, ss->pbvh, data->nodes[n]);
+  float(*displacement)[3] = MEM_mallocN(sizeof(float[3]) * max_ii(batch.capacity, 1), __func__);
+
   BKE_pbvh_vertex_iter_begin(ss->pbvh, data->nodes[n], vd, PBVH_ITER_UNIQUE)
   {
     if (!SCULPT_brush_test_cube(&test, vd.co, mat, brush->tip_roundness)) {
@@ -5218,24 +5396,20 @@ static void do_clay_strips_brush_task_cb_ex(void *__restrict userdata,
     if (!SCULPT_plane_trim(ss->cache, brush, val)) {
       continue;
     }
+    copy_v3_v3(displacement[batch.len], val);
     /* The normal from the vertices is ignored, it causes glitch with planes, see: T44390. */
-    const float fade = bstrength * SCULPT_brush_strength_factor(ss,
-                                                                brush,
-                                                                vd.co,
-                                                                ss->cache->radius * test.dist,
-                                                                vd.no,
-                                                                vd.fno,
-                                                                vd.mask ? *vd.mask : 0.0f,
-                                                                vd.index,
-                                                                thread_id);
+    SCULPT_brush_batch_add(&batch, &vd, vd.co, ss->cache->radius * test.dist, vd.no, vd.fno);
+  }
+  BKE_pbvh_vertex_iter_end;
 
-    mul_v3_v3fl(proxy[vd.i], val, fade);
+  SCULPT_brush_batch_strength_factors(ss, brush, &batch, thread_id);
 
-    if (vd.mvert) {
-      vd.mvert->flag |= ME_VERT_PBVH_UPDATE;
-    }
+  for (int i = 0; i < batch.len; i++) {
+    mul_v3_v3fl(proxy[batch.proxy_index[i]], displacement[i], bstrength * batch.factor[i]);
   }
-  BKE_pbvh_vertex_iter_end;
+  SCULPT_brush_batch_tag_update(&batch);
+  SCULPT_brush_batch_free(&batch);
+  MEM_freeN(displacement);
 }
 
 static void do_clay_strips_brush(Sculpt *sd, Object *ob, PBVHNode **nodes, int totnode)
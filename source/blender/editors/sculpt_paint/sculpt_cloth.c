@@ -29,6 +29,7 @@
 #include "BLI_gsqueue.h"
 #include "BLI_hash.h"
 #include "BLI_math.h"
+#include "BLI_math_bits.h"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
 
@@ -192,6 +193,7 @@ static float cloth_brush_simulation_falloff_get(const Brush *brush,
 #define CLOTH_SIMULATION_ITERATIONS 5
 
 #define CLOTH_SOLVER_DISPLACEMENT_FACTOR 0.6f
+#define CLOTH_SOLVER_PARALLEL_MIN_CONSTRAINTS 1024
 #define CLOTH_MAX_CONSTRAINTS_PER_VERTEX 1024
 #define CLOTH_SIMULATION_TIME_STEP 0.01f
 #define CLOTH_DEFORMATION_SNAKEHOOK_STRENGTH 0.35f
@@ -833,96 +835,207 @@ static void do_cloth_brush_solve_simulation_task_cb_ex(
   cloth_sim->node_state[node_index] = SCULPT_CLOTH_NODE_INACTIVE;
 }
 
-static void cloth_brush_satisfy_constraints(SculptSession *ss,
-                                            Brush *brush,
-                                            SculptClothSimulation *cloth_sim)
+/* Greedy coloring of the constraints, so two constraints with the same color never write to the
+ * same vertex. */
+static void cloth_brush_constraints_color(SculptSession *ss, SculptClothSimulation *cloth_sim)
 {
+  if (cloth_sim->tot_colored_constraints == cloth_sim->tot_length_constraints &&
+      cloth_sim->constraint_color_order != NULL) {
+    return;
+  }
 
-  AutomaskingCache *automasking = SCULPT_automasking_active_cache_get(ss);
+  const int totverts = SCULPT_vertex_count_get(ss);
+  const int tot_constraints = cloth_sim->tot_length_constraints;
+  uint *vertex_colors = MEM_callocN(sizeof(uint) * totverts, "cloth vertex colors");
+  char *constraint_color = MEM_mallocN(sizeof(char) * tot_constraints, "cloth constraint colors");
+  int color_len[SCULPT_CLOTH_CONSTRAINT_COLORS + 1] = {0};
+
+  for (int i = 0; i < tot_constraints; i++) {
+    const SculptClothLengthConstraint *constraint = &cloth_sim->length_constraints[i];
+    const int v1 = constraint->elem_index_a;
+    const int v2 = constraint->elem_index_b;
+    const uint used_colors = vertex_colors[v1] | vertex_colors[v2];
+
+    int color = SCULPT_CLOTH_CONSTRAINT_COLORS;
+    if (used_colors != UINT_MAX) {
+      color = (int)bitscan_forward_uint(~used_colors);
+      vertex_colors[v1] |= (1u << color);
+      vertex_colors[v2] |= (1u << color);
+    }
+    constraint_color[i] = (char)color;
+    color_len[color]++;
+  }
 
-  for (int constraint_it = 0; constraint_it < CLOTH_SIMULATION_ITERATIONS; constraint_it++) {
-    for (int i = 0; i < cloth_sim->tot_length_constraints; i++) {
-      const SculptClothLengthConstraint *constraint = &cloth_sim->length_constraints[i];
+  int *offset = cloth_sim->constraint_color_offset;
+  offset[0] = 0;
+  for (int color = 0; color <= SCULPT_CLOTH_CONSTRAINT_COLORS; color++) {
+    offset[color + 1] = offset[color] + color_len[color];
+    color_len[color] = offset[color];
+  }
 
-      if (cloth_sim->node_state[constraint->node] != SCULPT_CLOTH_NODE_ACTIVE) {
-        /* Skip all constraints that were created for inactive nodes. */
-        continue;
-      }
+  MEM_SAFE_FREE(cloth_sim->constraint_color_order);
+  cloth_sim->constraint_color_order = MEM_mallocN(sizeof(int) * max_ii(tot_constraints, 1),
+                                                  "cloth constraint color order");
+  for (int i = 0; i < tot_constraints; i++) {
+    cloth_sim->constraint_color_order[color_len[(int)constraint_color[i]]++] = i;
+  }
 
-      const int v1 = constraint->elem_index_a;
-      const int v2 = constraint->elem_index_b;
+  cloth_sim->tot_colored_constraints = tot_constraints;
 
-      float v1_to_v2[3];
-      sub_v3_v3v3(v1_to_v2, constraint->elem_position_b, constraint->elem_position_a);
-      const float current_distance = len_v3(v1_to_v2);
-      float correction_vector[3];
-      float correction_vector_half[3];
+  MEM_freeN(vertex_colors);
+  MEM_freeN(constraint_color);
+}
 
-      const float constraint_distance = constraint->length +
-                                        (cloth_sim->length_constraint_tweak[v1] * 0.5f) +
-                                        (cloth_sim->length_constraint_tweak[v2] * 0.5f);
+typedef struct ClothConstraintsSolveData {
+  SculptSession *ss;
+  Brush *brush;
+  SculptClothSimulation *cloth_sim;
+  AutomaskingCache *automasking;
+  const int *constraint_indices;
+  float sim_location[3];
+} ClothConstraintsSolveData;
+
+static void cloth_brush_solve_constraint(SculptSession *ss,
+                                         Brush *brush,
+                                         SculptClothSimulation *cloth_sim,
+                                         AutomaskingCache *automasking,
+                                         const float sim_location[3],
+                                         const SculptClothLengthConstraint *constraint)
+{
+  if (cloth_sim->node_state[constraint->node] != SCULPT_CLOTH_NODE_ACTIVE) {
+    /* Skip all constraints that were created for inactive nodes. */
+    return;
+  }
 
-      if (current_distance > 0.0f) {
-        mul_v3_v3fl(correction_vector,
-                    v1_to_v2,
-                    CLOTH_SOLVER_DISPLACEMENT_FACTOR *
-                        (1.0f - (constraint_distance / current_distance)));
-      }
-      else {
-        mul_v3_v3fl(correction_vector, v1_to_v2, CLOTH_SOLVER_DISPLACEMENT_FACTOR);
-      }
+  const int v1 = constraint->elem_index_a;
+  const int v2 = constraint->elem_index_b;
 
-      mul_v3_v3fl(correction_vector_half, correction_vector, 0.5f);
-
-      const float mask_v1 = (1.0f - SCULPT_vertex_mask_get(ss, v1)) *
-                            SCULPT_automasking_factor_get(automasking, ss, v1);
-      const float mask_v2 = (1.0f - SCULPT_vertex_mask_get(ss, v2)) *
-                            SCULPT_automasking_factor_get(automasking, ss, v2);
-
-      float sim_location[3];
-      cloth_brush_simulation_location_get(ss, brush, sim_location);
-
-      const float sim_factor_v1 = ss->cache ?
-                                      cloth_brush_simulation_falloff_get(brush,
-                                                                         ss->cache->radius,
-                                                                         sim_location,
-                                                                         cloth_sim->init_pos[v1]) :
-                                      1.0f;
-      const float sim_factor_v2 = ss->cache ?
-                                      cloth_brush_simulation_falloff_get(brush,
-                                                                         ss->cache->radius,
-                                                                         sim_location,
-                                                                         cloth_sim->init_pos[v2]) :
-                                      1.0f;
-
-      float deformation_strength = 1.0f;
-      if (constraint->type == SCULPT_CLOTH_CONSTRAINT_DEFORMATION) {
-        deformation_strength = (cloth_sim->deformation_strength[v1] +
-                                cloth_sim->deformation_strength[v2]) *
-                               0.5f;
-      }
+  float v1_to_v2[3];
+  sub_v3_v3v3(v1_to_v2, constraint->elem_position_b, constraint->elem_position_a);
+  const float current_distance = len_v3(v1_to_v2);
+  float correction_vector[3];
+  float correction_vector_half[3];
 
-      if (constraint->type == SCULPT_CLOTH_CONSTRAINT_SOFTBODY) {
-        const float softbody_plasticity = brush ? brush->cloth_constraint_softbody_strength : 0.0f;
-        madd_v3_v3fl(cloth_sim->pos[v1],
-                     correction_vector_half,
-                     1.0f * mask_v1 * sim_factor_v1 * constraint->strength * softbody_plasticity);
-        madd_v3_v3fl(cloth_sim->softbody_pos[v1],
-                     correction_vector_half,
-                     -1.0f * mask_v1 * sim_factor_v1 * constraint->strength *
-                         (1.0f - softbody_plasticity));
-      }
-      else {
-        madd_v3_v3fl(cloth_sim->pos[v1],
-                     correction_vector_half,
-                     1.0f * mask_v1 * sim_factor_v1 * constraint->strength * deformation_strength);
-        if (v1 != v2) {
-          madd_v3_v3fl(cloth_sim->pos[v2],
-                       correction_vector_half,
-                       -1.0f * mask_v2 * sim_factor_v2 * constraint->strength *
-                           deformation_strength);
-        }
+  const float constraint_distance = constraint->length +
+                                    (cloth_sim->length_constraint_tweak[v1] * 0.5f) +
+                                    (cloth_sim->length_constraint_tweak[v2] * 0.5f);
+
+  if (current_distance > 0.0f) {
+    mul_v3_v3fl(correction_vector,
+                v1_to_v2,
+                CLOTH_SOLVER_DISPLACEMENT_FACTOR *
+                    (1.0f - (constraint_distance / current_distance)));
+  }
+  else {
+    mul_v3_v3fl(correction_vector, v1_to_v2, CLOTH_SOLVER_DISPLACEMENT_FACTOR);
+  }
+
+  mul_v3_v3fl(correction_vector_half, correction_vector, 0.5f);
+
+  const float mask_v1 = (1.0f - SCULPT_vertex_mask_get(ss, v1)) *
+                        SCULPT_automasking_factor_get(automasking, ss, v1);
+  const float mask_v2 = (1.0f - SCULPT_vertex_mask_get(ss, v2)) *
+                        SCULPT_automasking_factor_get(automasking, ss, v2);
+
+  const float sim_factor_v1 = ss->cache ?
+                                  cloth_brush_simulation_falloff_get(brush,
+                                                                     ss->cache->radius,
+                                                                     sim_location,
+                                                                     cloth_sim->init_pos[v1]) :
+                                  1.0f;
+  const float sim_factor_v2 = ss->cache ?
+                                  cloth_brush_simulation_falloff_get(brush,
+                                                                     ss->cache->radius,
+                                                                     sim_location,
+                                                                     cloth_sim->init_pos[v2]) :
+                                  1.0f;
+
+  float deformation_strength = 1.0f;
+  if (constraint->type == SCULPT_CLOTH_CONSTRAINT_DEFORMATION) {
+    deformation_strength = (cloth_sim->deformation_strength[v1] +
+                            cloth_sim->deformation_strength[v2]) *
+                           0.5f;
+  }
+
+  if (constraint->type == SCULPT_CLOTH_CONSTRAINT_SOFTBODY) {
+    const float softbody_plasticity = brush ? brush->cloth_constraint_softbody_strength : 0.0f;
+    madd_v3_v3fl(cloth_sim->pos[v1],
+                 correction_vector_half,
+                 1.0f * mask_v1 * sim_factor_v1 * constraint->strength * softbody_plasticity);
+    madd_v3_v3fl(cloth_sim->softbody_pos[v1],
+                 correction_vector_half,
+                 -1.0f * mask_v1 * sim_factor_v1 * constraint->strength *
+                     (1.0f - softbody_plasticity));
+  }
+  else {
+    madd_v3_v3fl(cloth_sim->pos[v1],
+                 correction_vector_half,
+                 1.0f * mask_v1 * sim_factor_v1 * constraint->strength * deformation_strength);
+    if (v1 != v2) {
+      madd_v3_v3fl(cloth_sim->pos[v2],
+                   correction_vector_half,
+                   -1.0f * mask_v2 * sim_factor_v2 * constraint->strength * deformation_strength);
+    }
+  }
+}
+
+static void cloth_brush_solve_constraints_task_cb(void *__restrict userdata,
+                                                  const int i,
+                                                  const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ClothConstraintsSolveData *data = userdata;
+  SculptClothSimulation *cloth_sim = data->cloth_sim;
+  cloth_brush_solve_constraint(data->ss,
+                               data->brush,
+                               cloth_sim,
+                               data->automasking,
+                               data->sim_location,
+                               &cloth_sim->length_constraints[data->constraint_indices[i]]);
+}
+
+static void cloth_brush_satisfy_constraints(SculptSession *ss,
+                                            Brush *brush,
+                                            SculptClothSimulation *cloth_sim)
+{
+  cloth_brush_constraints_color(ss, cloth_sim);
+
+  ClothConstraintsSolveData data = {
+      .ss = ss,
+      .brush = brush,
+      .cloth_sim = cloth_sim,
+      .automasking = SCULPT_automasking_active_cache_get(ss),
+  };
+  cloth_brush_simulation_location_get(ss, brush, data.sim_location);
+
+  const int *offset = cloth_sim->constraint_color_offset;
+
+  for (int constraint_it = 0; constraint_it < CLOTH_SIMULATION_ITERATIONS; constraint_it++) {
+    for (int color = 0; color < SCULPT_CLOTH_CONSTRAINT_COLORS; color++) {
+      const int color_len = offset[color + 1] - offset[color];
+      if (color_len == 0) {
+        continue;
       }
+      data.constraint_indices = &cloth_sim->constraint_color_order[offset[color]];
+
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      settings.use_threading = color_len > CLOTH_SOLVER_PARALLEL_MIN_CONSTRAINTS;
+      settings.min_iter_per_thread = CLOTH_SOLVER_PARALLEL_MIN_CONSTRAINTS;
+      BLI_task_parallel_range(
+          0, color_len, &data, cloth_brush_solve_constraints_task_cb, &settings);
+    }
+
+    /* Constraints that didn't fit in any color share vertices, solve them serially. */
+    for (int i = offset[SCULPT_CLOTH_CONSTRAINT_COLORS];
+         i < offset[SCULPT_CLOTH_CONSTRAINT_COLORS + 1];
+         i++) {
+      cloth_brush_solve_constraint(
+          ss,
+          brush,
+          cloth_sim,
+          data.automasking,
+          data.sim_location,
+          &cloth_sim->length_constraints[cloth_sim->constraint_color_order[i]]);
     }
   }
 }
@@ -1262,6 +1375,7 @@ void SCULPT_cloth_simulation_free(struct SculptClothSimulation *cloth_sim)
   MEM_SAFE_FREE(cloth_sim->acceleration);
   MEM_SAFE_FREE(cloth_sim->length_constraints);
   MEM_SAFE_FREE(cloth_sim->length_constraint_tweak);
+  MEM_SAFE_FREE(cloth_sim->constraint_color_order);
   MEM_SAFE_FREE(cloth_sim->deformation_pos);
   MEM_SAFE_FREE(cloth_sim->softbody_pos);
   MEM_SAFE_FREE(cloth_sim->init_pos);
@@ -848,6 +848,39 @@ float SCULPT_brush_strength_factor(struct SculptSession *ss,
                                    const int vertex_index,
                                    const int thread_id);
 
+/* Vertices of a PBVH node gathered to compute their brush strength factors at once. */
+typedef struct SculptBrushBatch {
+  int len;
+  int capacity;
+
+  struct MVert **mvert;
+  float (*co)[3];
+  float (*no)[3];
+  float *len_to_brush;
+  float *mask;
+  int *vertex_index;
+  /* Index of the vertex in the node, used for proxies. */
+  int *proxy_index;
+
+  /* Result of #SCULPT_brush_batch_strength_factors. */
+  float *factor;
+} SculptBrushBatch;
+
+void SCULPT_brush_batch_init(SculptBrushBatch *batch, struct PBVH *pbvh, struct PBVHNode *node);
+void SCULPT_brush_batch_add(SculptBrushBatch *batch,
+                            const struct PBVHVertexIter *vd,
+                            const float co[3],
+                            const float len,
+                            const short vno[3],
+                            const float fno[3]);
+/* Same as #SCULPT_brush_strength_factor for every vertex in the batch. */
+void SCULPT_brush_batch_strength_factors(struct SculptSession *ss,
+                                         const struct Brush *br,
+                                         SculptBrushBatch *batch,
+                                         const int thread_id);
+void SCULPT_brush_batch_tag_update(const SculptBrushBatch *batch);
+void SCULPT_brush_batch_free(SculptBrushBatch *batch);
+
 /* Tilts a normal by the x and y tilt values using the view axis. */
 void SCULPT_tilt_apply_to_normal(float r_normal[3],
                                  struct StrokeCache *cache,
@@ -45,6 +45,7 @@
 #include "BKE_customdata.h"
 #include "BKE_global.h"
 #include "BKE_key.h"
+#include "BKE_lib_id.h"
 #include "BKE_main.h"
 #include "BKE_mesh.h"
 #include "BKE_multires.h"
@@ -107,7 +108,10 @@
  * does modifications on it.
  *
  * End of dynamic topology and symmetrize in this mode are handled in a special
- * manner as well. */
+ * manner as well.
+ *
+ * Once the step is finished, COORDS nodes of regular meshes are compacted to only
+ * keep the vertices whose coordinates were actually changed by the operation. */
 
 typedef struct UndoSculpt {
   ListBase nodes;
@@ -1402,6 +1406,105 @@ void SCULPT_undo_push_begin(Object *ob, const char *name)
   BKE_undosys_step_push_init_with_type(ustack, C, name, BKE_UNDOSYS_TYPE_SCULPT);
 }
 
+typedef struct SculptUndoCompactData {
+  SculptSession *ss;
+  SculptUndoNode **nodes;
+  size_t *freed_size;
+} SculptUndoCompactData;
+
+static void sculpt_undo_compact_coords_task_cb(void *__restrict userdata,
+                                               const int n,
+                                               const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SculptUndoCompactData *data = userdata;
+  SculptUndoNode *unode = data->nodes[n];
+  const size_t alloc_size = MEM_allocN_len(unode->co) + MEM_allocN_len(unode->index);
+
+  /* Only unique vertices are restored, shared ones are dropped as well since the node owning
+   * them stores them too. */
+  int totvert = 0;
+  for (int i = 0; i < unode->totvert; i++) {
+    const float *co = SCULPT_vertex_co_get(data->ss, unode->index[i]);
+    /* No need for float comparison here (memory is exactly equal or not). */
+    if (memcmp(unode->co[i], co, sizeof(float[3])) != 0) {
+      copy_v3_v3(unode->co[totvert], unode->co[i]);
+      unode->index[totvert] = unode->index[i];
+      totvert++;
+    }
+  }
+
+  unode->totvert = totvert;
+  if (totvert == 0) {
+    MEM_freeN(unode->co);
+    MEM_freeN(unode->index);
+    unode->co = NULL;
+    unode->index = NULL;
+    data->freed_size[n] = alloc_size;
+    return;
+  }
+
+  unode->co = MEM_reallocN(unode->co, sizeof(*unode->co) * (size_t)totvert);
+  unode->index = MEM_reallocN(unode->index, sizeof(*unode->index) * (size_t)totvert);
+  data->freed_size[n] = alloc_size - MEM_allocN_len(unode->co) - MEM_allocN_len(unode->index);
+}
+
+/* Drop unchanged vertices from the COORDS nodes of the step, brushes push entire PBVH nodes
+ * while usually only modifying part of them. Nodes with deformed original coordinates or
+ * multires grids are restored by position in the node and are kept as is. */
+static void sculpt_undo_compact_coords(UndoSculpt *usculpt)
+{
+  SculptUndoNode *first_unode = usculpt->nodes.first;
+  if (first_unode == NULL) {
+    return;
+  }
+
+  Object *ob = (Object *)BKE_libblock_find_name(G_MAIN, ID_OB, first_unode->idname + 2);
+  if (ob == NULL || ob->sculpt == NULL || ob->sculpt->pbvh == NULL) {
+    return;
+  }
+  SculptSession *ss = ob->sculpt;
+  if (BKE_pbvh_type(ss->pbvh) != PBVH_FACES) {
+    return;
+  }
+
+  int totnode = 0;
+  LISTBASE_FOREACH (SculptUndoNode *, unode, &usculpt->nodes) {
+    if (unode->type == SCULPT_UNDO_COORDS && unode->co && unode->orig_co == NULL &&
+        unode->maxvert == ss->totvert && STREQ(unode->idname, ob->id.name)) {
+      totnode++;
+    }
+  }
+  if (totnode == 0) {
+    return;
+  }
+
+  SculptUndoNode **nodes = MEM_malloc_arrayN(totnode, sizeof(*nodes), __func__);
+  size_t *freed_size = MEM_calloc_arrayN(totnode, sizeof(*freed_size), __func__);
+  int n = 0;
+  LISTBASE_FOREACH (SculptUndoNode *, unode, &usculpt->nodes) {
+    if (unode->type == SCULPT_UNDO_COORDS && unode->co && unode->orig_co == NULL &&
+        unode->maxvert == ss->totvert && STREQ(unode->idname, ob->id.name)) {
+      nodes[n++] = unode;
+    }
+  }
+
+  SculptUndoCompactData data = {
+      .ss = ss,
+      .nodes = nodes,
+      .freed_size = freed_size,
+  };
+  TaskParallelSettings settings;
+  BKE_pbvh_parallel_range_settings(&settings, true, totnode);
+  BLI_task_parallel_range(0, totnode, &data, sculpt_undo_compact_coords_task_cb, &settings);
+
+  for (int i = 0; i < totnode; i++) {
+    usculpt->undo_size -= freed_size[i];
+  }
+
+  MEM_freeN(nodes);
+  MEM_freeN(freed_size);
+}
+
 void SCULPT_undo_push_end(void)
 {
   SCULPT_undo_push_end_ex(false);
@@ -1421,6 +1524,8 @@ void SCULPT_undo_push_end_ex(const bool use_nested_undo)
     }
   }
 
+  sculpt_undo_compact_coords(usculpt);
+
   /* We could remove this and enforce all callers run in an operator using 'OPTYPE_UNDO'. */
   wmWindowManager *wm = G_MAIN->wm.first;
   if (wm->op_undo_depth == 0 || use_nested_undo) {
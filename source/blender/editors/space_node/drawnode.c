@@ -3654,6 +3654,15 @@ bool node_link_bezier_handles(const View2D *v2d,
   if (v2d && max_ffff(vec[0][0], vec[1][0], vec[2][0], vec[3][0]) < v2d->cur.xmin) {
     return false; /* clipped */
   }
+  /* The curve stays inside the bounds of its control points, pad for the line width. */
+  if (v2d &&
+      min_ffff(vec[0][1], vec[1][1], vec[2][1], vec[3][1]) > v2d->cur.ymax + NODE_SOCKSIZE) {
+    return false; /* clipped */
+  }
+  if (v2d &&
+      max_ffff(vec[0][1], vec[1][1], vec[2][1], vec[3][1]) < v2d->cur.ymin - NODE_SOCKSIZE) {
+    return false; /* clipped */
+  }
 
   return true;
 }
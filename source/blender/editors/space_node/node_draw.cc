@@ -1533,6 +1533,14 @@ static void node_draw_hidden(const bContext *C,
                              bNodeInstanceKey UNUSED(key))
 {
   rctf *rct = &node->totr;
+
+  /* Skip if out of view. */
+  if (BLI_rctf_isect(rct, &v2d->cur, nullptr) == false) {
+    UI_block_end(C, node->block);
+    node->block = nullptr;
+    return;
+  }
+
   float centy = BLI_rctf_cent_y(rct);
   float hiddenrad = BLI_rctf_size_y(rct) / 2.0f;
 
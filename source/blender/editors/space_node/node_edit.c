@@ -41,6 +41,7 @@
 #include "BKE_node.h"
 #include "BKE_report.h"
 #include "BKE_scene.h"
+#include "BKE_screen.h"
 
 #include "DEG_depsgraph.h"
 #include "DEG_depsgraph_build.h"
@@ -314,6 +315,50 @@ static void compo_startjob(void *cjv,
   ntree->progress = NULL;
 }
 
+/**
+ * Part of the viewer image visible in the node editor backdrops, see
+ * #bNodeTree.viewer_visible_border. Stays empty when an image editor shows the viewer image too
+ * or no backdrop is drawn, the whole image is calculated then.
+ */
+static void compo_viewer_visible_border(const bContext *C, rctf *r_border)
+{
+  wmWindowManager *wm = CTX_wm_manager(C);
+  bool is_first = true;
+
+  BLI_rctf_init(r_border, 0.0f, 0.0f, 0.0f, 0.0f);
+
+  LISTBASE_FOREACH (wmWindow *, win, &wm->windows) {
+    bScreen *screen = WM_window_get_active_screen(win);
+    LISTBASE_FOREACH (ScrArea *, area, &screen->areabase) {
+      SpaceLink *sl = area->spacedata.first;
+      if (sl->spacetype == SPACE_IMAGE) {
+        SpaceImage *sima = (SpaceImage *)sl;
+        if (sima->image && sima->image->type == IMA_TYPE_COMPOSITE) {
+          BLI_rctf_init(r_border, 0.0f, 0.0f, 0.0f, 0.0f);
+          return;
+        }
+      }
+      else if (sl->spacetype == SPACE_NODE) {
+        SpaceNode *snode = (SpaceNode *)sl;
+        ARegion *region = BKE_area_find_region_type(area, RGN_TYPE_WINDOW);
+        if (!(snode->flag & SNODE_BACKDRAW) || !ED_node_is_compositor(snode) || !region ||
+            snode->zoom <= 0.0f) {
+          continue;
+        }
+        rctf visible;
+        node_backdrop_visible_border(snode, region, &visible);
+        if (is_first) {
+          *r_border = visible;
+          is_first = false;
+        }
+        else {
+          BLI_rctf_union(r_border, &visible);
+        }
+      }
+    }
+  }
+}
+
 /**
  * \param scene_owner: is the owner of the job,
  * we don't use it for anything else currently so could also be a void pointer,
@@ -354,6 +399,10 @@ void ED_node_composite_job(const bContext *C, struct bNodeTree *nodetree, Scene
   cj->ntree = nodetree;
   cj->recalc_flags = compo_get_recalc_flags(C);
 
+  /* Copied to the localized tree, also used to detect when panning shows parts that weren't
+   * calculated. */
+  compo_viewer_visible_border(C, &nodetree->viewer_visible_border);
+
   /* setup job */
   WM_jobs_customdata_set(wm_job, cj, compo_freejob);
   WM_jobs_timer(wm_job, 0.1, NC_SCENE | ND_COMPO_RESULT, NC_SCENE | ND_COMPO_RESULT);
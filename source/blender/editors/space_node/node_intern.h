@@ -161,6 +161,10 @@ int space_node_view_flag(struct bContext *C,
                          const int node_flag,
                          const int smooth_viewtx);
 
+void node_backdrop_visible_border(const struct SpaceNode *snode,
+                                  const struct ARegion *region,
+                                  rctf *r_border);
+
 void NODE_OT_view_all(struct wmOperatorType *ot);
 void NODE_OT_view_selected(struct wmOperatorType *ot);
 
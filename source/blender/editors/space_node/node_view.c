@@ -191,6 +191,36 @@ void NODE_OT_view_selected(wmOperatorType *ot)
 /** \name Background Image Operators
  * \{ */
 
+/**
+ * Part of the viewer image visible in the backdrop of \a region, in pixels relative to the image
+ * center (see #bNodeTree.viewer_visible_border).
+ */
+void node_backdrop_visible_border(const SpaceNode *snode, const ARegion *region, rctf *r_border)
+{
+  r_border->xmin = (-0.5f * region->winx - snode->xof) / snode->zoom;
+  r_border->xmax = (0.5f * region->winx - snode->xof) / snode->zoom;
+  r_border->ymin = (-0.5f * region->winy - snode->yof) / snode->zoom;
+  r_border->ymax = (0.5f * region->winy - snode->yof) / snode->zoom;
+}
+
+/**
+ * Only the visible part of the viewer image is calculated, composite again when moving or
+ * zooming the backdrop shows parts that weren't calculated.
+ */
+static void snode_bg_view_changed(bContext *C, SpaceNode *snode, ARegion *region)
+{
+  const rctf *calculated = &snode->nodetree->viewer_visible_border;
+  if (BLI_rctf_is_empty(calculated) || snode->zoom <= 0.0f) {
+    return;
+  }
+
+  rctf visible;
+  node_backdrop_visible_border(snode, region, &visible);
+  if (!BLI_rctf_inside_rctf(calculated, &visible)) {
+    ED_area_tag_refresh(CTX_wm_area(C));
+  }
+}
+
 typedef struct NodeViewMove {
   int mvalo[2];
   int xmin, ymin, xmax, ymax;
@@ -226,6 +256,7 @@ static int snode_bg_viewmove_modal(bContext *C, wmOperator *op, const wmEvent *e
       if (event->val == KM_RELEASE) {
         MEM_freeN(nvm);
         op->customdata = NULL;
+        snode_bg_view_changed(C, snode, region);
         return OPERATOR_FINISHED;
       }
       break;
@@ -311,6 +342,7 @@ static int backimage_zoom_exec(bContext *C, wmOperator *op)
   ED_region_tag_redraw(region);
   WM_main_add_notifier(NC_NODE | ND_DISPLAY, NULL);
   WM_main_add_notifier(NC_SPACE | ND_SPACE_NODE_VIEW, NULL);
+  snode_bg_view_changed(C, snode, region);
 
   return OPERATOR_FINISHED;
 }
@@ -376,6 +408,7 @@ static int backimage_fit_exec(bContext *C, wmOperator *UNUSED(op))
   ED_region_tag_redraw(region);
   WM_main_add_notifier(NC_NODE | ND_DISPLAY, NULL);
   WM_main_add_notifier(NC_SPACE | ND_SPACE_NODE_VIEW, NULL);
+  snode_bg_view_changed(C, snode, region);
 
   return OPERATOR_FINISHED;
 }
@@ -190,6 +190,9 @@ void outliner_item_openclose(SpaceOutliner *space_outliner,
   }
 
   if (toggle_all) {
+    if (open) {
+      outliner_lazy_contents_build(space_outliner, &te->subtree);
+    }
     outliner_flag_set(&te->subtree, TSE_CLOSED, !open);
   }
 }
@@ -1153,6 +1156,7 @@ static int outliner_toggle_expanded_exec(bContext *C, wmOperator *UNUSED(op))
   ARegion *region = CTX_wm_region(C);
 
   if (outliner_flag_is_any_test(&space_outliner->tree, TSE_CLOSED, 1)) {
+    outliner_lazy_contents_build(space_outliner, &space_outliner->tree);
     outliner_flag_set(&space_outliner->tree, TSE_CLOSED, 0);
   }
   else {
@@ -1370,7 +1374,7 @@ static int outliner_show_active_exec(bContext *C, wmOperator *UNUSED(op))
     return OPERATOR_CANCELLED;
   }
 
-  ED_region_tag_redraw_no_rebuild(region);
+  outliner_tag_redraw_avoid_rebuild_on_open_change(space_outliner, region);
 
   return OPERATOR_FINISHED;
 }
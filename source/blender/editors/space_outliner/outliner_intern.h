@@ -158,6 +158,9 @@ enum {
   /* Child elements of the same type in the icon-row are drawn merged as one icon.
    * This flag is set for an element that is part of these merged child icons. */
   TE_ICONROW_MERGED = (1 << 7),
+  /* Object contents were not built because the parent is collapsed, the element isn't drawn.
+   * See #outliner_lazy_contents_build(). */
+  TE_LAZY_CONTENTS = (1 << 8),
 };
 
 /* button events */
@@ -261,6 +264,7 @@ void outliner_build_tree(struct Main *mainvar,
 bool outliner_requires_rebuild_on_select_or_active_change(
     const struct SpaceOutliner *space_outliner);
 bool outliner_requires_rebuild_on_open_change(const struct SpaceOutliner *space_outliner);
+void outliner_lazy_contents_build(struct SpaceOutliner *space_outliner, ListBase *lb);
 
 typedef struct IDsSelectedData {
   struct ListBase selected_array;
@@ -252,7 +252,23 @@ bool outliner_requires_rebuild_on_select_or_active_change(const SpaceOutliner *s
  */
 bool outliner_requires_rebuild_on_open_change(const SpaceOutliner *space_outliner)
 {
-  return ELEM(space_outliner->outlinevis, SO_DATA_API);
+  return ELEM(space_outliner->outlinevis, SO_DATA_API, SO_VIEW_LAYER, SO_SCENES);
+}
+
+/**
+ * Contents of objects under a collapsed parent are only drawn once the parent is opened, which
+ * rebuilds the tree. Skip them, for scenes with many objects most of them are collapsed.
+ * Objects in pose or edit mode are always expanded, bone selection is synced to their elements.
+ */
+static bool outliner_object_contents_is_lazy(SpaceOutliner *space_outliner,
+                                             TreeElement *te,
+                                             Object *ob)
+{
+  if ((te->parent == NULL) || (ob->mode != OB_MODE_OBJECT) ||
+      !outliner_requires_rebuild_on_open_change(space_outliner)) {
+    return false;
+  }
+  return !TSELEM_OPEN(TREESTORE(te->parent), space_outliner);
 }
 
 /* special handling of hierarchical non-lib data */
@@ -676,7 +692,12 @@ static void outliner_add_id_contents(SpaceOutliner *space_outliner,
       break;
     }
     case ID_OB: {
-      outliner_add_object_contents(space_outliner, te, tselem, (Object *)id);
+      if (outliner_object_contents_is_lazy(space_outliner, te, (Object *)id)) {
+        te->flag |= TE_LAZY_CONTENTS;
+      }
+      else {
+        outliner_add_object_contents(space_outliner, te, tselem, (Object *)id);
+      }
       break;
     }
     case ID_ME: {
@@ -914,6 +935,25 @@ static void outliner_add_id_contents(SpaceOutliner *space_outliner,
   }
 }
 
+/**
+ * Build the object contents skipped by #outliner_object_contents_is_lazy(), recursively.
+ * Needed before changing the open state of a whole sub-tree, so the state is stored for the
+ * children that only appear after the rebuild.
+ */
+void outliner_lazy_contents_build(SpaceOutliner *space_outliner, ListBase *lb)
+{
+  LISTBASE_FOREACH (TreeElement *, te, lb) {
+    if (te->flag & TE_LAZY_CONTENTS) {
+      te->flag &= ~TE_LAZY_CONTENTS;
+      if ((te->flag & TE_CHILD_NOT_IN_COLLECTION) == 0) {
+        TreeStoreElem *tselem = TREESTORE(te);
+        outliner_add_object_contents(space_outliner, te, tselem, (Object *)tselem->id);
+      }
+    }
+    outliner_lazy_contents_build(space_outliner, &te->subtree);
+  }
+}
+
 /**
  * TODO: this function needs to be split up! It's getting a bit too large...
  *
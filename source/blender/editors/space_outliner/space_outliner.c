@@ -155,6 +155,9 @@ static void outliner_main_region_listener(const wmRegionListenerParams *params)
     case NC_OBJECT:
       switch (wmn->data) {
         case ND_TRANSFORM:
+          /* Sent on every step of interactive transform, nothing in the tree depends on it. */
+          ED_region_tag_redraw_no_rebuild(region);
+          break;
         case ND_BONE_ACTIVE:
         case ND_BONE_SELECT:
         case ND_DRAW:
@@ -1648,6 +1648,30 @@ static void sequencer_preview_get_rect(rctf *preview,
   }
 }
 
+/**
+ * The preview texture is kept in the space and updated in place, instead of creating a texture
+ * for every displayed frame during playback.
+ */
+static GPUTexture *sequencer_display_texture_ensure(SpaceSeq *sseq,
+                                                   int width,
+                                                   int height,
+                                                   eGPUTextureFormat format)
+{
+  GPUTexture *texture = sseq->display_texture;
+
+  if (texture && (GPU_texture_width(texture) != width || GPU_texture_height(texture) != height ||
+                  GPU_texture_format(texture) != format)) {
+    GPU_texture_free(texture);
+    texture = NULL;
+  }
+  if (texture == NULL) {
+    texture = GPU_texture_create_2d("seq_display_buf", width, height, 1, format, NULL);
+    GPU_texture_filter_mode(texture, false);
+    sseq->display_texture = texture;
+  }
+  return texture;
+}
+
 static void sequencer_draw_display_buffer(const bContext *C,
                                           Scene *scene,
                                           ARegion *region,
@@ -1695,10 +1719,8 @@ static void sequencer_draw_display_buffer(const bContext *C,
     GPU_matrix_identity_projection_set();
   }
 
-  GPUTexture *texture = GPU_texture_create_2d(
-      "seq_display_buf", ibuf->x, ibuf->y, 1, format, NULL);
+  GPUTexture *texture = sequencer_display_texture_ensure(sseq, ibuf->x, ibuf->y, format);
   GPU_texture_update(texture, data, display_buffer);
-  GPU_texture_filter_mode(texture, false);
 
   GPU_texture_bind(texture, 0);
 
@@ -1736,7 +1758,6 @@ static void sequencer_draw_display_buffer(const bContext *C,
   immEnd();
 
   GPU_texture_unbind(texture);
-  GPU_texture_free(texture);
 
   if (!glsl_used) {
     immUnbindProgram();
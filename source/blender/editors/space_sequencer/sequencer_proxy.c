@@ -74,18 +74,12 @@ static void proxy_freejob(void *pjv)
 static void proxy_startjob(void *pjv, short *stop, short *do_update, float *progress)
 {
   ProxyJob *pj = pjv;
-  LinkData *link;
-
-  for (link = pj->queue.first; link; link = link->next) {
-    struct SeqIndexBuildContext *context = link->data;
 
-    SEQ_proxy_rebuild(context, stop, do_update, progress);
+  SEQ_proxy_rebuild_queue(&pj->queue, stop, do_update, progress);
 
-    if (*stop) {
-      pj->stop = 1;
-      fprintf(stderr, "Canceling proxy rebuild on users request...\n");
-      break;
-    }
+  if (*stop) {
+    pj->stop = 1;
+    fprintf(stderr, "Canceling proxy rebuild on users request...\n");
   }
 }
 
@@ -210,27 +204,27 @@ static int sequencer_rebuild_proxy_exec(bContext *C, wmOperator *UNUSED(op))
     return OPERATOR_CANCELLED;
   }
 
+  ListBase queue = {NULL, NULL};
+  short stop = 0, do_update;
+  float progress;
+
   file_list = BLI_gset_new(BLI_ghashutil_strhash_p, BLI_ghashutil_strcmp, "file list");
 
   SEQ_CURRENT_BEGIN (ed, seq) {
     if ((seq->flag & SELECT)) {
-      ListBase queue = {NULL, NULL};
-      LinkData *link;
-      short stop = 0, do_update;
-      float progress;
-
       SEQ_proxy_rebuild_context(bmain, depsgraph, scene, seq, file_list, &queue);
-
-      for (link = queue.first; link; link = link->next) {
-        struct SeqIndexBuildContext *context = link->data;
-        SEQ_proxy_rebuild(context, &stop, &do_update, &progress);
-        SEQ_proxy_rebuild_finish(context, 0);
-      }
-      SEQ_relations_free_imbuf(scene, &ed->seqbase, false);
     }
   }
   SEQ_CURRENT_END;
 
+  SEQ_proxy_rebuild_queue(&queue, &stop, &do_update, &progress);
+
+  LISTBASE_FOREACH (LinkData *, link, &queue) {
+    SEQ_proxy_rebuild_finish(link->data, 0);
+  }
+  BLI_freelistN(&queue);
+  SEQ_relations_free_imbuf(scene, &ed->seqbase, false);
+
   BLI_gset_free(file_list, MEM_freeN);
 
   return OPERATOR_FINISHED;
@@ -45,6 +45,8 @@
 #include "ED_view3d.h"
 #include "ED_view3d_offscreen.h" /* Only for sequencer view3d drawing callback. */
 
+#include "GPU_texture.h"
+
 #include "WM_api.h"
 #include "WM_message.h"
 #include "WM_types.h"
@@ -215,6 +217,10 @@ static void sequencer_free(SpaceLink *sl)
   if (scopes->histogram_ibuf) {
     IMB_freeImBuf(scopes->histogram_ibuf);
   }
+
+  if (sseq->display_texture) {
+    GPU_texture_free(sseq->display_texture);
+  }
 }
 
 /* Spacetype init callback. */
@@ -329,6 +335,7 @@ static SpaceLink *sequencer_duplicate(SpaceLink *sl)
   /* XXX  sseq->gpd = gpencil_data_duplicate(sseq->gpd, false); */
 
   memset(&sseqn->scopes, 0, sizeof(sseqn->scopes));
+  sseqn->display_texture = NULL;
 
   return (SpaceLink *)sseqn;
 }
@@ -30,6 +30,7 @@
 #include "BLI_linklist_stack.h"
 #include "BLI_math.h"
 #include "BLI_memarena.h"
+#include "BLI_task.h"
 
 #include "BKE_context.h"
 #include "BKE_crazyspace.h"
@@ -256,7 +257,7 @@ static bool bmesh_test_dist_add(BMVert *v0,
                                 float *dists,
                                 /* optionally track original index */
                                 int *index,
-                                const float mtx[3][3])
+                                const float (*vcos)[3])
 {
   if ((BM_elem_flag_test(v0, BM_ELEM_SELECT) == 0) &&
       (BM_elem_flag_test(v0, BM_ELEM_HIDDEN) == 0)) {
@@ -278,20 +279,12 @@ static bool bmesh_test_dist_add(BMVert *v0,
         return false;
       }
 
-      float vm0[3], vm1[3], vm2[3];
-      mul_v3_m3v3(vm0, mtx, v0->co);
-      mul_v3_m3v3(vm1, mtx, v1->co);
-      mul_v3_m3v3(vm2, mtx, v2->co);
-
-      dist0 = geodesic_distance_propagate_across_triangle(vm0, vm1, vm2, dists[i1], dists[i2]);
+      dist0 = geodesic_distance_propagate_across_triangle(
+          vcos[i0], vcos[i1], vcos[i2], dists[i1], dists[i2]);
     }
     else {
       /* Distance along edge. */
-      float vec[3];
-      sub_v3_v3v3(vec, v1->co, v0->co);
-      mul_m3_v3(mtx, vec);
-
-      dist0 = dists[i1] + len_v3(vec);
+      dist0 = dists[i1] + len_v3v3(vcos[i1], vcos[i0]);
     }
 
     if (dist0 < dists[i0]) {
@@ -345,6 +338,9 @@ void transform_convert_mesh_connectivity_distance(struct BMesh *bm,
   BLI_LINKSTACK_INIT(queue);
   BLI_LINKSTACK_INIT(queue_next);
 
+  /* Coordinates in measuring space, computed once instead of at every propagation step. */
+  float(*vcos)[3] = MEM_mallocN(sizeof(*vcos) * bm->totvert, __func__);
+
   {
     /* Set indexes and initial distances for selected vertices. */
     BMIter viter;
@@ -354,6 +350,7 @@ void transform_convert_mesh_connectivity_distance(struct BMesh *bm,
     BM_ITER_MESH_INDEX (v, &viter, bm, BM_VERTS_OF_MESH, i) {
       float dist;
       BM_elem_index_set(v, i); /* set_inline */
+      mul_v3_m3v3(vcos[i], mtx, v->co);
 
       if (BM_elem_flag_test(v, BM_ELEM_SELECT) == 0 || BM_elem_flag_test(v, BM_ELEM_HIDDEN)) {
         dist = FLT_MAX;
@@ -408,7 +405,7 @@ void transform_convert_mesh_connectivity_distance(struct BMesh *bm,
           SWAP(BMVert *, v1, v2);
         }
 
-        if (bmesh_test_dist_add(v2, v1, NULL, dists, index, mtx)) {
+        if (bmesh_test_dist_add(v2, v1, NULL, dists, index, vcos)) {
           /* Add adjacent loose edges to the queue, or all edges if this is a loose edge.
            * Other edges are handled by propagation across edges below. */
           BMEdge *e_other;
@@ -432,7 +429,7 @@ void transform_convert_mesh_connectivity_distance(struct BMesh *bm,
             BMVert *v_other = l_other->v;
             BLI_assert(!ELEM(v_other, v1, v2));
 
-            if (bmesh_test_dist_add(v_other, v1, v2, dists, index, mtx)) {
+            if (bmesh_test_dist_add(v_other, v1, v2, dists, index, vcos)) {
               /* Add adjacent edges to the queue, if they are ready to propagate across/along.
                * Always propagate along loose edges, and for other edges only propagate across
                * if both vertices have a known distances. */
@@ -467,6 +464,8 @@ void transform_convert_mesh_connectivity_distance(struct BMesh *bm,
 
   BLI_LINKSTACK_FREE(queue);
   BLI_LINKSTACK_FREE(queue_next);
+
+  MEM_freeN(vcos);
 }
 
 /** \} */
@@ -792,10 +791,121 @@ static void VertsToTransData(TransInfo *t,
   }
 }
 
+/* Vertex slots in #TransDataContainer.data_mirror are stored as negative values. */
+#define TRANS_VERT_SLOT_MIRROR(index) (-2 - (index))
+
+struct TransEditVertsCreateData {
+  TransInfo *t;
+  TransDataContainer *tc;
+  BMEditMesh *em;
+  /** Index in `tc->data`, #TRANS_VERT_SLOT_MIRROR index in `tc->data_mirror` or -1. */
+  const int *vert_slot;
+  const struct TransIslandData *island_data;
+  struct TransMirrorData *mirror_data;
+  const struct TransMeshDataCrazySpace *crazyspace_data;
+  const float *dists;
+  const int *dists_index;
+  float mtx[3][3], smtx[3][3];
+  int prop_mode;
+  int cd_vert_bweight_offset;
+};
+
+static void trans_edit_verts_create_cb(void *__restrict userdata,
+                                       const int a,
+                                       const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const struct TransEditVertsCreateData *data = userdata;
+  const int slot = data->vert_slot[a];
+  if (slot == -1) {
+    return;
+  }
+
+  TransInfo *t = data->t;
+  TransDataContainer *tc = data->tc;
+  BMesh *bm = data->em->bm;
+  BMVert *eve = BM_vert_at_index(bm, a);
+  const struct TransIslandData *island_data = data->island_data;
+  struct TransMirrorData *mirror_data = data->mirror_data;
+  const struct TransMeshDataCrazySpace *crazyspace_data = data->crazyspace_data;
+  const int prop_mode = data->prop_mode;
+
+  int island_index = -1;
+  if (island_data->island_vert_map) {
+    const int connected_index = (data->dists_index && data->dists_index[a] != -1) ?
+                                    data->dists_index[a] :
+                                    a;
+    island_index = island_data->island_vert_map[connected_index];
+  }
+
+  if (slot < -1) {
+    TransDataMirror *td_mirror = &tc->data_mirror[TRANS_VERT_SLOT_MIRROR(slot)];
+    int elem_index = mirror_data->vert_map[a].index;
+    BMVert *v_src = BM_vert_at_index(bm, elem_index);
+
+    if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+      mirror_data->vert_map[a].flag |= TD_SELECTED;
+    }
+
+    td_mirror->extra = eve;
+    td_mirror->loc = eve->co;
+    copy_v3_v3(td_mirror->iloc, eve->co);
+    td_mirror->flag = mirror_data->vert_map[a].flag;
+    td_mirror->loc_src = v_src->co;
+    transdata_center_get(island_data, island_index, td_mirror->iloc, td_mirror->center);
+    return;
+  }
+
+  TransData *tob = &tc->data[slot];
+  TransDataExtension *tx = tc->data_ext ? &tc->data_ext[slot] : NULL;
+  float *bweight = (data->cd_vert_bweight_offset != -1) ?
+                       BM_ELEM_CD_GET_VOID_P(eve, data->cd_vert_bweight_offset) :
+                       NULL;
+
+  /* Do not use the island center in case we are using islands
+   * only to get axis for snap/rotate to normal... */
+  VertsToTransData(t, tob, tx, data->em, eve, bweight, island_data, island_index);
+
+  /* selected */
+  if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
+    tob->flag |= TD_SELECTED;
+  }
+
+  if (prop_mode) {
+    if (prop_mode & T_PROP_CONNECTED) {
+      tob->dist = data->dists[a];
+    }
+    else {
+      tob->flag |= TD_NOTCONNECTED;
+      tob->dist = FLT_MAX;
+    }
+  }
+
+  /* CrazySpace */
+  transform_convert_mesh_crazyspace_transdata_set(
+      data->mtx,
+      data->smtx,
+      crazyspace_data->defmats ? crazyspace_data->defmats[a] : NULL,
+      crazyspace_data->quats && BM_elem_flag_test(eve, BM_ELEM_TAG) ?
+          crazyspace_data->quats[a] :
+          NULL,
+      tob);
+
+  if (tc->use_mirror_axis_any) {
+    if (tc->use_mirror_axis_x && fabsf(tob->loc[0]) < TRANSFORM_MAXDIST_MIRROR) {
+      tob->flag |= TD_MIRROR_EDGE_X;
+    }
+    if (tc->use_mirror_axis_y && fabsf(tob->loc[1]) < TRANSFORM_MAXDIST_MIRROR) {
+      tob->flag |= TD_MIRROR_EDGE_Y;
+    }
+    if (tc->use_mirror_axis_z && fabsf(tob->loc[2]) < TRANSFORM_MAXDIST_MIRROR) {
+      tob->flag |= TD_MIRROR_EDGE_Z;
+    }
+  }
+}
+
 void createTransEditVerts(TransInfo *t)
 {
   FOREACH_TRANS_DATA_CONTAINER (t, tc) {
-    TransDataExtension *tx = NULL;
     BMEditMesh *em = BKE_editmesh_from_object(tc->obedit);
     Mesh *me = tc->obedit->data;
     BMesh *bm = em->bm;
@@ -918,8 +1028,7 @@ void createTransEditVerts(TransInfo *t)
        * but this stores loads of extra stuff, for TFM_SHRINKFATTEN its even more overkill
        * since we may not use the 'alt' transform mode to maintain shell thickness,
        * but with generic transform code its hard to lazy init vars */
-      tx = tc->data_ext = MEM_callocN(tc->data_len * sizeof(TransDataExtension),
-                                      "TransObData ext");
+      tc->data_ext = MEM_callocN(tc->data_len * sizeof(TransDataExtension), "TransObData ext");
     }
 
     int cd_vert_bweight_offset = -1;
@@ -928,88 +1037,52 @@ void createTransEditVerts(TransInfo *t)
       cd_vert_bweight_offset = CustomData_get_offset(&bm->vdata, CD_BWEIGHT);
     }
 
-    TransData *tob = tc->data;
-    TransDataMirror *td_mirror = tc->data_mirror;
+    /* Assign the slots sequentially so the data keeps the vertex order,
+     * then fill them in parallel. */
+    int *vert_slot = MEM_mallocN(sizeof(*vert_slot) * bm->totvert, __func__);
+    int td_len = 0, td_mirror_len = 0;
     BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, a) {
       if (BM_elem_flag_test(eve, BM_ELEM_HIDDEN)) {
-        continue;
+        vert_slot[a] = -1;
       }
-
-      int island_index = -1;
-      if (island_data.island_vert_map) {
-        const int connected_index = (dists_index && dists_index[a] != -1) ? dists_index[a] : a;
-        island_index = island_data.island_vert_map[connected_index];
-      }
-
-      if (mirror_data.vert_map && mirror_data.vert_map[a].index != -1) {
-        int elem_index = mirror_data.vert_map[a].index;
-        BMVert *v_src = BM_vert_at_index(bm, elem_index);
-
-        if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-          mirror_data.vert_map[a].flag |= TD_SELECTED;
-        }
-
-        td_mirror->extra = eve;
-        td_mirror->loc = eve->co;
-        copy_v3_v3(td_mirror->iloc, eve->co);
-        td_mirror->flag = mirror_data.vert_map[a].flag;
-        td_mirror->loc_src = v_src->co;
-        transdata_center_get(&island_data, island_index, td_mirror->iloc, td_mirror->center);
-
-        td_mirror++;
+      else if (mirror_data.vert_map && mirror_data.vert_map[a].index != -1) {
+        vert_slot[a] = TRANS_VERT_SLOT_MIRROR(td_mirror_len++);
       }
       else if (prop_mode || BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-        float *bweight = (cd_vert_bweight_offset != -1) ?
-                             BM_ELEM_CD_GET_VOID_P(eve, cd_vert_bweight_offset) :
-                             NULL;
-
-        /* Do not use the island center in case we are using islands
-         * only to get axis for snap/rotate to normal... */
-        VertsToTransData(t, tob, tx, em, eve, bweight, &island_data, island_index);
-        if (tx) {
-          tx++;
-        }
-
-        /* selected */
-        if (BM_elem_flag_test(eve, BM_ELEM_SELECT)) {
-          tob->flag |= TD_SELECTED;
-        }
-
-        if (prop_mode) {
-          if (prop_mode & T_PROP_CONNECTED) {
-            tob->dist = dists[a];
-          }
-          else {
-            tob->flag |= TD_NOTCONNECTED;
-            tob->dist = FLT_MAX;
-          }
-        }
-
-        /* CrazySpace */
-        transform_convert_mesh_crazyspace_transdata_set(
-            mtx,
-            smtx,
-            crazyspace_data.defmats ? crazyspace_data.defmats[a] : NULL,
-            crazyspace_data.quats && BM_elem_flag_test(eve, BM_ELEM_TAG) ?
-                crazyspace_data.quats[a] :
-                NULL,
-            tob);
-
-        if (tc->use_mirror_axis_any) {
-          if (tc->use_mirror_axis_x && fabsf(tob->loc[0]) < TRANSFORM_MAXDIST_MIRROR) {
-            tob->flag |= TD_MIRROR_EDGE_X;
-          }
-          if (tc->use_mirror_axis_y && fabsf(tob->loc[1]) < TRANSFORM_MAXDIST_MIRROR) {
-            tob->flag |= TD_MIRROR_EDGE_Y;
-          }
-          if (tc->use_mirror_axis_z && fabsf(tob->loc[2]) < TRANSFORM_MAXDIST_MIRROR) {
-            tob->flag |= TD_MIRROR_EDGE_Z;
-          }
-        }
-
-        tob++;
+        vert_slot[a] = td_len++;
+      }
+      else {
+        vert_slot[a] = -1;
       }
     }
+    BLI_assert(td_len == tc->data_len);
+    BLI_assert(td_mirror_len == tc->data_mirror_len);
+
+    BM_mesh_elem_table_ensure(bm, BM_VERT);
+
+    struct TransEditVertsCreateData create_data = {
+        .t = t,
+        .tc = tc,
+        .em = em,
+        .vert_slot = vert_slot,
+        .island_data = &island_data,
+        .mirror_data = &mirror_data,
+        .crazyspace_data = &crazyspace_data,
+        .dists = dists,
+        .dists_index = dists_index,
+        .prop_mode = prop_mode,
+        .cd_vert_bweight_offset = cd_vert_bweight_offset,
+    };
+    copy_m3_m3(create_data.mtx, mtx);
+    copy_m3_m3(create_data.smtx, smtx);
+
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.use_threading = (bm->totvert > 1024);
+    settings.min_iter_per_thread = 1024;
+    BLI_task_parallel_range(0, bm->totvert, &create_data, trans_edit_verts_create_cb, &settings);
+
+    MEM_freeN(vert_slot);
 
     transform_convert_mesh_islanddata_free(&island_data);
     transform_convert_mesh_mirrordata_free(&mirror_data);
@@ -1615,6 +1688,29 @@ static void mesh_apply_to_mirror(TransInfo *t)
   }
 }
 
+/**
+ * Let drawing update the faces around the transformed vertices only,
+ * custom-data correction changes loop data too, so everything is updated then.
+ */
+static void mesh_deform_tag(TransInfo *t, TransDataContainer *tc, BMEditMesh *em)
+{
+  if ((t->data_type != TC_MESH_VERTS) || (tc->custom.type.data != NULL)) {
+    BKE_editmesh_deform_tag_all(em);
+    return;
+  }
+
+  BM_mesh_elem_index_ensure(em->bm, BM_FACE);
+
+  TransData *td = tc->data;
+  for (int i = tc->data_len; i--; td++) {
+    BKE_editmesh_deform_tag_vert(em, td->extra);
+  }
+  TransDataMirror *td_mirror = tc->data_mirror;
+  for (int i = tc->data_mirror_len; i--; td_mirror++) {
+    BKE_editmesh_deform_tag_vert(em, td_mirror->extra);
+  }
+}
+
 void recalcData_mesh(TransInfo *t)
 {
   bool is_canceling = t->state == TRANS_CANCEL;
@@ -1637,6 +1733,7 @@ void recalcData_mesh(TransInfo *t)
   FOREACH_TRANS_DATA_CONTAINER (t, tc) {
     DEG_id_tag_update(tc->obedit->data, 0); /* sets recalc flags */
     BMEditMesh *em = BKE_editmesh_from_object(tc->obedit);
+    mesh_deform_tag(t, tc, em);
     EDBM_mesh_normals_update(em);
     BKE_editmesh_looptri_calc(em);
   }
@@ -28,6 +28,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_rand.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "uvedit_parametrizer.h"
@@ -4594,51 +4595,88 @@ void param_construct_end(ParamHandle *handle, ParamBool fill, ParamBool topology
   phandle->state = PHANDLE_STATE_CONSTRUCTED;
 }
 
-void param_lscm_begin(ParamHandle *handle, ParamBool live, ParamBool abf)
+/* Charts don't share any data, so they are unwrapped in parallel. */
+
+typedef struct LSCMChartData {
+  PHandle *phandle;
+  PBool live, abf;
+} LSCMChartData;
+
+static void p_chart_lscm_begin_task_cb(void *__restrict userdata,
+                                       const int i,
+                                       const TaskParallelTLS *__restrict UNUSED(tls))
 {
-  PHandle *phandle = (PHandle *)handle;
+  const LSCMChartData *data = userdata;
+  PChart *chart = data->phandle->charts[i];
   PFace *f;
-  int i;
 
-  param_assert(phandle->state == PHANDLE_STATE_CONSTRUCTED);
-  phandle->state = PHANDLE_STATE_LSCM;
+  for (f = chart->faces; f; f = f->nextlink) {
+    p_face_backup_uvs(f);
+  }
+  p_chart_lscm_begin(chart, data->live, data->abf);
+}
 
-  for (i = 0; i < phandle->ncharts; i++) {
-    for (f = phandle->charts[i]->faces; f; f = f->nextlink) {
-      p_face_backup_uvs(f);
+static void p_chart_lscm_solve_task_cb(void *__restrict userdata,
+                                       const int i,
+                                       const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const LSCMChartData *data = userdata;
+  PChart *chart = data->phandle->charts[i];
+  PBool result;
+
+  if (chart->u.lscm.context) {
+    result = p_chart_lscm_solve(data->phandle, chart);
+
+    if (result && !(chart->flag & PCHART_HAS_PINS)) {
+      p_chart_rotate_minimum_area(chart);
+    }
+    else if (result && chart->u.lscm.single_pin) {
+      p_chart_rotate_fit_aabb(chart);
+      p_chart_lscm_transform_single_pin(chart);
+    }
+
+    if (!result || !(chart->flag & PCHART_HAS_PINS)) {
+      p_chart_lscm_end(chart);
     }
-    p_chart_lscm_begin(phandle->charts[i], (PBool)live, (PBool)abf);
   }
 }
 
-void param_lscm_solve(ParamHandle *handle)
+static void p_charts_parallel_range(PHandle *phandle,
+                                    const LSCMChartData *data,
+                                    TaskParallelRangeFunc func)
+{
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  /* The size of charts varies a lot, distribute them one by one. */
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0, phandle->ncharts, (void *)data, func, &settings);
+}
+
+void param_lscm_begin(ParamHandle *handle, ParamBool live, ParamBool abf)
 {
   PHandle *phandle = (PHandle *)handle;
-  PChart *chart;
-  int i;
-  PBool result;
 
-  param_assert(phandle->state == PHANDLE_STATE_LSCM);
+  param_assert(phandle->state == PHANDLE_STATE_CONSTRUCTED);
+  phandle->state = PHANDLE_STATE_LSCM;
 
-  for (i = 0; i < phandle->ncharts; i++) {
-    chart = phandle->charts[i];
+  LSCMChartData data = {
+      .phandle = phandle,
+      .live = (PBool)live,
+      .abf = (PBool)abf,
+  };
+  p_charts_parallel_range(phandle, &data, p_chart_lscm_begin_task_cb);
+}
 
-    if (chart->u.lscm.context) {
-      result = p_chart_lscm_solve(phandle, chart);
+void param_lscm_solve(ParamHandle *handle)
+{
+  PHandle *phandle = (PHandle *)handle;
 
-      if (result && !(chart->flag & PCHART_HAS_PINS)) {
-        p_chart_rotate_minimum_area(chart);
-      }
-      else if (result && chart->u.lscm.single_pin) {
-        p_chart_rotate_fit_aabb(chart);
-        p_chart_lscm_transform_single_pin(chart);
-      }
+  param_assert(phandle->state == PHANDLE_STATE_LSCM);
 
-      if (!result || !(chart->flag & PCHART_HAS_PINS)) {
-        p_chart_lscm_end(chart);
-      }
-    }
-  }
+  LSCMChartData data = {
+      .phandle = phandle,
+  };
+  p_charts_parallel_range(phandle, &data, p_chart_lscm_solve_task_cb);
 }
 
 void param_lscm_end(ParamHandle *handle)
@@ -28,6 +28,7 @@
  * - Avoids data copies in many cases.
  * - Every node is executed at most once.
  * - Can compute sub-functions on a single element, when the result is the same for all elements.
+ * - Large masks are evaluated in chunks, so that the buffers for intermediate values stay small.
  *
  * Possible improvements:
  * - Cache and reuse buffers.
@@ -41,6 +42,10 @@
 
 namespace blender::fn {
 
+/* Number of elements that are evaluated at once when the network is evaluated in chunks. The
+ * temporary buffers of all intermediate sockets should fit into the CPU cache. */
+static constexpr int64_t evaluation_chunk_size = 1024;
+
 struct Value;
 
 /**
@@ -141,6 +146,11 @@ void MFNetworkEvaluator::call(IndexMask mask, MFParams params, MFContext context
     return;
   }
 
+  if (mask.size() > evaluation_chunk_size && this->can_evaluate_in_chunks()) {
+    this->evaluate_in_chunks(mask, params, context);
+    return;
+  }
+
   const MFNetwork &network = outputs_[0]->node().network();
   Storage storage(mask, network.socket_id_amount());
 
@@ -152,6 +162,89 @@ void MFNetworkEvaluator::call(IndexMask mask, MFParams params, MFContext context
   this->initialize_remaining_outputs(params, storage, outputs_to_initialize_in_the_end);
 }
 
+bool MFNetworkEvaluator::can_evaluate_in_chunks() const
+{
+  for (const MFOutputSocket *socket : inputs_) {
+    if (socket->data_type().category() != MFDataType::Single) {
+      return false;
+    }
+  }
+  for (const MFInputSocket *socket : outputs_) {
+    if (socket->data_type().category() != MFDataType::Single) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Evaluate the network for a few elements at a time. Otherwise, every intermediate socket in the
+ * network would need a buffer that is as large as the mask. The inputs of every chunk are copied
+ * into small buffers and the computed outputs are moved to the buffers of the caller.
+ */
+BLI_NOINLINE void MFNetworkEvaluator::evaluate_in_chunks(IndexMask mask,
+                                                         MFParams params,
+                                                         MFContext context) const
+{
+  LinearAllocator<> allocator;
+  Array<void *> chunk_buffers(this->param_amount());
+  for (const int param_index : this->param_indices()) {
+    const CPPType &type = this->param_type(param_index).data_type().single_type();
+    chunk_buffers[param_index] = allocator.allocate(type.size() * evaluation_chunk_size,
+                                                    type.alignment());
+  }
+
+  Span<int64_t> indices = mask.indices();
+  for (int64_t chunk_start = 0; chunk_start < indices.size();
+       chunk_start += evaluation_chunk_size) {
+    const int64_t chunk_size = std::min(evaluation_chunk_size, indices.size() - chunk_start);
+    Span<int64_t> chunk_indices = indices.slice(chunk_start, chunk_size);
+    MFParamsBuilder chunk_params{*this, chunk_size};
+
+    for (const int input_index : inputs_.index_range()) {
+      const GVSpan values = params.readonly_single_input(input_index);
+      const CPPType &type = values.type();
+      if (values.is_single_element()) {
+        chunk_params.add_readonly_single_input(
+            GVSpan::FromSingle(type, values.as_single_element(), chunk_size));
+        continue;
+      }
+      void *buffer = chunk_buffers[input_index];
+      for (const int64_t i : chunk_indices.index_range()) {
+        type.copy_to_uninitialized(values[chunk_indices[i]],
+                                   POINTER_OFFSET(buffer, type.size() * i));
+      }
+      chunk_params.add_readonly_single_input(GSpan(type, buffer, chunk_size));
+    }
+
+    for (const int output_index : outputs_.index_range()) {
+      const int param_index = inputs_.size() + output_index;
+      const CPPType &type = this->param_type(param_index).data_type().single_type();
+      chunk_params.add_uninitialized_single_output(
+          GMutableSpan(type, chunk_buffers[param_index], chunk_size));
+    }
+
+    this->call(IndexRange(chunk_size), chunk_params, context);
+
+    for (const int input_index : inputs_.index_range()) {
+      const GVSpan values = params.readonly_single_input(input_index);
+      if (!values.is_single_element()) {
+        values.type().destruct_n(chunk_buffers[input_index], chunk_size);
+      }
+    }
+    for (const int output_index : outputs_.index_range()) {
+      const int param_index = inputs_.size() + output_index;
+      GMutableSpan values = params.uninitialized_single_output(param_index);
+      const CPPType &type = values.type();
+      void *buffer = chunk_buffers[param_index];
+      for (const int64_t i : chunk_indices.index_range()) {
+        type.relocate_to_uninitialized(POINTER_OFFSET(buffer, type.size() * i),
+                                       values[chunk_indices[i]]);
+      }
+    }
+  }
+}
+
 BLI_NOINLINE void MFNetworkEvaluator::copy_inputs_to_storage(MFParams params,
                                                              Storage &storage) const
 {
@@ -251,5 +251,56 @@ TEST(multi_function_network, Test2)
   }
 }
 
+TEST(multi_function_network, LargeMask)
+{
+  CustomMF_SI_SI_SO<int, int, int> add_fn("add", [](int a, int b) { return a + b; });
+  CustomMF_SI_SO<int, int> square_fn("square", [](int value) { return value * value; });
+
+  MFNetwork network;
+
+  MFNode &node1 = network.add_function(add_fn);
+  MFNode &node2 = network.add_function(square_fn);
+  MFOutputSocket &input_socket_1 = network.add_input("Input 1", MFDataType::ForSingle<int>());
+  MFOutputSocket &input_socket_2 = network.add_input("Input 2", MFDataType::ForSingle<int>());
+  MFInputSocket &output_socket = network.add_output("Output", MFDataType::ForSingle<int>());
+  network.add_link(input_socket_1, node1.input(0));
+  network.add_link(input_socket_2, node1.input(1));
+  network.add_link(node1.output(0), node2.input(0));
+  network.add_link(node2.output(0), output_socket);
+
+  MFNetworkEvaluator network_fn{{&input_socket_1, &input_socket_2}, {&output_socket}};
+
+  /* Use more elements than are evaluated at once, and skip some of them. */
+  const int size = 10000;
+  Array<int> values(size);
+  for (const int i : values.index_range()) {
+    values[i] = i;
+  }
+  Vector<int64_t> indices;
+  for (int i = 0; i < size; i += 3) {
+    indices.append(i);
+  }
+  const int offset = 2;
+  Array<int> results(size, -1);
+
+  MFParamsBuilder params(network_fn, size);
+  params.add_readonly_single_input(values.as_span());
+  params.add_readonly_single_input(&offset);
+  params.add_uninitialized_single_output(results.as_mutable_span());
+
+  MFContextBuilder context;
+
+  network_fn.call(indices.as_span(), params, context);
+
+  for (const int i : results.index_range()) {
+    if (i % 3 == 0) {
+      EXPECT_EQ(results[i], (i + 2) * (i + 2));
+    }
+    else {
+      EXPECT_EQ(results[i], -1);
+    }
+  }
+}
+
 }  // namespace
 }  // namespace blender::fn::tests
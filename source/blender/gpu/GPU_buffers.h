@@ -73,6 +73,9 @@ enum {
   GPU_PBVH_BUFFERS_SHOW_MASK = (1 << 1),
   GPU_PBVH_BUFFERS_SHOW_VCOL = (1 << 2),
   GPU_PBVH_BUFFERS_SHOW_SCULPT_FACE_SETS = (1 << 3),
+  /* Positions or normals changed, otherwise only mask, colors and face sets are updated.
+   * Only used by mesh buffers, grid and BMesh buffers are always fully updated. */
+  GPU_PBVH_BUFFERS_UPDATE_COORDS = (1 << 4),
 };
 
 void GPU_pbvh_mesh_buffers_update(GPU_PBVH_Buffers *buffers,
@@ -50,6 +50,13 @@ void GPU_indexbuf_init_ex(GPUIndexBufBuilder *, GPUPrimType, uint index_len, uin
 /* supports only GPU_PRIM_POINTS, GPU_PRIM_LINES and GPU_PRIM_TRIS. */
 void GPU_indexbuf_init(GPUIndexBufBuilder *, GPUPrimType, uint prim_len, uint vertex_len);
 
+/* Sub-builders write to the data of their parent builder, so that multiple threads can fill
+ * distinct elements using the GPU_indexbuf_set_* functions. Join them back into the parent
+ * (one at a time) once they are filled. */
+void GPU_indexbuf_subbuild_init(const GPUIndexBufBuilder *builder,
+                                GPUIndexBufBuilder *sub_builder);
+void GPU_indexbuf_join(GPUIndexBufBuilder *builder, const GPUIndexBufBuilder *sub_builder);
+
 void GPU_indexbuf_add_generic_vert(GPUIndexBufBuilder *, uint v);
 void GPU_indexbuf_add_primitive_restart(GPUIndexBufBuilder *);
 
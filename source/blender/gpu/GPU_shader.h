@@ -45,6 +45,12 @@ GPUShader *GPU_shader_create(const char *vertcode,
                              const char *libcode,
                              const char *defines,
                              const char *shname);
+GPUShader *GPU_shader_create_cached(const char *vertcode,
+                                    const char *fragcode,
+                                    const char *geomcode,
+                                    const char *libcode,
+                                    const char *defines,
+                                    const char *shname);
 GPUShader *GPU_shader_create_from_python(const char *vertcode,
                                          const char *fragcode,
                                          const char *geomcode,
@@ -76,6 +82,8 @@ struct GPUShader *GPU_shader_create_from_arrays_impl(
 
 void GPU_shader_free(GPUShader *shader);
 
+void GPU_shader_binary_cache_dir_set(const char *dir);
+
 void GPU_shader_bind(GPUShader *shader);
 void GPU_shader_unbind(void);
 
@@ -61,6 +61,9 @@ struct GPU_PBVH_Buffers {
   GPUIndexBuf *index_buf, *index_buf_fast;
   GPUIndexBuf *index_lines_buf, *index_lines_buf_fast;
   GPUVertBuf *vert_buf;
+  /* Mesh PBVH only: mask, color and face set attributes, kept out of #vert_buf so they can be
+   * updated without filling and uploading positions and normals again. */
+  GPUVertBuf *vert_buf_attr;
 
   GPUBatch *lines;
   GPUBatch *lines_fast;
@@ -101,6 +104,9 @@ struct GPU_PBVH_Buffers {
 static struct {
   GPUVertFormat format;
   uint pos, nor, msk, col, fset;
+  /* Same attributes split in two formats, used by mesh PBVH. */
+  GPUVertFormat format_geom, format_attr;
+  uint geom_pos, geom_nor, attr_msk, attr_col, attr_fset;
 } g_vbo_id = {{0}};
 
 /** \} */
@@ -125,6 +131,20 @@ void gpu_pbvh_init()
     g_vbo_id.fset = GPU_vertformat_attr_add(
         &g_vbo_id.format, "fset", GPU_COMP_U8, 3, GPU_FETCH_INT_TO_FLOAT_UNIT);
   }
+  if (g_vbo_id.format_geom.attr_len == 0) {
+    g_vbo_id.geom_pos = GPU_vertformat_attr_add(
+        &g_vbo_id.format_geom, "pos", GPU_COMP_F32, 3, GPU_FETCH_FLOAT);
+    g_vbo_id.geom_nor = GPU_vertformat_attr_add(
+        &g_vbo_id.format_geom, "nor", GPU_COMP_I16, 3, GPU_FETCH_INT_TO_FLOAT_UNIT);
+  }
+  if (g_vbo_id.format_attr.attr_len == 0) {
+    g_vbo_id.attr_msk = GPU_vertformat_attr_add(
+        &g_vbo_id.format_attr, "msk", GPU_COMP_U8, 1, GPU_FETCH_INT_TO_FLOAT_UNIT);
+    g_vbo_id.attr_col = GPU_vertformat_attr_add(
+        &g_vbo_id.format_attr, "ac", GPU_COMP_U16, 4, GPU_FETCH_INT_TO_FLOAT_UNIT);
+    g_vbo_id.attr_fset = GPU_vertformat_attr_add(
+        &g_vbo_id.format_attr, "fset", GPU_COMP_U8, 3, GPU_FETCH_INT_TO_FLOAT_UNIT);
+  }
 }
 
 void gpu_pbvh_exit()
@@ -134,58 +154,71 @@ void gpu_pbvh_exit()
 
 /* Allocates a non-initialized buffer to be sent to GPU.
  * Return is false it indicates that the memory map failed. */
-static bool gpu_pbvh_vert_buf_data_set(GPU_PBVH_Buffers *buffers, uint vert_len)
+static bool gpu_pbvh_vert_buf_data_set(GPUVertBuf **vert_buf,
+                                       const GPUVertFormat *format,
+                                       uint vert_len)
 {
   /* Keep so we can test #GPU_USAGE_DYNAMIC buffer use.
    * Not that format initialization match in both blocks.
    * Do this to keep braces balanced - otherwise indentation breaks. */
 #if 0
-  if (buffers->vert_buf == NULL) {
+  if (*vert_buf == NULL) {
     /* Initialize vertex buffer (match 'VertexBufferFormat'). */
-    buffers->vert_buf = GPU_vertbuf_create_with_format_ex(&g_vbo_id.format, GPU_USAGE_DYNAMIC);
-    GPU_vertbuf_data_alloc(buffers->vert_buf, vert_len);
+    *vert_buf = GPU_vertbuf_create_with_format_ex(format, GPU_USAGE_DYNAMIC);
+    GPU_vertbuf_data_alloc(*vert_buf, vert_len);
   }
-  else if (vert_len != buffers->vert_buf->vertex_len) {
-    GPU_vertbuf_data_resize(buffers->vert_buf, vert_len);
+  else if (vert_len != (*vert_buf)->vertex_len) {
+    GPU_vertbuf_data_resize(*vert_buf, vert_len);
   }
 #else
-  if (buffers->vert_buf == NULL) {
+  if (*vert_buf == NULL) {
     /* Initialize vertex buffer (match 'VertexBufferFormat'). */
-    buffers->vert_buf = GPU_vertbuf_create_with_format_ex(&g_vbo_id.format, GPU_USAGE_STATIC);
+    *vert_buf = GPU_vertbuf_create_with_format_ex(format, GPU_USAGE_STATIC);
   }
-  if (GPU_vertbuf_get_data(buffers->vert_buf) == NULL ||
-      GPU_vertbuf_get_vertex_len(buffers->vert_buf) != vert_len) {
+  if (GPU_vertbuf_get_data(*vert_buf) == NULL ||
+      GPU_vertbuf_get_vertex_len(*vert_buf) != vert_len) {
     /* Allocate buffer if not allocated yet or size changed. */
-    GPU_vertbuf_data_alloc(buffers->vert_buf, vert_len);
+    GPU_vertbuf_data_alloc(*vert_buf, vert_len);
   }
 #endif
 
-  return GPU_vertbuf_get_data(buffers->vert_buf) != NULL;
+  return GPU_vertbuf_get_data(*vert_buf) != NULL;
+}
+
+static GPUBatch *gpu_pbvh_batch_create(GPU_PBVH_Buffers *buffers,
+                                       GPUPrimType prim,
+                                       GPUIndexBuf *index_buf)
+{
+  GPUBatch *batch = GPU_batch_create(prim, buffers->vert_buf, index_buf);
+  if (buffers->vert_buf_attr) {
+    GPU_batch_vertbuf_add(batch, buffers->vert_buf_attr);
+  }
+  return batch;
 }
 
 static void gpu_pbvh_batch_init(GPU_PBVH_Buffers *buffers, GPUPrimType prim)
 {
   if (buffers->triangles == NULL) {
-    buffers->triangles = GPU_batch_create(prim,
-                                          buffers->vert_buf,
-                                          /* can be NULL if buffer is empty */
-                                          buffers->index_buf);
+    buffers->triangles = gpu_pbvh_batch_create(buffers,
+                                               prim,
+                                               /* can be NULL if buffer is empty */
+                                               buffers->index_buf);
   }
 
   if ((buffers->triangles_fast == NULL) && buffers->index_buf_fast) {
-    buffers->triangles_fast = GPU_batch_create(prim, buffers->vert_buf, buffers->index_buf_fast);
+    buffers->triangles_fast = gpu_pbvh_batch_create(buffers, prim, buffers->index_buf_fast);
   }
 
   if (buffers->lines == NULL) {
-    buffers->lines = GPU_batch_create(GPU_PRIM_LINES,
-                                      buffers->vert_buf,
-                                      /* can be NULL if buffer is empty */
-                                      buffers->index_lines_buf);
+    buffers->lines = gpu_pbvh_batch_create(buffers,
+                                           GPU_PRIM_LINES,
+                                           /* can be NULL if buffer is empty */
+                                           buffers->index_lines_buf);
   }
 
   if ((buffers->lines_fast == NULL) && buffers->index_lines_buf_fast) {
-    buffers->lines_fast = GPU_batch_create(
-        GPU_PRIM_LINES, buffers->vert_buf, buffers->index_lines_buf_fast);
+    buffers->lines_fast = gpu_pbvh_batch_create(
+        buffers, GPU_PRIM_LINES, buffers->index_lines_buf_fast);
   }
 }
 
@@ -204,6 +237,54 @@ static bool gpu_pbvh_is_looptri_visible(const MLoopTri *lt,
           sculpt_face_sets[lt->poly] > SCULPT_FACE_SET_NONE);
 }
 
+/* Fill positions and normals of the visible triangles. */
+static void gpu_pbvh_mesh_buffers_fill_geometry(GPU_PBVH_Buffers *buffers,
+                                                const MVert *mvert,
+                                                const int *sculpt_face_sets)
+{
+  GPUVertBufRaw pos_step = {0};
+  GPUVertBufRaw nor_step = {0};
+
+  GPU_vertbuf_attr_get_raw_data(buffers->vert_buf, g_vbo_id.geom_pos, &pos_step);
+  GPU_vertbuf_attr_get_raw_data(buffers->vert_buf, g_vbo_id.geom_nor, &nor_step);
+
+  /* calculate normal for each polygon only once */
+  uint mpoly_prev = UINT_MAX;
+  short no[3] = {0, 0, 0};
+
+  for (uint i = 0; i < buffers->face_indices_len; i++) {
+    const MLoopTri *lt = &buffers->looptri[buffers->face_indices[i]];
+    const uint vtri[3] = {
+        buffers->mloop[lt->tri[0]].v,
+        buffers->mloop[lt->tri[1]].v,
+        buffers->mloop[lt->tri[2]].v,
+    };
+
+    if (!gpu_pbvh_is_looptri_visible(lt, mvert, buffers->mloop, sculpt_face_sets)) {
+      continue;
+    }
+
+    /* Face normal */
+    if (lt->poly != mpoly_prev && !buffers->smooth) {
+      const MPoly *mp = &buffers->mpoly[lt->poly];
+      float fno[3];
+      BKE_mesh_calc_poly_normal(mp, &buffers->mloop[mp->loopstart], mvert, fno);
+      normal_float_to_short_v3(no, fno);
+      mpoly_prev = lt->poly;
+    }
+
+    for (uint j = 0; j < 3; j++) {
+      const MVert *v = &mvert[vtri[j]];
+      copy_v3_v3(GPU_vertbuf_raw_step(&pos_step), v->co);
+
+      if (buffers->smooth) {
+        copy_v3_v3_short(no, v->no);
+      }
+      copy_v3_v3_short(GPU_vertbuf_raw_step(&nor_step), no);
+    }
+  }
+}
+
 /* Threaded - do not call any functions that use OpenGL calls! */
 void GPU_pbvh_mesh_buffers_update(GPU_PBVH_Buffers *buffers,
                                   const MVert *mvert,
@@ -220,32 +301,31 @@ void GPU_pbvh_mesh_buffers_update(GPU_PBVH_Buffers *buffers,
                               (update_flags & GPU_PBVH_BUFFERS_SHOW_SCULPT_FACE_SETS) != 0;
   const bool show_vcol = (vcol || (vtcol && U.experimental.use_sculpt_vertex_colors)) &&
                          (update_flags & GPU_PBVH_BUFFERS_SHOW_VCOL) != 0;
+  const bool update_coords = (update_flags & GPU_PBVH_BUFFERS_UPDATE_COORDS) != 0 ||
+                             buffers->vert_buf == NULL;
   bool empty_mask = true;
   bool default_face_set = true;
 
   {
     const int totelem = buffers->tot_tri * 3;
 
-    /* Build VBO */
-    if (gpu_pbvh_vert_buf_data_set(buffers, totelem)) {
-      GPUVertBufRaw pos_step = {0};
-      GPUVertBufRaw nor_step = {0};
+    /* Build VBOs, positions and normals are left untouched when only attributes changed. */
+    if (update_coords &&
+        gpu_pbvh_vert_buf_data_set(&buffers->vert_buf, &g_vbo_id.format_geom, totelem)) {
+      gpu_pbvh_mesh_buffers_fill_geometry(buffers, mvert, sculpt_face_sets);
+    }
+
+    if (gpu_pbvh_vert_buf_data_set(&buffers->vert_buf_attr, &g_vbo_id.format_attr, totelem)) {
       GPUVertBufRaw msk_step = {0};
       GPUVertBufRaw fset_step = {0};
       GPUVertBufRaw col_step = {0};
 
-      GPU_vertbuf_attr_get_raw_data(buffers->vert_buf, g_vbo_id.pos, &pos_step);
-      GPU_vertbuf_attr_get_raw_data(buffers->vert_buf, g_vbo_id.nor, &nor_step);
-      GPU_vertbuf_attr_get_raw_data(buffers->vert_buf, g_vbo_id.msk, &msk_step);
-      GPU_vertbuf_attr_get_raw_data(buffers->vert_buf, g_vbo_id.fset, &fset_step);
+      GPU_vertbuf_attr_get_raw_data(buffers->vert_buf_attr, g_vbo_id.attr_msk, &msk_step);
+      GPU_vertbuf_attr_get_raw_data(buffers->vert_buf_attr, g_vbo_id.attr_fset, &fset_step);
       if (show_vcol) {
-        GPU_vertbuf_attr_get_raw_data(buffers->vert_buf, g_vbo_id.col, &col_step);
+        GPU_vertbuf_attr_get_raw_data(buffers->vert_buf_attr, g_vbo_id.attr_col, &col_step);
       }
 
-      /* calculate normal for each polygon only once */
-      uint mpoly_prev = UINT_MAX;
-      short no[3] = {0, 0, 0};
-
       for (uint i = 0; i < buffers->face_indices_len; i++) {
         const MLoopTri *lt = &buffers->looptri[buffers->face_indices[i]];
         const uint vtri[3] = {
@@ -258,15 +338,6 @@ void GPU_pbvh_mesh_buffers_update(GPU_PBVH_Buffers *buffers,
           continue;
         }
 
-        /* Face normal and mask */
-        if (lt->poly != mpoly_prev && !buffers->smooth) {
-          const MPoly *mp = &buffers->mpoly[lt->poly];
-          float fno[3];
-          BKE_mesh_calc_poly_normal(mp, &buffers->mloop[mp->loopstart], mvert, fno);
-          normal_float_to_short_v3(no, fno);
-          mpoly_prev = lt->poly;
-        }
-
         uchar face_set_color[4] = {UCHAR_MAX, UCHAR_MAX, UCHAR_MAX, UCHAR_MAX};
         if (show_face_sets) {
           const int fset = abs(sculpt_face_sets[lt->poly]);
@@ -277,6 +348,7 @@ void GPU_pbvh_mesh_buffers_update(GPU_PBVH_Buffers *buffers,
           }
         }
 
+        /* Face mask */
         float fmask = 0.0f;
         uchar cmask = 0;
         if (show_mask && !buffers->smooth) {
@@ -285,14 +357,6 @@ void GPU_pbvh_mesh_buffers_update(GPU_PBVH_Buffers *buffers,
         }
 
         for (uint j = 0; j < 3; j++) {
-          const MVert *v = &mvert[vtri[j]];
-          copy_v3_v3(GPU_vertbuf_raw_step(&pos_step), v->co);
-
-          if (buffers->smooth) {
-            copy_v3_v3_short(no, v->no);
-          }
-          copy_v3_v3_short(GPU_vertbuf_raw_step(&nor_step), no);
-
           if (show_mask && buffers->smooth) {
             cmask = (uchar)(vmask[vtri[j]] * 255);
           }
@@ -634,7 +698,7 @@ void GPU_pbvh_grid_buffers_update(GPU_PBVH_Buffers *buffers,
 
   uint vbo_index_offset = 0;
   /* Build VBO */
-  if (gpu_pbvh_vert_buf_data_set(buffers, vert_count)) {
+  if (gpu_pbvh_vert_buf_data_set(&buffers->vert_buf, &g_vbo_id.format, vert_count)) {
     GPUIndexBufBuilder elb_lines;
 
     if (buffers->index_lines_buf == NULL) {
@@ -920,7 +984,7 @@ void GPU_pbvh_bmesh_buffers_update(GPU_PBVH_Buffers *buffers,
   const int cd_vert_mask_offset = CustomData_get_offset(&bm->vdata, CD_PAINT_MASK);
 
   /* Fill vertex buffer */
-  if (!gpu_pbvh_vert_buf_data_set(buffers, totvert)) {
+  if (!gpu_pbvh_vert_buf_data_set(&buffers->vert_buf, &g_vbo_id.format, totvert)) {
     /* Memory map failed */
     return;
   }
@@ -1091,6 +1155,7 @@ static void gpu_pbvh_buffers_clear(GPU_PBVH_Buffers *buffers)
   GPU_INDEXBUF_DISCARD_SAFE(buffers->index_buf_fast);
   GPU_INDEXBUF_DISCARD_SAFE(buffers->index_buf);
   GPU_VERTBUF_DISCARD_SAFE(buffers->vert_buf);
+  GPU_VERTBUF_DISCARD_SAFE(buffers->vert_buf_attr);
 }
 
 void GPU_pbvh_buffers_update_flush(GPU_PBVH_Buffers *buffers)
@@ -1105,6 +1170,9 @@ void GPU_pbvh_buffers_update_flush(GPU_PBVH_Buffers *buffers)
   if (buffers->vert_buf && GPU_vertbuf_get_data(buffers->vert_buf)) {
     GPU_vertbuf_use(buffers->vert_buf);
   }
+  if (buffers->vert_buf_attr && GPU_vertbuf_get_data(buffers->vert_buf_attr)) {
+    GPU_vertbuf_use(buffers->vert_buf_attr);
+  }
 }
 
 void GPU_pbvh_buffers_free(GPU_PBVH_Buffers *buffers)
@@ -67,6 +67,9 @@ extern char datatoc_gpu_shader_common_obinfos_lib_glsl[];
 
 /* Only use one linklist that contains the GPUPasses grouped by hash. */
 static GPUPass *pass_cache = NULL;
+/* Maps a hash to the first pass of its group inside `pass_cache`, so that the lookup done for
+ * every material compilation does not have to walk the whole list. */
+static GHash *pass_cache_map = NULL;
 static SpinLock pass_cache_spin;
 
 static uint32_t gpu_pass_hash(const char *frag_gen, const char *defs, ListBase *attributes)
@@ -89,15 +92,9 @@ static uint32_t gpu_pass_hash(const char *frag_gen, const char *defs, ListBase *
 static GPUPass *gpu_pass_cache_lookup(uint32_t hash)
 {
   BLI_spin_lock(&pass_cache_spin);
-  /* Could be optimized with a Lookup table. */
-  for (GPUPass *pass = pass_cache; pass; pass = pass->next) {
-    if (pass->hash == hash) {
-      BLI_spin_unlock(&pass_cache_spin);
-      return pass;
-    }
-  }
+  GPUPass *pass = BLI_ghash_lookup(pass_cache_map, POINTER_FROM_UINT(hash));
   BLI_spin_unlock(&pass_cache_spin);
-  return NULL;
+  return pass;
 }
 
 /* Check all possible passes with the same hash. */
@@ -931,6 +928,7 @@ GPUPass *GPU_generate_pass(GPUMaterial *material,
     else {
       /* No other pass have same hash, just prepend to the list. */
       BLI_LINKS_PREPEND(pass_cache, pass);
+      BLI_ghash_insert(pass_cache_map, POINTER_FROM_UINT(hash), pass);
     }
     BLI_spin_unlock(&pass_cache_spin);
   }
@@ -1026,7 +1024,7 @@ bool GPU_pass_compile(GPUPass *pass, const char *shname)
 {
   bool success = true;
   if (!pass->compiled) {
-    GPUShader *shader = GPU_shader_create(
+    GPUShader *shader = GPU_shader_create_cached(
         pass->vertexcode, pass->fragmentcode, pass->geometrycode, NULL, pass->defines, shname);
 
     /* NOTE: Some drivers / gpu allows more active samplers than the opengl limit.
@@ -1084,6 +1082,17 @@ void GPU_pass_cache_garbage_collect(void)
     if (pass->refcount == 0) {
       /* Remove from list */
       *prev_pass = next;
+      /* Groups are contiguous, so the next pass becomes the head of the group if it shares the
+       * same hash. */
+      void **head_p = BLI_ghash_lookup_p(pass_cache_map, POINTER_FROM_UINT(pass->hash));
+      if (head_p && *head_p == pass) {
+        if (next && next->hash == pass->hash) {
+          *head_p = next;
+        }
+        else {
+          BLI_ghash_remove(pass_cache_map, POINTER_FROM_UINT(pass->hash), NULL, NULL);
+        }
+      }
       gpu_pass_free(pass);
     }
     else {
@@ -1096,6 +1105,7 @@ void GPU_pass_cache_garbage_collect(void)
 void GPU_pass_cache_init(void)
 {
   BLI_spin_init(&pass_cache_spin);
+  pass_cache_map = BLI_ghash_int_new(__func__);
 }
 
 void GPU_pass_cache_free(void)
@@ -1106,6 +1116,8 @@ void GPU_pass_cache_free(void)
     gpu_pass_free(pass_cache);
     pass_cache = next;
   }
+  BLI_ghash_free(pass_cache_map, NULL, NULL);
+  pass_cache_map = NULL;
   BLI_spin_unlock(&pass_cache_spin);
 
   BLI_spin_end(&pass_cache_spin);
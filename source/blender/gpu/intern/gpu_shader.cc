@@ -24,6 +24,8 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_dynstr.h"
+#include "BLI_fileops.h"
+#include "BLI_hash_mm2a.h"
 #include "BLI_math_base.h"
 #include "BLI_math_vector.h"
 #include "BLI_path_util.h"
@@ -50,6 +52,8 @@
 
 #include "CLG_log.h"
 
+#include <mutex>
+
 extern "C" char datatoc_gpu_shader_colorspace_lib_glsl[];
 
 static CLG_LogRef LOG = {"gpu.shader"};
@@ -240,6 +244,139 @@ void Shader::print_log(Span<const char *> sources, char *log, const char *stage,
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Program Binary Cache
+ *
+ * Linked programs are stored on disk, keyed by a hash of all their sources and of the GPU and
+ * driver identification string. Only used for material shaders, which are generated per file
+ * and make up most of the compilation time when opening one.
+ * \{ */
+
+#define SHADER_BINARY_MAGIC "BGSB"
+#define SHADER_BINARY_VERSION 1
+
+typedef struct ShaderBinaryHeader {
+  char magic[4];
+  uint32_t version;
+  /** Backend specific format of the binary. */
+  uint32_t format;
+  uint32_t data_len;
+} ShaderBinaryHeader;
+
+static std::mutex g_binary_cache_dir_mutex;
+static char g_binary_cache_dir[FILE_MAX] = "";
+
+/**
+ * Directory used to store program binaries, NULL or empty to disable the cache.
+ * Already created shaders are not affected.
+ */
+void GPU_shader_binary_cache_dir_set(const char *dir)
+{
+  std::scoped_lock lock(g_binary_cache_dir_mutex);
+  BLI_strncpy(g_binary_cache_dir, (dir) ? dir : "", sizeof(g_binary_cache_dir));
+}
+
+/* Return false if the cache is disabled. */
+static bool gpu_shader_binary_cache_path(Span<Span<const char *>> stages, char r_path[FILE_MAX])
+{
+  char dir[FILE_MAX];
+  {
+    std::scoped_lock lock(g_binary_cache_dir_mutex);
+    BLI_strncpy(dir, g_binary_cache_dir, sizeof(dir));
+  }
+  if (dir[0] == '\0') {
+    return false;
+  }
+
+  /* Two differently seeded hashes make collisions between cached programs unlikely. */
+  const char *gpu_name = GPU_platform_gpu_name();
+  uint32_t hash[2];
+  for (int i = 0; i < 2; i++) {
+    BLI_HashMurmur2A mm2;
+    BLI_hash_mm2a_init(&mm2, (uint32_t)i);
+    BLI_hash_mm2a_add_int(&mm2, SHADER_BINARY_VERSION);
+    if (gpu_name) {
+      BLI_hash_mm2a_add(&mm2, (const uchar *)gpu_name, strlen(gpu_name));
+    }
+    for (Span<const char *> sources : stages) {
+      BLI_hash_mm2a_add_int(&mm2, (int)sources.size());
+      for (const char *source : sources) {
+        BLI_hash_mm2a_add(&mm2, (const uchar *)source, strlen(source) + 1);
+      }
+    }
+    hash[i] = BLI_hash_mm2a_end(&mm2);
+  }
+
+  char filename[32];
+  BLI_snprintf(filename, sizeof(filename), "%08x%08x.bin", hash[0], hash[1]);
+  BLI_join_dirfile(r_path, FILE_MAX, dir, filename);
+  return true;
+}
+
+static bool gpu_shader_binary_load(Shader *shader, const char *filepath)
+{
+  if (!BLI_exists(filepath)) {
+    return false;
+  }
+
+  size_t mem_len = 0;
+  uint8_t *mem = (uint8_t *)BLI_file_read_binary_as_mem(filepath, 0, &mem_len);
+  if (mem == nullptr) {
+    return false;
+  }
+
+  bool success = false;
+  const ShaderBinaryHeader *header = (const ShaderBinaryHeader *)mem;
+  if ((mem_len > sizeof(*header)) && STREQLEN(header->magic, SHADER_BINARY_MAGIC, 4) &&
+      (header->version == SHADER_BINARY_VERSION) &&
+      (header->data_len == mem_len - sizeof(*header))) {
+    success = shader->binary_set(header->format,
+                                 Span<uint8_t>(mem + sizeof(*header), header->data_len));
+  }
+  MEM_freeN(mem);
+
+  return success;
+}
+
+static void gpu_shader_binary_store(Shader *shader, const char *filepath)
+{
+  uint32_t format;
+  Vector<uint8_t> data;
+  if (!shader->binary_get(format, data)) {
+    return;
+  }
+
+  char dir[FILE_MAX];
+  BLI_split_dir_part(filepath, dir, sizeof(dir));
+  if (!BLI_dir_create_recursive(dir)) {
+    return;
+  }
+
+  /* Write to a temporary file first, so a partially written binary is never read. */
+  char filepath_tmp[FILE_MAX];
+  BLI_snprintf(filepath_tmp, sizeof(filepath_tmp), "%s@%p", filepath, (void *)shader);
+  FILE *file = BLI_fopen(filepath_tmp, "wb");
+  if (file == nullptr) {
+    return;
+  }
+
+  ShaderBinaryHeader header;
+  memcpy(header.magic, SHADER_BINARY_MAGIC, sizeof(header.magic));
+  header.version = SHADER_BINARY_VERSION;
+  header.format = format;
+  header.data_len = (uint32_t)data.size();
+
+  bool success = (fwrite(&header, sizeof(header), 1, file) == 1) &&
+                 (fwrite(data.data(), data.size(), 1, file) == 1);
+  success = (fclose(file) == 0) && success;
+
+  if (!success || BLI_rename(filepath_tmp, filepath) != 0) {
+    BLI_delete(filepath_tmp, false, false);
+  }
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Creation / Destruction
  * \{ */
@@ -285,66 +422,89 @@ static void standard_defines(Vector<const char *> &sources)
   }
 }
 
-GPUShader *GPU_shader_create_ex(const char *vertcode,
-                                const char *fragcode,
-                                const char *geomcode,
-                                const char *libcode,
-                                const char *defines,
-                                const eGPUShaderTFBType tf_type,
-                                const char **tf_names,
-                                const int tf_count,
-                                const char *shname)
+static GPUShader *gpu_shader_create_ex(const char *vertcode,
+                                       const char *fragcode,
+                                       const char *geomcode,
+                                       const char *libcode,
+                                       const char *defines,
+                                       const eGPUShaderTFBType tf_type,
+                                       const char **tf_names,
+                                       const int tf_count,
+                                       const char *shname,
+                                       const bool use_binary_cache)
 {
   /* At least a vertex shader and a fragment shader are required. */
   BLI_assert((fragcode != nullptr) && (vertcode != nullptr));
 
-  Shader *shader = GPUBackend::get()->shader_alloc(shname);
+  Vector<const char *> vert_sources;
+  Vector<const char *> frag_sources;
+  Vector<const char *> geom_sources;
 
   if (vertcode) {
-    Vector<const char *> sources;
-    standard_defines(sources);
-    sources.append("#define GPU_VERTEX_SHADER\n");
-    sources.append("#define IN_OUT out\n");
+    standard_defines(vert_sources);
+    vert_sources.append("#define GPU_VERTEX_SHADER\n");
+    vert_sources.append("#define IN_OUT out\n");
     if (geomcode) {
-      sources.append("#define USE_GEOMETRY_SHADER\n");
+      vert_sources.append("#define USE_GEOMETRY_SHADER\n");
     }
     if (defines) {
-      sources.append(defines);
+      vert_sources.append(defines);
     }
-    sources.append(vertcode);
-
-    shader->vertex_shader_from_glsl(sources);
+    vert_sources.append(vertcode);
   }
 
   if (fragcode) {
-    Vector<const char *> sources;
-    standard_defines(sources);
-    sources.append("#define GPU_FRAGMENT_SHADER\n");
-    sources.append("#define IN_OUT in\n");
+    standard_defines(frag_sources);
+    frag_sources.append("#define GPU_FRAGMENT_SHADER\n");
+    frag_sources.append("#define IN_OUT in\n");
     if (geomcode) {
-      sources.append("#define USE_GEOMETRY_SHADER\n");
+      frag_sources.append("#define USE_GEOMETRY_SHADER\n");
     }
     if (defines) {
-      sources.append(defines);
+      frag_sources.append(defines);
     }
     if (libcode) {
-      sources.append(libcode);
+      frag_sources.append(libcode);
     }
-    sources.append(fragcode);
-
-    shader->fragment_shader_from_glsl(sources);
+    frag_sources.append(fragcode);
   }
 
   if (geomcode) {
-    Vector<const char *> sources;
-    standard_defines(sources);
-    sources.append("#define GPU_GEOMETRY_SHADER\n");
+    standard_defines(geom_sources);
+    geom_sources.append("#define GPU_GEOMETRY_SHADER\n");
     if (defines) {
-      sources.append(defines);
+      geom_sources.append(defines);
     }
-    sources.append(geomcode);
+    geom_sources.append(geomcode);
+  }
+
+  /* Transform feedback varyings are part of the link state, don't cache those programs. */
+  char binary_path[FILE_MAX];
+  const Span<const char *> stages[3] = {vert_sources, frag_sources, geom_sources};
+  const bool use_binary = use_binary_cache && (tf_names == nullptr) &&
+                          gpu_shader_binary_cache_path(Span<Span<const char *>>(stages, 3),
+                                                       binary_path);
+
+  if (use_binary) {
+    Shader *shader = GPUBackend::get()->shader_alloc(shname);
+    if (gpu_shader_binary_load(shader, binary_path)) {
+      return wrap(shader);
+    }
+    delete shader;
+  }
+
+  Shader *shader = GPUBackend::get()->shader_alloc(shname);
+
+  if (vertcode) {
+    shader->vertex_shader_from_glsl(vert_sources);
+  }
+
+  if (fragcode) {
+    shader->fragment_shader_from_glsl(frag_sources);
+  }
 
-    shader->geometry_shader_from_glsl(sources);
+  if (geomcode) {
+    shader->geometry_shader_from_glsl(geom_sources);
   }
 
   if (tf_names != nullptr && tf_count > 0) {
@@ -352,14 +512,59 @@ GPUShader *GPU_shader_create_ex(const char *vertcode,
     shader->transform_feedback_names_set(Span<const char *>(tf_names, tf_count), tf_type);
   }
 
+  if (use_binary) {
+    shader->binary_retrievable_set();
+  }
+
   if (!shader->finalize()) {
     delete shader;
     return nullptr;
   };
 
+  if (use_binary) {
+    gpu_shader_binary_store(shader, binary_path);
+  }
+
   return wrap(shader);
 }
 
+GPUShader *GPU_shader_create_ex(const char *vertcode,
+                                const char *fragcode,
+                                const char *geomcode,
+                                const char *libcode,
+                                const char *defines,
+                                const eGPUShaderTFBType tf_type,
+                                const char **tf_names,
+                                const int tf_count,
+                                const char *shname)
+{
+  return gpu_shader_create_ex(
+      vertcode, fragcode, geomcode, libcode, defines, tf_type, tf_names, tf_count, shname, false);
+}
+
+/**
+ * Same as #GPU_shader_create but the linked program is read from and written to the program
+ * binary cache, see #GPU_shader_binary_cache_dir_set.
+ */
+GPUShader *GPU_shader_create_cached(const char *vertcode,
+                                    const char *fragcode,
+                                    const char *geomcode,
+                                    const char *libcode,
+                                    const char *defines,
+                                    const char *shname)
+{
+  return gpu_shader_create_ex(vertcode,
+                              fragcode,
+                              geomcode,
+                              libcode,
+                              defines,
+                              GPU_SHADER_TFB_NONE,
+                              nullptr,
+                              0,
+                              shname,
+                              true);
+}
+
 void GPU_shader_free(GPUShader *shader)
 {
   delete unwrap(shader);
@@ -21,6 +21,7 @@
 #pragma once
 
 #include "BLI_span.hh"
+#include "BLI_vector.hh"
 
 #include "GPU_shader.h"
 #include "gpu_shader_interface.hh"
@@ -51,6 +52,22 @@ class Shader {
   virtual void fragment_shader_from_glsl(MutableSpan<const char *> sources) = 0;
   virtual bool finalize(void) = 0;
 
+  /**
+   * Program binaries, used by the on-disk shader cache. `binary_retrievable_set` must be called
+   * before #finalize for `binary_get` to succeed. Backends without support return false.
+   */
+  virtual void binary_retrievable_set(void)
+  {
+  }
+  virtual bool binary_get(uint32_t &UNUSED(r_format), Vector<uint8_t> &UNUSED(r_data))
+  {
+    return false;
+  }
+  virtual bool binary_set(uint32_t UNUSED(format), Span<uint8_t> UNUSED(data))
+  {
+    return false;
+  }
+
   virtual void transform_feedback_names_set(Span<const char *> name_list,
                                             const eGPUShaderTFBType geom_type) = 0;
   virtual bool transform_feedback_enable(GPUVertBuf *) = 0;
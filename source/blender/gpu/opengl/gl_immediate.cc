@@ -57,12 +57,29 @@ GLImmediate::GLImmediate()
   glBindBuffer(GL_ARRAY_BUFFER, buffer_strict.vbo_id);
   glBufferData(GL_ARRAY_BUFFER, buffer_strict.buffer_size, nullptr, GL_DYNAMIC_DRAW);
 
+  if (GLContext::buffer_storage_support) {
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glGenBuffers(1, &ring_.vbo_id);
+    glBindBuffer(GL_ARRAY_BUFFER, ring_.vbo_id);
+    glBufferStorage(GL_ARRAY_BUFFER, DEFAULT_INTERNAL_BUFFER_SIZE, nullptr, flags);
+    ring_.data = (uchar *)glMapBufferRange(
+        GL_ARRAY_BUFFER, 0, DEFAULT_INTERNAL_BUFFER_SIZE, flags);
+    if (ring_.data == nullptr) {
+      /* Fallback to the mapped ranges. */
+      glDeleteBuffers(1, &ring_.vbo_id);
+      ring_.vbo_id = 0;
+    }
+  }
+
   glBindBuffer(GL_ARRAY_BUFFER, 0);
   glBindVertexArray(0);
 
   debug::object_label(GL_VERTEX_ARRAY, vao_id_, "Immediate");
   debug::object_label(GL_BUFFER, buffer.vbo_id, "ImmediateVbo");
   debug::object_label(GL_BUFFER, buffer_strict.vbo_id, "ImmediateVboStrict");
+  if (ring_.vbo_id != 0) {
+    debug::object_label(GL_BUFFER, ring_.vbo_id, "ImmediateVboRing");
+  }
 }
 
 GLImmediate::~GLImmediate()
@@ -71,6 +88,16 @@ GLImmediate::~GLImmediate()
 
   glDeleteBuffers(1, &buffer.vbo_id);
   glDeleteBuffers(1, &buffer_strict.vbo_id);
+
+  for (GLsync &fence : ring_.fences) {
+    if (fence != nullptr) {
+      glDeleteSync(fence);
+    }
+  }
+  /* Deleting the buffer also unmaps it. */
+  if (ring_.vbo_id != 0) {
+    glDeleteBuffers(1, &ring_.vbo_id);
+  }
 }
 
 /** \} */
@@ -79,10 +106,51 @@ GLImmediate::~GLImmediate()
 /** \name Buffer management
  * \{ */
 
+uchar *GLImmediate::ring_begin(size_t bytes_needed)
+{
+  size_t offset = ring_.buffer_offset + padding(ring_.buffer_offset, vertex_format.stride);
+  const size_t segment_end = (size_t)(ring_.segment + 1) * RING_BUFFER_SEGMENT_SIZE;
+
+  if (offset + bytes_needed > segment_end) {
+    /* Move to the next segment. Every draw reading this one has already been submitted. */
+    ring_.fences[ring_.segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    ring_.segment = (ring_.segment + 1) % RING_BUFFER_SEGMENT_LEN;
+
+    GLsync &fence = ring_.fences[ring_.segment];
+    if (fence != nullptr) {
+      /* Wait for the GPU to be done with the previous use of the segment. */
+      GLenum status;
+      do {
+        status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+      } while (status == GL_TIMEOUT_EXPIRED);
+      glDeleteSync(fence);
+      fence = nullptr;
+    }
+
+    const size_t segment_start = (size_t)ring_.segment * RING_BUFFER_SEGMENT_SIZE;
+    offset = segment_start + padding(segment_start, vertex_format.stride);
+  }
+
+  glBindBuffer(GL_ARRAY_BUFFER, ring_.vbo_id);
+
+  ring_.buffer_offset = offset;
+  bytes_mapped_ = bytes_needed;
+  return ring_.data + offset;
+}
+
 uchar *GLImmediate::begin()
 {
   /* How many bytes do we need for this draw call? */
   const size_t bytes_needed = vertex_buffer_size(&vertex_format, vertex_len);
+
+  /* Leave room for the alignment padding at the start of a segment. */
+  use_ring_ = (ring_.vbo_id != 0) &&
+              (bytes_needed + vertex_format.stride <= RING_BUFFER_SEGMENT_SIZE);
+  if (use_ring_) {
+    GL_CHECK_RESOURCES("Immediate");
+    return ring_begin(bytes_needed);
+  }
+
   /* Does the current buffer have enough room? */
   const size_t available_bytes = buffer_size() - buffer_offset();
 
@@ -146,10 +214,14 @@ void GLImmediate::end()
       buffer_bytes_used = vertex_buffer_size(&vertex_format, vertex_len);
       /* unused buffer bytes are available to the next immBegin */
     }
-    /* tell OpenGL what range was modified so it doesn't copy the whole mapped range */
-    glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, buffer_bytes_used);
+    if (!use_ring_) {
+      /* tell OpenGL what range was modified so it doesn't copy the whole mapped range */
+      glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, buffer_bytes_used);
+    }
+  }
+  if (!use_ring_) {
+    glUnmapBuffer(GL_ARRAY_BUFFER);
   }
-  glUnmapBuffer(GL_ARRAY_BUFFER);
 
   if (vertex_len > 0) {
     GLContext::get()->state_manager->apply_state();
@@ -35,6 +35,9 @@ namespace blender::gpu {
 
 /* size of internal buffer */
 #define DEFAULT_INTERNAL_BUFFER_SIZE (4 * 1024 * 1024)
+/* Number of fenced segments the persistent ring buffer is split into. */
+#define RING_BUFFER_SEGMENT_LEN 4
+#define RING_BUFFER_SEGMENT_SIZE (DEFAULT_INTERNAL_BUFFER_SIZE / RING_BUFFER_SEGMENT_LEN)
 
 class GLImmediate : public Immediate {
  private:
@@ -49,6 +52,25 @@ class GLImmediate : public Immediate {
     /** Size of the whole buffer in bytes. */
     size_t buffer_size = 0;
   } buffer, buffer_strict;
+  /**
+   * Persistently mapped buffer used instead of the two above when `GL_ARB_buffer_storage` is
+   * supported. This avoids mapping and unmapping a buffer range for every draw. Draws are
+   * sub-allocated sequentially and each segment is fenced before it is written again.
+   */
+  struct {
+    /** Opengl Handle for this buffer. 0 if not supported. */
+    GLuint vbo_id = 0;
+    /** Offset of the mapped data in data. */
+    size_t buffer_offset = 0;
+    /** Persistent mapping of the whole buffer. */
+    uchar *data = nullptr;
+    /** Segment containing `buffer_offset`. */
+    int segment = 0;
+    /** Signaled when the GPU is done reading the segment. */
+    GLsync fences[RING_BUFFER_SEGMENT_LEN] = {nullptr};
+  } ring_;
+  /** True if the current draw is using `ring_`. */
+  bool use_ring_ = false;
   /** Size in bytes of the mapped region. */
   size_t bytes_mapped_ = 0;
   /** Vertex array for this immediate mode instance. */
@@ -62,13 +84,21 @@ class GLImmediate : public Immediate {
   void end(void) override;
 
  private:
+  uchar *ring_begin(size_t bytes_needed);
+
   GLuint &vbo_id(void)
   {
+    if (use_ring_) {
+      return ring_.vbo_id;
+    }
     return strict_vertex_len ? buffer_strict.vbo_id : buffer.vbo_id;
   };
 
   size_t &buffer_offset(void)
   {
+    if (use_ring_) {
+      return ring_.buffer_offset;
+    }
     return strict_vertex_len ? buffer_strict.buffer_offset : buffer.buffer_offset;
   };
 
@@ -197,6 +197,63 @@ bool GLShader::finalize()
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Program Binary
+ * \{ */
+
+void GLShader::binary_retrievable_set()
+{
+  if (GLContext::program_binary_support) {
+    glProgramParameteri(shader_program_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+  }
+}
+
+bool GLShader::binary_get(uint32_t &r_format, Vector<uint8_t> &r_data)
+{
+  if (!GLContext::program_binary_support) {
+    return false;
+  }
+
+  GLint binary_len = 0;
+  glGetProgramiv(shader_program_, GL_PROGRAM_BINARY_LENGTH, &binary_len);
+  if (binary_len <= 0) {
+    return false;
+  }
+
+  GLenum format = 0;
+  GLsizei written_len = 0;
+  r_data.resize(binary_len);
+  glGetProgramBinary(shader_program_, binary_len, &written_len, &format, r_data.data());
+  if (written_len <= 0) {
+    return false;
+  }
+  r_data.resize(written_len);
+  r_format = format;
+  return true;
+}
+
+bool GLShader::binary_set(uint32_t format, Span<uint8_t> data)
+{
+  if (!GLContext::program_binary_support) {
+    return false;
+  }
+
+  glProgramBinary(shader_program_, format, data.data(), data.size());
+
+  /* Drivers reject binaries made by another driver version, the caller compiles instead. */
+  GLint status;
+  glGetProgramiv(shader_program_, GL_LINK_STATUS, &status);
+  if (!status) {
+    return false;
+  }
+
+  interface = new GLShaderInterface(shader_program_);
+
+  return true;
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Binding
  * \{ */
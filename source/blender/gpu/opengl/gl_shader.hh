@@ -58,6 +58,10 @@ class GLShader : public Shader {
   void fragment_shader_from_glsl(MutableSpan<const char *> sources) override;
   bool finalize(void) override;
 
+  void binary_retrievable_set(void) override;
+  bool binary_get(uint32_t &r_format, Vector<uint8_t> &r_data) override;
+  bool binary_set(uint32_t format, Span<uint8_t> data) override;
+
   void transform_feedback_names_set(Span<const char *> name_list,
                                     const eGPUShaderTFBType geom_type) override;
   bool transform_feedback_enable(GPUVertBuf *buf) override;
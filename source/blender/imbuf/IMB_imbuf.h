@@ -122,6 +122,20 @@ struct ImBuf *IMB_testiffname(const char *filepath, int flags);
  */
 struct ImBuf *IMB_loadiffname(const char *filepath, int flags, char colorspace[IM_MAX_SPACE]);
 
+/**
+ * Load only a reduced resolution level of a tiled, mip-mapped file, the largest level that
+ * fits within \a max_size. Returns NULL when the file has no such levels or the full
+ * resolution already fits, callers then fall back to #IMB_loadiffname.
+ * \a r_full_size is set to the resolution of the full image.
+ *
+ * \attention Defined in readimage.c
+ */
+struct ImBuf *IMB_loadiffname_mip_level(const char *filepath,
+                                        int flags,
+                                        char colorspace[IM_MAX_SPACE],
+                                        int max_size,
+                                        int r_full_size[2]);
+
 /**
  *
  * \attention Defined in allocimbuf.c
@@ -382,6 +396,7 @@ bool IMB_anim_can_produce_frames(const struct anim *anim);
 int ismovie(const char *filepath);
 void IMB_anim_set_preseek(struct anim *anim, int preseek);
 int IMB_anim_get_preseek(struct anim *anim);
+void IMB_anim_set_hardware_decode(bool use_hardware_decode);
 int IMB_anim_get_image_width(struct anim *anim);
 int IMB_anim_get_image_height(struct anim *anim);
 
@@ -758,6 +773,9 @@ void IMB_update_gpu_texture_sub(struct GPUTexture *tex,
                                 int h,
                                 bool use_high_bitdepth,
                                 bool use_premult);
+struct GPUTexture *IMB_display_gpu_texture_ensure(struct ImBuf *ibuf);
+void IMB_display_gpu_texture_tag_freed(struct ImBuf *ibuf);
+void IMB_display_gpu_texture_free(void);
 
 /**
  *
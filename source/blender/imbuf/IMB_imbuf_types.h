@@ -299,6 +299,8 @@ enum {
   IB_DISPLAY_BUFFER_INVALID = (1 << 4),
   /** image buffer is persistent in the memory and should never be removed from the cache */
   IB_PERSISTENT = (1 << 5),
+  /** part of the float buffer changed in place, GPU display texture needs to be uploaded again */
+  IB_DISPLAY_TEXTURE_INVALID = (1 << 6),
 };
 
 /**
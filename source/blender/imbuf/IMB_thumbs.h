@@ -81,6 +81,13 @@ struct ImBuf *IMB_thumb_load_blend(const char *blen_path,
                                    const char *blen_group,
                                    const char *blen_id);
 
+/* load an image file at reduced size when the file type supports it */
+struct ImBuf *IMB_thumb_load_image(const char *filepath,
+                                   const size_t max_thumb_size,
+                                   char *colorspace,
+                                   size_t *r_width,
+                                   size_t *r_height);
+
 /* special function for previewing fonts */
 struct ImBuf *IMB_thumb_load_font(const char *filename, unsigned int x, unsigned int y);
 bool IMB_thumb_load_font_get_hash(char *r_hash);
@@ -80,6 +80,9 @@
 
 #define MAXNUMSTREAMS 50
 
+/* Maximum number of decoded movie frames kept per anim, see #anim.frame_cache. */
+#define FFMPEG_FRAME_CACHE_SIZE 32
+
 struct IDProperty;
 struct _AviMovie;
 struct anim_index;
@@ -132,10 +135,26 @@ struct anim {
   struct SwsContext *img_convert_ctx;
   int videoStream;
 
+  /* Hardware decoding, frames in hw_pix_fmt are copied to pFrameHWTransfer and converted with
+   * hw_convert_ctx, as the format of the copied frame is only known once decoding started.
+   * hw_pix_fmt is AV_PIX_FMT_NONE when decoding in software. */
+  enum AVPixelFormat hw_pix_fmt;
+  AVFrame *pFrameHWTransfer;
+  struct SwsContext *hw_convert_ctx;
+
   struct ImBuf *last_frame;
   int64_t last_pts;
   int64_t next_pts;
   AVPacket next_packet;
+
+  /* Frames decoded while scanning from a keyframe, so stepping backwards inside the
+   * same GOP does not decode it again. Each frame covers the PTS range [pts, next_pts). */
+  struct {
+    struct ImBuf *ibuf;
+    int64_t pts;
+    int64_t next_pts;
+  } frame_cache[FFMPEG_FRAME_CACHE_SIZE];
+  int frame_cache_next;
 #endif
 
   char index_dir[768];
@@ -105,6 +105,7 @@ void imb_freerectfloatImBuf(ImBuf *ibuf)
     ibuf->rect_float = NULL;
   }
 
+  IMB_display_gpu_texture_tag_freed(ibuf);
   imb_freemipmapImBuf(ibuf);
 
   ibuf->rect_float = NULL;
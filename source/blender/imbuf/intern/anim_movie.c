@@ -83,6 +83,10 @@
 #  include <libswscale/swscale.h>
 
 #  include "ffmpeg_compat.h"
+
+#  ifdef FFMPEG_HAVE_HWACCEL
+#    include <libavutil/hwcontext.h>
+#  endif
 #endif /* WITH_FFMPEG */
 
 int ismovie(const char *UNUSED(filepath))
@@ -201,6 +205,9 @@ static void free_anim_avi(struct anim *anim)
 
 #ifdef WITH_FFMPEG
 static void free_anim_ffmpeg(struct anim *anim);
+
+/* Set from the preferences, only affects movies opened afterwards. */
+static bool ffmpeg_use_hardware_decode = false;
 #endif
 
 void IMB_free_anim(struct anim *anim)
@@ -506,6 +513,147 @@ BLI_INLINE bool need_aligned_ffmpeg_buffer(struct anim *anim)
   return (anim->x & 31) != 0;
 }
 
+static void ffmpeg_swscale_colorspace_init(struct anim *anim, struct SwsContext *convert_ctx)
+{
+#  ifdef FFMPEG_SWSCALE_COLOR_SPACE_SUPPORT
+  /* The following for color space determination */
+  int srcRange, dstRange, brightness, contrast, saturation;
+  int *table;
+  const int *inv_table;
+
+  /* Try do detect if input has 0-255 YCbCR range (JFIF Jpeg MotionJpeg) */
+  if (!sws_getColorspaceDetails(convert_ctx,
+                                (int **)&inv_table,
+                                &srcRange,
+                                &table,
+                                &dstRange,
+                                &brightness,
+                                &contrast,
+                                &saturation)) {
+    srcRange = srcRange || anim->pCodecCtx->color_range == AVCOL_RANGE_JPEG;
+    inv_table = sws_getCoefficients(anim->pCodecCtx->colorspace);
+
+    if (sws_setColorspaceDetails(convert_ctx,
+                                 (int *)inv_table,
+                                 srcRange,
+                                 table,
+                                 dstRange,
+                                 brightness,
+                                 contrast,
+                                 saturation)) {
+      fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
+    }
+  }
+  else {
+    fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
+  }
+#  else
+  UNUSED_VARS(anim, convert_ctx);
+#  endif
+}
+
+#  ifdef FFMPEG_HAVE_HWACCEL
+static enum AVPixelFormat ffmpeg_hwaccel_get_format(AVCodecContext *pCodecCtx,
+                                                    const enum AVPixelFormat *pix_fmts)
+{
+  struct anim *anim = pCodecCtx->opaque;
+  const enum AVPixelFormat *p;
+
+  for (p = pix_fmts; *p != AV_PIX_FMT_NONE; p++) {
+    if (*p == anim->hw_pix_fmt) {
+      return *p;
+    }
+  }
+
+  /* The device can't decode this stream (e.g. unsupported profile), decode in software. */
+  av_log(pCodecCtx, AV_LOG_WARNING, "Hardware decoding not supported, using software decoder\n");
+  return avcodec_default_get_format(pCodecCtx, pix_fmts);
+}
+
+/* Attach the first hardware device that can be created for the codec, the decoder falls back to
+ * software decoding when none is available. */
+static void ffmpeg_hwaccel_init(struct anim *anim, AVCodecContext *pCodecCtx, AVCodec *pCodec)
+{
+  /* Device types in the order of preference. */
+  const enum AVHWDeviceType device_types[] = {
+      AV_HWDEVICE_TYPE_CUDA,
+      AV_HWDEVICE_TYPE_VAAPI,
+      AV_HWDEVICE_TYPE_VIDEOTOOLBOX,
+      AV_HWDEVICE_TYPE_D3D11VA,
+      AV_HWDEVICE_TYPE_DXVA2,
+  };
+
+  for (int i = 0; i < ARRAY_SIZE(device_types); i++) {
+    for (int j = 0;; j++) {
+      const AVCodecHWConfig *config = avcodec_get_hw_config(pCodec, j);
+      AVBufferRef *hw_device_ctx = NULL;
+
+      if (config == NULL) {
+        break;
+      }
+      if (config->device_type != device_types[i] ||
+          (config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) == 0) {
+        continue;
+      }
+      if (av_hwdevice_ctx_create(&hw_device_ctx, config->device_type, NULL, NULL, 0) < 0) {
+        break;
+      }
+
+      av_log(pCodecCtx,
+             AV_LOG_DEBUG,
+             "HWACCEL: using %s\n",
+             av_hwdevice_get_type_name(config->device_type));
+
+      /* The codec context owns the device from now on, it is freed by #avcodec_close. */
+      pCodecCtx->hw_device_ctx = hw_device_ctx;
+      pCodecCtx->opaque = anim;
+      pCodecCtx->get_format = ffmpeg_hwaccel_get_format;
+      anim->hw_pix_fmt = config->pix_fmt;
+      return;
+    }
+  }
+}
+
+/* Copy the hardware decoded anim->pFrame to system memory. */
+static AVFrame *ffmpeg_hwaccel_transfer_frame(struct anim *anim)
+{
+  if (anim->pFrameHWTransfer == NULL) {
+    anim->pFrameHWTransfer = av_frame_alloc();
+  }
+
+  AVFrame *frame = anim->pFrameHWTransfer;
+  av_frame_unref(frame);
+
+  if (av_hwframe_transfer_data(frame, anim->pFrame, 0) < 0) {
+    fprintf(stderr,
+            "ffmpeg_fetchibuf: "
+            "could not transfer hardware decoded frame...\n");
+    return NULL;
+  }
+
+  /* The format of the copied frame is chosen by the device (e.g. NV12 or P010). */
+  if (anim->hw_convert_ctx == NULL) {
+    anim->hw_convert_ctx = sws_getContext(anim->x,
+                                          anim->y,
+                                          frame->format,
+                                          anim->x,
+                                          anim->y,
+                                          AV_PIX_FMT_RGBA,
+                                          SWS_FAST_BILINEAR | SWS_FULL_CHR_H_INT,
+                                          NULL,
+                                          NULL,
+                                          NULL);
+    if (anim->hw_convert_ctx == NULL) {
+      fprintf(stderr, "Can't transform color space of hardware decoded frame...\n");
+      return NULL;
+    }
+    ffmpeg_swscale_colorspace_init(anim, anim->hw_convert_ctx);
+  }
+
+  return frame;
+}
+#  endif /* FFMPEG_HAVE_HWACCEL */
+
 static int startffmpeg(struct anim *anim)
 {
   int i, video_stream_index;
@@ -519,12 +667,6 @@ static int startffmpeg(struct anim *anim)
   double frs_den;
   int streamcount;
 
-#  ifdef FFMPEG_SWSCALE_COLOR_SPACE_SUPPORT
-  /* The following for color space determination */
-  int srcRange, dstRange, brightness, contrast, saturation;
-  int *table;
-  const int *inv_table;
-#  endif
 
   if (anim == NULL) {
     return (-1);
@@ -577,6 +719,14 @@ static int startffmpeg(struct anim *anim)
   pCodecCtx->thread_count = BLI_system_thread_count();
   pCodecCtx->thread_type = FF_THREAD_SLICE;
 
+  anim->hw_pix_fmt = AV_PIX_FMT_NONE;
+#  ifdef FFMPEG_HAVE_HWACCEL
+  /* Deinterlacing works on the pixel format of the software decoder. */
+  if (ffmpeg_use_hardware_decode && (anim->ib_flags & IB_animdeinterlace) == 0) {
+    ffmpeg_hwaccel_init(anim, pCodecCtx, pCodec);
+  }
+#  endif
+
   if (avcodec_open2(pCodecCtx, pCodec, NULL) < 0) {
     avformat_close_input(&pFormatCtx);
     return -1;
@@ -718,54 +868,129 @@ static int startffmpeg(struct anim *anim)
     return -1;
   }
 
-#  ifdef FFMPEG_SWSCALE_COLOR_SPACE_SUPPORT
-  /* Try do detect if input has 0-255 YCbCR range (JFIF Jpeg MotionJpeg) */
-  if (!sws_getColorspaceDetails(anim->img_convert_ctx,
-                                (int **)&inv_table,
-                                &srcRange,
-                                &table,
-                                &dstRange,
-                                &brightness,
-                                &contrast,
-                                &saturation)) {
-    srcRange = srcRange || anim->pCodecCtx->color_range == AVCOL_RANGE_JPEG;
-    inv_table = sws_getCoefficients(anim->pCodecCtx->colorspace);
+  ffmpeg_swscale_colorspace_init(anim, anim->img_convert_ctx);
 
-    if (sws_setColorspaceDetails(anim->img_convert_ctx,
-                                 (int *)inv_table,
-                                 srcRange,
-                                 table,
-                                 dstRange,
-                                 brightness,
-                                 contrast,
-                                 saturation)) {
-      fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
+  return 0;
+}
+
+static ImBuf *ffmpeg_frame_ibuf_alloc(struct anim *anim)
+{
+  /* Certain versions of FFmpeg have a bug in libswscale which ends up in crash
+   * when destination buffer is not properly aligned. For example, this happens
+   * in FFmpeg 4.3.1. It got fixed later on, but for compatibility reasons is
+   * still best to avoid crash.
+   *
+   * This is achieved by using own allocation call rather than relying on
+   * IMB_allocImBuf() to do so since the IMB_allocImBuf() is not guaranteed
+   * to perform aligned allocation.
+   *
+   * In theory this could give better performance, since SIMD operations on
+   * aligned data are usually faster.
+   *
+   * Note that even though sometimes vertical flip is required it does not
+   * affect on alignment of data passed to sws_scale because if the X dimension
+   * is not 32 byte aligned special intermediate buffer is allocated.
+   *
+   * The issue was reported to FFmpeg under ticket #8747 in the FFmpeg tracker
+   * and is fixed in the newer versions than 4.3.1. */
+  ImBuf *ibuf = IMB_allocImBuf(anim->x, anim->y, 32, 0);
+  ibuf->rect = MEM_mallocN_aligned((size_t)4 * anim->x * anim->y, 32, "ffmpeg ibuf");
+  ibuf->mall |= IB_rect;
+
+  ibuf->rect_colorspace = colormanage_colorspace_get_named(anim->colorspace);
+
+  return ibuf;
+}
+
+/* Budget for the decoded frames of the GOP cache, the number of cached frames is limited
+ * so that high resolution footage does not take too much memory. */
+#define FFMPEG_FRAME_CACHE_MEMORY (256 * 1024 * 1024)
+
+static int ffmpeg_frame_cache_size(struct anim *anim)
+{
+  const size_t frame_size = (size_t)4 * anim->x * anim->y;
+  const size_t size = FFMPEG_FRAME_CACHE_MEMORY / MAX2(frame_size, 1);
+
+  return (int)CLAMPIS(size, 2, FFMPEG_FRAME_CACHE_SIZE);
+}
+
+static void ffmpeg_frame_cache_add(struct anim *anim, ImBuf *ibuf, int64_t pts, int64_t next_pts)
+{
+  const int size = ffmpeg_frame_cache_size(anim);
+
+  if (next_pts <= pts) {
+    return;
+  }
+
+  /* Frame is cached already, this happens when playing back over previously scanned frames. */
+  for (int i = 0; i < FFMPEG_FRAME_CACHE_SIZE; i++) {
+    if (anim->frame_cache[i].ibuf && anim->frame_cache[i].pts == pts) {
+      return;
     }
   }
-  else {
-    fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
+
+  /* Overwrite the oldest frame, when scanning forward from a keyframe this keeps the frames
+   * closest to the one requested. */
+  const int index = anim->frame_cache_next % size;
+  if (anim->frame_cache[index].ibuf) {
+    IMB_freeImBuf(anim->frame_cache[index].ibuf);
   }
-#  endif
 
-  return 0;
+  IMB_refImBuf(ibuf);
+  anim->frame_cache[index].ibuf = ibuf;
+  anim->frame_cache[index].pts = pts;
+  anim->frame_cache[index].next_pts = next_pts;
+  anim->frame_cache_next = (index + 1) % size;
+}
+
+static ImBuf *ffmpeg_frame_cache_lookup(struct anim *anim, int64_t pts)
+{
+  for (int i = 0; i < FFMPEG_FRAME_CACHE_SIZE; i++) {
+    if (anim->frame_cache[i].ibuf && anim->frame_cache[i].pts <= pts &&
+        anim->frame_cache[i].next_pts > pts) {
+      return anim->frame_cache[i].ibuf;
+    }
+  }
+  return NULL;
+}
+
+static void ffmpeg_frame_cache_free(struct anim *anim)
+{
+  for (int i = 0; i < FFMPEG_FRAME_CACHE_SIZE; i++) {
+    if (anim->frame_cache[i].ibuf) {
+      IMB_freeImBuf(anim->frame_cache[i].ibuf);
+      anim->frame_cache[i].ibuf = NULL;
+    }
+  }
+  anim->frame_cache_next = 0;
 }
 
 /* postprocess the image in anim->pFrame and do color conversion
  * and deinterlacing stuff.
  *
- * Output is anim->last_frame
+ * Output is ibuf, usually anim->last_frame
  */
 
-static void ffmpeg_postprocess(struct anim *anim)
+static void ffmpeg_postprocess(struct anim *anim, ImBuf *ibuf)
 {
   AVFrame *input = anim->pFrame;
-  ImBuf *ibuf = anim->last_frame;
+  struct SwsContext *convert_ctx = anim->img_convert_ctx;
   int filter_y = 0;
 
   if (!anim->pFrameComplete) {
     return;
   }
 
+#  ifdef FFMPEG_HAVE_HWACCEL
+  if (input->format == anim->hw_pix_fmt) {
+    input = ffmpeg_hwaccel_transfer_frame(anim);
+    if (input == NULL) {
+      return;
+    }
+    convert_ctx = anim->hw_convert_ctx;
+  }
+#  endif
+
   /* This means the data wasn't read properly,
    * this check stops crashing */
   if (input->data[0] == 0 && input->data[1] == 0 && input->data[2] == 0 && input->data[3] == 0) {
@@ -813,7 +1038,7 @@ static void ffmpeg_postprocess(struct anim *anim)
     unsigned char *bottom;
     unsigned char *top;
 
-    sws_scale(anim->img_convert_ctx,
+    sws_scale(convert_ctx,
               (const uint8_t *const *)input->data,
               input->linesize,
               0,
@@ -856,7 +1081,7 @@ static void ffmpeg_postprocess(struct anim *anim)
     const int dstStride2[4] = {-dstStride[0], 0, 0, 0};
     uint8_t *dst2[4] = {dst[0] + (anim->y - 1) * dstStride[0], 0, 0, 0};
 
-    sws_scale(anim->img_convert_ctx,
+    sws_scale(convert_ctx,
               (const uint8_t *const *)input->data,
               input->linesize,
               0,
@@ -986,7 +1211,25 @@ static void ffmpeg_decode_video_frame_scan(struct anim *anim, int64_t pts_to_sea
            "  WHILE: pts=%" PRId64 " in search of %" PRId64 "\n",
            (int64_t)anim->next_pts,
            (int64_t)pts_to_search);
-    if (!ffmpeg_decode_video_frame(anim)) {
+
+    /* Keep the skipped frame, it is likely to be requested next when scrubbing backwards. */
+    ImBuf *skipped_ibuf = NULL;
+    const int64_t skipped_pts = anim->next_pts;
+    if (anim->pFrameComplete && skipped_pts != -1) {
+      skipped_ibuf = ffmpeg_frame_ibuf_alloc(anim);
+      ffmpeg_postprocess(anim, skipped_ibuf);
+    }
+
+    const bool decoded = ffmpeg_decode_video_frame(anim);
+
+    if (skipped_ibuf) {
+      if (decoded) {
+        ffmpeg_frame_cache_add(anim, skipped_ibuf, skipped_pts, anim->next_pts);
+      }
+      IMB_freeImBuf(skipped_ibuf);
+    }
+
+    if (!decoded) {
       break;
     }
     count--;
@@ -1110,6 +1353,15 @@ static ImBuf *ffmpeg_fetchibuf(struct anim *anim, int position, IMB_Timecode_Typ
     return anim->last_frame;
   }
 
+  /* The decoder state is left untouched, so curposition keeps referring to the last decoded
+   * frame and the seek logic below stays valid for the next request. */
+  ImBuf *cached_ibuf = ffmpeg_frame_cache_lookup(anim, pts_to_search);
+  if (cached_ibuf) {
+    av_log(anim->pFormatCtx, AV_LOG_DEBUG, "FETCH: frame found in GOP cache\n");
+    IMB_refImBuf(cached_ibuf);
+    return cached_ibuf;
+  }
+
   if (position > anim->curposition + 1 && anim->preseek && !tc_index &&
       position - (anim->curposition + 1) < anim->preseek) {
     av_log(anim->pFormatCtx, AV_LOG_DEBUG, "FETCH: within preseek interval (no index)\n");
@@ -1207,36 +1459,20 @@ static ImBuf *ffmpeg_fetchibuf(struct anim *anim, int position, IMB_Timecode_Typ
 
   IMB_freeImBuf(anim->last_frame);
 
-  /* Certain versions of FFmpeg have a bug in libswscale which ends up in crash
-   * when destination buffer is not properly aligned. For example, this happens
-   * in FFmpeg 4.3.1. It got fixed later on, but for compatibility reasons is
-   * still best to avoid crash.
-   *
-   * This is achieved by using own allocation call rather than relying on
-   * IMB_allocImBuf() to do so since the IMB_allocImBuf() is not guaranteed
-   * to perform aligned allocation.
-   *
-   * In theory this could give better performance, since SIMD operations on
-   * aligned data are usually faster.
-   *
-   * Note that even though sometimes vertical flip is required it does not
-   * affect on alignment of data passed to sws_scale because if the X dimension
-   * is not 32 byte aligned special intermediate buffer is allocated.
-   *
-   * The issue was reported to FFmpeg under ticket #8747 in the FFmpeg tracker
-   * and is fixed in the newer versions than 4.3.1. */
-  anim->last_frame = IMB_allocImBuf(anim->x, anim->y, 32, 0);
-  anim->last_frame->rect = MEM_mallocN_aligned((size_t)4 * anim->x * anim->y, 32, "ffmpeg ibuf");
-  anim->last_frame->mall |= IB_rect;
+  anim->last_frame = ffmpeg_frame_ibuf_alloc(anim);
 
-  anim->last_frame->rect_colorspace = colormanage_colorspace_get_named(anim->colorspace);
+  const bool frame_complete = anim->pFrameComplete;
 
-  ffmpeg_postprocess(anim);
+  ffmpeg_postprocess(anim, anim->last_frame);
 
   anim->last_pts = anim->next_pts;
 
   ffmpeg_decode_video_frame(anim);
 
+  if (frame_complete) {
+    ffmpeg_frame_cache_add(anim, anim->last_frame, anim->last_pts, anim->next_pts);
+  }
+
   anim->curposition = position;
 
   IMB_refImBuf(anim->last_frame);
@@ -1272,8 +1508,12 @@ static void free_anim_ffmpeg(struct anim *anim)
     av_frame_free(&anim->pFrameRGB);
     av_frame_free(&anim->pFrameDeinterlaced);
 
+    av_frame_free(&anim->pFrameHWTransfer);
+
     sws_freeContext(anim->img_convert_ctx);
+    sws_freeContext(anim->hw_convert_ctx);
     IMB_freeImBuf(anim->last_frame);
+    ffmpeg_frame_cache_free(anim);
     if (anim->next_packet.stream_index != -1) {
       av_free_packet(&anim->next_packet);
     }
@@ -1508,6 +1748,15 @@ int IMB_anim_get_preseek(struct anim *anim)
   return anim->preseek;
 }
 
+void IMB_anim_set_hardware_decode(bool use_hardware_decode)
+{
+#ifdef WITH_FFMPEG
+  ffmpeg_use_hardware_decode = use_hardware_decode;
+#else
+  UNUSED_VARS(use_hardware_decode);
+#endif
+}
+
 int IMB_anim_get_image_width(struct anim *anim)
 {
   return anim->x;
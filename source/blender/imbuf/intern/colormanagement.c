@@ -104,6 +104,9 @@ typedef struct ColormanageProcessor {
   OCIO_ConstCPUProcessorRcPtr *cpu_processor;
   CurveMapping *curve_mapping;
   bool is_data_result;
+  /* Display transform is exactly scene linear to sRGB, the lookup tables of BLI_math_color
+   * can be used instead of the OCIO processor. */
+  bool is_srgb_result;
 } ColormanageProcessor;
 
 static struct global_gpu_state {
@@ -783,6 +786,35 @@ void colormanage_cache_free(ImBuf *ibuf)
   }
 }
 
+/* Check if the pixels changed since the display texture was last uploaded, for GLSL drawing
+ * which does not acquire display buffers. Invalidation of the cached display buffers is
+ * propagated the same way #IMB_display_buffer_acquire does before the flag is cleared. */
+bool colormanage_display_texture_check_changed(ImBuf *ibuf)
+{
+  bool changed = false;
+
+  BLI_thread_lock(LOCK_COLORMANAGE);
+
+  if (ibuf->userflags & IB_DISPLAY_BUFFER_INVALID) {
+    if (ibuf->display_buffer_flags) {
+      memset(ibuf->display_buffer_flags, 0, global_tot_display * sizeof(unsigned int));
+    }
+    if (ibuf->rect) {
+      /* Keep the byte buffer marked for recreation from float. */
+      ibuf->userflags |= IB_RECT_INVALID;
+    }
+    changed = true;
+  }
+  if (ibuf->userflags & IB_DISPLAY_TEXTURE_INVALID) {
+    changed = true;
+  }
+  ibuf->userflags &= ~(IB_DISPLAY_BUFFER_INVALID | IB_DISPLAY_TEXTURE_INVALID);
+
+  BLI_thread_unlock(LOCK_COLORMANAGE);
+
+  return changed;
+}
+
 void IMB_colormanagement_display_settings_from_ctx(
     const bContext *C,
     ColorManagedViewSettings **r_view_settings,
@@ -1440,6 +1472,9 @@ typedef struct DisplayBufferThread {
 
   const char *byte_colorspace;
   const char *float_colorspace;
+
+  bool byte_is_srgb;
+  bool byte_is_scene_linear;
 } DisplayBufferThread;
 
 typedef struct DisplayBufferInitData {
@@ -1505,6 +1540,14 @@ static void display_buffer_init_handle(void *handle_v,
 
   handle->byte_colorspace = init_data->byte_colorspace;
   handle->float_colorspace = init_data->float_colorspace;
+
+  if (handle->byte_colorspace) {
+    ColorSpace *colorspace = colormanage_colorspace_get_named(handle->byte_colorspace);
+    if (colorspace) {
+      handle->byte_is_srgb = IMB_colormanagement_space_is_srgb(colorspace);
+      handle->byte_is_scene_linear = IMB_colormanagement_space_is_scene_linear(colorspace);
+    }
+  }
 }
 
 static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
@@ -1532,6 +1575,17 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
     const size_t i_last = ((size_t)width) * height;
     size_t i;
 
+    if (channels == 4 && handle->byte_is_srgb && !is_data && !is_data_display) {
+      /* Common case of sRGB images, convert to scene linear with a lookup table. */
+      for (i = 0, fp = linear_buffer, cp = byte_buffer; i != i_last;
+           i++, fp += channels, cp += channels) {
+        srgb_to_linearrgb_uchar4(fp, cp);
+      }
+
+      *is_straight_alpha = true;
+      return;
+    }
+
     /* first convert byte buffer to float, keep in image space */
     for (i = 0, fp = linear_buffer, cp = byte_buffer; i != i_last;
          i++, fp += channels, cp += channels) {
@@ -1546,7 +1600,7 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
       }
     }
 
-    if (!is_data && !is_data_display) {
+    if (!is_data && !is_data_display && !handle->byte_is_scene_linear) {
       /* convert float buffer to scene linear space */
       IMB_colormanagement_transform(
           linear_buffer, width, height, channels, from_colorspace, to_colorspace, false);
@@ -1586,9 +1640,8 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
   }
 }
 
-static void *do_display_buffer_apply_thread(void *handle_v)
+static void display_buffer_apply_processor(DisplayBufferThread *handle)
 {
-  DisplayBufferThread *handle = (DisplayBufferThread *)handle_v;
   ColormanageProcessor *cm_processor = handle->cm_processor;
   float *display_buffer = handle->display_buffer;
   unsigned char *display_buffer_byte = handle->display_buffer_byte;
@@ -1598,6 +1651,114 @@ static void *do_display_buffer_apply_thread(void *handle_v)
   float dither = handle->dither;
   bool is_data = handle->is_data;
 
+  bool is_straight_alpha;
+  float *linear_buffer = MEM_mallocN(((size_t)channels) * width * height * sizeof(float),
+                                     "color conversion linear buffer");
+
+  display_buffer_apply_get_linear_buffer(handle, height, linear_buffer, &is_straight_alpha);
+
+  bool predivide = handle->predivide && (is_straight_alpha == false);
+
+  if (is_data) {
+    /* special case for data buffers - no color space conversions,
+     * only generate byte buffers
+     */
+  }
+  else {
+    /* apply processor */
+    IMB_colormanagement_processor_apply(
+        cm_processor, linear_buffer, width, height, channels, predivide);
+  }
+
+  /* copy result to output buffers */
+  if (display_buffer_byte) {
+    /* do conversion */
+    IMB_buffer_byte_from_float(display_buffer_byte,
+                               linear_buffer,
+                               channels,
+                               dither,
+                               IB_PROFILE_SRGB,
+                               IB_PROFILE_SRGB,
+                               predivide,
+                               width,
+                               height,
+                               width,
+                               width);
+  }
+
+  if (display_buffer) {
+    memcpy(display_buffer, linear_buffer, ((size_t)width) * height * channels * sizeof(float));
+
+    if (is_straight_alpha && channels == 4) {
+      const size_t i_last = ((size_t)width) * height;
+      size_t i;
+      float *fp;
+
+      for (i = 0, fp = display_buffer; i != i_last; i++, fp += channels) {
+        straight_to_premul_v4(fp);
+      }
+    }
+  }
+
+  MEM_freeN(linear_buffer);
+}
+
+/* Plain sRGB display of scene linear float or sRGB byte buffers, convert straight to the
+ * display buffer through lookup tables, without the intermediate linear buffer and OCIO.
+ * Returns false when the buffer needs the regular processor. */
+static bool display_buffer_apply_srgb(DisplayBufferThread *handle)
+{
+  ColormanageProcessor *cm_processor = handle->cm_processor;
+  int width = handle->width;
+  int height = handle->tot_line;
+
+  if (!cm_processor->is_srgb_result || handle->is_data || handle->channels != 4 ||
+      handle->display_buffer != NULL || handle->display_buffer_byte == NULL) {
+    return false;
+  }
+
+  if (handle->buffer) {
+    if (handle->float_colorspace != NULL) {
+      return false;
+    }
+    IMB_buffer_byte_from_float(handle->display_buffer_byte,
+                               handle->buffer,
+                               handle->channels,
+                               handle->dither,
+                               IB_PROFILE_SRGB,
+                               IB_PROFILE_LINEAR_RGB,
+                               handle->predivide,
+                               width,
+                               height,
+                               width,
+                               width);
+    return true;
+  }
+
+  if (!handle->byte_is_srgb) {
+    return false;
+  }
+  IMB_buffer_byte_from_byte(handle->display_buffer_byte,
+                            handle->byte_buffer,
+                            IB_PROFILE_SRGB,
+                            IB_PROFILE_SRGB,
+                            false,
+                            width,
+                            height,
+                            width,
+                            width);
+  return true;
+}
+
+static void *do_display_buffer_apply_thread(void *handle_v)
+{
+  DisplayBufferThread *handle = (DisplayBufferThread *)handle_v;
+  ColormanageProcessor *cm_processor = handle->cm_processor;
+  float *display_buffer = handle->display_buffer;
+  unsigned char *display_buffer_byte = handle->display_buffer_byte;
+  int width = handle->width;
+  int height = handle->tot_line;
+
   if (cm_processor == NULL) {
     if (display_buffer_byte && display_buffer_byte != handle->byte_buffer) {
       IMB_buffer_byte_from_byte(display_buffer_byte,
@@ -1623,57 +1784,8 @@ static void *do_display_buffer_apply_thread(void *handle_v)
                                  width);
     }
   }
-  else {
-    bool is_straight_alpha;
-    float *linear_buffer = MEM_mallocN(((size_t)channels) * width * height * sizeof(float),
-                                       "color conversion linear buffer");
-
-    display_buffer_apply_get_linear_buffer(handle, height, linear_buffer, &is_straight_alpha);
-
-    bool predivide = handle->predivide && (is_straight_alpha == false);
-
-    if (is_data) {
-      /* special case for data buffers - no color space conversions,
-       * only generate byte buffers
-       */
-    }
-    else {
-      /* apply processor */
-      IMB_colormanagement_processor_apply(
-          cm_processor, linear_buffer, width, height, channels, predivide);
-    }
-
-    /* copy result to output buffers */
-    if (display_buffer_byte) {
-      /* do conversion */
-      IMB_buffer_byte_from_float(display_buffer_byte,
-                                 linear_buffer,
-                                 channels,
-                                 dither,
-                                 IB_PROFILE_SRGB,
-                                 IB_PROFILE_SRGB,
-                                 predivide,
-                                 width,
-                                 height,
-                                 width,
-                                 width);
-    }
-
-    if (display_buffer) {
-      memcpy(display_buffer, linear_buffer, ((size_t)width) * height * channels * sizeof(float));
-
-      if (is_straight_alpha && channels == 4) {
-        const size_t i_last = ((size_t)width) * height;
-        size_t i;
-        float *fp;
-
-        for (i = 0, fp = display_buffer; i != i_last; i++, fp += channels) {
-          straight_to_premul_v4(fp);
-        }
-      }
-    }
-
-    MEM_freeN(linear_buffer);
+  else if (!display_buffer_apply_srgb(handle)) {
+    display_buffer_apply_processor(handle);
   }
 
   return NULL;
@@ -3581,6 +3693,8 @@ static void imb_partial_display_buffer_update_ex(
   unsigned char *display_buffer = NULL;
   int buffer_width = ibuf->x;
 
+  ibuf->userflags |= IB_DISPLAY_TEXTURE_INVALID;
+
   if (ibuf->display_buffer_flags) {
     int view_flag, display_index;
 
@@ -3732,6 +3846,8 @@ void IMB_partial_display_buffer_update_threaded(
 
 void IMB_partial_display_buffer_update_delayed(ImBuf *ibuf, int xmin, int ymin, int xmax, int ymax)
 {
+  ibuf->userflags |= IB_DISPLAY_TEXTURE_INVALID;
+
   if (ibuf->invalid_rect.xmin == ibuf->invalid_rect.xmax) {
     BLI_rcti_init(&ibuf->invalid_rect, xmin, xmax, ymin, ymax);
   }
@@ -3784,6 +3900,12 @@ ColormanageProcessor *IMB_colormanagement_display_processor_new(
     cm_processor->curve_mapping = BKE_curvemapping_copy(applied_view_settings->curve_mapping);
     BKE_curvemapping_premultiply(cm_processor->curve_mapping, false);
   }
+  else if (display_space && !display_space->is_data &&
+           !colormanage_use_look(applied_view_settings->look,
+                                 applied_view_settings->view_transform) &&
+           applied_view_settings->exposure == 0.0f && applied_view_settings->gamma == 1.0f) {
+    cm_processor->is_srgb_result = IMB_colormanagement_space_is_srgb(display_space);
+  }
 
   return cm_processor;
 }
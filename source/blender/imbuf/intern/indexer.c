@@ -29,6 +29,7 @@
 #include "BLI_ghash.h"
 #include "BLI_path_util.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 #ifdef _WIN32
@@ -842,6 +843,12 @@ static void index_rebuild_ffmpeg_finish(FFmpegIndexBuilderContext *context, int
   MEM_freeN(context);
 }
 
+static void index_rebuild_ffmpeg_proxy_task(TaskPool *__restrict pool, void *taskdata)
+{
+  AVFrame *in_frame = BLI_task_pool_user_data(pool);
+  add_to_proxy_output_ffmpeg(taskdata, in_frame);
+}
+
 static void index_rebuild_ffmpeg_proc_decoded_frame(FFmpegIndexBuilderContext *context,
                                                     AVPacket *curr_packet,
                                                     AVFrame *in_frame)
@@ -850,9 +857,31 @@ static void index_rebuild_ffmpeg_proc_decoded_frame(FFmpegIndexBuilderContext *c
   uint64_t s_pos = context->seek_pos;
   uint64_t s_dts = context->seek_pos_dts;
   uint64_t pts = av_get_pts_from_frame(context->iFormatCtx, in_frame);
+  int num_proxies = 0;
 
   for (i = 0; i < context->num_proxy_sizes; i++) {
-    add_to_proxy_output_ffmpeg(context->proxy_ctx[i], in_frame);
+    if (context->proxy_ctx[i]) {
+      num_proxies++;
+    }
+  }
+
+  if (num_proxies > 1) {
+    /* Every proxy size has its own scaler, encoder and file, encode them in parallel from the
+     * same decoded frame. */
+    TaskPool *task_pool = BLI_task_pool_create(in_frame, TASK_PRIORITY_HIGH);
+    for (i = 0; i < context->num_proxy_sizes; i++) {
+      if (context->proxy_ctx[i]) {
+        BLI_task_pool_push(
+            task_pool, index_rebuild_ffmpeg_proxy_task, context->proxy_ctx[i], false, NULL);
+      }
+    }
+    BLI_task_pool_work_and_wait(task_pool);
+    BLI_task_pool_free(task_pool);
+  }
+  else {
+    for (i = 0; i < context->num_proxy_sizes; i++) {
+      add_to_proxy_output_ffmpeg(context->proxy_ctx[i], in_frame);
+    }
   }
 
   if (!context->start_pts_set) {
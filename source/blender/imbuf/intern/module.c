@@ -40,6 +40,7 @@ void IMB_exit(void)
 {
   imb_tile_cache_exit();
   imb_filetypes_exit();
+  IMB_display_gpu_texture_free();
   colormanagement_exit();
   imb_mmap_lock_exit();
   imb_refcounter_lock_exit();
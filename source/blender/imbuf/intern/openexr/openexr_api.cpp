@@ -42,6 +42,7 @@
 #include <ImfInputFile.h>
 #include <ImfOutputFile.h>
 #include <ImfPixelType.h>
+#include <ImfPreviewImage.h>
 #include <ImfStandardAttributes.h>
 #include <ImfStringAttribute.h>
 #include <ImfVersion.h>
@@ -55,6 +56,7 @@
 #include <ImfOutputPart.h>
 #include <ImfPartHelper.h>
 #include <ImfPartType.h>
+#include <ImfTiledInputPart.h>
 #include <ImfTiledOutputPart.h>
 
 #include "DNA_scene_types.h" /* For OpenEXR compression constants */
@@ -78,6 +80,7 @@ _CRTIMP void __cdecl _invalid_parameter_noinfo(void)
 }
 #include "BLI_blenlib.h"
 #include "BLI_math_color.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 
 #include "BKE_idprop.h"
@@ -1209,6 +1212,78 @@ void IMB_exrtile_write_channels(
   }
 }
 
+struct ExrReadPartData {
+  ExrHandle *data;
+  short flip;
+};
+
+static void exr_read_part(ExrHandle *data, int part_number, short flip)
+{
+  /* Read part header. */
+  InputPart in(*data->ifile, part_number);
+  Header header = in.header();
+  Box2i dw = header.dataWindow();
+
+  /* Insert all matching channel into frame-buffer. */
+  FrameBuffer frameBuffer;
+  ExrChannel *echan;
+
+  for (echan = (ExrChannel *)data->channels.first; echan; echan = echan->next) {
+    if (echan->m->part_number != part_number) {
+      continue;
+    }
+
+    exr_printf("%d %-6s %-22s \"%s\"\n",
+               echan->m->part_number,
+               echan->m->view.c_str(),
+               echan->m->name.c_str(),
+               echan->m->internal_name.c_str());
+
+    if (echan->rect) {
+      float *rect = echan->rect;
+      size_t xstride = echan->xstride * sizeof(float);
+      size_t ystride = echan->ystride * sizeof(float);
+
+      if (!flip) {
+        /* Inverse correct first pixel for data-window coordinates. */
+        rect -= echan->xstride * (dw.min.x - dw.min.y * data->width);
+        /* move to last scanline to flip to Blender convention */
+        rect += echan->xstride * (data->height - 1) * data->width;
+        ystride = -ystride;
+      }
+      else {
+        /* Inverse correct first pixel for data-window coordinates. */
+        rect -= echan->xstride * (dw.min.x + dw.min.y * data->width);
+      }
+
+      frameBuffer.insert(echan->m->internal_name,
+                         Slice(Imf::FLOAT, (char *)rect, xstride, ystride));
+    }
+    else {
+      printf("warning, channel with no rect set %s\n", echan->m->internal_name.c_str());
+    }
+  }
+
+  /* Read pixels. */
+  in.setFrameBuffer(frameBuffer);
+  exr_printf(
+      "readPixels:readPixels[%d]: min.y: %d, max.y: %d\n", part_number, dw.min.y, dw.max.y);
+  in.readPixels(dw.min.y, dw.max.y);
+}
+
+static void exr_read_part_task(TaskPool *__restrict pool, void *taskdata)
+{
+  ExrReadPartData *read_data = (ExrReadPartData *)BLI_task_pool_user_data(pool);
+  const int part_number = POINTER_AS_INT(taskdata);
+
+  try {
+    exr_read_part(read_data->data, part_number, read_data->flip);
+  }
+  catch (const std::exception &exc) {
+    std::cerr << "OpenEXR-readPixels: ERROR: " << exc.what() << std::endl;
+  }
+}
+
 void IMB_exr_read_channels(void *handle)
 {
   ExrHandle *data = (ExrHandle *)handle;
@@ -1229,63 +1304,26 @@ void IMB_exr_read_channels(void *handle)
       "name",
       "internal_name");
 
-  for (int i = 0; i < numparts; i++) {
-    /* Read part header. */
-    InputPart in(*data->ifile, i);
-    Header header = in.header();
-    Box2i dw = header.dataWindow();
-
-    /* Insert all matching channel into frame-buffer. */
-    FrameBuffer frameBuffer;
-    ExrChannel *echan;
-
-    for (echan = (ExrChannel *)data->channels.first; echan; echan = echan->next) {
-      if (echan->m->part_number != i) {
-        continue;
-      }
-
-      exr_printf("%d %-6s %-22s \"%s\"\n",
-                 echan->m->part_number,
-                 echan->m->view.c_str(),
-                 echan->m->name.c_str(),
-                 echan->m->internal_name.c_str());
-
-      if (echan->rect) {
-        float *rect = echan->rect;
-        size_t xstride = echan->xstride * sizeof(float);
-        size_t ystride = echan->ystride * sizeof(float);
-
-        if (!flip) {
-          /* Inverse correct first pixel for data-window coordinates. */
-          rect -= echan->xstride * (dw.min.x - dw.min.y * data->width);
-          /* move to last scanline to flip to Blender convention */
-          rect += echan->xstride * (data->height - 1) * data->width;
-          ystride = -ystride;
-        }
-        else {
-          /* Inverse correct first pixel for data-window coordinates. */
-          rect -= echan->xstride * (dw.min.x + dw.min.y * data->width);
-        }
-
-        frameBuffer.insert(echan->m->internal_name,
-                           Slice(Imf::FLOAT, (char *)rect, xstride, ystride));
-      }
-      else {
-        printf("warning, channel with no rect set %s\n", echan->m->internal_name.c_str());
-      }
-    }
-
-    /* Read pixels. */
+  if (numparts == 1) {
     try {
-      in.setFrameBuffer(frameBuffer);
-      exr_printf("readPixels:readPixels[%d]: min.y: %d, max.y: %d\n", i, dw.min.y, dw.max.y);
-      in.readPixels(dw.min.y, dw.max.y);
+      exr_read_part(data, 0, flip);
     }
     catch (const std::exception &exc) {
       std::cerr << "OpenEXR-readPixels: ERROR: " << exc.what() << std::endl;
-      break;
     }
+    return;
   }
+
+  /* Parts (views of multi-view files) are independent, decompress them in parallel. Reading
+   * from the shared stream is serialized by OpenEXR, scanline blocks of each part are still
+   * decompressed by its global thread pool. */
+  ExrReadPartData read_data = {data, flip};
+  TaskPool *task_pool = BLI_task_pool_create(&read_data, TASK_PRIORITY_HIGH);
+  for (int i = 0; i < numparts; i++) {
+    BLI_task_pool_push(task_pool, exr_read_part_task, POINTER_FROM_INT(i), false, nullptr);
+  }
+  BLI_task_pool_work_and_wait(task_pool);
+  BLI_task_pool_free(task_pool);
 }
 
 void IMB_exr_multilayer_convert(void *handle,
@@ -2096,6 +2134,149 @@ struct ImBuf *imb_load_openexr(const unsigned char *mem,
   }
 }
 
+struct ImBuf *imb_load_openexr_mip_level(const unsigned char *mem,
+                                         size_t size,
+                                         int flags,
+                                         char colorspace[IM_MAX_SPACE],
+                                         int max_size,
+                                         int r_full_size[2])
+{
+  struct ImBuf *ibuf = nullptr;
+
+  if (imb_is_a_openexr(mem, size) == 0) {
+    return nullptr;
+  }
+
+  colorspace_set_default_role(colorspace, IM_MAX_SPACE, COLOR_ROLE_DEFAULT_FLOAT);
+
+  try {
+    IMemStream membuf((unsigned char *)mem, size);
+    MultiPartInputFile file(membuf);
+    const Header &header = file.header(0);
+
+    if (imb_exr_is_multi(file) || !header.hasTileDescription() ||
+        header.tileDescription().mode != MIPMAP_LEVELS) {
+      return nullptr;
+    }
+
+    /* Only plain RGB(A) images, other channel layouts use the regular loading. */
+    const char *rgb_channels[3];
+    if (exr_has_rgb(file, rgb_channels) != 3) {
+      return nullptr;
+    }
+
+    TiledInputPart in(file, 0);
+    int level = 0;
+    while (level < in.numLevels() - 1 &&
+           std::max(in.levelWidth(level), in.levelHeight(level)) > max_size) {
+      level++;
+    }
+    if (level == 0) {
+      /* Full resolution fits, nothing to gain over regular loading. */
+      return nullptr;
+    }
+
+    const Box2i dw = in.dataWindowForLevel(level);
+    const int width = dw.max.x - dw.min.x + 1;
+    const int height = dw.max.y - dw.min.y + 1;
+
+    ibuf = IMB_allocImBuf(width, height, exr_has_alpha(file) ? 32 : 24, 0);
+    ibuf->flags |= exr_is_half_float(file) ? IB_halffloat : 0;
+    ibuf->ftype = IMB_FTYPE_OPENEXR;
+    imb_addrectfloatImBuf(ibuf);
+
+    /* Read y-flipped, same as #imb_load_openexr. */
+    const int xstride = sizeof(float[4]);
+    const int ystride = -xstride * width;
+    float *first = ibuf->rect_float - 4 * (dw.min.x - dw.min.y * width);
+    first += 4 * (height - 1) * width;
+
+    FrameBuffer frameBuffer;
+    for (int i = 0; i < 3; i++) {
+      frameBuffer.insert(exr_rgba_channelname(file, rgb_channels[i]),
+                         Slice(Imf::FLOAT, (char *)(first + i), xstride, ystride));
+    }
+    frameBuffer.insert(exr_rgba_channelname(file, "A"),
+                       Slice(Imf::FLOAT, (char *)(first + 3), xstride, ystride, 1, 1, 1.0f));
+
+    in.setFrameBuffer(frameBuffer);
+    in.readTiles(0, in.numXTiles(level) - 1, 0, in.numYTiles(level) - 1, level);
+
+    const Box2i full_dw = header.dataWindow();
+    r_full_size[0] = full_dw.max.x - full_dw.min.x + 1;
+    r_full_size[1] = full_dw.max.y - full_dw.min.y + 1;
+
+    if (flags & IB_alphamode_detect) {
+      ibuf->flags |= IB_alphamode_premul;
+    }
+
+    return ibuf;
+  }
+  catch (const std::exception &exc) {
+    std::cerr << exc.what() << std::endl;
+    if (ibuf) {
+      IMB_freeImBuf(ibuf);
+    }
+
+    return nullptr;
+  }
+}
+
+struct ImBuf *imb_load_filepath_thumbnail_openexr(const char *filepath,
+                                                  const int UNUSED(flags),
+                                                  const size_t UNUSED(max_thumb_size),
+                                                  char colorspace[IM_MAX_SPACE],
+                                                  size_t *r_width,
+                                                  size_t *r_height)
+{
+  IStream *stream = nullptr;
+  MultiPartInputFile *file = nullptr;
+
+  try {
+    /* Only the header is read, the embedded preview image is stored there. */
+    stream = new IFileStream(filepath);
+    file = new MultiPartInputFile(*stream);
+    const Header &header = file->header(0);
+
+    const Box2i dw = header.dataWindow();
+    *r_width = dw.max.x - dw.min.x + 1;
+    *r_height = dw.max.y - dw.min.y + 1;
+
+    struct ImBuf *ibuf = nullptr;
+    if (header.hasPreviewImage()) {
+      const PreviewImage &preview = header.previewImage();
+      const int width = preview.width(), height = preview.height();
+
+      ibuf = IMB_allocImBuf(width, height, 32, IB_rect);
+      if (ibuf) {
+        /* Preview pixels are stored top to bottom, 8 bit and display referred. */
+        for (int y = 0; y < height; y++) {
+          const PreviewRgba *src = preview.pixels() + (size_t)(height - 1 - y) * width;
+          unsigned char *dst = (unsigned char *)(ibuf->rect + (size_t)y * width);
+          for (int x = 0; x < width; x++, src++, dst += 4) {
+            dst[0] = src->r;
+            dst[1] = src->g;
+            dst[2] = src->b;
+            dst[3] = src->a;
+          }
+        }
+        ibuf->ftype = IMB_FTYPE_OPENEXR;
+        colorspace_set_default_role(colorspace, IM_MAX_SPACE, COLOR_ROLE_DEFAULT_BYTE);
+      }
+    }
+
+    delete file;
+    delete stream;
+    return ibuf;
+  }
+  catch (const std::exception &exc) {
+    std::cerr << exc.what() << std::endl;
+    delete file;
+    delete stream;
+    return nullptr;
+  }
+}
+
 void imb_initopenexr(void)
 {
   int num_threads = BLI_system_thread_count();
@@ -37,6 +37,18 @@ bool imb_is_a_openexr(const unsigned char *mem, const size_t size);
 bool imb_save_openexr(struct ImBuf *ibuf, const char *name, int flags);
 
 struct ImBuf *imb_load_openexr(const unsigned char *mem, size_t size, int flags, char *colorspace);
+struct ImBuf *imb_load_openexr_mip_level(const unsigned char *mem,
+                                         size_t size,
+                                         int flags,
+                                         char *colorspace,
+                                         int max_size,
+                                         int r_full_size[2]);
+struct ImBuf *imb_load_filepath_thumbnail_openexr(const char *filepath,
+                                                  const int flags,
+                                                  const size_t max_thumb_size,
+                                                  char *colorspace,
+                                                  size_t *r_width,
+                                                  size_t *r_height);
 
 #ifdef __cplusplus
 }
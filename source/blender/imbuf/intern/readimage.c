@@ -39,11 +39,16 @@
 #include "IMB_filetype.h"
 #include "IMB_imbuf.h"
 #include "IMB_imbuf_types.h"
+#include "IMB_thumbs.h"
 #include "imbuf.h"
 
 #include "IMB_colormanagement.h"
 #include "IMB_colormanagement_intern.h"
 
+#ifdef WITH_OPENEXR
+#  include "openexr/openexr_api.h"
+#endif
+
 static void imb_handle_alpha(ImBuf *ibuf,
                              int flags,
                              char colorspace[IM_MAX_SPACE],
@@ -251,6 +256,37 @@ ImBuf *IMB_loadiffname(const char *filepath, int flags, char colorspace[IM_MAX_S
   return ibuf;
 }
 
+/**
+ * Load an image for use as a thumbnail, using the reduced size decoding of the file type when
+ * available. The full size of the image is returned in \a r_width and \a r_height.
+ */
+ImBuf *IMB_thumb_load_image(const char *filepath,
+                            const size_t max_thumb_size,
+                            char colorspace[IM_MAX_SPACE],
+                            size_t *r_width,
+                            size_t *r_height)
+{
+  const int flags = IB_rect | IB_metadata;
+  ImBuf *ibuf = NULL;
+
+  const ImFileType *type = IMB_file_type_from_ftype(IMB_ispic_type(filepath));
+  if (type != NULL && type->load_filepath_thumbnail != NULL) {
+    ibuf = type->load_filepath_thumbnail(
+        filepath, flags, max_thumb_size, colorspace, r_width, r_height);
+  }
+
+  if (ibuf == NULL) {
+    /* No reduced size decoding, load the full image. */
+    ibuf = IMB_loadiffname(filepath, flags, colorspace);
+    if (ibuf != NULL) {
+      *r_width = (size_t)ibuf->x;
+      *r_height = (size_t)ibuf->y;
+    }
+  }
+
+  return ibuf;
+}
+
 ImBuf *IMB_testiffname(const char *filepath, int flags)
 {
   ImBuf *ibuf;
@@ -279,6 +315,62 @@ ImBuf *IMB_testiffname(const char *filepath, int flags)
   return ibuf;
 }
 
+ImBuf *IMB_loadiffname_mip_level(const char *filepath,
+                                 int flags,
+                                 char colorspace[IM_MAX_SPACE],
+                                 int max_size,
+                                 int r_full_size[2])
+{
+#ifdef WITH_OPENEXR
+  ImBuf *ibuf;
+  int file;
+  char effective_colorspace[IM_MAX_SPACE] = "";
+
+  BLI_assert(!BLI_path_is_rel(filepath));
+
+  file = BLI_open(filepath, O_BINARY | O_RDONLY, 0);
+  if (file == -1) {
+    return NULL;
+  }
+
+  const size_t size = BLI_file_descriptor_size(file);
+
+  imb_mmap_lock();
+  BLI_mmap_file *mmap_file = BLI_mmap_open(file);
+  imb_mmap_unlock();
+  if (mmap_file == NULL) {
+    close(file);
+    return NULL;
+  }
+
+  if (colorspace) {
+    BLI_strncpy(effective_colorspace, colorspace, sizeof(effective_colorspace));
+  }
+
+  ibuf = imb_load_openexr_mip_level(BLI_mmap_get_pointer(mmap_file),
+                                    size,
+                                    flags,
+                                    effective_colorspace,
+                                    max_size,
+                                    r_full_size);
+
+  imb_mmap_lock();
+  BLI_mmap_free(mmap_file);
+  imb_mmap_unlock();
+  close(file);
+
+  if (ibuf) {
+    imb_handle_alpha(ibuf, flags, colorspace, effective_colorspace);
+    BLI_strncpy(ibuf->name, filepath, sizeof(ibuf->name));
+  }
+
+  return ibuf;
+#else
+  UNUSED_VARS(filepath, flags, colorspace, max_size, r_full_size);
+  return NULL;
+#endif
+}
+
 static void imb_loadtilefile(ImBuf *ibuf, int file, int tx, int ty, unsigned int *rect)
 {
   unsigned char *mem;
@@ -26,6 +26,7 @@
 
 #include "BLI_math_color.h"
 #include "BLI_math_interp.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 #include "MEM_guardedalloc.h"
 
@@ -908,21 +909,203 @@ static bool q_scale_linear_interpolation(struct ImBuf *ibuf, int newx, int newy)
   return true;
 }
 
+/* Box filter weights for scaling down one axis. Every output pixel is a weighted sum of a
+ * contiguous run of input pixels, which is the same for all rows (or columns) of the image.
+ * The weights are computed the same way the band-limited scaling always did, so the result
+ * does not change but the rows can be processed independently and in parallel. */
+typedef struct ScaleDownWeights {
+  /* First contribution of every output pixel, `newsize + 1` entries. */
+  int *offset;
+  /* Input pixel and weight of every contribution. */
+  int *index;
+  float *weight;
+  float add;
+} ScaleDownWeights;
+
+static void scaledown_weights_init(ScaleDownWeights *weights, int size, int newsize)
+{
+  /* Every input pixel contributes once as a whole or last pixel, plus once as the carried
+   * partial pixel of the next output. */
+  const int max_contributions = size + 2 * newsize;
+  float sample = 0.0f;
+  int next = 0, carry = -1, n = 0;
+
+  weights->offset = MEM_mallocN(sizeof(int) * (newsize + 1), __func__);
+  weights->index = MEM_mallocN(sizeof(int) * max_contributions, __func__);
+  weights->weight = MEM_mallocN(sizeof(float) * max_contributions, __func__);
+  weights->add = (size - 0.01) / newsize;
+
+  for (int i = 0; i < newsize; i++) {
+    weights->offset[i] = n;
+
+    if (carry != -1) {
+      weights->index[n] = carry;
+      weights->weight[n] = -sample;
+      n++;
+    }
+
+    sample += weights->add;
+
+    while (sample >= 1.0f) {
+      sample -= 1.0f;
+      weights->index[n] = next++;
+      weights->weight[n] = 1.0f;
+      n++;
+    }
+
+    carry = next++;
+    weights->index[n] = carry;
+    weights->weight[n] = sample;
+    n++;
+
+    sample -= 1.0f;
+  }
+  weights->offset[newsize] = n;
+
+  BLI_assert(next == size); /* see bug T26502. */
+  BLI_assert(n <= max_contributions);
+}
+
+static void scaledown_weights_free(ScaleDownWeights *weights)
+{
+  MEM_freeN(weights->offset);
+  MEM_freeN(weights->index);
+  MEM_freeN(weights->weight);
+}
+
+typedef struct ScaleDownData {
+  const ScaleDownWeights *weights;
+  const uchar *rect;
+  const float *rectf;
+  uchar *newrect;
+  float *newrectf;
+  /* Width of the input and output buffers, in pixels. */
+  int width;
+  int newwidth;
+} ScaleDownData;
+
+static void scaledownx_row(void *__restrict userdata,
+                           const int y,
+                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const ScaleDownData *data = userdata;
+  const ScaleDownWeights *weights = data->weights;
+  const float add = weights->add;
+
+  for (int x = 0; x < data->newwidth; x++) {
+    const int c_start = weights->offset[x], c_end = weights->offset[x + 1];
+
+    if (data->rect) {
+      const uchar *rect = data->rect + (size_t)4 * y * data->width;
+      uchar *newrect = data->newrect + (size_t)4 * (y * data->newwidth + x);
+      float acc[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+
+      for (int c = c_start; c < c_end; c++) {
+        const uchar *pixel = rect + 4 * weights->index[c];
+        const float weight = weights->weight[c];
+        acc[0] += weight * pixel[0];
+        acc[1] += weight * pixel[1];
+        acc[2] += weight * pixel[2];
+        acc[3] += weight * pixel[3];
+      }
+
+      newrect[0] = roundf(acc[0] / add);
+      newrect[1] = roundf(acc[1] / add);
+      newrect[2] = roundf(acc[2] / add);
+      newrect[3] = roundf(acc[3] / add);
+    }
+    if (data->rectf) {
+      const float *rectf = data->rectf + (size_t)4 * y * data->width;
+      float *newrectf = data->newrectf + (size_t)4 * (y * data->newwidth + x);
+      float acc[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+
+      for (int c = c_start; c < c_end; c++) {
+        const float *pixel = rectf + 4 * weights->index[c];
+        const float weight = weights->weight[c];
+        acc[0] += weight * pixel[0];
+        acc[1] += weight * pixel[1];
+        acc[2] += weight * pixel[2];
+        acc[3] += weight * pixel[3];
+      }
+
+      newrectf[0] = acc[0] / add;
+      newrectf[1] = acc[1] / add;
+      newrectf[2] = acc[2] / add;
+      newrectf[3] = acc[3] / add;
+    }
+  }
+}
+
+static void scaledowny_row(void *__restrict userdata,
+                           const int y,
+                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const ScaleDownData *data = userdata;
+  const ScaleDownWeights *weights = data->weights;
+  const float add = weights->add;
+  const int c_start = weights->offset[y], c_end = weights->offset[y + 1];
+  const size_t width = data->width;
+
+  /* Walk along the rows, the few input rows of the output row are read in parallel. */
+  for (size_t x = 0; x < width; x++) {
+    if (data->rect) {
+      uchar *newrect = data->newrect + 4 * (y * width + x);
+      float acc[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+
+      for (int c = c_start; c < c_end; c++) {
+        const uchar *pixel = data->rect + 4 * (weights->index[c] * width + x);
+        const float weight = weights->weight[c];
+        acc[0] += weight * pixel[0];
+        acc[1] += weight * pixel[1];
+        acc[2] += weight * pixel[2];
+        acc[3] += weight * pixel[3];
+      }
+
+      newrect[0] = roundf(acc[0] / add);
+      newrect[1] = roundf(acc[1] / add);
+      newrect[2] = roundf(acc[2] / add);
+      newrect[3] = roundf(acc[3] / add);
+    }
+    if (data->rectf) {
+      float *newrectf = data->newrectf + 4 * (y * width + x);
+      float acc[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+
+      for (int c = c_start; c < c_end; c++) {
+        const float *pixel = data->rectf + 4 * (weights->index[c] * width + x);
+        const float weight = weights->weight[c];
+        acc[0] += weight * pixel[0];
+        acc[1] += weight * pixel[1];
+        acc[2] += weight * pixel[2];
+        acc[3] += weight * pixel[3];
+      }
+
+      newrectf[0] = acc[0] / add;
+      newrectf[1] = acc[1] / add;
+      newrectf[2] = acc[2] / add;
+      newrectf[3] = acc[3] / add;
+    }
+  }
+}
+
+/* Only use threads for images where it pays off, thumbnails are scaled in jobs already. */
+static void scale_parallel_range(int tot_lines,
+                                 size_t tot_pixels,
+                                 void *userdata,
+                                 TaskParallelRangeFunc func)
+{
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (tot_pixels > 256 * 256);
+  settings.min_iter_per_thread = 8;
+  BLI_task_parallel_range(0, tot_lines, userdata, func, &settings);
+}
+
 static ImBuf *scaledownx(struct ImBuf *ibuf, int newx)
 {
   const int do_rect = (ibuf->rect != NULL);
   const int do_float = (ibuf->rect_float != NULL);
-  const size_t rect_size = ibuf->x * ibuf->y * 4;
-
-  uchar *rect, *_newrect, *newrect;
-  float *rectf, *_newrectf, *newrectf;
-  float sample, add, val[4], nval[4], valf[4], nvalf[4];
-  int x, y;
-
-  rectf = _newrectf = newrectf = NULL;
-  rect = _newrect = newrect = NULL;
-  nval[0] = nval[1] = nval[2] = nval[3] = 0.0f;
-  nvalf[0] = nvalf[1] = nvalf[2] = nvalf[3] = 0.0f;
+  uchar *_newrect = NULL;
+  float *_newrectf = NULL;
 
   if (!do_rect && !do_float) {
     return ibuf;
@@ -944,106 +1127,32 @@ static ImBuf *scaledownx(struct ImBuf *ibuf, int newx)
     }
   }
 
-  add = (ibuf->x - 0.01) / newx;
-
-  if (do_rect) {
-    rect = (uchar *)ibuf->rect;
-    newrect = _newrect;
-  }
-  if (do_float) {
-    rectf = ibuf->rect_float;
-    newrectf = _newrectf;
-  }
-
-  for (y = ibuf->y; y > 0; y--) {
-    sample = 0.0f;
-    val[0] = val[1] = val[2] = val[3] = 0.0f;
-    valf[0] = valf[1] = valf[2] = valf[3] = 0.0f;
-
-    for (x = newx; x > 0; x--) {
-      if (do_rect) {
-        nval[0] = -val[0] * sample;
-        nval[1] = -val[1] * sample;
-        nval[2] = -val[2] * sample;
-        nval[3] = -val[3] * sample;
-      }
-      if (do_float) {
-        nvalf[0] = -valf[0] * sample;
-        nvalf[1] = -valf[1] * sample;
-        nvalf[2] = -valf[2] * sample;
-        nvalf[3] = -valf[3] * sample;
-      }
-
-      sample += add;
-
-      while (sample >= 1.0f) {
-        sample -= 1.0f;
-
-        if (do_rect) {
-          nval[0] += rect[0];
-          nval[1] += rect[1];
-          nval[2] += rect[2];
-          nval[3] += rect[3];
-          rect += 4;
-        }
-        if (do_float) {
-          nvalf[0] += rectf[0];
-          nvalf[1] += rectf[1];
-          nvalf[2] += rectf[2];
-          nvalf[3] += rectf[3];
-          rectf += 4;
-        }
-      }
-
-      if (do_rect) {
-        val[0] = rect[0];
-        val[1] = rect[1];
-        val[2] = rect[2];
-        val[3] = rect[3];
-        rect += 4;
+  ScaleDownWeights weights;
+  scaledown_weights_init(&weights, ibuf->x, newx);
 
-        newrect[0] = roundf((nval[0] + sample * val[0]) / add);
-        newrect[1] = roundf((nval[1] + sample * val[1]) / add);
-        newrect[2] = roundf((nval[2] + sample * val[2]) / add);
-        newrect[3] = roundf((nval[3] + sample * val[3]) / add);
-
-        newrect += 4;
-      }
-      if (do_float) {
-
-        valf[0] = rectf[0];
-        valf[1] = rectf[1];
-        valf[2] = rectf[2];
-        valf[3] = rectf[3];
-        rectf += 4;
-
-        newrectf[0] = ((nvalf[0] + sample * valf[0]) / add);
-        newrectf[1] = ((nvalf[1] + sample * valf[1]) / add);
-        newrectf[2] = ((nvalf[2] + sample * valf[2]) / add);
-        newrectf[3] = ((nvalf[3] + sample * valf[3]) / add);
-
-        newrectf += 4;
-      }
+  ScaleDownData data = {
+      .weights = &weights,
+      .rect = (uchar *)ibuf->rect,
+      .rectf = ibuf->rect_float,
+      .newrect = _newrect,
+      .newrectf = _newrectf,
+      .width = ibuf->x,
+      .newwidth = newx,
+  };
+  scale_parallel_range(ibuf->y, (size_t)ibuf->x * ibuf->y, &data, scaledownx_row);
 
-      sample -= 1.0f;
-    }
-  }
+  scaledown_weights_free(&weights);
 
   if (do_rect) {
-    // printf("%ld %ld\n", (uchar *)rect - ((uchar *)ibuf->rect), rect_size);
-    BLI_assert((uchar *)rect - ((uchar *)ibuf->rect) == rect_size); /* see bug T26502. */
     imb_freerectImBuf(ibuf);
     ibuf->mall |= IB_rect;
     ibuf->rect = (unsigned int *)_newrect;
   }
   if (do_float) {
-    // printf("%ld %ld\n", rectf - ibuf->rect_float, rect_size);
-    BLI_assert((rectf - ibuf->rect_float) == rect_size); /* see bug T26502. */
     imb_freerectfloatImBuf(ibuf);
     ibuf->mall |= IB_rectfloat;
     ibuf->rect_float = _newrectf;
   }
-  (void)rect_size; /* UNUSED in release builds */
 
   ibuf->x = newx;
   return ibuf;
@@ -1053,17 +1162,8 @@ static ImBuf *scaledowny(struct ImBuf *ibuf, int newy)
 {
   const int do_rect = (ibuf->rect != NULL);
   const int do_float = (ibuf->rect_float != NULL);
-  const size_t rect_size = ibuf->x * ibuf->y * 4;
-
-  uchar *rect, *_newrect, *newrect;
-  float *rectf, *_newrectf, *newrectf;
-  float sample, add, val[4], nval[4], valf[4], nvalf[4];
-  int x, y, skipx;
-
-  rectf = _newrectf = newrectf = NULL;
-  rect = _newrect = newrect = NULL;
-  nval[0] = nval[1] = nval[2] = nval[3] = 0.0f;
-  nvalf[0] = nvalf[1] = nvalf[2] = nvalf[3] = 0.0f;
+  uchar *_newrect = NULL;
+  float *_newrectf = NULL;
 
   if (!do_rect && !do_float) {
     return ibuf;
@@ -1085,107 +1185,32 @@ static ImBuf *scaledowny(struct ImBuf *ibuf, int newy)
     }
   }
 
-  add = (ibuf->y - 0.01) / newy;
-  skipx = 4 * ibuf->x;
-
-  for (x = skipx - 4; x >= 0; x -= 4) {
-    if (do_rect) {
-      rect = ((uchar *)ibuf->rect) + x;
-      newrect = _newrect + x;
-    }
-    if (do_float) {
-      rectf = ibuf->rect_float + x;
-      newrectf = _newrectf + x;
-    }
-
-    sample = 0.0f;
-    val[0] = val[1] = val[2] = val[3] = 0.0f;
-    valf[0] = valf[1] = valf[2] = valf[3] = 0.0f;
+  ScaleDownWeights weights;
+  scaledown_weights_init(&weights, ibuf->y, newy);
 
-    for (y = newy; y > 0; y--) {
-      if (do_rect) {
-        nval[0] = -val[0] * sample;
-        nval[1] = -val[1] * sample;
-        nval[2] = -val[2] * sample;
-        nval[3] = -val[3] * sample;
-      }
-      if (do_float) {
-        nvalf[0] = -valf[0] * sample;
-        nvalf[1] = -valf[1] * sample;
-        nvalf[2] = -valf[2] * sample;
-        nvalf[3] = -valf[3] * sample;
-      }
+  ScaleDownData data = {
+      .weights = &weights,
+      .rect = (uchar *)ibuf->rect,
+      .rectf = ibuf->rect_float,
+      .newrect = _newrect,
+      .newrectf = _newrectf,
+      .width = ibuf->x,
+      .newwidth = ibuf->x,
+  };
+  scale_parallel_range(newy, (size_t)ibuf->x * ibuf->y, &data, scaledowny_row);
 
-      sample += add;
-
-      while (sample >= 1.0f) {
-        sample -= 1.0f;
-
-        if (do_rect) {
-          nval[0] += rect[0];
-          nval[1] += rect[1];
-          nval[2] += rect[2];
-          nval[3] += rect[3];
-          rect += skipx;
-        }
-        if (do_float) {
-          nvalf[0] += rectf[0];
-          nvalf[1] += rectf[1];
-          nvalf[2] += rectf[2];
-          nvalf[3] += rectf[3];
-          rectf += skipx;
-        }
-      }
-
-      if (do_rect) {
-        val[0] = rect[0];
-        val[1] = rect[1];
-        val[2] = rect[2];
-        val[3] = rect[3];
-        rect += skipx;
-
-        newrect[0] = roundf((nval[0] + sample * val[0]) / add);
-        newrect[1] = roundf((nval[1] + sample * val[1]) / add);
-        newrect[2] = roundf((nval[2] + sample * val[2]) / add);
-        newrect[3] = roundf((nval[3] + sample * val[3]) / add);
-
-        newrect += skipx;
-      }
-      if (do_float) {
-
-        valf[0] = rectf[0];
-        valf[1] = rectf[1];
-        valf[2] = rectf[2];
-        valf[3] = rectf[3];
-        rectf += skipx;
-
-        newrectf[0] = ((nvalf[0] + sample * valf[0]) / add);
-        newrectf[1] = ((nvalf[1] + sample * valf[1]) / add);
-        newrectf[2] = ((nvalf[2] + sample * valf[2]) / add);
-        newrectf[3] = ((nvalf[3] + sample * valf[3]) / add);
-
-        newrectf += skipx;
-      }
-
-      sample -= 1.0f;
-    }
-  }
+  scaledown_weights_free(&weights);
 
   if (do_rect) {
-    // printf("%ld %ld\n", (uchar *)rect - ((uchar *)ibuf->rect), rect_size);
-    BLI_assert((uchar *)rect - ((uchar *)ibuf->rect) == rect_size); /* see bug T26502. */
     imb_freerectImBuf(ibuf);
     ibuf->mall |= IB_rect;
     ibuf->rect = (unsigned int *)_newrect;
   }
   if (do_float) {
-    // printf("%ld %ld\n", rectf - ibuf->rect_float, rect_size);
-    BLI_assert((rectf - ibuf->rect_float) == rect_size); /* see bug T26502. */
     imb_freerectfloatImBuf(ibuf);
     ibuf->mall |= IB_rectfloat;
     ibuf->rect_float = (float *)_newrectf;
   }
-  (void)rect_size; /* UNUSED in release builds */
 
   ibuf->y = newy;
   return ibuf;
@@ -1661,23 +1686,54 @@ struct imbufRGBA {
   float r, g, b, a;
 };
 
+typedef struct ScaleFastData {
+  const ImBuf *ibuf;
+  unsigned int *newrect;
+  struct imbufRGBA *newrectf;
+  unsigned int newx;
+  size_t stepx, stepy;
+} ScaleFastData;
+
+static void scalefast_row(void *__restrict userdata,
+                          const int y,
+                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const ScaleFastData *data = userdata;
+  const ImBuf *ibuf = data->ibuf;
+  const size_t ofsy = 32768 + y * data->stepy;
+  size_t ofsx;
+  unsigned int x;
+
+  if (data->newrect) {
+    const unsigned int *rect = ibuf->rect + (ofsy >> 16) * ibuf->x;
+    unsigned int *newrect = data->newrect + (size_t)y * data->newx;
+    ofsx = 32768;
+
+    for (x = data->newx; x > 0; x--, ofsx += data->stepx) {
+      *newrect++ = rect[ofsx >> 16];
+    }
+  }
+
+  if (data->newrectf) {
+    const struct imbufRGBA *rectf = (struct imbufRGBA *)ibuf->rect_float;
+    struct imbufRGBA *newrectf = data->newrectf + (size_t)y * data->newx;
+    rectf += (ofsy >> 16) * ibuf->x;
+    ofsx = 32768;
+
+    for (x = data->newx; x > 0; x--, ofsx += data->stepx) {
+      *newrectf++ = rectf[ofsx >> 16];
+    }
+  }
+}
+
 /**
  * Return true if \a ibuf is modified.
  */
 bool IMB_scalefastImBuf(struct ImBuf *ibuf, unsigned int newx, unsigned int newy)
 {
-  unsigned int *rect, *_newrect, *newrect;
-  struct imbufRGBA *rectf, *_newrectf, *newrectf;
-  int x, y;
+  unsigned int *_newrect = NULL;
+  struct imbufRGBA *_newrectf = NULL;
   bool do_float = false, do_rect = false;
-  size_t ofsx, ofsy, stepx, stepy;
-
-  rect = NULL;
-  _newrect = NULL;
-  newrect = NULL;
-  rectf = NULL;
-  _newrectf = NULL;
-  newrectf = NULL;
 
   if (ibuf == NULL) {
     return false;
@@ -1701,7 +1757,6 @@ bool IMB_scalefastImBuf(struct ImBuf *ibuf, unsigned int newx, unsigned int newy
     if (_newrect == NULL) {
       return false;
     }
-    newrect = _newrect;
   }
 
   if (do_float) {
@@ -1712,34 +1767,17 @@ bool IMB_scalefastImBuf(struct ImBuf *ibuf, unsigned int newx, unsigned int newy
       }
       return false;
     }
-    newrectf = _newrectf;
   }
 
-  stepx = round(65536.0 * (ibuf->x - 1.0) / (newx - 1.0));
-  stepy = round(65536.0 * (ibuf->y - 1.0) / (newy - 1.0));
-  ofsy = 32768;
-
-  for (y = newy; y > 0; y--, ofsy += stepy) {
-    if (do_rect) {
-      rect = ibuf->rect;
-      rect += (ofsy >> 16) * ibuf->x;
-      ofsx = 32768;
-
-      for (x = newx; x > 0; x--, ofsx += stepx) {
-        *newrect++ = rect[ofsx >> 16];
-      }
-    }
-
-    if (do_float) {
-      rectf = (struct imbufRGBA *)ibuf->rect_float;
-      rectf += (ofsy >> 16) * ibuf->x;
-      ofsx = 32768;
-
-      for (x = newx; x > 0; x--, ofsx += stepx) {
-        *newrectf++ = rectf[ofsx >> 16];
-      }
-    }
-  }
+  ScaleFastData data = {
+      .ibuf = ibuf,
+      .newrect = _newrect,
+      .newrectf = _newrectf,
+      .newx = newx,
+      .stepx = round(65536.0 * (ibuf->x - 1.0) / (newx - 1.0)),
+      .stepy = round(65536.0 * (ibuf->y - 1.0) / (newy - 1.0)),
+  };
+  scale_parallel_range(newy, (size_t)newx * newy, &data, scalefast_row);
 
   if (do_rect) {
     imb_freerectImBuf(ibuf);
@@ -337,6 +337,7 @@ static ImBuf *thumb_create_ex(const char *file_path,
   char mtime[40] = "0";  /* in case we can't stat the file */
   char cwidth[40] = "0"; /* in case images have no data */
   char cheight[40] = "0";
+  size_t width = 0, height = 0; /* full size of the source image */
   short tsize = 128;
   short ex, ey;
   float scaledx, scaledy;
@@ -384,7 +385,7 @@ static ImBuf *thumb_create_ex(const char *file_path,
         if (img == NULL) {
           switch (source) {
             case THB_SOURCE_IMAGE:
-              img = IMB_loadiffname(file_path, IB_rect | IB_metadata, NULL);
+              img = IMB_thumb_load_image(file_path, tsize, NULL, &width, &height);
               break;
             case THB_SOURCE_BLEND:
               img = IMB_thumb_load_blend(file_path, blen_group, blen_id);
@@ -401,8 +402,12 @@ static ImBuf *thumb_create_ex(const char *file_path,
           if (BLI_stat(file_path, &info) != -1) {
             BLI_snprintf(mtime, sizeof(mtime), "%ld", (long int)info.st_mtime);
           }
-          BLI_snprintf(cwidth, sizeof(cwidth), "%d", img->x);
-          BLI_snprintf(cheight, sizeof(cheight), "%d", img->y);
+          if (width == 0 || height == 0) {
+            width = (size_t)img->x;
+            height = (size_t)img->y;
+          }
+          BLI_snprintf(cwidth, sizeof(cwidth), "%zu", width);
+          BLI_snprintf(cheight, sizeof(cheight), "%zu", height);
         }
       }
       else if (THB_SOURCE_MOVIE == source) {
@@ -34,6 +34,7 @@
 #include "GPU_texture.h"
 
 #include "IMB_colormanagement.h"
+#include "IMB_colormanagement_intern.h"
 #include "IMB_imbuf.h"
 #include "IMB_imbuf_types.h"
 
@@ -285,3 +286,75 @@ GPUTexture *IMB_create_gpu_texture(const char *name,
 
   return tex;
 }
+
+/* Float buffer last drawn with the GLSL display transform. It stays on the GPU while only the
+ * view settings change, so changing exposure or view transform does not upload it again. */
+static struct {
+  GPUTexture *texture;
+  const ImBuf *ibuf;
+  const float *rect_float;
+  int x, y, channels;
+} imb_display_texture = {NULL};
+
+/* Half float texture of the float buffer, for drawing with the GLSL display transform.
+ * Owned by the cache, valid until the next call. Returns NULL when the buffer can not be
+ * uploaded as a single texture. */
+GPUTexture *IMB_display_gpu_texture_ensure(ImBuf *ibuf)
+{
+  if (ibuf->rect_float == NULL || !ELEM(ibuf->channels, 3, 4)) {
+    return NULL;
+  }
+  const int max_size = GPU_max_texture_size();
+  if (ibuf->x > max_size || ibuf->y > max_size) {
+    return NULL;
+  }
+
+  const bool changed = colormanage_display_texture_check_changed(ibuf);
+  const bool same_size = (imb_display_texture.texture != NULL &&
+                          imb_display_texture.x == ibuf->x && imb_display_texture.y == ibuf->y &&
+                          imb_display_texture.channels == ibuf->channels);
+
+  if (same_size && !changed && imb_display_texture.ibuf == ibuf &&
+      imb_display_texture.rect_float == ibuf->rect_float) {
+    return imb_display_texture.texture;
+  }
+
+  if (!same_size) {
+    IMB_display_gpu_texture_free();
+
+    const eGPUTextureFormat format = (ibuf->channels == 3) ? GPU_RGB16F : GPU_RGBA16F;
+    imb_display_texture.texture = GPU_texture_create_2d(
+        "display_texture", ibuf->x, ibuf->y, 1, format, NULL);
+    if (imb_display_texture.texture == NULL) {
+      return NULL;
+    }
+    GPU_texture_wrap_mode(imb_display_texture.texture, false, true);
+  }
+
+  GPU_texture_update(imb_display_texture.texture, GPU_DATA_FLOAT, ibuf->rect_float);
+
+  imb_display_texture.ibuf = ibuf;
+  imb_display_texture.rect_float = ibuf->rect_float;
+  imb_display_texture.x = ibuf->x;
+  imb_display_texture.y = ibuf->y;
+  imb_display_texture.channels = ibuf->channels;
+
+  return imb_display_texture.texture;
+}
+
+/* Float buffer of the image buffer is freed, a new one at the same address must not match. */
+void IMB_display_gpu_texture_tag_freed(ImBuf *ibuf)
+{
+  if (imb_display_texture.ibuf == ibuf) {
+    imb_display_texture.ibuf = NULL;
+    imb_display_texture.rect_float = NULL;
+  }
+}
+
+void IMB_display_gpu_texture_free(void)
+{
+  if (imb_display_texture.texture) {
+    GPU_texture_free(imb_display_texture.texture);
+  }
+  memset(&imb_display_texture, 0, sizeof(imb_display_texture));
+}
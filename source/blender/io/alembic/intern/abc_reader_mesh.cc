@@ -250,6 +250,45 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
   }
 }
 
+/**
+ * Only read the loop UVs, for meshes with faces that already match the sample.
+ * Same as the UV reading in #read_mpolys().
+ */
+static void read_mloopuvs(CDStreamConfig &config, const AbcMeshData &mesh_data)
+{
+  MLoopUV *mloopuvs = config.mloopuv;
+
+  const Int32ArraySamplePtr &face_indices = mesh_data.face_indices;
+  const Int32ArraySamplePtr &face_counts = mesh_data.face_counts;
+  const V2fArraySamplePtr &uvs = mesh_data.uvs;
+  const UInt32ArraySamplePtr &uvs_indices = mesh_data.uvs_indices;
+
+  if (!(mloopuvs && uvs && uvs_indices) || (uvs_indices->size() != face_indices->size())) {
+    return;
+  }
+
+  const size_t uvs_size = uvs->size();
+  unsigned int loop_index = 0;
+
+  for (int i = 0; i < face_counts->size(); i++) {
+    const int face_size = (*face_counts)[i];
+
+    /* NOTE: Alembic data is stored in the reverse order. */
+    unsigned int rev_loop_index = loop_index + (face_size - 1);
+
+    for (int f = 0; f < face_size; f++, loop_index++, rev_loop_index--) {
+      const unsigned int uv_index = (*uvs_indices)[loop_index];
+      if (uv_index >= uvs_size) {
+        continue;
+      }
+
+      MLoopUV &loopuv = mloopuvs[rev_loop_index];
+      loopuv.uv[0] = (*uvs)[uv_index][0];
+      loopuv.uv[1] = (*uvs)[uv_index][1];
+    }
+  }
+}
+
 static void process_no_normals(CDStreamConfig &config)
 {
   /* Absence of normals in the Alembic mesh is interpreted as 'smooth'. */
@@ -412,14 +451,18 @@ static void get_weight_and_index(CDStreamConfig &config,
   config.ceil_index = i1;
 }
 
+/**
+ * \param read_topology: When false, the faces of the mesh in \a config are known to match the
+ * sample already, so only the other requested data (e.g. vertices and normals) is read.
+ */
 static void read_mesh_sample(const std::string &iobject_full_name,
                              ImportSettings *settings,
                              const IPolyMeshSchema &schema,
+                             const IPolyMeshSchema::Sample &sample,
                              const ISampleSelector &selector,
-                             CDStreamConfig &config)
+                             CDStreamConfig &config,
+                             const bool read_topology)
 {
-  const IPolyMeshSchema::Sample sample = schema.getValue(selector);
-
   AbcMeshData abc_mesh_data;
   abc_mesh_data.face_counts = sample.getFaceCounts();
   abc_mesh_data.face_indices = sample.getFaceIndices();
@@ -442,7 +485,12 @@ static void read_mesh_sample(const std::string &iobject_full_name,
   }
 
   if ((settings->read_flag & MOD_MESHSEQ_READ_POLY) != 0) {
-    read_mpolys(config, abc_mesh_data);
+    if (read_topology) {
+      read_mpolys(config, abc_mesh_data);
+    }
+    else {
+      read_mloopuvs(config, abc_mesh_data);
+    }
     process_normals(config, schema.getNormalsParam(), selector);
   }
 
@@ -664,7 +712,9 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
   ImportSettings settings;
   settings.read_flag |= read_flag;
 
-  if (topology_changed(existing_mesh, sample_sel)) {
+  /* Same test as #topology_changed(), using the sample that was already read. */
+  if (positions->size() != existing_mesh->totvert || poly_count != existing_mesh->totpoly ||
+      loop_count != existing_mesh->totloop) {
     new_mesh = BKE_mesh_new_nomain_from_template(
         existing_mesh, positions->size(), 0, 0, face_indices->size(), face_counts->size());
 
@@ -692,7 +742,14 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
   config.time = sample_sel.getRequestedTime();
   config.modifier_error_message = err_str;
 
-  read_mesh_sample(m_iobject.getFullName(), &settings, m_schema, sample_sel, config);
+  /* Faces of a mesh with homogeneous topology are the same for every sample, so when streaming
+   * into an existing mesh of the same size only its vertices (and normals, UVs, colors) need to
+   * be read again. */
+  const bool read_topology = new_mesh != nullptr ||
+                             m_schema.getTopologyVariance() ==
+                                 Alembic::AbcGeom::kHeterogenousTopology;
+  read_mesh_sample(
+      m_iobject.getFullName(), &settings, m_schema, sample, sample_sel, config, read_topology);
 
   if (new_mesh) {
     /* Here we assume that the number of materials doesn't change, i.e. that
@@ -601,10 +601,17 @@ static void import_endjob(void *user_data)
 
     lc = BKE_layer_collection_get_active(view_layer);
 
+    /* Add all objects before syncing the view layers once, instead of syncing them for every
+     * object, which makes importing many objects quadratic. */
+    BKE_layer_collection_resync_forbid();
     for (iter = data->readers.begin(); iter != data->readers.end(); ++iter) {
-      Object *ob = (*iter)->object();
+      BKE_collection_object_add(data->bmain, lc->collection, (*iter)->object());
+    }
+    BKE_layer_collection_resync_allow();
+    BKE_main_collection_sync(data->bmain);
 
-      BKE_collection_object_add(data->bmain, lc->collection, ob);
+    for (iter = data->readers.begin(); iter != data->readers.end(); ++iter) {
+      Object *ob = (*iter)->object();
 
       base = BKE_view_layer_base_find(view_layer, ob);
       /* TODO: is setting active needed? */
@@ -101,9 +101,7 @@ int ArmatureImporter::create_bone(SkinInfo *skin,
   int chain_length = 0;
 
   /* Checking if bone is already made. */
-  std::vector<COLLADAFW::Node *>::iterator it;
-  it = std::find(finished_joints.begin(), finished_joints.end(), node);
-  if (it != finished_joints.end()) {
+  if (finished_joints.count(node)) {
     return chain_length;
   }
 
@@ -213,7 +211,7 @@ int ArmatureImporter::create_bone(SkinInfo *skin,
 
   bone->length = len_v3v3(bone->head, bone->tail);
   joint_by_uid[node->getUniqueId()] = node;
-  finished_joints.push_back(node);
+  finished_joints.insert(node);
 
   be.set_chain_length(chain_length + 1);
 
@@ -395,7 +393,7 @@ void ArmatureImporter::set_euler_rotmode()
 {
   /* just set rotmode = ROT_MODE_EUL on pose channel for each joint */
 
-  std::map<COLLADAFW::UniqueId, COLLADAFW::Node *>::iterator it;
+  UidNodeHashMap::iterator it;
 
   for (it = joint_by_uid.begin(); it != joint_by_uid.end(); it++) {
 
@@ -1001,11 +999,12 @@ void ArmatureImporter::make_shape_keys(bContext *C)
 
 COLLADAFW::UniqueId *ArmatureImporter::get_geometry_uid(const COLLADAFW::UniqueId &controller_uid)
 {
-  if (geom_uid_by_controller_uid.find(controller_uid) == geom_uid_by_controller_uid.end()) {
+  auto it = geom_uid_by_controller_uid.find(controller_uid);
+  if (it == geom_uid_by_controller_uid.end()) {
     return nullptr;
   }
 
-  return &geom_uid_by_controller_uid[controller_uid];
+  return &it->second;
 }
 
 Object *ArmatureImporter::get_armature_for_joint(COLLADAFW::Node *node)
@@ -1019,11 +1018,10 @@ Object *ArmatureImporter::get_armature_for_joint(COLLADAFW::Node *node)
     }
   }
 
-  std::map<COLLADAFW::UniqueId, Object *>::iterator arm;
-  for (arm = unskinned_armature_map.begin(); arm != unskinned_armature_map.end(); arm++) {
-    if (arm->first == node->getUniqueId()) {
-      return arm->second;
-    }
+  std::map<COLLADAFW::UniqueId, Object *>::iterator arm = unskinned_armature_map.find(
+      node->getUniqueId());
+  if (arm != unskinned_armature_map.end()) {
+    return arm->second;
   }
   return nullptr;
 }
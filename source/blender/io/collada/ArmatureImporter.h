@@ -41,6 +41,7 @@
 #include "TransformReader.h"
 
 #include <map>
+#include <unordered_set>
 #include <vector>
 
 #include "ImportSettings.h"
@@ -77,10 +78,11 @@ class ArmatureImporter : private TransformReader {
 
   Object *empty; /* empty for leaf bones */
 
-  std::map<COLLADAFW::UniqueId, COLLADAFW::UniqueId> geom_uid_by_controller_uid;
-  std::map<COLLADAFW::UniqueId, COLLADAFW::Node *> joint_by_uid; /* contains all joints */
+  std::unordered_map<COLLADAFW::UniqueId, COLLADAFW::UniqueId, bc_UniqueIdHash>
+      geom_uid_by_controller_uid;
+  UidNodeHashMap joint_by_uid; /* contains all joints */
   std::vector<COLLADAFW::Node *> root_joints;
-  std::vector<COLLADAFW::Node *> finished_joints;
+  std::unordered_set<COLLADAFW::Node *> finished_joints;
   std::vector<COLLADAFW::MorphController *> morph_controllers;
   std::map<COLLADAFW::UniqueId, Object *> joint_parent_map;
   std::map<COLLADAFW::UniqueId, Object *> unskinned_armature_map;
@@ -726,6 +726,39 @@ void MeshImporter::read_polys(COLLADAFW::Mesh *collada_mesh, Mesh *me)
       COLLADAFW::IndexListArray &index_list_array_uvcoord = mp->getUVCoordIndicesArray();
       COLLADAFW::IndexListArray &index_list_array_vcolor = mp->getColorIndicesArray();
 
+      /* Resolve the layers once per primitive instead of looking them up by name for every
+       * polygon, which dominates the import time of large meshes. */
+      std::vector<MLoopUV *> mloopuvs(index_list_array_uvcoord.getCount(), nullptr);
+      for (unsigned int uvset_index = 0; uvset_index < index_list_array_uvcoord.getCount();
+           uvset_index++) {
+        COLLADAFW::IndexList &index_list = *index_list_array_uvcoord[uvset_index];
+        mloopuvs[uvset_index] = (MLoopUV *)CustomData_get_layer_named(
+            &me->ldata, CD_MLOOPUV, index_list.getName().c_str());
+        if (mloopuvs[uvset_index] == nullptr) {
+          fprintf(stderr,
+                  "Collada import: Mesh [%s] : Unknown reference to TEXCOORD [#%s].\n",
+                  me->id.name,
+                  index_list.getName().c_str());
+        }
+      }
+
+      std::vector<MLoopCol *> mloopcols;
+      if (mp->hasColorIndices()) {
+        mloopcols.resize(index_list_array_vcolor.getCount(), nullptr);
+        for (unsigned int vcolor_index = 0; vcolor_index < mloopcols.size(); vcolor_index++) {
+          COLLADAFW::IndexList &color_index_list = *mp->getColorIndices(vcolor_index);
+          COLLADAFW::String colname = extract_vcolname(color_index_list.getName());
+          mloopcols[vcolor_index] = (MLoopCol *)CustomData_get_layer_named(
+              &me->ldata, CD_MLOOPCOL, colname.c_str());
+          if (mloopcols[vcolor_index] == nullptr) {
+            fprintf(stderr,
+                    "Collada import: Mesh [%s] : Unknown reference to VCOLOR [#%s].\n",
+                    me->id.name,
+                    color_index_list.getName().c_str());
+          }
+        }
+      }
+
       int invalid_loop_holes = 0;
       for (unsigned int j = 0; j < prim_totpoly; j++) {
 
@@ -740,20 +773,9 @@ void MeshImporter::read_polys(COLLADAFW::Mesh *collada_mesh, Mesh *me)
           invalid_loop_holes += 1;
         }
 
-        for (unsigned int uvset_index = 0; uvset_index < index_list_array_uvcoord.getCount();
-             uvset_index++) {
-          /* get mtface by face index and uv set index */
-          COLLADAFW::IndexList &index_list = *index_list_array_uvcoord[uvset_index];
-          MLoopUV *mloopuv = (MLoopUV *)CustomData_get_layer_named(
-              &me->ldata, CD_MLOOPUV, index_list.getName().c_str());
-          if (mloopuv == nullptr) {
-            fprintf(stderr,
-                    "Collada import: Mesh [%s] : Unknown reference to TEXCOORD [#%s].\n",
-                    me->id.name,
-                    index_list.getName().c_str());
-          }
-          else {
-            set_face_uv(mloopuv + loop_index,
+        for (unsigned int uvset_index = 0; uvset_index < mloopuvs.size(); uvset_index++) {
+          if (mloopuvs[uvset_index] != nullptr) {
+            set_face_uv(mloopuvs[uvset_index] + loop_index,
                         uvs,
                         start_index,
                         *index_list_array_uvcoord[uvset_index],
@@ -767,24 +789,13 @@ void MeshImporter::read_polys(COLLADAFW::Mesh *collada_mesh, Mesh *me)
           }
         }
 
-        if (mp->hasColorIndices()) {
-          int vcolor_count = index_list_array_vcolor.getCount();
-
-          for (unsigned int vcolor_index = 0; vcolor_index < vcolor_count; vcolor_index++) {
-
-            COLLADAFW::IndexList &color_index_list = *mp->getColorIndices(vcolor_index);
-            COLLADAFW::String colname = extract_vcolname(color_index_list.getName());
-            MLoopCol *mloopcol = (MLoopCol *)CustomData_get_layer_named(
-                &me->ldata, CD_MLOOPCOL, colname.c_str());
-            if (mloopcol == nullptr) {
-              fprintf(stderr,
-                      "Collada import: Mesh [%s] : Unknown reference to VCOLOR [#%s].\n",
-                      me->id.name,
-                      color_index_list.getName().c_str());
-            }
-            else {
-              set_vcol(mloopcol + loop_index, vcol, start_index, color_index_list, vcount);
-            }
+        for (unsigned int vcolor_index = 0; vcolor_index < mloopcols.size(); vcolor_index++) {
+          if (mloopcols[vcolor_index] != nullptr) {
+            set_vcol(mloopcols[vcolor_index] + loop_index,
+                     vcol,
+                     start_index,
+                     *mp->getColorIndices(vcolor_index),
+                     vcount);
           }
         }
 
@@ -818,7 +829,7 @@ void MeshImporter::read_polys(COLLADAFW::Mesh *collada_mesh, Mesh *me)
     }
   }
 
-  geom_uid_mat_mapping_map[collada_mesh->getUniqueId()] = mat_prim_map;
+  geom_uid_mat_mapping_map[collada_mesh->getUniqueId()] = std::move(mat_prim_map);
 }
 
 void MeshImporter::get_vector(float v[3], COLLADAFW::MeshVertexData &arr, int i, int stride)
@@ -887,16 +898,18 @@ bool MeshImporter::is_flat_face(unsigned int *nind, COLLADAFW::MeshVertexData &n
 
 Object *MeshImporter::get_object_by_geom_uid(const COLLADAFW::UniqueId &geom_uid)
 {
-  if (uid_object_map.find(geom_uid) != uid_object_map.end()) {
-    return uid_object_map[geom_uid];
+  auto it = uid_object_map.find(geom_uid);
+  if (it != uid_object_map.end()) {
+    return it->second;
   }
   return nullptr;
 }
 
 Mesh *MeshImporter::get_mesh_by_geom_uid(const COLLADAFW::UniqueId &geom_uid)
 {
-  if (uid_mesh_map.find(geom_uid) != uid_mesh_map.end()) {
-    return uid_mesh_map[geom_uid];
+  auto it = uid_mesh_map.find(geom_uid);
+  if (it != uid_mesh_map.end()) {
+    return it->second;
   }
   return nullptr;
 }
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 #include "COLLADAFWIndexList.h"
@@ -85,9 +86,11 @@ class MeshImporter : public MeshImporterBase {
   ArmatureImporter *armature_importer;
 
   std::map<std::string, std::string> mesh_geom_map;       /* needed for correct shape key naming */
-  std::map<COLLADAFW::UniqueId, Mesh *> uid_mesh_map;     /* geometry unique id-to-mesh map */
-  std::map<COLLADAFW::UniqueId, Object *> uid_object_map; /* geom uid-to-object */
-  std::vector<Object *> imported_objects;                 /* list of imported objects */
+  /* geometry unique id-to-mesh map */
+  std::unordered_map<COLLADAFW::UniqueId, Mesh *, bc_UniqueIdHash> uid_mesh_map;
+  /* geom uid-to-object */
+  std::unordered_map<COLLADAFW::UniqueId, Object *, bc_UniqueIdHash> uid_object_map;
+  std::vector<Object *> imported_objects; /* list of imported objects */
 
   /* this structure is used to assign material indices to polygons
    * it holds a portion of Mesh faces and corresponds to a DAE primitive list
@@ -98,7 +101,8 @@ class MeshImporter : public MeshImporterBase {
   };
   typedef std::map<COLLADAFW::MaterialId, std::vector<Primitive>> MaterialIdPrimitiveArrayMap;
   /* crazy name! */
-  std::map<COLLADAFW::UniqueId, MaterialIdPrimitiveArrayMap> geom_uid_mat_mapping_map;
+  std::unordered_map<COLLADAFW::UniqueId, MaterialIdPrimitiveArrayMap, bc_UniqueIdHash>
+      geom_uid_mat_mapping_map;
   /* < materials that have already been mapped to a geometry.
    * A pair/of geom uid and mat uid, one geometry can have several materials */
   std::multimap<COLLADAFW::UniqueId, COLLADAFW::UniqueId> materials_mapped_to_geom;
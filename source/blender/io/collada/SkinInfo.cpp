@@ -222,7 +222,7 @@ bool SkinInfo::uses_joint_or_descendant(COLLADAFW::Node *node)
 
 void SkinInfo::link_armature(bContext *C,
                              Object *ob,
-                             std::map<COLLADAFW::UniqueId, COLLADAFW::Node *> &joint_by_uid,
+                             UidNodeHashMap &joint_by_uid,
                              TransformReader *tm)
 {
   Main *bmain = CTX_data_main(C);
@@ -266,8 +266,9 @@ void SkinInfo::link_armature(bContext *C,
 
     /* name group by joint node name */
 
-    if (joint_by_uid.find((*it).joint_uid) != joint_by_uid.end()) {
-      name = bc_get_joint_name(joint_by_uid[(*it).joint_uid]);
+    UidNodeHashMap::iterator joint_it = joint_by_uid.find((*it).joint_uid);
+    if (joint_it != joint_by_uid.end()) {
+      name = bc_get_joint_name(joint_it->second);
     }
 
     BKE_object_defgroup_add_name(ob, name);
@@ -316,7 +317,7 @@ Object *SkinInfo::get_parent()
 }
 
 void SkinInfo::find_root_joints(const std::vector<COLLADAFW::Node *> &root_joints,
-                                std::map<COLLADAFW::UniqueId, COLLADAFW::Node *> &joint_by_uid,
+                                UidNodeHashMap &joint_by_uid,
                                 std::vector<COLLADAFW::Node *> &result)
 {
   std::vector<COLLADAFW::Node *>::const_iterator it;
@@ -326,9 +327,10 @@ void SkinInfo::find_root_joints(const std::vector<COLLADAFW::Node *> &root_joint
     std::vector<JointData>::iterator ji;
     /* for each joint_data in this skin */
     for (ji = joint_data.begin(); ji != joint_data.end(); ji++) {
-      if (joint_by_uid.find((*ji).joint_uid) != joint_by_uid.end()) {
+      UidNodeHashMap::iterator joint_it = joint_by_uid.find((*ji).joint_uid);
+      if (joint_it != joint_by_uid.end()) {
         /* get joint node from joint map */
-        COLLADAFW::Node *joint = joint_by_uid[(*ji).joint_uid];
+        COLLADAFW::Node *joint = joint_it->second;
 
         /* find if joint node is in the tree belonging to the root_joint */
         if (find_node_in_tree(joint, root)) {
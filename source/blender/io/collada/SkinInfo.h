@@ -110,7 +110,7 @@ class SkinInfo {
 
   void link_armature(bContext *C,
                      Object *ob,
-                     std::map<COLLADAFW::UniqueId, COLLADAFW::Node *> &joint_by_uid,
+                     UidNodeHashMap &joint_by_uid,
                      TransformReader *tm);
 
   bPoseChannel *get_pose_channel_from_node(COLLADAFW::Node *node);
@@ -120,7 +120,7 @@ class SkinInfo {
   Object *get_parent();
 
   void find_root_joints(const std::vector<COLLADAFW::Node *> &root_joints,
-                        std::map<COLLADAFW::UniqueId, COLLADAFW::Node *> &joint_by_uid,
+                        UidNodeHashMap &joint_by_uid,
                         std::vector<COLLADAFW::Node *> &result);
 
   bool find_node_in_tree(COLLADAFW::Node *node, COLLADAFW::Node *tree_root);
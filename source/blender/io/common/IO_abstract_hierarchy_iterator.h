@@ -42,6 +42,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 struct Depsgraph;
 struct DupliObject;
@@ -120,11 +121,20 @@ struct HierarchyContext {
  * that's the first frame to be exported, but can be later, for example when objects are
  * instantiated by particles. The AbstractHierarchyWriter::write() function is called on every
  * frame the object exists in the dependency graph and should be exported.
+ *
+ * Every frame is written in two phases. First capture() is called for all writers of the frame in
+ * parallel, then write() is called for each of them, one at a time and in hierarchy order.
  */
 class AbstractHierarchyWriter {
  public:
   virtual ~AbstractHierarchyWriter();
   virtual void write(HierarchyContext &context) = 0;
+
+  /* Copy the evaluated data that write() needs and that is expensive to convert, for example
+   * mesh geometry, into the writer. This runs concurrently with the capture() of other writers,
+   * so it must only read Blender data and must not touch the output file. The default
+   * implementation captures nothing, leaving all work to write(). */
+  virtual void capture(const HierarchyContext &context);
   /* TODO(Sybren): add function like absent() that's called when a writer was previously created,
    * but wasn't used while exporting the current frame (for example, a particle-instanced mesh of
    * which the particle is no longer alive). */
@@ -166,6 +176,7 @@ class EnsuredWriter {
   static EnsuredWriter newly_created(AbstractHierarchyWriter *writer);
 
   bool is_newly_created() const;
+  AbstractHierarchyWriter *get() const;
 
   /* These operators make an EnsuredWriter* act as an AbstractHierarchyWriter* */
   operator bool() const;
@@ -219,13 +230,23 @@ class AbstractHierarchyIterator {
   /* Mapping from ID to its export path. This is used for instancing; given an
    * instanced datablock, the export path of the original can be looked up. */
   typedef std::map<ID *, std::string> ExportPathMap;
+  /* A writer that writes the current frame, with the context to write. */
+  struct PendingWrite {
+    AbstractHierarchyWriter *writer;
+    HierarchyContext context;
+  };
 
  protected:
   ExportGraph export_graph_;
   ExportPathMap duplisource_export_path_;
+  /* Mapping from original object data to the export path of its first export. Other objects that
+   * use the same data unmodified are exported as instance of it. */
+  ExportPathMap shared_data_export_path_;
   Depsgraph *depsgraph_;
   WriterMap writers_;
   ExportSubset export_subset_;
+  /* Writers that write the current frame, in hierarchy order. */
+  std::vector<PendingWrite> pending_writes_;
 
  public:
   explicit AbstractHierarchyIterator(Depsgraph *depsgraph);
@@ -282,10 +303,12 @@ class AbstractHierarchyIterator {
   void determine_duplication_references(const HierarchyContext *parent_context,
                                         std::string indent);
 
-  /* These three functions create writers and call their write() method. */
+  /* These three functions create writers and queue them for writing the current frame. */
   void make_writers(const HierarchyContext *parent_context);
   void make_writer_object_data(const HierarchyContext *context);
   void make_writers_particle_systems(const HierarchyContext *context);
+  /* Let the queued writers capture their data in parallel, then write it in order. */
+  void write_pending();
 
   /* Return the appropriate HierarchyContext for the data of the object represented by
    * object_context. */
@@ -28,12 +28,14 @@
 #include "BKE_anim_data.h"
 #include "BKE_duplilist.h"
 #include "BKE_key.h"
+#include "BKE_modifier.h"
 #include "BKE_object.h"
 #include "BKE_particle.h"
 
 #include "BLI_assert.h"
 #include "BLI_listbase.h"
 #include "BLI_math_matrix.h"
+#include "BLI_task.hh"
 
 #include "DNA_ID.h"
 #include "DNA_layer_types.h"
@@ -127,6 +129,11 @@ bool EnsuredWriter::is_newly_created() const
   return newly_created_;
 }
 
+AbstractHierarchyWriter *EnsuredWriter::get() const
+{
+  return writer_;
+}
+
 EnsuredWriter::operator bool() const
 {
   return writer_ != nullptr;
@@ -141,6 +148,10 @@ AbstractHierarchyWriter::~AbstractHierarchyWriter()
 {
 }
 
+void AbstractHierarchyWriter::capture(const HierarchyContext & /*context*/)
+{
+}
+
 bool AbstractHierarchyWriter::check_is_animated(const HierarchyContext &context) const
 {
   const Object *object = context.object;
@@ -204,9 +215,27 @@ void AbstractHierarchyIterator::iterate_and_write()
   determine_export_paths(HierarchyContext::root());
   determine_duplication_references(HierarchyContext::root(), "");
   make_writers(HierarchyContext::root());
+  write_pending();
   export_graph_clear();
 }
 
+void AbstractHierarchyIterator::write_pending()
+{
+  /* Converting evaluated data is usually the expensive part of exporting, and can be done for
+   * all writers at the same time. Writing to the file has to be serialized. */
+  blender::parallel_for(
+      blender::IndexRange(pending_writes_.size()), 1, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          pending_writes_[i].writer->capture(pending_writes_[i].context);
+        }
+      });
+
+  for (PendingWrite &pending : pending_writes_) {
+    pending.writer->write(pending.context);
+  }
+  pending_writes_.clear();
+}
+
 void AbstractHierarchyIterator::release_writers()
 {
   for (WriterMap::value_type it : writers_) {
@@ -539,6 +568,31 @@ void AbstractHierarchyIterator::determine_export_paths(const HierarchyContext *p
   }
 }
 
+/* Whether the evaluated object data only depends on the data itself and not on the object using
+ * it, so objects sharing the data can export it once and instance it. */
+static bool object_data_is_shareable(const Object *object)
+{
+  if (object->type != OB_MESH) {
+    return false;
+  }
+
+  VirtualModifierData virtual_modifier_data;
+  if (BKE_modifiers_get_virtual_modifierlist(object, &virtual_modifier_data) != nullptr) {
+    return false;
+  }
+
+  /* Materials linked to the object instead of its data differ between users. */
+  if (object->matbits != nullptr) {
+    for (int i = 0; i < object->totcol; i++) {
+      if (object->matbits[i]) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 void AbstractHierarchyIterator::determine_duplication_references(
     const HierarchyContext *parent_context, std::string indent)
 {
@@ -571,6 +625,20 @@ void AbstractHierarchyIterator::determine_duplication_references(
         }
       }
     }
+    else if (!context->weak_export && object_data_is_shareable(context->object)) {
+      /* Evaluated objects each have their own evaluated data, so compare the original data. */
+      ID *source_data_id = static_cast<ID *>(DEG_get_original_object(context->object)->data);
+      const std::string data_path = get_object_data_path(context);
+      const ExportPathMap::const_iterator &it = shared_data_export_path_.find(source_data_id);
+
+      if (it == shared_data_export_path_.end()) {
+        shared_data_export_path_[source_data_id] = data_path;
+      }
+      else if (it->second != data_path) {
+        /* The object itself is not instanced, only its data refers to the first export. */
+        context->mark_as_instance_of(it->second);
+      }
+    }
 
     determine_duplication_references(context, indent + "  ");
   }
@@ -609,7 +677,7 @@ void AbstractHierarchyIterator::make_writers(const HierarchyContext *parent_cont
       /* XXX This can lead to too many XForms being written. For example, a camera writer can
        * refuse to write an orthographic camera. By the time that this is known, the XForm has
        * already been written. */
-      transform_writer->write(*context);
+      pending_writes_.push_back({transform_writer.get(), *context});
     }
 
     if (!context->weak_export) {
@@ -643,7 +711,8 @@ void AbstractHierarchyIterator::make_writer_object_data(const HierarchyContext *
   }
 
   HierarchyContext data_context = context_for_object_data(context);
-  if (data_context.is_instance()) {
+  /* For data shared by non-duplicated objects, the context already refers to the data. */
+  if (data_context.is_instance() && context->duplicator != nullptr) {
     ID *object_data = static_cast<ID *>(context->object->data);
     data_context.original_export_path = duplisource_export_path_[object_data];
 
@@ -659,7 +728,7 @@ void AbstractHierarchyIterator::make_writer_object_data(const HierarchyContext *
   }
 
   if (data_writer.is_newly_created() || export_subset_.shapes) {
-    data_writer->write(data_context);
+    pending_writes_.push_back({data_writer.get(), data_context});
   }
 }
 
@@ -695,7 +764,7 @@ void AbstractHierarchyIterator::make_writers_particle_systems(
 
     /* Always write upon creation, otherwise depend on which subset is active. */
     if (writer.is_newly_created() || export_subset_.shapes) {
-      writer->write(hair_context);
+      pending_writes_.push_back({writer.get(), hair_context});
     }
   }
 }
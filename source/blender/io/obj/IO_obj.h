@@ -0,0 +1,67 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The Original Code is Copyright (C) 2021 Blender Foundation.
+ * All rights reserved.
+ */
+
+#pragma once
+
+/** \file
+ * \ingroup obj
+ */
+
+#include "BLI_utildefines.h"
+
+#include "DEG_depsgraph.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct bContext;
+struct ReportList;
+
+typedef struct OBJExportParams {
+  /** Write one file per frame of the range, with the frame number added to the file name. */
+  bool export_animation;
+  int start_frame;
+  int end_frame;
+
+  /** Scale applied to the exported geometry. */
+  float global_scale;
+  /** Axes of the file that Blender's forward (Y) and up (Z) axes become, `OB_POSX` etc. */
+  int forward_axis;
+  int up_axis;
+
+  bool export_selected_objects;
+  bool export_uv;
+  bool export_normals;
+  /** Whether to use the viewport or render visibility and modifier settings. */
+  enum eEvaluationMode evaluation_mode;
+} OBJExportParams;
+
+/**
+ * Write the evaluated mesh geometry of the visible objects in the active view layer.
+ * Returns false and reports an error when a file could not be written.
+ */
+bool OBJ_export(struct bContext *C,
+                const char *filepath,
+                const OBJExportParams *params,
+                struct ReportList *reports);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,490 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The Original Code is Copyright (C) 2021 Blender Foundation.
+ * All rights reserved.
+ */
+
+/** \file
+ * \ingroup obj
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <string>
+
+#include "DNA_layer_types.h"
+#include "DNA_mesh_types.h"
+#include "DNA_meshdata_types.h"
+#include "DNA_object_types.h"
+#include "DNA_scene_types.h"
+
+#include "BLI_array.hh"
+#include "BLI_fileops.h"
+#include "BLI_float2.hh"
+#include "BLI_float3.hh"
+#include "BLI_map.hh"
+#include "BLI_math_matrix.h"
+#include "BLI_math_rotation.h"
+#include "BLI_math_vector.h"
+#include "BLI_path_util.h"
+#include "BLI_string.h"
+#include "BLI_system.h"
+#include "BLI_task.h"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
+
+#include "BKE_blender_version.h"
+#include "BKE_context.h"
+#include "BKE_customdata.h"
+#include "BKE_mesh.h"
+#include "BKE_object.h"
+#include "BKE_report.h"
+#include "BKE_scene.h"
+
+#include "DEG_depsgraph.h"
+#include "DEG_depsgraph_build.h"
+#include "DEG_depsgraph_query.h"
+
+#include "IO_obj.h"
+#include "obj_export_format.hh"
+
+namespace blender::io::obj {
+
+/**
+ * Geometry of one object, copied out of the evaluated mesh and already transformed, so that it
+ * can be written while the depsgraph is evaluated for the next frame.
+ */
+struct OBJMesh {
+  std::string name;
+  Array<float3> positions;
+  Array<float2> uvs;
+  Array<float3> normals;
+  /** Start of every face in the corner arrays, with the total number of corners at the end. */
+  Array<int> face_offsets;
+  Array<int> corner_verts;
+  /** Indices into #uvs and #normals, empty when those are not exported. */
+  Array<int> corner_uvs;
+  Array<int> corner_normals;
+};
+
+/** Number of elements formatted by a single task. */
+static constexpr int64_t BLOCK_SIZE = 16384;
+/** Number of formatted blocks kept in memory before they are written to the file. */
+static constexpr int64_t BLOCKS_PER_WRITE = 64;
+
+/* -------------------------------------------------------------------- */
+/** \name Mesh Data
+ * \{ */
+
+static void obj_mesh_fill_normals(const Mesh *mesh, const float normal_mat[3][3], OBJMesh &r_mesh)
+{
+  /* Smooth faces share the vertex normals, flat faces get a normal of their own. */
+  Array<int> vert_normals(mesh->totvert, -1);
+  Vector<float3> normals;
+  r_mesh.corner_normals.reinitialize(mesh->totloop);
+
+  for (const int i : IndexRange(mesh->totpoly)) {
+    const MPoly &poly = mesh->mpoly[i];
+    const IndexRange corners(r_mesh.face_offsets[i], poly.totloop);
+    if (poly.flag & ME_SMOOTH) {
+      for (const int corner : corners) {
+        const int vert = r_mesh.corner_verts[corner];
+        if (vert_normals[vert] == -1) {
+          vert_normals[vert] = int(normals.size());
+          float3 normal;
+          normal_short_to_float_v3(normal, mesh->mvert[vert].no);
+          normals.append(normal);
+        }
+        r_mesh.corner_normals[corner] = vert_normals[vert];
+      }
+    }
+    else {
+      float3 normal;
+      BKE_mesh_calc_poly_normal(&poly, &mesh->mloop[poly.loopstart], mesh->mvert, normal);
+      MutableSpan<int> corner_normals = r_mesh.corner_normals;
+      corner_normals.slice(corners.start(), corners.size()).fill(int(normals.size()));
+      normals.append(normal);
+    }
+  }
+
+  r_mesh.normals.reinitialize(normals.size());
+  parallel_for(normals.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      mul_v3_m3v3(r_mesh.normals[i], normal_mat, normals[i]);
+      normalize_v3(r_mesh.normals[i]);
+    }
+  });
+}
+
+static void obj_mesh_fill_uvs(const Mesh *mesh, OBJMesh &r_mesh)
+{
+  const MLoopUV *mloopuv = static_cast<const MLoopUV *>(
+      CustomData_get_layer(&mesh->ldata, CD_MLOOPUV));
+  if (mloopuv == nullptr) {
+    return;
+  }
+
+  /* Neighboring corners usually share their UV, only write the unique ones. */
+  Map<float2, int> uv_indices;
+  Vector<float2> uvs;
+  r_mesh.corner_uvs.reinitialize(mesh->totloop);
+  for (const int i : IndexRange(mesh->totpoly)) {
+    const MPoly &poly = mesh->mpoly[i];
+    for (const int j : IndexRange(poly.totloop)) {
+      const float2 uv = mloopuv[poly.loopstart + j].uv;
+      const int uv_index = uv_indices.lookup_or_add(uv, int(uvs.size()));
+      if (uv_index == uvs.size()) {
+        uvs.append(uv);
+      }
+      r_mesh.corner_uvs[r_mesh.face_offsets[i] + j] = uv_index;
+    }
+  }
+  r_mesh.uvs = uvs.as_span();
+}
+
+static OBJMesh obj_mesh_create(Object *ob,
+                               const Mesh *mesh,
+                               const float axis_mat[4][4],
+                               const OBJExportParams &params)
+{
+  OBJMesh r_mesh;
+  r_mesh.name = ob->id.name + 2;
+
+  float world_mat[4][4];
+  mul_m4_m4m4(world_mat, axis_mat, ob->obmat);
+  float normal_mat[3][3];
+  copy_m3_m4(normal_mat, world_mat);
+  invert_m3(normal_mat);
+  transpose_m3(normal_mat);
+
+  r_mesh.positions.reinitialize(mesh->totvert);
+  parallel_for(r_mesh.positions.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      mul_v3_m4v3(r_mesh.positions[i], world_mat, mesh->mvert[i].co);
+    }
+  });
+
+  /* Faces are written in order, but their corners don't have to be stored that way. */
+  r_mesh.face_offsets.reinitialize(mesh->totpoly + 1);
+  int offset = 0;
+  for (const int i : IndexRange(mesh->totpoly)) {
+    r_mesh.face_offsets[i] = offset;
+    offset += mesh->mpoly[i].totloop;
+  }
+  r_mesh.face_offsets.last() = offset;
+
+  r_mesh.corner_verts.reinitialize(offset);
+  parallel_for(IndexRange(mesh->totpoly), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      const MPoly &poly = mesh->mpoly[i];
+      for (const int j : IndexRange(poly.totloop)) {
+        r_mesh.corner_verts[r_mesh.face_offsets[i] + j] = mesh->mloop[poly.loopstart + j].v;
+      }
+    }
+  });
+
+  if (params.export_uv) {
+    obj_mesh_fill_uvs(mesh, r_mesh);
+  }
+  if (params.export_normals) {
+    obj_mesh_fill_normals(mesh, normal_mat, r_mesh);
+  }
+
+  return r_mesh;
+}
+
+static void obj_meshes_collect(Depsgraph *depsgraph,
+                               const OBJExportParams &params,
+                               Vector<OBJMesh> &r_meshes)
+{
+  float axis_mat3[3][3];
+  mat3_from_axis_conversion(OB_POSY, OB_POSZ, params.forward_axis, params.up_axis, axis_mat3);
+  mul_m3_fl(axis_mat3, params.global_scale);
+  float axis_mat[4][4];
+  copy_m4_m3(axis_mat, axis_mat3);
+
+  DEG_OBJECT_ITER_BEGIN (depsgraph,
+                         ob,
+                         DEG_ITER_OBJECT_FLAG_LINKED_DIRECTLY |
+                             DEG_ITER_OBJECT_FLAG_LINKED_VIA_SET | DEG_ITER_OBJECT_FLAG_VISIBLE |
+                             DEG_ITER_OBJECT_FLAG_DUPLI) {
+    if (params.export_selected_objects && (ob->base_flag & BASE_SELECTED) == 0) {
+      continue;
+    }
+    const Mesh *mesh = BKE_object_get_evaluated_mesh(ob);
+    if (mesh == nullptr || mesh->totpoly == 0) {
+      continue;
+    }
+    r_meshes.append(obj_mesh_create(ob, mesh, axis_mat, params));
+  }
+  DEG_OBJECT_ITER_END;
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Writing
+ * \{ */
+
+using FormatBlockFn = std::function<void(std::string &r_str)>;
+
+/** Split `size` elements into blocks that are formatted independently. */
+static void add_blocks(Vector<FormatBlockFn> &r_blocks,
+                       const int64_t size,
+                       const std::function<void(IndexRange, std::string &)> &format_fn)
+{
+  for (int64_t start = 0; start < size; start += BLOCK_SIZE) {
+    const IndexRange range(start, std::min(BLOCK_SIZE, size - start));
+    r_blocks.append([range, format_fn](std::string &r_str) { format_fn(range, r_str); });
+  }
+}
+
+static void add_mesh_blocks(Vector<FormatBlockFn> &r_blocks,
+                            const OBJMesh &mesh,
+                            const int vert_offset,
+                            const int uv_offset,
+                            const int normal_offset)
+{
+  r_blocks.append([&mesh](std::string &r_str) {
+    r_str.append("o ").append(mesh.name).append("\n");
+  });
+
+  add_blocks(r_blocks, mesh.positions.size(), [&mesh](IndexRange range, std::string &r_str) {
+    r_str.reserve(range.size() * 32);
+    for (const int64_t i : range) {
+      const float3 &co = mesh.positions[i];
+      r_str.append("v ");
+      append_float(r_str, co.x);
+      r_str.push_back(' ');
+      append_float(r_str, co.y);
+      r_str.push_back(' ');
+      append_float(r_str, co.z);
+      r_str.push_back('\n');
+    }
+  });
+
+  add_blocks(r_blocks, mesh.uvs.size(), [&mesh](IndexRange range, std::string &r_str) {
+    r_str.reserve(range.size() * 24);
+    for (const int64_t i : range) {
+      r_str.append("vt ");
+      append_float(r_str, mesh.uvs[i].x);
+      r_str.push_back(' ');
+      append_float(r_str, mesh.uvs[i].y);
+      r_str.push_back('\n');
+    }
+  });
+
+  add_blocks(r_blocks, mesh.normals.size(), [&mesh](IndexRange range, std::string &r_str) {
+    r_str.reserve(range.size() * 32);
+    for (const int64_t i : range) {
+      const float3 &normal = mesh.normals[i];
+      r_str.append("vn ");
+      append_float(r_str, normal.x);
+      r_str.push_back(' ');
+      append_float(r_str, normal.y);
+      r_str.push_back(' ');
+      append_float(r_str, normal.z);
+      r_str.push_back('\n');
+    }
+  });
+
+  const int64_t faces_num = mesh.face_offsets.size() - 1;
+  add_blocks(r_blocks, faces_num, [&, vert_offset, uv_offset, normal_offset](
+                                      IndexRange range, std::string &r_str) {
+    const bool use_uvs = !mesh.corner_uvs.is_empty();
+    const bool use_normals = !mesh.corner_normals.is_empty();
+    r_str.reserve(range.size() * 32);
+    for (const int64_t i : range) {
+      r_str.push_back('f');
+      for (const int corner : IndexRange(mesh.face_offsets[i],
+                                         mesh.face_offsets[i + 1] - mesh.face_offsets[i])) {
+        /* OBJ indices start at one. */
+        r_str.push_back(' ');
+        append_int(r_str, vert_offset + mesh.corner_verts[corner] + 1);
+        if (use_uvs || use_normals) {
+          r_str.push_back('/');
+        }
+        if (use_uvs) {
+          append_int(r_str, uv_offset + mesh.corner_uvs[corner] + 1);
+        }
+        if (use_normals) {
+          r_str.push_back('/');
+          append_int(r_str, normal_offset + mesh.corner_normals[corner] + 1);
+        }
+      }
+      r_str.push_back('\n');
+    }
+  });
+}
+
+static bool obj_file_write(const char *filepath, Span<OBJMesh> meshes)
+{
+  FILE *file = BLI_fopen(filepath, "wb");
+  if (file == nullptr) {
+    return false;
+  }
+
+  Vector<FormatBlockFn> blocks;
+  blocks.append([](std::string &r_str) {
+    r_str.append("# Blender v").append(BKE_blender_version_string()).append(" OBJ File\n");
+    r_str.append("# www.blender.org\n");
+  });
+
+  int vert_offset = 0;
+  int uv_offset = 0;
+  int normal_offset = 0;
+  for (const OBJMesh &mesh : meshes) {
+    add_mesh_blocks(blocks, mesh, vert_offset, uv_offset, normal_offset);
+    vert_offset += int(mesh.positions.size());
+    uv_offset += int(mesh.uvs.size());
+    normal_offset += int(mesh.normals.size());
+  }
+
+  /* Format a batch of blocks in parallel and write them in order, so that the whole file
+   * doesn't have to be kept in memory. */
+  Array<std::string> buffers(std::min(BLOCKS_PER_WRITE, blocks.size()));
+  for (int64_t start = 0; start < blocks.size(); start += BLOCKS_PER_WRITE) {
+    const IndexRange batch(start, std::min(BLOCKS_PER_WRITE, blocks.size() - start));
+    parallel_for(IndexRange(batch.size()), 1, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        buffers[i].clear();
+        blocks[batch[i]](buffers[i]);
+      }
+    });
+    for (const int64_t i : IndexRange(batch.size())) {
+      fwrite(buffers[i].data(), 1, buffers[i].size(), file);
+    }
+  }
+
+  const bool ok = !ferror(file);
+  return (fclose(file) == 0) && ok;
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Animation
+ *
+ * The depsgraph can only be evaluated for one frame at a time, but the files of the frames
+ * that are already evaluated are written in parallel with the evaluation of the next ones.
+ * \{ */
+
+struct FrameWriteTask {
+  char filepath[FILE_MAX];
+  Vector<OBJMesh> meshes;
+};
+
+static void frame_write_task_run(TaskPool *__restrict pool, void *taskdata)
+{
+  FrameWriteTask *task = static_cast<FrameWriteTask *>(taskdata);
+  std::atomic<bool> *all_ok = static_cast<std::atomic<bool> *>(BLI_task_pool_user_data(pool));
+  if (!obj_file_write(task->filepath, task->meshes)) {
+    *all_ok = false;
+  }
+}
+
+static void frame_write_task_free(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  delete static_cast<FrameWriteTask *>(taskdata);
+}
+
+/** Add the frame number to the file name, before the extension. */
+static void frame_filepath_get(char *r_filepath, const char *filepath, const int frame)
+{
+  char base[FILE_MAX];
+  BLI_strncpy(base, filepath, sizeof(base));
+  BLI_path_extension_replace(base, sizeof(base), "");
+  const char *ext = filepath + strlen(base);
+  BLI_snprintf(r_filepath, FILE_MAX, "%s_%06d%s", base, frame, ext);
+}
+
+static bool obj_export_animation(Depsgraph *depsgraph,
+                                 const char *filepath,
+                                 const OBJExportParams &params)
+{
+  Scene *scene = DEG_get_input_scene(depsgraph);
+  const int orig_frame = CFRA;
+
+  /* Only keep a few frames in memory when writing is slower than evaluating. */
+  const int frames_in_flight = std::max(2, BLI_system_thread_count());
+
+  std::atomic<bool> all_ok = true;
+  TaskPool *pool = BLI_task_pool_create(&all_ok, TASK_PRIORITY_HIGH);
+  int frames_pending = 0;
+
+  for (int frame = params.start_frame; frame <= params.end_frame; frame++) {
+    CFRA = frame;
+    BKE_scene_graph_update_for_newframe(depsgraph);
+
+    FrameWriteTask *task = new FrameWriteTask();
+    frame_filepath_get(task->filepath, filepath, frame);
+    obj_meshes_collect(depsgraph, params, task->meshes);
+    BLI_task_pool_push(pool, frame_write_task_run, task, true, frame_write_task_free);
+
+    if (++frames_pending == frames_in_flight) {
+      BLI_task_pool_work_and_wait(pool);
+      frames_pending = 0;
+    }
+  }
+  BLI_task_pool_work_and_wait(pool);
+  BLI_task_pool_free(pool);
+
+  if (CFRA != orig_frame) {
+    CFRA = orig_frame;
+    BKE_scene_graph_update_for_newframe(depsgraph);
+  }
+
+  return all_ok;
+}
+
+/** \} */
+
+}  // namespace blender::io::obj
+
+bool OBJ_export(bContext *C,
+                const char *filepath,
+                const OBJExportParams *params,
+                ReportList *reports)
+{
+  using namespace blender::io::obj;
+
+  Main *bmain = CTX_data_main(C);
+  Scene *scene = CTX_data_scene(C);
+  ViewLayer *view_layer = CTX_data_view_layer(C);
+
+  /* A depsgraph of its own, so that the evaluation mode and the frame can be changed. */
+  Depsgraph *depsgraph = DEG_graph_new(bmain, scene, view_layer, params->evaluation_mode);
+  DEG_graph_build_from_view_layer(depsgraph);
+  BKE_scene_graph_update_tagged(depsgraph, bmain);
+
+  bool ok;
+  if (params->export_animation) {
+    ok = obj_export_animation(depsgraph, filepath, *params);
+  }
+  else {
+    blender::Vector<OBJMesh> meshes;
+    obj_meshes_collect(depsgraph, *params, meshes);
+    ok = obj_file_write(filepath, meshes);
+  }
+
+  DEG_graph_free(depsgraph);
+
+  if (!ok) {
+    BKE_reportf(reports, RPT_ERROR, "Cannot write file '%s'", filepath);
+  }
+  return ok;
+}
@@ -0,0 +1,107 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The Original Code is Copyright (C) 2021 Blender Foundation.
+ * All rights reserved.
+ */
+
+#pragma once
+
+/** \file
+ * \ingroup obj
+ *
+ * Number formatting for the OBJ exporter. The standard library formatting functions are
+ * locale dependent and slow, which is noticeable when writing millions of coordinates.
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace blender::io::obj {
+
+/** Large enough for any number formatted by #format_float or #format_int. */
+constexpr int NUMBER_BUFFER_SIZE = 64;
+
+inline char *format_uint(char *buf, uint64_t value)
+{
+  char digits[20];
+  int len = 0;
+  do {
+    digits[len++] = char('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  while (len > 0) {
+    *buf++ = digits[--len];
+  }
+  return buf;
+}
+
+/**
+ * Write `value` as a decimal integer to `buf`, without a terminator.
+ * \return The end of the written text.
+ */
+inline char *format_int(char *buf, const int64_t value)
+{
+  if (value < 0) {
+    *buf++ = '-';
+    return format_uint(buf, uint64_t(-(value + 1)) + 1);
+  }
+  return format_uint(buf, uint64_t(value));
+}
+
+/**
+ * Write `value` with six decimals to `buf`, without a terminator. The text is identical to
+ * `printf("%.6f")` in the C locale.
+ * \return The end of the written text.
+ */
+inline char *format_float(char *buf, const float value)
+{
+  const double abs_value = std::abs(double(value));
+  if (!(abs_value < 1e12)) {
+    /* Also handles infinity and NaN. */
+    return buf + snprintf(buf, NUMBER_BUFFER_SIZE, "%.6f", double(value));
+  }
+
+  if (std::signbit(value)) {
+    *buf++ = '-';
+  }
+  /* The product is exact because both factors have few enough significant bits, so rounding
+   * (with ties to even) gives the same digits as printf. */
+  const uint64_t scaled = uint64_t(std::nearbyint(abs_value * 1e6));
+  buf = format_uint(buf, scaled / 1000000);
+  *buf++ = '.';
+  uint64_t fraction = scaled % 1000000;
+  for (int i = 5; i >= 0; i--) {
+    buf[i] = char('0' + fraction % 10);
+    fraction /= 10;
+  }
+  return buf + 6;
+}
+
+inline void append_int(std::string &r_str, const int64_t value)
+{
+  char buf[NUMBER_BUFFER_SIZE];
+  r_str.append(buf, format_int(buf, value));
+}
+
+inline void append_float(std::string &r_str, const float value)
+{
+  char buf[NUMBER_BUFFER_SIZE];
+  r_str.append(buf, format_float(buf, value));
+}
+
+}  // namespace blender::io::obj
@@ -0,0 +1,84 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The Original Code is Copyright (C) 2021 Blender Foundation.
+ * All rights reserved.
+ */
+#include "testing/testing.h"
+
+#include <cfloat>
+#include <cstdio>
+
+#include "obj_export_format.hh"
+
+namespace blender::io::obj::tests {
+
+static std::string printf_float(const float value)
+{
+  char buf[NUMBER_BUFFER_SIZE];
+  snprintf(buf, sizeof(buf), "%.6f", double(value));
+  return buf;
+}
+
+static std::string format_float_str(const float value)
+{
+  std::string str;
+  append_float(str, value);
+  return str;
+}
+
+TEST(obj_export_format, format_int)
+{
+  std::string str;
+  append_int(str, 0);
+  str.push_back(' ');
+  append_int(str, 1234567);
+  str.push_back(' ');
+  append_int(str, -42);
+  str.push_back(' ');
+  append_int(str, INT64_MIN);
+  EXPECT_EQ(str, "0 1234567 -42 -9223372036854775808");
+}
+
+TEST(obj_export_format, format_float)
+{
+  EXPECT_EQ(format_float_str(0.0f), "0.000000");
+  EXPECT_EQ(format_float_str(-0.0f), "-0.000000");
+  EXPECT_EQ(format_float_str(1.5f), "1.500000");
+  EXPECT_EQ(format_float_str(-2.25f), "-2.250000");
+  EXPECT_EQ(format_float_str(-1e-7f), "-0.000000");
+  /* Exact ties round to even, like printf. */
+  EXPECT_EQ(format_float_str(0.0078125f), "0.007812");
+  EXPECT_EQ(format_float_str(0.0234375f), "0.023438");
+}
+
+TEST(obj_export_format, format_float_matches_printf)
+{
+  const float values[] = {
+      0.1f, 0.3333333f, -0.6666667f, 1.0f / 3.0f, 123.456789f, -98765.4321f, 1e-6f, 5e-7f,
+      4.9999999e-7f, 1e11f, 3e12f, 1e30f, -FLT_MAX, FLT_MIN, INFINITY, -INFINITY,
+  };
+  for (const float value : values) {
+    EXPECT_EQ(format_float_str(value), printf_float(value));
+  }
+
+  /* A range of values with all kinds of fractions. */
+  for (int i = -100000; i <= 100000; i += 7) {
+    const float value = float(i) * 0.0137f;
+    EXPECT_EQ(format_float_str(value), printf_float(value));
+  }
+}
+
+}  // namespace blender::io::obj::tests
@@ -0,0 +1,56 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The Original Code is Copyright (C) 2021 Blender Foundation.
+ * All rights reserved.
+ */
+
+#pragma once
+
+/** \file
+ * \ingroup stl
+ */
+
+#include "BLI_utildefines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct bContext;
+struct ReportList;
+
+typedef struct STLImportParams {
+  /** Scale applied to the imported geometry. */
+  float global_scale;
+  /** Axes of the file that become Blender's forward (Y) and up (Z) axes, `OB_POSX` etc. */
+  int forward_axis;
+  int up_axis;
+  /** Use the facet normals of the file as custom normals. */
+  bool use_facet_normal;
+} STLImportParams;
+
+/**
+ * Import a binary or ASCII STL file as a new mesh object in the active collection.
+ * Returns false and reports an error when the file can't be read.
+ */
+bool STL_import(struct bContext *C,
+                const char *filepath,
+                const struct STLImportParams *params,
+                struct ReportList *reports);
+
+#ifdef __cplusplus
+}
+#endif
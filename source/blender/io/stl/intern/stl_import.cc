@@ -0,0 +1,534 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The Original Code is Copyright (C) 2021 Blender Foundation.
+ * All rights reserved.
+ */
+
+/** \file
+ * \ingroup stl
+ */
+
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
+
+#ifdef WIN32
+#  include <io.h>
+#else
+#  include <unistd.h>
+#endif
+
+#include "MEM_guardedalloc.h"
+
+#include "DNA_collection_types.h"
+#include "DNA_layer_types.h"
+#include "DNA_mesh_types.h"
+#include "DNA_meshdata_types.h"
+#include "DNA_object_types.h"
+#include "DNA_scene_types.h"
+
+#include "BLI_array.hh"
+#include "BLI_endian_switch.h"
+#include "BLI_fileops.h"
+#include "BLI_map.hh"
+#include "BLI_math_matrix.h"
+#include "BLI_math_rotation.h"
+#include "BLI_math_vector.h"
+#include "BLI_mmap.h"
+#include "BLI_path_util.h"
+#include "BLI_string.h"
+#include "BLI_string_ref.hh"
+#include "BLI_task.hh"
+
+#include "BKE_collection.h"
+#include "BKE_context.h"
+#include "BKE_customdata.h"
+#include "BKE_global.h"
+#include "BKE_layer.h"
+#include "BKE_main.h"
+#include "BKE_mesh.h"
+#include "BKE_object.h"
+#include "BKE_report.h"
+
+#include "DEG_depsgraph.h"
+#include "DEG_depsgraph_build.h"
+
+#include "IO_stl.h"
+#include "stl_import.hh"
+
+namespace blender::io::stl {
+
+/* -------------------------------------------------------------------- */
+/** \name Binary STL
+ *
+ * An 80 byte header, the number of triangles as 32 bit integer, and per triangle: the facet
+ * normal, three vertex positions (all little endian floats) and a 16 bit attribute count.
+ * \{ */
+
+static constexpr int64_t BINARY_HEADER_SIZE = 80 + sizeof(uint32_t);
+static constexpr int64_t BINARY_FACET_SIZE = 12 * sizeof(float) + sizeof(uint16_t);
+
+static bool is_binary_stl(Span<char> data, uint32_t *r_tris_num)
+{
+  if (data.size() < BINARY_HEADER_SIZE) {
+    return false;
+  }
+  uint32_t tris_num;
+  memcpy(&tris_num, data.data() + 80, sizeof(tris_num));
+  if (ENDIAN_ORDER == B_ENDIAN) {
+    BLI_endian_switch_uint32(&tris_num);
+  }
+  /* ASCII files can start with anything, but their size is very unlikely to match. */
+  if (BINARY_HEADER_SIZE + int64_t(tris_num) * BINARY_FACET_SIZE != data.size()) {
+    return false;
+  }
+  *r_tris_num = tris_num;
+  return true;
+}
+
+static void parse_binary(Span<char> data, const uint32_t tris_num, STLMeshData &r_mesh_data)
+{
+  r_mesh_data.positions.resize(int64_t(tris_num) * 3);
+  r_mesh_data.normals.resize(tris_num);
+
+  parallel_for(IndexRange(tris_num), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      /* Facets are not aligned, copy them out. */
+      float facet[12];
+      memcpy(facet, data.data() + BINARY_HEADER_SIZE + i * BINARY_FACET_SIZE, sizeof(facet));
+      if (ENDIAN_ORDER == B_ENDIAN) {
+        BLI_endian_switch_float_array(facet, 12);
+      }
+      r_mesh_data.normals[i] = float3(facet);
+      for (int j = 0; j < 3; j++) {
+        r_mesh_data.positions[i * 3 + j] = float3(facet + 3 + j * 3);
+      }
+    }
+  });
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name ASCII STL
+ *
+ * Only the `facet normal`, `vertex` and `endfacet` keywords matter, `solid` and `endsolid` are
+ * followed by a name that is skipped. The remaining keywords (`outer loop`, `endloop`) are
+ * ignored.
+ * \{ */
+
+static bool is_space(const char c)
+{
+  return ELEM(c, ' ', '\t', '\n', '\r', '\f', '\v');
+}
+
+static bool is_digit(const char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+static void skip_space(const char *&p, const char *end)
+{
+  while (p < end && is_space(*p)) {
+    p++;
+  }
+}
+
+static void skip_line(const char *&p, const char *end)
+{
+  while (p < end && *p != '\n') {
+    p++;
+  }
+}
+
+static StringRef next_token(const char *&p, const char *end)
+{
+  skip_space(p, end);
+  const char *start = p;
+  while (p < end && !is_space(*p)) {
+    p++;
+  }
+  return StringRef(start, p);
+}
+
+/**
+ * Parse a decimal floating point number without relying on the data being null terminated
+ * (unlike `strtof`), and without the locale handling of the standard library.
+ */
+static bool parse_float(const char *&p, const char *end, float &r_value)
+{
+  /* Exactly representable powers of ten, so numbers with up to 15 significant digits and a small
+   * exponent are converted with a single correctly rounded multiplication or division. */
+  static const double powers_of_ten[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                         1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                         1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  const uint64_t mantissa_max = 100000000000000000ull;
+
+  skip_space(p, end);
+  const char *start = p;
+
+  bool negative = false;
+  if (p < end && ELEM(*p, '-', '+')) {
+    negative = *p == '-';
+    p++;
+  }
+
+  uint64_t mantissa = 0;
+  int exponent = 0;
+  int digits = 0;
+  for (; p < end && is_digit(*p); p++, digits++) {
+    if (mantissa < mantissa_max) {
+      mantissa = mantissa * 10 + uint64_t(*p - '0');
+    }
+    else {
+      exponent++;
+    }
+  }
+  if (p < end && *p == '.') {
+    p++;
+    for (; p < end && is_digit(*p); p++, digits++) {
+      if (mantissa < mantissa_max) {
+        mantissa = mantissa * 10 + uint64_t(*p - '0');
+        exponent--;
+      }
+    }
+  }
+  if (digits == 0) {
+    p = start;
+    return false;
+  }
+
+  if (p < end && ELEM(*p, 'e', 'E')) {
+    const char *exponent_start = p;
+    p++;
+    bool exponent_negative = false;
+    if (p < end && ELEM(*p, '-', '+')) {
+      exponent_negative = *p == '-';
+      p++;
+    }
+    if (p < end && is_digit(*p)) {
+      int exponent_value = 0;
+      for (; p < end && is_digit(*p); p++) {
+        exponent_value = std::min(exponent_value * 10 + (*p - '0'), 100000);
+      }
+      exponent += exponent_negative ? -exponent_value : exponent_value;
+    }
+    else {
+      /* Not an exponent after all. */
+      p = exponent_start;
+    }
+  }
+
+  double value = double(mantissa);
+  if (exponent < 0 && exponent >= -22) {
+    value /= powers_of_ten[-exponent];
+  }
+  else if (exponent > 0 && exponent <= 22) {
+    value *= powers_of_ten[exponent];
+  }
+  else if (exponent != 0) {
+    value *= std::pow(10.0, double(exponent));
+  }
+
+  r_value = float(negative ? -value : value);
+  return true;
+}
+
+static bool parse_float3(const char *&p, const char *end, float3 &r_value)
+{
+  return parse_float(p, end, r_value.x) && parse_float(p, end, r_value.y) &&
+         parse_float(p, end, r_value.z);
+}
+
+/** Whether the text at `p` is the `facet` keyword, and not the end of `endfacet`. */
+static bool is_facet_keyword(const char *p, const char *begin, const char *end)
+{
+  const int64_t len = 5;
+  return (end - p > len) && memcmp(p, "facet", len) == 0 && is_space(p[len]) &&
+         (p == begin || is_space(p[-1]));
+}
+
+/** Find the first facet that starts at or after `p`, or `end` when there is none. */
+static const char *find_facet_start(const char *p, const char *begin, const char *end)
+{
+  for (; p < end; p++) {
+    if (*p == 'f' && is_facet_keyword(p, begin, end)) {
+      return p;
+    }
+  }
+  return end;
+}
+
+static bool parse_ascii_chunk(const char *p, const char *end, STLMeshData &r_mesh_data)
+{
+  bool in_facet = false;
+  int facet_vertices_num = 0;
+
+  /* Facets that don't have exactly three vertices are skipped. */
+  auto facet_finish = [&]() {
+    if (in_facet && facet_vertices_num != 3) {
+      r_mesh_data.positions.resize(r_mesh_data.positions.size() - facet_vertices_num);
+      r_mesh_data.normals.remove_last();
+    }
+    in_facet = false;
+    facet_vertices_num = 0;
+  };
+
+  while (true) {
+    const StringRef token = next_token(p, end);
+    if (token.is_empty()) {
+      break;
+    }
+
+    if (token == "facet") {
+      facet_finish();
+      float3 normal;
+      if (next_token(p, end) != "normal" || !parse_float3(p, end, normal)) {
+        return false;
+      }
+      r_mesh_data.normals.append(normal);
+      in_facet = true;
+    }
+    else if (token == "vertex") {
+      float3 position;
+      if (!in_facet || !parse_float3(p, end, position)) {
+        return false;
+      }
+      r_mesh_data.positions.append(position);
+      facet_vertices_num++;
+    }
+    else if (token == "endfacet") {
+      facet_finish();
+    }
+    else if (ELEM(token, "solid", "endsolid")) {
+      skip_line(p, end);
+    }
+  }
+
+  /* A truncated file may end in the middle of a facet. */
+  facet_finish();
+  return true;
+}
+
+static bool parse_ascii(Span<char> data, STLMeshData &r_mesh_data)
+{
+  const char *begin = data.data();
+  const char *end = begin + data.size();
+
+  /* Split into chunks of at least a megabyte that start at facet boundaries. */
+  const int64_t chunk_size = 1 << 20;
+  const int64_t chunks_num = std::max(int64_t(1), data.size() / chunk_size);
+  Array<const char *> chunk_starts(chunks_num + 1);
+  chunk_starts[0] = begin;
+  for (const int64_t i : IndexRange(1, chunks_num - 1)) {
+    chunk_starts[i] = find_facet_start(
+        std::max(begin + i * chunk_size, chunk_starts[i - 1]), begin, end);
+  }
+  chunk_starts[chunks_num] = end;
+
+  Array<STLMeshData> chunks(chunks_num);
+  Array<bool> chunks_ok(chunks_num);
+  parallel_for(chunks.index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      chunks_ok[i] = parse_ascii_chunk(chunk_starts[i], chunk_starts[i + 1], chunks[i]);
+    }
+  });
+
+  for (const int64_t i : chunks.index_range()) {
+    if (!chunks_ok[i]) {
+      return false;
+    }
+    r_mesh_data.positions.extend(chunks[i].positions);
+    r_mesh_data.normals.extend(chunks[i].normals);
+  }
+  return true;
+}
+
+/** \} */
+
+bool stl_parse(Span<char> data, STLMeshData &r_mesh_data)
+{
+  uint32_t tris_num;
+  if (is_binary_stl(data, &tris_num)) {
+    parse_binary(data, tris_num, r_mesh_data);
+    return true;
+  }
+
+  const char *p = data.data();
+  if (next_token(p, data.data() + data.size()) != "solid") {
+    return false;
+  }
+  return parse_ascii(data, r_mesh_data);
+}
+
+/* -------------------------------------------------------------------- */
+/** \name Mesh Creation
+ * \{ */
+
+static Mesh *stl_mesh_create(Main *bmain,
+                             const char *name,
+                             const STLMeshData &mesh_data,
+                             const STLImportParams &params)
+{
+  const int64_t tris_num = mesh_data.normals.size();
+
+  /* Merge vertices with identical positions, STL files store every triangle separately. */
+  Vector<float3> verts;
+  Array<int> corner_verts(tris_num * 3);
+  {
+    Map<float3, int> vert_indices;
+    vert_indices.reserve(tris_num / 2);
+    for (const int64_t i : corner_verts.index_range()) {
+      const float3 &co = mesh_data.positions[i];
+      /* Adding zero turns negative zero into zero, which compares equal but hashes differently. */
+      const float3 key(co.x + 0.0f, co.y + 0.0f, co.z + 0.0f);
+      const int vert_index = vert_indices.lookup_or_add(key, int(verts.size()));
+      if (vert_index == verts.size()) {
+        verts.append(key);
+      }
+      corner_verts[i] = vert_index;
+    }
+  }
+
+  /* Skip triangles that collapsed into an edge or a point. */
+  Vector<int> tri_indices;
+  tri_indices.reserve(tris_num);
+  for (const int64_t i : IndexRange(tris_num)) {
+    const int *tri = &corner_verts[i * 3];
+    if (tri[0] != tri[1] && tri[1] != tri[2] && tri[2] != tri[0]) {
+      tri_indices.append(int(i));
+    }
+  }
+
+  float mat[3][3];
+  mat3_from_axis_conversion(params.forward_axis, params.up_axis, OB_POSY, OB_POSZ, mat);
+
+  Mesh *mesh = BKE_mesh_add(bmain, name);
+  mesh->totvert = int(verts.size());
+  mesh->totpoly = int(tri_indices.size());
+  mesh->totloop = mesh->totpoly * 3;
+  CustomData_add_layer(&mesh->vdata, CD_MVERT, CD_CALLOC, nullptr, mesh->totvert);
+  CustomData_add_layer(&mesh->ldata, CD_MLOOP, CD_CALLOC, nullptr, mesh->totloop);
+  CustomData_add_layer(&mesh->pdata, CD_MPOLY, CD_CALLOC, nullptr, mesh->totpoly);
+  BKE_mesh_update_customdata_pointers(mesh, false);
+
+  parallel_for(verts.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      float *co = mesh->mvert[i].co;
+      mul_v3_m3v3(co, mat, verts[i]);
+      mul_v3_fl(co, params.global_scale);
+    }
+  });
+
+  parallel_for(tri_indices.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      MPoly &poly = mesh->mpoly[i];
+      poly.loopstart = int(i * 3);
+      poly.totloop = 3;
+      for (int j = 0; j < 3; j++) {
+        mesh->mloop[i * 3 + j].v = corner_verts[tri_indices[i] * 3 + j];
+      }
+    }
+  });
+
+  BKE_mesh_calc_edges(mesh, false, false);
+  BKE_mesh_calc_normals(mesh);
+
+  if (params.use_facet_normal) {
+    float(*loop_normals)[3] = static_cast<float(*)[3]>(
+        MEM_malloc_arrayN(mesh->totloop, sizeof(float[3]), __func__));
+    for (const int64_t i : tri_indices.index_range()) {
+      float normal[3];
+      mul_v3_m3v3(normal, mat, mesh_data.normals[tri_indices[i]]);
+      normalize_v3(normal);
+      for (int j = 0; j < 3; j++) {
+        copy_v3_v3(loop_normals[i * 3 + j], normal);
+      }
+      /* Custom normals are only used for smooth faces. */
+      mesh->mpoly[i].flag |= ME_SMOOTH;
+    }
+    mesh->flag |= ME_AUTOSMOOTH;
+    BKE_mesh_set_custom_normals(mesh, loop_normals);
+    MEM_freeN(loop_normals);
+  }
+
+  return mesh;
+}
+
+/** \} */
+
+}  // namespace blender::io::stl
+
+bool STL_import(bContext *C,
+                const char *filepath,
+                const STLImportParams *params,
+                ReportList *reports)
+{
+  using namespace blender::io::stl;
+
+  const int file = BLI_open(filepath, O_BINARY | O_RDONLY, 0);
+  if (file == -1) {
+    BKE_reportf(reports, RPT_ERROR, "Cannot open file '%s'", filepath);
+    return false;
+  }
+
+  const size_t size = BLI_file_descriptor_size(file);
+  BLI_mmap_file *mmap_file = (size > 0) ? BLI_mmap_open(file) : nullptr;
+  if (mmap_file == nullptr) {
+    BKE_reportf(reports, RPT_ERROR, "Cannot read file '%s'", filepath);
+    close(file);
+    return false;
+  }
+
+  const char *contents = static_cast<const char *>(BLI_mmap_get_pointer(mmap_file));
+  STLMeshData mesh_data;
+  bool ok = stl_parse(blender::Span<char>(contents, int64_t(size)), mesh_data);
+  if (BLI_mmap_any_io_error(mmap_file)) {
+    ok = false;
+  }
+  BLI_mmap_free(mmap_file);
+  close(file);
+
+  if (!ok) {
+    BKE_reportf(reports, RPT_ERROR, "File '%s' is not a valid STL file", filepath);
+    return false;
+  }
+
+  Main *bmain = CTX_data_main(C);
+  Scene *scene = CTX_data_scene(C);
+  ViewLayer *view_layer = CTX_data_view_layer(C);
+
+  char name[FILE_MAX];
+  BLI_strncpy(name, BLI_path_basename(filepath), sizeof(name));
+  BLI_path_extension_replace(name, sizeof(name), "");
+
+  Mesh *mesh = stl_mesh_create(bmain, name, mesh_data, *params);
+  Object *ob = BKE_object_add_only_object(bmain, OB_MESH, name);
+  ob->data = mesh;
+
+  LayerCollection *lc = BKE_layer_collection_get_active(view_layer);
+  BKE_collection_object_add(bmain, lc->collection, ob);
+  Base *base = BKE_view_layer_base_find(view_layer, ob);
+  BKE_view_layer_base_select_and_set_active(view_layer, base);
+
+  DEG_id_tag_update(&lc->collection->id, ID_RECALC_COPY_ON_WRITE);
+  DEG_id_tag_update_ex(
+      bmain, &ob->id, ID_RECALC_TRANSFORM | ID_RECALC_GEOMETRY | ID_RECALC_ANIMATION);
+  DEG_id_tag_update(&scene->id, ID_RECALC_BASE_FLAGS);
+  DEG_relations_tag_update(bmain);
+
+  return true;
+}
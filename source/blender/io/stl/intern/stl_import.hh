@@ -0,0 +1,48 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The Original Code is Copyright (C) 2021 Blender Foundation.
+ * All rights reserved.
+ */
+
+#pragma once
+
+/** \file
+ * \ingroup stl
+ */
+
+#include "BLI_float3.hh"
+#include "BLI_span.hh"
+#include "BLI_vector.hh"
+
+namespace blender::io::stl {
+
+/** Triangles as read from an STL file, before identical vertices are merged. */
+struct STLMeshData {
+  /** Three positions per triangle. */
+  Vector<float3> positions;
+  /** One facet normal per triangle. */
+  Vector<float3> normals;
+};
+
+/**
+ * Parse the contents of a binary or ASCII STL file. Binary files are detected by their size,
+ * which always matches the triangle count in their header; ASCII files are split into chunks at
+ * facet boundaries, and both are parsed on multiple threads.
+ * Returns false when the data is neither a valid binary nor ASCII STL file.
+ */
+bool stl_parse(Span<char> data, STLMeshData &r_mesh_data);
+
+}  // namespace blender::io::stl
@@ -0,0 +1,115 @@
+/*
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The Original Code is Copyright (C) 2021 Blender Foundation.
+ * All rights reserved.
+ */
+#include "testing/testing.h"
+
+#include <cstring>
+
+#include "stl_import.hh"
+
+namespace blender::io::stl::tests {
+
+static bool parse_string(const char *str, STLMeshData &r_mesh_data)
+{
+  return stl_parse(Span<char>(str, int64_t(strlen(str))), r_mesh_data);
+}
+
+TEST(stl_import, ascii_single_facet)
+{
+  const char *str =
+      "solid cube_corner\n"
+      "  facet normal 0.0 -1.0 0.0\n"
+      "    outer loop\n"
+      "      vertex 0.0 0.0 0.0\n"
+      "      vertex 1.0 0.0 0.0\n"
+      "      vertex 0.0 0.0 1.5e1\n"
+      "    endloop\n"
+      "  endfacet\n"
+      "endsolid cube_corner\n";
+
+  STLMeshData mesh_data;
+  EXPECT_TRUE(parse_string(str, mesh_data));
+  ASSERT_EQ(mesh_data.normals.size(), 1);
+  ASSERT_EQ(mesh_data.positions.size(), 3);
+  EXPECT_EQ(mesh_data.normals[0], float3(0.0f, -1.0f, 0.0f));
+  EXPECT_EQ(mesh_data.positions[1], float3(1.0f, 0.0f, 0.0f));
+  EXPECT_EQ(mesh_data.positions[2], float3(0.0f, 0.0f, 15.0f));
+}
+
+TEST(stl_import, ascii_skip_invalid_facet)
+{
+  const char *str =
+      "solid facet\n"
+      "facet normal 0 0 1\n"
+      "outer loop\n"
+      "vertex 0 0 0\n"
+      "vertex 1 0 0\n"
+      "endloop\n"
+      "endfacet\n"
+      "facet normal 0 0 -1\n"
+      "outer loop\n"
+      "vertex -0.25 0 0\n"
+      "vertex 0 -2.5 0\n"
+      "vertex 0 0 .5\n"
+      "endloop\n"
+      "endfacet\n"
+      "endsolid facet\n";
+
+  STLMeshData mesh_data;
+  EXPECT_TRUE(parse_string(str, mesh_data));
+  ASSERT_EQ(mesh_data.normals.size(), 1);
+  ASSERT_EQ(mesh_data.positions.size(), 3);
+  EXPECT_EQ(mesh_data.normals[0], float3(0.0f, 0.0f, -1.0f));
+  EXPECT_EQ(mesh_data.positions[0], float3(-0.25f, 0.0f, 0.0f));
+  EXPECT_EQ(mesh_data.positions[1], float3(0.0f, -2.5f, 0.0f));
+  EXPECT_EQ(mesh_data.positions[2], float3(0.0f, 0.0f, 0.5f));
+}
+
+TEST(stl_import, ascii_invalid)
+{
+  STLMeshData mesh_data;
+  EXPECT_FALSE(parse_string("", mesh_data));
+  EXPECT_FALSE(parse_string("not an stl file", mesh_data));
+  EXPECT_FALSE(parse_string("solid\nfacet normal 0 0 x\n", mesh_data));
+}
+
+TEST(stl_import, binary)
+{
+  const float facets[2][12] = {
+      {0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0},
+      {0, 0, -1, 0, 0, 0, 0, 1, 0, 1, 0, 0},
+  };
+  /* The header may start with "solid" too, which is why the size is checked first. */
+  Vector<char> data(84 + 2 * 50, 0);
+  memcpy(data.data(), "solid binary", 12);
+  const uint32_t tris_num = 2;
+  memcpy(data.data() + 80, &tris_num, sizeof(tris_num));
+  for (const int i : IndexRange(2)) {
+    memcpy(data.data() + 84 + i * 50, facets[i], sizeof(facets[i]));
+  }
+
+  STLMeshData mesh_data;
+  EXPECT_TRUE(stl_parse(data, mesh_data));
+  ASSERT_EQ(mesh_data.normals.size(), 2);
+  ASSERT_EQ(mesh_data.positions.size(), 6);
+  EXPECT_EQ(mesh_data.normals[1], float3(0.0f, 0.0f, -1.0f));
+  EXPECT_EQ(mesh_data.positions[2], float3(0.0f, 1.0f, 0.0f));
+  EXPECT_EQ(mesh_data.positions[5], float3(1.0f, 0.0f, 0.0f));
+}
+
+}  // namespace blender::io::stl::tests
@@ -111,6 +111,38 @@ struct USDMeshData {
   pxr::VtFloatArray crease_sharpnesses;
 };
 
+/* Defined here, where #USDMeshData is a complete type. */
+USDGenericMeshWriter::~USDGenericMeshWriter() = default;
+
+static void get_loops_polys(const Mesh *mesh, USDMeshData &usd_mesh_data);
+
+void USDGenericMeshWriter::capture(const HierarchyContext &context)
+{
+  captured_mesh_data_.reset();
+
+  /* Same condition as in #USDAbstractWriter::write(), after the first frame. */
+  if (frame_has_been_written_ && !is_animated_) {
+    return;
+  }
+  /* Instances only reference the geometry of the original. */
+  if (usd_export_context_.export_params.use_instancing && context.is_instance()) {
+    return;
+  }
+
+  bool needsfree = false;
+  Mesh *mesh = get_export_mesh(context.object, needsfree);
+  if (mesh == nullptr) {
+    return;
+  }
+
+  captured_mesh_data_ = std::make_unique<USDMeshData>();
+  get_geometry_data(mesh, *captured_mesh_data_);
+
+  if (needsfree) {
+    free_export_mesh(mesh);
+  }
+}
+
 void USDGenericMeshWriter::write_uv_maps(const Mesh *mesh, pxr::UsdGeomMesh usd_mesh)
 {
   pxr::UsdTimeCode timecode = get_export_time_code();
@@ -130,10 +162,11 @@ void USDGenericMeshWriter::write_uv_maps(const Mesh *mesh, pxr::UsdGeomMesh usd_
     pxr::UsdGeomPrimvar uv_coords_primvar = usd_mesh.CreatePrimvar(
         primvar_name, pxr::SdfValueTypeNames->TexCoord2fArray, pxr::UsdGeomTokens->faceVarying);
 
-    MLoopUV *mloopuv = static_cast<MLoopUV *>(layer->data);
-    pxr::VtArray<pxr::GfVec2f> uv_coords;
+    const MLoopUV *mloopuv = static_cast<const MLoopUV *>(layer->data);
+    pxr::VtArray<pxr::GfVec2f> uv_coords(mesh->totloop);
+    pxr::GfVec2f *uv_coords_data = uv_coords.data();
     for (int loop_idx = 0; loop_idx < mesh->totloop; loop_idx++) {
-      uv_coords.push_back(pxr::GfVec2f(mloopuv[loop_idx].uv));
+      uv_coords_data[loop_idx] = pxr::GfVec2f(mloopuv[loop_idx].uv);
     }
 
     if (!uv_coords_primvar.HasValue()) {
@@ -155,7 +188,6 @@ void USDGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
   write_visibility(context, timecode, usd_mesh);
 
   USDMeshData usd_mesh_data;
-  get_geometry_data(mesh, usd_mesh_data);
 
   if (usd_export_context_.export_params.use_instancing && context.is_instance()) {
     if (!mark_as_instance(context, usd_mesh.GetPrim())) {
@@ -167,12 +199,22 @@ void USDGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
      * out of its own sub-tree. It does work when we override the material with exactly the same
      * path, though.*/
     if (usd_export_context_.export_params.export_materials) {
+      /* Only the face groups are needed, the geometry itself is referenced. */
+      get_loops_polys(mesh, usd_mesh_data);
       assign_materials(context, usd_mesh, usd_mesh_data.face_groups);
     }
 
     return;
   }
 
+  if (captured_mesh_data_) {
+    usd_mesh_data = std::move(*captured_mesh_data_);
+    captured_mesh_data_.reset();
+  }
+  else {
+    get_geometry_data(mesh, usd_mesh_data);
+  }
+
   pxr::UsdAttribute attr_points = usd_mesh.CreatePointsAttr(pxr::VtValue(), true);
   pxr::UsdAttribute attr_face_vertex_counts = usd_mesh.CreateFaceVertexCountsAttr(pxr::VtValue(),
                                                                                   true);
@@ -235,11 +277,14 @@ void USDGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
 
 static void get_vertices(const Mesh *mesh, USDMeshData &usd_mesh_data)
 {
-  usd_mesh_data.points.reserve(mesh->totvert);
+  /* Write through the data pointer, every #pxr::VtArray::push_back() checks whether the array
+   * is shared and needs to be detached first. */
+  usd_mesh_data.points.resize(mesh->totvert);
+  pxr::GfVec3f *points = usd_mesh_data.points.data();
 
   const MVert *verts = mesh->mvert;
   for (int i = 0; i < mesh->totvert; ++i) {
-    usd_mesh_data.points.push_back(pxr::GfVec3f(verts[i].co));
+    points[i] = pxr::GfVec3f(verts[i].co);
   }
 }
 
@@ -249,16 +294,19 @@ static void get_loops_polys(const Mesh *mesh, USDMeshData &usd_mesh_data)
    * assignments. */
   bool construct_face_groups = mesh->totcol > 1;
 
-  usd_mesh_data.face_vertex_counts.reserve(mesh->totpoly);
-  usd_mesh_data.face_indices.reserve(mesh->totloop);
+  usd_mesh_data.face_vertex_counts.resize(mesh->totpoly);
+  usd_mesh_data.face_indices.resize(mesh->totloop);
+  int *face_vertex_counts = usd_mesh_data.face_vertex_counts.data();
+  int *face_indices = usd_mesh_data.face_indices.data();
 
-  MLoop *mloop = mesh->mloop;
-  MPoly *mpoly = mesh->mpoly;
+  const MLoop *mloop = mesh->mloop;
+  const MPoly *mpoly = mesh->mpoly;
+  int face_index_offset = 0;
   for (int i = 0; i < mesh->totpoly; ++i, ++mpoly) {
-    MLoop *loop = mloop + mpoly->loopstart;
-    usd_mesh_data.face_vertex_counts.push_back(mpoly->totloop);
+    const MLoop *loop = mloop + mpoly->loopstart;
+    face_vertex_counts[i] = mpoly->totloop;
     for (int j = 0; j < mpoly->totloop; ++j, ++loop) {
-      usd_mesh_data.face_indices.push_back(loop->v);
+      face_indices[face_index_offset++] = loop->v;
     }
 
     if (construct_face_groups) {
@@ -367,16 +415,18 @@ void USDGenericMeshWriter::write_normals(const Mesh *mesh, pxr::UsdGeomMesh usd_
   const float(*lnors)[3] = static_cast<float(*)[3]>(CustomData_get_layer(&mesh->ldata, CD_NORMAL));
 
   pxr::VtVec3fArray loop_normals;
-  loop_normals.reserve(mesh->totloop);
 
   if (lnors != nullptr) {
     /* Export custom loop normals. */
+    loop_normals.resize(mesh->totloop);
+    pxr::GfVec3f *loop_normals_data = loop_normals.data();
     for (int loop_idx = 0, totloop = mesh->totloop; loop_idx < totloop; ++loop_idx) {
-      loop_normals.push_back(pxr::GfVec3f(lnors[loop_idx]));
+      loop_normals_data[loop_idx] = pxr::GfVec3f(lnors[loop_idx]);
     }
   }
   else {
     /* Compute the loop normals based on the 'smooth' flag. */
+    loop_normals.reserve(mesh->totloop);
     float normal[3];
     MPoly *mpoly = mesh->mpoly;
     const MVert *mvert = mesh->mvert;
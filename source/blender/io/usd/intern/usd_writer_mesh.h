@@ -22,6 +22,8 @@
 
 #include <pxr/usd/usdGeom/mesh.h>
 
+#include <memory>
+
 namespace blender::io::usd {
 
 struct USDMeshData;
@@ -30,15 +32,23 @@ struct USDMeshData;
 class USDGenericMeshWriter : public USDAbstractWriter {
  public:
   USDGenericMeshWriter(const USDExporterContext &ctx);
+  ~USDGenericMeshWriter();
+
+  /* Convert the geometry to USD arrays, which is the bulk of the work of writing a mesh. */
+  virtual void capture(const HierarchyContext &context) override;
 
  protected:
   virtual bool is_supported(const HierarchyContext *context) const override;
   virtual void do_write(HierarchyContext &context) override;
 
+  /* Also called from capture(), so this has to be safe to call from multiple threads. */
   virtual Mesh *get_export_mesh(Object *object_eval, bool &r_needsfree) = 0;
   virtual void free_export_mesh(Mesh *mesh);
 
  private:
+  /* Geometry converted by capture(), used by the next write() instead of converting it again. */
+  std::unique_ptr<USDMeshData> captured_mesh_data_;
+
   /* Mapping from material slot number to array of face indices with that material. */
   typedef std::map<short, pxr::VtIntArray> MaterialFaceGroups;
 
@@ -53,6 +53,11 @@ typedef struct CustomDataLayer {
   char name[64];
   /** Layer data. */
   void *data;
+  /**
+   * Run-time only, reference counted ownership of `data` when it is shared with copies of this
+   * layer (e.g. the evaluated copies of a mesh), NULL when the layer owns its data alone.
+   */
+  struct CustomDataLayerSharing *sharing;
 } CustomDataLayer;
 
 #define MAX_CUSTOMDATA_LAYER_NAME 64
@@ -109,6 +109,12 @@ void *DNA_struct_reconstruct(const struct DNA_ReconstructInfo *reconstruct_info,
                              int old_struct_nr,
                              int blocks,
                              const void *old_blocks);
+void DNA_struct_reconstruct_blocks(const struct DNA_ReconstructInfo *reconstruct_info,
+                                   int old_struct_nr,
+                                   int new_struct_nr,
+                                   int blocks,
+                                   const void *old_blocks,
+                                   void *new_blocks);
 
 int DNA_elem_offset(struct SDNA *sdna, const char *stype, const char *vartype, const char *name);
 
@@ -417,6 +417,12 @@ typedef struct bNodeLink {
 #define NTREE_CHUNKSIZE_512 512
 #define NTREE_CHUNKSIZE_1024 1024
 
+/* tree->execution_mode */
+typedef enum eNodeTreeExecutionMode {
+  NTREE_EXECUTION_MODE_TILED = 0,
+  NTREE_EXECUTION_MODE_FULL_FRAME = 1,
+} eNodeTreeExecutionMode;
+
 /* the basis for a Node tree, all links and nodes reside internal here */
 /* only re-usable node trees are in the library though,
  * materials and textures allocate own tree struct */
@@ -454,7 +460,8 @@ typedef struct bNodeTree {
   short is_updating;
   /** Generic temporary flag for recursion check (DFS/BFS). */
   short done;
-  char _pad2[4];
+  /** Execution mode of the compositor engine, see #eNodeTreeExecutionMode. */
+  int execution_mode;
 
   /** Specific node type this tree is used for. */
   int nodetype DNA_DEPRECATED;
@@ -467,6 +474,11 @@ typedef struct bNodeTree {
   int chunksize;
 
   rctf viewer_border;
+  /**
+   * Part of the viewer image visible in the node editor backdrops, in pixels relative to the
+   * image center. Only this part of viewer nodes is calculated when editing, unless empty.
+   */
+  rctf viewer_visible_border;
 
   /* Lists of bNodeSocket to hold default values and own_index.
    * Warning! Don't make links to these sockets, input/output nodes are used for that.
@@ -526,6 +538,7 @@ typedef struct bNodeTree {
 
 /* tree is localized copy, free when deleting node groups */
 /* #define NTREE_IS_LOCALIZED           (1 << 5) */
+#define NTREE_COM_GPU (1 << 6) /* use gpu shaders (full-frame execution) */
 
 /* ntree->update */
 typedef enum eNodeTreeUpdate {
@@ -131,7 +131,9 @@ typedef struct Object_Runtime {
    * when the object is being instanced.
    */
   int select_id;
-  char _pad1[3];
+  /** Random value derived from the object name, updated on evaluation for drawing. */
+  unsigned int random_id;
+  char _pad1[7];
 
   /**
    * Denotes whether the evaluated data is owned by this object or is referenced and owned by
@@ -356,7 +356,7 @@ typedef struct ParticleSystem {
 
   /** Used for instancing. */
   float imat[4][4];
-  float cfra, tree_frame, bvhtree_frame;
+  float cfra, tree_frame, neighbor_grid_frame;
   int seed, child_seed;
   int flag, totpart, totunexist, totchild, totcached, totchildcache;
   /* NOTE: Recalc is one of ID_RECALC_PSYS_ALL flags.
@@ -386,8 +386,8 @@ typedef struct ParticleSystem {
 
   /** Used for interactions with self and other systems. */
   struct KDTree_3d *tree;
-  /** Used for interactions with self and other systems. */
-  struct BVHTree *bvhtree;
+  /** Used for SPH interactions with self and other systems. */
+  struct ParticleNeighborGrid *neighbor_grid;
 
   struct ParticleDrawData *pdd;
 
@@ -27,6 +27,11 @@
 extern "C" {
 #endif
 
+typedef struct PointCloud_Runtime {
+  /** Cache of BVH trees built from the point positions, see #BKE_bvhtree_from_pointcloud_get. */
+  struct BVHCache *bvh_cache;
+} PointCloud_Runtime;
+
 typedef struct PointCloud {
   ID id;
   struct AnimData *adt; /* animation data (must be immediately after id) */
@@ -52,6 +57,8 @@ typedef struct PointCloud {
 
   /* Draw Cache */
   void *batch_cache;
+
+  PointCloud_Runtime runtime;
 } PointCloud;
 
 /* PointCloud.flag */
@@ -434,6 +434,11 @@ typedef struct ARegion_Runtime {
 
   /* The offset needed to not overlap with window scrollbars. Only used by HUD regions for now. */
   int offset_x, offset_y;
+
+  /* View and size the panel blocks were last laid out with, to reuse them for redraws that don't
+   * need a rebuild (see #ED_region_tag_redraw_no_rebuild()). */
+  rctf panels_layout_cur;
+  int panels_layout_winx, panels_layout_winy;
 } ARegion_Runtime;
 
 typedef struct ARegion {
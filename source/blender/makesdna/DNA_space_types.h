@@ -597,6 +597,9 @@ typedef struct SpaceSeq {
   /** Grease-pencil data. */
   struct bGPdata *gpd;
 
+  /** Runtime: texture of the preview image, reused while its size and format don't change. */
+  struct GPUTexture *display_texture;
+
   /** Different scoped displayed in space. */
   struct SequencerScopes scopes;
 
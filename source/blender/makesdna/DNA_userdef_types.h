@@ -792,7 +792,8 @@ typedef struct UserDef {
   int prefetchframes;
   /** Control the rotation step of the view when PAD2, PAD4, PAD6&PAD8 is use. */
   float pad_rot_angle;
-  char _pad12[4];
+  /** Memory limit of the compositor buffers in megabytes, 0 for no limit. */
+  int compositor_memory_limit;
   /** Rotating view icon size. */
   short rvisize;
   /** Rotating view icon brightness. */
@@ -906,7 +907,8 @@ typedef struct UserDef {
   short pie_menu_threshold;
 
   short opensubdiv_compute_type;
-  short _pad6;
+  /** Number of movie strips whose proxies are built at the same time, 0 for automatic. */
+  short sequencer_proxy_build_threads;
 
   char factor_display_type;
 
@@ -919,7 +921,8 @@ typedef struct UserDef {
   int sequencer_disk_cache_compression; /* eUserpref_DiskCacheCompression */
   int sequencer_disk_cache_size_limit;
   short sequencer_disk_cache_flag;
-  char _pad5[2];
+  char movie_decode_flag; /* eUserpref_MovieDecodeFlag */
+  char _pad5[1];
 
   float collection_instance_empty_size;
   char _pad10[3];
@@ -1113,6 +1116,7 @@ typedef enum eUserpref_GPU_Flag {
   USER_GPU_FLAG_NO_DEPT_PICK = (1 << 0),
   USER_GPU_FLAG_NO_EDIT_MODE_SMOOTH_WIRE = (1 << 1),
   USER_GPU_FLAG_OVERLAY_SMOOTH_WIRE = (1 << 2),
+  USER_GPU_FLAG_SHADER_CACHE = (1 << 3),
 } eUserpref_GPU_Flag;
 
 /** #UserDef.tablet_api */
@@ -1384,6 +1388,11 @@ typedef enum eUserpref_DiskCacheCompression {
   USER_SEQ_DISK_CACHE_COMPRESSION_HIGH = 2,
 } eUserpref_DiskCacheCompression;
 
+/** #UserDef.movie_decode_flag */
+typedef enum eUserpref_MovieDecodeFlag {
+  USER_MOVIE_DECODE_HARDWARE = (1 << 0),
+} eUserpref_MovieDecodeFlag;
+
 /* Locale Ids. Auto will try to get local from OS. Our default is English though. */
 /** #UserDef.language */
 enum {
@@ -1253,6 +1253,25 @@ void *DNA_struct_reconstruct(const DNA_ReconstructInfo *reconstruct_info,
   return new_blocks;
 }
 
+/**
+ * Same as #DNA_struct_reconstruct, but writes into memory allocated by the caller.
+ * This doesn't access any shared state, so callers may reconstruct separate ranges
+ * of a large array from multiple threads.
+ *
+ * \param new_struct_nr: Index of the matching struct info within newsdna.
+ * \param new_blocks: Zero initialized memory for \a blocks elements of the new struct.
+ */
+void DNA_struct_reconstruct_blocks(const DNA_ReconstructInfo *reconstruct_info,
+                                   int old_struct_nr,
+                                   int new_struct_nr,
+                                   int blocks,
+                                   const void *old_blocks,
+                                   void *new_blocks)
+{
+  reconstruct_structs(
+      reconstruct_info, blocks, old_struct_nr, new_struct_nr, old_blocks, new_blocks);
+}
+
 /** Finds a member in the given struct with the given name. */
 static const SDNA_StructMember *find_member_with_matching_name(const SDNA *sdna,
                                                                const SDNA_Struct *struct_info,
@@ -966,6 +966,10 @@ void RNA_property_update_main(struct Main *bmain,
                               struct Scene *scene,
                               PointerRNA *ptr,
                               PropertyRNA *prop);
+void RNA_property_update_batch(struct bContext *C,
+                               PointerRNA *ptrs,
+                               int ptrs_len,
+                               PropertyRNA *prop);
 bool RNA_property_update_check(struct PropertyRNA *prop);
 
 /* Property Data */
@@ -577,6 +577,13 @@ typedef enum FunctionFlag {
   FUNC_USE_CONTEXT = (1 << 3),
   FUNC_USE_REPORTS = (1 << 4),
 
+  /**
+   * Python releases the global interpreter lock while calling the function,
+   * so other Python threads can run meanwhile. Only for long running functions that don't
+   * use the Python API (Python callbacks they run, such as drivers, acquire the lock themselves).
+   */
+  FUNC_ALLOW_THREADS = (1 << 13),
+
   /***** Registering of Python subclasses. *****/
   /**
    * This function is part of the registerable class' interface,
@@ -2224,8 +2224,12 @@ bool RNA_property_path_from_ID_check(PointerRNA *ptr, PropertyRNA *prop)
   return ret;
 }
 
-static void rna_property_update(
-    bContext *C, Main *bmain, Scene *scene, PointerRNA *ptr, PropertyRNA *prop)
+/**
+ * \param is_batch: Skip the notifiers and relation updates,
+ * the caller adds them once for all updated pointers, see #RNA_property_update_batch.
+ */
+static void rna_property_update_ex(
+    bContext *C, Main *bmain, Scene *scene, PointerRNA *ptr, PropertyRNA *prop, bool is_batch)
 {
   const bool is_rna = (prop->magic == RNA_MAGIC);
   prop = rna_ensure_property(prop);
@@ -2252,7 +2256,7 @@ static void rna_property_update(
 #if 1
     /* TODO(campbell): Should eventually be replaced entirely by message bus (below)
      * for now keep since COW, bugs are hard to track when we have other missing updates. */
-    if (prop->noteflag) {
+    if (prop->noteflag && !is_batch) {
       WM_main_add_notifier(prop->noteflag, ptr->owner_id);
     }
 #endif
@@ -2290,6 +2294,10 @@ static void rna_property_update(
     DEG_id_tag_update(ptr->owner_id,
                       ID_RECALC_TRANSFORM | ID_RECALC_GEOMETRY | ID_RECALC_PARAMETERS);
 
+    if (is_batch) {
+      return;
+    }
+
     /* When updating an ID pointer property, tag depsgraph for update. */
     if (prop->type == PROP_POINTER && RNA_struct_is_ID(RNA_property_pointer_type(ptr, prop))) {
       DEG_relations_tag_update(bmain);
@@ -2306,6 +2314,12 @@ static void rna_property_update(
   }
 }
 
+static void rna_property_update(
+    bContext *C, Main *bmain, Scene *scene, PointerRNA *ptr, PropertyRNA *prop)
+{
+  rna_property_update_ex(C, bmain, scene, ptr, prop, false);
+}
+
 /* must keep in sync with 'rna_property_update'
  * note, its possible this returns a false positive in the case of PROP_CONTEXT_UPDATE
  * but this isn't likely to be a performance problem. */
@@ -2324,6 +2338,52 @@ void RNA_property_update_main(Main *bmain, Scene *scene, PointerRNA *ptr, Proper
   rna_property_update(NULL, bmain, scene, ptr, prop);
 }
 
+/**
+ * Update \a prop after it has been set on all \a ptrs.
+ *
+ * Update callbacks, message bus and depsgraph tags run per pointer,
+ * notifiers and relation updates are only added once for the whole batch
+ * (adding a notifier per owner is quadratic with the size of the notifier queue).
+ * The pointers are expected to be of the same type, sharing \a prop.
+ */
+void RNA_property_update_batch(bContext *C, PointerRNA *ptrs, int ptrs_len, PropertyRNA *prop)
+{
+  if (ptrs_len == 0) {
+    return;
+  }
+
+  Main *bmain = CTX_data_main(C);
+  Scene *scene = CTX_data_scene(C);
+  const bool is_rna = (prop->magic == RNA_MAGIC);
+  ID *owner_id = ptrs[0].owner_id;
+
+  for (int i = 0; i < ptrs_len; i++) {
+    rna_property_update_ex(C, bmain, scene, &ptrs[i], prop, true);
+    if (ptrs[i].owner_id != owner_id) {
+      owner_id = NULL;
+    }
+  }
+
+  PropertyRNA *prop_rna = rna_ensure_property(prop);
+  if (is_rna && prop_rna->noteflag) {
+    /* A NULL reference when the owners differ is handled by listeners as 'any data'. */
+    WM_main_add_notifier(prop_rna->noteflag, owner_id);
+  }
+
+  if (!is_rna || (prop_rna->flag & PROP_IDPROPERTY)) {
+    if (prop_rna->type == PROP_POINTER &&
+        RNA_struct_is_ID(RNA_property_pointer_type(&ptrs[0], prop_rna))) {
+      DEG_relations_tag_update(bmain);
+    }
+
+    WM_main_add_notifier(NC_WINDOW, NULL);
+    if ((prop_rna->flag & PROP_IDPROPERTY) != 0 && (ptrs[0].owner_id != NULL) &&
+        (GS(ptrs[0].owner_id->name) == ID_NT)) {
+      WM_main_add_notifier(NC_MATERIAL | ND_SHADING, NULL);
+    }
+  }
+}
+
 /* ---------------------------------------------------------------------- */
 
 /* Property Data */
@@ -4541,6 +4601,17 @@ static int rna_raw_access(ReportList *reports,
 
         size = RNA_raw_type_sizeof(out.type) * arraylen;
 
+        /* Tightly packed items (a plain array of the property type), copy in one go. */
+        if (out.stride == size) {
+          if (set) {
+            memcpy(outp, inp, (size_t)size * out.len);
+          }
+          else {
+            memcpy(inp, outp, (size_t)size * out.len);
+          }
+          return 1;
+        }
+
         for (a = 0; a < out.len; a++) {
           if (set) {
             memcpy(outp, inp, size);
@@ -4556,8 +4627,29 @@ static int rna_raw_access(ReportList *reports,
         return 1;
       }
 
-      /* could also be faster with non-matching types,
-       * for now we just do slower loop .. */
+      /* Non-matching raw types, convert directly from/to the raw array
+       * instead of going through the property accessors for every item. */
+      if (out.type != PROP_RAW_UNSET && in.type != PROP_RAW_UNSET) {
+        RawArray item = out;
+        int a, j;
+        double value;
+
+        for (a = 0; a < out.len; a++) {
+          item.array = (char *)out.array + (size_t)a * out.stride;
+          for (j = 0; j < arraylen; j++) {
+            if (set) {
+              RAW_GET(double, value, in, a * arraylen + j);
+              RAW_SET(double, item, j, value);
+            }
+            else {
+              RAW_GET(double, value, item, j);
+              RAW_SET(double, in, a * arraylen + j, value);
+            }
+          }
+        }
+
+        return 1;
+      }
     }
   }
 
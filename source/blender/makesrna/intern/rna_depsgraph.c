@@ -252,6 +252,31 @@ static void rna_Depsgraph_debug_stats_gnuplot(Depsgraph *depsgraph,
   fclose(f);
 }
 
+static void rna_Depsgraph_debug_profile_start(Depsgraph *depsgraph)
+{
+  DEG_debug_eval_profile_start(depsgraph);
+}
+
+static void rna_Depsgraph_debug_profile_stop(Depsgraph *depsgraph)
+{
+  DEG_debug_eval_profile_stop(depsgraph);
+}
+
+static void rna_Depsgraph_debug_profile_write(Depsgraph *depsgraph,
+                                              ReportList *reports,
+                                              const char *filename)
+{
+  FILE *f = fopen(filename, "w");
+  if (f == NULL) {
+    BKE_reportf(reports, RPT_ERROR, "Cannot open file '%s' for writing", filename);
+    return;
+  }
+  if (!DEG_debug_eval_profile_write_trace(depsgraph, f)) {
+    BKE_report(reports, RPT_ERROR, "Profiling was not started");
+  }
+  fclose(f);
+}
+
 static void rna_Depsgraph_debug_tag_update(Depsgraph *depsgraph)
 {
   DEG_graph_tag_relations_update(depsgraph);
@@ -666,6 +691,21 @@ static void rna_def_depsgraph(BlenderRNA *brna)
                                   "File name where gnuplot script will save the result");
   RNA_def_parameter_flags(parm, 0, PARM_REQUIRED);
 
+  func = RNA_def_function(srna, "debug_profile_start", "rna_Depsgraph_debug_profile_start");
+  RNA_def_function_ui_description(
+      func, "Start recording timing of every evaluated operation, for all following updates");
+
+  func = RNA_def_function(srna, "debug_profile_stop", "rna_Depsgraph_debug_profile_stop");
+  RNA_def_function_ui_description(func, "Stop recording and discard the recorded timing");
+
+  func = RNA_def_function(srna, "debug_profile_write", "rna_Depsgraph_debug_profile_write");
+  RNA_def_function_ui_description(
+      func, "Write the recorded timing as a Chrome/Perfetto trace (JSON) file");
+  RNA_def_function_flag(func, FUNC_USE_REPORTS);
+  parm = RNA_def_string_file_path(
+      func, "filename", NULL, FILE_MAX, "File Name", "Output path for the trace file");
+  RNA_def_parameter_flags(parm, 0, PARM_REQUIRED);
+
   func = RNA_def_function(srna, "debug_tag_update", "rna_Depsgraph_debug_tag_update");
 
   func = RNA_def_function(srna, "debug_stats", "rna_Depsgraph_debug_stats");
@@ -281,14 +281,15 @@ void RNA_api_image(StructRNA *srna)
   func = RNA_def_function(srna, "save_render", "rna_Image_save_render");
   RNA_def_function_ui_description(func,
                                   "Save image to a specific path using a scenes render settings");
-  RNA_def_function_flag(func, FUNC_USE_CONTEXT | FUNC_USE_REPORTS);
+  RNA_def_function_flag(func, FUNC_USE_CONTEXT | FUNC_USE_REPORTS | FUNC_ALLOW_THREADS);
   parm = RNA_def_string_file_path(func, "filepath", NULL, 0, "", "Save path");
   RNA_def_parameter_flags(parm, 0, PARM_REQUIRED);
   RNA_def_pointer(func, "scene", "Scene", "", "Scene to take image parameters from");
 
   func = RNA_def_function(srna, "save", "rna_Image_save");
   RNA_def_function_ui_description(func, "Save image to its source path");
-  RNA_def_function_flag(func, FUNC_USE_MAIN | FUNC_USE_CONTEXT | FUNC_USE_REPORTS);
+  RNA_def_function_flag(
+      func, FUNC_USE_MAIN | FUNC_USE_CONTEXT | FUNC_USE_REPORTS | FUNC_ALLOW_THREADS);
 
   func = RNA_def_function(srna, "pack", "rna_Image_pack");
   RNA_def_function_ui_description(func, "Pack an image as embedded data into the .blend file");
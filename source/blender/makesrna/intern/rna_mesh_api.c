@@ -240,6 +240,7 @@ void RNA_api_mesh(StructRNA *srna)
   RNA_def_function_ui_description(func, "Empty split vertex normals");
 
   func = RNA_def_function(srna, "calc_normals_split", "BKE_mesh_calc_normals_split");
+  RNA_def_function_flag(func, FUNC_ALLOW_THREADS);
   RNA_def_function_ui_description(func,
                                   "Calculate split vertex normals, which preserve sharp edges");
 
@@ -252,7 +253,7 @@ void RNA_api_mesh(StructRNA *srna)
       func, "free_loop_normals", 1, "Free Loop Notmals", "Free loop normals custom data layer");
 
   func = RNA_def_function(srna, "calc_tangents", "rna_Mesh_calc_tangents");
-  RNA_def_function_flag(func, FUNC_USE_REPORTS);
+  RNA_def_function_flag(func, FUNC_USE_REPORTS | FUNC_ALLOW_THREADS);
   RNA_def_function_ui_description(
       func,
       "Compute tangents and bitangent signs, to be used together with the split normals "
@@ -269,6 +270,7 @@ void RNA_api_mesh(StructRNA *srna)
   RNA_def_function_ui_description(func, "Free tangents");
 
   func = RNA_def_function(srna, "calc_loop_triangles", "rna_Mesh_calc_looptri");
+  RNA_def_function_flag(func, FUNC_ALLOW_THREADS);
   RNA_def_function_ui_description(func,
                                   "Calculate loop triangle tessellation (supports editmode too)");
 
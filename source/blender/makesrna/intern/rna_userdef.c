@@ -193,6 +193,8 @@ static const EnumPropertyItem rna_enum_userdef_viewport_aa_items[] = {
 #  include "GPU_select.h"
 #  include "GPU_texture.h"
 
+#  include "IMB_imbuf.h"
+
 #  include "BLF_api.h"
 
 #  include "BLI_path_util.h"
@@ -427,6 +429,14 @@ static void rna_userdef_anim_update(Main *UNUSED(bmain),
   USERDEF_TAG_DIRTY;
 }
 
+static void rna_userdef_gpu_shader_cache_update(Main *UNUSED(bmain),
+                                                Scene *UNUSED(scene),
+                                                PointerRNA *UNUSED(ptr))
+{
+  WM_init_gpu_shader_cache();
+  USERDEF_TAG_DIRTY;
+}
+
 static void rna_userdef_tablet_api_update(Main *UNUSED(bmain),
                                           Scene *UNUSED(scene),
                                           PointerRNA *UNUSED(ptr))
@@ -573,6 +583,14 @@ static void rna_Userdef_memcache_update(Main *UNUSED(bmain),
   USERDEF_TAG_DIRTY;
 }
 
+static void rna_Userdef_movie_decode_update(Main *UNUSED(bmain),
+                                            Scene *UNUSED(scene),
+                                            PointerRNA *UNUSED(ptr))
+{
+  IMB_anim_set_hardware_decode(U.movie_decode_flag & USER_MOVIE_DECODE_HARDWARE);
+  USERDEF_TAG_DIRTY;
+}
+
 static void rna_Userdef_disk_cache_dir_update(Main *UNUSED(bmain),
                                               Scene *UNUSED(scene),
                                               PointerRNA *UNUSED(ptr))
@@ -5391,6 +5409,13 @@ static void rna_def_userdef_system(BlenderRNA *brna)
   RNA_def_property_ui_text(prop, "Memory Cache Limit", "Memory cache limit (in megabytes)");
   RNA_def_property_update(prop, 0, "rna_Userdef_memcache_update");
 
+  prop = RNA_def_property(srna, "compositor_memory_limit", PROP_INT, PROP_NONE);
+  RNA_def_property_int_sdna(prop, NULL, "compositor_memory_limit");
+  RNA_def_property_range(prop, 0, max_memory_in_megabytes_int());
+  RNA_def_property_ui_text(prop,
+                           "Compositor Memory Limit",
+                           "Memory limit of the compositor buffers (in megabytes), 0 for no limit");
+
   /* Sequencer disk cache */
 
   prop = RNA_def_property(srna, "use_sequencer_disk_cache", PROP_BOOLEAN, PROP_NONE);
@@ -5416,6 +5441,22 @@ static void rna_def_userdef_system(BlenderRNA *brna)
       "Disk Cache Compression Level",
       "Smaller compression will result in larger files, but less decoding overhead");
 
+  prop = RNA_def_property(srna, "sequencer_proxy_build_threads", PROP_INT, PROP_NONE);
+  RNA_def_property_int_sdna(prop, NULL, "sequencer_proxy_build_threads");
+  RNA_def_property_range(prop, 0, 64);
+  RNA_def_property_ui_text(
+      prop,
+      "Proxy Build Threads",
+      "Number of movie strips whose proxies are built at the same time, 0 for automatic");
+
+  prop = RNA_def_property(srna, "use_movie_hardware_decode", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, NULL, "movie_decode_flag", USER_MOVIE_DECODE_HARDWARE);
+  RNA_def_property_ui_text(prop,
+                           "Hardware Movie Decoding",
+                           "Decode movies on the GPU when the platform supports it "
+                           "(only affects movies opened afterwards)");
+  RNA_def_property_update(prop, 0, "rna_Userdef_movie_decode_update");
+
   prop = RNA_def_property(srna, "scrollback", PROP_INT, PROP_UNSIGNED);
   RNA_def_property_int_sdna(prop, NULL, "scrollback");
   RNA_def_property_range(prop, 32, 32768);
@@ -5439,6 +5480,15 @@ static void rna_def_userdef_system(BlenderRNA *brna)
                            "Enable Edit-Mode edge smoothing, reducing aliasing, requires restart");
   RNA_def_property_update(prop, 0, "rna_userdef_dpi_update");
 
+  prop = RNA_def_property(srna, "use_gpu_shader_cache", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, NULL, "gpu_flag", USER_GPU_FLAG_SHADER_CACHE);
+  RNA_def_property_ui_text(prop,
+                           "Shader Cache",
+                           "Store compiled material shaders on disk, so they don't have to be "
+                           "compiled again when reopening a file (only affects shaders compiled "
+                           "afterwards)");
+  RNA_def_property_update(prop, 0, "rna_userdef_gpu_shader_cache_update");
+
   prop = RNA_def_property(srna, "use_region_overlap", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_boolean_sdna(prop, NULL, "uiflag2", USER_REGION_OVERLAP);
   RNA_def_property_ui_text(
@@ -28,6 +28,7 @@
 #include "BLI_utildefines.h"
 
 #include "BLI_math.h"
+#include "BLI_task.h"
 
 #include "BLT_translation.h"
 
@@ -354,16 +355,78 @@ static void mesh_merge_transform(Mesh *result,
   }
 }
 
+typedef struct ArrayCopyData {
+  const Mesh *mesh;
+  Mesh *result;
+  /* Cumulative offset of every copy. */
+  const float (*copy_offsets)[4][4];
+  bool use_recalc_normals;
+} ArrayCopyData;
+
+/* Copies are written to preallocated ranges of the result, so they can be created in parallel.
+ * Merging is done afterwards since it depends on the previous copies. */
+static void array_copy_task_cb(void *__restrict userdata,
+                               const int c,
+                               const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const ArrayCopyData *data = userdata;
+  const Mesh *mesh = data->mesh;
+  Mesh *result = data->result;
+  const int chunk_nverts = mesh->totvert;
+  const int chunk_nedges = mesh->totedge;
+  const int chunk_nloops = mesh->totloop;
+  const int chunk_npolys = mesh->totpoly;
+  const float(*current_offset)[4] = data->copy_offsets[c];
+  int i;
+
+  /* copy customdata to new geometry */
+  CustomData_copy_data(&mesh->vdata, &result->vdata, 0, c * chunk_nverts, chunk_nverts);
+  CustomData_copy_data(&mesh->edata, &result->edata, 0, c * chunk_nedges, chunk_nedges);
+  CustomData_copy_data(&mesh->ldata, &result->ldata, 0, c * chunk_nloops, chunk_nloops);
+  CustomData_copy_data(&mesh->pdata, &result->pdata, 0, c * chunk_npolys, chunk_npolys);
+
+  /* apply offset to all new verts */
+  MVert *mv = result->mvert + c * chunk_nverts;
+  for (i = 0; i < chunk_nverts; i++, mv++) {
+    mul_m4_v3(current_offset, mv->co);
+
+    /* We have to correct normals too, if we do not tag them as dirty! */
+    if (!data->use_recalc_normals) {
+      float no[3];
+      normal_short_to_float_v3(no, mv->no);
+      mul_mat3_m4_v3(current_offset, no);
+      normalize_v3(no);
+      normal_float_to_short_v3(mv->no, no);
+    }
+  }
+
+  /* adjust edge vertex indices */
+  MEdge *me = result->medge + c * chunk_nedges;
+  for (i = 0; i < chunk_nedges; i++, me++) {
+    me->v1 += c * chunk_nverts;
+    me->v2 += c * chunk_nverts;
+  }
+
+  MPoly *mp = result->mpoly + c * chunk_npolys;
+  for (i = 0; i < chunk_npolys; i++, mp++) {
+    mp->loopstart += c * chunk_nloops;
+  }
+
+  /* adjust loop vertex and edge indices */
+  MLoop *ml = result->mloop + c * chunk_nloops;
+  for (i = 0; i < chunk_nloops; i++, ml++) {
+    ml->v += c * chunk_nverts;
+    ml->e += c * chunk_nedges;
+  }
+}
+
 static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
                                    const ModifierEvalContext *ctx,
                                    Mesh *mesh)
 {
   const MVert *src_mvert;
-  MVert *mv, *mv_prev, *result_dm_verts;
+  MVert *result_dm_verts;
 
-  MEdge *me;
-  MLoop *ml;
-  MPoly *mp;
   int i, j, c, count;
   float length = amd->length;
   /* offset matrix */
@@ -570,90 +633,62 @@ static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
   first_chunk_start = 0;
   first_chunk_nverts = chunk_nverts;
 
-  unit_m4(current_offset);
+  /* recalculate cumulative offset here */
+  float(*copy_offsets)[4][4] = MEM_malloc_arrayN(count, sizeof(*copy_offsets), __func__);
+  unit_m4(copy_offsets[0]);
   for (c = 1; c < count; c++) {
-    /* copy customdata to new geometry */
-    CustomData_copy_data(&mesh->vdata, &result->vdata, 0, c * chunk_nverts, chunk_nverts);
-    CustomData_copy_data(&mesh->edata, &result->edata, 0, c * chunk_nedges, chunk_nedges);
-    CustomData_copy_data(&mesh->ldata, &result->ldata, 0, c * chunk_nloops, chunk_nloops);
-    CustomData_copy_data(&mesh->pdata, &result->pdata, 0, c * chunk_npolys, chunk_npolys);
-
-    mv_prev = result_dm_verts;
-    mv = mv_prev + c * chunk_nverts;
-
-    /* recalculate cumulative offset here */
-    mul_m4_m4m4(current_offset, current_offset, offset);
-
-    /* apply offset to all new verts */
-    for (i = 0; i < chunk_nverts; i++, mv++, mv_prev++) {
-      mul_m4_v3(current_offset, mv->co);
-
-      /* We have to correct normals too, if we do not tag them as dirty! */
-      if (!use_recalc_normals) {
-        float no[3];
-        normal_short_to_float_v3(no, mv->no);
-        mul_mat3_m4_v3(current_offset, no);
-        normalize_v3(no);
-        normal_float_to_short_v3(mv->no, no);
-      }
-    }
-
-    /* adjust edge vertex indices */
-    me = result->medge + c * chunk_nedges;
-    for (i = 0; i < chunk_nedges; i++, me++) {
-      me->v1 += c * chunk_nverts;
-      me->v2 += c * chunk_nverts;
-    }
-
-    mp = result->mpoly + c * chunk_npolys;
-    for (i = 0; i < chunk_npolys; i++, mp++) {
-      mp->loopstart += c * chunk_nloops;
-    }
-
-    /* adjust loop vertex and edge indices */
-    ml = result->mloop + c * chunk_nloops;
-    for (i = 0; i < chunk_nloops; i++, ml++) {
-      ml->v += c * chunk_nverts;
-      ml->e += c * chunk_nedges;
-    }
-
-    /* Handle merge between chunk n and n-1 */
-    if (use_merge && (c >= 1)) {
-      if (!offset_has_scale && (c >= 2)) {
-        /* Mapping chunk 3 to chunk 2 is a translation of mapping 2 to 1
-         * ... that is except if scaling makes the distance grow */
-        int k;
-        int this_chunk_index = c * chunk_nverts;
-        int prev_chunk_index = (c - 1) * chunk_nverts;
-        for (k = 0; k < chunk_nverts; k++, this_chunk_index++, prev_chunk_index++) {
-          int target = full_doubles_map[prev_chunk_index];
-          if (target != -1) {
-            target += chunk_nverts; /* translate mapping */
-            while (target != -1 && !ELEM(full_doubles_map[target], -1, target)) {
-              /* If target is already mapped, we only follow that mapping if final target remains
-               * close enough from current vert (otherwise no mapping at all). */
-              if (compare_len_v3v3(result_dm_verts[this_chunk_index].co,
-                                   result_dm_verts[full_doubles_map[target]].co,
-                                   amd->merge_dist)) {
-                target = full_doubles_map[target];
-              }
-              else {
-                target = -1;
-              }
+    mul_m4_m4m4(copy_offsets[c], copy_offsets[c - 1], offset);
+  }
+  copy_m4_m4(current_offset, copy_offsets[count - 1]);
+
+  ArrayCopyData copy_data = {
+      .mesh = mesh,
+      .result = result,
+      .copy_offsets = (const float(*)[4][4])copy_offsets,
+      .use_recalc_normals = use_recalc_normals,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (count - 1) * (chunk_nverts + chunk_nloops) > 10000;
+  BLI_task_parallel_range(1, count, &copy_data, array_copy_task_cb, &settings);
+  MEM_freeN(copy_offsets);
+
+  /* Handle merge between chunk n and n-1 */
+  for (c = 1; c < count && use_merge; c++) {
+    if (!offset_has_scale && (c >= 2)) {
+      /* Mapping chunk 3 to chunk 2 is a translation of mapping 2 to 1
+       * ... that is except if scaling makes the distance grow */
+      int k;
+      int this_chunk_index = c * chunk_nverts;
+      int prev_chunk_index = (c - 1) * chunk_nverts;
+      for (k = 0; k < chunk_nverts; k++, this_chunk_index++, prev_chunk_index++) {
+        int target = full_doubles_map[prev_chunk_index];
+        if (target != -1) {
+          target += chunk_nverts; /* translate mapping */
+          while (target != -1 && !ELEM(full_doubles_map[target], -1, target)) {
+            /* If target is already mapped, we only follow that mapping if final target remains
+             * close enough from current vert (otherwise no mapping at all). */
+            if (compare_len_v3v3(result_dm_verts[this_chunk_index].co,
+                                 result_dm_verts[full_doubles_map[target]].co,
+                                 amd->merge_dist)) {
+              target = full_doubles_map[target];
+            }
+            else {
+              target = -1;
             }
           }
-          full_doubles_map[this_chunk_index] = target;
         }
+        full_doubles_map[this_chunk_index] = target;
       }
-      else {
-        dm_mvert_map_doubles(full_doubles_map,
-                             result_dm_verts,
-                             (c - 1) * chunk_nverts,
-                             chunk_nverts,
-                             c * chunk_nverts,
-                             chunk_nverts,
-                             amd->merge_dist);
-      }
+    }
+    else {
+      dm_mvert_map_doubles(full_doubles_map,
+                           result_dm_verts,
+                           (c - 1) * chunk_nverts,
+                           chunk_nverts,
+                           c * chunk_nverts,
+                           chunk_nverts,
+                           amd->merge_dist);
     }
   }
 
@@ -26,6 +26,7 @@
 #include "BLI_utildefines.h"
 
 #include "BLI_math.h"
+#include "BLI_task.h"
 
 #include "BLT_translation.h"
 
@@ -43,6 +44,7 @@
 #include "BKE_editmesh.h"
 #include "BKE_lib_id.h"
 #include "BKE_mesh.h"
+#include "BKE_mesh_mapping.h"
 #include "BKE_mesh_wrapper.h"
 #include "BKE_screen.h"
 
@@ -182,6 +184,50 @@ static void mesh_get_boundaries(Mesh *mesh, float *smooth_weights)
  *
  * (average of surrounding verts)
  */
+typedef struct SmoothingTaskData {
+  const MeshElemMap *vert_edges;
+  const MEdge *edges;
+  float (*vertexCos)[3];
+  float (*deltas)[3];
+
+  /* Simple smoothing, 'lambda' and the smoothing weights divided by the number of edges. */
+  const float *vertex_edge_count_div;
+
+  /* Edge-length weighted smoothing. */
+  float *edge_length_sums;
+  const float *smooth_weights;
+  float lambda;
+} SmoothingTaskData;
+
+/* Smoothing gathers the offsets to the neighbors of each vertex, so vertices are independent of
+ * each other and can be processed in parallel. The deltas of all vertices are calculated before
+ * they are applied, to keep the result independent of the vertex order. */
+
+static void smooth_simple_delta_task_cb(void *__restrict userdata,
+                                        const int i,
+                                        const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SmoothingTaskData *data = userdata;
+  const MeshElemMap *vert_edges = &data->vert_edges[i];
+  float *delta = data->deltas[i];
+
+  zero_v3(delta);
+  for (int j = 0; j < vert_edges->count; j++) {
+    const int v_other = BKE_mesh_edge_other_vert(&data->edges[vert_edges->indices[j]], i);
+    float edge_dir[3];
+    sub_v3_v3v3(edge_dir, data->vertexCos[v_other], data->vertexCos[i]);
+    add_v3_v3(delta, edge_dir);
+  }
+}
+
+static void smooth_simple_apply_task_cb(void *__restrict userdata,
+                                        const int i,
+                                        const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SmoothingTaskData *data = userdata;
+  madd_v3_v3fl(data->vertexCos[i], data->deltas[i], data->vertex_edge_count_div[i]);
+}
+
 static void smooth_iter__simple(CorrectiveSmoothModifierData *csmd,
                                 Mesh *mesh,
                                 float (*vertexCos)[3],
@@ -192,72 +238,99 @@ static void smooth_iter__simple(CorrectiveSmoothModifierData *csmd,
   const float lambda = csmd->lambda;
   uint i;
 
-  const uint numEdges = (uint)mesh->totedge;
-  const MEdge *edges = mesh->medge;
+  MeshElemMap *vert_edges;
+  int *vert_edges_mem;
   float *vertex_edge_count_div;
 
-  struct SmoothingData_Simple {
-    float delta[3];
-  } *smooth_data = MEM_calloc_arrayN(numVerts, sizeof(*smooth_data), __func__);
+  BKE_mesh_vert_edge_map_create(
+      &vert_edges, &vert_edges_mem, mesh->medge, (int)numVerts, mesh->totedge);
 
-  vertex_edge_count_div = MEM_calloc_arrayN(numVerts, sizeof(float), __func__);
+  float(*deltas)[3] = MEM_malloc_arrayN(numVerts, sizeof(*deltas), __func__);
 
-  /* calculate as floats to avoid int->float conversion in #smooth_iter */
-  for (i = 0; i < numEdges; i++) {
-    vertex_edge_count_div[edges[i].v1] += 1.0f;
-    vertex_edge_count_div[edges[i].v2] += 1.0f;
-  }
+  vertex_edge_count_div = MEM_malloc_arrayN(numVerts, sizeof(float), __func__);
 
   /* a little confusing, but we can include 'lambda' and smoothing weight
    * here to avoid multiplying for every iteration */
-  if (smooth_weights == NULL) {
-    for (i = 0; i < numVerts; i++) {
-      vertex_edge_count_div[i] = lambda * (vertex_edge_count_div[i] ?
-                                               (1.0f / vertex_edge_count_div[i]) :
-                                               1.0f);
-    }
-  }
-  else {
-    for (i = 0; i < numVerts; i++) {
-      vertex_edge_count_div[i] = smooth_weights[i] * lambda *
-                                 (vertex_edge_count_div[i] ? (1.0f / vertex_edge_count_div[i]) :
-                                                             1.0f);
+  for (i = 0; i < numVerts; i++) {
+    /* calculate as floats to avoid int->float conversion in #smooth_iter */
+    const float edge_count = (float)vert_edges[i].count;
+    vertex_edge_count_div[i] = lambda * (edge_count ? (1.0f / edge_count) : 1.0f);
+    if (smooth_weights != NULL) {
+      vertex_edge_count_div[i] *= smooth_weights[i];
     }
   }
 
+  SmoothingTaskData data = {
+      .vert_edges = vert_edges,
+      .edges = mesh->medge,
+      .vertexCos = vertexCos,
+      .deltas = deltas,
+      .vertex_edge_count_div = vertex_edge_count_div,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+
   /* -------------------------------------------------------------------- */
   /* Main Smoothing Loop */
 
   while (iterations--) {
-    for (i = 0; i < numEdges; i++) {
-      struct SmoothingData_Simple *sd_v1;
-      struct SmoothingData_Simple *sd_v2;
-      float edge_dir[3];
-
-      sub_v3_v3v3(edge_dir, vertexCos[edges[i].v2], vertexCos[edges[i].v1]);
-
-      sd_v1 = &smooth_data[edges[i].v1];
-      sd_v2 = &smooth_data[edges[i].v2];
-
-      add_v3_v3(sd_v1->delta, edge_dir);
-      sub_v3_v3(sd_v2->delta, edge_dir);
-    }
-
-    for (i = 0; i < numVerts; i++) {
-      struct SmoothingData_Simple *sd = &smooth_data[i];
-      madd_v3_v3fl(vertexCos[i], sd->delta, vertex_edge_count_div[i]);
-      /* zero for the next iteration (saves memset on entire array) */
-      memset(sd, 0, sizeof(*sd));
-    }
+    BLI_task_parallel_range(0, (int)numVerts, &data, smooth_simple_delta_task_cb, &settings);
+    BLI_task_parallel_range(0, (int)numVerts, &data, smooth_simple_apply_task_cb, &settings);
   }
 
+  MEM_freeN(vert_edges);
+  MEM_freeN(vert_edges_mem);
   MEM_freeN(vertex_edge_count_div);
-  MEM_freeN(smooth_data);
+  MEM_freeN(deltas);
 }
 
 /* -------------------------------------------------------------------- */
 /* Edge-Length Weighted Smoothing
  */
+static void smooth_length_weight_delta_task_cb(void *__restrict userdata,
+                                               const int i,
+                                               const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SmoothingTaskData *data = userdata;
+  const MeshElemMap *vert_edges = &data->vert_edges[i];
+  float *delta = data->deltas[i];
+  float edge_length_sum = 0.0f;
+
+  zero_v3(delta);
+  for (int j = 0; j < vert_edges->count; j++) {
+    const int v_other = BKE_mesh_edge_other_vert(&data->edges[vert_edges->indices[j]], i);
+    float edge_dir[3];
+    sub_v3_v3v3(edge_dir, data->vertexCos[v_other], data->vertexCos[i]);
+    const float edge_dist = len_v3(edge_dir);
+
+    /* weight by distance */
+    madd_v3_v3fl(delta, edge_dir, edge_dist);
+    edge_length_sum += edge_dist;
+  }
+
+  data->edge_length_sums[i] = edge_length_sum;
+}
+
+static void smooth_length_weight_apply_task_cb(void *__restrict userdata,
+                                               const int i,
+                                               const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SmoothingTaskData *data = userdata;
+  const float eps = FLT_EPSILON * 10.0f;
+
+  /* Divide by sum of all neighbor distances (weighted) and amount of neighbors,
+   * (mean average). */
+  const float div = data->edge_length_sums[i] * (float)data->vert_edges[i].count;
+  if (div > eps) {
+    const float lambda_w = data->smooth_weights ? data->lambda * data->smooth_weights[i] :
+                                                  data->lambda;
+    /* first calculate the new location and then interpolate, in one step */
+    madd_v3_v3fl(data->vertexCos[i], data->deltas[i], lambda_w / div);
+  }
+}
+
 static void smooth_iter__length_weight(CorrectiveSmoothModifierData *csmd,
                                        Mesh *mesh,
                                        float (*vertexCos)[3],
@@ -265,91 +338,47 @@ static void smooth_iter__length_weight(CorrectiveSmoothModifierData *csmd,
                                        const float *smooth_weights,
                                        uint iterations)
 {
-  const float eps = FLT_EPSILON * 10.0f;
-  const uint numEdges = (uint)mesh->totedge;
   /* note: the way this smoothing method works, its approx half as strong as the simple-smooth,
    * and 2.0 rarely spikes, double the value for consistent behavior. */
   const float lambda = csmd->lambda * 2.0f;
-  const MEdge *edges = mesh->medge;
-  float *vertex_edge_count;
-  uint i;
-
-  struct SmoothingData_Weighted {
-    float delta[3];
-    float edge_length_sum;
-  } *smooth_data = MEM_calloc_arrayN(numVerts, sizeof(*smooth_data), __func__);
-
-  /* calculate as floats to avoid int->float conversion in #smooth_iter */
-  vertex_edge_count = MEM_calloc_arrayN(numVerts, sizeof(float), __func__);
-  for (i = 0; i < numEdges; i++) {
-    vertex_edge_count[edges[i].v1] += 1.0f;
-    vertex_edge_count[edges[i].v2] += 1.0f;
-  }
-
-  /* -------------------------------------------------------------------- */
-  /* Main Smoothing Loop */
 
-  while (iterations--) {
-    for (i = 0; i < numEdges; i++) {
-      struct SmoothingData_Weighted *sd_v1;
-      struct SmoothingData_Weighted *sd_v2;
-      float edge_dir[3];
-      float edge_dist;
+  MeshElemMap *vert_edges;
+  int *vert_edges_mem;
 
-      sub_v3_v3v3(edge_dir, vertexCos[edges[i].v2], vertexCos[edges[i].v1]);
-      edge_dist = len_v3(edge_dir);
+  BKE_mesh_vert_edge_map_create(
+      &vert_edges, &vert_edges_mem, mesh->medge, (int)numVerts, mesh->totedge);
 
-      /* weight by distance */
-      mul_v3_fl(edge_dir, edge_dist);
+  float(*deltas)[3] = MEM_malloc_arrayN(numVerts, sizeof(*deltas), __func__);
+  float *edge_length_sums = MEM_malloc_arrayN(numVerts, sizeof(float), __func__);
 
-      sd_v1 = &smooth_data[edges[i].v1];
-      sd_v2 = &smooth_data[edges[i].v2];
+  SmoothingTaskData data = {
+      .vert_edges = vert_edges,
+      .edges = mesh->medge,
+      .vertexCos = vertexCos,
+      .deltas = deltas,
+      .edge_length_sums = edge_length_sums,
+      .smooth_weights = smooth_weights,
+      .lambda = lambda,
+  };
 
-      add_v3_v3(sd_v1->delta, edge_dir);
-      sub_v3_v3(sd_v2->delta, edge_dir);
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
 
-      sd_v1->edge_length_sum += edge_dist;
-      sd_v2->edge_length_sum += edge_dist;
-    }
+  /* -------------------------------------------------------------------- */
+  /* Main Smoothing Loop */
 
-    if (smooth_weights == NULL) {
-      /* fast-path */
-      for (i = 0; i < numVerts; i++) {
-        struct SmoothingData_Weighted *sd = &smooth_data[i];
-        /* Divide by sum of all neighbor distances (weighted) and amount of neighbors,
-         * (mean average). */
-        const float div = sd->edge_length_sum * vertex_edge_count[i];
-        if (div > eps) {
-#if 0
-          /* first calculate the new location */
-          mul_v3_fl(sd->delta, 1.0f / div);
-          /* then interpolate */
-          madd_v3_v3fl(vertexCos[i], sd->delta, lambda);
-#else
-          /* do this in one step */
-          madd_v3_v3fl(vertexCos[i], sd->delta, lambda / div);
-#endif
-        }
-        /* zero for the next iteration (saves memset on entire array) */
-        memset(sd, 0, sizeof(*sd));
-      }
-    }
-    else {
-      for (i = 0; i < numVerts; i++) {
-        struct SmoothingData_Weighted *sd = &smooth_data[i];
-        const float div = sd->edge_length_sum * vertex_edge_count[i];
-        if (div > eps) {
-          const float lambda_w = lambda * smooth_weights[i];
-          madd_v3_v3fl(vertexCos[i], sd->delta, lambda_w / div);
-        }
-
-        memset(sd, 0, sizeof(*sd));
-      }
-    }
+  while (iterations--) {
+    BLI_task_parallel_range(
+        0, (int)numVerts, &data, smooth_length_weight_delta_task_cb, &settings);
+    BLI_task_parallel_range(
+        0, (int)numVerts, &data, smooth_length_weight_apply_task_cb, &settings);
   }
 
-  MEM_freeN(vertex_edge_count);
-  MEM_freeN(smooth_data);
+  MEM_freeN(vert_edges);
+  MEM_freeN(vert_edges_mem);
+  MEM_freeN(edge_length_sums);
+  MEM_freeN(deltas);
 }
 
 static void smooth_iter(CorrectiveSmoothModifierData *csmd,
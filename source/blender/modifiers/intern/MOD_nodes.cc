@@ -23,14 +23,19 @@
 
 #include <cstring>
 #include <iostream>
+#include <mutex>
+#include <optional>
 #include <string>
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_concurrent_map.hh"
 #include "BLI_float3.hh"
+#include "BLI_hash_mm2a.h"
 #include "BLI_listbase.h"
 #include "BLI_set.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_collection_types.h"
@@ -88,6 +93,7 @@ using blender::bke::PersistentCollectionHandle;
 using blender::bke::PersistentDataHandleMap;
 using blender::bke::PersistentObjectHandle;
 using blender::fn::GMutablePointer;
+using blender::fn::GPointer;
 using blender::fn::GValueMap;
 using blender::nodes::GeoNodeExecParams;
 using namespace blender::nodes::derived_node_tree_types;
@@ -246,10 +252,355 @@ static bool isDisabled(const struct Scene *UNUSED(scene),
   return false;
 }
 
+/* Maximum amount of memory used by the cached node outputs of one modifier. */
+static constexpr int64_t geometry_nodes_cache_memory_limit = 256 * 1024 * 1024;
+
+/**
+ * Builds a 64 bit key from two murmur hashes with different seeds, so that different inputs
+ * practically never end up with the same key.
+ */
+class CacheKeyBuilder {
+ private:
+  BLI_HashMurmur2A hash_[2];
+
+ public:
+  CacheKeyBuilder()
+  {
+    BLI_hash_mm2a_init(&hash_[0], 0);
+    BLI_hash_mm2a_init(&hash_[1], 0x9e3779b9);
+  }
+
+  void add(const void *data, const size_t size)
+  {
+    for (BLI_HashMurmur2A &hash : hash_) {
+      BLI_hash_mm2a_add(&hash, static_cast<const unsigned char *>(data), size);
+    }
+  }
+
+  void add_int(const int value)
+  {
+    for (BLI_HashMurmur2A &hash : hash_) {
+      BLI_hash_mm2a_add_int(&hash, value);
+    }
+  }
+
+  void add_uint64(const uint64_t value)
+  {
+    this->add(&value, sizeof(value));
+  }
+
+  void add_string(StringRef str)
+  {
+    this->add_int(str.size());
+    this->add(str.data(), str.size());
+  }
+
+  uint64_t end()
+  {
+    const uint64_t hash0 = BLI_hash_mm2a_end(&hash_[0]);
+    const uint64_t hash1 = BLI_hash_mm2a_end(&hash_[1]);
+    return (hash0 << 32) | hash1;
+  }
+};
+
+/* Add the contents of all layers to the key. Returns false when the data can't be hashed. */
+static bool custom_data_add_to_key(CacheKeyBuilder &key, const CustomData &data, const int size)
+{
+  key.add_int(size);
+  for (const int i : IndexRange(data.totlayer)) {
+    const CustomDataLayer &layer = data.layers[i];
+    key.add_int(layer.type);
+    key.add_string(layer.name);
+    if (layer.data == nullptr) {
+      continue;
+    }
+    if (ELEM(layer.type, CD_MDISPS, CD_GRID_PAINT_MASK)) {
+      /* These layers point to data that is not part of the layer. */
+      return false;
+    }
+    if (layer.type == CD_MDEFORMVERT) {
+      const MDeformVert *dverts = static_cast<const MDeformVert *>(layer.data);
+      for (const int j : IndexRange(size)) {
+        key.add_int(dverts[j].totweight);
+        key.add(dverts[j].dw, sizeof(MDeformWeight) * dverts[j].totweight);
+      }
+      continue;
+    }
+    key.add(layer.data, static_cast<size_t>(CustomData_sizeof(layer.type)) * size);
+  }
+  return true;
+}
+
+static int64_t custom_data_memory_size(const CustomData &data, const int size)
+{
+  int64_t memory_size = 0;
+  for (const int i : IndexRange(data.totlayer)) {
+    const CustomDataLayer &layer = data.layers[i];
+    if (layer.data != nullptr) {
+      memory_size += static_cast<int64_t>(CustomData_sizeof(layer.type)) * size;
+    }
+  }
+  return memory_size;
+}
+
+/* Only geometry that is completely described by its own data can be cached, instances and volume
+ * grids reference data that is not hashed. */
+static bool geometry_set_is_cacheable(const GeometrySet &geometry_set)
+{
+  return !geometry_set.has_instances() && !geometry_set.has_volume();
+}
+
+static bool geometry_set_add_to_key(CacheKeyBuilder &key, const GeometrySet &geometry_set)
+{
+  if (!geometry_set_is_cacheable(geometry_set)) {
+    return false;
+  }
+  const MeshComponent *mesh_component = geometry_set.get_component_for_read<MeshComponent>();
+  const Mesh *mesh = (mesh_component == nullptr) ? nullptr : mesh_component->get_for_read();
+  key.add_int(mesh != nullptr);
+  if (mesh != nullptr) {
+    if (!custom_data_add_to_key(key, mesh->vdata, mesh->totvert) ||
+        !custom_data_add_to_key(key, mesh->edata, mesh->totedge) ||
+        !custom_data_add_to_key(key, mesh->fdata, mesh->totface) ||
+        !custom_data_add_to_key(key, mesh->ldata, mesh->totloop) ||
+        !custom_data_add_to_key(key, mesh->pdata, mesh->totpoly)) {
+      return false;
+    }
+    key.add_int(mesh->flag);
+    key.add(&mesh->smoothresh, sizeof(mesh->smoothresh));
+    key.add_int(mesh->totcol);
+    key.add(mesh->mat, sizeof(Material *) * mesh->totcol);
+    for (auto item : mesh_component->vertex_group_names().items()) {
+      key.add_string(item.key);
+      key.add_int(item.value);
+    }
+  }
+  const PointCloudComponent *pointcloud_component =
+      geometry_set.get_component_for_read<PointCloudComponent>();
+  const PointCloud *pointcloud = (pointcloud_component == nullptr) ?
+                                     nullptr :
+                                     pointcloud_component->get_for_read();
+  key.add_int(pointcloud != nullptr);
+  if (pointcloud != nullptr) {
+    if (!custom_data_add_to_key(key, pointcloud->pdata, pointcloud->totpoint)) {
+      return false;
+    }
+    key.add_int(pointcloud->totcol);
+    key.add(pointcloud->mat, sizeof(Material *) * pointcloud->totcol);
+  }
+  return true;
+}
+
+static int64_t geometry_set_memory_size(const GeometrySet &geometry_set)
+{
+  int64_t memory_size = 0;
+  if (const Mesh *mesh = geometry_set.get_mesh_for_read()) {
+    memory_size += custom_data_memory_size(mesh->vdata, mesh->totvert);
+    memory_size += custom_data_memory_size(mesh->edata, mesh->totedge);
+    memory_size += custom_data_memory_size(mesh->fdata, mesh->totface);
+    memory_size += custom_data_memory_size(mesh->ldata, mesh->totloop);
+    memory_size += custom_data_memory_size(mesh->pdata, mesh->totpoly);
+  }
+  if (const PointCloud *pointcloud = geometry_set.get_pointcloud_for_read()) {
+    memory_size += custom_data_memory_size(pointcloud->pdata, pointcloud->totpoint);
+  }
+  return memory_size;
+}
+
+/* Copy the geometry so that the cache owns all of its data. The geometry passed to a node might
+ * reference data owned by the modifier stack, which does not outlive the evaluation. */
+static GeometrySet geometry_set_copy_for_cache(const GeometrySet &geometry_set)
+{
+  GeometrySet geometry_set_copy;
+  if (const MeshComponent *component = geometry_set.get_component_for_read<MeshComponent>()) {
+    MeshComponent &component_copy = geometry_set_copy.get_component_for_write<MeshComponent>();
+    if (const Mesh *mesh = component->get_for_read()) {
+      component_copy.replace(BKE_mesh_copy_for_eval(const_cast<Mesh *>(mesh), false));
+    }
+    component_copy.vertex_group_names() = component->vertex_group_names();
+  }
+  if (const PointCloud *pointcloud = geometry_set.get_pointcloud_for_read()) {
+    geometry_set_copy.replace_pointcloud(
+        BKE_pointcloud_copy_for_eval(const_cast<PointCloud *>(pointcloud), false));
+  }
+  return geometry_set_copy;
+}
+
+/**
+ * Outputs of expensive nodes are cached on the evaluated modifier, so that evaluating the
+ * modifier again does not recompute them when their inputs did not change, e.g. when only nodes
+ * further down the tree are edited. The key of an entry is a hash of the node settings and the
+ * contents of all its input values. When the cache exceeds its memory limit, the least recently
+ * used entries are removed.
+ */
+class GeometryNodesCache {
+ private:
+  struct Entry {
+    Vector<std::pair<std::string, GMutablePointer>> outputs;
+    int64_t memory_size = 0;
+    uint64_t last_used = 0;
+
+    ~Entry()
+    {
+      for (std::pair<std::string, GMutablePointer> &item : outputs) {
+        item.second.destruct();
+        MEM_freeN(item.second.get());
+      }
+    }
+  };
+
+  Map<uint64_t, std::unique_ptr<Entry>> entries_;
+  int64_t memory_size_ = 0;
+  uint64_t use_counter_ = 0;
+  std::mutex mutex_;
+
+ public:
+  /* Add copies of the cached outputs to the map. Returns false when nothing is cached for the
+   * key. */
+  bool lookup(const uint64_t key,
+              GValueMap<StringRef> &r_outputs,
+              blender::LinearAllocator<> &allocator)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_ptr<Entry> *entry = entries_.lookup_ptr(key);
+    if (entry == nullptr) {
+      return false;
+    }
+    (*entry)->last_used = ++use_counter_;
+    for (const std::pair<std::string, GMutablePointer> &item : (*entry)->outputs) {
+      r_outputs.add_new_by_copy(allocator.copy_string(item.first), GPointer(item.second));
+    }
+    return true;
+  }
+
+  void add(const uint64_t key, Span<std::pair<StringRef, GMutablePointer>> outputs)
+  {
+    std::unique_ptr<Entry> entry = std::make_unique<Entry>();
+    for (const std::pair<StringRef, GMutablePointer> &item : outputs) {
+      const CPPType &type = *item.second.type();
+      if (type.is<GeometrySet>() &&
+          !geometry_set_is_cacheable(*static_cast<const GeometrySet *>(item.second.get()))) {
+        return;
+      }
+    }
+    for (const std::pair<StringRef, GMutablePointer> &item : outputs) {
+      const CPPType &type = *item.second.type();
+      void *buffer = MEM_mallocN_aligned(type.size(), type.alignment(), __func__);
+      if (type.is<GeometrySet>()) {
+        const GeometrySet &geometry_set = *static_cast<const GeometrySet *>(item.second.get());
+        new (buffer) GeometrySet(geometry_set_copy_for_cache(geometry_set));
+        entry->memory_size += geometry_set_memory_size(geometry_set);
+      }
+      else {
+        type.copy_to_uninitialized(item.second.get(), buffer);
+        entry->memory_size += type.size();
+      }
+      entry->outputs.append({item.first, {type, buffer}});
+    }
+
+    /* Results without geometry are cheap to compute again. They are also what nodes output
+     * together with an error message, which would not be shown when the node is not executed. */
+    if (entry->memory_size == 0 || entry->memory_size > geometry_nodes_cache_memory_limit) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.contains(key)) {
+      return;
+    }
+    while (memory_size_ + entry->memory_size > geometry_nodes_cache_memory_limit) {
+      this->remove_least_recently_used();
+    }
+    entry->last_used = ++use_counter_;
+    memory_size_ += entry->memory_size;
+    entries_.add_new(key, std::move(entry));
+  }
+
+ private:
+  void remove_least_recently_used()
+  {
+    uint64_t oldest_key = 0;
+    uint64_t oldest_use = UINT64_MAX;
+    for (auto item : entries_.items()) {
+      if (item.value->last_used < oldest_use) {
+        oldest_key = item.key;
+        oldest_use = item.value->last_used;
+      }
+    }
+    memory_size_ -= entries_.lookup(oldest_key)->memory_size;
+    entries_.remove(oldest_key);
+  }
+};
+
+static GeometryNodesCache &geometry_nodes_cache_ensure(ModifierData &md)
+{
+  if (md.runtime == nullptr) {
+    md.runtime = OBJECT_GUARDED_NEW(GeometryNodesCache);
+  }
+  return *static_cast<GeometryNodesCache *>(md.runtime);
+}
+
+static void freeRuntimeData(void *runtime_data)
+{
+  if (runtime_data != nullptr) {
+    GeometryNodesCache *cache = static_cast<GeometryNodesCache *>(runtime_data);
+    OBJECT_GUARDED_DELETE(cache, GeometryNodesCache);
+  }
+}
+
+/* Nodes whose outputs are cached, because they are expensive to compute compared to hashing
+ * their inputs. */
+static bool node_supports_caching(const bNode &bnode)
+{
+  switch (bnode.type) {
+    case GEO_NODE_BOOLEAN:
+    case GEO_NODE_POINT_DISTRIBUTE:
+    case GEO_NODE_SUBDIVISION_SURFACE:
+    case GEO_NODE_SUBDIVISION_SURFACE_SIMPLE:
+    case GEO_NODE_ATTRIBUTE_PROXIMITY:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static void node_settings_add_to_key(CacheKeyBuilder &key, const bNode &bnode)
+{
+  key.add_string(bnode.idname);
+  key.add_int(bnode.custom1);
+  key.add_int(bnode.custom2);
+  key.add(&bnode.custom3, sizeof(bnode.custom3));
+  key.add(&bnode.custom4, sizeof(bnode.custom4));
+  if (bnode.storage != nullptr) {
+    key.add(bnode.storage, MEM_allocN_len(bnode.storage));
+  }
+}
+
+/* Add an input value of a node to the key. Returns false when the value can't be hashed. */
+static bool value_add_to_key(CacheKeyBuilder &key, StringRef identifier, GPointer value)
+{
+  const CPPType &type = *value.type();
+  key.add_string(identifier);
+  key.add_string(type.name());
+  if (type.is<GeometrySet>()) {
+    return geometry_set_add_to_key(key, *static_cast<const GeometrySet *>(value.get()));
+  }
+  if (type.is<PersistentObjectHandle>() || type.is<PersistentCollectionHandle>()) {
+    /* The referenced data can change without the handle changing. */
+    return false;
+  }
+  key.add_uint64(type.hash(value.get()));
+  return true;
+}
+
 class GeometryNodesEvaluator {
  private:
   blender::LinearAllocator<> allocator_;
-  Map<std::pair<const DInputSocket *, const DOutputSocket *>, GMutablePointer> value_by_input_;
+  /* Every executed node gets its own allocator, so that nodes can be executed in parallel. */
+  Vector<std::unique_ptr<blender::LinearAllocator<>>> node_allocators_;
+  /* Accessed by all threads executing nodes, sharded to avoid contention on a single lock. */
+  blender::ConcurrentMap<std::pair<const DInputSocket *, const DOutputSocket *>, GMutablePointer>
+      value_by_input_;
   Vector<const DInputSocket *> group_outputs_;
   blender::nodes::MultiFunctionByNode &mf_by_node_;
   const blender::nodes::DataTypeConversions &conversions_;
@@ -257,6 +608,7 @@ class GeometryNodesEvaluator {
   const Object *self_object_;
   const ModifierData *modifier_;
   Depsgraph *depsgraph_;
+  GeometryNodesCache &cache_;
 
  public:
   GeometryNodesEvaluator(const Map<const DOutputSocket *, GMutablePointer> &group_input_data,
@@ -265,35 +617,124 @@ class GeometryNodesEvaluator {
                          const PersistentDataHandleMap &handle_map,
                          const Object *self_object,
                          const ModifierData *modifier,
-                         Depsgraph *depsgraph)
+                         Depsgraph *depsgraph,
+                         GeometryNodesCache &cache)
       : group_outputs_(std::move(group_outputs)),
         mf_by_node_(mf_by_node),
         conversions_(blender::nodes::get_implicit_type_conversions()),
         handle_map_(handle_map),
         self_object_(self_object),
         modifier_(modifier),
-        depsgraph_(depsgraph)
+        depsgraph_(depsgraph),
+        cache_(cache)
   {
     for (auto item : group_input_data.items()) {
-      this->forward_to_inputs(*item.key, item.value);
+      this->forward_to_inputs(*item.key, item.value, allocator_);
     }
   }
 
   Vector<GMutablePointer> execute()
   {
+    this->execute_required_nodes();
+
     Vector<GMutablePointer> results;
     for (const DInputSocket *group_output : group_outputs_) {
-      Vector<GMutablePointer> result = this->get_input_values(*group_output);
+      Vector<GMutablePointer> result = this->get_input_values(*group_output, allocator_);
       results.append(result[0]);
     }
-    for (GMutablePointer value : value_by_input_.values()) {
-      value.destruct();
-    }
+    value_by_input_.foreach_item(
+        [](const auto &UNUSED(key), GMutablePointer &value) { value.destruct(); });
     return results;
   }
 
  private:
-  Vector<GMutablePointer> get_input_values(const DInputSocket &socket_to_compute)
+  /**
+   * Execute all nodes that the group outputs depend on. Nodes are grouped in levels, where every
+   * node only depends on nodes of earlier levels. The nodes of one level are independent of
+   * each other and are executed in parallel.
+   */
+  void execute_required_nodes()
+  {
+    Map<const DNode *, int> level_by_node;
+    for (const DInputSocket *group_output : group_outputs_) {
+      this->compute_input_level(*group_output, level_by_node);
+    }
+
+    Vector<Vector<const DNode *>> nodes_by_level;
+    for (auto item : level_by_node.items()) {
+      if (item.value >= nodes_by_level.size()) {
+        nodes_by_level.resize(item.value + 1);
+      }
+      nodes_by_level[item.value].append(item.key);
+    }
+
+    for (Span<const DNode *> nodes : nodes_by_level) {
+      const int64_t allocators_start = node_allocators_.size();
+      node_allocators_.resize(allocators_start + nodes.size());
+
+      blender::parallel_for(nodes.index_range(), 1, [&](IndexRange range) {
+        for (const int64_t i : range) {
+          std::unique_ptr<blender::LinearAllocator<>> &allocator =
+              node_allocators_[allocators_start + i];
+          allocator = std::make_unique<blender::LinearAllocator<>>();
+          this->execute_node_and_forward(*nodes[i], *allocator);
+        }
+      });
+    }
+  }
+
+  /* Returns the level of the node, computing it and the levels of the nodes it depends on when
+   * it has not been computed yet. */
+  int compute_node_level(const DNode &node, Map<const DNode *, int> &level_by_node)
+  {
+    const int *existing_level = level_by_node.lookup_ptr(&node);
+    if (existing_level != nullptr) {
+      return *existing_level;
+    }
+
+    int level = 0;
+    for (const DInputSocket *input_socket : node.inputs()) {
+      if (input_socket->is_available()) {
+        level = std::max(level, this->compute_input_level(*input_socket, level_by_node));
+      }
+    }
+    level_by_node.add_new(&node, level);
+    return level;
+  }
+
+  /* Returns the first level at which all values of the input socket are available. */
+  int compute_input_level(const DInputSocket &socket, Map<const DNode *, int> &level_by_node)
+  {
+    Span<const DOutputSocket *> from_sockets = socket.linked_sockets();
+    Span<const DGroupInput *> from_group_inputs = socket.linked_group_inputs();
+    const int total_inputs = from_sockets.size() + from_group_inputs.size();
+
+    if (total_inputs == 0 || from_group_inputs.size() == 1) {
+      /* The value of the socket itself is used. */
+      return 0;
+    }
+
+    int level = 0;
+    for (const DOutputSocket *from_socket : from_sockets) {
+      if (value_by_input_.contains(std::make_pair(&socket, from_socket))) {
+        /* The value has been passed in already. */
+        continue;
+      }
+      if (!from_socket->is_available()) {
+        /* If the output is not available, use a default value. */
+        const CPPType &type = *blender::nodes::socket_cpp_type_get(*from_socket->typeinfo());
+        void *buffer = allocator_.allocate(type.size(), type.alignment());
+        type.copy_to_uninitialized(type.default_value(), buffer);
+        this->forward_to_inputs(*from_socket, {type, buffer}, allocator_);
+        continue;
+      }
+      level = std::max(level, this->compute_node_level(from_socket->node(), level_by_node) + 1);
+    }
+    return level;
+  }
+
+  Vector<GMutablePointer> get_input_values(const DInputSocket &socket_to_compute,
+                                           blender::LinearAllocator<> &allocator)
   {
 
     Span<const DOutputSocket *> from_sockets = socket_to_compute.linked_sockets();
@@ -302,28 +743,21 @@ class GeometryNodesEvaluator {
 
     if (total_inputs == 0) {
       /* The input is not connected, use the value from the socket itself. */
-      return {get_unlinked_input_value(socket_to_compute)};
+      return {get_unlinked_input_value(socket_to_compute, allocator)};
     }
 
     if (from_group_inputs.size() == 1) {
-      return {get_unlinked_input_value(socket_to_compute)};
+      return {get_unlinked_input_value(socket_to_compute, allocator)};
     }
 
+    /* The linked nodes have been executed already, see #execute_required_nodes. */
     /* Multi-input sockets contain a vector of inputs. */
     if (socket_to_compute.is_multi_input_socket()) {
       Vector<GMutablePointer> values;
       for (const DOutputSocket *from_socket : from_sockets) {
         const std::pair<const DInputSocket *, const DOutputSocket *> key = std::make_pair(
             &socket_to_compute, from_socket);
-        std::optional<GMutablePointer> value = value_by_input_.pop_try(key);
-        if (value.has_value()) {
-          values.append(*value);
-        }
-        else {
-          this->compute_output_and_forward(*from_socket);
-          GMutablePointer value = value_by_input_.pop(key);
-          values.append(value);
-        }
+        values.append(value_by_input_.pop(key));
       }
       return values;
     }
@@ -331,61 +765,76 @@ class GeometryNodesEvaluator {
     const DOutputSocket &from_socket = *from_sockets[0];
     const std::pair<const DInputSocket *, const DOutputSocket *> key = std::make_pair(
         &socket_to_compute, &from_socket);
-    std::optional<GMutablePointer> value = value_by_input_.pop_try(key);
-    if (value.has_value()) {
-      /* This input has been computed before, return it directly. */
-      return {*value};
-    }
-
-    /* Compute the socket now. */
-    this->compute_output_and_forward(from_socket);
     return {value_by_input_.pop(key)};
   }
 
-  void compute_output_and_forward(const DOutputSocket &socket_to_compute)
+  void execute_node_and_forward(const DNode &node, blender::LinearAllocator<> &allocator)
   {
-    const DNode &node = socket_to_compute.node();
-
-    if (!socket_to_compute.is_available()) {
-      /* If the output is not available, use a default value. */
-      const CPPType &type = *blender::nodes::socket_cpp_type_get(*socket_to_compute.typeinfo());
-      void *buffer = allocator_.allocate(type.size(), type.alignment());
-      type.copy_to_uninitialized(type.default_value(), buffer);
-      this->forward_to_inputs(socket_to_compute, {type, buffer});
-      return;
+    /* The key of the node outputs in the cache, built while the inputs are prepared. */
+    std::optional<CacheKeyBuilder> cache_key;
+    if (node_supports_caching(*node.bnode())) {
+      cache_key.emplace();
+      node_settings_add_to_key(*cache_key, *node.bnode());
     }
 
     /* Prepare inputs required to execute the node. */
-    GValueMap<StringRef> node_inputs_map{allocator_};
+    GValueMap<StringRef> node_inputs_map{allocator};
     for (const DInputSocket *input_socket : node.inputs()) {
       if (input_socket->is_available()) {
-        Vector<GMutablePointer> values = this->get_input_values(*input_socket);
+        Vector<GMutablePointer> values = this->get_input_values(*input_socket, allocator);
         for (int i = 0; i < values.size(); ++i) {
           /* Values from Multi Input Sockets are stored in input map with the format
            * <identifier>[<index>]. */
-          blender::StringRefNull key = allocator_.copy_string(
+          blender::StringRefNull key = allocator.copy_string(
               input_socket->identifier() + (i > 0 ? ("[" + std::to_string(i)) + "]" : ""));
+          if (cache_key.has_value() && !value_add_to_key(*cache_key, key, values[i])) {
+            cache_key.reset();
+          }
           node_inputs_map.add_new_direct(key, std::move(values[i]));
         }
       }
     }
 
-    /* Execute the node. */
-    GValueMap<StringRef> node_outputs_map{allocator_};
+    /* Execute the node, unless its outputs are cached already. */
+    GValueMap<StringRef> node_outputs_map{allocator};
     GeoNodeExecParams params{
         node, node_inputs_map, node_outputs_map, handle_map_, self_object_, modifier_, depsgraph_};
-    this->execute_node(node, params);
+    const std::optional<uint64_t> cache_hash = cache_key.has_value() ?
+                                                   std::optional<uint64_t>(cache_key->end()) :
+                                                   std::nullopt;
+    bool is_cached = false;
+    if (cache_hash.has_value()) {
+      is_cached = cache_.lookup(*cache_hash, node_outputs_map, allocator);
+    }
+    if (is_cached) {
+      this->store_ui_hints(node, params);
+    }
+    else {
+      this->execute_node(node, params, allocator);
+    }
 
-    /* Forward computed outputs to linked input sockets. */
+    Vector<const DOutputSocket *> output_sockets;
+    Vector<std::pair<StringRef, GMutablePointer>> output_values;
     for (const DOutputSocket *output_socket : node.outputs()) {
       if (output_socket->is_available()) {
-        GMutablePointer value = node_outputs_map.extract(output_socket->identifier());
-        this->forward_to_inputs(*output_socket, value);
+        output_sockets.append(output_socket);
+        output_values.append(
+            {output_socket->identifier(), node_outputs_map.extract(output_socket->identifier())});
       }
     }
+    if (cache_hash.has_value() && !is_cached) {
+      cache_.add(*cache_hash, output_values);
+    }
+
+    /* Forward computed outputs to linked input sockets. */
+    for (const int i : output_values.index_range()) {
+      this->forward_to_inputs(*output_sockets[i], output_values[i].second, allocator);
+    }
   }
 
-  void execute_node(const DNode &node, GeoNodeExecParams params)
+  void execute_node(const DNode &node,
+                    GeoNodeExecParams params,
+                    blender::LinearAllocator<> &allocator)
   {
     const bNode &bnode = params.node();
 
@@ -400,7 +849,7 @@ class GeometryNodesEvaluator {
     /* Use the multi-function implementation if it exists. */
     const MultiFunction *multi_function = mf_by_node_.lookup_default(&node, nullptr);
     if (multi_function != nullptr) {
-      this->execute_multi_function_node(node, params, *multi_function);
+      this->execute_multi_function_node(node, params, *multi_function, allocator);
       return;
     }
 
@@ -437,7 +886,8 @@ class GeometryNodesEvaluator {
 
   void execute_multi_function_node(const DNode &node,
                                    GeoNodeExecParams params,
-                                   const MultiFunction &fn)
+                                   const MultiFunction &fn,
+                                   blender::LinearAllocator<> &allocator)
   {
     MFContextBuilder fn_context;
     MFParamsBuilder fn_params{fn, 1};
@@ -453,7 +903,7 @@ class GeometryNodesEvaluator {
     for (const DOutputSocket *dsocket : node.outputs()) {
       if (dsocket->is_available()) {
         const CPPType &type = *blender::nodes::socket_cpp_type_get(*dsocket->typeinfo());
-        void *buffer = allocator_.allocate(type.size(), type.alignment());
+        void *buffer = allocator.allocate(type.size(), type.alignment());
         fn_params.add_uninitialized_single_output(GMutableSpan(type, buffer, 1));
         output_data.append(GMutablePointer(type, buffer));
       }
@@ -483,7 +933,9 @@ class GeometryNodesEvaluator {
     }
   }
 
-  void forward_to_inputs(const DOutputSocket &from_socket, GMutablePointer value_to_forward)
+  void forward_to_inputs(const DOutputSocket &from_socket,
+                         GMutablePointer value_to_forward,
+                         blender::LinearAllocator<> &allocator)
   {
     /* For all sockets that are linked with the from_socket push the value to their node. */
     Span<const DInputSocket *> to_sockets_all = from_socket.linked_sockets();
@@ -498,7 +950,7 @@ class GeometryNodesEvaluator {
         to_sockets_same_type.append(to_socket);
       }
       else {
-        void *buffer = allocator_.allocate(to_type.size(), to_type.alignment());
+        void *buffer = allocator.allocate(to_type.size(), to_type.alignment());
         if (conversions_.is_convertible(from_type, to_type)) {
           conversions_.convert(from_type, to_type, value_to_forward.get(), buffer);
         }
@@ -532,7 +984,7 @@ class GeometryNodesEvaluator {
       for (const DInputSocket *to_socket : other_to_sockets) {
         const std::pair<const DInputSocket *, const DOutputSocket *> key = std::make_pair(
             to_socket, &from_socket);
-        void *buffer = allocator_.allocate(type.size(), type.alignment());
+        void *buffer = allocator.allocate(type.size(), type.alignment());
         type.copy_to_uninitialized(value_to_forward.get(), buffer);
         add_value_to_input_socket(key, GMutablePointer{type, buffer});
       }
@@ -545,7 +997,8 @@ class GeometryNodesEvaluator {
     value_by_input_.add_new(key, value);
   }
 
-  GMutablePointer get_unlinked_input_value(const DInputSocket &socket)
+  GMutablePointer get_unlinked_input_value(const DInputSocket &socket,
+                                           blender::LinearAllocator<> &allocator)
   {
     bNodeSocket *bsocket;
     if (socket.linked_group_inputs().size() == 0) {
@@ -555,7 +1008,7 @@ class GeometryNodesEvaluator {
       bsocket = socket.linked_group_inputs()[0]->bsocket();
     }
     const CPPType &type = *blender::nodes::socket_cpp_type_get(*socket.typeinfo());
-    void *buffer = allocator_.allocate(type.size(), type.alignment());
+    void *buffer = allocator.allocate(type.size(), type.alignment());
 
     if (bsocket->type == SOCK_OBJECT) {
       Object *object = ((bNodeSocketValueObject *)bsocket->default_value)->value;
@@ -1054,7 +1507,8 @@ static GeometrySet compute_geometry(const DerivedNodeTree &tree,
                                    handle_map,
                                    ctx->object,
                                    (ModifierData *)nmd,
-                                   ctx->depsgraph};
+                                   ctx->depsgraph,
+                                   geometry_nodes_cache_ensure(nmd->modifier)};
 
   Vector<GMutablePointer> results = evaluator.execute();
   BLI_assert(results.size() == 1);
@@ -1306,6 +1760,8 @@ static void freeData(ModifierData *md)
     IDP_FreeProperty_ex(nmd->settings.properties, false);
     nmd->settings.properties = nullptr;
   }
+  freeRuntimeData(md->runtime);
+  md->runtime = nullptr;
 }
 
 static void requiredDataMask(Object *UNUSED(ob),
@@ -1349,7 +1805,7 @@ ModifierTypeInfo modifierType_Nodes = {
     /* dependsOnNormals */ nullptr,
     /* foreachIDLink */ foreachIDLink,
     /* foreachTexLink */ nullptr,
-    /* freeRuntimeData */ nullptr,
+    /* freeRuntimeData */ freeRuntimeData,
     /* panelRegister */ panelRegister,
     /* blendWrite */ blendWrite,
     /* blendRead */ blendRead,
@@ -23,6 +23,7 @@
 #include "BLI_alloca.h"
 #include "BLI_math.h"
 #include "BLI_math_geom.h"
+#include "BLI_memarena.h"
 #include "BLI_task.h"
 
 #include "BLT_translation.h"
@@ -165,6 +166,12 @@ typedef struct SDefBindWeightData {
   uint numbinds;
 } SDefBindWeightData;
 
+/** Per thread data of the bind task. */
+typedef struct SDefBindCalcTLS {
+  /** Scratch memory for #SDefBindWeightData, cleared after each vertex. */
+  MemArena *arena;
+} SDefBindCalcTLS;
+
 typedef struct SDefDeformData {
   const SDefVert *const bind_verts;
   float (*const targetCos)[3];
@@ -461,29 +468,17 @@ BLI_INLINE int isPolyValid(const float coords[][2], const uint nr)
   return MOD_SDEF_BIND_RESULT_SUCCESS;
 }
 
-static void freeBindData(SDefBindWeightData *const bwdata)
-{
-  SDefBindPoly *bpoly = bwdata->bind_polys;
-
-  if (bwdata->bind_polys) {
-    for (int i = 0; i < bwdata->numpoly; bpoly++, i++) {
-      MEM_SAFE_FREE(bpoly->coords);
-      MEM_SAFE_FREE(bpoly->coords_v2);
-    }
-
-    MEM_freeN(bwdata->bind_polys);
-  }
-
-  MEM_freeN(bwdata);
-}
-
 BLI_INLINE float computeAngularWeight(const float point_angle, const float edgemid_angle)
 {
   return sinf(min_ff(point_angle / edgemid_angle, 1) * M_PI_2);
 }
 
+/**
+ * \param arena: All returned data is allocated from this arena, which is cleared by the caller.
+ */
 BLI_INLINE SDefBindWeightData *computeBindWeights(SDefBindCalcData *const data,
-                                                  const float point_co[3])
+                                                  const float point_co[3],
+                                                  MemArena *arena)
 {
   const uint nearest = nearestVert(data, point_co);
   const SDefAdjacency *const vert_edges = data->vert_edges[nearest].first;
@@ -501,20 +496,9 @@ BLI_INLINE SDefBindWeightData *computeBindWeights(SDefBindCalcData *const data,
   float tot_weight = 0.0f;
   int inf_weight_flags = 0;
 
-  bwdata = MEM_callocN(sizeof(*bwdata), "SDefBindWeightData");
-  if (bwdata == NULL) {
-    data->success = MOD_SDEF_BIND_RESULT_MEM_ERR;
-    return NULL;
-  }
-
+  bwdata = BLI_memarena_calloc(arena, sizeof(*bwdata));
   bwdata->numpoly = data->vert_edges[nearest].num / 2;
-
-  bpoly = MEM_calloc_arrayN(bwdata->numpoly, sizeof(*bpoly), "SDefBindPoly");
-  if (bpoly == NULL) {
-    freeBindData(bwdata);
-    data->success = MOD_SDEF_BIND_RESULT_MEM_ERR;
-    return NULL;
-  }
+  bpoly = BLI_memarena_calloc(arena, sizeof(*bpoly) * bwdata->numpoly);
 
   bwdata->bind_polys = bpoly;
 
@@ -553,21 +537,8 @@ BLI_INLINE SDefBindWeightData *computeBindWeights(SDefBindCalcData *const data,
         bpoly->numverts = poly->totloop;
         bpoly->loopstart = poly->loopstart;
 
-        bpoly->coords = MEM_malloc_arrayN(
-            poly->totloop, sizeof(*bpoly->coords), "SDefBindPolyCoords");
-        if (bpoly->coords == NULL) {
-          freeBindData(bwdata);
-          data->success = MOD_SDEF_BIND_RESULT_MEM_ERR;
-          return NULL;
-        }
-
-        bpoly->coords_v2 = MEM_malloc_arrayN(
-            poly->totloop, sizeof(*bpoly->coords_v2), "SDefBindPolyCoords_v2");
-        if (bpoly->coords_v2 == NULL) {
-          freeBindData(bwdata);
-          data->success = MOD_SDEF_BIND_RESULT_MEM_ERR;
-          return NULL;
-        }
+        bpoly->coords = BLI_memarena_alloc(arena, sizeof(*bpoly->coords) * poly->totloop);
+        bpoly->coords_v2 = BLI_memarena_alloc(arena, sizeof(*bpoly->coords_v2) * poly->totloop);
 
         for (int j = 0; j < poly->totloop; j++, loop++) {
           copy_v3_v3(bpoly->coords[j], data->targetCos[loop->v]);
@@ -605,7 +576,6 @@ BLI_INLINE SDefBindWeightData *computeBindWeights(SDefBindCalcData *const data,
         is_poly_valid = isPolyValid(bpoly->coords_v2, poly->totloop);
 
         if (is_poly_valid != MOD_SDEF_BIND_RESULT_SUCCESS) {
-          freeBindData(bwdata);
           data->success = is_poly_valid;
           return NULL;
         }
@@ -661,7 +631,6 @@ BLI_INLINE SDefBindWeightData *computeBindWeights(SDefBindCalcData *const data,
         if (bpoly->scales[0] < FLT_EPSILON || bpoly->scales[1] < FLT_EPSILON ||
             bpoly->edgemid_angle < FLT_EPSILON || bpoly->corner_edgemid_angles[0] < FLT_EPSILON ||
             bpoly->corner_edgemid_angles[1] < FLT_EPSILON) {
-          freeBindData(bwdata);
           data->success = MOD_SDEF_BIND_RESULT_GENERIC_ERR;
           return NULL;
         }
@@ -719,7 +688,6 @@ BLI_INLINE SDefBindWeightData *computeBindWeights(SDefBindCalcData *const data,
           /* Verify that the additional computed values are valid. */
           if (bpoly->scale_mid < FLT_EPSILON ||
               bpoly->point_edgemid_angles[0] + bpoly->point_edgemid_angles[1] < FLT_EPSILON) {
-            freeBindData(bwdata);
             data->success = MOD_SDEF_BIND_RESULT_GENERIC_ERR;
             return NULL;
           }
@@ -793,7 +761,6 @@ BLI_INLINE SDefBindWeightData *computeBindWeights(SDefBindCalcData *const data,
       corner_angle_weights[1] = bpoly->point_edgemid_angles[1] / bpoly->corner_edgemid_angles[1];
 
       if (isnan(corner_angle_weights[0]) || isnan(corner_angle_weights[1])) {
-        freeBindData(bwdata);
         data->success = MOD_SDEF_BIND_RESULT_GENERIC_ERR;
         return NULL;
       }
@@ -810,7 +777,6 @@ BLI_INLINE SDefBindWeightData *computeBindWeights(SDefBindCalcData *const data,
 
       /* Check for invalid weights just in case computations fail. */
       if (bpoly->dominant_angle_weight < 0 || bpoly->dominant_angle_weight > 1) {
-        freeBindData(bwdata);
         data->success = MOD_SDEF_BIND_RESULT_GENERIC_ERR;
         return NULL;
       }
@@ -952,9 +918,10 @@ BLI_INLINE float computeNormalDisplacement(const float point_co[3],
 
 static void bindVert(void *__restrict userdata,
                      const int index,
-                     const TaskParallelTLS *__restrict UNUSED(tls))
+                     const TaskParallelTLS *__restrict tls)
 {
   SDefBindCalcData *const data = (SDefBindCalcData *)userdata;
+  SDefBindCalcTLS *const bind_tls = tls->userdata_chunk;
   float point_co[3];
   float point_co_proj[3];
 
@@ -969,12 +936,17 @@ static void bindVert(void *__restrict userdata,
     return;
   }
 
+  if (bind_tls->arena == NULL) {
+    bind_tls->arena = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, __func__);
+  }
+
   copy_v3_v3(point_co, data->vertexCos[index]);
-  bwdata = computeBindWeights(data, point_co);
+  bwdata = computeBindWeights(data, point_co, bind_tls->arena);
 
   if (bwdata == NULL) {
     sdvert->binds = NULL;
     sdvert->numbinds = 0;
+    BLI_memarena_clear(bind_tls->arena);
     return;
   }
 
@@ -982,6 +954,7 @@ static void bindVert(void *__restrict userdata,
   if (sdvert->binds == NULL) {
     data->success = MOD_SDEF_BIND_RESULT_MEM_ERR;
     sdvert->numbinds = 0;
+    BLI_memarena_clear(bind_tls->arena);
     return;
   }
 
@@ -1132,7 +1105,15 @@ static void bindVert(void *__restrict userdata,
     }
   }
 
-  freeBindData(bwdata);
+  BLI_memarena_clear(bind_tls->arena);
+}
+
+static void bindVertFree(const void *__restrict UNUSED(userdata), void *__restrict chunk)
+{
+  SDefBindCalcTLS *bind_tls = chunk;
+  if (bind_tls->arena != NULL) {
+    BLI_memarena_free(bind_tls->arena);
+  }
 }
 
 static bool surfacedeformBind(Object *ob,
@@ -1235,9 +1216,14 @@ static bool surfacedeformBind(Object *ob,
     mul_v3_m4v3(data.targetCos[i], smd_orig->mat, mvert[i].co);
   }
 
+  SDefBindCalcTLS bind_tls = {NULL};
+
   TaskParallelSettings settings;
   BLI_parallel_range_settings_defaults(&settings);
   settings.use_threading = (numverts > 10000);
+  settings.userdata_chunk = &bind_tls;
+  settings.userdata_chunk_size = sizeof(bind_tls);
+  settings.func_free = bindVertFree;
   BLI_task_parallel_range(0, numverts, &data, bindVert, &settings);
 
   MEM_freeN(data.targetCos);
@@ -37,8 +37,8 @@
 
 #include "BLI_alloca.h"
 #include "BLI_bitmap.h"
-#include "BLI_kdtree.h"
 #include "BLI_math.h"
+#include "BLI_task.h"
 
 #include "BLT_translation.h"
 
@@ -1567,6 +1567,324 @@ static bool bvhtree_weld_overlap_cb(void *userdata, int index_a, int index_b, in
 }
 #endif
 
+#ifndef USE_BVHTREEKDOP
+/* -------------------------------------------------------------------- */
+/** \name Weld Vertex Grid
+ *
+ * Uniform grid with cells of (at least) the merge distance. Vertices are sorted by cell, so the
+ * candidates of a vertex are the 9 ranges of the sorted array holding the cells around it
+ * (3 rows of 3 cells which are contiguous). Visiting the vertices in sorted order, those ranges
+ * only move forward, which keeps memory access linear for large scattered meshes.
+ * \{ */
+
+/* Cells per axis are limited so the cell key of all three axes fits into 64 bits. */
+#define WELD_GRID_AXIS_CELLS_MAX ((1 << 20) - 2)
+/* Sorted vertices handled by a single task when searching neighbors. */
+#define WELD_GRID_CHUNK_SIZE 4096
+
+struct WeldVertGrid {
+  float min[3];
+  float cell_size_inv;
+  float merge_dist_sq;
+  int cells_max[3];
+  uint key_shift[2];
+  uint len;
+  /* Sorted by cell key. */
+  uint64_t *keys;
+  uint *verts;
+  float (*cos)[3];
+};
+
+/* Cell coordinates start at 1, so neighbor cells are never negative. */
+static void weld_grid_cell_get(const struct WeldVertGrid *grid, const float co[3], int r_cell[3])
+{
+  for (int i = 0; i < 3; i++) {
+    const float f = (co[i] - grid->min[i]) * grid->cell_size_inv;
+    /* Also takes care of NAN coordinates. */
+    r_cell[i] = 1 + ((f > 0.0f) ? ((f < (float)grid->cells_max[i]) ? (int)f : grid->cells_max[i]) :
+                                  0);
+  }
+}
+
+BLI_INLINE uint64_t weld_grid_key(const struct WeldVertGrid *grid, int x, int y, int z)
+{
+  return ((uint64_t)x << grid->key_shift[0]) | ((uint64_t)y << grid->key_shift[1]) | (uint64_t)z;
+}
+
+static uint weld_grid_lower_bound(const struct WeldVertGrid *grid, const uint64_t key)
+{
+  uint first = 0;
+  uint count = grid->len;
+  while (count > 0) {
+    const uint step = count / 2;
+    if (grid->keys[first + step] < key) {
+      first += step + 1;
+      count -= step + 1;
+    }
+    else {
+      count = step;
+    }
+  }
+  return first;
+}
+
+typedef bool (*WeldGridNeighborFn)(void *userdata, uint v_search, uint v_other);
+
+/**
+ * Call \a fn for all vertices in merge distance of \a v_search (except itself).
+ * \param row_ofs: Start of each of the 9 rows in the sorted array, when not NULL these are
+ * advanced from their current value (which must not be past the row start).
+ * \return true as soon as \a fn returns true.
+ */
+static bool weld_grid_foreach_neighbor(const struct WeldVertGrid *grid,
+                                       const uint v_search,
+                                       const float co[3],
+                                       uint *row_ofs,
+                                       WeldGridNeighborFn fn,
+                                       void *userdata)
+{
+  int cell[3];
+  weld_grid_cell_get(grid, co, cell);
+  int row = 0;
+  for (int x = cell[0] - 1; x <= cell[0] + 1; x++) {
+    for (int y = cell[1] - 1; y <= cell[1] + 1; y++, row++) {
+      const uint64_t key_min = weld_grid_key(grid, x, y, cell[2] - 1);
+      const uint64_t key_max = weld_grid_key(grid, x, y, cell[2] + 1);
+      uint i;
+      if (row_ofs) {
+        for (i = row_ofs[row]; i < grid->len && grid->keys[i] < key_min; i++) {
+          /* Pass. */
+        }
+        row_ofs[row] = i;
+      }
+      else {
+        i = weld_grid_lower_bound(grid, key_min);
+      }
+      for (; i < grid->len && grid->keys[i] <= key_max; i++) {
+        const uint v_other = grid->verts[i];
+        if (v_other == v_search) {
+          continue;
+        }
+        if (len_squared_v3v3(co, grid->cos[i]) <= grid->merge_dist_sq) {
+          if (fn(userdata, v_search, v_other)) {
+            return true;
+          }
+        }
+      }
+    }
+  }
+  return false;
+}
+
+static bool weld_grid_any_neighbor_fn(void *UNUSED(userdata),
+                                      uint UNUSED(v_search),
+                                      uint UNUSED(v_other))
+{
+  return true;
+}
+
+struct WeldGridNeighborData {
+  const struct WeldVertGrid *grid;
+  /* Indexed by the original vertex index. */
+  bool *has_neighbor;
+};
+
+static void weld_grid_has_neighbor_task_cb(void *__restrict userdata,
+                                           const int chunk,
+                                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  struct WeldGridNeighborData *data = userdata;
+  const struct WeldVertGrid *grid = data->grid;
+  const uint start = (uint)chunk * WELD_GRID_CHUNK_SIZE;
+  const uint end = MIN2(start + WELD_GRID_CHUNK_SIZE, grid->len);
+
+  /* The rows around the first vertex of the chunk are searched, then they only advance. */
+  uint row_ofs[9];
+  {
+    int cell[3];
+    weld_grid_cell_get(grid, grid->cos[start], cell);
+    int row = 0;
+    for (int x = cell[0] - 1; x <= cell[0] + 1; x++) {
+      for (int y = cell[1] - 1; y <= cell[1] + 1; y++, row++) {
+        row_ofs[row] = weld_grid_lower_bound(grid, weld_grid_key(grid, x, y, cell[2] - 1));
+      }
+    }
+  }
+
+  for (uint i = start; i < end; i++) {
+    const uint v = grid->verts[i];
+    data->has_neighbor[v] = weld_grid_foreach_neighbor(
+        grid, v, grid->cos[i], row_ofs, weld_grid_any_neighbor_fn, NULL);
+  }
+}
+
+struct WeldGridMergeData {
+  uint *vert_dest_map;
+  uint found;
+};
+
+static bool weld_grid_merge_fn(void *userdata, uint v_search, uint v_other)
+{
+  struct WeldGridMergeData *data = userdata;
+  if (data->vert_dest_map[v_other] == OUT_OF_CONTEXT) {
+    data->vert_dest_map[v_other] = v_search;
+    data->found++;
+  }
+  return false;
+}
+
+/* LSD radix sort of the vertices by cell key, only the bits in use are sorted. */
+static void weld_grid_sort(struct WeldVertGrid *grid, const uint key_bits)
+{
+  uint64_t *keys_tmp = MEM_malloc_arrayN(grid->len, sizeof(*keys_tmp), __func__);
+  uint *verts_tmp = MEM_malloc_arrayN(grid->len, sizeof(*verts_tmp), __func__);
+  for (uint shift = 0; shift < key_bits; shift += 8) {
+    uint offsets[256] = {0};
+    for (uint i = 0; i < grid->len; i++) {
+      offsets[(grid->keys[i] >> shift) & 0xff]++;
+    }
+    uint ofs = 0;
+    for (uint i = 0; i < 256; i++) {
+      const uint len = offsets[i];
+      offsets[i] = ofs;
+      ofs += len;
+    }
+    for (uint i = 0; i < grid->len; i++) {
+      const uint dst = offsets[(grid->keys[i] >> shift) & 0xff]++;
+      keys_tmp[dst] = grid->keys[i];
+      verts_tmp[dst] = grid->verts[i];
+    }
+    SWAP(uint64_t *, grid->keys, keys_tmp);
+    SWAP(uint *, grid->verts, verts_tmp);
+  }
+  MEM_freeN(keys_tmp);
+  MEM_freeN(verts_tmp);
+}
+
+static uint weld_grid_axis_bits(const int cells)
+{
+  uint bits = 1;
+  while ((1 << bits) <= cells) {
+    bits++;
+  }
+  return bits;
+}
+
+/**
+ * Same result as #BLI_kdtree_3d_calc_duplicates_fast using index order: vertices are visited in
+ * index order and every vertex in range that wasn't handled yet is merged into the visited one
+ * (merging is a single step, no chains are created).
+ *
+ * Finding out which vertices have neighbors at all is done in parallel, so only the (usually
+ * few) vertices that are actually merged remain for the order dependent part.
+ */
+static uint weld_vert_grid_calc_duplicates(const MVert *mvert,
+                                           const uint totvert,
+                                           const BLI_bitmap *v_mask,
+                                           const uint v_mask_len,
+                                           const float merge_dist,
+                                           uint *r_vert_dest_map)
+{
+  copy_vn_i((int *)r_vert_dest_map, (int)totvert, (int)OUT_OF_CONTEXT);
+  if (v_mask_len < 2) {
+    return 0;
+  }
+
+  struct WeldVertGrid grid = {
+      .merge_dist_sq = square_f(merge_dist),
+      .len = v_mask_len,
+  };
+
+  float max[3];
+  INIT_MINMAX(grid.min, max);
+  for (uint i = 0; i < totvert; i++) {
+    if (!v_mask || BLI_BITMAP_TEST(v_mask, i)) {
+      minmax_v3v3_v3(grid.min, max, mvert[i].co);
+    }
+  }
+  float extent[3];
+  sub_v3_v3v3(extent, max, grid.min);
+  /* Cells are slightly larger than the merge distance, so rounding never puts two vertices in
+   * range more than one cell apart. */
+  float cell_size = max_ff(merge_dist * 1.001f,
+                           max_axis_v3(extent) / (float)WELD_GRID_AXIS_CELLS_MAX);
+  cell_size = max_ff(cell_size, FLT_MIN);
+  grid.cell_size_inv = 1.0f / cell_size;
+
+  uint axis_bits[3];
+  for (int i = 0; i < 3; i++) {
+    const float cells = isfinite(extent[i]) ? extent[i] * grid.cell_size_inv : FLT_MAX;
+    grid.cells_max[i] = (cells < (float)WELD_GRID_AXIS_CELLS_MAX) ? (int)cells :
+                                                                    WELD_GRID_AXIS_CELLS_MAX;
+    /* Neighbors of the last cell are included. */
+    axis_bits[i] = weld_grid_axis_bits(grid.cells_max[i] + 2);
+  }
+  grid.key_shift[1] = axis_bits[2];
+  grid.key_shift[0] = axis_bits[2] + axis_bits[1];
+
+  grid.keys = MEM_malloc_arrayN(v_mask_len, sizeof(*grid.keys), __func__);
+  grid.verts = MEM_malloc_arrayN(v_mask_len, sizeof(*grid.verts), __func__);
+  uint len = 0;
+  for (uint i = 0; i < totvert; i++) {
+    if (!v_mask || BLI_BITMAP_TEST(v_mask, i)) {
+      int cell[3];
+      weld_grid_cell_get(&grid, mvert[i].co, cell);
+      grid.keys[len] = weld_grid_key(&grid, cell[0], cell[1], cell[2]);
+      grid.verts[len] = i;
+      len++;
+    }
+  }
+  BLI_assert(len == v_mask_len);
+  weld_grid_sort(&grid, grid.key_shift[0] + axis_bits[0]);
+
+  grid.cos = MEM_malloc_arrayN(v_mask_len, sizeof(*grid.cos), __func__);
+  for (uint i = 0; i < v_mask_len; i++) {
+    copy_v3_v3(grid.cos[i], mvert[grid.verts[i]].co);
+  }
+
+  struct WeldGridNeighborData neighbor_data = {
+      .grid = &grid,
+      .has_neighbor = MEM_calloc_arrayN(totvert, sizeof(bool), __func__),
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0,
+                          (int)divide_ceil_u(v_mask_len, WELD_GRID_CHUNK_SIZE),
+                          &neighbor_data,
+                          weld_grid_has_neighbor_task_cb,
+                          &settings);
+
+  struct WeldGridMergeData merge_data = {
+      .vert_dest_map = r_vert_dest_map,
+      .found = 0,
+  };
+  for (uint i = 0; i < totvert; i++) {
+    if (!neighbor_data.has_neighbor[i]) {
+      continue;
+    }
+    if (!ELEM(r_vert_dest_map[i], OUT_OF_CONTEXT, i)) {
+      continue;
+    }
+    const uint found_prev = merge_data.found;
+    weld_grid_foreach_neighbor(&grid, i, mvert[i].co, NULL, weld_grid_merge_fn, &merge_data);
+    if (merge_data.found != found_prev) {
+      /* Prevent chains of doubles. */
+      r_vert_dest_map[i] = i;
+    }
+  }
+
+  MEM_freeN(grid.keys);
+  MEM_freeN(grid.verts);
+  MEM_freeN(grid.cos);
+  MEM_freeN(neighbor_data.has_neighbor);
+
+  return merge_data.found;
+}
+
+/** \} */
+#endif
+
 /** Use for #MOD_WELD_MODE_CONNECTED calculation. */
 struct WeldVertexCluster {
   float co[3];
@@ -1694,18 +2012,12 @@ static Mesh *weldModifier_doWeld(WeldModifierData *wmd, const ModifierEvalContex
   }
 #else
   {
-    KDTree_3d *tree = BLI_kdtree_3d_new(v_mask ? v_mask_act : totvert);
-    for (uint i = 0; i < totvert; i++) {
-      if (!v_mask || BLI_BITMAP_TEST(v_mask, i)) {
-        BLI_kdtree_3d_insert(tree, i, mvert[i].co);
-      }
-      vert_dest_map[i] = OUT_OF_CONTEXT;
-    }
-
-    BLI_kdtree_3d_balance(tree);
-    vert_kill_len = BLI_kdtree_3d_calc_duplicates_fast(
-        tree, wmd->merge_dist, false, (int *)vert_dest_map);
-    BLI_kdtree_3d_free(tree);
+    vert_kill_len = weld_vert_grid_calc_duplicates(mvert,
+                                                   totvert,
+                                                   v_mask,
+                                                   v_mask ? (uint)v_mask_act : totvert,
+                                                   wmd->merge_dist,
+                                                   vert_dest_map);
   }
 #endif
   else {
@@ -14,6 +14,8 @@
  * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+#include "BLI_task.hh"
+
 #include "BKE_material.h"
 
 #include "DNA_material_types.h"
@@ -63,15 +65,20 @@ static void do_mix_operation_float(const int blend_mode,
                                    const FloatReadAttribute &inputs_b,
                                    FloatWriteAttribute results)
 {
-  const int size = results.size();
-  for (const int i : IndexRange(size)) {
-    const float factor = factors[i];
-    float3 a{inputs_a[i]};
-    const float3 b{inputs_b[i]};
-    ramp_blend(blend_mode, a, factor, b);
-    const float result = a.x;
-    results.set(i, result);
-  }
+  Span<float> span_factors = factors.get_span();
+  Span<float> span_a = inputs_a.get_span();
+  Span<float> span_b = inputs_b.get_span();
+  MutableSpan<float> span_results = results.get_span_for_write_only();
+  parallel_for(span_results.index_range(), 4096, [&](IndexRange range) {
+    for (const int i : range) {
+      const float factor = span_factors[i];
+      float3 a{span_a[i]};
+      const float3 b{span_b[i]};
+      ramp_blend(blend_mode, a, factor, b);
+      span_results[i] = a.x;
+    }
+  });
+  results.apply_span();
 }
 
 static void do_mix_operation_float3(const int blend_mode,
@@ -80,14 +87,20 @@ static void do_mix_operation_float3(const int blend_mode,
                                     const Float3ReadAttribute &inputs_b,
                                     Float3WriteAttribute results)
 {
-  const int size = results.size();
-  for (const int i : IndexRange(size)) {
-    const float factor = factors[i];
-    float3 a = inputs_a[i];
-    const float3 b = inputs_b[i];
-    ramp_blend(blend_mode, a, factor, b);
-    results.set(i, a);
-  }
+  Span<float> span_factors = factors.get_span();
+  Span<float3> span_a = inputs_a.get_span();
+  Span<float3> span_b = inputs_b.get_span();
+  MutableSpan<float3> span_results = results.get_span_for_write_only();
+  parallel_for(span_results.index_range(), 4096, [&](IndexRange range) {
+    for (const int i : range) {
+      const float factor = span_factors[i];
+      float3 a = span_a[i];
+      const float3 b = span_b[i];
+      ramp_blend(blend_mode, a, factor, b);
+      span_results[i] = a;
+    }
+  });
+  results.apply_span();
 }
 
 static void do_mix_operation_color4f(const int blend_mode,
@@ -96,14 +109,20 @@ static void do_mix_operation_color4f(const int blend_mode,
                                      const Color4fReadAttribute &inputs_b,
                                      Color4fWriteAttribute results)
 {
-  const int size = results.size();
-  for (const int i : IndexRange(size)) {
-    const float factor = factors[i];
-    Color4f a = inputs_a[i];
-    const Color4f b = inputs_b[i];
-    ramp_blend(blend_mode, a, factor, b);
-    results.set(i, a);
-  }
+  Span<float> span_factors = factors.get_span();
+  Span<Color4f> span_a = inputs_a.get_span();
+  Span<Color4f> span_b = inputs_b.get_span();
+  MutableSpan<Color4f> span_results = results.get_span_for_write_only();
+  parallel_for(span_results.index_range(), 4096, [&](IndexRange range) {
+    for (const int i : range) {
+      const float factor = span_factors[i];
+      Color4f a = span_a[i];
+      const Color4f b = span_b[i];
+      ramp_blend(blend_mode, a, factor, b);
+      span_results[i] = a;
+    }
+  });
+  results.apply_span();
 }
 
 static void do_mix_operation(const CustomDataType result_type,
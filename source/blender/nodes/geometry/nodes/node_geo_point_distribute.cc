@@ -19,7 +19,9 @@
 #include "BLI_kdtree.h"
 #include "BLI_math_vector.h"
 #include "BLI_rand.hh"
+#include "BLI_sort.hh"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_timeit.hh"
 
 #include "DNA_mesh_types.h"
@@ -88,6 +90,40 @@ static Span<MLoopTri> get_mesh_looptris(const Mesh &mesh)
   return {looptris, looptris_len};
 }
 
+static int sample_looptri_point_amount(const Mesh &mesh,
+                                      const MLoopTri &looptri,
+                                      const float base_density,
+                                      const FloatReadAttribute *density_factors,
+                                      RandomNumberGenerator &looptri_rng)
+{
+  const int v0_loop = looptri.tri[0];
+  const int v1_loop = looptri.tri[1];
+  const int v2_loop = looptri.tri[2];
+  const float3 v0_pos = mesh.mvert[mesh.mloop[v0_loop].v].co;
+  const float3 v1_pos = mesh.mvert[mesh.mloop[v1_loop].v].co;
+  const float3 v2_pos = mesh.mvert[mesh.mloop[v2_loop].v].co;
+
+  float looptri_density_factor = 1.0f;
+  if (density_factors != nullptr) {
+    const float v0_density_factor = std::max(0.0f, (*density_factors)[v0_loop]);
+    const float v1_density_factor = std::max(0.0f, (*density_factors)[v1_loop]);
+    const float v2_density_factor = std::max(0.0f, (*density_factors)[v2_loop]);
+    looptri_density_factor = (v0_density_factor + v1_density_factor + v2_density_factor) / 3.0f;
+  }
+  const float area = area_tri_v3(v0_pos, v1_pos, v2_pos);
+
+  const float points_amount_fl = area * base_density * looptri_density_factor;
+  const float add_point_probability = fractf(points_amount_fl);
+  const bool add_point = add_point_probability > looptri_rng.get_float();
+  return (int)points_amount_fl + (int)add_point;
+}
+
+/**
+ * Every looptri has its own random number generator, so that the points on it only depend on the
+ * looptri and the seed. That allows sampling all looptris in parallel: first the amount of points
+ * per looptri is computed to know where every looptri writes its points, then the points are
+ * generated.
+ */
 static void sample_mesh_surface(const Mesh &mesh,
                                 const float base_density,
                                 const FloatReadAttribute *density_factors,
@@ -98,44 +134,47 @@ static void sample_mesh_surface(const Mesh &mesh,
 {
   Span<MLoopTri> looptris = get_mesh_looptris(mesh);
 
-  for (const int looptri_index : looptris.index_range()) {
-    const MLoopTri &looptri = looptris[looptri_index];
-    const int v0_loop = looptri.tri[0];
-    const int v1_loop = looptri.tri[1];
-    const int v2_loop = looptri.tri[2];
-    const int v0_index = mesh.mloop[v0_loop].v;
-    const int v1_index = mesh.mloop[v1_loop].v;
-    const int v2_index = mesh.mloop[v2_loop].v;
-    const float3 v0_pos = mesh.mvert[v0_index].co;
-    const float3 v1_pos = mesh.mvert[v1_index].co;
-    const float3 v2_pos = mesh.mvert[v2_index].co;
-
-    float looptri_density_factor = 1.0f;
-    if (density_factors != nullptr) {
-      const float v0_density_factor = std::max(0.0f, (*density_factors)[v0_loop]);
-      const float v1_density_factor = std::max(0.0f, (*density_factors)[v1_loop]);
-      const float v2_density_factor = std::max(0.0f, (*density_factors)[v2_loop]);
-      looptri_density_factor = (v0_density_factor + v1_density_factor + v2_density_factor) / 3.0f;
+  Array<int> point_offsets(looptris.size() + 1);
+  parallel_for(looptris.index_range(), 512, [&](IndexRange range) {
+    for (const int looptri_index : range) {
+      RandomNumberGenerator looptri_rng(BLI_hash_int(looptri_index + seed));
+      point_offsets[looptri_index] = sample_looptri_point_amount(
+          mesh, looptris[looptri_index], base_density, density_factors, looptri_rng);
     }
-    const float area = area_tri_v3(v0_pos, v1_pos, v2_pos);
-
-    const int looptri_seed = BLI_hash_int(looptri_index + seed);
-    RandomNumberGenerator looptri_rng(looptri_seed);
-
-    const float points_amount_fl = area * base_density * looptri_density_factor;
-    const float add_point_probability = fractf(points_amount_fl);
-    const bool add_point = add_point_probability > looptri_rng.get_float();
-    const int point_amount = (int)points_amount_fl + (int)add_point;
-
-    for (int i = 0; i < point_amount; i++) {
-      const float3 bary_coord = looptri_rng.get_barycentric_coordinates();
-      float3 point_pos;
-      interp_v3_v3v3v3(point_pos, v0_pos, v1_pos, v2_pos, bary_coord);
-      r_positions.append(point_pos);
-      r_bary_coords.append(bary_coord);
-      r_looptri_indices.append(looptri_index);
+  });
+  const int tot_points = parallel_prefix_sum(
+      point_offsets.as_mutable_span().drop_back(1), 4096);
+  point_offsets.last() = tot_points;
+
+  const int points_start = r_positions.size();
+  r_positions.resize(points_start + tot_points);
+  r_bary_coords.resize(points_start + tot_points);
+  r_looptri_indices.resize(points_start + tot_points);
+
+  parallel_for(looptris.index_range(), 512, [&](IndexRange range) {
+    for (const int looptri_index : range) {
+      const MLoopTri &looptri = looptris[looptri_index];
+      const float3 v0_pos = mesh.mvert[mesh.mloop[looptri.tri[0]].v].co;
+      const float3 v1_pos = mesh.mvert[mesh.mloop[looptri.tri[1]].v].co;
+      const float3 v2_pos = mesh.mvert[mesh.mloop[looptri.tri[2]].v].co;
+
+      RandomNumberGenerator looptri_rng(BLI_hash_int(looptri_index + seed));
+      /* Skip the random value that was used to compute the amount of points. */
+      looptri_rng.skip(1);
+
+      const IndexRange points_range(point_offsets[looptri_index],
+                                    point_offsets[looptri_index + 1] -
+                                        point_offsets[looptri_index]);
+      for (const int i : points_range) {
+        const float3 bary_coord = looptri_rng.get_barycentric_coordinates();
+        float3 point_pos;
+        interp_v3_v3v3v3(point_pos, v0_pos, v1_pos, v2_pos, bary_coord);
+        r_positions[points_start + i] = point_pos;
+        r_bary_coords[points_start + i] = bary_coord;
+        r_looptri_indices[points_start + i] = looptri_index;
+      }
     }
-  }
+  });
 }
 
 BLI_NOINLINE static KDTree_3d *build_kdtree(Span<float3> positions)
@@ -148,6 +187,40 @@ BLI_NOINLINE static KDTree_3d *build_kdtree(Span<float3> positions)
   return kdtree;
 }
 
+struct GridCell {
+  int x, y, z;
+
+  /* Cells with the same color are at least two cells apart. */
+  int color() const
+  {
+    return mod_i(x, 3) + mod_i(y, 3) * 3 + mod_i(z, 3) * 9;
+  }
+};
+
+struct GridPoint {
+  int color;
+  GridCell cell;
+  int index;
+
+  bool operator<(const GridPoint &other) const
+  {
+    return std::tie(color, cell.x, cell.y, cell.z, index) <
+           std::tie(other.color, other.cell.x, other.cell.y, other.cell.z, other.index);
+  }
+
+  bool is_in_same_cell(const GridPoint &other) const
+  {
+    return cell.x == other.cell.x && cell.y == other.cell.y && cell.z == other.cell.z;
+  }
+};
+
+/**
+ * The points are put into a grid whose cells are as large as the minimum distance, so a point can
+ * only eliminate points in its own or in directly neighboring cells. Cells of the same color (see
+ * #GridCell::color) never share a neighbor, so all cells of one color are processed in parallel.
+ * Within a cell the points are processed in index order, which makes the result independent of
+ * the number of threads.
+ */
 BLI_NOINLINE static void update_elimination_mask_for_close_points(
     Span<float3> positions, const float minimum_distance, MutableSpan<bool> elimination_mask)
 {
@@ -157,28 +230,73 @@ BLI_NOINLINE static void update_elimination_mask_for_close_points(
 
   KDTree_3d *kdtree = build_kdtree(positions);
 
-  for (const int i : positions.index_range()) {
-    if (elimination_mask[i]) {
-      continue;
+  Array<GridPoint> grid_points(positions.size());
+  parallel_for(positions.index_range(), 4096, [&](IndexRange range) {
+    for (const int i : range) {
+      const float3 cell_co = positions[i] / minimum_distance;
+      GridPoint &grid_point = grid_points[i];
+      grid_point.cell = {(int)floorf(cell_co.x), (int)floorf(cell_co.y), (int)floorf(cell_co.z)};
+      grid_point.color = grid_point.cell.color();
+      grid_point.index = i;
+    }
+  });
+  parallel_sort(grid_points.begin(), grid_points.end());
+
+  /* Ranges of grid points per cell, these are sorted by color. */
+  Vector<IndexRange> cell_ranges;
+  std::array<int, 28> color_offsets;
+  color_offsets.fill(-1);
+  for (int start = 0; start < grid_points.size();) {
+    int end = start + 1;
+    while (end < grid_points.size() && grid_points[end].is_in_same_cell(grid_points[start])) {
+      end++;
+    }
+    const int color = grid_points[start].color;
+    if (color_offsets[color] == -1) {
+      color_offsets[color] = cell_ranges.size();
     }
+    cell_ranges.append(IndexRange(start, end - start));
+    start = end;
+  }
+  color_offsets[27] = cell_ranges.size();
+  for (int color = 26; color >= 0; color--) {
+    if (color_offsets[color] == -1) {
+      color_offsets[color] = color_offsets[color + 1];
+    }
+  }
 
-    struct CallbackData {
-      int index;
-      MutableSpan<bool> elimination_mask;
-    } callback_data = {i, elimination_mask};
-
-    BLI_kdtree_3d_range_search_cb(
-        kdtree,
-        positions[i],
-        minimum_distance,
-        [](void *user_data, int index, const float *UNUSED(co), float UNUSED(dist_sq)) {
-          CallbackData &callback_data = *static_cast<CallbackData *>(user_data);
-          if (index != callback_data.index) {
-            callback_data.elimination_mask[index] = true;
+  struct CallbackData {
+    int index;
+    MutableSpan<bool> elimination_mask;
+  };
+
+  for (const int color : IndexRange(27)) {
+    const IndexRange color_cells(color_offsets[color],
+                                 color_offsets[color + 1] - color_offsets[color]);
+    parallel_for(color_cells, 16, [&](IndexRange range) {
+      for (const int cell_index : range) {
+        for (const GridPoint &grid_point : grid_points.as_span().slice(cell_ranges[cell_index])) {
+          const int i = grid_point.index;
+          if (elimination_mask[i]) {
+            continue;
           }
-          return true;
-        },
-        &callback_data);
+
+          CallbackData callback_data = {i, elimination_mask};
+          BLI_kdtree_3d_range_search_cb(
+              kdtree,
+              positions[i],
+              minimum_distance,
+              [](void *user_data, int index, const float *UNUSED(co), float UNUSED(dist_sq)) {
+                CallbackData &callback_data = *static_cast<CallbackData *>(user_data);
+                if (index != callback_data.index) {
+                  callback_data.elimination_mask[index] = true;
+                }
+                return true;
+              },
+              &callback_data);
+        }
+      }
+    });
   }
   BLI_kdtree_3d_free(kdtree);
 }
@@ -191,30 +309,33 @@ BLI_NOINLINE static void update_elimination_mask_based_on_density_factors(
     MutableSpan<bool> elimination_mask)
 {
   Span<MLoopTri> looptris = get_mesh_looptris(mesh);
-  for (const int i : bary_coords.index_range()) {
-    if (elimination_mask[i]) {
-      continue;
-    }
+  parallel_for(bary_coords.index_range(), 4096, [&](IndexRange range) {
+    for (const int i : range) {
+      if (elimination_mask[i]) {
+        continue;
+      }
 
-    const MLoopTri &looptri = looptris[looptri_indices[i]];
-    const float3 bary_coord = bary_coords[i];
+      const MLoopTri &looptri = looptris[looptri_indices[i]];
+      const float3 bary_coord = bary_coords[i];
 
-    const int v0_loop = looptri.tri[0];
-    const int v1_loop = looptri.tri[1];
-    const int v2_loop = looptri.tri[2];
+      const int v0_loop = looptri.tri[0];
+      const int v1_loop = looptri.tri[1];
+      const int v2_loop = looptri.tri[2];
 
-    const float v0_density_factor = std::max(0.0f, density_factors[v0_loop]);
-    const float v1_density_factor = std::max(0.0f, density_factors[v1_loop]);
-    const float v2_density_factor = std::max(0.0f, density_factors[v2_loop]);
+      const float v0_density_factor = std::max(0.0f, density_factors[v0_loop]);
+      const float v1_density_factor = std::max(0.0f, density_factors[v1_loop]);
+      const float v2_density_factor = std::max(0.0f, density_factors[v2_loop]);
 
-    const float probablity = v0_density_factor * bary_coord.x + v1_density_factor * bary_coord.y +
-                             v2_density_factor * bary_coord.z;
+      const float probablity = v0_density_factor * bary_coord.x +
+                               v1_density_factor * bary_coord.y +
+                               v2_density_factor * bary_coord.z;
 
-    const float hash = BLI_hash_int_01(bary_coord.hash());
-    if (hash > probablity) {
-      elimination_mask[i] = true;
+      const float hash = BLI_hash_int_01(bary_coord.hash());
+      if (hash > probablity) {
+        elimination_mask[i] = true;
+      }
     }
-  }
+  });
 }
 
 BLI_NOINLINE static void eliminate_points_based_on_mask(Span<bool> elimination_mask,
@@ -241,22 +362,24 @@ BLI_NOINLINE static void interpolate_attribute_point(const Mesh &mesh,
   BLI_assert(data_in.size() == mesh.totvert);
   Span<MLoopTri> looptris = get_mesh_looptris(mesh);
 
-  for (const int i : bary_coords.index_range()) {
-    const int looptri_index = looptri_indices[i];
-    const MLoopTri &looptri = looptris[looptri_index];
-    const float3 &bary_coord = bary_coords[i];
+  parallel_for(bary_coords.index_range(), 4096, [&](IndexRange range) {
+    for (const int i : range) {
+      const int looptri_index = looptri_indices[i];
+      const MLoopTri &looptri = looptris[looptri_index];
+      const float3 &bary_coord = bary_coords[i];
 
-    const int v0_index = mesh.mloop[looptri.tri[0]].v;
-    const int v1_index = mesh.mloop[looptri.tri[1]].v;
-    const int v2_index = mesh.mloop[looptri.tri[2]].v;
+      const int v0_index = mesh.mloop[looptri.tri[0]].v;
+      const int v1_index = mesh.mloop[looptri.tri[1]].v;
+      const int v2_index = mesh.mloop[looptri.tri[2]].v;
 
-    const T &v0 = data_in[v0_index];
-    const T &v1 = data_in[v1_index];
-    const T &v2 = data_in[v2_index];
+      const T &v0 = data_in[v0_index];
+      const T &v1 = data_in[v1_index];
+      const T &v2 = data_in[v2_index];
 
-    const T interpolated_value = attribute_math::mix3(bary_coord, v0, v1, v2);
-    data_out[i] = interpolated_value;
-  }
+      const T interpolated_value = attribute_math::mix3(bary_coord, v0, v1, v2);
+      data_out[i] = interpolated_value;
+    }
+  });
 }
 
 template<typename T>
@@ -269,22 +392,24 @@ BLI_NOINLINE static void interpolate_attribute_corner(const Mesh &mesh,
   BLI_assert(data_in.size() == mesh.totloop);
   Span<MLoopTri> looptris = get_mesh_looptris(mesh);
 
-  for (const int i : bary_coords.index_range()) {
-    const int looptri_index = looptri_indices[i];
-    const MLoopTri &looptri = looptris[looptri_index];
-    const float3 &bary_coord = bary_coords[i];
+  parallel_for(bary_coords.index_range(), 4096, [&](IndexRange range) {
+    for (const int i : range) {
+      const int looptri_index = looptri_indices[i];
+      const MLoopTri &looptri = looptris[looptri_index];
+      const float3 &bary_coord = bary_coords[i];
 
-    const int loop_index_0 = looptri.tri[0];
-    const int loop_index_1 = looptri.tri[1];
-    const int loop_index_2 = looptri.tri[2];
+      const int loop_index_0 = looptri.tri[0];
+      const int loop_index_1 = looptri.tri[1];
+      const int loop_index_2 = looptri.tri[2];
 
-    const T &v0 = data_in[loop_index_0];
-    const T &v1 = data_in[loop_index_1];
-    const T &v2 = data_in[loop_index_2];
+      const T &v0 = data_in[loop_index_0];
+      const T &v1 = data_in[loop_index_1];
+      const T &v2 = data_in[loop_index_2];
 
-    const T interpolated_value = attribute_math::mix3(bary_coord, v0, v1, v2);
-    data_out[i] = interpolated_value;
-  }
+      const T interpolated_value = attribute_math::mix3(bary_coord, v0, v1, v2);
+      data_out[i] = interpolated_value;
+    }
+  });
 }
 
 BLI_NOINLINE static void interpolate_attribute(const Mesh &mesh,
@@ -367,22 +492,24 @@ BLI_NOINLINE static void compute_special_attributes(const Mesh &mesh,
   MutableSpan<float3> rotations = rotation_attribute->get_span_for_write_only<float3>();
 
   Span<MLoopTri> looptris = get_mesh_looptris(mesh);
-  for (const int i : bary_coords.index_range()) {
-    const int looptri_index = looptri_indices[i];
-    const MLoopTri &looptri = looptris[looptri_index];
-    const float3 &bary_coord = bary_coords[i];
-
-    const int v0_index = mesh.mloop[looptri.tri[0]].v;
-    const int v1_index = mesh.mloop[looptri.tri[1]].v;
-    const int v2_index = mesh.mloop[looptri.tri[2]].v;
-    const float3 v0_pos = mesh.mvert[v0_index].co;
-    const float3 v1_pos = mesh.mvert[v1_index].co;
-    const float3 v2_pos = mesh.mvert[v2_index].co;
-
-    ids[i] = (int)(bary_coord.hash() + (uint64_t)looptri_index);
-    normal_tri_v3(normals[i], v0_pos, v1_pos, v2_pos);
-    rotations[i] = normal_to_euler_rotation(normals[i]);
-  }
+  parallel_for(bary_coords.index_range(), 4096, [&](IndexRange range) {
+    for (const int i : range) {
+      const int looptri_index = looptri_indices[i];
+      const MLoopTri &looptri = looptris[looptri_index];
+      const float3 &bary_coord = bary_coords[i];
+
+      const int v0_index = mesh.mloop[looptri.tri[0]].v;
+      const int v1_index = mesh.mloop[looptri.tri[1]].v;
+      const int v2_index = mesh.mloop[looptri.tri[2]].v;
+      const float3 v0_pos = mesh.mvert[v0_index].co;
+      const float3 v1_pos = mesh.mvert[v1_index].co;
+      const float3 v2_pos = mesh.mvert[v2_index].co;
+
+      ids[i] = (int)(bary_coord.hash() + (uint64_t)looptri_index);
+      normal_tri_v3(normals[i], v0_pos, v1_pos, v2_pos);
+      rotations[i] = normal_to_euler_rotation(normals[i]);
+    }
+  });
 
   id_attribute.apply_span_and_save();
   normal_attribute.apply_span_and_save();
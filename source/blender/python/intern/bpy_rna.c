@@ -5241,6 +5241,41 @@ static bool foreach_compat_buffer(RawPropertyType raw_type, int attr_signed, con
   return 0;
 }
 
+/**
+ * Raw type of a buffer that doesn't match the attribute type,
+ * so RNA can convert the values directly instead of going through Python objects.
+ */
+static RawPropertyType foreach_buffer_raw_type(const Py_buffer *buf, int tot)
+{
+  const char f = buf->format ? *buf->format : 'B';
+  RawPropertyType raw_type;
+
+  switch (f) {
+    case 'h':
+      raw_type = PROP_RAW_SHORT;
+      break;
+    case 'i':
+      raw_type = PROP_RAW_INT;
+      break;
+    case '?':
+      raw_type = PROP_RAW_BOOLEAN;
+      break;
+    case 'f':
+      raw_type = PROP_RAW_FLOAT;
+      break;
+    case 'd':
+      raw_type = PROP_RAW_DOUBLE;
+      break;
+    default:
+      return PROP_RAW_UNSET;
+  }
+
+  if (buf->len != (Py_ssize_t)tot * RNA_raw_type_sizeof(raw_type)) {
+    return PROP_RAW_UNSET;
+  }
+  return raw_type;
+}
+
 static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
 {
   PyObject *item = NULL;
@@ -5268,18 +5303,31 @@ static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
     buffer_is_compat = false;
     if (PyObject_CheckBuffer(seq)) {
       Py_buffer buf;
-      PyObject_GetBuffer(seq, &buf, PyBUF_SIMPLE | PyBUF_FORMAT);
+      if (PyObject_GetBuffer(seq, &buf, PyBUF_SIMPLE | PyBUF_FORMAT) == -1) {
+        /* Non-contiguous buffer, use it as a sequence. */
+        PyErr_Clear();
+      }
+      else {
+        /* Check if the buffer matches. */
 
-      /* Check if the buffer matches. */
+        buffer_is_compat = foreach_compat_buffer(raw_type, attr_signed, buf.format);
 
-      buffer_is_compat = foreach_compat_buffer(raw_type, attr_signed, buf.format);
+        if (buffer_is_compat) {
+          ok = RNA_property_collection_raw_set(
+              NULL, &self->ptr, self->prop, attr, buf.buf, raw_type, tot);
+        }
+        else {
+          /* Let RNA convert from the buffer type. */
+          const RawPropertyType buf_raw_type = foreach_buffer_raw_type(&buf, tot);
+          if (buf_raw_type != PROP_RAW_UNSET) {
+            ok = RNA_property_collection_raw_set(
+                NULL, &self->ptr, self->prop, attr, buf.buf, buf_raw_type, tot);
+            buffer_is_compat = true;
+          }
+        }
 
-      if (buffer_is_compat) {
-        ok = RNA_property_collection_raw_set(
-            NULL, &self->ptr, self->prop, attr, buf.buf, raw_type, tot);
+        PyBuffer_Release(&buf);
       }
-
-      PyBuffer_Release(&buf);
     }
 
     /* Could not use the buffer, fallback to sequence. */
@@ -5324,18 +5372,31 @@ static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
     buffer_is_compat = false;
     if (PyObject_CheckBuffer(seq)) {
       Py_buffer buf;
-      PyObject_GetBuffer(seq, &buf, PyBUF_SIMPLE | PyBUF_FORMAT);
+      if (PyObject_GetBuffer(seq, &buf, PyBUF_SIMPLE | PyBUF_FORMAT) == -1) {
+        /* Non-contiguous buffer, use it as a sequence. */
+        PyErr_Clear();
+      }
+      else {
+        /* Check if the buffer matches, TODO - signed/unsigned types. */
 
-      /* Check if the buffer matches, TODO - signed/unsigned types. */
+        buffer_is_compat = foreach_compat_buffer(raw_type, attr_signed, buf.format);
 
-      buffer_is_compat = foreach_compat_buffer(raw_type, attr_signed, buf.format);
+        if (buffer_is_compat) {
+          ok = RNA_property_collection_raw_get(
+              NULL, &self->ptr, self->prop, attr, buf.buf, raw_type, tot);
+        }
+        else if (!buf.readonly) {
+          /* Let RNA convert to the buffer type. */
+          const RawPropertyType buf_raw_type = foreach_buffer_raw_type(&buf, tot);
+          if (buf_raw_type != PROP_RAW_UNSET) {
+            ok = RNA_property_collection_raw_get(
+                NULL, &self->ptr, self->prop, attr, buf.buf, buf_raw_type, tot);
+            buffer_is_compat = true;
+          }
+        }
 
-      if (buffer_is_compat) {
-        ok = RNA_property_collection_raw_get(
-            NULL, &self->ptr, self->prop, attr, buf.buf, raw_type, tot);
+        PyBuffer_Release(&buf);
       }
-
-      PyBuffer_Release(&buf);
     }
 
     /* Could not use the buffer, fallback to sequence. */
@@ -6318,7 +6379,15 @@ static PyObject *pyrna_func_call(BPy_FunctionRNA *self, PyObject *args, PyObject
     bContext *C = BPY_context_get();
 
     BKE_reports_init(&reports, RPT_STORE);
-    RNA_function_call(C, &reports, self_ptr, self_func, &parms);
+    if (RNA_function_flag(self_func) & FUNC_ALLOW_THREADS) {
+      /* Let other Python threads run while the function is busy. */
+      Py_BEGIN_ALLOW_THREADS;
+      RNA_function_call(C, &reports, self_ptr, self_func, &parms);
+      Py_END_ALLOW_THREADS;
+    }
+    else {
+      RNA_function_call(C, &reports, self_ptr, self_func, &parms);
+    }
 
     err = (BPy_reports_to_error(&reports, PyExc_RuntimeError, true));
 
@@ -65,7 +65,9 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_alloca.h"
 #include "BLI_math.h"
+#include "BLI_task.h"
 
 #include "DNA_mesh_types.h"
 #include "DNA_meshdata_types.h"
@@ -333,8 +335,8 @@ static bool cast_ray_highpoly(BVHTreeFromMesh *treeData,
     hit_distance = FLT_MAX;
   }
 
-  BVHTreeRayHit *hits;
-  hits = MEM_mallocN(sizeof(BVHTreeRayHit) * tot_highpoly, "Bake Highpoly to Lowpoly: BVH Rays");
+  /* Called for every pixel from multiple threads, avoid allocating. */
+  BVHTreeRayHit *hits = BLI_array_alloca(hits, tot_highpoly);
 
   for (i = 0; i < tot_highpoly; i++) {
     float co_high[3], dir_high[3];
@@ -439,7 +441,6 @@ static bool cast_ray_highpoly(BVHTreeFromMesh *treeData,
     pixel_array[pixel_id].seed = 0;
   }
 
-  MEM_freeN(hits);
   return hit_mesh != -1;
 }
 
@@ -520,6 +521,101 @@ static TriTessFace *mesh_calc_tri_tessface(Mesh *me, bool tangent, Mesh *me_eval
   return triangles;
 }
 
+typedef struct BakeHighPolyRayCastData {
+  BakePixel *pixel_array_from;
+  BakePixel *pixel_array_to;
+  BakeHighPolyData *highpoly;
+  int tot_highpoly;
+  bool is_custom_cage;
+  bool is_cage;
+  float cage_extrusion;
+  float max_ray_distance;
+  const float (*mat_low)[4];
+  const float (*mat_cage)[4];
+  const float (*imat_low)[4];
+  TriTessFace *tris_low;
+  TriTessFace *tris_cage;
+  TriTessFace **tris_high;
+  BVHTreeFromMesh *treeData;
+} BakeHighPolyRayCastData;
+
+static void bake_highpoly_ray_cast_task_cb(void *__restrict userdata,
+                                           const int i,
+                                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const BakeHighPolyRayCastData *data = userdata;
+  float co[3];
+  float dir[3];
+  TriTessFace *tri_low;
+
+  const int primitive_id = data->pixel_array_from[i].primitive_id;
+
+  if (primitive_id == -1) {
+    data->pixel_array_to[i].primitive_id = -1;
+    return;
+  }
+
+  const float u = data->pixel_array_from[i].uv[0];
+  const float v = data->pixel_array_from[i].uv[1];
+
+  /* calculate from low poly mesh cage */
+  if (data->is_custom_cage) {
+    calc_point_from_barycentric_cage(data->tris_low,
+                                     data->tris_cage,
+                                     data->mat_low,
+                                     data->mat_cage,
+                                     primitive_id,
+                                     u,
+                                     v,
+                                     co,
+                                     dir);
+    tri_low = &data->tris_cage[primitive_id];
+  }
+  else if (data->is_cage) {
+    calc_point_from_barycentric_extrusion(data->tris_cage,
+                                          data->mat_low,
+                                          data->imat_low,
+                                          primitive_id,
+                                          u,
+                                          v,
+                                          data->cage_extrusion,
+                                          co,
+                                          dir,
+                                          true);
+    tri_low = &data->tris_cage[primitive_id];
+  }
+  else {
+    calc_point_from_barycentric_extrusion(data->tris_low,
+                                          data->mat_low,
+                                          data->imat_low,
+                                          primitive_id,
+                                          u,
+                                          v,
+                                          data->cage_extrusion,
+                                          co,
+                                          dir,
+                                          false);
+    tri_low = &data->tris_low[primitive_id];
+  }
+
+  /* cast ray */
+  if (!cast_ray_highpoly(data->treeData,
+                         tri_low,
+                         data->tris_high,
+                         data->pixel_array_from,
+                         data->pixel_array_to,
+                         data->mat_low,
+                         data->highpoly,
+                         co,
+                         dir,
+                         i,
+                         data->tot_highpoly,
+                         data->max_ray_distance)) {
+    /* if it fails mask out the original pixel array */
+    data->pixel_array_from[i].primitive_id = -1;
+  }
+}
+
 bool RE_bake_pixels_populate_from_objects(struct Mesh *me_low,
                                           BakePixel pixel_array_from[],
                                           BakePixel pixel_array_to[],
@@ -534,8 +630,6 @@ bool RE_bake_pixels_populate_from_objects(struct Mesh *me_low,
                                           struct Mesh *me_cage)
 {
   size_t i;
-  int primitive_id;
-  float u, v;
   float imat_low[4][4];
   bool is_cage = me_cage != NULL;
   bool result = true;
@@ -589,54 +683,30 @@ bool RE_bake_pixels_populate_from_objects(struct Mesh *me_low,
     }
   }
 
-  for (i = 0; i < num_pixels; i++) {
-    float co[3];
-    float dir[3];
-    TriTessFace *tri_low;
-
-    primitive_id = pixel_array_from[i].primitive_id;
-
-    if (primitive_id == -1) {
-      pixel_array_to[i].primitive_id = -1;
-      continue;
-    }
-
-    u = pixel_array_from[i].uv[0];
-    v = pixel_array_from[i].uv[1];
-
-    /* calculate from low poly mesh cage */
-    if (is_custom_cage) {
-      calc_point_from_barycentric_cage(
-          tris_low, tris_cage, mat_low, mat_cage, primitive_id, u, v, co, dir);
-      tri_low = &tris_cage[primitive_id];
-    }
-    else if (is_cage) {
-      calc_point_from_barycentric_extrusion(
-          tris_cage, mat_low, imat_low, primitive_id, u, v, cage_extrusion, co, dir, true);
-      tri_low = &tris_cage[primitive_id];
-    }
-    else {
-      calc_point_from_barycentric_extrusion(
-          tris_low, mat_low, imat_low, primitive_id, u, v, cage_extrusion, co, dir, false);
-      tri_low = &tris_low[primitive_id];
-    }
-
-    /* cast ray */
-    if (!cast_ray_highpoly(treeData,
-                           tri_low,
-                           tris_high,
-                           pixel_array_from,
-                           pixel_array_to,
-                           mat_low,
-                           highpoly,
-                           co,
-                           dir,
-                           i,
-                           tot_highpoly,
-                           max_ray_distance)) {
-      /* if it fails mask out the original pixel array */
-      pixel_array_from[i].primitive_id = -1;
-    }
+  {
+    BakeHighPolyRayCastData data = {
+        .pixel_array_from = pixel_array_from,
+        .pixel_array_to = pixel_array_to,
+        .highpoly = highpoly,
+        .tot_highpoly = tot_highpoly,
+        .is_custom_cage = is_custom_cage,
+        .is_cage = is_cage,
+        .cage_extrusion = cage_extrusion,
+        .max_ray_distance = max_ray_distance,
+        .mat_low = mat_low,
+        .mat_cage = mat_cage,
+        .imat_low = imat_low,
+        .tris_low = tris_low,
+        .tris_cage = tris_cage,
+        .tris_high = tris_high,
+        .treeData = treeData,
+    };
+
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    /* Rays of neighboring pixels are coherent, keep them on the same thread. */
+    settings.min_iter_per_thread = 1024;
+    BLI_task_parallel_range(0, (int)num_pixels, &data, bake_highpoly_ray_cast_task_cb, &settings);
   }
 
   /* garbage collection */
@@ -820,126 +890,152 @@ static void normal_compress(float out[3],
   }
 }
 
-/**
- * This function converts an object space normal map
- * to a tangent space normal map for a given low poly mesh.
- */
-void RE_bake_normal_world_to_tangent(const BakePixel pixel_array[],
-                                     const size_t num_pixels,
-                                     const int depth,
-                                     float result[],
-                                     Mesh *me,
-                                     const eBakeNormalSwizzle normal_swizzle[3],
-                                     float mat[4][4])
-{
-  size_t i;
-
+typedef struct BakeNormalToTangentData {
+  const BakePixel *pixel_array;
+  int depth;
+  float *result;
   TriTessFace *triangles;
+  const eBakeNormalSwizzle *normal_swizzle;
+  float (*mat)[4];
+} BakeNormalToTangentData;
 
-  Mesh *me_eval = BKE_mesh_copy_for_eval(me, false);
+static void bake_normal_world_to_tangent_task_cb(void *__restrict userdata,
+                                                 const int i,
+                                                 const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const BakeNormalToTangentData *data = userdata;
+  TriTessFace *triangle;
+  float tangents[3][3];
+  float normals[3][3];
+  float signs[3];
+  int j;
 
-  triangles = mesh_calc_tri_tessface(me, true, me_eval);
+  float tangent[3];
+  float normal[3];
+  float binormal[3];
+  float sign;
+  float u, v, w;
 
-  BLI_assert(num_pixels >= 3);
+  float tsm[3][3]; /* tangent space matrix */
+  float itsm[3][3];
 
-  for (i = 0; i < num_pixels; i++) {
-    TriTessFace *triangle;
-    float tangents[3][3];
-    float normals[3][3];
-    float signs[3];
-    int j;
-
-    float tangent[3];
-    float normal[3];
-    float binormal[3];
-    float sign;
-    float u, v, w;
+  size_t offset;
+  float nor[3]; /* texture normal */
 
-    float tsm[3][3]; /* tangent space matrix */
-    float itsm[3][3];
+  bool is_smooth;
 
-    size_t offset;
-    float nor[3]; /* texture normal */
+  const int primitive_id = data->pixel_array[i].primitive_id;
 
-    bool is_smooth;
+  offset = (size_t)i * data->depth;
 
-    int primitive_id = pixel_array[i].primitive_id;
+  if (primitive_id == -1) {
+    if (data->depth == 4) {
+      copy_v4_fl4(&data->result[offset], 0.5f, 0.5f, 1.0f, 1.0f);
+    }
+    else {
+      copy_v3_fl3(&data->result[offset], 0.5f, 0.5f, 1.0f);
+    }
+    return;
+  }
 
-    offset = i * depth;
+  triangle = &data->triangles[primitive_id];
+  is_smooth = triangle->is_smooth;
+
+  for (j = 0; j < 3; j++) {
+    const TSpace *ts;
 
-    if (primitive_id == -1) {
-      if (depth == 4) {
-        copy_v4_fl4(&result[offset], 0.5f, 0.5f, 1.0f, 1.0f);
+    if (is_smooth) {
+      if (triangle->loop_normal[j]) {
+        copy_v3_v3(normals[j], triangle->loop_normal[j]);
       }
       else {
-        copy_v3_fl3(&result[offset], 0.5f, 0.5f, 1.0f);
+        normal_short_to_float_v3(normals[j], triangle->mverts[j]->no);
       }
-      continue;
     }
 
-    triangle = &triangles[primitive_id];
-    is_smooth = triangle->is_smooth;
+    ts = triangle->tspace[j];
+    copy_v3_v3(tangents[j], ts->tangent);
+    signs[j] = ts->sign;
+  }
 
-    for (j = 0; j < 3; j++) {
-      const TSpace *ts;
+  u = data->pixel_array[i].uv[0];
+  v = data->pixel_array[i].uv[1];
+  w = 1.0f - u - v;
 
-      if (is_smooth) {
-        if (triangle->loop_normal[j]) {
-          copy_v3_v3(normals[j], triangle->loop_normal[j]);
-        }
-        else {
-          normal_short_to_float_v3(normals[j], triangle->mverts[j]->no);
-        }
-      }
+  /* normal */
+  if (is_smooth) {
+    interp_barycentric_tri_v3(normals, u, v, normal);
+  }
+  else {
+    copy_v3_v3(normal, triangle->normal);
+  }
 
-      ts = triangle->tspace[j];
-      copy_v3_v3(tangents[j], ts->tangent);
-      signs[j] = ts->sign;
-    }
+  /* tangent */
+  interp_barycentric_tri_v3(tangents, u, v, tangent);
 
-    u = pixel_array[i].uv[0];
-    v = pixel_array[i].uv[1];
-    w = 1.0f - u - v;
+  /* sign */
+  /* The sign is the same at all face vertices for any non degenerate face.
+   * Just in case we clamp the interpolated value though. */
+  sign = (signs[0] * u + signs[1] * v + signs[2] * w) < 0 ? (-1.0f) : 1.0f;
 
-    /* normal */
-    if (is_smooth) {
-      interp_barycentric_tri_v3(normals, u, v, normal);
-    }
-    else {
-      copy_v3_v3(normal, triangle->normal);
-    }
+  /* binormal */
+  /* B = sign * cross(N, T)  */
+  cross_v3_v3v3(binormal, normal, tangent);
+  mul_v3_fl(binormal, sign);
 
-    /* tangent */
-    interp_barycentric_tri_v3(tangents, u, v, tangent);
+  /* populate tangent space matrix */
+  copy_v3_v3(tsm[0], tangent);
+  copy_v3_v3(tsm[1], binormal);
+  copy_v3_v3(tsm[2], normal);
 
-    /* sign */
-    /* The sign is the same at all face vertices for any non degenerate face.
-     * Just in case we clamp the interpolated value though. */
-    sign = (signs[0] * u + signs[1] * v + signs[2] * w) < 0 ? (-1.0f) : 1.0f;
+  /* texture values */
+  normal_uncompress(nor, &data->result[offset]);
 
-    /* binormal */
-    /* B = sign * cross(N, T)  */
-    cross_v3_v3v3(binormal, normal, tangent);
-    mul_v3_fl(binormal, sign);
+  /* converts from world space to local space */
+  mul_transposed_mat3_m4_v3(data->mat, nor);
 
-    /* populate tangent space matrix */
-    copy_v3_v3(tsm[0], tangent);
-    copy_v3_v3(tsm[1], binormal);
-    copy_v3_v3(tsm[2], normal);
+  invert_m3_m3(itsm, tsm);
+  mul_m3_v3(itsm, nor);
+  normalize_v3(nor);
 
-    /* texture values */
-    normal_uncompress(nor, &result[offset]);
+  /* save back the values */
+  normal_compress(&data->result[offset], nor, data->normal_swizzle);
+}
 
-    /* converts from world space to local space */
-    mul_transposed_mat3_m4_v3(mat, nor);
+/**
+ * This function converts an object space normal map
+ * to a tangent space normal map for a given low poly mesh.
+ */
+void RE_bake_normal_world_to_tangent(const BakePixel pixel_array[],
+                                     const size_t num_pixels,
+                                     const int depth,
+                                     float result[],
+                                     Mesh *me,
+                                     const eBakeNormalSwizzle normal_swizzle[3],
+                                     float mat[4][4])
+{
+  TriTessFace *triangles;
 
-    invert_m3_m3(itsm, tsm);
-    mul_m3_v3(itsm, nor);
-    normalize_v3(nor);
+  Mesh *me_eval = BKE_mesh_copy_for_eval(me, false);
 
-    /* save back the values */
-    normal_compress(&result[offset], nor, normal_swizzle);
-  }
+  triangles = mesh_calc_tri_tessface(me, true, me_eval);
+
+  BLI_assert(num_pixels >= 3);
+
+  BakeNormalToTangentData data = {
+      .pixel_array = pixel_array,
+      .depth = depth,
+      .result = result,
+      .triangles = triangles,
+      .normal_swizzle = normal_swizzle,
+      .mat = mat,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+  BLI_task_parallel_range(
+      0, (int)num_pixels, &data, bake_normal_world_to_tangent_task_cb, &settings);
 
   /* garbage collection */
   MEM_freeN(triangles);
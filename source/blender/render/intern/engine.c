@@ -383,6 +383,11 @@ void RE_engine_end_result(
   }
 
   if (!cancel || merge_results) {
+    /* Results covering the entire frame take over the pass buffers of the render result instead
+     * of copying them, after drawing (which reads from the engine result). Not for previews,
+     * their display update only tags the render result to be read later. */
+    bool merge_exchange = false;
+
     if (re->result->do_exr_tile) {
       if (!cancel && merge_results) {
         render_result_exr_file_merge(re->result, result, re->viewname);
@@ -390,7 +395,13 @@ void RE_engine_end_result(
       }
     }
     else if (!(re->test_break(re->tbh) && (re->r.scemode & R_BUTS_PREVIEW))) {
-      render_result_merge(re->result, result);
+      if ((re->r.scemode & R_BUTS_PREVIEW) == 0 && result->rectx == re->result->rectx &&
+          result->recty == re->result->recty) {
+        merge_exchange = true;
+      }
+      else {
+        render_result_merge(re->result, result);
+      }
     }
 
     /* draw */
@@ -398,6 +409,12 @@ void RE_engine_end_result(
       result->renlay = result->layers.first; /* weak, draws first layer always */
       re->display_update(re->duh, result, NULL);
     }
+
+    if (merge_exchange) {
+      BLI_rw_mutex_lock(&re->resultmutex, THREAD_LOCK_WRITE);
+      render_result_merge_exchange(re->result, result);
+      BLI_rw_mutex_unlock(&re->resultmutex);
+    }
   }
 
   /* free */
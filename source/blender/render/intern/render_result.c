@@ -867,6 +867,39 @@ void render_result_merge(RenderResult *rr, RenderResult *rrpart)
   }
 }
 
+/**
+ * Same as #render_result_merge, but when \a rrpart covers the entire \a rr, the buffers of the
+ * passes are exchanged instead of copied. The old buffers of \a rr are freed together with
+ * \a rrpart, so it can't be used after this and readers of \a rr must be locked out.
+ */
+void render_result_merge_exchange(RenderResult *rr, RenderResult *rrpart)
+{
+  if (rrpart->rectx != rr->rectx || rrpart->recty != rr->recty) {
+    render_result_merge(rr, rrpart);
+    return;
+  }
+
+  LISTBASE_FOREACH (RenderLayer *, rl, &rr->layers) {
+    RenderLayer *rlp = RE_GetRenderLayer(rrpart, rl->name);
+    if (rlp == NULL) {
+      continue;
+    }
+    /* Passes are allocated in sync, see #render_result_merge. */
+    RenderPass *rpassp = rlp->passes.first;
+    for (RenderPass *rpass = rl->passes.first; rpass && rpassp; rpass = rpass->next) {
+      if (rpass->rect == NULL || rpassp->rect == NULL) {
+        continue;
+      }
+      if (!STREQ(rpassp->fullname, rpass->fullname)) {
+        continue;
+      }
+      BLI_assert(rpass->channels == rpassp->channels);
+      SWAP(float *, rpass->rect, rpassp->rect);
+      rpassp = rpassp->next;
+    }
+  }
+}
+
 /* Called from the UI and render pipeline, to save multilayer and multiview
  * images, optionally isolating a specific, view, layer or RGBA/Z pass. */
 bool RE_WriteRenderResult(ReportList *reports,
@@ -64,6 +64,7 @@ void render_result_views_new(struct RenderResult *rr, const struct RenderData *r
 /* Merge */
 
 void render_result_merge(struct RenderResult *rr, struct RenderResult *rrpart);
+void render_result_merge_exchange(struct RenderResult *rr, struct RenderResult *rrpart);
 
 /* Add Passes */
 
@@ -89,6 +89,8 @@ typedef struct PrefetchJob {
   bool running;
   bool waiting;
   bool stop;
+  /* Stopped to update the scene, the evaluated copy must be rebuilt before prefetching again. */
+  bool need_scene_update;
 } PrefetchJob;
 
 static bool seq_prefetch_is_playing(Main *bmain)
@@ -279,6 +281,7 @@ void SEQ_prefetch_stop(Scene *scene)
   }
 
   pfjob->stop = true;
+  pfjob->need_scene_update = true;
 
   while (pfjob->running) {
     BLI_condition_notify_one(&pfjob->prefetch_suspend_cond);
@@ -423,6 +426,27 @@ static bool seq_prefetch_do_skip_frame(PrefetchJob *pfjob, ListBase *seqbase)
   return false;
 }
 
+/* Frames still in the cache since the last prefetching are skipped without evaluating the scene,
+ * after an edit only the invalidated frames are rendered again. */
+static bool seq_prefetch_is_frame_cached(PrefetchJob *pfjob, ListBase *seqbase)
+{
+  float cfra = seq_prefetch_cfra(pfjob);
+  Sequence *seq_arr[MAXSEQ + 1];
+  int count = seq_get_shown_sequences(seqbase, cfra, 0, seq_arr);
+
+  if (count == 0) {
+    return true;
+  }
+
+  ImBuf *ibuf = seq_cache_get(
+      &pfjob->context, seq_arr[count - 1], cfra, SEQ_CACHE_STORE_FINAL_OUT);
+  if (ibuf == NULL) {
+    return false;
+  }
+  IMB_freeImBuf(ibuf);
+  return true;
+}
+
 static bool seq_prefetch_need_suspend(PrefetchJob *pfjob)
 {
   return seq_prefetch_is_cache_full(pfjob->scene) || seq_prefetch_is_scrubbing(pfjob->bmain) ||
@@ -447,6 +471,15 @@ static void *seq_prefetch_frames(void *job)
   PrefetchJob *pfjob = (PrefetchJob *)job;
 
   while (seq_prefetch_cfra(pfjob) <= pfjob->scene->r.efra) {
+    ListBase *seqbase = SEQ_active_seqbase_get(SEQ_editing_get(pfjob->scene, false));
+    if (seq_prefetch_is_frame_cached(pfjob, seqbase)) {
+      if (pfjob->stop) {
+        break;
+      }
+      pfjob->num_frames_prefetched++;
+      continue;
+    }
+
     pfjob->scene_eval->ed->prefetch_job = NULL;
 
     seq_prefetch_update_depsgraph(pfjob);
@@ -463,7 +496,6 @@ static void *seq_prefetch_frames(void *job)
      */
     pfjob->scene_eval->ed->prefetch_job = pfjob;
 
-    ListBase *seqbase = SEQ_active_seqbase_get(SEQ_editing_get(pfjob->scene, false));
     if (seq_prefetch_do_skip_frame(pfjob, seqbase)) {
       pfjob->num_frames_prefetched++;
       continue;
@@ -524,7 +556,11 @@ static PrefetchJob *seq_prefetch_start_ex(const SeqRenderData *context, float cf
   pfjob->stop = false;
   pfjob->running = true;
 
-  seq_prefetch_update_scene(context->scene);
+  /* Rebuilding the evaluated scene is expensive, only do it when the scene changed. */
+  if (pfjob->need_scene_update) {
+    seq_prefetch_update_scene(context->scene);
+    pfjob->need_scene_update = false;
+  }
   seq_prefetch_update_context(context);
 
   BLI_threadpool_remove(&pfjob->threads, pfjob);
@@ -30,11 +30,13 @@
 #include "DNA_scene_types.h"
 #include "DNA_sequence_types.h"
 #include "DNA_space_types.h"
+#include "DNA_userdef_types.h"
 
 #include "BLI_fileops.h"
 #include "BLI_listbase.h"
 #include "BLI_path_util.h"
 #include "BLI_string.h"
+#include "BLI_threads.h"
 
 #ifdef WIN32
 #  include "BLI_winstuff.h"
@@ -54,6 +56,8 @@
 #include "IMB_imbuf_types.h"
 #include "IMB_metadata.h"
 
+#include "PIL_time.h"
+
 #include "SEQ_proxy.h"
 #include "SEQ_render.h"
 #include "SEQ_sequencer.h"
@@ -538,6 +542,146 @@ void SEQ_proxy_rebuild(SeqIndexBuildContext *context,
   }
 }
 
+/* Shared by the threads building the movie strips of a queue. */
+typedef struct SeqProxyBuildThreadData {
+  SeqIndexBuildContext **contexts;
+  /* Progress of every context. */
+  float *progress;
+  ThreadMutex mutex;
+  int contexts_len;
+  int next_context;
+  int threads_done;
+
+  short *stop;
+  short *do_update;
+} SeqProxyBuildThreadData;
+
+static bool seq_proxy_build_in_thread(const SeqIndexBuildContext *context)
+{
+  /* Movies are built by the indexer on their own anim, other strips render through the
+   * sequencer and are built one by one. */
+  return context->index_context != NULL;
+}
+
+static int seq_proxy_build_thread_count(void)
+{
+  if (U.sequencer_proxy_build_threads > 0) {
+    return U.sequencer_proxy_build_threads;
+  }
+  /* Decoding and encoding use multiple threads already. */
+  return max_ii(1, BLI_system_thread_count() / 4);
+}
+
+static void *seq_proxy_build_thread(void *data_v)
+{
+  SeqProxyBuildThreadData *data = data_v;
+
+  while (!*data->stop) {
+    int index = -1;
+
+    BLI_mutex_lock(&data->mutex);
+    while (data->next_context < data->contexts_len) {
+      const int i = data->next_context++;
+      if (seq_proxy_build_in_thread(data->contexts[i])) {
+        index = i;
+        break;
+      }
+    }
+    BLI_mutex_unlock(&data->mutex);
+
+    if (index == -1) {
+      break;
+    }
+
+    SEQ_proxy_rebuild(data->contexts[index], data->stop, data->do_update, &data->progress[index]);
+    data->progress[index] = 1.0f;
+  }
+
+  BLI_mutex_lock(&data->mutex);
+  data->threads_done++;
+  BLI_mutex_unlock(&data->mutex);
+
+  return NULL;
+}
+
+static float seq_proxy_build_progress(SeqProxyBuildThreadData *data)
+{
+  float progress = 0.0f;
+  for (int i = 0; i < data->contexts_len; i++) {
+    progress += data->progress[i];
+  }
+  return progress / data->contexts_len;
+}
+
+/**
+ * Build the proxies of all #SeqIndexBuildContext in the queue. Movie strips are built in
+ * parallel, limited by the proxy build threads preference.
+ */
+void SEQ_proxy_rebuild_queue(ListBase *queue, short *stop, short *do_update, float *progress)
+{
+  SeqProxyBuildThreadData data = {NULL};
+  int threads_len = 0;
+
+  data.contexts_len = BLI_listbase_count(queue);
+  if (data.contexts_len == 0) {
+    return;
+  }
+
+  data.contexts = MEM_mallocN(sizeof(*data.contexts) * data.contexts_len, __func__);
+  data.progress = MEM_callocN(sizeof(*data.progress) * data.contexts_len, __func__);
+  data.stop = stop;
+  data.do_update = do_update;
+  BLI_mutex_init(&data.mutex);
+
+  int i = 0;
+  LISTBASE_FOREACH (LinkData *, link, queue) {
+    data.contexts[i] = link->data;
+    if (seq_proxy_build_in_thread(link->data)) {
+      threads_len++;
+    }
+    i++;
+  }
+  threads_len = min_ii(threads_len, seq_proxy_build_thread_count());
+
+  if (threads_len > 0) {
+    ListBase threads;
+    BLI_threadpool_init(&threads, seq_proxy_build_thread, threads_len);
+    for (i = 0; i < threads_len; i++) {
+      BLI_threadpool_insert(&threads, &data);
+    }
+
+    /* Report the combined progress until all threads are done. */
+    while (true) {
+      BLI_mutex_lock(&data.mutex);
+      const bool done = data.threads_done == threads_len;
+      BLI_mutex_unlock(&data.mutex);
+
+      *progress = seq_proxy_build_progress(&data);
+      *do_update = true;
+
+      if (done) {
+        break;
+      }
+      PIL_sleep_ms(100);
+    }
+
+    BLI_threadpool_end(&threads);
+  }
+
+  for (i = 0; i < data.contexts_len && !*stop; i++) {
+    if (!seq_proxy_build_in_thread(data.contexts[i])) {
+      float context_progress = 0.0f;
+      SEQ_proxy_rebuild(data.contexts[i], stop, do_update, &context_progress);
+      data.progress[i] = 1.0f;
+      *progress = seq_proxy_build_progress(&data);
+    }
+  }
+
+  BLI_mutex_end(&data.mutex);
+  MEM_freeN(data.contexts);
+  MEM_freeN(data.progress);
+}
+
 void SEQ_proxy_rebuild_finish(SeqIndexBuildContext *context, bool stop)
 {
   if (context->index_context) {
@@ -37,6 +37,7 @@
 #include "BLI_linklist.h"
 #include "BLI_listbase.h"
 #include "BLI_path_util.h"
+#include "BLI_task.h"
 
 #include "BKE_anim_data.h"
 #include "BKE_animsys.h"
@@ -1907,6 +1908,86 @@ static ImBuf *seq_render_strip_stack_apply_effect(
   return out;
 }
 
+/**
+ * Strips that can be rendered in parallel with the other strips of a stack: they don't render
+ * other strips (effect inputs, meta and scene strips, modifier masks).
+ */
+static bool seq_render_strip_is_independent(Sequence *seq)
+{
+  if (!ELEM(seq->type, SEQ_TYPE_IMAGE, SEQ_TYPE_MOVIE)) {
+    return false;
+  }
+  LISTBASE_FOREACH (SequenceModifierData *, smd, &seq->modifiers) {
+    if (smd->mask_sequence || smd->mask_id) {
+      return false;
+    }
+  }
+  return true;
+}
+
+typedef struct SeqRenderStripTask {
+  Sequence *seq;
+  SeqRenderState state;
+  float timeline_frame;
+  ImBuf *ibuf;
+} SeqRenderStripTask;
+
+static void seq_render_strip_task(TaskPool *__restrict pool, void *taskdata)
+{
+  const SeqRenderData *context = BLI_task_pool_user_data(pool);
+  SeqRenderStripTask *task = taskdata;
+
+  task->ibuf = seq_render_strip(context, &task->state, task->seq, task->timeline_frame);
+}
+
+/**
+ * Render the strips of \a seq_arr for which \a do_render is set. Independent strips are
+ * decoded and rendered in parallel first, the other strips are rendered in order afterwards,
+ * they may render strips of the stack again (e.g. adjustment strips), using the cache.
+ */
+static void seq_render_strip_stack_strips(const SeqRenderData *context,
+                                          SeqRenderState *state,
+                                          Sequence **seq_arr,
+                                          const bool *do_render,
+                                          int count,
+                                          float timeline_frame,
+                                          ImBuf **r_ibufs)
+{
+  SeqRenderStripTask tasks[MAXSEQ + 1];
+  int tasks_index[MAXSEQ + 1];
+  int num_tasks = 0;
+
+  for (int i = 0; i < count; i++) {
+    if (do_render[i] && seq_render_strip_is_independent(seq_arr[i])) {
+      tasks[num_tasks].seq = seq_arr[i];
+      tasks[num_tasks].state = *state;
+      tasks[num_tasks].timeline_frame = timeline_frame;
+      tasks[num_tasks].ibuf = NULL;
+      tasks_index[num_tasks] = i;
+      num_tasks++;
+    }
+  }
+
+  if (num_tasks > 1) {
+    TaskPool *task_pool = BLI_task_pool_create((void *)context, TASK_PRIORITY_HIGH);
+    for (int i = 0; i < num_tasks; i++) {
+      BLI_task_pool_push(task_pool, seq_render_strip_task, &tasks[i], false, NULL);
+    }
+    BLI_task_pool_work_and_wait(task_pool);
+    BLI_task_pool_free(task_pool);
+
+    for (int i = 0; i < num_tasks; i++) {
+      r_ibufs[tasks_index[i]] = tasks[i].ibuf;
+    }
+  }
+
+  for (int i = 0; i < count; i++) {
+    if (do_render[i] && r_ibufs[i] == NULL) {
+      r_ibufs[i] = seq_render_strip(context, state, seq_arr[i], timeline_frame);
+    }
+  }
+}
+
 static ImBuf *seq_render_strip_stack(const SeqRenderData *context,
                                      SeqRenderState *state,
                                      ListBase *seqbasep,
@@ -1914,6 +1995,9 @@ static ImBuf *seq_render_strip_stack(const SeqRenderData *context,
                                      int chanshown)
 {
   Sequence *seq_arr[MAXSEQ + 1];
+  ImBuf *ibufs[MAXSEQ + 1] = {NULL};
+  bool do_render[MAXSEQ + 1] = {false};
+  int early_out = EARLY_NO_INPUT;
   int count;
   int i;
   ImBuf *out = NULL;
@@ -1924,8 +2008,8 @@ static ImBuf *seq_render_strip_stack(const SeqRenderData *context,
     return NULL;
   }
 
+  /* Find the lowest strip the stack is blended onto. */
   for (i = count - 1; i >= 0; i--) {
-    int early_out;
     Sequence *seq = seq_arr[i];
 
     out = seq_cache_get(context, seq, timeline_frame, SEQ_CACHE_STORE_COMPOSITE);
@@ -1934,48 +2018,55 @@ static ImBuf *seq_render_strip_stack(const SeqRenderData *context,
       break;
     }
     if (seq->blend_mode == SEQ_BLEND_REPLACE) {
-      out = seq_render_strip(context, state, seq, timeline_frame);
+      early_out = EARLY_NO_INPUT;
       break;
     }
 
     early_out = seq_get_early_out_for_blend_mode(seq);
 
-    switch (early_out) {
-      case EARLY_NO_INPUT:
-      case EARLY_USE_INPUT_2:
-        out = seq_render_strip(context, state, seq, timeline_frame);
-        break;
-      case EARLY_USE_INPUT_1:
-        if (i == 0) {
-          out = IMB_allocImBuf(context->rectx, context->recty, 32, IB_rect);
-        }
-        break;
-      case EARLY_DO_EFFECT:
-        if (i == 0) {
-          ImBuf *ibuf1 = IMB_allocImBuf(context->rectx, context->recty, 32, IB_rect);
-          ImBuf *ibuf2 = seq_render_strip(context, state, seq, timeline_frame);
+    if (ELEM(early_out, EARLY_NO_INPUT, EARLY_USE_INPUT_2) || i == 0) {
+      break;
+    }
+  }
 
-          out = seq_render_strip_stack_apply_effect(context, seq, timeline_frame, ibuf1, ibuf2);
+  const int base = i;
+  if (out == NULL && early_out != EARLY_USE_INPUT_1) {
+    do_render[base] = true;
+  }
+  for (i = base + 1; i < count; i++) {
+    do_render[i] = seq_get_early_out_for_blend_mode(seq_arr[i]) == EARLY_DO_EFFECT;
+  }
 
-          seq_cache_put(context, seq_arr[i], timeline_frame, SEQ_CACHE_STORE_COMPOSITE, out);
+  seq_render_strip_stack_strips(context, state, seq_arr, do_render, count, timeline_frame, ibufs);
 
-          IMB_freeImBuf(ibuf1);
-          IMB_freeImBuf(ibuf2);
-        }
-        break;
+  /* Blend the rendered strips onto the lowest one. */
+  if (out == NULL) {
+    if (early_out == EARLY_USE_INPUT_1) {
+      out = IMB_allocImBuf(context->rectx, context->recty, 32, IB_rect);
     }
-    if (out) {
-      break;
+    else if (early_out == EARLY_DO_EFFECT) {
+      ImBuf *ibuf1 = IMB_allocImBuf(context->rectx, context->recty, 32, IB_rect);
+      ImBuf *ibuf2 = ibufs[base];
+
+      out = seq_render_strip_stack_apply_effect(
+          context, seq_arr[base], timeline_frame, ibuf1, ibuf2);
+
+      seq_cache_put(context, seq_arr[base], timeline_frame, SEQ_CACHE_STORE_COMPOSITE, out);
+
+      IMB_freeImBuf(ibuf1);
+      IMB_freeImBuf(ibuf2);
+    }
+    else {
+      out = ibufs[base];
     }
   }
 
-  i++;
-  for (; i < count; i++) {
+  for (i = base + 1; i < count; i++) {
     Sequence *seq = seq_arr[i];
 
-    if (seq_get_early_out_for_blend_mode(seq) == EARLY_DO_EFFECT) {
+    if (do_render[i]) {
       ImBuf *ibuf1 = out;
-      ImBuf *ibuf2 = seq_render_strip(context, state, seq, timeline_frame);
+      ImBuf *ibuf2 = ibufs[i];
 
       out = seq_render_strip_stack_apply_effect(context, seq, timeline_frame, ibuf1, ibuf2);
 
@@ -34,6 +34,7 @@
 #  include "DNA_texture_types.h"
 
 #  include "BLI_math.h"
+#  include "BLI_task.h"
 #  include "BLI_utildefines.h"
 
 #  include "BKE_cloth.h"
@@ -644,6 +645,105 @@ DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector
   del_lfvector(temp);
 }
 
+/* Blocks of every row of a sparse symmetric big matrix, so it can be multiplied with a long
+ * vector in parallel. The blocks of each row are
+ * `blocks[offsets[row]]` to `blocks[offsets[row + 1]]`, stored as `block * 2 + transposed`. */
+typedef struct BFMatrixRows {
+  unsigned int *offsets;
+  unsigned int *blocks;
+} BFMatrixRows;
+
+static void bfmatrix_rows_create(BFMatrixRows *rows, const fmatrix3x3 *matrix)
+{
+  const unsigned int vcount = matrix[0].vcount;
+  const unsigned int tot = matrix[0].vcount + matrix[0].scount;
+  unsigned int *offsets = MEM_calloc_arrayN(vcount + 1, sizeof(*offsets), __func__);
+  unsigned int *blocks = MEM_malloc_arrayN(
+      max_ii(2 * matrix[0].scount, 1), sizeof(*blocks), __func__);
+
+  for (unsigned int i = vcount; i < tot; i++) {
+    offsets[matrix[i].r + 1]++;
+    offsets[matrix[i].c + 1]++;
+  }
+  for (unsigned int i = 0; i < vcount; i++) {
+    offsets[i + 1] += offsets[i];
+  }
+  /* Blocks stay in matrix order within each row, so sums are done in the same order as in
+   * #mul_bfmatrix_lfvector. Temporarily advance the row starts, restored below. */
+  for (unsigned int i = vcount; i < tot; i++) {
+    blocks[offsets[matrix[i].r]++] = i * 2;
+    blocks[offsets[matrix[i].c]++] = i * 2 + 1;
+  }
+  for (unsigned int i = vcount; i > 0; i--) {
+    offsets[i] = offsets[i - 1];
+  }
+  offsets[0] = 0;
+
+  rows->offsets = offsets;
+  rows->blocks = blocks;
+}
+
+static void bfmatrix_rows_free(BFMatrixRows *rows)
+{
+  MEM_freeN(rows->offsets);
+  MEM_freeN(rows->blocks);
+}
+
+typedef struct BFMatrixMulData {
+  float (*to)[3];
+  const fmatrix3x3 *from;
+  const BFMatrixRows *rows;
+  const lfVector *fLongVector;
+} BFMatrixMulData;
+
+static void mul_bfmatrix_lfvector_rows_task_cb(void *__restrict userdata,
+                                               const int i,
+                                               const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const BFMatrixMulData *data = userdata;
+  const fmatrix3x3 *from = data->from;
+  const lfVector *fLongVector = data->fLongVector;
+  /* Lower (transposed) and upper triangle including the diagonal, accumulated separately as in
+   * #mul_bfmatrix_lfvector. */
+  float lower[3] = {0.0f, 0.0f, 0.0f};
+  float upper[3] = {0.0f, 0.0f, 0.0f};
+
+  muladd_fmatrix_fvector(upper, from[i].m, fLongVector[from[i].c]);
+
+  const unsigned int *block = &data->rows->blocks[data->rows->offsets[i]];
+  const unsigned int *block_end = &data->rows->blocks[data->rows->offsets[i + 1]];
+  for (; block != block_end; block++) {
+    const fmatrix3x3 *m = &from[*block >> 1];
+    if (*block & 1) {
+      muladd_fmatrixT_fvector(lower, m->m, fLongVector[m->r]);
+    }
+    else {
+      muladd_fmatrix_fvector(upper, m->m, fLongVector[m->c]);
+    }
+  }
+
+  add_v3_v3v3(data->to[i], lower, upper);
+}
+
+/* Same as #mul_bfmatrix_lfvector, using the row lists of the matrix to run in parallel. */
+static void mul_bfmatrix_lfvector_rows(float (*to)[3],
+                                       const fmatrix3x3 *from,
+                                       const BFMatrixRows *rows,
+                                       const lfVector *fLongVector)
+{
+  BFMatrixMulData data = {
+      .to = to,
+      .from = from,
+      .rows = rows,
+      .fLongVector = fLongVector,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 256;
+  BLI_task_parallel_range(
+      0, (int)from[0].vcount, &data, mul_bfmatrix_lfvector_rows_task_cb, &settings);
+}
+
 /* SPARSE SYMMETRIC sub big matrix with big matrix*/
 /* A -= B * float + C * float --> for big matrix */
 /* VERIFIED */
@@ -852,6 +952,7 @@ static int cg_filtered(lfVector *ldV, fmatrix3x3 *lA, lfVector *lB, lfVector *z,
 
 static int cg_filtered(lfVector *ldV,
                        fmatrix3x3 *lA,
+                       const BFMatrixRows *lA_rows,
                        lfVector *lB,
                        lfVector *z,
                        fmatrix3x3 *S,
@@ -879,7 +980,7 @@ static int cg_filtered(lfVector *ldV,
   delta_target = conjgrad_epsilon * conjgrad_epsilon * bnorm2;
 
   /* r = filter(B - A * dV) */
-  mul_bfmatrix_lfvector(AdV, lA, ldV);
+  mul_bfmatrix_lfvector_rows(AdV, lA, lA_rows, ldV);
   sub_lfvector_lfvector(r, lB, AdV, numverts);
   filter(r, S);
 
@@ -902,7 +1003,7 @@ static int cg_filtered(lfVector *ldV,
 #  endif
 
   while (delta_new > delta_target && conjgrad_loopcount < conjgrad_looplimit) {
-    mul_bfmatrix_lfvector(q, lA, c);
+    mul_bfmatrix_lfvector_rows(q, lA, lA_rows, c);
     filter(q, S);
 
     alpha = delta_new / dot_lfvector(c, q, numverts);
@@ -1162,7 +1263,11 @@ bool SIM_mass_spring_solve_velocities(Implicit_Data *data, float dt, ImplicitSol
 
   subadd_bfmatrixS_bfmatrixS(data->A, data->dFdV, dt, data->dFdX, (dt * dt));
 
-  mul_bfmatrix_lfvector(dFdXmV, data->dFdX, data->V);
+  /* A and dFdX have the same blocks. */
+  BFMatrixRows rows;
+  bfmatrix_rows_create(&rows, data->A);
+
+  mul_bfmatrix_lfvector_rows(dFdXmV, data->dFdX, &rows, data->V);
 
   add_lfvectorS_lfvectorS(data->B, data->F, dt, dFdXmV, (dt * dt), numverts);
 
@@ -1171,7 +1276,7 @@ bool SIM_mass_spring_solve_velocities(Implicit_Data *data, float dt, ImplicitSol
 #  endif
 
   /* Conjugate gradient algorithm to solve Ax=b. */
-  cg_filtered(data->dV, data->A, data->B, data->z, data->S, result);
+  cg_filtered(data->dV, data->A, &rows, data->B, data->z, data->S, result);
 
   // cg_filtered_pre(id->dV, id->A, id->B, id->z, id->S, id->P, id->Pinv, id->bigI);
 
@@ -1183,6 +1288,7 @@ bool SIM_mass_spring_solve_velocities(Implicit_Data *data, float dt, ImplicitSol
   /* advance velocities */
   add_lfvector_lfvector(data->Vnew, data->V, data->dV, numverts);
 
+  bfmatrix_rows_free(&rows);
   del_lfvector(dFdXmV);
 
   return result->status == SIM_SOLVER_SUCCESS;
@@ -88,6 +88,7 @@ void WM_init_state_start_with_console_set(bool value);
 void WM_init_window_focus_set(bool do_it);
 void WM_init_native_pixels(bool do_it);
 void WM_init_tablet_api(void);
+void WM_init_gpu_shader_cache(void);
 
 void WM_init(struct bContext *C, int argc, const char **argv);
 void WM_exit_ex(struct bContext *C, const bool do_python);
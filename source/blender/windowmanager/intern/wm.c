@@ -29,6 +29,7 @@
 #define DNA_DEPRECATED_ALLOW
 
 #include <stddef.h>
+#include <stdio.h>
 #include <string.h>
 
 #include "BLI_sys_types.h"
@@ -74,6 +75,8 @@
 
 #include "BLO_read_write.h"
 
+#include "PIL_time.h"
+
 /* ****************************************************** */
 
 static void window_manager_free_data(ID *id)
@@ -626,6 +629,26 @@ void wm_close_and_free_all(bContext *C, ListBase *wmlist)
   }
 }
 
+/**
+ * Print the time spent in each phase of a main loop iteration for `--debug-wm-time`.
+ * Only iterations slower than a 60 Hz frame are printed, to point at the phase causing a stall.
+ */
+static void wm_main_loop_time_print(const double time_start,
+                                    const double time_handlers,
+                                    const double time_notifiers,
+                                    const double time_draw)
+{
+  const double time_total = time_draw - time_start;
+  if (time_total < 1.0 / 60.0) {
+    return;
+  }
+  printf("Main loop: %.2f ms (handlers %.2f ms, notifiers %.2f ms, draw %.2f ms)\n",
+         time_total * 1000.0,
+         (time_handlers - time_start) * 1000.0,
+         (time_notifiers - time_handlers) * 1000.0,
+         (time_draw - time_notifiers) * 1000.0);
+}
+
 void WM_main(bContext *C)
 {
   /* Single refresh before handling events.
@@ -637,13 +660,23 @@ void WM_main(bContext *C)
     /* Get events from ghost, handle window events, add to window queues. */
     wm_window_process_events(C);
 
+    const bool use_time = (G.debug & G_DEBUG_WM_TIME) != 0;
+    const double time_start = use_time ? PIL_check_seconds_timer() : 0.0;
+
     /* Per window, all events to the window, screen, area and region handlers. */
     wm_event_do_handlers(C);
+    const double time_handlers = use_time ? PIL_check_seconds_timer() : 0.0;
 
     /* Wvents have left notes about changes, we handle and cache it. */
     wm_event_do_notifiers(C);
+    const double time_notifiers = use_time ? PIL_check_seconds_timer() : 0.0;
 
     /* Wxecute cached changes draw. */
     wm_draw_update(C);
+
+    if (use_time) {
+      wm_main_loop_time_print(
+          time_start, time_handlers, time_notifiers, PIL_check_seconds_timer());
+    }
   }
 }
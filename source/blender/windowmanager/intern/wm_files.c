@@ -411,6 +411,7 @@ static void wm_init_userdef(Main *bmain)
   }
 
   MEM_CacheLimiter_set_maximum(((size_t)U.memcachelimit) * 1024 * 1024);
+  IMB_anim_set_hardware_decode(U.movie_decode_flag & USER_MOVIE_DECODE_HARDWARE);
   BKE_sound_init(bmain);
 
   /* Update the temporary directory from the preferences or fallback to the system default. */
@@ -419,6 +420,8 @@ static void wm_init_userdef(Main *bmain)
   /* Update tablet API preference. */
   WM_init_tablet_api();
 
+  WM_init_gpu_shader_cache();
+
   BLO_sanitize_experimental_features_userpref_blend(&U);
 }
 
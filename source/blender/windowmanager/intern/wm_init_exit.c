@@ -49,6 +49,8 @@
 #include "BLI_timer.h"
 #include "BLI_utildefines.h"
 
+#include "PIL_time.h"
+
 #include "BLO_undofile.h"
 #include "BLO_writefile.h"
 
@@ -127,6 +129,7 @@
 #include "GPU_context.h"
 #include "GPU_init_exit.h"
 #include "GPU_material.h"
+#include "GPU_shader.h"
 
 #include "BKE_sound.h"
 #include "BKE_subdiv.h"
@@ -195,6 +198,16 @@ void WM_init_opengl(void)
   opengl_is_init = true;
 }
 
+/* Store compiled material shaders on disk when enabled in the preferences. */
+void WM_init_gpu_shader_cache(void)
+{
+  const char *dir = NULL;
+  if (U.gpu_flag & USER_GPU_FLAG_SHADER_CACHE) {
+    dir = BKE_appdir_folder_id_user_notest(BLENDER_USER_DATAFILES, "shader_cache");
+  }
+  GPU_shader_binary_cache_dir_set(dir);
+}
+
 static void sound_jack_sync_callback(Main *bmain, int mode, double time)
 {
   /* Ugly: Blender doesn't like it when the animation is played back during rendering. */
@@ -221,9 +234,23 @@ static void sound_jack_sync_callback(Main *bmain, int mode, double time)
   }
 }
 
+/**
+ * Print the time spent since the previous startup phase for `--debug-startup`.
+ */
+static void wm_init_time_print(const char *phase, double *r_time)
+{
+  if ((G.debug & G_DEBUG_STARTUP) == 0) {
+    return;
+  }
+  const double time = PIL_check_seconds_timer();
+  printf("Startup: %s %.2f ms\n", phase, (time - *r_time) * 1000.0);
+  *r_time = time;
+}
+
 /* only called once, for startup */
 void WM_init(bContext *C, int argc, const char **argv)
 {
+  double time = PIL_check_seconds_timer();
 
   if (!G.background) {
     wm_ghost_init(C); /* note: it assigns C to ghost! */
@@ -259,6 +286,7 @@ void WM_init(bContext *C, int argc, const char **argv)
   ED_spacetypes_init(); /* editors/space_api/spacetype.c */
 
   ED_node_init_butfuncs();
+  wm_init_time_print("types and editors", &time);
 
   BLF_init();
 
@@ -298,6 +326,7 @@ void WM_init(bContext *C, int argc, const char **argv)
                    NULL,
                    WM_init_state_app_template_get(),
                    &is_factory_startup);
+  wm_init_time_print("fonts, icons and startup file", &time);
 
   /* Call again to set from userpreferences... */
   BLT_lang_set(NULL);
@@ -322,6 +351,7 @@ void WM_init(bContext *C, int argc, const char **argv)
 
     UI_init();
   }
+  wm_init_time_print("OpenGL and interface", &time);
 
   BKE_subdiv_init();
 
@@ -338,6 +368,7 @@ void WM_init(bContext *C, int argc, const char **argv)
 #ifdef WITH_PYTHON
   BPY_python_start(C, argc, argv);
   BPY_python_reset(C);
+  wm_init_time_print("Python and add-ons", &time);
 #else
   (void)argc; /* unused */
   (void)argv; /* unused */
@@ -393,6 +424,7 @@ void WM_init(bContext *C, int argc, const char **argv)
       CTX_wm_window_set(C, NULL);
     }
   }
+  wm_init_time_print("load handlers", &time);
 }
 
 void WM_init_splash(bContext *C)
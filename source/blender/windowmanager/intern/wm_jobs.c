@@ -23,6 +23,7 @@
  * Threaded job manager (high level job access).
  */
 
+#include <math.h>
 #include <string.h>
 
 #include "DNA_windowmanager_types.h"
@@ -45,6 +46,12 @@
 
 #include "PIL_time.h"
 
+/**
+ * Smallest progress change that sends a #ND_JOB notifier. Every such notifier redraws the
+ * headers and status bars showing the progress, which isn't visible for tiny increments.
+ */
+#define WM_JOB_PROGRESS_NOTIFY_STEP 0.005f
+
 /*
  * Add new job
  * - register in WM
@@ -117,6 +124,8 @@ struct wmJob {
   int flag;
   short suspended, running, ready, do_update, stop, job_type;
   float progress;
+  /** Progress at the time of the last #ND_JOB notifier, to avoid redraws for tiny changes. */
+  float progress_notified;
 
   /** For display in header, identification */
   char name[128];
@@ -477,6 +486,7 @@ void WM_jobs_start(wmWindowManager *wm, wmJob *wm_job)
         wm_job->stop = false;
         wm_job->ready = false;
         wm_job->progress = 0.0;
+        wm_job->progress_notified = -1.0f;
 
         // printf("job started: %s\n", wm_job->name);
 
@@ -636,7 +646,12 @@ void wm_jobs_timer(wmWindowManager *wm, wmTimer *wt)
           }
 
           if (wm_job->flag & WM_JOB_PROGRESS) {
-            WM_event_add_notifier_ex(wm, wm_job->win, NC_WM | ND_JOB, NULL);
+            const float progress = wm_job->progress;
+            if (wm_job->ready ||
+                fabsf(progress - wm_job->progress_notified) >= WM_JOB_PROGRESS_NOTIFY_STEP) {
+              WM_event_add_notifier_ex(wm, wm_job->win, NC_WM | ND_JOB, NULL);
+              wm_job->progress_notified = progress;
+            }
           }
           wm_job->do_update = false;
         }
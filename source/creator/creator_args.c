@@ -591,6 +591,8 @@ static int arg_handle_print_help(int UNUSED(argc), const char **UNUSED(argv), vo
   BLI_args_print_arg_doc(ba, "--debug-gpu");
   BLI_args_print_arg_doc(ba, "--debug-gpu-force-workarounds");
   BLI_args_print_arg_doc(ba, "--debug-wm");
+  BLI_args_print_arg_doc(ba, "--debug-wm-time");
+  BLI_args_print_arg_doc(ba, "--debug-startup");
 #  ifdef WITH_XR_OPENXR
   BLI_args_print_arg_doc(ba, "--debug-xr");
   BLI_args_print_arg_doc(ba, "--debug-xr-time");
@@ -949,6 +951,14 @@ static const char arg_handle_debug_mode_generic_set_doc_wm[] =
     "\n\t"
     "Enable debug messages for the window manager, shows all operators in search, shows "
     "keymap errors.";
+static const char arg_handle_debug_mode_generic_set_doc_wm_time[] =
+    "\n\t"
+    "Enable timing messages for main loop iterations slower than a 60 Hz frame, split into event "
+    "handling, notifiers (including depsgraph updates) and drawing.";
+static const char arg_handle_debug_mode_generic_set_doc_startup[] =
+    "\n\t"
+    "Enable timing messages for the phases of the startup, such as reading the startup file and "
+    "starting Python including the registration of add-ons.";
 #  ifdef WITH_XR_OPENXR
 static const char arg_handle_debug_mode_generic_set_doc_xr[] =
     "\n\t"
@@ -2088,6 +2098,16 @@ void main_args_setup(bContext *C, bArgs *ba)
                (void *)G_DEBUG_HANDLERS);
   BLI_args_add(
       ba, NULL, "--debug-wm", CB_EX(arg_handle_debug_mode_generic_set, wm), (void *)G_DEBUG_WM);
+  BLI_args_add(ba,
+               NULL,
+               "--debug-wm-time",
+               CB_EX(arg_handle_debug_mode_generic_set, wm_time),
+               (void *)G_DEBUG_WM_TIME);
+  BLI_args_add(ba,
+               NULL,
+               "--debug-startup",
+               CB_EX(arg_handle_debug_mode_generic_set, startup),
+               (void *)G_DEBUG_STARTUP);
 #  ifdef WITH_XR_OPENXR
   BLI_args_add(
       ba, NULL, "--debug-xr", CB_EX(arg_handle_debug_mode_generic_set, xr), (void *)G_DEBUG_XR);